@@ -0,0 +1,2384 @@
+
+build/bin/user/_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    cat_plain(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 24             	sub    $0x24,%esp
+      14:	8b 39                	mov    (%ecx),%edi
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  int fd;
+  int idx = modern_consume_flags("cat", argc, argv, 1, &json_mode);
+      1c:	68 a0 17 00 00       	push   $0x17a0
+      21:	6a 01                	push   $0x1
+      23:	53                   	push   %ebx
+      24:	57                   	push   %edi
+      25:	68 6f 11 00 00       	push   $0x116f
+      2a:	e8 21 0f 00 00       	call   f50 <modern_consume_flags>
+
+  if(idx >= argc){
+      2f:	83 c4 20             	add    $0x20,%esp
+      32:	39 c7                	cmp    %eax,%edi
+      34:	7e 4e                	jle    84 <main+0x84>
+      36:	89 c6                	mov    %eax,%esi
+    cat_stream(0, "stdin");
+    exit();
+  }
+
+  for(int i = idx; i < argc; i++){
+      38:	8d 1c 83             	lea    (%ebx,%eax,4),%ebx
+      3b:	eb 1f                	jmp    5c <main+0x5c>
+      3d:	8d 76 00             	lea    0x0(%esi),%esi
+    cat_json(fd, source);
+      40:	e8 7b 01 00 00       	call   1c0 <cat_json>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat_stream(fd, argv[i]);
+    close(fd);
+      45:	83 ec 0c             	sub    $0xc,%esp
+  for(int i = idx; i < argc; i++){
+      48:	83 c6 01             	add    $0x1,%esi
+      4b:	83 c3 04             	add    $0x4,%ebx
+    close(fd);
+      4e:	57                   	push   %edi
+      4f:	e8 c7 04 00 00       	call   51b <close>
+  for(int i = idx; i < argc; i++){
+      54:	83 c4 10             	add    $0x10,%esp
+      57:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      5a:	74 3d                	je     99 <main+0x99>
+    if((fd = open(argv[i], 0)) < 0){
+      5c:	83 ec 08             	sub    $0x8,%esp
+      5f:	6a 00                	push   $0x0
+      61:	ff 33                	push   (%ebx)
+      63:	e8 cb 04 00 00       	call   533 <open>
+      68:	83 c4 10             	add    $0x10,%esp
+      6b:	89 c7                	mov    %eax,%edi
+      6d:	85 c0                	test   %eax,%eax
+      6f:	78 2d                	js     9e <main+0x9e>
+  if(json_mode)
+      71:	8b 0d a0 17 00 00    	mov    0x17a0,%ecx
+    cat_stream(fd, argv[i]);
+      77:	8b 13                	mov    (%ebx),%edx
+  if(json_mode)
+      79:	85 c9                	test   %ecx,%ecx
+      7b:	75 c3                	jne    40 <main+0x40>
+    cat_plain(fd);
+      7d:	e8 3e 00 00 00       	call   c0 <cat_plain>
+      82:	eb c1                	jmp    45 <main+0x45>
+  if(json_mode)
+      84:	83 3d a0 17 00 00 00 	cmpl   $0x0,0x17a0
+      8b:	74 25                	je     b2 <main+0xb2>
+    cat_json(fd, source);
+      8d:	ba 73 11 00 00       	mov    $0x1173,%edx
+      92:	31 c0                	xor    %eax,%eax
+      94:	e8 27 01 00 00       	call   1c0 <cat_json>
+    exit();
+      99:	e8 55 04 00 00       	call   4f3 <exit>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      9e:	56                   	push   %esi
+      9f:	ff 33                	push   (%ebx)
+      a1:	68 79 11 00 00       	push   $0x1179
+      a6:	6a 01                	push   $0x1
+      a8:	e8 f3 05 00 00       	call   6a0 <printf>
+      exit();
+      ad:	e8 41 04 00 00       	call   4f3 <exit>
+    cat_plain(fd);
+      b2:	31 c0                	xor    %eax,%eax
+      b4:	e8 07 00 00 00       	call   c0 <cat_plain>
+      b9:	eb de                	jmp    99 <main+0x99>
+      bb:	66 90                	xchg   %ax,%ax
+      bd:	66 90                	xchg   %ax,%ax
+      bf:	90                   	nop
+
+000000c0 <cat_plain>:
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	56                   	push   %esi
+      c4:	89 c6                	mov    %eax,%esi
+      c6:	53                   	push   %ebx
+      c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ce:	66 90                	xchg   %ax,%ax
+  while((n = splice(fd, 1, 64*1024)) > 0)
+      d0:	83 ec 04             	sub    $0x4,%esp
+      d3:	68 00 00 01 00       	push   $0x10000
+      d8:	6a 01                	push   $0x1
+      da:	56                   	push   %esi
+      db:	e8 f3 04 00 00       	call   5d3 <splice>
+      e0:	83 c4 10             	add    $0x10,%esp
+      e3:	85 c0                	test   %eax,%eax
+      e5:	7f e9                	jg     d0 <cat_plain+0x10>
+  if(n == 0)
+      e7:	75 1e                	jne    107 <cat_plain+0x47>
+      e9:	eb 3a                	jmp    125 <cat_plain+0x65>
+      eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+    if (write(1, buf, n) != n) {
+      f0:	83 ec 04             	sub    $0x4,%esp
+      f3:	53                   	push   %ebx
+      f4:	68 c0 1b 00 00       	push   $0x1bc0
+      f9:	6a 01                	push   $0x1
+      fb:	e8 13 04 00 00       	call   513 <write>
+     100:	83 c4 10             	add    $0x10,%esp
+     103:	39 d8                	cmp    %ebx,%eax
+     105:	75 25                	jne    12c <cat_plain+0x6c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+     107:	83 ec 04             	sub    $0x4,%esp
+     10a:	68 00 02 00 00       	push   $0x200
+     10f:	68 c0 1b 00 00       	push   $0x1bc0
+     114:	56                   	push   %esi
+     115:	e8 f1 03 00 00       	call   50b <read>
+     11a:	83 c4 10             	add    $0x10,%esp
+     11d:	89 c3                	mov    %eax,%ebx
+     11f:	85 c0                	test   %eax,%eax
+     121:	7f cd                	jg     f0 <cat_plain+0x30>
+  if(n < 0){
+     123:	75 1b                	jne    140 <cat_plain+0x80>
+}
+     125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     128:	5b                   	pop    %ebx
+     129:	5e                   	pop    %esi
+     12a:	5d                   	pop    %ebp
+     12b:	c3                   	ret
+      printf(1, "cat: write error\n");
+     12c:	83 ec 08             	sub    $0x8,%esp
+     12f:	68 40 11 00 00       	push   $0x1140
+     134:	6a 01                	push   $0x1
+     136:	e8 65 05 00 00       	call   6a0 <printf>
+      exit();
+     13b:	e8 b3 03 00 00       	call   4f3 <exit>
+    printf(1, "cat: read error\n");
+     140:	50                   	push   %eax
+     141:	50                   	push   %eax
+     142:	68 52 11 00 00       	push   $0x1152
+     147:	6a 01                	push   $0x1
+     149:	e8 52 05 00 00       	call   6a0 <printf>
+    exit();
+     14e:	e8 a0 03 00 00       	call   4f3 <exit>
+     153:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     15a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000160 <emit_line.constprop.0>:
+emit_line(const char *source, const char *line)
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	56                   	push   %esi
+     164:	89 c6                	mov    %eax,%esi
+     166:	53                   	push   %ebx
+  struct_begin(&w, 1);
+     167:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+emit_line(const char *source, const char *line)
+     16d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+     173:	6a 01                	push   $0x1
+     175:	53                   	push   %ebx
+     176:	e8 85 09 00 00       	call   b00 <struct_begin>
+  if(source)
+     17b:	83 c4 10             	add    $0x10,%esp
+     17e:	85 f6                	test   %esi,%esi
+     180:	74 12                	je     194 <emit_line.constprop.0+0x34>
+    struct_field_str(&w, "source", source);
+     182:	83 ec 04             	sub    $0x4,%esp
+     185:	56                   	push   %esi
+     186:	68 63 11 00 00       	push   $0x1163
+     18b:	53                   	push   %ebx
+     18c:	e8 9f 09 00 00       	call   b30 <struct_field_str>
+     191:	83 c4 10             	add    $0x10,%esp
+  struct_field_str(&w, "data", line ? line : "");
+     194:	83 ec 04             	sub    $0x4,%esp
+     197:	68 c0 17 00 00       	push   $0x17c0
+     19c:	68 6a 11 00 00       	push   $0x116a
+     1a1:	53                   	push   %ebx
+     1a2:	e8 89 09 00 00       	call   b30 <struct_field_str>
+  struct_end(&w);
+     1a7:	89 1c 24             	mov    %ebx,(%esp)
+     1aa:	e8 41 0c 00 00       	call   df0 <struct_end>
+}
+     1af:	83 c4 10             	add    $0x10,%esp
+     1b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1b5:	5b                   	pop    %ebx
+     1b6:	5e                   	pop    %esi
+     1b7:	5d                   	pop    %ebp
+     1b8:	c3                   	ret
+     1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <cat_json>:
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	57                   	push   %edi
+  int n, m = 0;
+     1c4:	31 ff                	xor    %edi,%edi
+{
+     1c6:	56                   	push   %esi
+     1c7:	53                   	push   %ebx
+     1c8:	83 ec 1c             	sub    $0x1c,%esp
+     1cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1ce:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     1d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     1d8:	83 ec 04             	sub    $0x4,%esp
+     1db:	68 00 02 00 00       	push   $0x200
+     1e0:	68 c0 1b 00 00       	push   $0x1bc0
+     1e5:	ff 75 e0             	push   -0x20(%ebp)
+     1e8:	e8 1e 03 00 00       	call   50b <read>
+     1ed:	83 c4 10             	add    $0x10,%esp
+     1f0:	89 c6                	mov    %eax,%esi
+     1f2:	85 c0                	test   %eax,%eax
+     1f4:	7e 7a                	jle    270 <cat_json+0xb0>
+    for(int i = 0; i < n; i++){
+     1f6:	31 db                	xor    %ebx,%ebx
+     1f8:	eb 3b                	jmp    235 <cat_json+0x75>
+     1fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        emit_line(source, linebuf);
+     200:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    for(int i = 0; i < n; i++){
+     203:	83 c3 01             	add    $0x1,%ebx
+        linebuf[m] = '\0';
+     206:	c6 05 bf 1b 00 00 00 	movb   $0x0,0x1bbf
+        emit_line(source, linebuf);
+     20d:	e8 4e ff ff ff       	call   160 <emit_line.constprop.0>
+    for(int i = 0; i < n; i++){
+     212:	39 de                	cmp    %ebx,%esi
+     214:	74 50                	je     266 <cat_json+0xa6>
+      char c = buf[i];
+     216:	0f b6 83 c0 1b 00 00 	movzbl 0x1bc0(%ebx),%eax
+        m = 0;
+     21d:	31 ff                	xor    %edi,%edi
+      if(c == '\n'){
+     21f:	3c 0a                	cmp    $0xa,%al
+     221:	74 2d                	je     250 <cat_json+0x90>
+        m = 0;
+     223:	31 c9                	xor    %ecx,%ecx
+    for(int i = 0; i < n; i++){
+     225:	83 c3 01             	add    $0x1,%ebx
+        linebuf[m++] = c;
+     228:	88 81 c0 17 00 00    	mov    %al,0x17c0(%ecx)
+     22e:	8d 79 01             	lea    0x1(%ecx),%edi
+    for(int i = 0; i < n; i++){
+     231:	39 de                	cmp    %ebx,%esi
+     233:	74 a3                	je     1d8 <cat_json+0x18>
+      char c = buf[i];
+     235:	0f b6 83 c0 1b 00 00 	movzbl 0x1bc0(%ebx),%eax
+      if(c == '\n'){
+     23c:	3c 0a                	cmp    $0xa,%al
+     23e:	74 10                	je     250 <cat_json+0x90>
+      } else if(m < (int)sizeof(linebuf) - 1){
+     240:	81 ff ff 03 00 00    	cmp    $0x3ff,%edi
+     246:	74 b8                	je     200 <cat_json+0x40>
+     248:	89 f9                	mov    %edi,%ecx
+     24a:	eb d9                	jmp    225 <cat_json+0x65>
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        emit_line(source, linebuf);
+     250:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    for(int i = 0; i < n; i++){
+     253:	83 c3 01             	add    $0x1,%ebx
+        linebuf[m] = '\0';
+     256:	c6 87 c0 17 00 00 00 	movb   $0x0,0x17c0(%edi)
+        emit_line(source, linebuf);
+     25d:	e8 fe fe ff ff       	call   160 <emit_line.constprop.0>
+    for(int i = 0; i < n; i++){
+     262:	39 de                	cmp    %ebx,%esi
+     264:	75 b0                	jne    216 <cat_json+0x56>
+        m = 0;
+     266:	31 ff                	xor    %edi,%edi
+     268:	e9 6b ff ff ff       	jmp    1d8 <cat_json+0x18>
+     26d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(m > 0){
+     270:	85 ff                	test   %edi,%edi
+     272:	74 0f                	je     283 <cat_json+0xc3>
+    emit_line(source, linebuf);
+     274:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    linebuf[m] = '\0';
+     277:	c6 87 c0 17 00 00 00 	movb   $0x0,0x17c0(%edi)
+    emit_line(source, linebuf);
+     27e:	e8 dd fe ff ff       	call   160 <emit_line.constprop.0>
+  if(n < 0){
+     283:	85 f6                	test   %esi,%esi
+     285:	75 08                	jne    28f <cat_json+0xcf>
+}
+     287:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     28a:	5b                   	pop    %ebx
+     28b:	5e                   	pop    %esi
+     28c:	5f                   	pop    %edi
+     28d:	5d                   	pop    %ebp
+     28e:	c3                   	ret
+    printf(1, "cat: read error\n");
+     28f:	50                   	push   %eax
+     290:	50                   	push   %eax
+     291:	68 52 11 00 00       	push   $0x1152
+     296:	6a 01                	push   $0x1
+     298:	e8 03 04 00 00       	call   6a0 <printf>
+    exit();
+     29d:	e8 51 02 00 00       	call   4f3 <exit>
+     2a2:	66 90                	xchg   %ax,%ax
+     2a4:	66 90                	xchg   %ax,%ax
+     2a6:	66 90                	xchg   %ax,%ax
+     2a8:	66 90                	xchg   %ax,%ax
+     2aa:	66 90                	xchg   %ax,%ax
+     2ac:	66 90                	xchg   %ax,%ax
+     2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2b1:	31 c0                	xor    %eax,%eax
+{
+     2b3:	89 e5                	mov    %esp,%ebp
+     2b5:	53                   	push   %ebx
+     2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     2c7:	83 c0 01             	add    $0x1,%eax
+     2ca:	84 d2                	test   %dl,%dl
+     2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+     2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d1:	89 c8                	mov    %ecx,%eax
+     2d3:	c9                   	leave
+     2d4:	c3                   	ret
+     2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	53                   	push   %ebx
+     2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+     2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     2ea:	0f b6 02             	movzbl (%edx),%eax
+     2ed:	84 c0                	test   %al,%al
+     2ef:	75 17                	jne    308 <strcmp+0x28>
+     2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+     2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f7:	90                   	nop
+     2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     2fc:	83 c2 01             	add    $0x1,%edx
+     2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     302:	84 c0                	test   %al,%al
+     304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+     306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     308:	0f b6 19             	movzbl (%ecx),%ebx
+     30b:	38 c3                	cmp    %al,%bl
+     30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     30f:	29 d8                	sub    %ebx,%eax
+}
+     311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     314:	c9                   	leave
+     315:	c3                   	ret
+     316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     324:	31 c0                	xor    %eax,%eax
+     326:	29 d8                	sub    %ebx,%eax
+}
+     328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32b:	c9                   	leave
+     32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     32d:	0f b6 19             	movzbl (%ecx),%ebx
+     330:	31 c0                	xor    %eax,%eax
+     332:	eb db                	jmp    30f <strcmp+0x2f>
+     334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     346:	80 3a 00             	cmpb   $0x0,(%edx)
+     349:	74 15                	je     360 <strlen+0x20>
+     34b:	31 c0                	xor    %eax,%eax
+     34d:	8d 76 00             	lea    0x0(%esi),%esi
+     350:	83 c0 01             	add    $0x1,%eax
+     353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     357:	89 c1                	mov    %eax,%ecx
+     359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+     35b:	89 c8                	mov    %ecx,%eax
+     35d:	5d                   	pop    %ebp
+     35e:	c3                   	ret
+     35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     360:	31 c9                	xor    %ecx,%ecx
+}
+     362:	5d                   	pop    %ebp
+     363:	89 c8                	mov    %ecx,%eax
+     365:	c3                   	ret
+     366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	57                   	push   %edi
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     37d:	89 d7                	mov    %edx,%edi
+     37f:	fc                   	cld
+     380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     385:	89 d0                	mov    %edx,%eax
+     387:	c9                   	leave
+     388:	c3                   	ret
+     389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	8b 45 08             	mov    0x8(%ebp),%eax
+     396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     39a:	0f b6 10             	movzbl (%eax),%edx
+     39d:	84 d2                	test   %dl,%dl
+     39f:	75 12                	jne    3b3 <strchr+0x23>
+     3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+     3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3a7:	90                   	nop
+     3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     3ac:	83 c0 01             	add    $0x1,%eax
+     3af:	84 d2                	test   %dl,%dl
+     3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+     3b3:	38 d1                	cmp    %dl,%cl
+     3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     3b7:	5d                   	pop    %ebp
+     3b8:	c3                   	ret
+     3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     3c0:	31 c0                	xor    %eax,%eax
+}
+     3c2:	5d                   	pop    %ebp
+     3c3:	c3                   	ret
+     3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	57                   	push   %edi
+     3d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     3d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     3d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     3d9:	31 db                	xor    %ebx,%ebx
+{
+     3db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     3de:	eb 27                	jmp    407 <gets+0x37>
+    cc = read(0, &c, 1);
+     3e0:	83 ec 04             	sub    $0x4,%esp
+     3e3:	6a 01                	push   $0x1
+     3e5:	56                   	push   %esi
+     3e6:	6a 00                	push   $0x0
+     3e8:	e8 1e 01 00 00       	call   50b <read>
+    if(cc < 1)
+     3ed:	83 c4 10             	add    $0x10,%esp
+     3f0:	85 c0                	test   %eax,%eax
+     3f2:	7e 1d                	jle    411 <gets+0x41>
+      break;
+    buf[i++] = c;
+     3f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     3fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     3ff:	3c 0a                	cmp    $0xa,%al
+     401:	74 10                	je     413 <gets+0x43>
+     403:	3c 0d                	cmp    $0xd,%al
+     405:	74 0c                	je     413 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     407:	89 df                	mov    %ebx,%edi
+     409:	83 c3 01             	add    $0x1,%ebx
+     40c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     40f:	7c cf                	jl     3e0 <gets+0x10>
+     411:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     41d:	5b                   	pop    %ebx
+     41e:	5e                   	pop    %esi
+     41f:	5f                   	pop    %edi
+     420:	5d                   	pop    %ebp
+     421:	c3                   	ret
+     422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	56                   	push   %esi
+     434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     435:	83 ec 08             	sub    $0x8,%esp
+     438:	6a 00                	push   $0x0
+     43a:	ff 75 08             	push   0x8(%ebp)
+     43d:	e8 f1 00 00 00       	call   533 <open>
+  if(fd < 0)
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     449:	83 ec 08             	sub    $0x8,%esp
+     44c:	ff 75 0c             	push   0xc(%ebp)
+     44f:	89 c3                	mov    %eax,%ebx
+     451:	50                   	push   %eax
+     452:	e8 f4 00 00 00       	call   54b <fstat>
+  close(fd);
+     457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     45c:	e8 ba 00 00 00       	call   51b <close>
+  return r;
+     461:	83 c4 10             	add    $0x10,%esp
+}
+     464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     467:	89 f0                	mov    %esi,%eax
+     469:	5b                   	pop    %ebx
+     46a:	5e                   	pop    %esi
+     46b:	5d                   	pop    %ebp
+     46c:	c3                   	ret
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     475:	eb ed                	jmp    464 <stat+0x34>
+     477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	53                   	push   %ebx
+     484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     487:	0f be 02             	movsbl (%edx),%eax
+     48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     495:	77 1e                	ja     4b5 <atoi+0x35>
+     497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     4a0:	83 c2 01             	add    $0x1,%edx
+     4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     4aa:	0f be 02             	movsbl (%edx),%eax
+     4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4b0:	80 fb 09             	cmp    $0x9,%bl
+     4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+     4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4b8:	89 c8                	mov    %ecx,%eax
+     4ba:	c9                   	leave
+     4bb:	c3                   	ret
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+     4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+     4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     4ce:	85 c0                	test   %eax,%eax
+     4d0:	7e 13                	jle    4e5 <memmove+0x25>
+     4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     4d4:	89 d7                	mov    %edx,%edi
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     4e1:	39 f8                	cmp    %edi,%eax
+     4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+     4e5:	5e                   	pop    %esi
+     4e6:	89 d0                	mov    %edx,%eax
+     4e8:	5f                   	pop    %edi
+     4e9:	5d                   	pop    %ebp
+     4ea:	c3                   	ret
+
+000004eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     4eb:	b8 01 00 00 00       	mov    $0x1,%eax
+     4f0:	cd 40                	int    $0x40
+     4f2:	c3                   	ret
+
+000004f3 <exit>:
+SYSCALL(exit)
+     4f3:	b8 02 00 00 00       	mov    $0x2,%eax
+     4f8:	cd 40                	int    $0x40
+     4fa:	c3                   	ret
+
+000004fb <wait>:
+SYSCALL(wait)
+     4fb:	b8 03 00 00 00       	mov    $0x3,%eax
+     500:	cd 40                	int    $0x40
+     502:	c3                   	ret
+
+00000503 <pipe>:
+SYSCALL(pipe)
+     503:	b8 04 00 00 00       	mov    $0x4,%eax
+     508:	cd 40                	int    $0x40
+     50a:	c3                   	ret
+
+0000050b <read>:
+SYSCALL(read)
+     50b:	b8 05 00 00 00       	mov    $0x5,%eax
+     510:	cd 40                	int    $0x40
+     512:	c3                   	ret
+
+00000513 <write>:
+SYSCALL(write)
+     513:	b8 10 00 00 00       	mov    $0x10,%eax
+     518:	cd 40                	int    $0x40
+     51a:	c3                   	ret
+
+0000051b <close>:
+SYSCALL(close)
+     51b:	b8 15 00 00 00       	mov    $0x15,%eax
+     520:	cd 40                	int    $0x40
+     522:	c3                   	ret
+
+00000523 <kill>:
+SYSCALL(kill)
+     523:	b8 06 00 00 00       	mov    $0x6,%eax
+     528:	cd 40                	int    $0x40
+     52a:	c3                   	ret
+
+0000052b <exec>:
+SYSCALL(exec)
+     52b:	b8 07 00 00 00       	mov    $0x7,%eax
+     530:	cd 40                	int    $0x40
+     532:	c3                   	ret
+
+00000533 <open>:
+SYSCALL(open)
+     533:	b8 0f 00 00 00       	mov    $0xf,%eax
+     538:	cd 40                	int    $0x40
+     53a:	c3                   	ret
+
+0000053b <mknod>:
+SYSCALL(mknod)
+     53b:	b8 11 00 00 00       	mov    $0x11,%eax
+     540:	cd 40                	int    $0x40
+     542:	c3                   	ret
+
+00000543 <unlink>:
+SYSCALL(unlink)
+     543:	b8 12 00 00 00       	mov    $0x12,%eax
+     548:	cd 40                	int    $0x40
+     54a:	c3                   	ret
+
+0000054b <fstat>:
+SYSCALL(fstat)
+     54b:	b8 08 00 00 00       	mov    $0x8,%eax
+     550:	cd 40                	int    $0x40
+     552:	c3                   	ret
+
+00000553 <link>:
+SYSCALL(link)
+     553:	b8 13 00 00 00       	mov    $0x13,%eax
+     558:	cd 40                	int    $0x40
+     55a:	c3                   	ret
+
+0000055b <mkdir>:
+SYSCALL(mkdir)
+     55b:	b8 14 00 00 00       	mov    $0x14,%eax
+     560:	cd 40                	int    $0x40
+     562:	c3                   	ret
+
+00000563 <chdir>:
+SYSCALL(chdir)
+     563:	b8 09 00 00 00       	mov    $0x9,%eax
+     568:	cd 40                	int    $0x40
+     56a:	c3                   	ret
+
+0000056b <dup>:
+SYSCALL(dup)
+     56b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     570:	cd 40                	int    $0x40
+     572:	c3                   	ret
+
+00000573 <getpid>:
+SYSCALL(getpid)
+     573:	b8 0b 00 00 00       	mov    $0xb,%eax
+     578:	cd 40                	int    $0x40
+     57a:	c3                   	ret
+
+0000057b <sbrk>:
+SYSCALL(sbrk)
+     57b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     580:	cd 40                	int    $0x40
+     582:	c3                   	ret
+
+00000583 <sleep>:
+SYSCALL(sleep)
+     583:	b8 0d 00 00 00       	mov    $0xd,%eax
+     588:	cd 40                	int    $0x40
+     58a:	c3                   	ret
+
+0000058b <uptime>:
+SYSCALL(uptime)
+     58b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     590:	cd 40                	int    $0x40
+     592:	c3                   	ret
+
+00000593 <poll>:
+SYSCALL(poll)
+     593:	b8 16 00 00 00       	mov    $0x16,%eax
+     598:	cd 40                	int    $0x40
+     59a:	c3                   	ret
+
+0000059b <fcntl>:
+SYSCALL(fcntl)
+     59b:	b8 17 00 00 00       	mov    $0x17,%eax
+     5a0:	cd 40                	int    $0x40
+     5a2:	c3                   	ret
+
+000005a3 <lseek>:
+SYSCALL(lseek)
+     5a3:	b8 18 00 00 00       	mov    $0x18,%eax
+     5a8:	cd 40                	int    $0x40
+     5aa:	c3                   	ret
+
+000005ab <pread>:
+SYSCALL(pread)
+     5ab:	b8 19 00 00 00       	mov    $0x19,%eax
+     5b0:	cd 40                	int    $0x40
+     5b2:	c3                   	ret
+
+000005b3 <pwrite>:
+SYSCALL(pwrite)
+     5b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     5b8:	cd 40                	int    $0x40
+     5ba:	c3                   	ret
+
+000005bb <readv>:
+SYSCALL(readv)
+     5bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     5c0:	cd 40                	int    $0x40
+     5c2:	c3                   	ret
+
+000005c3 <writev>:
+SYSCALL(writev)
+     5c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     5c8:	cd 40                	int    $0x40
+     5ca:	c3                   	ret
+
+000005cb <getdents>:
+SYSCALL(getdents)
+     5cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     5d0:	cd 40                	int    $0x40
+     5d2:	c3                   	ret
+
+000005d3 <splice>:
+SYSCALL(splice)
+     5d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     5d8:	cd 40                	int    $0x40
+     5da:	c3                   	ret
+
+000005db <ioring_setup>:
+SYSCALL(ioring_setup)
+     5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <ioring_enter>:
+SYSCALL(ioring_enter)
+     5e3:	b8 20 00 00 00       	mov    $0x20,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <batch>:
+SYSCALL(batch)
+     5eb:	b8 21 00 00 00       	mov    $0x21,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+     5f3:	66 90                	xchg   %ax,%ax
+     5f5:	66 90                	xchg   %ax,%ax
+     5f7:	66 90                	xchg   %ax,%ax
+     5f9:	66 90                	xchg   %ax,%ax
+     5fb:	66 90                	xchg   %ax,%ax
+     5fd:	66 90                	xchg   %ax,%ax
+     5ff:	90                   	nop
+
+00000600 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+     605:	53                   	push   %ebx
+     606:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     608:	89 d1                	mov    %edx,%ecx
+{
+     60a:	83 ec 3c             	sub    $0x3c,%esp
+     60d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     610:	85 d2                	test   %edx,%edx
+     612:	0f 89 80 00 00 00    	jns    698 <printint+0x98>
+     618:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     61c:	74 7a                	je     698 <printint+0x98>
+    x = -xx;
+     61e:	f7 d9                	neg    %ecx
+    neg = 1;
+     620:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     625:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     628:	31 f6                	xor    %esi,%esi
+     62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     630:	89 c8                	mov    %ecx,%eax
+     632:	31 d2                	xor    %edx,%edx
+     634:	89 f7                	mov    %esi,%edi
+     636:	f7 f3                	div    %ebx
+     638:	8d 76 01             	lea    0x1(%esi),%esi
+     63b:	0f b6 92 f0 11 00 00 	movzbl 0x11f0(%edx),%edx
+     642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     646:	89 ca                	mov    %ecx,%edx
+     648:	89 c1                	mov    %eax,%ecx
+     64a:	39 da                	cmp    %ebx,%edx
+     64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+     64e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     651:	85 c0                	test   %eax,%eax
+     653:	74 07                	je     65c <printint+0x5c>
+    buf[i++] = '-';
+     655:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     65a:	89 f7                	mov    %esi,%edi
+     65c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     65f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     662:	01 df                	add    %ebx,%edi
+     664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     668:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     66b:	83 ec 04             	sub    $0x4,%esp
+     66e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     671:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     674:	6a 01                	push   $0x1
+     676:	50                   	push   %eax
+     677:	56                   	push   %esi
+     678:	e8 96 fe ff ff       	call   513 <write>
+  while(--i >= 0)
+     67d:	89 f8                	mov    %edi,%eax
+     67f:	83 c4 10             	add    $0x10,%esp
+     682:	83 ef 01             	sub    $0x1,%edi
+     685:	39 d8                	cmp    %ebx,%eax
+     687:	75 df                	jne    668 <printint+0x68>
+}
+     689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     68c:	5b                   	pop    %ebx
+     68d:	5e                   	pop    %esi
+     68e:	5f                   	pop    %edi
+     68f:	5d                   	pop    %ebp
+     690:	c3                   	ret
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     698:	31 c0                	xor    %eax,%eax
+     69a:	eb 89                	jmp    625 <printint+0x25>
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     6a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     6ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     6af:	0f b6 1e             	movzbl (%esi),%ebx
+     6b2:	83 c6 01             	add    $0x1,%esi
+     6b5:	84 db                	test   %bl,%bl
+     6b7:	74 67                	je     720 <printf+0x80>
+     6b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     6bc:	31 d2                	xor    %edx,%edx
+     6be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     6c1:	eb 34                	jmp    6f7 <printf+0x57>
+     6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6c7:	90                   	nop
+     6c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     6cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     6d0:	83 f8 25             	cmp    $0x25,%eax
+     6d3:	74 18                	je     6ed <printf+0x4d>
+  write(fd, &c, 1);
+     6d5:	83 ec 04             	sub    $0x4,%esp
+     6d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     6db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     6de:	6a 01                	push   $0x1
+     6e0:	50                   	push   %eax
+     6e1:	57                   	push   %edi
+     6e2:	e8 2c fe ff ff       	call   513 <write>
+     6e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     6ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     6ed:	0f b6 1e             	movzbl (%esi),%ebx
+     6f0:	83 c6 01             	add    $0x1,%esi
+     6f3:	84 db                	test   %bl,%bl
+     6f5:	74 29                	je     720 <printf+0x80>
+    c = fmt[i] & 0xff;
+     6f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     6fa:	85 d2                	test   %edx,%edx
+     6fc:	74 ca                	je     6c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     6fe:	83 fa 25             	cmp    $0x25,%edx
+     701:	75 ea                	jne    6ed <printf+0x4d>
+      if(c == 'd'){
+     703:	83 f8 25             	cmp    $0x25,%eax
+     706:	0f 84 24 01 00 00    	je     830 <printf+0x190>
+     70c:	83 e8 63             	sub    $0x63,%eax
+     70f:	83 f8 15             	cmp    $0x15,%eax
+     712:	77 1c                	ja     730 <printf+0x90>
+     714:	ff 24 85 98 11 00 00 	jmp    *0x1198(,%eax,4)
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     723:	5b                   	pop    %ebx
+     724:	5e                   	pop    %esi
+     725:	5f                   	pop    %edi
+     726:	5d                   	pop    %ebp
+     727:	c3                   	ret
+     728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+  write(fd, &c, 1);
+     730:	83 ec 04             	sub    $0x4,%esp
+     733:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     736:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     73a:	6a 01                	push   $0x1
+     73c:	52                   	push   %edx
+     73d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     740:	57                   	push   %edi
+     741:	e8 cd fd ff ff       	call   513 <write>
+     746:	83 c4 0c             	add    $0xc,%esp
+     749:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     74c:	6a 01                	push   $0x1
+     74e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     751:	52                   	push   %edx
+     752:	57                   	push   %edi
+     753:	e8 bb fd ff ff       	call   513 <write>
+        putc(fd, c);
+     758:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     75b:	31 d2                	xor    %edx,%edx
+     75d:	eb 8e                	jmp    6ed <printf+0x4d>
+     75f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     763:	83 ec 0c             	sub    $0xc,%esp
+     766:	b9 10 00 00 00       	mov    $0x10,%ecx
+     76b:	8b 13                	mov    (%ebx),%edx
+     76d:	6a 00                	push   $0x0
+     76f:	89 f8                	mov    %edi,%eax
+        ap++;
+     771:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     774:	e8 87 fe ff ff       	call   600 <printint>
+        ap++;
+     779:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     77c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     77f:	31 d2                	xor    %edx,%edx
+     781:	e9 67 ff ff ff       	jmp    6ed <printf+0x4d>
+     786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     790:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     793:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     795:	83 c0 04             	add    $0x4,%eax
+     798:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     79b:	85 db                	test   %ebx,%ebx
+     79d:	0f 84 9d 00 00 00    	je     840 <printf+0x1a0>
+        while(*s != 0){
+     7a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     7a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     7a8:	84 c0                	test   %al,%al
+     7aa:	0f 84 3d ff ff ff    	je     6ed <printf+0x4d>
+     7b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     7b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     7b6:	89 de                	mov    %ebx,%esi
+     7b8:	89 d3                	mov    %edx,%ebx
+     7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     7c0:	83 ec 04             	sub    $0x4,%esp
+     7c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     7c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     7c9:	6a 01                	push   $0x1
+     7cb:	53                   	push   %ebx
+     7cc:	57                   	push   %edi
+     7cd:	e8 41 fd ff ff       	call   513 <write>
+        while(*s != 0){
+     7d2:	0f b6 06             	movzbl (%esi),%eax
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	84 c0                	test   %al,%al
+     7da:	75 e4                	jne    7c0 <printf+0x120>
+      state = 0;
+     7dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     7df:	31 d2                	xor    %edx,%edx
+     7e1:	e9 07 ff ff ff       	jmp    6ed <printf+0x4d>
+     7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     7f3:	83 ec 0c             	sub    $0xc,%esp
+     7f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     7fb:	8b 13                	mov    (%ebx),%edx
+     7fd:	6a 01                	push   $0x1
+     7ff:	e9 6b ff ff ff       	jmp    76f <printf+0xcf>
+     804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     808:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     80b:	83 ec 04             	sub    $0x4,%esp
+     80e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     811:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     813:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     816:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     819:	6a 01                	push   $0x1
+     81b:	52                   	push   %edx
+     81c:	57                   	push   %edi
+     81d:	e8 f1 fc ff ff       	call   513 <write>
+        ap++;
+     822:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     825:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     828:	31 d2                	xor    %edx,%edx
+     82a:	e9 be fe ff ff       	jmp    6ed <printf+0x4d>
+     82f:	90                   	nop
+  write(fd, &c, 1);
+     830:	83 ec 04             	sub    $0x4,%esp
+     833:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     836:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     839:	6a 01                	push   $0x1
+     83b:	e9 11 ff ff ff       	jmp    751 <printf+0xb1>
+     840:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     845:	bb 8e 11 00 00       	mov    $0x118e,%ebx
+     84a:	e9 61 ff ff ff       	jmp    7b0 <printf+0x110>
+     84f:	90                   	nop
+
+00000850 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     850:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     851:	a1 c0 1d 00 00       	mov    0x1dc0,%eax
+{
+     856:	89 e5                	mov    %esp,%ebp
+     858:	57                   	push   %edi
+     859:	56                   	push   %esi
+     85a:	53                   	push   %ebx
+     85b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     85e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     868:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     86a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     86c:	39 ca                	cmp    %ecx,%edx
+     86e:	73 30                	jae    8a0 <free+0x50>
+     870:	39 c1                	cmp    %eax,%ecx
+     872:	72 04                	jb     878 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     874:	39 c2                	cmp    %eax,%edx
+     876:	72 f0                	jb     868 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     878:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     87b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     87e:	39 f8                	cmp    %edi,%eax
+     880:	74 2e                	je     8b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     882:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     885:	8b 42 04             	mov    0x4(%edx),%eax
+     888:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     88b:	39 f1                	cmp    %esi,%ecx
+     88d:	74 38                	je     8c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     88f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     891:	5b                   	pop    %ebx
+  freep = p;
+     892:	89 15 c0 1d 00 00    	mov    %edx,0x1dc0
+}
+     898:	5e                   	pop    %esi
+     899:	5f                   	pop    %edi
+     89a:	5d                   	pop    %ebp
+     89b:	c3                   	ret
+     89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     8a0:	39 c1                	cmp    %eax,%ecx
+     8a2:	72 d0                	jb     874 <free+0x24>
+     8a4:	eb c2                	jmp    868 <free+0x18>
+     8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     8b0:	03 70 04             	add    0x4(%eax),%esi
+     8b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     8b6:	8b 02                	mov    (%edx),%eax
+     8b8:	8b 00                	mov    (%eax),%eax
+     8ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     8bd:	8b 42 04             	mov    0x4(%edx),%eax
+     8c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     8c3:	39 f1                	cmp    %esi,%ecx
+     8c5:	75 c8                	jne    88f <free+0x3f>
+    p->s.size += bp->s.size;
+     8c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     8ca:	89 15 c0 1d 00 00    	mov    %edx,0x1dc0
+    p->s.size += bp->s.size;
+     8d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     8d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     8d6:	89 0a                	mov    %ecx,(%edx)
+}
+     8d8:	5b                   	pop    %ebx
+     8d9:	5e                   	pop    %esi
+     8da:	5f                   	pop    %edi
+     8db:	5d                   	pop    %ebp
+     8dc:	c3                   	ret
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	57                   	push   %edi
+     8e4:	56                   	push   %esi
+     8e5:	53                   	push   %ebx
+     8e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     8ec:	8b 15 c0 1d 00 00    	mov    0x1dc0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     8f2:	8d 78 07             	lea    0x7(%eax),%edi
+     8f5:	c1 ef 03             	shr    $0x3,%edi
+     8f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     8fb:	85 d2                	test   %edx,%edx
+     8fd:	0f 84 8d 00 00 00    	je     990 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     903:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     905:	8b 48 04             	mov    0x4(%eax),%ecx
+     908:	39 f9                	cmp    %edi,%ecx
+     90a:	73 64                	jae    970 <malloc+0x90>
+  if(nu < 4096)
+     90c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     911:	39 df                	cmp    %ebx,%edi
+     913:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     916:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     91d:	eb 0a                	jmp    929 <malloc+0x49>
+     91f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     920:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     922:	8b 48 04             	mov    0x4(%eax),%ecx
+     925:	39 f9                	cmp    %edi,%ecx
+     927:	73 47                	jae    970 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     929:	89 c2                	mov    %eax,%edx
+     92b:	39 05 c0 1d 00 00    	cmp    %eax,0x1dc0
+     931:	75 ed                	jne    920 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     933:	83 ec 0c             	sub    $0xc,%esp
+     936:	56                   	push   %esi
+     937:	e8 3f fc ff ff       	call   57b <sbrk>
+  if(p == (char*)-1)
+     93c:	83 c4 10             	add    $0x10,%esp
+     93f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     942:	74 1c                	je     960 <malloc+0x80>
+  hp->s.size = nu;
+     944:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     947:	83 ec 0c             	sub    $0xc,%esp
+     94a:	83 c0 08             	add    $0x8,%eax
+     94d:	50                   	push   %eax
+     94e:	e8 fd fe ff ff       	call   850 <free>
+  return freep;
+     953:	8b 15 c0 1d 00 00    	mov    0x1dc0,%edx
+      if((p = morecore(nunits)) == 0)
+     959:	83 c4 10             	add    $0x10,%esp
+     95c:	85 d2                	test   %edx,%edx
+     95e:	75 c0                	jne    920 <malloc+0x40>
+        return 0;
+  }
+}
+     960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     963:	31 c0                	xor    %eax,%eax
+}
+     965:	5b                   	pop    %ebx
+     966:	5e                   	pop    %esi
+     967:	5f                   	pop    %edi
+     968:	5d                   	pop    %ebp
+     969:	c3                   	ret
+     96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     970:	39 cf                	cmp    %ecx,%edi
+     972:	74 4c                	je     9c0 <malloc+0xe0>
+        p->s.size -= nunits;
+     974:	29 f9                	sub    %edi,%ecx
+     976:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     979:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     97c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     97f:	89 15 c0 1d 00 00    	mov    %edx,0x1dc0
+}
+     985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     988:	83 c0 08             	add    $0x8,%eax
+}
+     98b:	5b                   	pop    %ebx
+     98c:	5e                   	pop    %esi
+     98d:	5f                   	pop    %edi
+     98e:	5d                   	pop    %ebp
+     98f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     990:	c7 05 c0 1d 00 00 c4 	movl   $0x1dc4,0x1dc0
+     997:	1d 00 00 
+    base.s.size = 0;
+     99a:	b8 c4 1d 00 00       	mov    $0x1dc4,%eax
+    base.s.ptr = freep = prevp = &base;
+     99f:	c7 05 c4 1d 00 00 c4 	movl   $0x1dc4,0x1dc4
+     9a6:	1d 00 00 
+    base.s.size = 0;
+     9a9:	c7 05 c8 1d 00 00 00 	movl   $0x0,0x1dc8
+     9b0:	00 00 00 
+    if(p->s.size >= nunits){
+     9b3:	e9 54 ff ff ff       	jmp    90c <malloc+0x2c>
+     9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     9c0:	8b 08                	mov    (%eax),%ecx
+     9c2:	89 0a                	mov    %ecx,(%edx)
+     9c4:	eb b9                	jmp    97f <malloc+0x9f>
+     9c6:	66 90                	xchg   %ax,%ax
+     9c8:	66 90                	xchg   %ax,%ax
+     9ca:	66 90                	xchg   %ax,%ax
+     9cc:	66 90                	xchg   %ax,%ax
+     9ce:	66 90                	xchg   %ax,%ax
+
+000009d0 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	57                   	push   %edi
+     9d4:	56                   	push   %esi
+     9d5:	53                   	push   %ebx
+     9d6:	83 ec 1c             	sub    $0x1c,%esp
+     9d9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+     9dc:	85 c9                	test   %ecx,%ecx
+     9de:	7e 51                	jle    a31 <put+0x61>
+     9e0:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+     9e2:	8b 40 08             	mov    0x8(%eax),%eax
+     9e5:	89 ce                	mov    %ecx,%esi
+     9e7:	85 c0                	test   %eax,%eax
+     9e9:	7e 55                	jle    a40 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+     9eb:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+     9ee:	8b 51 0c             	mov    0xc(%ecx),%edx
+     9f1:	8b 79 08             	mov    0x8(%ecx),%edi
+     9f4:	01 d7                	add    %edx,%edi
+     9f6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     9f9:	74 65                	je     a60 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+     9fb:	83 f8 20             	cmp    $0x20,%eax
+     9fe:	75 40                	jne    a40 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+     a00:	83 ec 04             	sub    $0x4,%esp
+     a03:	8d 43 10             	lea    0x10(%ebx),%eax
+     a06:	6a 20                	push   $0x20
+     a08:	50                   	push   %eax
+     a09:	ff 33                	push   (%ebx)
+     a0b:	e8 b3 fb ff ff       	call   5c3 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+     a10:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+     a13:	31 c0                	xor    %eax,%eax
+     a15:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     a1a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+     a1d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     a24:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+     a27:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     a2a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+     a2e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     a31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a34:	5b                   	pop    %ebx
+     a35:	5e                   	pop    %esi
+     a36:	5f                   	pop    %edi
+     a37:	5d                   	pop    %ebp
+     a38:	c3                   	ret
+     a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+     a40:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+     a43:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     a46:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+     a49:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+     a4d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+     a50:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a56:	5b                   	pop    %ebx
+     a57:	5e                   	pop    %esi
+     a58:	5f                   	pop    %edi
+     a59:	5d                   	pop    %ebp
+     a5a:	c3                   	ret
+     a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+      last->iov_len += n;
+     a60:	01 f2                	add    %esi,%edx
+     a62:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+     a65:	eb ca                	jmp    a31 <put+0x61>
+     a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a6e:	66 90                	xchg   %ax,%ax
+
+00000a70 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+     a70:	55                   	push   %ebp
+     a71:	89 e5                	mov    %esp,%ebp
+     a73:	57                   	push   %edi
+     a74:	89 d7                	mov    %edx,%edi
+     a76:	56                   	push   %esi
+     a77:	89 ce                	mov    %ecx,%esi
+     a79:	53                   	push   %ebx
+     a7a:	89 c3                	mov    %eax,%ebx
+     a7c:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+     a7f:	8b 40 0c             	mov    0xc(%eax),%eax
+     a82:	8b 53 08             	mov    0x8(%ebx),%edx
+     a85:	01 c1                	add    %eax,%ecx
+     a87:	83 f9 40             	cmp    $0x40,%ecx
+     a8a:	7f 3c                	jg     ac8 <putcopy+0x58>
+     a8c:	83 fa 20             	cmp    $0x20,%edx
+     a8f:	74 3f                	je     ad0 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+     a91:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+     a97:	83 ec 04             	sub    $0x4,%esp
+     a9a:	01 d0                	add    %edx,%eax
+     a9c:	56                   	push   %esi
+     a9d:	57                   	push   %edi
+     a9e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     aa1:	50                   	push   %eax
+     aa2:	e8 19 fa ff ff       	call   4c0 <memmove>
+  put(w, w->buf + w->nbuf, n);
+     aa7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     aaa:	89 f1                	mov    %esi,%ecx
+     aac:	03 53 0c             	add    0xc(%ebx),%edx
+     aaf:	89 d8                	mov    %ebx,%eax
+     ab1:	e8 1a ff ff ff       	call   9d0 <put>
+  w->nbuf += n;
+     ab6:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     abf:	5b                   	pop    %ebx
+     ac0:	5e                   	pop    %esi
+     ac1:	5f                   	pop    %edi
+     ac2:	5d                   	pop    %ebp
+     ac3:	c3                   	ret
+     ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+     ac8:	85 d2                	test   %edx,%edx
+     aca:	7e 16                	jle    ae2 <putcopy+0x72>
+     acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+     ad0:	83 ec 04             	sub    $0x4,%esp
+     ad3:	8d 43 10             	lea    0x10(%ebx),%eax
+     ad6:	52                   	push   %edx
+     ad7:	50                   	push   %eax
+     ad8:	ff 33                	push   (%ebx)
+     ada:	e8 e4 fa ff ff       	call   5c3 <writev>
+     adf:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+     ae2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     ae9:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+     aeb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     af2:	eb 9d                	jmp    a91 <putcopy+0x21>
+     af4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aff:	90                   	nop
+
+00000b00 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+     b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+     b09:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+     b10:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+     b12:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+     b19:	c7 40 10 01 12 00 00 	movl   $0x1201,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+     b20:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+     b27:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+     b2e:	5d                   	pop    %ebp
+     b2f:	c3                   	ret
+
+00000b30 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+     b30:	55                   	push   %ebp
+     b31:	89 e5                	mov    %esp,%ebp
+     b33:	57                   	push   %edi
+     b34:	56                   	push   %esi
+     b35:	53                   	push   %ebx
+     b36:	83 ec 1c             	sub    $0x1c,%esp
+     b39:	8b 7d 08             	mov    0x8(%ebp),%edi
+     b3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     b3f:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+     b42:	8b 47 04             	mov    0x4(%edi),%eax
+     b45:	85 c0                	test   %eax,%eax
+     b47:	0f 85 7b 01 00 00    	jne    cc8 <struct_field_str+0x198>
+    w->need_comma = 1;
+     b4d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     b54:	b9 01 00 00 00       	mov    $0x1,%ecx
+     b59:	ba 16 12 00 00       	mov    $0x1216,%edx
+     b5e:	89 f8                	mov    %edi,%eax
+     b60:	e8 6b fe ff ff       	call   9d0 <put>
+  put_str(w, key ? key : "");
+     b65:	85 db                	test   %ebx,%ebx
+     b67:	b8 6e 12 00 00       	mov    $0x126e,%eax
+     b6c:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     b6f:	83 ec 0c             	sub    $0xc,%esp
+     b72:	53                   	push   %ebx
+     b73:	e8 c8 f7 ff ff       	call   340 <strlen>
+     b78:	89 da                	mov    %ebx,%edx
+     b7a:	89 c1                	mov    %eax,%ecx
+     b7c:	89 f8                	mov    %edi,%eax
+     b7e:	e8 4d fe ff ff       	call   9d0 <put>
+  put(w, "\":\"", 3);
+     b83:	b9 03 00 00 00       	mov    $0x3,%ecx
+     b88:	ba 14 12 00 00       	mov    $0x1214,%edx
+     b8d:	89 f8                	mov    %edi,%eax
+     b8f:	e8 3c fe ff ff       	call   9d0 <put>
+  put_escaped(w, value ? value : "");
+     b94:	83 c4 10             	add    $0x10,%esp
+     b97:	85 f6                	test   %esi,%esi
+     b99:	0f 84 41 01 00 00    	je     ce0 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+     b9f:	0f b6 1e             	movzbl (%esi),%ebx
+     ba2:	89 f2                	mov    %esi,%edx
+     ba4:	84 db                	test   %bl,%bl
+     ba6:	0f 84 40 01 00 00    	je     cec <struct_field_str+0x1bc>
+     bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     bb0:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+     bb2:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+     bb5:	80 fb 0d             	cmp    $0xd,%bl
+     bb8:	74 7e                	je     c38 <struct_field_str+0x108>
+     bba:	7f 5c                	jg     c18 <struct_field_str+0xe8>
+     bbc:	80 fb 09             	cmp    $0x9,%bl
+     bbf:	0f 84 eb 00 00 00    	je     cb0 <struct_field_str+0x180>
+     bc5:	80 fb 0a             	cmp    $0xa,%bl
+     bc8:	0f 85 95 00 00 00    	jne    c63 <struct_field_str+0x133>
+    put(w, run, s - run);
+     bce:	29 d1                	sub    %edx,%ecx
+     bd0:	89 f8                	mov    %edi,%eax
+     bd2:	e8 f9 fd ff ff       	call   9d0 <put>
+      esc = "\\n";
+     bd7:	ba 0f 12 00 00       	mov    $0x120f,%edx
+      put(w, esc, 2);
+     bdc:	b9 02 00 00 00       	mov    $0x2,%ecx
+     be1:	89 f8                	mov    %edi,%eax
+     be3:	e8 e8 fd ff ff       	call   9d0 <put>
+    run = s + 1;
+     be8:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+     bea:	0f b6 1e             	movzbl (%esi),%ebx
+     bed:	84 db                	test   %bl,%bl
+     bef:	75 bf                	jne    bb0 <struct_field_str+0x80>
+  put(w, run, s - run);
+     bf1:	29 d6                	sub    %edx,%esi
+     bf3:	89 f1                	mov    %esi,%ecx
+     bf5:	89 f8                	mov    %edi,%eax
+     bf7:	e8 d4 fd ff ff       	call   9d0 <put>
+  put(w, "\"", 1);
+}
+     bfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+     bff:	89 f8                	mov    %edi,%eax
+     c01:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+     c06:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+     c07:	ba 16 12 00 00       	mov    $0x1216,%edx
+}
+     c0c:	5e                   	pop    %esi
+     c0d:	5f                   	pop    %edi
+     c0e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+     c0f:	e9 bc fd ff ff       	jmp    9d0 <put>
+     c14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     c18:	80 fb 22             	cmp    $0x22,%bl
+     c1b:	74 33                	je     c50 <struct_field_str+0x120>
+     c1d:	80 fb 5c             	cmp    $0x5c,%bl
+     c20:	75 41                	jne    c63 <struct_field_str+0x133>
+    put(w, run, s - run);
+     c22:	29 d1                	sub    %edx,%ecx
+     c24:	89 f8                	mov    %edi,%eax
+     c26:	e8 a5 fd ff ff       	call   9d0 <put>
+      esc = "\\\\";
+     c2b:	ba 03 12 00 00       	mov    $0x1203,%edx
+     c30:	eb aa                	jmp    bdc <struct_field_str+0xac>
+     c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+     c38:	29 d1                	sub    %edx,%ecx
+     c3a:	89 f8                	mov    %edi,%eax
+     c3c:	e8 8f fd ff ff       	call   9d0 <put>
+      esc = "\\r";
+     c41:	ba 0c 12 00 00       	mov    $0x120c,%edx
+     c46:	eb 94                	jmp    bdc <struct_field_str+0xac>
+     c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4f:	90                   	nop
+    put(w, run, s - run);
+     c50:	29 d1                	sub    %edx,%ecx
+     c52:	89 f8                	mov    %edi,%eax
+     c54:	e8 77 fd ff ff       	call   9d0 <put>
+      esc = "\\\"";
+     c59:	ba 06 12 00 00       	mov    $0x1206,%edx
+     c5e:	e9 79 ff ff ff       	jmp    bdc <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+     c63:	80 fb 1f             	cmp    $0x1f,%bl
+     c66:	77 82                	ja     bea <struct_field_str+0xba>
+    put(w, run, s - run);
+     c68:	29 d1                	sub    %edx,%ecx
+     c6a:	89 f8                	mov    %edi,%eax
+     c6c:	e8 5f fd ff ff       	call   9d0 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+     c71:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+     c73:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+     c76:	0f b7 05 30 12 00 00 	movzwl 0x1230,%eax
+     c7d:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+     c80:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+     c85:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+     c8c:	0f b6 d2             	movzbl %dl,%edx
+     c8f:	8a 82 18 12 00 00    	mov    0x1218(%edx),%al
+     c95:	8a a3 18 12 00 00    	mov    0x1218(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+     c9b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+     c9e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+     ca2:	89 f8                	mov    %edi,%eax
+     ca4:	e8 c7 fd ff ff       	call   a70 <putcopy>
+     ca9:	e9 3a ff ff ff       	jmp    be8 <struct_field_str+0xb8>
+     cae:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+     cb0:	29 d1                	sub    %edx,%ecx
+     cb2:	89 f8                	mov    %edi,%eax
+     cb4:	e8 17 fd ff ff       	call   9d0 <put>
+      esc = "\\t";
+     cb9:	ba 09 12 00 00       	mov    $0x1209,%edx
+     cbe:	e9 19 ff ff ff       	jmp    bdc <struct_field_str+0xac>
+     cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cc7:	90                   	nop
+    put(w, ",", 1);
+     cc8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     ccd:	ba 12 12 00 00       	mov    $0x1212,%edx
+     cd2:	89 f8                	mov    %edi,%eax
+     cd4:	e8 f7 fc ff ff       	call   9d0 <put>
+}
+     cd9:	e9 76 fe ff ff       	jmp    b54 <struct_field_str+0x24>
+     cde:	66 90                	xchg   %ax,%ax
+     ce0:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+     ce2:	ba 6e 12 00 00       	mov    $0x126e,%edx
+     ce7:	e9 09 ff ff ff       	jmp    bf5 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+     cec:	31 c9                	xor    %ecx,%ecx
+     cee:	e9 02 ff ff ff       	jmp    bf5 <struct_field_str+0xc5>
+     cf3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000d00 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+     d05:	53                   	push   %ebx
+     d06:	83 ec 1c             	sub    $0x1c,%esp
+     d09:	8b 7d 08             	mov    0x8(%ebp),%edi
+     d0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+     d0f:	8b 57 04             	mov    0x4(%edi),%edx
+     d12:	85 d2                	test   %edx,%edx
+     d14:	0f 85 b6 00 00 00    	jne    dd0 <struct_field_int+0xd0>
+    w->need_comma = 1;
+     d1a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     d21:	b9 01 00 00 00       	mov    $0x1,%ecx
+     d26:	ba 16 12 00 00       	mov    $0x1216,%edx
+     d2b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+     d2d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+     d32:	e8 99 fc ff ff       	call   9d0 <put>
+  put_str(w, key ? key : "");
+     d37:	85 db                	test   %ebx,%ebx
+     d39:	b8 6e 12 00 00       	mov    $0x126e,%eax
+     d3e:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     d41:	83 ec 0c             	sub    $0xc,%esp
+     d44:	53                   	push   %ebx
+     d45:	e8 f6 f5 ff ff       	call   340 <strlen>
+     d4a:	89 da                	mov    %ebx,%edx
+     d4c:	89 c1                	mov    %eax,%ecx
+     d4e:	89 f8                	mov    %edi,%eax
+     d50:	e8 7b fc ff ff       	call   9d0 <put>
+  put(w, "\":", 2);
+     d55:	b9 02 00 00 00       	mov    $0x2,%ecx
+     d5a:	ba 29 12 00 00       	mov    $0x1229,%edx
+     d5f:	89 f8                	mov    %edi,%eax
+     d61:	e8 6a fc ff ff       	call   9d0 <put>
+  x = value < 0 ? -(uint)value : value;
+     d66:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+     d69:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+     d6c:	83 c4 10             	add    $0x10,%esp
+     d6f:	f7 d9                	neg    %ecx
+     d71:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+     d75:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+     d78:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     d7d:	89 f3                	mov    %esi,%ebx
+     d7f:	83 ee 01             	sub    $0x1,%esi
+     d82:	f7 e1                	mul    %ecx
+     d84:	89 c8                	mov    %ecx,%eax
+     d86:	c1 ea 03             	shr    $0x3,%edx
+     d89:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     d8c:	01 ff                	add    %edi,%edi
+     d8e:	29 f8                	sub    %edi,%eax
+     d90:	83 c0 30             	add    $0x30,%eax
+     d93:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+     d97:	89 c8                	mov    %ecx,%eax
+     d99:	89 d1                	mov    %edx,%ecx
+     d9b:	83 f8 09             	cmp    $0x9,%eax
+     d9e:	77 d8                	ja     d78 <struct_field_int+0x78>
+  if(value < 0)
+     da0:	8b 45 10             	mov    0x10(%ebp),%eax
+     da3:	8b 7d 08             	mov    0x8(%ebp),%edi
+     da6:	85 c0                	test   %eax,%eax
+     da8:	79 08                	jns    db2 <struct_field_int+0xb2>
+    buf[--i] = '-';
+     daa:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+     daf:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+     db2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     db5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+     dba:	8d 14 30             	lea    (%eax,%esi,1),%edx
+     dbd:	29 f1                	sub    %esi,%ecx
+     dbf:	89 f8                	mov    %edi,%eax
+     dc1:	e8 aa fc ff ff       	call   a70 <putcopy>
+  put_int(w, value);
+}
+     dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dc9:	5b                   	pop    %ebx
+     dca:	5e                   	pop    %esi
+     dcb:	5f                   	pop    %edi
+     dcc:	5d                   	pop    %ebp
+     dcd:	c3                   	ret
+     dce:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+     dd0:	b9 01 00 00 00       	mov    $0x1,%ecx
+     dd5:	ba 12 12 00 00       	mov    $0x1212,%edx
+     dda:	89 f8                	mov    %edi,%eax
+     ddc:	e8 ef fb ff ff       	call   9d0 <put>
+}
+     de1:	e9 3b ff ff ff       	jmp    d21 <struct_field_int+0x21>
+     de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	56                   	push   %esi
+     df4:	53                   	push   %ebx
+     df5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+     df8:	8b 43 08             	mov    0x8(%ebx),%eax
+     dfb:	85 c0                	test   %eax,%eax
+     dfd:	7e 59                	jle    e58 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+     dff:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+     e02:	8b 4a 0c             	mov    0xc(%edx),%ecx
+     e05:	8b 72 08             	mov    0x8(%edx),%esi
+     e08:	01 ce                	add    %ecx,%esi
+     e0a:	81 fe 2c 12 00 00    	cmp    $0x122c,%esi
+     e10:	0f 84 aa 00 00 00    	je     ec0 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+     e16:	83 f8 20             	cmp    $0x20,%eax
+     e19:	75 75                	jne    e90 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+     e1b:	83 ec 04             	sub    $0x4,%esp
+     e1e:	8d 73 10             	lea    0x10(%ebx),%esi
+     e21:	6a 20                	push   $0x20
+     e23:	56                   	push   %esi
+     e24:	ff 33                	push   (%ebx)
+     e26:	e8 98 f7 ff ff       	call   5c3 <writev>
+  w->nbuf = 0;
+     e2b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+     e32:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+     e35:	c7 43 10 2c 12 00 00 	movl   $0x122c,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+     e3c:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+     e43:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+     e4a:	ba 01 00 00 00       	mov    $0x1,%edx
+     e4f:	eb 5a                	jmp    eab <struct_end+0xbb>
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+     e58:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     e5b:	83 c0 02             	add    $0x2,%eax
+     e5e:	c7 04 c3 2c 12 00 00 	movl   $0x122c,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     e65:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+     e6c:	00 
+  w->niov++;
+     e6d:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+     e70:	83 fa 01             	cmp    $0x1,%edx
+     e73:	74 58                	je     ecd <struct_end+0xdd>
+  w->niov = 0;
+     e75:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+     e7c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+     e83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e86:	5b                   	pop    %ebx
+     e87:	5e                   	pop    %esi
+     e88:	5d                   	pop    %ebp
+     e89:	c3                   	ret
+     e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+     e90:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     e93:	83 c0 02             	add    $0x2,%eax
+     e96:	8d 73 10             	lea    0x10(%ebx),%esi
+     e99:	c7 04 c3 2c 12 00 00 	movl   $0x122c,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     ea0:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+     ea7:	00 
+  w->niov++;
+     ea8:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+     eab:	83 ec 04             	sub    $0x4,%esp
+     eae:	52                   	push   %edx
+     eaf:	56                   	push   %esi
+     eb0:	ff 33                	push   (%ebx)
+     eb2:	e8 0c f7 ff ff       	call   5c3 <writev>
+     eb7:	83 c4 10             	add    $0x10,%esp
+     eba:	eb b9                	jmp    e75 <struct_end+0x85>
+     ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+     ec0:	83 c1 02             	add    $0x2,%ecx
+     ec3:	8d 73 10             	lea    0x10(%ebx),%esi
+     ec6:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+     ec9:	89 c2                	mov    %eax,%edx
+     ecb:	eb de                	jmp    eab <struct_end+0xbb>
+     ecd:	8d 73 10             	lea    0x10(%ebx),%esi
+     ed0:	e9 75 ff ff ff       	jmp    e4a <struct_end+0x5a>
+     ed5:	66 90                	xchg   %ax,%ax
+     ed7:	66 90                	xchg   %ax,%ax
+     ed9:	66 90                	xchg   %ax,%ax
+     edb:	66 90                	xchg   %ax,%ax
+     edd:	66 90                	xchg   %ax,%ax
+     edf:	90                   	nop
+
+00000ee0 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	56                   	push   %esi
+     ee4:	89 c6                	mov    %eax,%esi
+     ee6:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+     ee7:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+     eed:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+     ef3:	6a 01                	push   $0x1
+     ef5:	53                   	push   %ebx
+     ef6:	e8 05 fc ff ff       	call   b00 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+     efb:	83 c4 0c             	add    $0xc,%esp
+     efe:	56                   	push   %esi
+     eff:	68 32 12 00 00       	push   $0x1232
+     f04:	53                   	push   %ebx
+     f05:	e8 26 fc ff ff       	call   b30 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+     f0a:	83 c4 0c             	add    $0xc,%esp
+     f0d:	68 3a 12 00 00       	push   $0x123a
+     f12:	68 4b 12 00 00       	push   $0x124b
+     f17:	53                   	push   %ebx
+     f18:	e8 13 fc ff ff       	call   b30 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+     f1d:	83 c4 0c             	add    $0xc,%esp
+     f20:	68 ea 07 00 00       	push   $0x7ea
+     f25:	68 52 12 00 00       	push   $0x1252
+     f2a:	53                   	push   %ebx
+     f2b:	e8 d0 fd ff ff       	call   d00 <struct_field_int>
+  struct_end(&w);
+     f30:	89 1c 24             	mov    %ebx,(%esp)
+     f33:	e8 b8 fe ff ff       	call   df0 <struct_end>
+     f38:	83 c4 10             	add    $0x10,%esp
+}
+     f3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f3e:	5b                   	pop    %ebx
+     f3f:	5e                   	pop    %esi
+     f40:	5d                   	pop    %ebp
+     f41:	c3                   	ret
+     f42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f50 <modern_consume_flags>:
+{
+     f50:	55                   	push   %ebp
+     f51:	89 e5                	mov    %esp,%ebp
+     f53:	57                   	push   %edi
+     f54:	56                   	push   %esi
+     f55:	53                   	push   %ebx
+     f56:	83 ec 0c             	sub    $0xc,%esp
+     f59:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+     f5c:	85 f6                	test   %esi,%esi
+     f5e:	74 06                	je     f66 <modern_consume_flags+0x16>
+    *json_mode = 0;
+     f60:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+     f66:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+     f6a:	bf 01 00 00 00       	mov    $0x1,%edi
+     f6f:	7e 4c                	jle    fbd <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+     f71:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+     f74:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+     f77:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+     f7a:	68 57 12 00 00       	push   $0x1257
+     f7f:	53                   	push   %ebx
+     f80:	e8 5b f3 ff ff       	call   2e0 <strcmp>
+     f85:	83 c4 10             	add    $0x10,%esp
+     f88:	85 c0                	test   %eax,%eax
+     f8a:	74 58                	je     fe4 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+     f8c:	8b 45 14             	mov    0x14(%ebp),%eax
+     f8f:	85 c0                	test   %eax,%eax
+     f91:	74 2a                	je     fbd <modern_consume_flags+0x6d>
+     f93:	83 ec 08             	sub    $0x8,%esp
+     f96:	68 6f 12 00 00       	push   $0x126f
+     f9b:	53                   	push   %ebx
+     f9c:	e8 3f f3 ff ff       	call   2e0 <strcmp>
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	85 c0                	test   %eax,%eax
+     fa6:	74 28                	je     fd0 <modern_consume_flags+0x80>
+     fa8:	83 ec 08             	sub    $0x8,%esp
+     fab:	68 72 12 00 00       	push   $0x1272
+     fb0:	53                   	push   %ebx
+     fb1:	e8 2a f3 ff ff       	call   2e0 <strcmp>
+     fb6:	83 c4 10             	add    $0x10,%esp
+     fb9:	85 c0                	test   %eax,%eax
+     fbb:	74 13                	je     fd0 <modern_consume_flags+0x80>
+}
+     fbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fc0:	89 f8                	mov    %edi,%eax
+     fc2:	5b                   	pop    %ebx
+     fc3:	5e                   	pop    %esi
+     fc4:	5f                   	pop    %edi
+     fc5:	5d                   	pop    %ebp
+     fc6:	c3                   	ret
+     fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fce:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+     fd0:	85 f6                	test   %esi,%esi
+     fd2:	74 06                	je     fda <modern_consume_flags+0x8a>
+        *json_mode = 1;
+     fd4:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+     fda:	83 c7 01             	add    $0x1,%edi
+     fdd:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+     fe0:	75 8f                	jne    f71 <modern_consume_flags+0x21>
+     fe2:	eb d9                	jmp    fbd <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+     fe4:	85 f6                	test   %esi,%esi
+     fe6:	74 12                	je     ffa <modern_consume_flags+0xaa>
+  if(!json_mode){
+     fe8:	83 3e 00             	cmpl   $0x0,(%esi)
+     feb:	74 0d                	je     ffa <modern_consume_flags+0xaa>
+     fed:	8b 45 08             	mov    0x8(%ebp),%eax
+     ff0:	e8 eb fe ff ff       	call   ee0 <modern_print_version.part.0>
+      exit();
+     ff5:	e8 f9 f4 ff ff       	call   4f3 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+     ffa:	83 ec 0c             	sub    $0xc,%esp
+     ffd:	68 ea 07 00 00       	push   $0x7ea
+    1002:	68 3a 12 00 00       	push   $0x123a
+    1007:	ff 75 08             	push   0x8(%ebp)
+    100a:	68 61 12 00 00       	push   $0x1261
+    100f:	6a 01                	push   $0x1
+    1011:	e8 8a f6 ff ff       	call   6a0 <printf>
+}
+    1016:	83 c4 20             	add    $0x20,%esp
+    1019:	eb da                	jmp    ff5 <modern_consume_flags+0xa5>
+    101b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    101f:	90                   	nop
+
+00001020 <modern_print_version>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    1026:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    1029:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    102c:	85 d2                	test   %edx,%edx
+    102e:	74 10                	je     1040 <modern_print_version+0x20>
+}
+    1030:	c9                   	leave
+    1031:	e9 aa fe ff ff       	jmp    ee0 <modern_print_version.part.0>
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    1040:	83 ec 0c             	sub    $0xc,%esp
+    1043:	68 ea 07 00 00       	push   $0x7ea
+    1048:	68 3a 12 00 00       	push   $0x123a
+    104d:	50                   	push   %eax
+    104e:	68 61 12 00 00       	push   $0x1261
+    1053:	6a 01                	push   $0x1
+    1055:	e8 46 f6 ff ff       	call   6a0 <printf>
+}
+    105a:	83 c4 20             	add    $0x20,%esp
+}
+    105d:	c9                   	leave
+    105e:	c3                   	ret
+    105f:	90                   	nop
+
+00001060 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+    1066:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    106c:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    106f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1072:	8b 45 10             	mov    0x10(%ebp),%eax
+    1075:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    1078:	85 d2                	test   %edx,%edx
+    107a:	75 44                	jne    10c0 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    107c:	85 f6                	test   %esi,%esi
+    107e:	ba 79 12 00 00       	mov    $0x1279,%edx
+    1083:	0f 44 f2             	cmove  %edx,%esi
+    1086:	85 c0                	test   %eax,%eax
+    1088:	ba 6e 12 00 00       	mov    $0x126e,%edx
+    108d:	0f 44 c2             	cmove  %edx,%eax
+    1090:	85 db                	test   %ebx,%ebx
+    1092:	ba 7e 12 00 00       	mov    $0x127e,%edx
+    1097:	0f 44 da             	cmove  %edx,%ebx
+    109a:	83 ec 08             	sub    $0x8,%esp
+    109d:	56                   	push   %esi
+    109e:	50                   	push   %eax
+    109f:	53                   	push   %ebx
+    10a0:	ff 75 08             	push   0x8(%ebp)
+    10a3:	68 84 12 00 00       	push   $0x1284
+    10a8:	6a 01                	push   $0x1
+    10aa:	e8 f1 f5 ff ff       	call   6a0 <printf>
+    10af:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    10b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10b5:	5b                   	pop    %ebx
+    10b6:	5e                   	pop    %esi
+    10b7:	5f                   	pop    %edi
+    10b8:	5d                   	pop    %ebp
+    10b9:	c3                   	ret
+    10ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    10c0:	83 ec 08             	sub    $0x8,%esp
+    10c3:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    10c9:	89 45 10             	mov    %eax,0x10(%ebp)
+    10cc:	6a 01                	push   $0x1
+    10ce:	57                   	push   %edi
+    10cf:	e8 2c fa ff ff       	call   b00 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    10d4:	83 c4 0c             	add    $0xc,%esp
+    10d7:	ff 75 08             	push   0x8(%ebp)
+    10da:	68 32 12 00 00       	push   $0x1232
+    10df:	57                   	push   %edi
+    10e0:	e8 4b fa ff ff       	call   b30 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    10e5:	83 c4 0c             	add    $0xc,%esp
+    10e8:	ba 7e 12 00 00       	mov    $0x127e,%edx
+    10ed:	85 db                	test   %ebx,%ebx
+    10ef:	0f 44 da             	cmove  %edx,%ebx
+    10f2:	53                   	push   %ebx
+    10f3:	52                   	push   %edx
+    10f4:	57                   	push   %edi
+    10f5:	e8 36 fa ff ff       	call   b30 <struct_field_str>
+  if(target)
+    10fa:	8b 45 10             	mov    0x10(%ebp),%eax
+    10fd:	83 c4 10             	add    $0x10,%esp
+    1100:	85 c0                	test   %eax,%eax
+    1102:	74 12                	je     1116 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    1104:	83 ec 04             	sub    $0x4,%esp
+    1107:	50                   	push   %eax
+    1108:	68 92 12 00 00       	push   $0x1292
+    110d:	57                   	push   %edi
+    110e:	e8 1d fa ff ff       	call   b30 <struct_field_str>
+    1113:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    1116:	85 f6                	test   %esi,%esi
+    1118:	74 12                	je     112c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    111a:	83 ec 04             	sub    $0x4,%esp
+    111d:	56                   	push   %esi
+    111e:	68 99 12 00 00       	push   $0x1299
+    1123:	57                   	push   %edi
+    1124:	e8 07 fa ff ff       	call   b30 <struct_field_str>
+    1129:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    112c:	83 ec 0c             	sub    $0xc,%esp
+    112f:	57                   	push   %edi
+    1130:	e8 bb fc ff ff       	call   df0 <struct_end>
+    1135:	83 c4 10             	add    $0x10,%esp
+}
+    1138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    113b:	5b                   	pop    %ebx
+    113c:	5e                   	pop    %esi
+    113d:	5f                   	pop    %edi
+    113e:	5d                   	pop    %ebp
+    113f:	c3                   	ret
@@ -0,0 +1,2103 @@
+
+build/bin/user/_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 00 0f 00 00       	push   $0xf00
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 02 0f 00 00       	push   $0xf02
+  3e:	6a 01                	push   $0x1
+  40:	e8 1b 04 00 00       	call   460 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 e5 0f 00 00       	push   $0xfe5
+  55:	50                   	push   %eax
+  56:	68 02 0f 00 00       	push   $0xf02
+  5b:	6a 01                	push   $0x1
+  5d:	e8 fe 03 00 00       	call   460 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 49 02 00 00       	call   2b3 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 1e 01 00 00       	call   2cb <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 f1 00 00 00       	call   2f3 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 f4 00 00 00       	call   30b <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 ba 00 00 00       	call   2db <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+
+000002ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <exit>:
+SYSCALL(exit)
+ 2b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <wait>:
+SYSCALL(wait)
+ 2bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <pipe>:
+SYSCALL(pipe)
+ 2c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <read>:
+SYSCALL(read)
+ 2cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <write>:
+SYSCALL(write)
+ 2d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <close>:
+SYSCALL(close)
+ 2db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <kill>:
+SYSCALL(kill)
+ 2e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <exec>:
+SYSCALL(exec)
+ 2eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <open>:
+SYSCALL(open)
+ 2f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <mknod>:
+SYSCALL(mknod)
+ 2fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <unlink>:
+SYSCALL(unlink)
+ 303:	b8 12 00 00 00       	mov    $0x12,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <fstat>:
+SYSCALL(fstat)
+ 30b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <link>:
+SYSCALL(link)
+ 313:	b8 13 00 00 00       	mov    $0x13,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <mkdir>:
+SYSCALL(mkdir)
+ 31b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <chdir>:
+SYSCALL(chdir)
+ 323:	b8 09 00 00 00       	mov    $0x9,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <dup>:
+SYSCALL(dup)
+ 32b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <getpid>:
+SYSCALL(getpid)
+ 333:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <sbrk>:
+SYSCALL(sbrk)
+ 33b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <sleep>:
+SYSCALL(sleep)
+ 343:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <uptime>:
+SYSCALL(uptime)
+ 34b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <poll>:
+SYSCALL(poll)
+ 353:	b8 16 00 00 00       	mov    $0x16,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fcntl>:
+SYSCALL(fcntl)
+ 35b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <lseek>:
+SYSCALL(lseek)
+ 363:	b8 18 00 00 00       	mov    $0x18,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <pread>:
+SYSCALL(pread)
+ 36b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pwrite>:
+SYSCALL(pwrite)
+ 373:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <readv>:
+SYSCALL(readv)
+ 37b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <writev>:
+SYSCALL(writev)
+ 383:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <getdents>:
+SYSCALL(getdents)
+ 38b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <splice>:
+SYSCALL(splice)
+ 393:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 39b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 3a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <batch>:
+SYSCALL(batch)
+ 3ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+ 3b3:	66 90                	xchg   %ax,%ax
+ 3b5:	66 90                	xchg   %ax,%ax
+ 3b7:	66 90                	xchg   %ax,%ax
+ 3b9:	66 90                	xchg   %ax,%ax
+ 3bb:	66 90                	xchg   %ax,%ax
+ 3bd:	66 90                	xchg   %ax,%ax
+ 3bf:	90                   	nop
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3c8:	89 d1                	mov    %edx,%ecx
+{
+ 3ca:	83 ec 3c             	sub    $0x3c,%esp
+ 3cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3d0:	85 d2                	test   %edx,%edx
+ 3d2:	0f 89 80 00 00 00    	jns    458 <printint+0x98>
+ 3d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3dc:	74 7a                	je     458 <printint+0x98>
+    x = -xx;
+ 3de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3e8:	31 f6                	xor    %esi,%esi
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3f0:	89 c8                	mov    %ecx,%eax
+ 3f2:	31 d2                	xor    %edx,%edx
+ 3f4:	89 f7                	mov    %esi,%edi
+ 3f6:	f7 f3                	div    %ebx
+ 3f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3fb:	0f b6 92 68 0f 00 00 	movzbl 0xf68(%edx),%edx
+ 402:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 406:	89 ca                	mov    %ecx,%edx
+ 408:	89 c1                	mov    %eax,%ecx
+ 40a:	39 da                	cmp    %ebx,%edx
+ 40c:	73 e2                	jae    3f0 <printint+0x30>
+  if(neg)
+ 40e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 411:	85 c0                	test   %eax,%eax
+ 413:	74 07                	je     41c <printint+0x5c>
+    buf[i++] = '-';
+ 415:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 41a:	89 f7                	mov    %esi,%edi
+ 41c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 41f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 422:	01 df                	add    %ebx,%edi
+ 424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 428:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 431:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 434:	6a 01                	push   $0x1
+ 436:	50                   	push   %eax
+ 437:	56                   	push   %esi
+ 438:	e8 96 fe ff ff       	call   2d3 <write>
+  while(--i >= 0)
+ 43d:	89 f8                	mov    %edi,%eax
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	83 ef 01             	sub    $0x1,%edi
+ 445:	39 d8                	cmp    %ebx,%eax
+ 447:	75 df                	jne    428 <printint+0x68>
+}
+ 449:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 44c:	5b                   	pop    %ebx
+ 44d:	5e                   	pop    %esi
+ 44e:	5f                   	pop    %edi
+ 44f:	5d                   	pop    %ebp
+ 450:	c3                   	ret
+ 451:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 458:	31 c0                	xor    %eax,%eax
+ 45a:	eb 89                	jmp    3e5 <printint+0x25>
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 469:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 46c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 46f:	0f b6 1e             	movzbl (%esi),%ebx
+ 472:	83 c6 01             	add    $0x1,%esi
+ 475:	84 db                	test   %bl,%bl
+ 477:	74 67                	je     4e0 <printf+0x80>
+ 479:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 47c:	31 d2                	xor    %edx,%edx
+ 47e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 481:	eb 34                	jmp    4b7 <printf+0x57>
+ 483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 487:	90                   	nop
+ 488:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 48b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 490:	83 f8 25             	cmp    $0x25,%eax
+ 493:	74 18                	je     4ad <printf+0x4d>
+  write(fd, &c, 1);
+ 495:	83 ec 04             	sub    $0x4,%esp
+ 498:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 49b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 49e:	6a 01                	push   $0x1
+ 4a0:	50                   	push   %eax
+ 4a1:	57                   	push   %edi
+ 4a2:	e8 2c fe ff ff       	call   2d3 <write>
+ 4a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b0:	83 c6 01             	add    $0x1,%esi
+ 4b3:	84 db                	test   %bl,%bl
+ 4b5:	74 29                	je     4e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ba:	85 d2                	test   %edx,%edx
+ 4bc:	74 ca                	je     488 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4be:	83 fa 25             	cmp    $0x25,%edx
+ 4c1:	75 ea                	jne    4ad <printf+0x4d>
+      if(c == 'd'){
+ 4c3:	83 f8 25             	cmp    $0x25,%eax
+ 4c6:	0f 84 24 01 00 00    	je     5f0 <printf+0x190>
+ 4cc:	83 e8 63             	sub    $0x63,%eax
+ 4cf:	83 f8 15             	cmp    $0x15,%eax
+ 4d2:	77 1c                	ja     4f0 <printf+0x90>
+ 4d4:	ff 24 85 10 0f 00 00 	jmp    *0xf10(,%eax,4)
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4e3:	5b                   	pop    %ebx
+ 4e4:	5e                   	pop    %esi
+ 4e5:	5f                   	pop    %edi
+ 4e6:	5d                   	pop    %ebp
+ 4e7:	c3                   	ret
+ 4e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+  write(fd, &c, 1);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	52                   	push   %edx
+ 4fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 500:	57                   	push   %edi
+ 501:	e8 cd fd ff ff       	call   2d3 <write>
+ 506:	83 c4 0c             	add    $0xc,%esp
+ 509:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50c:	6a 01                	push   $0x1
+ 50e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 511:	52                   	push   %edx
+ 512:	57                   	push   %edi
+ 513:	e8 bb fd ff ff       	call   2d3 <write>
+        putc(fd, c);
+ 518:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 51b:	31 d2                	xor    %edx,%edx
+ 51d:	eb 8e                	jmp    4ad <printf+0x4d>
+ 51f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 520:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 523:	83 ec 0c             	sub    $0xc,%esp
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 13                	mov    (%ebx),%edx
+ 52d:	6a 00                	push   $0x0
+ 52f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 531:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 534:	e8 87 fe ff ff       	call   3c0 <printint>
+        ap++;
+ 539:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 53c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53f:	31 d2                	xor    %edx,%edx
+ 541:	e9 67 ff ff ff       	jmp    4ad <printf+0x4d>
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 550:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 553:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 555:	83 c0 04             	add    $0x4,%eax
+ 558:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 55b:	85 db                	test   %ebx,%ebx
+ 55d:	0f 84 9d 00 00 00    	je     600 <printf+0x1a0>
+        while(*s != 0){
+ 563:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 566:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 568:	84 c0                	test   %al,%al
+ 56a:	0f 84 3d ff ff ff    	je     4ad <printf+0x4d>
+ 570:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 573:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 576:	89 de                	mov    %ebx,%esi
+ 578:	89 d3                	mov    %edx,%ebx
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 586:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 589:	6a 01                	push   $0x1
+ 58b:	53                   	push   %ebx
+ 58c:	57                   	push   %edi
+ 58d:	e8 41 fd ff ff       	call   2d3 <write>
+        while(*s != 0){
+ 592:	0f b6 06             	movzbl (%esi),%eax
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	84 c0                	test   %al,%al
+ 59a:	75 e4                	jne    580 <printf+0x120>
+      state = 0;
+ 59c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 59f:	31 d2                	xor    %edx,%edx
+ 5a1:	e9 07 ff ff ff       	jmp    4ad <printf+0x4d>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	e9 6b ff ff ff       	jmp    52f <printf+0xcf>
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	52                   	push   %edx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 f1 fc ff ff       	call   2d3 <write>
+        ap++;
+ 5e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e8:	31 d2                	xor    %edx,%edx
+ 5ea:	e9 be fe ff ff       	jmp    4ad <printf+0x4d>
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	e9 11 ff ff ff       	jmp    511 <printf+0xb1>
+ 600:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 605:	bb 07 0f 00 00       	mov    $0xf07,%ebx
+ 60a:	e9 61 ff ff ff       	jmp    570 <printf+0x110>
+ 60f:	90                   	nop
+
+00000610 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 610:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 611:	a1 8c 14 00 00       	mov    0x148c,%eax
+{
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	57                   	push   %edi
+ 619:	56                   	push   %esi
+ 61a:	53                   	push   %ebx
+ 61b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 61e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 628:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 62a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62c:	39 ca                	cmp    %ecx,%edx
+ 62e:	73 30                	jae    660 <free+0x50>
+ 630:	39 c1                	cmp    %eax,%ecx
+ 632:	72 04                	jb     638 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 634:	39 c2                	cmp    %eax,%edx
+ 636:	72 f0                	jb     628 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 638:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 63b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 63e:	39 f8                	cmp    %edi,%eax
+ 640:	74 2e                	je     670 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 642:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 645:	8b 42 04             	mov    0x4(%edx),%eax
+ 648:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 64b:	39 f1                	cmp    %esi,%ecx
+ 64d:	74 38                	je     687 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 64f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 651:	5b                   	pop    %ebx
+  freep = p;
+ 652:	89 15 8c 14 00 00    	mov    %edx,0x148c
+}
+ 658:	5e                   	pop    %esi
+ 659:	5f                   	pop    %edi
+ 65a:	5d                   	pop    %ebp
+ 65b:	c3                   	ret
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 660:	39 c1                	cmp    %eax,%ecx
+ 662:	72 d0                	jb     634 <free+0x24>
+ 664:	eb c2                	jmp    628 <free+0x18>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 670:	03 70 04             	add    0x4(%eax),%esi
+ 673:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 676:	8b 02                	mov    (%edx),%eax
+ 678:	8b 00                	mov    (%eax),%eax
+ 67a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 67d:	8b 42 04             	mov    0x4(%edx),%eax
+ 680:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 683:	39 f1                	cmp    %esi,%ecx
+ 685:	75 c8                	jne    64f <free+0x3f>
+    p->s.size += bp->s.size;
+ 687:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 68a:	89 15 8c 14 00 00    	mov    %edx,0x148c
+    p->s.size += bp->s.size;
+ 690:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 693:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 696:	89 0a                	mov    %ecx,(%edx)
+}
+ 698:	5b                   	pop    %ebx
+ 699:	5e                   	pop    %esi
+ 69a:	5f                   	pop    %edi
+ 69b:	5d                   	pop    %ebp
+ 69c:	c3                   	ret
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ac:	8b 15 8c 14 00 00    	mov    0x148c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6b5:	c1 ef 03             	shr    $0x3,%edi
+ 6b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6bb:	85 d2                	test   %edx,%edx
+ 6bd:	0f 84 8d 00 00 00    	je     750 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6c8:	39 f9                	cmp    %edi,%ecx
+ 6ca:	73 64                	jae    730 <malloc+0x90>
+  if(nu < 4096)
+ 6cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6d1:	39 df                	cmp    %ebx,%edi
+ 6d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6dd:	eb 0a                	jmp    6e9 <malloc+0x49>
+ 6df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6e5:	39 f9                	cmp    %edi,%ecx
+ 6e7:	73 47                	jae    730 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6e9:	89 c2                	mov    %eax,%edx
+ 6eb:	39 05 8c 14 00 00    	cmp    %eax,0x148c
+ 6f1:	75 ed                	jne    6e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	56                   	push   %esi
+ 6f7:	e8 3f fc ff ff       	call   33b <sbrk>
+  if(p == (char*)-1)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+ 6ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 702:	74 1c                	je     720 <malloc+0x80>
+  hp->s.size = nu;
+ 704:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 707:	83 ec 0c             	sub    $0xc,%esp
+ 70a:	83 c0 08             	add    $0x8,%eax
+ 70d:	50                   	push   %eax
+ 70e:	e8 fd fe ff ff       	call   610 <free>
+  return freep;
+ 713:	8b 15 8c 14 00 00    	mov    0x148c,%edx
+      if((p = morecore(nunits)) == 0)
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	85 d2                	test   %edx,%edx
+ 71e:	75 c0                	jne    6e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 723:	31 c0                	xor    %eax,%eax
+}
+ 725:	5b                   	pop    %ebx
+ 726:	5e                   	pop    %esi
+ 727:	5f                   	pop    %edi
+ 728:	5d                   	pop    %ebp
+ 729:	c3                   	ret
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 730:	39 cf                	cmp    %ecx,%edi
+ 732:	74 4c                	je     780 <malloc+0xe0>
+        p->s.size -= nunits;
+ 734:	29 f9                	sub    %edi,%ecx
+ 736:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 739:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 73c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 73f:	89 15 8c 14 00 00    	mov    %edx,0x148c
+}
+ 745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 748:	83 c0 08             	add    $0x8,%eax
+}
+ 74b:	5b                   	pop    %ebx
+ 74c:	5e                   	pop    %esi
+ 74d:	5f                   	pop    %edi
+ 74e:	5d                   	pop    %ebp
+ 74f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 750:	c7 05 8c 14 00 00 90 	movl   $0x1490,0x148c
+ 757:	14 00 00 
+    base.s.size = 0;
+ 75a:	b8 90 14 00 00       	mov    $0x1490,%eax
+    base.s.ptr = freep = prevp = &base;
+ 75f:	c7 05 90 14 00 00 90 	movl   $0x1490,0x1490
+ 766:	14 00 00 
+    base.s.size = 0;
+ 769:	c7 05 94 14 00 00 00 	movl   $0x0,0x1494
+ 770:	00 00 00 
+    if(p->s.size >= nunits){
+ 773:	e9 54 ff ff ff       	jmp    6cc <malloc+0x2c>
+ 778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 780:	8b 08                	mov    (%eax),%ecx
+ 782:	89 0a                	mov    %ecx,(%edx)
+ 784:	eb b9                	jmp    73f <malloc+0x9f>
+ 786:	66 90                	xchg   %ax,%ax
+ 788:	66 90                	xchg   %ax,%ax
+ 78a:	66 90                	xchg   %ax,%ax
+ 78c:	66 90                	xchg   %ax,%ax
+ 78e:	66 90                	xchg   %ax,%ax
+
+00000790 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 1c             	sub    $0x1c,%esp
+ 799:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+ 79c:	85 c9                	test   %ecx,%ecx
+ 79e:	7e 51                	jle    7f1 <put+0x61>
+ 7a0:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+ 7a2:	8b 40 08             	mov    0x8(%eax),%eax
+ 7a5:	89 ce                	mov    %ecx,%esi
+ 7a7:	85 c0                	test   %eax,%eax
+ 7a9:	7e 55                	jle    800 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+ 7ab:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+ 7ae:	8b 51 0c             	mov    0xc(%ecx),%edx
+ 7b1:	8b 79 08             	mov    0x8(%ecx),%edi
+ 7b4:	01 d7                	add    %edx,%edi
+ 7b6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 7b9:	74 65                	je     820 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+ 7bb:	83 f8 20             	cmp    $0x20,%eax
+ 7be:	75 40                	jne    800 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	8d 43 10             	lea    0x10(%ebx),%eax
+ 7c6:	6a 20                	push   $0x20
+ 7c8:	50                   	push   %eax
+ 7c9:	ff 33                	push   (%ebx)
+ 7cb:	e8 b3 fb ff ff       	call   383 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+ 7d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+ 7d3:	31 c0                	xor    %eax,%eax
+ 7d5:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 7da:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+ 7dd:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 7e4:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ 7e7:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ 7ea:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+ 7ee:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 7f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f4:	5b                   	pop    %ebx
+ 7f5:	5e                   	pop    %esi
+ 7f6:	5f                   	pop    %edi
+ 7f7:	5d                   	pop    %ebp
+ 7f8:	c3                   	ret
+ 7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+ 800:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+ 803:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 806:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+ 809:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+ 80d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+ 810:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 813:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 816:	5b                   	pop    %ebx
+ 817:	5e                   	pop    %esi
+ 818:	5f                   	pop    %edi
+ 819:	5d                   	pop    %ebp
+ 81a:	c3                   	ret
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+      last->iov_len += n;
+ 820:	01 f2                	add    %esi,%edx
+ 822:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+ 825:	eb ca                	jmp    7f1 <put+0x61>
+ 827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82e:	66 90                	xchg   %ax,%ax
+
+00000830 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	89 d7                	mov    %edx,%edi
+ 836:	56                   	push   %esi
+ 837:	89 ce                	mov    %ecx,%esi
+ 839:	53                   	push   %ebx
+ 83a:	89 c3                	mov    %eax,%ebx
+ 83c:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+ 83f:	8b 40 0c             	mov    0xc(%eax),%eax
+ 842:	8b 53 08             	mov    0x8(%ebx),%edx
+ 845:	01 c1                	add    %eax,%ecx
+ 847:	83 f9 40             	cmp    $0x40,%ecx
+ 84a:	7f 3c                	jg     888 <putcopy+0x58>
+ 84c:	83 fa 20             	cmp    $0x20,%edx
+ 84f:	74 3f                	je     890 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+ 851:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+ 857:	83 ec 04             	sub    $0x4,%esp
+ 85a:	01 d0                	add    %edx,%eax
+ 85c:	56                   	push   %esi
+ 85d:	57                   	push   %edi
+ 85e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 861:	50                   	push   %eax
+ 862:	e8 19 fa ff ff       	call   280 <memmove>
+  put(w, w->buf + w->nbuf, n);
+ 867:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 86a:	89 f1                	mov    %esi,%ecx
+ 86c:	03 53 0c             	add    0xc(%ebx),%edx
+ 86f:	89 d8                	mov    %ebx,%eax
+ 871:	e8 1a ff ff ff       	call   790 <put>
+  w->nbuf += n;
+ 876:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+ 879:	83 c4 10             	add    $0x10,%esp
+ 87c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 87f:	5b                   	pop    %ebx
+ 880:	5e                   	pop    %esi
+ 881:	5f                   	pop    %edi
+ 882:	5d                   	pop    %ebp
+ 883:	c3                   	ret
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+ 888:	85 d2                	test   %edx,%edx
+ 88a:	7e 16                	jle    8a2 <putcopy+0x72>
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	8d 43 10             	lea    0x10(%ebx),%eax
+ 896:	52                   	push   %edx
+ 897:	50                   	push   %eax
+ 898:	ff 33                	push   (%ebx)
+ 89a:	e8 e4 fa ff ff       	call   383 <writev>
+ 89f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+ 8a2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 8a9:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+ 8ab:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 8b2:	eb 9d                	jmp    851 <putcopy+0x21>
+ 8b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+
+000008c0 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+ 8c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+ 8c9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+ 8d0:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+ 8d2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+ 8d9:	c7 40 10 79 0f 00 00 	movl   $0xf79,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+ 8e0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+ 8e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+ 8ee:	5d                   	pop    %ebp
+ 8ef:	c3                   	ret
+
+000008f0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 1c             	sub    $0x1c,%esp
+ 8f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 8fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 8ff:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+ 902:	8b 47 04             	mov    0x4(%edi),%eax
+ 905:	85 c0                	test   %eax,%eax
+ 907:	0f 85 7b 01 00 00    	jne    a88 <struct_field_str+0x198>
+    w->need_comma = 1;
+ 90d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ 914:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 919:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+ 91e:	89 f8                	mov    %edi,%eax
+ 920:	e8 6b fe ff ff       	call   790 <put>
+  put_str(w, key ? key : "");
+ 925:	85 db                	test   %ebx,%ebx
+ 927:	b8 e6 0f 00 00       	mov    $0xfe6,%eax
+ 92c:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ 92f:	83 ec 0c             	sub    $0xc,%esp
+ 932:	53                   	push   %ebx
+ 933:	e8 c8 f7 ff ff       	call   100 <strlen>
+ 938:	89 da                	mov    %ebx,%edx
+ 93a:	89 c1                	mov    %eax,%ecx
+ 93c:	89 f8                	mov    %edi,%eax
+ 93e:	e8 4d fe ff ff       	call   790 <put>
+  put(w, "\":\"", 3);
+ 943:	b9 03 00 00 00       	mov    $0x3,%ecx
+ 948:	ba 8c 0f 00 00       	mov    $0xf8c,%edx
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	e8 3c fe ff ff       	call   790 <put>
+  put_escaped(w, value ? value : "");
+ 954:	83 c4 10             	add    $0x10,%esp
+ 957:	85 f6                	test   %esi,%esi
+ 959:	0f 84 41 01 00 00    	je     aa0 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+ 95f:	0f b6 1e             	movzbl (%esi),%ebx
+ 962:	89 f2                	mov    %esi,%edx
+ 964:	84 db                	test   %bl,%bl
+ 966:	0f 84 40 01 00 00    	je     aac <struct_field_str+0x1bc>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 970:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+ 972:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+ 975:	80 fb 0d             	cmp    $0xd,%bl
+ 978:	74 7e                	je     9f8 <struct_field_str+0x108>
+ 97a:	7f 5c                	jg     9d8 <struct_field_str+0xe8>
+ 97c:	80 fb 09             	cmp    $0x9,%bl
+ 97f:	0f 84 eb 00 00 00    	je     a70 <struct_field_str+0x180>
+ 985:	80 fb 0a             	cmp    $0xa,%bl
+ 988:	0f 85 95 00 00 00    	jne    a23 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 98e:	29 d1                	sub    %edx,%ecx
+ 990:	89 f8                	mov    %edi,%eax
+ 992:	e8 f9 fd ff ff       	call   790 <put>
+      esc = "\\n";
+ 997:	ba 87 0f 00 00       	mov    $0xf87,%edx
+      put(w, esc, 2);
+ 99c:	b9 02 00 00 00       	mov    $0x2,%ecx
+ 9a1:	89 f8                	mov    %edi,%eax
+ 9a3:	e8 e8 fd ff ff       	call   790 <put>
+    run = s + 1;
+ 9a8:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+ 9aa:	0f b6 1e             	movzbl (%esi),%ebx
+ 9ad:	84 db                	test   %bl,%bl
+ 9af:	75 bf                	jne    970 <struct_field_str+0x80>
+  put(w, run, s - run);
+ 9b1:	29 d6                	sub    %edx,%esi
+ 9b3:	89 f1                	mov    %esi,%ecx
+ 9b5:	89 f8                	mov    %edi,%eax
+ 9b7:	e8 d4 fd ff ff       	call   790 <put>
+  put(w, "\"", 1);
+}
+ 9bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+ 9bf:	89 f8                	mov    %edi,%eax
+ 9c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+ 9c6:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+ 9c7:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+}
+ 9cc:	5e                   	pop    %esi
+ 9cd:	5f                   	pop    %edi
+ 9ce:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+ 9cf:	e9 bc fd ff ff       	jmp    790 <put>
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 9d8:	80 fb 22             	cmp    $0x22,%bl
+ 9db:	74 33                	je     a10 <struct_field_str+0x120>
+ 9dd:	80 fb 5c             	cmp    $0x5c,%bl
+ 9e0:	75 41                	jne    a23 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 9e2:	29 d1                	sub    %edx,%ecx
+ 9e4:	89 f8                	mov    %edi,%eax
+ 9e6:	e8 a5 fd ff ff       	call   790 <put>
+      esc = "\\\\";
+ 9eb:	ba 7b 0f 00 00       	mov    $0xf7b,%edx
+ 9f0:	eb aa                	jmp    99c <struct_field_str+0xac>
+ 9f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+ 9f8:	29 d1                	sub    %edx,%ecx
+ 9fa:	89 f8                	mov    %edi,%eax
+ 9fc:	e8 8f fd ff ff       	call   790 <put>
+      esc = "\\r";
+ a01:	ba 84 0f 00 00       	mov    $0xf84,%edx
+ a06:	eb 94                	jmp    99c <struct_field_str+0xac>
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+    put(w, run, s - run);
+ a10:	29 d1                	sub    %edx,%ecx
+ a12:	89 f8                	mov    %edi,%eax
+ a14:	e8 77 fd ff ff       	call   790 <put>
+      esc = "\\\"";
+ a19:	ba 7e 0f 00 00       	mov    $0xf7e,%edx
+ a1e:	e9 79 ff ff ff       	jmp    99c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+ a23:	80 fb 1f             	cmp    $0x1f,%bl
+ a26:	77 82                	ja     9aa <struct_field_str+0xba>
+    put(w, run, s - run);
+ a28:	29 d1                	sub    %edx,%ecx
+ a2a:	89 f8                	mov    %edi,%eax
+ a2c:	e8 5f fd ff ff       	call   790 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+ a31:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+ a33:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+ a36:	0f b7 05 a8 0f 00 00 	movzwl 0xfa8,%eax
+ a3d:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+ a40:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+ a45:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+ a4c:	0f b6 d2             	movzbl %dl,%edx
+ a4f:	8a 82 90 0f 00 00    	mov    0xf90(%edx),%al
+ a55:	8a a3 90 0f 00 00    	mov    0xf90(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+ a5b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+ a5e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+ a62:	89 f8                	mov    %edi,%eax
+ a64:	e8 c7 fd ff ff       	call   830 <putcopy>
+ a69:	e9 3a ff ff ff       	jmp    9a8 <struct_field_str+0xb8>
+ a6e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+ a70:	29 d1                	sub    %edx,%ecx
+ a72:	89 f8                	mov    %edi,%eax
+ a74:	e8 17 fd ff ff       	call   790 <put>
+      esc = "\\t";
+ a79:	ba 81 0f 00 00       	mov    $0xf81,%edx
+ a7e:	e9 19 ff ff ff       	jmp    99c <struct_field_str+0xac>
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+    put(w, ",", 1);
+ a88:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a8d:	ba 8a 0f 00 00       	mov    $0xf8a,%edx
+ a92:	89 f8                	mov    %edi,%eax
+ a94:	e8 f7 fc ff ff       	call   790 <put>
+}
+ a99:	e9 76 fe ff ff       	jmp    914 <struct_field_str+0x24>
+ a9e:	66 90                	xchg   %ax,%ax
+ aa0:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+ aa2:	ba e6 0f 00 00       	mov    $0xfe6,%edx
+ aa7:	e9 09 ff ff ff       	jmp    9b5 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+ aac:	31 c9                	xor    %ecx,%ecx
+ aae:	e9 02 ff ff ff       	jmp    9b5 <struct_field_str+0xc5>
+ ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ac0 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 1c             	sub    $0x1c,%esp
+ ac9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ acc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+ acf:	8b 57 04             	mov    0x4(%edi),%edx
+ ad2:	85 d2                	test   %edx,%edx
+ ad4:	0f 85 b6 00 00 00    	jne    b90 <struct_field_int+0xd0>
+    w->need_comma = 1;
+ ada:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ ae1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ae6:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+ aeb:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+ aed:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+ af2:	e8 99 fc ff ff       	call   790 <put>
+  put_str(w, key ? key : "");
+ af7:	85 db                	test   %ebx,%ebx
+ af9:	b8 e6 0f 00 00       	mov    $0xfe6,%eax
+ afe:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ b01:	83 ec 0c             	sub    $0xc,%esp
+ b04:	53                   	push   %ebx
+ b05:	e8 f6 f5 ff ff       	call   100 <strlen>
+ b0a:	89 da                	mov    %ebx,%edx
+ b0c:	89 c1                	mov    %eax,%ecx
+ b0e:	89 f8                	mov    %edi,%eax
+ b10:	e8 7b fc ff ff       	call   790 <put>
+  put(w, "\":", 2);
+ b15:	b9 02 00 00 00       	mov    $0x2,%ecx
+ b1a:	ba a1 0f 00 00       	mov    $0xfa1,%edx
+ b1f:	89 f8                	mov    %edi,%eax
+ b21:	e8 6a fc ff ff       	call   790 <put>
+  x = value < 0 ? -(uint)value : value;
+ b26:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+ b29:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+ b2c:	83 c4 10             	add    $0x10,%esp
+ b2f:	f7 d9                	neg    %ecx
+ b31:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+ b35:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+ b38:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ b3d:	89 f3                	mov    %esi,%ebx
+ b3f:	83 ee 01             	sub    $0x1,%esi
+ b42:	f7 e1                	mul    %ecx
+ b44:	89 c8                	mov    %ecx,%eax
+ b46:	c1 ea 03             	shr    $0x3,%edx
+ b49:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ b4c:	01 ff                	add    %edi,%edi
+ b4e:	29 f8                	sub    %edi,%eax
+ b50:	83 c0 30             	add    $0x30,%eax
+ b53:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ b57:	89 c8                	mov    %ecx,%eax
+ b59:	89 d1                	mov    %edx,%ecx
+ b5b:	83 f8 09             	cmp    $0x9,%eax
+ b5e:	77 d8                	ja     b38 <struct_field_int+0x78>
+  if(value < 0)
+ b60:	8b 45 10             	mov    0x10(%ebp),%eax
+ b63:	8b 7d 08             	mov    0x8(%ebp),%edi
+ b66:	85 c0                	test   %eax,%eax
+ b68:	79 08                	jns    b72 <struct_field_int+0xb2>
+    buf[--i] = '-';
+ b6a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+ b6f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+ b72:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ b75:	b9 0c 00 00 00       	mov    $0xc,%ecx
+ b7a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+ b7d:	29 f1                	sub    %esi,%ecx
+ b7f:	89 f8                	mov    %edi,%eax
+ b81:	e8 aa fc ff ff       	call   830 <putcopy>
+  put_int(w, value);
+}
+ b86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b89:	5b                   	pop    %ebx
+ b8a:	5e                   	pop    %esi
+ b8b:	5f                   	pop    %edi
+ b8c:	5d                   	pop    %ebp
+ b8d:	c3                   	ret
+ b8e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+ b90:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b95:	ba 8a 0f 00 00       	mov    $0xf8a,%edx
+ b9a:	89 f8                	mov    %edi,%eax
+ b9c:	e8 ef fb ff ff       	call   790 <put>
+}
+ ba1:	e9 3b ff ff ff       	jmp    ae1 <struct_field_int+0x21>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	56                   	push   %esi
+ bb4:	53                   	push   %ebx
+ bb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+ bb8:	8b 43 08             	mov    0x8(%ebx),%eax
+ bbb:	85 c0                	test   %eax,%eax
+ bbd:	7e 59                	jle    c18 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+ bbf:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+ bc2:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ bc5:	8b 72 08             	mov    0x8(%edx),%esi
+ bc8:	01 ce                	add    %ecx,%esi
+ bca:	81 fe a4 0f 00 00    	cmp    $0xfa4,%esi
+ bd0:	0f 84 aa 00 00 00    	je     c80 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+ bd6:	83 f8 20             	cmp    $0x20,%eax
+ bd9:	75 75                	jne    c50 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+ bdb:	83 ec 04             	sub    $0x4,%esp
+ bde:	8d 73 10             	lea    0x10(%ebx),%esi
+ be1:	6a 20                	push   $0x20
+ be3:	56                   	push   %esi
+ be4:	ff 33                	push   (%ebx)
+ be6:	e8 98 f7 ff ff       	call   383 <writev>
+  w->nbuf = 0;
+ beb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+ bf2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ bf5:	c7 43 10 a4 0f 00 00 	movl   $0xfa4,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+ bfc:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+ c03:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+ c0a:	ba 01 00 00 00       	mov    $0x1,%edx
+ c0f:	eb 5a                	jmp    c6b <struct_end+0xbb>
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+ c18:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c1b:	83 c0 02             	add    $0x2,%eax
+ c1e:	c7 04 c3 a4 0f 00 00 	movl   $0xfa4,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ c25:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ c2c:	00 
+  w->niov++;
+ c2d:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+ c30:	83 fa 01             	cmp    $0x1,%edx
+ c33:	74 58                	je     c8d <struct_end+0xdd>
+  w->niov = 0;
+ c35:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+ c3c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+ c43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c46:	5b                   	pop    %ebx
+ c47:	5e                   	pop    %esi
+ c48:	5d                   	pop    %ebp
+ c49:	c3                   	ret
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+ c50:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c53:	83 c0 02             	add    $0x2,%eax
+ c56:	8d 73 10             	lea    0x10(%ebx),%esi
+ c59:	c7 04 c3 a4 0f 00 00 	movl   $0xfa4,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ c60:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ c67:	00 
+  w->niov++;
+ c68:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+ c6b:	83 ec 04             	sub    $0x4,%esp
+ c6e:	52                   	push   %edx
+ c6f:	56                   	push   %esi
+ c70:	ff 33                	push   (%ebx)
+ c72:	e8 0c f7 ff ff       	call   383 <writev>
+ c77:	83 c4 10             	add    $0x10,%esp
+ c7a:	eb b9                	jmp    c35 <struct_end+0x85>
+ c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+ c80:	83 c1 02             	add    $0x2,%ecx
+ c83:	8d 73 10             	lea    0x10(%ebx),%esi
+ c86:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+ c89:	89 c2                	mov    %eax,%edx
+ c8b:	eb de                	jmp    c6b <struct_end+0xbb>
+ c8d:	8d 73 10             	lea    0x10(%ebx),%esi
+ c90:	e9 75 ff ff ff       	jmp    c0a <struct_end+0x5a>
+ c95:	66 90                	xchg   %ax,%ax
+ c97:	66 90                	xchg   %ax,%ax
+ c99:	66 90                	xchg   %ax,%ax
+ c9b:	66 90                	xchg   %ax,%ax
+ c9d:	66 90                	xchg   %ax,%ax
+ c9f:	90                   	nop
+
+00000ca0 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	56                   	push   %esi
+ ca4:	89 c6                	mov    %eax,%esi
+ ca6:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+ ca7:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+ cad:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+ cb3:	6a 01                	push   $0x1
+ cb5:	53                   	push   %ebx
+ cb6:	e8 05 fc ff ff       	call   8c0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ cbb:	83 c4 0c             	add    $0xc,%esp
+ cbe:	56                   	push   %esi
+ cbf:	68 aa 0f 00 00       	push   $0xfaa
+ cc4:	53                   	push   %ebx
+ cc5:	e8 26 fc ff ff       	call   8f0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+ cca:	83 c4 0c             	add    $0xc,%esp
+ ccd:	68 b2 0f 00 00       	push   $0xfb2
+ cd2:	68 c3 0f 00 00       	push   $0xfc3
+ cd7:	53                   	push   %ebx
+ cd8:	e8 13 fc ff ff       	call   8f0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+ cdd:	83 c4 0c             	add    $0xc,%esp
+ ce0:	68 ea 07 00 00       	push   $0x7ea
+ ce5:	68 ca 0f 00 00       	push   $0xfca
+ cea:	53                   	push   %ebx
+ ceb:	e8 d0 fd ff ff       	call   ac0 <struct_field_int>
+  struct_end(&w);
+ cf0:	89 1c 24             	mov    %ebx,(%esp)
+ cf3:	e8 b8 fe ff ff       	call   bb0 <struct_end>
+ cf8:	83 c4 10             	add    $0x10,%esp
+}
+ cfb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cfe:	5b                   	pop    %ebx
+ cff:	5e                   	pop    %esi
+ d00:	5d                   	pop    %ebp
+ d01:	c3                   	ret
+ d02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <modern_consume_flags>:
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+ d19:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+ d1c:	85 f6                	test   %esi,%esi
+ d1e:	74 06                	je     d26 <modern_consume_flags+0x16>
+    *json_mode = 0;
+ d20:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+ d26:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+ d2a:	bf 01 00 00 00       	mov    $0x1,%edi
+ d2f:	7e 4c                	jle    d7d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+ d31:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+ d34:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+ d37:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+ d3a:	68 cf 0f 00 00       	push   $0xfcf
+ d3f:	53                   	push   %ebx
+ d40:	e8 5b f3 ff ff       	call   a0 <strcmp>
+ d45:	83 c4 10             	add    $0x10,%esp
+ d48:	85 c0                	test   %eax,%eax
+ d4a:	74 58                	je     da4 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+ d4c:	8b 45 14             	mov    0x14(%ebp),%eax
+ d4f:	85 c0                	test   %eax,%eax
+ d51:	74 2a                	je     d7d <modern_consume_flags+0x6d>
+ d53:	83 ec 08             	sub    $0x8,%esp
+ d56:	68 e7 0f 00 00       	push   $0xfe7
+ d5b:	53                   	push   %ebx
+ d5c:	e8 3f f3 ff ff       	call   a0 <strcmp>
+ d61:	83 c4 10             	add    $0x10,%esp
+ d64:	85 c0                	test   %eax,%eax
+ d66:	74 28                	je     d90 <modern_consume_flags+0x80>
+ d68:	83 ec 08             	sub    $0x8,%esp
+ d6b:	68 ea 0f 00 00       	push   $0xfea
+ d70:	53                   	push   %ebx
+ d71:	e8 2a f3 ff ff       	call   a0 <strcmp>
+ d76:	83 c4 10             	add    $0x10,%esp
+ d79:	85 c0                	test   %eax,%eax
+ d7b:	74 13                	je     d90 <modern_consume_flags+0x80>
+}
+ d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d80:	89 f8                	mov    %edi,%eax
+ d82:	5b                   	pop    %ebx
+ d83:	5e                   	pop    %esi
+ d84:	5f                   	pop    %edi
+ d85:	5d                   	pop    %ebp
+ d86:	c3                   	ret
+ d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+ d90:	85 f6                	test   %esi,%esi
+ d92:	74 06                	je     d9a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+ d94:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+ d9a:	83 c7 01             	add    $0x1,%edi
+ d9d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ da0:	75 8f                	jne    d31 <modern_consume_flags+0x21>
+ da2:	eb d9                	jmp    d7d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+ da4:	85 f6                	test   %esi,%esi
+ da6:	74 12                	je     dba <modern_consume_flags+0xaa>
+  if(!json_mode){
+ da8:	83 3e 00             	cmpl   $0x0,(%esi)
+ dab:	74 0d                	je     dba <modern_consume_flags+0xaa>
+ dad:	8b 45 08             	mov    0x8(%ebp),%eax
+ db0:	e8 eb fe ff ff       	call   ca0 <modern_print_version.part.0>
+      exit();
+ db5:	e8 f9 f4 ff ff       	call   2b3 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ dba:	83 ec 0c             	sub    $0xc,%esp
+ dbd:	68 ea 07 00 00       	push   $0x7ea
+ dc2:	68 b2 0f 00 00       	push   $0xfb2
+ dc7:	ff 75 08             	push   0x8(%ebp)
+ dca:	68 d9 0f 00 00       	push   $0xfd9
+ dcf:	6a 01                	push   $0x1
+ dd1:	e8 8a f6 ff ff       	call   460 <printf>
+}
+ dd6:	83 c4 20             	add    $0x20,%esp
+ dd9:	eb da                	jmp    db5 <modern_consume_flags+0xa5>
+ ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ddf:	90                   	nop
+
+00000de0 <modern_print_version>:
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+ de6:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+ de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+ dec:	85 d2                	test   %edx,%edx
+ dee:	74 10                	je     e00 <modern_print_version+0x20>
+}
+ df0:	c9                   	leave
+ df1:	e9 aa fe ff ff       	jmp    ca0 <modern_print_version.part.0>
+ df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ e00:	83 ec 0c             	sub    $0xc,%esp
+ e03:	68 ea 07 00 00       	push   $0x7ea
+ e08:	68 b2 0f 00 00       	push   $0xfb2
+ e0d:	50                   	push   %eax
+ e0e:	68 d9 0f 00 00       	push   $0xfd9
+ e13:	6a 01                	push   $0x1
+ e15:	e8 46 f6 ff ff       	call   460 <printf>
+}
+ e1a:	83 c4 20             	add    $0x20,%esp
+}
+ e1d:	c9                   	leave
+ e1e:	c3                   	ret
+ e1f:	90                   	nop
+
+00000e20 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+ e20:	55                   	push   %ebp
+ e21:	89 e5                	mov    %esp,%ebp
+ e23:	57                   	push   %edi
+ e24:	56                   	push   %esi
+ e25:	53                   	push   %ebx
+ e26:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+ e2c:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+ e2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ e32:	8b 45 10             	mov    0x10(%ebp),%eax
+ e35:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+ e38:	85 d2                	test   %edx,%edx
+ e3a:	75 44                	jne    e80 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+ e3c:	85 f6                	test   %esi,%esi
+ e3e:	ba f1 0f 00 00       	mov    $0xff1,%edx
+ e43:	0f 44 f2             	cmove  %edx,%esi
+ e46:	85 c0                	test   %eax,%eax
+ e48:	ba e6 0f 00 00       	mov    $0xfe6,%edx
+ e4d:	0f 44 c2             	cmove  %edx,%eax
+ e50:	85 db                	test   %ebx,%ebx
+ e52:	ba f6 0f 00 00       	mov    $0xff6,%edx
+ e57:	0f 44 da             	cmove  %edx,%ebx
+ e5a:	83 ec 08             	sub    $0x8,%esp
+ e5d:	56                   	push   %esi
+ e5e:	50                   	push   %eax
+ e5f:	53                   	push   %ebx
+ e60:	ff 75 08             	push   0x8(%ebp)
+ e63:	68 fc 0f 00 00       	push   $0xffc
+ e68:	6a 01                	push   $0x1
+ e6a:	e8 f1 f5 ff ff       	call   460 <printf>
+ e6f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+ e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e75:	5b                   	pop    %ebx
+ e76:	5e                   	pop    %esi
+ e77:	5f                   	pop    %edi
+ e78:	5d                   	pop    %ebp
+ e79:	c3                   	ret
+ e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+ e80:	83 ec 08             	sub    $0x8,%esp
+ e83:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+ e89:	89 45 10             	mov    %eax,0x10(%ebp)
+ e8c:	6a 01                	push   $0x1
+ e8e:	57                   	push   %edi
+ e8f:	e8 2c fa ff ff       	call   8c0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ e94:	83 c4 0c             	add    $0xc,%esp
+ e97:	ff 75 08             	push   0x8(%ebp)
+ e9a:	68 aa 0f 00 00       	push   $0xfaa
+ e9f:	57                   	push   %edi
+ ea0:	e8 4b fa ff ff       	call   8f0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+ ea5:	83 c4 0c             	add    $0xc,%esp
+ ea8:	ba f6 0f 00 00       	mov    $0xff6,%edx
+ ead:	85 db                	test   %ebx,%ebx
+ eaf:	0f 44 da             	cmove  %edx,%ebx
+ eb2:	53                   	push   %ebx
+ eb3:	52                   	push   %edx
+ eb4:	57                   	push   %edi
+ eb5:	e8 36 fa ff ff       	call   8f0 <struct_field_str>
+  if(target)
+ eba:	8b 45 10             	mov    0x10(%ebp),%eax
+ ebd:	83 c4 10             	add    $0x10,%esp
+ ec0:	85 c0                	test   %eax,%eax
+ ec2:	74 12                	je     ed6 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+ ec4:	83 ec 04             	sub    $0x4,%esp
+ ec7:	50                   	push   %eax
+ ec8:	68 0a 10 00 00       	push   $0x100a
+ ecd:	57                   	push   %edi
+ ece:	e8 1d fa ff ff       	call   8f0 <struct_field_str>
+ ed3:	83 c4 10             	add    $0x10,%esp
+  if(status)
+ ed6:	85 f6                	test   %esi,%esi
+ ed8:	74 12                	je     eec <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+ eda:	83 ec 04             	sub    $0x4,%esp
+ edd:	56                   	push   %esi
+ ede:	68 11 10 00 00       	push   $0x1011
+ ee3:	57                   	push   %edi
+ ee4:	e8 07 fa ff ff       	call   8f0 <struct_field_str>
+ ee9:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+ eec:	83 ec 0c             	sub    $0xc,%esp
+ eef:	57                   	push   %edi
+ ef0:	e8 bb fc ff ff       	call   bb0 <struct_end>
+ ef5:	83 c4 10             	add    $0x10,%esp
+}
+ ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ efb:	5b                   	pop    %ebx
+ efc:	5e                   	pop    %esi
+ efd:	5f                   	pop    %edi
+ efe:	5d                   	pop    %ebp
+ eff:	c3                   	ret
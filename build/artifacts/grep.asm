@@ -0,0 +1,2537 @@
+
+build/bin/user/_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+      21:	8b 43 04             	mov    0x4(%ebx),%eax
+      24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+      27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+      30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+      33:	75 2d                	jne    62 <main+0x62>
+      35:	eb 6c                	jmp    a3 <main+0xa3>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+      40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+      43:	83 c6 01             	add    $0x1,%esi
+      46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+      49:	50                   	push   %eax
+      4a:	ff 75 e0             	push   -0x20(%ebp)
+      4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+      52:	89 3c 24             	mov    %edi,(%esp)
+      55:	e8 b1 05 00 00       	call   60b <close>
+  for(i = 2; i < argc; i++){
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+      62:	83 ec 08             	sub    $0x8,%esp
+      65:	6a 00                	push   $0x0
+      67:	ff 33                	push   (%ebx)
+      69:	e8 b5 05 00 00       	call   623 <open>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	89 c7                	mov    %eax,%edi
+      73:	85 c0                	test   %eax,%eax
+      75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      77:	50                   	push   %eax
+      78:	ff 33                	push   (%ebx)
+      7a:	68 50 12 00 00       	push   $0x1250
+      7f:	6a 01                	push   $0x1
+      81:	e8 0a 07 00 00       	call   790 <printf>
+      exit();
+      86:	e8 58 05 00 00       	call   5e3 <exit>
+  }
+  exit();
+      8b:	e8 53 05 00 00       	call   5e3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+      90:	51                   	push   %ecx
+      91:	51                   	push   %ecx
+      92:	68 30 12 00 00       	push   $0x1230
+      97:	6a 02                	push   $0x2
+      99:	e8 f2 06 00 00       	call   790 <printf>
+    exit();
+      9e:	e8 40 05 00 00       	call   5e3 <exit>
+    grep(pattern, 0);
+      a3:	52                   	push   %edx
+      a4:	52                   	push   %edx
+      a5:	6a 00                	push   $0x0
+      a7:	50                   	push   %eax
+      a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+      ad:	e8 31 05 00 00       	call   5e3 <exit>
+      b2:	66 90                	xchg   %ax,%ax
+      b4:	66 90                	xchg   %ax,%ax
+      b6:	66 90                	xchg   %ax,%ax
+      b8:	66 90                	xchg   %ax,%ax
+      ba:	66 90                	xchg   %ax,%ax
+      bc:	66 90                	xchg   %ax,%ax
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 0c             	sub    $0xc,%esp
+      c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+      cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+      cf:	0f b6 0f             	movzbl (%edi),%ecx
+      d2:	84 c9                	test   %cl,%cl
+      d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      de:	3c 2a                	cmp    $0x2a,%al
+      e0:	74 2d                	je     10f <matchhere+0x4f>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      eb:	80 f9 24             	cmp    $0x24,%cl
+      ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      f0:	89 f2                	mov    %esi,%edx
+      f2:	84 d2                	test   %dl,%dl
+      f4:	74 6e                	je     164 <matchhere+0xa4>
+      f6:	80 f9 2e             	cmp    $0x2e,%cl
+      f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      fb:	83 c3 01             	add    $0x1,%ebx
+      fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     101:	84 c0                	test   %al,%al
+     103:	74 6b                	je     170 <matchhere+0xb0>
+     105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     10b:	3c 2a                	cmp    $0x2a,%al
+     10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     10f:	8d 77 02             	lea    0x2(%edi),%esi
+     112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	53                   	push   %ebx
+     11c:	56                   	push   %esi
+     11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     129:	0f be 13             	movsbl (%ebx),%edx
+     12c:	84 d2                	test   %dl,%dl
+     12e:	74 45                	je     175 <matchhere+0xb5>
+     130:	83 c3 01             	add    $0x1,%ebx
+     133:	39 fa                	cmp    %edi,%edx
+     135:	74 e1                	je     118 <matchhere+0x58>
+     137:	83 ff 2e             	cmp    $0x2e,%edi
+     13a:	74 dc                	je     118 <matchhere+0x58>
+     13c:	eb 37                	jmp    175 <matchhere+0xb5>
+     13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     140:	84 c0                	test   %al,%al
+     142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     144:	89 f2                	mov    %esi,%edx
+     146:	84 d2                	test   %dl,%dl
+     148:	74 1a                	je     164 <matchhere+0xa4>
+     14a:	80 fa 24             	cmp    $0x24,%dl
+     14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     14f:	83 c3 01             	add    $0x1,%ebx
+     152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     155:	89 c1                	mov    %eax,%ecx
+     157:	eb ae                	jmp    107 <matchhere+0x47>
+     159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     160:	38 ca                	cmp    %cl,%dl
+     162:	74 97                	je     fb <matchhere+0x3b>
+}
+     164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     167:	31 c0                	xor    %eax,%eax
+}
+     169:	5b                   	pop    %ebx
+     16a:	5e                   	pop    %esi
+     16b:	5f                   	pop    %edi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+    return 1;
+     170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+    return *text == '\0';
+     17d:	89 f0                	mov    %esi,%eax
+     17f:	84 c0                	test   %al,%al
+     181:	0f 94 c0             	sete   %al
+     184:	0f b6 c0             	movzbl %al,%eax
+     187:	eb ec                	jmp    175 <matchhere+0xb5>
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     19e:	75 11                	jne    1b1 <match+0x21>
+     1a0:	eb 2e                	jmp    1d0 <match+0x40>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1a8:	83 c6 01             	add    $0x1,%esi
+     1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+     1b1:	83 ec 08             	sub    $0x8,%esp
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 c0                	test   %eax,%eax
+     1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+     1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     1d0:	83 c3 01             	add    $0x1,%ebx
+     1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	57                   	push   %edi
+  m = 0;
+     1f4:	31 ff                	xor    %edi,%edi
+{
+     1f6:	56                   	push   %esi
+     1f7:	53                   	push   %ebx
+     1f8:	83 ec 1c             	sub    $0x1c,%esp
+     1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     201:	8d 43 01             	lea    0x1(%ebx),%eax
+     204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     218:	83 ec 04             	sub    $0x4,%esp
+     21b:	29 c8                	sub    %ecx,%eax
+     21d:	50                   	push   %eax
+     21e:	8d 81 e0 18 00 00    	lea    0x18e0(%ecx),%eax
+     224:	50                   	push   %eax
+     225:	ff 75 0c             	push   0xc(%ebp)
+     228:	e8 ce 03 00 00       	call   5fb <read>
+     22d:	83 c4 10             	add    $0x10,%esp
+     230:	85 c0                	test   %eax,%eax
+     232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+     238:	01 45 e0             	add    %eax,-0x20(%ebp)
+     23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     23e:	bf e0 18 00 00       	mov    $0x18e0,%edi
+     243:	89 de                	mov    %ebx,%esi
+     245:	c6 81 e0 18 00 00 00 	movb   $0x0,0x18e0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	6a 0a                	push   $0xa
+     255:	57                   	push   %edi
+     256:	e8 25 02 00 00       	call   480 <strchr>
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	89 c2                	mov    %eax,%edx
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+     268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     26e:	74 58                	je     2c8 <grep+0xd8>
+     270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     273:	89 d3                	mov    %edx,%ebx
+     275:	eb 12                	jmp    289 <grep+0x99>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     280:	83 c7 01             	add    $0x1,%edi
+     283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+     289:	83 ec 08             	sub    $0x8,%esp
+     28c:	57                   	push   %edi
+     28d:	56                   	push   %esi
+     28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+     293:	83 c4 10             	add    $0x10,%esp
+     296:	85 c0                	test   %eax,%eax
+     298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+     29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     29d:	89 da                	mov    %ebx,%edx
+     29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     2a2:	89 d8                	mov    %ebx,%eax
+     2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+     2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+     2aa:	29 f8                	sub    %edi,%eax
+     2ac:	50                   	push   %eax
+     2ad:	57                   	push   %edi
+     2ae:	89 df                	mov    %ebx,%edi
+     2b0:	6a 01                	push   $0x1
+     2b2:	e8 4c 03 00 00       	call   603 <write>
+     2b7:	83 c4 10             	add    $0x10,%esp
+     2ba:	eb 94                	jmp    250 <grep+0x60>
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     2c3:	eb 8b                	jmp    250 <grep+0x60>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     2ce:	57                   	push   %edi
+     2cf:	ff 75 dc             	push   -0x24(%ebp)
+     2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+     2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+     2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+     2e4:	89 df                	mov    %ebx,%edi
+     2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    if(p == buf)
+     2f0:	89 f3                	mov    %esi,%ebx
+     2f2:	81 ff e0 18 00 00    	cmp    $0x18e0,%edi
+     2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+     2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2fd:	85 c0                	test   %eax,%eax
+     2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+     305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     30a:	2d e0 18 00 00       	sub    $0x18e0,%eax
+     30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     315:	51                   	push   %ecx
+     316:	57                   	push   %edi
+     317:	68 e0 18 00 00       	push   $0x18e0
+     31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+     321:	83 c4 10             	add    $0x10,%esp
+     324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+     329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+     335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     338:	5b                   	pop    %ebx
+     339:	5e                   	pop    %esi
+     33a:	5f                   	pop    %edi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	57                   	push   %edi
+     35c:	56                   	push   %esi
+     35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     369:	0f be 17             	movsbl (%edi),%edx
+     36c:	84 d2                	test   %dl,%dl
+     36e:	74 0c                	je     37c <matchstar+0x3c>
+     370:	83 c7 01             	add    $0x1,%edi
+     373:	39 da                	cmp    %ebx,%edx
+     375:	74 e1                	je     358 <matchstar+0x18>
+     377:	83 fb 2e             	cmp    $0x2e,%ebx
+     37a:	74 dc                	je     358 <matchstar+0x18>
+}
+     37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37f:	5b                   	pop    %ebx
+     380:	5e                   	pop    %esi
+     381:	5f                   	pop    %edi
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     390:	5b                   	pop    %ebx
+     391:	5e                   	pop    %esi
+     392:	5f                   	pop    %edi
+     393:	5d                   	pop    %ebp
+     394:	c3                   	ret
+     395:	66 90                	xchg   %ax,%ax
+     397:	66 90                	xchg   %ax,%ax
+     399:	66 90                	xchg   %ax,%ax
+     39b:	66 90                	xchg   %ax,%ax
+     39d:	66 90                	xchg   %ax,%ax
+     39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3a1:	31 c0                	xor    %eax,%eax
+{
+     3a3:	89 e5                	mov    %esp,%ebp
+     3a5:	53                   	push   %ebx
+     3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3b7:	83 c0 01             	add    $0x1,%eax
+     3ba:	84 d2                	test   %dl,%dl
+     3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c1:	89 c8                	mov    %ecx,%eax
+     3c3:	c9                   	leave
+     3c4:	c3                   	ret
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3da:	0f b6 02             	movzbl (%edx),%eax
+     3dd:	84 c0                	test   %al,%al
+     3df:	75 17                	jne    3f8 <strcmp+0x28>
+     3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+     3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3ec:	83 c2 01             	add    $0x1,%edx
+     3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     3f2:	84 c0                	test   %al,%al
+     3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+     3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     3f8:	0f b6 19             	movzbl (%ecx),%ebx
+     3fb:	38 c3                	cmp    %al,%bl
+     3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     3ff:	29 d8                	sub    %ebx,%eax
+}
+     401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     404:	c9                   	leave
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     414:	31 c0                	xor    %eax,%eax
+     416:	29 d8                	sub    %ebx,%eax
+}
+     418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     41b:	c9                   	leave
+     41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     41d:	0f b6 19             	movzbl (%ecx),%ebx
+     420:	31 c0                	xor    %eax,%eax
+     422:	eb db                	jmp    3ff <strcmp+0x2f>
+     424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     436:	80 3a 00             	cmpb   $0x0,(%edx)
+     439:	74 15                	je     450 <strlen+0x20>
+     43b:	31 c0                	xor    %eax,%eax
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     447:	89 c1                	mov    %eax,%ecx
+     449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+     44b:	89 c8                	mov    %ecx,%eax
+     44d:	5d                   	pop    %ebp
+     44e:	c3                   	ret
+     44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     450:	31 c9                	xor    %ecx,%ecx
+}
+     452:	5d                   	pop    %ebp
+     453:	89 c8                	mov    %ecx,%eax
+     455:	c3                   	ret
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46d:	89 d7                	mov    %edx,%edi
+     46f:	fc                   	cld
+     470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     475:	89 d0                	mov    %edx,%eax
+     477:	c9                   	leave
+     478:	c3                   	ret
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	8b 45 08             	mov    0x8(%ebp),%eax
+     486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     48a:	0f b6 10             	movzbl (%eax),%edx
+     48d:	84 d2                	test   %dl,%dl
+     48f:	75 12                	jne    4a3 <strchr+0x23>
+     491:	eb 1d                	jmp    4b0 <strchr+0x30>
+     493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     497:	90                   	nop
+     498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     49c:	83 c0 01             	add    $0x1,%eax
+     49f:	84 d2                	test   %dl,%dl
+     4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+     4a3:	38 d1                	cmp    %dl,%cl
+     4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4a7:	5d                   	pop    %ebp
+     4a8:	c3                   	ret
+     4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4b0:	31 c0                	xor    %eax,%eax
+}
+     4b2:	5d                   	pop    %ebp
+     4b3:	c3                   	ret
+     4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     4c9:	31 db                	xor    %ebx,%ebx
+{
+     4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	6a 01                	push   $0x1
+     4d5:	56                   	push   %esi
+     4d6:	6a 00                	push   $0x0
+     4d8:	e8 1e 01 00 00       	call   5fb <read>
+    if(cc < 1)
+     4dd:	83 c4 10             	add    $0x10,%esp
+     4e0:	85 c0                	test   %eax,%eax
+     4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+     4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     4ef:	3c 0a                	cmp    $0xa,%al
+     4f1:	74 10                	je     503 <gets+0x43>
+     4f3:	3c 0d                	cmp    $0xd,%al
+     4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     4f7:	89 df                	mov    %ebx,%edi
+     4f9:	83 c3 01             	add    $0x1,%ebx
+     4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4ff:	7c cf                	jl     4d0 <gets+0x10>
+     501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     503:	8b 45 08             	mov    0x8(%ebp),%eax
+     506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     50d:	5b                   	pop    %ebx
+     50e:	5e                   	pop    %esi
+     50f:	5f                   	pop    %edi
+     510:	5d                   	pop    %ebp
+     511:	c3                   	ret
+     512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     525:	83 ec 08             	sub    $0x8,%esp
+     528:	6a 00                	push   $0x0
+     52a:	ff 75 08             	push   0x8(%ebp)
+     52d:	e8 f1 00 00 00       	call   623 <open>
+  if(fd < 0)
+     532:	83 c4 10             	add    $0x10,%esp
+     535:	85 c0                	test   %eax,%eax
+     537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	ff 75 0c             	push   0xc(%ebp)
+     53f:	89 c3                	mov    %eax,%ebx
+     541:	50                   	push   %eax
+     542:	e8 f4 00 00 00       	call   63b <fstat>
+  close(fd);
+     547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     54c:	e8 ba 00 00 00       	call   60b <close>
+  return r;
+     551:	83 c4 10             	add    $0x10,%esp
+}
+     554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     557:	89 f0                	mov    %esi,%eax
+     559:	5b                   	pop    %ebx
+     55a:	5e                   	pop    %esi
+     55b:	5d                   	pop    %ebp
+     55c:	c3                   	ret
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     565:	eb ed                	jmp    554 <stat+0x34>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	53                   	push   %ebx
+     574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     577:	0f be 02             	movsbl (%edx),%eax
+     57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     585:	77 1e                	ja     5a5 <atoi+0x35>
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     590:	83 c2 01             	add    $0x1,%edx
+     593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     59a:	0f be 02             	movsbl (%edx),%eax
+     59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5a0:	80 fb 09             	cmp    $0x9,%bl
+     5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+     5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5a8:	89 c8                	mov    %ecx,%eax
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+     5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5be:	85 c0                	test   %eax,%eax
+     5c0:	7e 13                	jle    5d5 <memmove+0x25>
+     5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5c4:	89 d7                	mov    %edx,%edi
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5d1:	39 f8                	cmp    %edi,%eax
+     5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+     5d5:	5e                   	pop    %esi
+     5d6:	89 d0                	mov    %edx,%eax
+     5d8:	5f                   	pop    %edi
+     5d9:	5d                   	pop    %ebp
+     5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     5db:	b8 01 00 00 00       	mov    $0x1,%eax
+     5e0:	cd 40                	int    $0x40
+     5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+     5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+     5e8:	cd 40                	int    $0x40
+     5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+     5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+     5f0:	cd 40                	int    $0x40
+     5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+     5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+     5f8:	cd 40                	int    $0x40
+     5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+     5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+     600:	cd 40                	int    $0x40
+     602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+     603:	b8 10 00 00 00       	mov    $0x10,%eax
+     608:	cd 40                	int    $0x40
+     60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+     60b:	b8 15 00 00 00       	mov    $0x15,%eax
+     610:	cd 40                	int    $0x40
+     612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+     613:	b8 06 00 00 00       	mov    $0x6,%eax
+     618:	cd 40                	int    $0x40
+     61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+     61b:	b8 07 00 00 00       	mov    $0x7,%eax
+     620:	cd 40                	int    $0x40
+     622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+     623:	b8 0f 00 00 00       	mov    $0xf,%eax
+     628:	cd 40                	int    $0x40
+     62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+     62b:	b8 11 00 00 00       	mov    $0x11,%eax
+     630:	cd 40                	int    $0x40
+     632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+     633:	b8 12 00 00 00       	mov    $0x12,%eax
+     638:	cd 40                	int    $0x40
+     63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+     63b:	b8 08 00 00 00       	mov    $0x8,%eax
+     640:	cd 40                	int    $0x40
+     642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+     643:	b8 13 00 00 00       	mov    $0x13,%eax
+     648:	cd 40                	int    $0x40
+     64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+     64b:	b8 14 00 00 00       	mov    $0x14,%eax
+     650:	cd 40                	int    $0x40
+     652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+     653:	b8 09 00 00 00       	mov    $0x9,%eax
+     658:	cd 40                	int    $0x40
+     65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+     65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     660:	cd 40                	int    $0x40
+     662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+     663:	b8 0b 00 00 00       	mov    $0xb,%eax
+     668:	cd 40                	int    $0x40
+     66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+     66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     670:	cd 40                	int    $0x40
+     672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+     673:	b8 0d 00 00 00       	mov    $0xd,%eax
+     678:	cd 40                	int    $0x40
+     67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+     67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     680:	cd 40                	int    $0x40
+     682:	c3                   	ret
+
+00000683 <poll>:
+SYSCALL(poll)
+     683:	b8 16 00 00 00       	mov    $0x16,%eax
+     688:	cd 40                	int    $0x40
+     68a:	c3                   	ret
+
+0000068b <fcntl>:
+SYSCALL(fcntl)
+     68b:	b8 17 00 00 00       	mov    $0x17,%eax
+     690:	cd 40                	int    $0x40
+     692:	c3                   	ret
+
+00000693 <lseek>:
+SYSCALL(lseek)
+     693:	b8 18 00 00 00       	mov    $0x18,%eax
+     698:	cd 40                	int    $0x40
+     69a:	c3                   	ret
+
+0000069b <pread>:
+SYSCALL(pread)
+     69b:	b8 19 00 00 00       	mov    $0x19,%eax
+     6a0:	cd 40                	int    $0x40
+     6a2:	c3                   	ret
+
+000006a3 <pwrite>:
+SYSCALL(pwrite)
+     6a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     6a8:	cd 40                	int    $0x40
+     6aa:	c3                   	ret
+
+000006ab <readv>:
+SYSCALL(readv)
+     6ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     6b0:	cd 40                	int    $0x40
+     6b2:	c3                   	ret
+
+000006b3 <writev>:
+SYSCALL(writev)
+     6b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     6b8:	cd 40                	int    $0x40
+     6ba:	c3                   	ret
+
+000006bb <getdents>:
+SYSCALL(getdents)
+     6bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     6c0:	cd 40                	int    $0x40
+     6c2:	c3                   	ret
+
+000006c3 <splice>:
+SYSCALL(splice)
+     6c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     6c8:	cd 40                	int    $0x40
+     6ca:	c3                   	ret
+
+000006cb <ioring_setup>:
+SYSCALL(ioring_setup)
+     6cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     6d0:	cd 40                	int    $0x40
+     6d2:	c3                   	ret
+
+000006d3 <ioring_enter>:
+SYSCALL(ioring_enter)
+     6d3:	b8 20 00 00 00       	mov    $0x20,%eax
+     6d8:	cd 40                	int    $0x40
+     6da:	c3                   	ret
+
+000006db <batch>:
+SYSCALL(batch)
+     6db:	b8 21 00 00 00       	mov    $0x21,%eax
+     6e0:	cd 40                	int    $0x40
+     6e2:	c3                   	ret
+     6e3:	66 90                	xchg   %ax,%ax
+     6e5:	66 90                	xchg   %ax,%ax
+     6e7:	66 90                	xchg   %ax,%ax
+     6e9:	66 90                	xchg   %ax,%ax
+     6eb:	66 90                	xchg   %ax,%ax
+     6ed:	66 90                	xchg   %ax,%ax
+     6ef:	90                   	nop
+
+000006f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	56                   	push   %esi
+     6f5:	53                   	push   %ebx
+     6f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     6f8:	89 d1                	mov    %edx,%ecx
+{
+     6fa:	83 ec 3c             	sub    $0x3c,%esp
+     6fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     700:	85 d2                	test   %edx,%edx
+     702:	0f 89 80 00 00 00    	jns    788 <printint+0x98>
+     708:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     70c:	74 7a                	je     788 <printint+0x98>
+    x = -xx;
+     70e:	f7 d9                	neg    %ecx
+    neg = 1;
+     710:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     715:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     718:	31 f6                	xor    %esi,%esi
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     720:	89 c8                	mov    %ecx,%eax
+     722:	31 d2                	xor    %edx,%edx
+     724:	89 f7                	mov    %esi,%edi
+     726:	f7 f3                	div    %ebx
+     728:	8d 76 01             	lea    0x1(%esi),%esi
+     72b:	0f b6 92 c8 12 00 00 	movzbl 0x12c8(%edx),%edx
+     732:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     736:	89 ca                	mov    %ecx,%edx
+     738:	89 c1                	mov    %eax,%ecx
+     73a:	39 da                	cmp    %ebx,%edx
+     73c:	73 e2                	jae    720 <printint+0x30>
+  if(neg)
+     73e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     741:	85 c0                	test   %eax,%eax
+     743:	74 07                	je     74c <printint+0x5c>
+    buf[i++] = '-';
+     745:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     74a:	89 f7                	mov    %esi,%edi
+     74c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     74f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     752:	01 df                	add    %ebx,%edi
+     754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     758:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     75b:	83 ec 04             	sub    $0x4,%esp
+     75e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     761:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     764:	6a 01                	push   $0x1
+     766:	50                   	push   %eax
+     767:	56                   	push   %esi
+     768:	e8 96 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+     76d:	89 f8                	mov    %edi,%eax
+     76f:	83 c4 10             	add    $0x10,%esp
+     772:	83 ef 01             	sub    $0x1,%edi
+     775:	39 d8                	cmp    %ebx,%eax
+     777:	75 df                	jne    758 <printint+0x68>
+}
+     779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     77c:	5b                   	pop    %ebx
+     77d:	5e                   	pop    %esi
+     77e:	5f                   	pop    %edi
+     77f:	5d                   	pop    %ebp
+     780:	c3                   	ret
+     781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     788:	31 c0                	xor    %eax,%eax
+     78a:	eb 89                	jmp    715 <printint+0x25>
+     78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     799:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     79c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     79f:	0f b6 1e             	movzbl (%esi),%ebx
+     7a2:	83 c6 01             	add    $0x1,%esi
+     7a5:	84 db                	test   %bl,%bl
+     7a7:	74 67                	je     810 <printf+0x80>
+     7a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     7ac:	31 d2                	xor    %edx,%edx
+     7ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     7b1:	eb 34                	jmp    7e7 <printf+0x57>
+     7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7b7:	90                   	nop
+     7b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     7bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     7c0:	83 f8 25             	cmp    $0x25,%eax
+     7c3:	74 18                	je     7dd <printf+0x4d>
+  write(fd, &c, 1);
+     7c5:	83 ec 04             	sub    $0x4,%esp
+     7c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     7cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     7ce:	6a 01                	push   $0x1
+     7d0:	50                   	push   %eax
+     7d1:	57                   	push   %edi
+     7d2:	e8 2c fe ff ff       	call   603 <write>
+     7d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     7da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     7dd:	0f b6 1e             	movzbl (%esi),%ebx
+     7e0:	83 c6 01             	add    $0x1,%esi
+     7e3:	84 db                	test   %bl,%bl
+     7e5:	74 29                	je     810 <printf+0x80>
+    c = fmt[i] & 0xff;
+     7e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     7ea:	85 d2                	test   %edx,%edx
+     7ec:	74 ca                	je     7b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     7ee:	83 fa 25             	cmp    $0x25,%edx
+     7f1:	75 ea                	jne    7dd <printf+0x4d>
+      if(c == 'd'){
+     7f3:	83 f8 25             	cmp    $0x25,%eax
+     7f6:	0f 84 24 01 00 00    	je     920 <printf+0x190>
+     7fc:	83 e8 63             	sub    $0x63,%eax
+     7ff:	83 f8 15             	cmp    $0x15,%eax
+     802:	77 1c                	ja     820 <printf+0x90>
+     804:	ff 24 85 70 12 00 00 	jmp    *0x1270(,%eax,4)
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     813:	5b                   	pop    %ebx
+     814:	5e                   	pop    %esi
+     815:	5f                   	pop    %edi
+     816:	5d                   	pop    %ebp
+     817:	c3                   	ret
+     818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+  write(fd, &c, 1);
+     820:	83 ec 04             	sub    $0x4,%esp
+     823:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     826:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     82a:	6a 01                	push   $0x1
+     82c:	52                   	push   %edx
+     82d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     830:	57                   	push   %edi
+     831:	e8 cd fd ff ff       	call   603 <write>
+     836:	83 c4 0c             	add    $0xc,%esp
+     839:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     83c:	6a 01                	push   $0x1
+     83e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     841:	52                   	push   %edx
+     842:	57                   	push   %edi
+     843:	e8 bb fd ff ff       	call   603 <write>
+        putc(fd, c);
+     848:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     84b:	31 d2                	xor    %edx,%edx
+     84d:	eb 8e                	jmp    7dd <printf+0x4d>
+     84f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     853:	83 ec 0c             	sub    $0xc,%esp
+     856:	b9 10 00 00 00       	mov    $0x10,%ecx
+     85b:	8b 13                	mov    (%ebx),%edx
+     85d:	6a 00                	push   $0x0
+     85f:	89 f8                	mov    %edi,%eax
+        ap++;
+     861:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     864:	e8 87 fe ff ff       	call   6f0 <printint>
+        ap++;
+     869:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     86c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     86f:	31 d2                	xor    %edx,%edx
+     871:	e9 67 ff ff ff       	jmp    7dd <printf+0x4d>
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     880:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     883:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     885:	83 c0 04             	add    $0x4,%eax
+     888:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     88b:	85 db                	test   %ebx,%ebx
+     88d:	0f 84 9d 00 00 00    	je     930 <printf+0x1a0>
+        while(*s != 0){
+     893:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     896:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     898:	84 c0                	test   %al,%al
+     89a:	0f 84 3d ff ff ff    	je     7dd <printf+0x4d>
+     8a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     8a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     8a6:	89 de                	mov    %ebx,%esi
+     8a8:	89 d3                	mov    %edx,%ebx
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     8b0:	83 ec 04             	sub    $0x4,%esp
+     8b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     8b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     8b9:	6a 01                	push   $0x1
+     8bb:	53                   	push   %ebx
+     8bc:	57                   	push   %edi
+     8bd:	e8 41 fd ff ff       	call   603 <write>
+        while(*s != 0){
+     8c2:	0f b6 06             	movzbl (%esi),%eax
+     8c5:	83 c4 10             	add    $0x10,%esp
+     8c8:	84 c0                	test   %al,%al
+     8ca:	75 e4                	jne    8b0 <printf+0x120>
+      state = 0;
+     8cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     8cf:	31 d2                	xor    %edx,%edx
+     8d1:	e9 07 ff ff ff       	jmp    7dd <printf+0x4d>
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     8e3:	83 ec 0c             	sub    $0xc,%esp
+     8e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     8eb:	8b 13                	mov    (%ebx),%edx
+     8ed:	6a 01                	push   $0x1
+     8ef:	e9 6b ff ff ff       	jmp    85f <printf+0xcf>
+     8f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     8f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     8fb:	83 ec 04             	sub    $0x4,%esp
+     8fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     901:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     903:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     906:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     909:	6a 01                	push   $0x1
+     90b:	52                   	push   %edx
+     90c:	57                   	push   %edi
+     90d:	e8 f1 fc ff ff       	call   603 <write>
+        ap++;
+     912:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     915:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     918:	31 d2                	xor    %edx,%edx
+     91a:	e9 be fe ff ff       	jmp    7dd <printf+0x4d>
+     91f:	90                   	nop
+  write(fd, &c, 1);
+     920:	83 ec 04             	sub    $0x4,%esp
+     923:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     926:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     929:	6a 01                	push   $0x1
+     92b:	e9 11 ff ff ff       	jmp    841 <printf+0xb1>
+     930:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     935:	bb 66 12 00 00       	mov    $0x1266,%ebx
+     93a:	e9 61 ff ff ff       	jmp    8a0 <printf+0x110>
+     93f:	90                   	nop
+
+00000940 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     940:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     941:	a1 e0 1c 00 00       	mov    0x1ce0,%eax
+{
+     946:	89 e5                	mov    %esp,%ebp
+     948:	57                   	push   %edi
+     949:	56                   	push   %esi
+     94a:	53                   	push   %ebx
+     94b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     94e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     958:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     95a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     95c:	39 ca                	cmp    %ecx,%edx
+     95e:	73 30                	jae    990 <free+0x50>
+     960:	39 c1                	cmp    %eax,%ecx
+     962:	72 04                	jb     968 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     964:	39 c2                	cmp    %eax,%edx
+     966:	72 f0                	jb     958 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     968:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     96b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     96e:	39 f8                	cmp    %edi,%eax
+     970:	74 2e                	je     9a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     972:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     975:	8b 42 04             	mov    0x4(%edx),%eax
+     978:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     97b:	39 f1                	cmp    %esi,%ecx
+     97d:	74 38                	je     9b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     97f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     981:	5b                   	pop    %ebx
+  freep = p;
+     982:	89 15 e0 1c 00 00    	mov    %edx,0x1ce0
+}
+     988:	5e                   	pop    %esi
+     989:	5f                   	pop    %edi
+     98a:	5d                   	pop    %ebp
+     98b:	c3                   	ret
+     98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     990:	39 c1                	cmp    %eax,%ecx
+     992:	72 d0                	jb     964 <free+0x24>
+     994:	eb c2                	jmp    958 <free+0x18>
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     9a0:	03 70 04             	add    0x4(%eax),%esi
+     9a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     9a6:	8b 02                	mov    (%edx),%eax
+     9a8:	8b 00                	mov    (%eax),%eax
+     9aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     9ad:	8b 42 04             	mov    0x4(%edx),%eax
+     9b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     9b3:	39 f1                	cmp    %esi,%ecx
+     9b5:	75 c8                	jne    97f <free+0x3f>
+    p->s.size += bp->s.size;
+     9b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     9ba:	89 15 e0 1c 00 00    	mov    %edx,0x1ce0
+    p->s.size += bp->s.size;
+     9c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     9c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     9c6:	89 0a                	mov    %ecx,(%edx)
+}
+     9c8:	5b                   	pop    %ebx
+     9c9:	5e                   	pop    %esi
+     9ca:	5f                   	pop    %edi
+     9cb:	5d                   	pop    %ebp
+     9cc:	c3                   	ret
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	57                   	push   %edi
+     9d4:	56                   	push   %esi
+     9d5:	53                   	push   %ebx
+     9d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     9d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     9dc:	8b 15 e0 1c 00 00    	mov    0x1ce0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     9e2:	8d 78 07             	lea    0x7(%eax),%edi
+     9e5:	c1 ef 03             	shr    $0x3,%edi
+     9e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     9eb:	85 d2                	test   %edx,%edx
+     9ed:	0f 84 8d 00 00 00    	je     a80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     9f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     9f5:	8b 48 04             	mov    0x4(%eax),%ecx
+     9f8:	39 f9                	cmp    %edi,%ecx
+     9fa:	73 64                	jae    a60 <malloc+0x90>
+  if(nu < 4096)
+     9fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     a01:	39 df                	cmp    %ebx,%edi
+     a03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     a06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     a0d:	eb 0a                	jmp    a19 <malloc+0x49>
+     a0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     a10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     a12:	8b 48 04             	mov    0x4(%eax),%ecx
+     a15:	39 f9                	cmp    %edi,%ecx
+     a17:	73 47                	jae    a60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     a19:	89 c2                	mov    %eax,%edx
+     a1b:	39 05 e0 1c 00 00    	cmp    %eax,0x1ce0
+     a21:	75 ed                	jne    a10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     a23:	83 ec 0c             	sub    $0xc,%esp
+     a26:	56                   	push   %esi
+     a27:	e8 3f fc ff ff       	call   66b <sbrk>
+  if(p == (char*)-1)
+     a2c:	83 c4 10             	add    $0x10,%esp
+     a2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a32:	74 1c                	je     a50 <malloc+0x80>
+  hp->s.size = nu;
+     a34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     a37:	83 ec 0c             	sub    $0xc,%esp
+     a3a:	83 c0 08             	add    $0x8,%eax
+     a3d:	50                   	push   %eax
+     a3e:	e8 fd fe ff ff       	call   940 <free>
+  return freep;
+     a43:	8b 15 e0 1c 00 00    	mov    0x1ce0,%edx
+      if((p = morecore(nunits)) == 0)
+     a49:	83 c4 10             	add    $0x10,%esp
+     a4c:	85 d2                	test   %edx,%edx
+     a4e:	75 c0                	jne    a10 <malloc+0x40>
+        return 0;
+  }
+}
+     a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     a53:	31 c0                	xor    %eax,%eax
+}
+     a55:	5b                   	pop    %ebx
+     a56:	5e                   	pop    %esi
+     a57:	5f                   	pop    %edi
+     a58:	5d                   	pop    %ebp
+     a59:	c3                   	ret
+     a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     a60:	39 cf                	cmp    %ecx,%edi
+     a62:	74 4c                	je     ab0 <malloc+0xe0>
+        p->s.size -= nunits;
+     a64:	29 f9                	sub    %edi,%ecx
+     a66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     a69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     a6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     a6f:	89 15 e0 1c 00 00    	mov    %edx,0x1ce0
+}
+     a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     a78:	83 c0 08             	add    $0x8,%eax
+}
+     a7b:	5b                   	pop    %ebx
+     a7c:	5e                   	pop    %esi
+     a7d:	5f                   	pop    %edi
+     a7e:	5d                   	pop    %ebp
+     a7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     a80:	c7 05 e0 1c 00 00 e4 	movl   $0x1ce4,0x1ce0
+     a87:	1c 00 00 
+    base.s.size = 0;
+     a8a:	b8 e4 1c 00 00       	mov    $0x1ce4,%eax
+    base.s.ptr = freep = prevp = &base;
+     a8f:	c7 05 e4 1c 00 00 e4 	movl   $0x1ce4,0x1ce4
+     a96:	1c 00 00 
+    base.s.size = 0;
+     a99:	c7 05 e8 1c 00 00 00 	movl   $0x0,0x1ce8
+     aa0:	00 00 00 
+    if(p->s.size >= nunits){
+     aa3:	e9 54 ff ff ff       	jmp    9fc <malloc+0x2c>
+     aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     ab0:	8b 08                	mov    (%eax),%ecx
+     ab2:	89 0a                	mov    %ecx,(%edx)
+     ab4:	eb b9                	jmp    a6f <malloc+0x9f>
+     ab6:	66 90                	xchg   %ax,%ax
+     ab8:	66 90                	xchg   %ax,%ax
+     aba:	66 90                	xchg   %ax,%ax
+     abc:	66 90                	xchg   %ax,%ax
+     abe:	66 90                	xchg   %ax,%ax
+
+00000ac0 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	57                   	push   %edi
+     ac4:	56                   	push   %esi
+     ac5:	53                   	push   %ebx
+     ac6:	83 ec 1c             	sub    $0x1c,%esp
+     ac9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+     acc:	85 c9                	test   %ecx,%ecx
+     ace:	7e 51                	jle    b21 <put+0x61>
+     ad0:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+     ad2:	8b 40 08             	mov    0x8(%eax),%eax
+     ad5:	89 ce                	mov    %ecx,%esi
+     ad7:	85 c0                	test   %eax,%eax
+     ad9:	7e 55                	jle    b30 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+     adb:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+     ade:	8b 51 0c             	mov    0xc(%ecx),%edx
+     ae1:	8b 79 08             	mov    0x8(%ecx),%edi
+     ae4:	01 d7                	add    %edx,%edi
+     ae6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     ae9:	74 65                	je     b50 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+     aeb:	83 f8 20             	cmp    $0x20,%eax
+     aee:	75 40                	jne    b30 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+     af0:	83 ec 04             	sub    $0x4,%esp
+     af3:	8d 43 10             	lea    0x10(%ebx),%eax
+     af6:	6a 20                	push   $0x20
+     af8:	50                   	push   %eax
+     af9:	ff 33                	push   (%ebx)
+     afb:	e8 b3 fb ff ff       	call   6b3 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+     b00:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+     b03:	31 c0                	xor    %eax,%eax
+     b05:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     b0a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+     b0d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     b14:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+     b17:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     b1a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+     b1e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     b21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b24:	5b                   	pop    %ebx
+     b25:	5e                   	pop    %esi
+     b26:	5f                   	pop    %edi
+     b27:	5d                   	pop    %ebp
+     b28:	c3                   	ret
+     b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+     b30:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+     b33:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     b36:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+     b39:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+     b3d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+     b40:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b46:	5b                   	pop    %ebx
+     b47:	5e                   	pop    %esi
+     b48:	5f                   	pop    %edi
+     b49:	5d                   	pop    %ebp
+     b4a:	c3                   	ret
+     b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+      last->iov_len += n;
+     b50:	01 f2                	add    %esi,%edx
+     b52:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+     b55:	eb ca                	jmp    b21 <put+0x61>
+     b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5e:	66 90                	xchg   %ax,%ax
+
+00000b60 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	89 d7                	mov    %edx,%edi
+     b66:	56                   	push   %esi
+     b67:	89 ce                	mov    %ecx,%esi
+     b69:	53                   	push   %ebx
+     b6a:	89 c3                	mov    %eax,%ebx
+     b6c:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+     b6f:	8b 40 0c             	mov    0xc(%eax),%eax
+     b72:	8b 53 08             	mov    0x8(%ebx),%edx
+     b75:	01 c1                	add    %eax,%ecx
+     b77:	83 f9 40             	cmp    $0x40,%ecx
+     b7a:	7f 3c                	jg     bb8 <putcopy+0x58>
+     b7c:	83 fa 20             	cmp    $0x20,%edx
+     b7f:	74 3f                	je     bc0 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+     b81:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+     b87:	83 ec 04             	sub    $0x4,%esp
+     b8a:	01 d0                	add    %edx,%eax
+     b8c:	56                   	push   %esi
+     b8d:	57                   	push   %edi
+     b8e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     b91:	50                   	push   %eax
+     b92:	e8 19 fa ff ff       	call   5b0 <memmove>
+  put(w, w->buf + w->nbuf, n);
+     b97:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     b9a:	89 f1                	mov    %esi,%ecx
+     b9c:	03 53 0c             	add    0xc(%ebx),%edx
+     b9f:	89 d8                	mov    %ebx,%eax
+     ba1:	e8 1a ff ff ff       	call   ac0 <put>
+  w->nbuf += n;
+     ba6:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+     ba9:	83 c4 10             	add    $0x10,%esp
+     bac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     baf:	5b                   	pop    %ebx
+     bb0:	5e                   	pop    %esi
+     bb1:	5f                   	pop    %edi
+     bb2:	5d                   	pop    %ebp
+     bb3:	c3                   	ret
+     bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+     bb8:	85 d2                	test   %edx,%edx
+     bba:	7e 16                	jle    bd2 <putcopy+0x72>
+     bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	8d 43 10             	lea    0x10(%ebx),%eax
+     bc6:	52                   	push   %edx
+     bc7:	50                   	push   %eax
+     bc8:	ff 33                	push   (%ebx)
+     bca:	e8 e4 fa ff ff       	call   6b3 <writev>
+     bcf:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+     bd2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     bd9:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+     bdb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     be2:	eb 9d                	jmp    b81 <putcopy+0x21>
+     be4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bef:	90                   	nop
+
+00000bf0 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+     bf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+     bf9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+     c00:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+     c02:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+     c09:	c7 40 10 d9 12 00 00 	movl   $0x12d9,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+     c10:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+     c17:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+     c1e:	5d                   	pop    %ebp
+     c1f:	c3                   	ret
+
+00000c20 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	83 ec 1c             	sub    $0x1c,%esp
+     c29:	8b 7d 08             	mov    0x8(%ebp),%edi
+     c2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     c2f:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+     c32:	8b 47 04             	mov    0x4(%edi),%eax
+     c35:	85 c0                	test   %eax,%eax
+     c37:	0f 85 7b 01 00 00    	jne    db8 <struct_field_str+0x198>
+    w->need_comma = 1;
+     c3d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     c44:	b9 01 00 00 00       	mov    $0x1,%ecx
+     c49:	ba ee 12 00 00       	mov    $0x12ee,%edx
+     c4e:	89 f8                	mov    %edi,%eax
+     c50:	e8 6b fe ff ff       	call   ac0 <put>
+  put_str(w, key ? key : "");
+     c55:	85 db                	test   %ebx,%ebx
+     c57:	b8 46 13 00 00       	mov    $0x1346,%eax
+     c5c:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     c5f:	83 ec 0c             	sub    $0xc,%esp
+     c62:	53                   	push   %ebx
+     c63:	e8 c8 f7 ff ff       	call   430 <strlen>
+     c68:	89 da                	mov    %ebx,%edx
+     c6a:	89 c1                	mov    %eax,%ecx
+     c6c:	89 f8                	mov    %edi,%eax
+     c6e:	e8 4d fe ff ff       	call   ac0 <put>
+  put(w, "\":\"", 3);
+     c73:	b9 03 00 00 00       	mov    $0x3,%ecx
+     c78:	ba ec 12 00 00       	mov    $0x12ec,%edx
+     c7d:	89 f8                	mov    %edi,%eax
+     c7f:	e8 3c fe ff ff       	call   ac0 <put>
+  put_escaped(w, value ? value : "");
+     c84:	83 c4 10             	add    $0x10,%esp
+     c87:	85 f6                	test   %esi,%esi
+     c89:	0f 84 41 01 00 00    	je     dd0 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+     c8f:	0f b6 1e             	movzbl (%esi),%ebx
+     c92:	89 f2                	mov    %esi,%edx
+     c94:	84 db                	test   %bl,%bl
+     c96:	0f 84 40 01 00 00    	je     ddc <struct_field_str+0x1bc>
+     c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     ca0:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+     ca2:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+     ca5:	80 fb 0d             	cmp    $0xd,%bl
+     ca8:	74 7e                	je     d28 <struct_field_str+0x108>
+     caa:	7f 5c                	jg     d08 <struct_field_str+0xe8>
+     cac:	80 fb 09             	cmp    $0x9,%bl
+     caf:	0f 84 eb 00 00 00    	je     da0 <struct_field_str+0x180>
+     cb5:	80 fb 0a             	cmp    $0xa,%bl
+     cb8:	0f 85 95 00 00 00    	jne    d53 <struct_field_str+0x133>
+    put(w, run, s - run);
+     cbe:	29 d1                	sub    %edx,%ecx
+     cc0:	89 f8                	mov    %edi,%eax
+     cc2:	e8 f9 fd ff ff       	call   ac0 <put>
+      esc = "\\n";
+     cc7:	ba e7 12 00 00       	mov    $0x12e7,%edx
+      put(w, esc, 2);
+     ccc:	b9 02 00 00 00       	mov    $0x2,%ecx
+     cd1:	89 f8                	mov    %edi,%eax
+     cd3:	e8 e8 fd ff ff       	call   ac0 <put>
+    run = s + 1;
+     cd8:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+     cda:	0f b6 1e             	movzbl (%esi),%ebx
+     cdd:	84 db                	test   %bl,%bl
+     cdf:	75 bf                	jne    ca0 <struct_field_str+0x80>
+  put(w, run, s - run);
+     ce1:	29 d6                	sub    %edx,%esi
+     ce3:	89 f1                	mov    %esi,%ecx
+     ce5:	89 f8                	mov    %edi,%eax
+     ce7:	e8 d4 fd ff ff       	call   ac0 <put>
+  put(w, "\"", 1);
+}
+     cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+     cef:	89 f8                	mov    %edi,%eax
+     cf1:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+     cf6:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+     cf7:	ba ee 12 00 00       	mov    $0x12ee,%edx
+}
+     cfc:	5e                   	pop    %esi
+     cfd:	5f                   	pop    %edi
+     cfe:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+     cff:	e9 bc fd ff ff       	jmp    ac0 <put>
+     d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     d08:	80 fb 22             	cmp    $0x22,%bl
+     d0b:	74 33                	je     d40 <struct_field_str+0x120>
+     d0d:	80 fb 5c             	cmp    $0x5c,%bl
+     d10:	75 41                	jne    d53 <struct_field_str+0x133>
+    put(w, run, s - run);
+     d12:	29 d1                	sub    %edx,%ecx
+     d14:	89 f8                	mov    %edi,%eax
+     d16:	e8 a5 fd ff ff       	call   ac0 <put>
+      esc = "\\\\";
+     d1b:	ba db 12 00 00       	mov    $0x12db,%edx
+     d20:	eb aa                	jmp    ccc <struct_field_str+0xac>
+     d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+     d28:	29 d1                	sub    %edx,%ecx
+     d2a:	89 f8                	mov    %edi,%eax
+     d2c:	e8 8f fd ff ff       	call   ac0 <put>
+      esc = "\\r";
+     d31:	ba e4 12 00 00       	mov    $0x12e4,%edx
+     d36:	eb 94                	jmp    ccc <struct_field_str+0xac>
+     d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3f:	90                   	nop
+    put(w, run, s - run);
+     d40:	29 d1                	sub    %edx,%ecx
+     d42:	89 f8                	mov    %edi,%eax
+     d44:	e8 77 fd ff ff       	call   ac0 <put>
+      esc = "\\\"";
+     d49:	ba de 12 00 00       	mov    $0x12de,%edx
+     d4e:	e9 79 ff ff ff       	jmp    ccc <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+     d53:	80 fb 1f             	cmp    $0x1f,%bl
+     d56:	77 82                	ja     cda <struct_field_str+0xba>
+    put(w, run, s - run);
+     d58:	29 d1                	sub    %edx,%ecx
+     d5a:	89 f8                	mov    %edi,%eax
+     d5c:	e8 5f fd ff ff       	call   ac0 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+     d61:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+     d63:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+     d66:	0f b7 05 08 13 00 00 	movzwl 0x1308,%eax
+     d6d:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+     d70:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+     d75:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+     d7c:	0f b6 d2             	movzbl %dl,%edx
+     d7f:	8a 82 f0 12 00 00    	mov    0x12f0(%edx),%al
+     d85:	8a a3 f0 12 00 00    	mov    0x12f0(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+     d8b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+     d8e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+     d92:	89 f8                	mov    %edi,%eax
+     d94:	e8 c7 fd ff ff       	call   b60 <putcopy>
+     d99:	e9 3a ff ff ff       	jmp    cd8 <struct_field_str+0xb8>
+     d9e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+     da0:	29 d1                	sub    %edx,%ecx
+     da2:	89 f8                	mov    %edi,%eax
+     da4:	e8 17 fd ff ff       	call   ac0 <put>
+      esc = "\\t";
+     da9:	ba e1 12 00 00       	mov    $0x12e1,%edx
+     dae:	e9 19 ff ff ff       	jmp    ccc <struct_field_str+0xac>
+     db3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     db7:	90                   	nop
+    put(w, ",", 1);
+     db8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     dbd:	ba ea 12 00 00       	mov    $0x12ea,%edx
+     dc2:	89 f8                	mov    %edi,%eax
+     dc4:	e8 f7 fc ff ff       	call   ac0 <put>
+}
+     dc9:	e9 76 fe ff ff       	jmp    c44 <struct_field_str+0x24>
+     dce:	66 90                	xchg   %ax,%ax
+     dd0:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+     dd2:	ba 46 13 00 00       	mov    $0x1346,%edx
+     dd7:	e9 09 ff ff ff       	jmp    ce5 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+     ddc:	31 c9                	xor    %ecx,%ecx
+     dde:	e9 02 ff ff ff       	jmp    ce5 <struct_field_str+0xc5>
+     de3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000df0 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	57                   	push   %edi
+     df4:	56                   	push   %esi
+     df5:	53                   	push   %ebx
+     df6:	83 ec 1c             	sub    $0x1c,%esp
+     df9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     dfc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+     dff:	8b 57 04             	mov    0x4(%edi),%edx
+     e02:	85 d2                	test   %edx,%edx
+     e04:	0f 85 b6 00 00 00    	jne    ec0 <struct_field_int+0xd0>
+    w->need_comma = 1;
+     e0a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     e11:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e16:	ba ee 12 00 00       	mov    $0x12ee,%edx
+     e1b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+     e1d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+     e22:	e8 99 fc ff ff       	call   ac0 <put>
+  put_str(w, key ? key : "");
+     e27:	85 db                	test   %ebx,%ebx
+     e29:	b8 46 13 00 00       	mov    $0x1346,%eax
+     e2e:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     e31:	83 ec 0c             	sub    $0xc,%esp
+     e34:	53                   	push   %ebx
+     e35:	e8 f6 f5 ff ff       	call   430 <strlen>
+     e3a:	89 da                	mov    %ebx,%edx
+     e3c:	89 c1                	mov    %eax,%ecx
+     e3e:	89 f8                	mov    %edi,%eax
+     e40:	e8 7b fc ff ff       	call   ac0 <put>
+  put(w, "\":", 2);
+     e45:	b9 02 00 00 00       	mov    $0x2,%ecx
+     e4a:	ba 01 13 00 00       	mov    $0x1301,%edx
+     e4f:	89 f8                	mov    %edi,%eax
+     e51:	e8 6a fc ff ff       	call   ac0 <put>
+  x = value < 0 ? -(uint)value : value;
+     e56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+     e59:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+     e5c:	83 c4 10             	add    $0x10,%esp
+     e5f:	f7 d9                	neg    %ecx
+     e61:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+     e65:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+     e68:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     e6d:	89 f3                	mov    %esi,%ebx
+     e6f:	83 ee 01             	sub    $0x1,%esi
+     e72:	f7 e1                	mul    %ecx
+     e74:	89 c8                	mov    %ecx,%eax
+     e76:	c1 ea 03             	shr    $0x3,%edx
+     e79:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     e7c:	01 ff                	add    %edi,%edi
+     e7e:	29 f8                	sub    %edi,%eax
+     e80:	83 c0 30             	add    $0x30,%eax
+     e83:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+     e87:	89 c8                	mov    %ecx,%eax
+     e89:	89 d1                	mov    %edx,%ecx
+     e8b:	83 f8 09             	cmp    $0x9,%eax
+     e8e:	77 d8                	ja     e68 <struct_field_int+0x78>
+  if(value < 0)
+     e90:	8b 45 10             	mov    0x10(%ebp),%eax
+     e93:	8b 7d 08             	mov    0x8(%ebp),%edi
+     e96:	85 c0                	test   %eax,%eax
+     e98:	79 08                	jns    ea2 <struct_field_int+0xb2>
+    buf[--i] = '-';
+     e9a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+     e9f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+     ea2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     ea5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+     eaa:	8d 14 30             	lea    (%eax,%esi,1),%edx
+     ead:	29 f1                	sub    %esi,%ecx
+     eaf:	89 f8                	mov    %edi,%eax
+     eb1:	e8 aa fc ff ff       	call   b60 <putcopy>
+  put_int(w, value);
+}
+     eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb9:	5b                   	pop    %ebx
+     eba:	5e                   	pop    %esi
+     ebb:	5f                   	pop    %edi
+     ebc:	5d                   	pop    %ebp
+     ebd:	c3                   	ret
+     ebe:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+     ec0:	b9 01 00 00 00       	mov    $0x1,%ecx
+     ec5:	ba ea 12 00 00       	mov    $0x12ea,%edx
+     eca:	89 f8                	mov    %edi,%eax
+     ecc:	e8 ef fb ff ff       	call   ac0 <put>
+}
+     ed1:	e9 3b ff ff ff       	jmp    e11 <struct_field_int+0x21>
+     ed6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ee0 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	89 e5                	mov    %esp,%ebp
+     ee3:	56                   	push   %esi
+     ee4:	53                   	push   %ebx
+     ee5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+     ee8:	8b 43 08             	mov    0x8(%ebx),%eax
+     eeb:	85 c0                	test   %eax,%eax
+     eed:	7e 59                	jle    f48 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+     eef:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+     ef2:	8b 4a 0c             	mov    0xc(%edx),%ecx
+     ef5:	8b 72 08             	mov    0x8(%edx),%esi
+     ef8:	01 ce                	add    %ecx,%esi
+     efa:	81 fe 04 13 00 00    	cmp    $0x1304,%esi
+     f00:	0f 84 aa 00 00 00    	je     fb0 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+     f06:	83 f8 20             	cmp    $0x20,%eax
+     f09:	75 75                	jne    f80 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+     f0b:	83 ec 04             	sub    $0x4,%esp
+     f0e:	8d 73 10             	lea    0x10(%ebx),%esi
+     f11:	6a 20                	push   $0x20
+     f13:	56                   	push   %esi
+     f14:	ff 33                	push   (%ebx)
+     f16:	e8 98 f7 ff ff       	call   6b3 <writev>
+  w->nbuf = 0;
+     f1b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+     f22:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+     f25:	c7 43 10 04 13 00 00 	movl   $0x1304,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+     f2c:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+     f33:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+     f3a:	ba 01 00 00 00       	mov    $0x1,%edx
+     f3f:	eb 5a                	jmp    f9b <struct_end+0xbb>
+     f41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+     f48:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     f4b:	83 c0 02             	add    $0x2,%eax
+     f4e:	c7 04 c3 04 13 00 00 	movl   $0x1304,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     f55:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+     f5c:	00 
+  w->niov++;
+     f5d:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+     f60:	83 fa 01             	cmp    $0x1,%edx
+     f63:	74 58                	je     fbd <struct_end+0xdd>
+  w->niov = 0;
+     f65:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+     f6c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+     f73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f76:	5b                   	pop    %ebx
+     f77:	5e                   	pop    %esi
+     f78:	5d                   	pop    %ebp
+     f79:	c3                   	ret
+     f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+     f80:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     f83:	83 c0 02             	add    $0x2,%eax
+     f86:	8d 73 10             	lea    0x10(%ebx),%esi
+     f89:	c7 04 c3 04 13 00 00 	movl   $0x1304,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     f90:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+     f97:	00 
+  w->niov++;
+     f98:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+     f9b:	83 ec 04             	sub    $0x4,%esp
+     f9e:	52                   	push   %edx
+     f9f:	56                   	push   %esi
+     fa0:	ff 33                	push   (%ebx)
+     fa2:	e8 0c f7 ff ff       	call   6b3 <writev>
+     fa7:	83 c4 10             	add    $0x10,%esp
+     faa:	eb b9                	jmp    f65 <struct_end+0x85>
+     fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+     fb0:	83 c1 02             	add    $0x2,%ecx
+     fb3:	8d 73 10             	lea    0x10(%ebx),%esi
+     fb6:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+     fb9:	89 c2                	mov    %eax,%edx
+     fbb:	eb de                	jmp    f9b <struct_end+0xbb>
+     fbd:	8d 73 10             	lea    0x10(%ebx),%esi
+     fc0:	e9 75 ff ff ff       	jmp    f3a <struct_end+0x5a>
+     fc5:	66 90                	xchg   %ax,%ax
+     fc7:	66 90                	xchg   %ax,%ax
+     fc9:	66 90                	xchg   %ax,%ax
+     fcb:	66 90                	xchg   %ax,%ax
+     fcd:	66 90                	xchg   %ax,%ax
+     fcf:	90                   	nop
+
+00000fd0 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+     fd0:	55                   	push   %ebp
+     fd1:	89 e5                	mov    %esp,%ebp
+     fd3:	56                   	push   %esi
+     fd4:	89 c6                	mov    %eax,%esi
+     fd6:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+     fd7:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+     fdd:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+     fe3:	6a 01                	push   $0x1
+     fe5:	53                   	push   %ebx
+     fe6:	e8 05 fc ff ff       	call   bf0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+     feb:	83 c4 0c             	add    $0xc,%esp
+     fee:	56                   	push   %esi
+     fef:	68 0a 13 00 00       	push   $0x130a
+     ff4:	53                   	push   %ebx
+     ff5:	e8 26 fc ff ff       	call   c20 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+     ffa:	83 c4 0c             	add    $0xc,%esp
+     ffd:	68 12 13 00 00       	push   $0x1312
+    1002:	68 23 13 00 00       	push   $0x1323
+    1007:	53                   	push   %ebx
+    1008:	e8 13 fc ff ff       	call   c20 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+    100d:	83 c4 0c             	add    $0xc,%esp
+    1010:	68 ea 07 00 00       	push   $0x7ea
+    1015:	68 2a 13 00 00       	push   $0x132a
+    101a:	53                   	push   %ebx
+    101b:	e8 d0 fd ff ff       	call   df0 <struct_field_int>
+  struct_end(&w);
+    1020:	89 1c 24             	mov    %ebx,(%esp)
+    1023:	e8 b8 fe ff ff       	call   ee0 <struct_end>
+    1028:	83 c4 10             	add    $0x10,%esp
+}
+    102b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    102e:	5b                   	pop    %ebx
+    102f:	5e                   	pop    %esi
+    1030:	5d                   	pop    %ebp
+    1031:	c3                   	ret
+    1032:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001040 <modern_consume_flags>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	57                   	push   %edi
+    1044:	56                   	push   %esi
+    1045:	53                   	push   %ebx
+    1046:	83 ec 0c             	sub    $0xc,%esp
+    1049:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+    104c:	85 f6                	test   %esi,%esi
+    104e:	74 06                	je     1056 <modern_consume_flags+0x16>
+    *json_mode = 0;
+    1050:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+    1056:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+    105a:	bf 01 00 00 00       	mov    $0x1,%edi
+    105f:	7e 4c                	jle    10ad <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+    1061:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+    1064:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+    1067:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+    106a:	68 2f 13 00 00       	push   $0x132f
+    106f:	53                   	push   %ebx
+    1070:	e8 5b f3 ff ff       	call   3d0 <strcmp>
+    1075:	83 c4 10             	add    $0x10,%esp
+    1078:	85 c0                	test   %eax,%eax
+    107a:	74 58                	je     10d4 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+    107c:	8b 45 14             	mov    0x14(%ebp),%eax
+    107f:	85 c0                	test   %eax,%eax
+    1081:	74 2a                	je     10ad <modern_consume_flags+0x6d>
+    1083:	83 ec 08             	sub    $0x8,%esp
+    1086:	68 47 13 00 00       	push   $0x1347
+    108b:	53                   	push   %ebx
+    108c:	e8 3f f3 ff ff       	call   3d0 <strcmp>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	85 c0                	test   %eax,%eax
+    1096:	74 28                	je     10c0 <modern_consume_flags+0x80>
+    1098:	83 ec 08             	sub    $0x8,%esp
+    109b:	68 4a 13 00 00       	push   $0x134a
+    10a0:	53                   	push   %ebx
+    10a1:	e8 2a f3 ff ff       	call   3d0 <strcmp>
+    10a6:	83 c4 10             	add    $0x10,%esp
+    10a9:	85 c0                	test   %eax,%eax
+    10ab:	74 13                	je     10c0 <modern_consume_flags+0x80>
+}
+    10ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10b0:	89 f8                	mov    %edi,%eax
+    10b2:	5b                   	pop    %ebx
+    10b3:	5e                   	pop    %esi
+    10b4:	5f                   	pop    %edi
+    10b5:	5d                   	pop    %ebp
+    10b6:	c3                   	ret
+    10b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10be:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+    10c0:	85 f6                	test   %esi,%esi
+    10c2:	74 06                	je     10ca <modern_consume_flags+0x8a>
+        *json_mode = 1;
+    10c4:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+    10ca:	83 c7 01             	add    $0x1,%edi
+    10cd:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+    10d0:	75 8f                	jne    1061 <modern_consume_flags+0x21>
+    10d2:	eb d9                	jmp    10ad <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+    10d4:	85 f6                	test   %esi,%esi
+    10d6:	74 12                	je     10ea <modern_consume_flags+0xaa>
+  if(!json_mode){
+    10d8:	83 3e 00             	cmpl   $0x0,(%esi)
+    10db:	74 0d                	je     10ea <modern_consume_flags+0xaa>
+    10dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e0:	e8 eb fe ff ff       	call   fd0 <modern_print_version.part.0>
+      exit();
+    10e5:	e8 f9 f4 ff ff       	call   5e3 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    10ea:	83 ec 0c             	sub    $0xc,%esp
+    10ed:	68 ea 07 00 00       	push   $0x7ea
+    10f2:	68 12 13 00 00       	push   $0x1312
+    10f7:	ff 75 08             	push   0x8(%ebp)
+    10fa:	68 39 13 00 00       	push   $0x1339
+    10ff:	6a 01                	push   $0x1
+    1101:	e8 8a f6 ff ff       	call   790 <printf>
+}
+    1106:	83 c4 20             	add    $0x20,%esp
+    1109:	eb da                	jmp    10e5 <modern_consume_flags+0xa5>
+    110b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    110f:	90                   	nop
+
+00001110 <modern_print_version>:
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    1116:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    1119:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    111c:	85 d2                	test   %edx,%edx
+    111e:	74 10                	je     1130 <modern_print_version+0x20>
+}
+    1120:	c9                   	leave
+    1121:	e9 aa fe ff ff       	jmp    fd0 <modern_print_version.part.0>
+    1126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    112d:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    1130:	83 ec 0c             	sub    $0xc,%esp
+    1133:	68 ea 07 00 00       	push   $0x7ea
+    1138:	68 12 13 00 00       	push   $0x1312
+    113d:	50                   	push   %eax
+    113e:	68 39 13 00 00       	push   $0x1339
+    1143:	6a 01                	push   $0x1
+    1145:	e8 46 f6 ff ff       	call   790 <printf>
+}
+    114a:	83 c4 20             	add    $0x20,%esp
+}
+    114d:	c9                   	leave
+    114e:	c3                   	ret
+    114f:	90                   	nop
+
+00001150 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+    1155:	53                   	push   %ebx
+    1156:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    115c:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    115f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1162:	8b 45 10             	mov    0x10(%ebp),%eax
+    1165:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    1168:	85 d2                	test   %edx,%edx
+    116a:	75 44                	jne    11b0 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    116c:	85 f6                	test   %esi,%esi
+    116e:	ba 51 13 00 00       	mov    $0x1351,%edx
+    1173:	0f 44 f2             	cmove  %edx,%esi
+    1176:	85 c0                	test   %eax,%eax
+    1178:	ba 46 13 00 00       	mov    $0x1346,%edx
+    117d:	0f 44 c2             	cmove  %edx,%eax
+    1180:	85 db                	test   %ebx,%ebx
+    1182:	ba 56 13 00 00       	mov    $0x1356,%edx
+    1187:	0f 44 da             	cmove  %edx,%ebx
+    118a:	83 ec 08             	sub    $0x8,%esp
+    118d:	56                   	push   %esi
+    118e:	50                   	push   %eax
+    118f:	53                   	push   %ebx
+    1190:	ff 75 08             	push   0x8(%ebp)
+    1193:	68 5c 13 00 00       	push   $0x135c
+    1198:	6a 01                	push   $0x1
+    119a:	e8 f1 f5 ff ff       	call   790 <printf>
+    119f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    11a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11a5:	5b                   	pop    %ebx
+    11a6:	5e                   	pop    %esi
+    11a7:	5f                   	pop    %edi
+    11a8:	5d                   	pop    %ebp
+    11a9:	c3                   	ret
+    11aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    11b0:	83 ec 08             	sub    $0x8,%esp
+    11b3:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    11b9:	89 45 10             	mov    %eax,0x10(%ebp)
+    11bc:	6a 01                	push   $0x1
+    11be:	57                   	push   %edi
+    11bf:	e8 2c fa ff ff       	call   bf0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    11c4:	83 c4 0c             	add    $0xc,%esp
+    11c7:	ff 75 08             	push   0x8(%ebp)
+    11ca:	68 0a 13 00 00       	push   $0x130a
+    11cf:	57                   	push   %edi
+    11d0:	e8 4b fa ff ff       	call   c20 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    11d5:	83 c4 0c             	add    $0xc,%esp
+    11d8:	ba 56 13 00 00       	mov    $0x1356,%edx
+    11dd:	85 db                	test   %ebx,%ebx
+    11df:	0f 44 da             	cmove  %edx,%ebx
+    11e2:	53                   	push   %ebx
+    11e3:	52                   	push   %edx
+    11e4:	57                   	push   %edi
+    11e5:	e8 36 fa ff ff       	call   c20 <struct_field_str>
+  if(target)
+    11ea:	8b 45 10             	mov    0x10(%ebp),%eax
+    11ed:	83 c4 10             	add    $0x10,%esp
+    11f0:	85 c0                	test   %eax,%eax
+    11f2:	74 12                	je     1206 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    11f4:	83 ec 04             	sub    $0x4,%esp
+    11f7:	50                   	push   %eax
+    11f8:	68 6a 13 00 00       	push   $0x136a
+    11fd:	57                   	push   %edi
+    11fe:	e8 1d fa ff ff       	call   c20 <struct_field_str>
+    1203:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    1206:	85 f6                	test   %esi,%esi
+    1208:	74 12                	je     121c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    120a:	83 ec 04             	sub    $0x4,%esp
+    120d:	56                   	push   %esi
+    120e:	68 71 13 00 00       	push   $0x1371
+    1213:	57                   	push   %edi
+    1214:	e8 07 fa ff ff       	call   c20 <struct_field_str>
+    1219:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    121c:	83 ec 0c             	sub    $0xc,%esp
+    121f:	57                   	push   %edi
+    1220:	e8 bb fc ff ff       	call   ee0 <struct_end>
+    1225:	83 c4 10             	add    $0x10,%esp
+}
+    1228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    122b:	5b                   	pop    %ebx
+    122c:	5e                   	pop    %esi
+    122d:	5f                   	pop    %edi
+    122e:	5d                   	pop    %ebp
+    122f:	c3                   	ret
@@ -0,0 +1,4273 @@
+
+build/bin/user/_hello:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 14             	sub    $0x14,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 41 04             	mov    0x4(%ecx),%eax
+  static char buf[100];
+  int fd;
+  int argi = modern_consume_flags("hello", argc, argv, 1, &hello_json);
+      19:	68 04 2e 00 00       	push   $0x2e04
+      1e:	6a 01                	push   $0x1
+      20:	50                   	push   %eax
+      21:	53                   	push   %ebx
+      22:	68 00 21 00 00       	push   $0x2100
+      27:	e8 e4 1e 00 00       	call   1f10 <modern_consume_flags>
+
+  if(argi < argc){
+      2c:	83 c4 20             	add    $0x20,%esp
+      2f:	39 c3                	cmp    %eax,%ebx
+      31:	7e 16                	jle    49 <main+0x49>
+      33:	e9 d4 02 00 00       	jmp    30c <main+0x30c>
+      38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3f:	90                   	nop
+    printf(2, "hello: unexpected arguments\n");
+  }
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+    if(fd >= 3){
+      40:	83 f8 02             	cmp    $0x2,%eax
+      43:	0f 8f b2 02 00 00    	jg     2fb <main+0x2fb>
+  while((fd = open("console", O_RDWR)) >= 0){
+      49:	83 ec 08             	sub    $0x8,%esp
+      4c:	6a 02                	push   $0x2
+      4e:	68 0d 22 00 00       	push   $0x220d
+      53:	e8 9b 14 00 00       	call   14f3 <open>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 e1                	jns    40 <main+0x40>
+}
+
+static char*
+skipws(char *s)
+{
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+      5f:	be ec ff 7f ff       	mov    $0xff7fffec,%esi
+      64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  hello_show_prompt();
+      68:	e8 93 03 00 00       	call   400 <hello_show_prompt>
+  memset(buf, 0, nbuf);
+      6d:	83 ec 04             	sub    $0x4,%esp
+      70:	6a 64                	push   $0x64
+      72:	6a 00                	push   $0x0
+      74:	68 a0 2d 00 00       	push   $0x2da0
+      79:	e8 b2 12 00 00       	call   1330 <memset>
+  gets(buf, nbuf);
+      7e:	58                   	pop    %eax
+      7f:	5a                   	pop    %edx
+      80:	6a 64                	push   $0x64
+      82:	68 a0 2d 00 00       	push   $0x2da0
+      87:	e8 04 13 00 00       	call   1390 <gets>
+  if(buf[0] == 0) // EOF
+      8c:	0f b6 15 a0 2d 00 00 	movzbl 0x2da0,%edx
+      93:	83 c4 10             	add    $0x10,%esp
+      96:	84 d2                	test   %dl,%dl
+      98:	0f 84 45 03 00 00    	je     3e3 <main+0x3e3>
+  for(int i = 0; s[i]; i++){
+      9e:	89 d0                	mov    %edx,%eax
+      a0:	b9 a0 2d 00 00       	mov    $0x2da0,%ecx
+      a5:	8d 76 00             	lea    0x0(%esi),%esi
+    if(s[i] == '\n' || s[i] == '\r'){
+      a8:	3c 0a                	cmp    $0xa,%al
+      aa:	0f 84 f0 00 00 00    	je     1a0 <main+0x1a0>
+      b0:	3c 0d                	cmp    $0xd,%al
+      b2:	0f 84 e8 00 00 00    	je     1a0 <main+0x1a0>
+  for(int i = 0; s[i]; i++){
+      b8:	0f b6 41 01          	movzbl 0x1(%ecx),%eax
+      bc:	83 c1 01             	add    $0x1,%ecx
+      bf:	84 c0                	test   %al,%al
+      c1:	75 e5                	jne    a8 <main+0xa8>
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+      c3:	8d 42 f7             	lea    -0x9(%edx),%eax
+      c6:	bb a0 2d 00 00       	mov    $0x2da0,%ebx
+      cb:	3c 17                	cmp    $0x17,%al
+      cd:	77 1b                	ja     ea <main+0xea>
+      cf:	0f a3 c6             	bt     %eax,%esi
+      d2:	72 1e                	jb     f2 <main+0xf2>
+      d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      d8:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+    s++;
+      dc:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+      df:	8d 42 f7             	lea    -0x9(%edx),%eax
+      e2:	3c 17                	cmp    $0x17,%al
+      e4:	0f 86 a6 00 00 00    	jbe    190 <main+0x190>
+static int
+handle_builtin(char *buf)
+{
+  trim_newline(buf);
+  char *s = skipws(buf);
+  if(*s == 0)
+      ea:	84 d2                	test   %dl,%dl
+      ec:	0f 84 76 ff ff ff    	je     68 <main+0x68>
+    return 1;
+
+  if(s[0] == 'c' && s[1] == 'd' && (s[2] == 0 || s[2] == ' ' || s[2] == '\t')){
+      f2:	80 fa 63             	cmp    $0x63,%dl
+      f5:	75 0a                	jne    101 <main+0x101>
+      f7:	80 7b 01 64          	cmpb   $0x64,0x1(%ebx)
+      fb:	0f 84 d3 00 00 00    	je     1d4 <main+0x1d4>
+      printf(2, "hello: cannot cd %s\n", arg);
+    }
+    return 1;
+  }
+
+  if(strcmp(s, "help") == 0){
+     101:	83 ec 08             	sub    $0x8,%esp
+     104:	68 1d 21 00 00       	push   $0x211d
+     109:	53                   	push   %ebx
+     10a:	e8 91 11 00 00       	call   12a0 <strcmp>
+     10f:	83 c4 10             	add    $0x10,%esp
+     112:	85 c0                	test   %eax,%eax
+     114:	0f 84 b0 00 00 00    	je     1ca <main+0x1ca>
+    hello_help();
+    return 1;
+  }
+
+  if(strcmp(s, "version") == 0 || strcmp(s, "--version") == 0){
+     11a:	83 ec 08             	sub    $0x8,%esp
+     11d:	68 47 22 00 00       	push   $0x2247
+     122:	53                   	push   %ebx
+     123:	e8 78 11 00 00       	call   12a0 <strcmp>
+     128:	83 c4 10             	add    $0x10,%esp
+     12b:	85 c0                	test   %eax,%eax
+     12d:	0f 84 7c 00 00 00    	je     1af <main+0x1af>
+     133:	83 ec 08             	sub    $0x8,%esp
+     136:	68 45 22 00 00       	push   $0x2245
+     13b:	53                   	push   %ebx
+     13c:	e8 5f 11 00 00       	call   12a0 <strcmp>
+     141:	83 c4 10             	add    $0x10,%esp
+     144:	85 c0                	test   %eax,%eax
+     146:	74 67                	je     1af <main+0x1af>
+}
+
+static int
+hello_strncmp(const char *a, const char *b, int n)
+{
+  for(int i = 0; i < n; i++){
+     148:	31 c0                	xor    %eax,%eax
+     14a:	eb 18                	jmp    164 <main+0x164>
+     14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    char ca = a[i];
+    char cb = b[i];
+    if(ca != cb)
+      return ca - cb;
+    if(ca == 0)
+     150:	84 d2                	test   %dl,%dl
+     152:	0f 84 e0 00 00 00    	je     238 <main+0x238>
+  for(int i = 0; i < n; i++){
+     158:	83 c0 01             	add    $0x1,%eax
+     15b:	83 f8 04             	cmp    $0x4,%eax
+     15e:	0f 84 d4 00 00 00    	je     238 <main+0x238>
+    char ca = a[i];
+     164:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    if(ca != cb)
+     168:	3a 90 39 21 00 00    	cmp    0x2139(%eax),%dl
+     16e:	74 e0                	je     150 <main+0x150>
+  pid = fork();
+     170:	e8 36 13 00 00       	call   14ab <fork>
+  if(pid == -1)
+     175:	83 f8 ff             	cmp    $0xffffffff,%eax
+     178:	0f 84 6a 02 00 00    	je     3e8 <main+0x3e8>
+    if(fork1() == 0)
+     17e:	85 c0                	test   %eax,%eax
+     180:	0f 84 9c 01 00 00    	je     322 <main+0x322>
+    wait();
+     186:	e8 30 13 00 00       	call   14bb <wait>
+     18b:	e9 d8 fe ff ff       	jmp    68 <main+0x68>
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     190:	0f a3 c6             	bt     %eax,%esi
+     193:	0f 83 3f ff ff ff    	jae    d8 <main+0xd8>
+     199:	e9 4c ff ff ff       	jmp    ea <main+0xea>
+     19e:	66 90                	xchg   %ax,%ax
+      s[i] = 0;
+     1a0:	c6 01 00             	movb   $0x0,(%ecx)
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     1a3:	0f b6 15 a0 2d 00 00 	movzbl 0x2da0,%edx
+      return;
+     1aa:	e9 14 ff ff ff       	jmp    c3 <main+0xc3>
+    modern_print_version("hello", hello_json);
+     1af:	83 ec 08             	sub    $0x8,%esp
+     1b2:	ff 35 04 2e 00 00    	push   0x2e04
+     1b8:	68 00 21 00 00       	push   $0x2100
+     1bd:	e8 1e 1e 00 00       	call   1fe0 <modern_print_version>
+    return 1;
+     1c2:	83 c4 10             	add    $0x10,%esp
+     1c5:	e9 9e fe ff ff       	jmp    68 <main+0x68>
+    hello_help();
+     1ca:	e8 a1 02 00 00       	call   470 <hello_help>
+    return 1;
+     1cf:	e9 94 fe ff ff       	jmp    68 <main+0x68>
+  if(s[0] == 'c' && s[1] == 'd' && (s[2] == 0 || s[2] == ' ' || s[2] == '\t')){
+     1d4:	0f b6 53 02          	movzbl 0x2(%ebx),%edx
+     1d8:	f6 c2 df             	test   $0xdf,%dl
+     1db:	74 09                	je     1e6 <main+0x1e6>
+     1dd:	80 fa 09             	cmp    $0x9,%dl
+     1e0:	0f 85 1b ff ff ff    	jne    101 <main+0x101>
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     1e6:	8d 4a f7             	lea    -0x9(%edx),%ecx
+    char *arg = skipws(s+2);
+     1e9:	83 c3 02             	add    $0x2,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     1ec:	80 f9 17             	cmp    $0x17,%cl
+     1ef:	77 29                	ja     21a <main+0x21a>
+     1f1:	b8 ec ff 7f ff       	mov    $0xff7fffec,%eax
+     1f6:	d3 f8                	sar    %cl,%eax
+     1f8:	a8 01                	test   $0x1,%al
+     1fa:	0f 85 d1 00 00 00    	jne    2d1 <main+0x2d1>
+     200:	b9 ec ff 7f ff       	mov    $0xff7fffec,%ecx
+     205:	8d 76 00             	lea    0x0(%esi),%esi
+     208:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+    s++;
+     20c:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     20f:	8d 42 f7             	lea    -0x9(%edx),%eax
+     212:	3c 17                	cmp    $0x17,%al
+     214:	0f 86 ae 00 00 00    	jbe    2c8 <main+0x2c8>
+    if(*arg == 0){
+     21a:	84 d2                	test   %dl,%dl
+     21c:	0f 85 af 00 00 00    	jne    2d1 <main+0x2d1>
+      printf(2, "hello: cd requires a path\n");
+     222:	50                   	push   %eax
+     223:	50                   	push   %eax
+     224:	68 15 22 00 00       	push   $0x2215
+     229:	6a 02                	push   $0x2
+     22b:	e8 30 14 00 00       	call   1660 <printf>
+     230:	83 c4 10             	add    $0x10,%esp
+     233:	e9 30 fe ff ff       	jmp    68 <main+0x68>
+  if(hello_strncmp(s, "path", 4) == 0 && (s[4] == 0 || s[4] == ' ' || s[4] == '\t')){
+     238:	0f b6 53 04          	movzbl 0x4(%ebx),%edx
+     23c:	f6 c2 df             	test   $0xdf,%dl
+     23f:	74 09                	je     24a <main+0x24a>
+     241:	80 fa 09             	cmp    $0x9,%dl
+     244:	0f 85 26 ff ff ff    	jne    170 <main+0x170>
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     24a:	8d 4a f7             	lea    -0x9(%edx),%ecx
+    char *arg = skipws(s+4);
+     24d:	83 c3 04             	add    $0x4,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     250:	80 f9 17             	cmp    $0x17,%cl
+     253:	77 60                	ja     2b5 <main+0x2b5>
+     255:	b8 ec ff 7f ff       	mov    $0xff7fffec,%eax
+     25a:	d3 f8                	sar    %cl,%eax
+     25c:	a8 01                	test   $0x1,%al
+     25e:	75 1b                	jne    27b <main+0x27b>
+     260:	b9 ec ff 7f ff       	mov    $0xff7fffec,%ecx
+     265:	8d 76 00             	lea    0x0(%esi),%esi
+     268:	0f b6 53 01          	movzbl 0x1(%ebx),%edx
+    s++;
+     26c:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     26f:	8d 42 f7             	lea    -0x9(%edx),%eax
+     272:	3c 17                	cmp    $0x17,%al
+     274:	77 3f                	ja     2b5 <main+0x2b5>
+     276:	0f a3 c1             	bt     %eax,%ecx
+     279:	73 ed                	jae    268 <main+0x268>
+  for(int i = 0; i < n; i++){
+     27b:	31 c0                	xor    %eax,%eax
+     27d:	eb 14                	jmp    293 <main+0x293>
+    if(ca == 0)
+     27f:	84 d2                	test   %dl,%dl
+     281:	0f 84 b0 00 00 00    	je     337 <main+0x337>
+  for(int i = 0; i < n; i++){
+     287:	83 c0 01             	add    $0x1,%eax
+     28a:	83 f8 03             	cmp    $0x3,%eax
+     28d:	0f 84 a4 00 00 00    	je     337 <main+0x337>
+    char ca = a[i];
+     293:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    if(ca != cb)
+     297:	3a 90 4f 22 00 00    	cmp    0x224f(%eax),%dl
+     29d:	74 e0                	je     27f <main+0x27f>
+      printf(2, "hello: usage path [set <paths>]\n");
+     29f:	51                   	push   %ecx
+     2a0:	51                   	push   %ecx
+     2a1:	68 60 23 00 00       	push   $0x2360
+     2a6:	6a 02                	push   $0x2
+     2a8:	e8 b3 13 00 00       	call   1660 <printf>
+     2ad:	83 c4 10             	add    $0x10,%esp
+     2b0:	e9 b3 fd ff ff       	jmp    68 <main+0x68>
+    if(*arg == 0){
+     2b5:	84 d2                	test   %dl,%dl
+     2b7:	75 c2                	jne    27b <main+0x27b>
+      hello_print_path();
+     2b9:	e8 72 02 00 00       	call   530 <hello_print_path>
+     2be:	e9 a5 fd ff ff       	jmp    68 <main+0x68>
+     2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c7:	90                   	nop
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     2c8:	0f a3 c1             	bt     %eax,%ecx
+     2cb:	0f 83 37 ff ff ff    	jae    208 <main+0x208>
+    } else if(chdir(arg) < 0){
+     2d1:	83 ec 0c             	sub    $0xc,%esp
+     2d4:	53                   	push   %ebx
+     2d5:	e8 49 12 00 00       	call   1523 <chdir>
+     2da:	83 c4 10             	add    $0x10,%esp
+     2dd:	85 c0                	test   %eax,%eax
+     2df:	0f 89 83 fd ff ff    	jns    68 <main+0x68>
+      printf(2, "hello: cannot cd %s\n", arg);
+     2e5:	57                   	push   %edi
+     2e6:	53                   	push   %ebx
+     2e7:	68 30 22 00 00       	push   $0x2230
+     2ec:	6a 02                	push   $0x2
+     2ee:	e8 6d 13 00 00       	call   1660 <printf>
+     2f3:	83 c4 10             	add    $0x10,%esp
+     2f6:	e9 6d fd ff ff       	jmp    68 <main+0x68>
+      close(fd);
+     2fb:	83 ec 0c             	sub    $0xc,%esp
+     2fe:	50                   	push   %eax
+     2ff:	e8 d7 11 00 00       	call   14db <close>
+      break;
+     304:	83 c4 10             	add    $0x10,%esp
+     307:	e9 53 fd ff ff       	jmp    5f <main+0x5f>
+    printf(2, "hello: unexpected arguments\n");
+     30c:	50                   	push   %eax
+     30d:	50                   	push   %eax
+     30e:	68 f0 21 00 00       	push   $0x21f0
+     313:	6a 02                	push   $0x2
+     315:	e8 46 13 00 00       	call   1660 <printf>
+     31a:	83 c4 10             	add    $0x10,%esp
+     31d:	e9 27 fd ff ff       	jmp    49 <main+0x49>
+      runcmd(parsecmd(buf));
+     322:	83 ec 0c             	sub    $0xc,%esp
+     325:	68 a0 2d 00 00       	push   $0x2da0
+     32a:	e8 d1 0e 00 00       	call   1200 <parsecmd>
+     32f:	89 04 24             	mov    %eax,(%esp)
+     332:	e8 29 05 00 00       	call   860 <runcmd>
+    } else if(hello_strncmp(arg, "set", 3) == 0 && (arg[3] == 0 || arg[3] == ' ' || arg[3] == '\t')){
+     337:	0f b6 43 03          	movzbl 0x3(%ebx),%eax
+     33b:	a8 df                	test   $0xdf,%al
+     33d:	74 08                	je     347 <main+0x347>
+     33f:	3c 09                	cmp    $0x9,%al
+     341:	0f 85 58 ff ff ff    	jne    29f <main+0x29f>
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     347:	8d 48 f7             	lea    -0x9(%eax),%ecx
+      char *val = skipws(arg+3);
+     34a:	83 c3 03             	add    $0x3,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     34d:	80 f9 17             	cmp    $0x17,%cl
+     350:	77 33                	ja     385 <main+0x385>
+     352:	b8 ec ff 7f ff       	mov    $0xff7fffec,%eax
+     357:	d3 f8                	sar    %cl,%eax
+     359:	a8 01                	test   $0x1,%al
+     35b:	75 32                	jne    38f <main+0x38f>
+     35d:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    s++;
+     361:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     364:	b9 ec ff 7f ff       	mov    $0xff7fffec,%ecx
+     369:	8d 50 f7             	lea    -0x9(%eax),%edx
+     36c:	80 fa 17             	cmp    $0x17,%dl
+     36f:	77 14                	ja     385 <main+0x385>
+     371:	0f a3 d1             	bt     %edx,%ecx
+     374:	72 19                	jb     38f <main+0x38f>
+     376:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    s++;
+     37a:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n')
+     37d:	8d 50 f7             	lea    -0x9(%eax),%edx
+     380:	80 fa 17             	cmp    $0x17,%dl
+     383:	76 ec                	jbe    371 <main+0x371>
+    value = "bin";
+     385:	84 c0                	test   %al,%al
+     387:	b8 ec 21 00 00       	mov    $0x21ec,%eax
+     38c:	0f 44 d8             	cmove  %eax,%ebx
+  int len = strlen(value);
+     38f:	83 ec 0c             	sub    $0xc,%esp
+     392:	53                   	push   %ebx
+     393:	e8 68 0f 00 00       	call   1300 <strlen>
+  if(len >= HELLO_MAXPATH)
+     398:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     39d:	39 d0                	cmp    %edx,%eax
+     39f:	89 d7                	mov    %edx,%edi
+     3a1:	0f 4e f8             	cmovle %eax,%edi
+  memmove(hello_path, value, len);
+     3a4:	83 c4 0c             	add    $0xc,%esp
+     3a7:	57                   	push   %edi
+     3a8:	53                   	push   %ebx
+     3a9:	68 20 2d 00 00       	push   $0x2d20
+     3ae:	e8 cd 10 00 00       	call   1480 <memmove>
+  modern_emit_status("hello", event, detail, hello_json, "ok");
+     3b3:	c7 04 24 53 22 00 00 	movl   $0x2253,(%esp)
+     3ba:	ff 35 04 2e 00 00    	push   0x2e04
+     3c0:	68 20 2d 00 00       	push   $0x2d20
+     3c5:	68 39 21 00 00       	push   $0x2139
+     3ca:	68 00 21 00 00       	push   $0x2100
+  hello_path[len] = 0;
+     3cf:	c6 87 20 2d 00 00 00 	movb   $0x0,0x2d20(%edi)
+  modern_emit_status("hello", event, detail, hello_json, "ok");
+     3d6:	e8 45 1c 00 00       	call   2020 <modern_emit_status>
+}
+     3db:	83 c4 20             	add    $0x20,%esp
+     3de:	e9 85 fc ff ff       	jmp    68 <main+0x68>
+  exit();
+     3e3:	e8 cb 10 00 00       	call   14b3 <exit>
+    panic("fork");
+     3e8:	83 ec 0c             	sub    $0xc,%esp
+     3eb:	68 47 21 00 00       	push   $0x2147
+     3f0:	e8 2b 04 00 00       	call   820 <panic>
+     3f5:	66 90                	xchg   %ax,%ax
+     3f7:	66 90                	xchg   %ax,%ax
+     3f9:	66 90                	xchg   %ax,%ax
+     3fb:	66 90                	xchg   %ax,%ax
+     3fd:	66 90                	xchg   %ax,%ax
+     3ff:	90                   	nop
+
+00000400 <hello_show_prompt>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	81 ec 54 01 00 00    	sub    $0x154,%esp
+  if(hello_json){
+     40a:	a1 04 2e 00 00       	mov    0x2e04,%eax
+     40f:	85 c0                	test   %eax,%eax
+     411:	74 3d                	je     450 <hello_show_prompt+0x50>
+    struct_begin(&w, 1);
+     413:	83 ec 08             	sub    $0x8,%esp
+     416:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+     41c:	6a 01                	push   $0x1
+     41e:	53                   	push   %ebx
+     41f:	e8 9c 16 00 00       	call   1ac0 <struct_begin>
+    struct_field_str(&w, "prompt", "hello");
+     424:	83 c4 0c             	add    $0xc,%esp
+     427:	68 00 21 00 00       	push   $0x2100
+     42c:	68 06 21 00 00       	push   $0x2106
+     431:	53                   	push   %ebx
+     432:	e8 b9 16 00 00       	call   1af0 <struct_field_str>
+    struct_end(&w);
+     437:	89 1c 24             	mov    %ebx,(%esp)
+     43a:	e8 71 19 00 00       	call   1db0 <struct_end>
+}
+     43f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	c9                   	leave
+     446:	c3                   	ret
+     447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44e:	66 90                	xchg   %ax,%ax
+    printf(2, "hello$ ");
+     450:	83 ec 08             	sub    $0x8,%esp
+     453:	68 0d 21 00 00       	push   $0x210d
+     458:	6a 02                	push   $0x2
+     45a:	e8 01 12 00 00       	call   1660 <printf>
+}
+     45f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(2, "hello$ ");
+     462:	83 c4 10             	add    $0x10,%esp
+}
+     465:	c9                   	leave
+     466:	c3                   	ret
+     467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46e:	66 90                	xchg   %ax,%ax
+
+00000470 <hello_help>:
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	81 ec 54 01 00 00    	sub    $0x154,%esp
+  if(hello_json){
+     47a:	8b 0d 04 2e 00 00    	mov    0x2e04,%ecx
+     480:	85 c9                	test   %ecx,%ecx
+     482:	74 4c                	je     4d0 <hello_help+0x60>
+    struct_begin(&w, 1);
+     484:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+     48a:	83 ec 08             	sub    $0x8,%esp
+     48d:	6a 01                	push   $0x1
+     48f:	53                   	push   %ebx
+     490:	e8 2b 16 00 00       	call   1ac0 <struct_begin>
+    struct_field_str(&w, "command", "hello");
+     495:	83 c4 0c             	add    $0xc,%esp
+     498:	68 00 21 00 00       	push   $0x2100
+     49d:	68 15 21 00 00       	push   $0x2115
+     4a2:	53                   	push   %ebx
+     4a3:	e8 48 16 00 00       	call   1af0 <struct_field_str>
+    struct_field_str(&w, "help",
+     4a8:	83 c4 0c             	add    $0xc,%esp
+     4ab:	68 58 22 00 00       	push   $0x2258
+     4b0:	68 1d 21 00 00       	push   $0x211d
+     4b5:	53                   	push   %ebx
+     4b6:	e8 35 16 00 00       	call   1af0 <struct_field_str>
+    struct_end(&w);
+     4bb:	89 1c 24             	mov    %ebx,(%esp)
+     4be:	e8 ed 18 00 00       	call   1db0 <struct_end>
+}
+     4c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4c6:	83 c4 10             	add    $0x10,%esp
+     4c9:	c9                   	leave
+     4ca:	c3                   	ret
+     4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4cf:	90                   	nop
+    printf(1, "Hello Shell commands:\n");
+     4d0:	83 ec 08             	sub    $0x8,%esp
+     4d3:	68 22 21 00 00       	push   $0x2122
+     4d8:	6a 01                	push   $0x1
+     4da:	e8 81 11 00 00       	call   1660 <printf>
+    printf(1, "  cd <dir>        change directory\n");
+     4df:	58                   	pop    %eax
+     4e0:	5a                   	pop    %edx
+     4e1:	68 90 22 00 00       	push   $0x2290
+     4e6:	6a 01                	push   $0x1
+     4e8:	e8 73 11 00 00       	call   1660 <printf>
+    printf(1, "  path            show command search path\n");
+     4ed:	59                   	pop    %ecx
+     4ee:	5b                   	pop    %ebx
+     4ef:	68 b4 22 00 00       	push   $0x22b4
+     4f4:	6a 01                	push   $0x1
+     4f6:	e8 65 11 00 00       	call   1660 <printf>
+    printf(1, "  path set X      set path (colon separated)\n");
+     4fb:	58                   	pop    %eax
+     4fc:	5a                   	pop    %edx
+     4fd:	68 e0 22 00 00       	push   $0x22e0
+     502:	6a 01                	push   $0x1
+     504:	e8 57 11 00 00       	call   1660 <printf>
+    printf(1, "  help            show this message\n");
+     509:	59                   	pop    %ecx
+     50a:	5b                   	pop    %ebx
+     50b:	68 10 23 00 00       	push   $0x2310
+     510:	6a 01                	push   $0x1
+     512:	e8 49 11 00 00       	call   1660 <printf>
+    printf(1, "  version         show version info\n");
+     517:	58                   	pop    %eax
+     518:	5a                   	pop    %edx
+     519:	68 38 23 00 00       	push   $0x2338
+     51e:	6a 01                	push   $0x1
+     520:	e8 3b 11 00 00       	call   1660 <printf>
+}
+     525:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "  version         show version info\n");
+     528:	83 c4 10             	add    $0x10,%esp
+}
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+     52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <hello_print_path>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	53                   	push   %ebx
+     534:	81 ec 54 01 00 00    	sub    $0x154,%esp
+  if(hello_json){
+     53a:	a1 04 2e 00 00       	mov    0x2e04,%eax
+     53f:	85 c0                	test   %eax,%eax
+     541:	74 4d                	je     590 <hello_print_path+0x60>
+    struct_begin(&w, 1);
+     543:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+     549:	83 ec 08             	sub    $0x8,%esp
+     54c:	6a 01                	push   $0x1
+     54e:	53                   	push   %ebx
+     54f:	e8 6c 15 00 00       	call   1ac0 <struct_begin>
+    struct_field_str(&w, "command", "hello");
+     554:	83 c4 0c             	add    $0xc,%esp
+     557:	68 00 21 00 00       	push   $0x2100
+     55c:	68 15 21 00 00       	push   $0x2115
+     561:	53                   	push   %ebx
+     562:	e8 89 15 00 00       	call   1af0 <struct_field_str>
+    struct_field_str(&w, "path", hello_path);
+     567:	83 c4 0c             	add    $0xc,%esp
+     56a:	68 20 2d 00 00       	push   $0x2d20
+     56f:	68 39 21 00 00       	push   $0x2139
+     574:	53                   	push   %ebx
+     575:	e8 76 15 00 00       	call   1af0 <struct_field_str>
+    struct_end(&w);
+     57a:	89 1c 24             	mov    %ebx,(%esp)
+     57d:	e8 2e 18 00 00       	call   1db0 <struct_end>
+}
+     582:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     585:	83 c4 10             	add    $0x10,%esp
+     588:	c9                   	leave
+     589:	c3                   	ret
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "PATH=%s\n", hello_path);
+     590:	83 ec 04             	sub    $0x4,%esp
+     593:	68 20 2d 00 00       	push   $0x2d20
+     598:	68 3e 21 00 00       	push   $0x213e
+     59d:	6a 01                	push   $0x1
+     59f:	e8 bc 10 00 00       	call   1660 <printf>
+}
+     5a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "PATH=%s\n", hello_path);
+     5a7:	83 c4 10             	add    $0x10,%esp
+}
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <try_exec>:
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	89 c7                	mov    %eax,%edi
+     5b6:	56                   	push   %esi
+     5b7:	89 d6                	mov    %edx,%esi
+     5b9:	53                   	push   %ebx
+     5ba:	81 ec 24 01 00 00    	sub    $0x124,%esp
+     5c0:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+  if(strchr(cmd, '/')){
+     5c6:	6a 2f                	push   $0x2f
+     5c8:	50                   	push   %eax
+     5c9:	e8 82 0d 00 00       	call   1350 <strchr>
+     5ce:	83 c4 10             	add    $0x10,%esp
+     5d1:	85 c0                	test   %eax,%eax
+     5d3:	74 14                	je     5e9 <try_exec+0x39>
+    exec(cmd, argv);
+     5d5:	52                   	push   %edx
+     5d6:	52                   	push   %edx
+     5d7:	56                   	push   %esi
+     5d8:	57                   	push   %edi
+     5d9:	e8 0d 0f 00 00       	call   14eb <exec>
+     5de:	83 c4 10             	add    $0x10,%esp
+}
+     5e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5e4:	5b                   	pop    %ebx
+     5e5:	5e                   	pop    %esi
+     5e6:	5f                   	pop    %edi
+     5e7:	5d                   	pop    %ebp
+     5e8:	c3                   	ret
+  int i = 0;
+     5e9:	31 c0                	xor    %eax,%eax
+     5eb:	eb 12                	jmp    5ff <try_exec+0x4f>
+     5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    dst[i] = src[i];
+     5f0:	88 94 05 e8 fe ff ff 	mov    %dl,-0x118(%ebp,%eax,1)
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     5f7:	83 c0 01             	add    $0x1,%eax
+     5fa:	83 f8 7f             	cmp    $0x7f,%eax
+     5fd:	74 0b                	je     60a <try_exec+0x5a>
+     5ff:	0f b6 90 20 2d 00 00 	movzbl 0x2d20(%eax),%edx
+     606:	84 d2                	test   %dl,%dl
+     608:	75 e6                	jne    5f0 <try_exec+0x40>
+  char *segment = pathbuf;
+     60a:	8d 8d e8 fe ff ff    	lea    -0x118(%ebp),%ecx
+  dst[i] = 0;
+     610:	c6 84 05 e8 fe ff ff 	movb   $0x0,-0x118(%ebp,%eax,1)
+     617:	00 
+    while(*end && *end != ':')
+     618:	0f b6 19             	movzbl (%ecx),%ebx
+     61b:	84 db                	test   %bl,%bl
+     61d:	0f 84 9e 00 00 00    	je     6c1 <try_exec+0x111>
+     623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     627:	90                   	nop
+     628:	80 fb 3a             	cmp    $0x3a,%bl
+     62b:	0f 84 90 00 00 00    	je     6c1 <try_exec+0x111>
+     631:	89 ce                	mov    %ecx,%esi
+     633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     637:	90                   	nop
+     638:	0f b6 5e 01          	movzbl 0x1(%esi),%ebx
+      end++;
+     63c:	83 c6 01             	add    $0x1,%esi
+    while(*end && *end != ':')
+     63f:	84 db                	test   %bl,%bl
+     641:	74 05                	je     648 <try_exec+0x98>
+     643:	80 fb 3a             	cmp    $0x3a,%bl
+     646:	75 f0                	jne    638 <try_exec+0x88>
+    *end = 0;
+     648:	c6 06 00             	movb   $0x0,(%esi)
+  if(prefix == 0 || prefix[0] == 0){
+     64b:	80 39 00             	cmpb   $0x0,(%ecx)
+     64e:	74 76                	je     6c6 <try_exec+0x116>
+  int n = strlen(prefix);
+     650:	83 ec 0c             	sub    $0xc,%esp
+     653:	51                   	push   %ecx
+     654:	89 8d e0 fe ff ff    	mov    %ecx,-0x120(%ebp)
+     65a:	e8 a1 0c 00 00       	call   1300 <strlen>
+  if(n >= dstsz)
+     65f:	83 c4 10             	add    $0x10,%esp
+     662:	8b 8d e0 fe ff ff    	mov    -0x120(%ebp),%ecx
+     668:	83 f8 7f             	cmp    $0x7f,%eax
+  int n = strlen(prefix);
+     66b:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+  if(n >= dstsz)
+     671:	0f 8e 89 00 00 00    	jle    700 <try_exec+0x150>
+  memmove(dst, prefix, n);
+     677:	83 ec 04             	sub    $0x4,%esp
+     67a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+     680:	6a 7f                	push   $0x7f
+     682:	51                   	push   %ecx
+     683:	50                   	push   %eax
+     684:	e8 f7 0d 00 00       	call   1480 <memmove>
+  int need_slash = (n > 0 && dst[n-1] != '/');
+     689:	83 c4 10             	add    $0x10,%esp
+  dst[n] = 0;
+     68c:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    exec(full, argv);
+     690:	83 ec 08             	sub    $0x8,%esp
+     693:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+     699:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+     69f:	50                   	push   %eax
+     6a0:	e8 46 0e 00 00       	call   14eb <exec>
+    *end = saved;
+     6a5:	88 1e                	mov    %bl,(%esi)
+    if(*end == 0)
+     6a7:	83 c4 10             	add    $0x10,%esp
+     6aa:	84 db                	test   %bl,%bl
+     6ac:	0f 84 d8 00 00 00    	je     78a <try_exec+0x1da>
+    while(*end && *end != ':')
+     6b2:	0f b6 5e 01          	movzbl 0x1(%esi),%ebx
+    segment = end + 1;
+     6b6:	8d 4e 01             	lea    0x1(%esi),%ecx
+    while(*end && *end != ':')
+     6b9:	84 db                	test   %bl,%bl
+     6bb:	0f 85 67 ff ff ff    	jne    628 <try_exec+0x78>
+    *end = 0;
+     6c1:	c6 01 00             	movb   $0x0,(%ecx)
+     6c4:	89 ce                	mov    %ecx,%esi
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     6c6:	31 c0                	xor    %eax,%eax
+     6c8:	31 d2                	xor    %edx,%edx
+     6ca:	85 ff                	test   %edi,%edi
+     6cc:	75 15                	jne    6e3 <try_exec+0x133>
+     6ce:	eb 1d                	jmp    6ed <try_exec+0x13d>
+    dst[i] = src[i];
+     6d0:	88 8c 05 68 ff ff ff 	mov    %cl,-0x98(%ebp,%eax,1)
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     6d7:	8d 42 01             	lea    0x1(%edx),%eax
+     6da:	83 fa 7e             	cmp    $0x7e,%edx
+     6dd:	0f 84 95 00 00 00    	je     778 <try_exec+0x1c8>
+     6e3:	0f b6 0c 07          	movzbl (%edi,%eax,1),%ecx
+     6e7:	89 c2                	mov    %eax,%edx
+     6e9:	84 c9                	test   %cl,%cl
+     6eb:	75 e3                	jne    6d0 <try_exec+0x120>
+  dst[i] = 0;
+     6ed:	c6 84 15 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%edx,1)
+     6f4:	00 
+     6f5:	eb 99                	jmp    690 <try_exec+0xe0>
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+  memmove(dst, prefix, n);
+     700:	83 ec 04             	sub    $0x4,%esp
+     703:	50                   	push   %eax
+     704:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+     70a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+     710:	51                   	push   %ecx
+     711:	50                   	push   %eax
+     712:	e8 69 0d 00 00       	call   1480 <memmove>
+  int need_slash = (n > 0 && dst[n-1] != '/');
+     717:	8b 95 e0 fe ff ff    	mov    -0x120(%ebp),%edx
+     71d:	83 c4 10             	add    $0x10,%esp
+     720:	85 d2                	test   %edx,%edx
+     722:	7f 7c                	jg     7a0 <try_exec+0x1f0>
+  dst[n] = 0;
+     724:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+     72a:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+     72d:	c6 01 00             	movb   $0x0,(%ecx)
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     730:	b8 7f 00 00 00       	mov    $0x7f,%eax
+     735:	29 d0                	sub    %edx,%eax
+     737:	89 c2                	mov    %eax,%edx
+  int i = 0;
+     739:	31 c0                	xor    %eax,%eax
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     73b:	85 ff                	test   %edi,%edi
+     73d:	74 29                	je     768 <try_exec+0x1b8>
+     73f:	89 b5 e0 fe ff ff    	mov    %esi,-0x120(%ebp)
+     745:	89 d6                	mov    %edx,%esi
+     747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74e:	66 90                	xchg   %ax,%ax
+     750:	0f b6 14 07          	movzbl (%edi,%eax,1),%edx
+     754:	84 d2                	test   %dl,%dl
+     756:	74 0a                	je     762 <try_exec+0x1b2>
+    dst[i] = src[i];
+     758:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  for(; i < dstsz - 1 && src && src[i]; i++)
+     75b:	83 c0 01             	add    $0x1,%eax
+     75e:	39 f0                	cmp    %esi,%eax
+     760:	75 ee                	jne    750 <try_exec+0x1a0>
+     762:	8b b5 e0 fe ff ff    	mov    -0x120(%ebp),%esi
+  dst[i] = 0;
+     768:	c6 04 01 00          	movb   $0x0,(%ecx,%eax,1)
+     76c:	e9 1f ff ff ff       	jmp    690 <try_exec+0xe0>
+     771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     778:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     77d:	c6 84 15 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%edx,1)
+     784:	00 
+     785:	e9 06 ff ff ff       	jmp    690 <try_exec+0xe0>
+  exec(cmd, argv);
+     78a:	50                   	push   %eax
+     78b:	50                   	push   %eax
+     78c:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+     792:	57                   	push   %edi
+     793:	e8 53 0d 00 00       	call   14eb <exec>
+     798:	83 c4 10             	add    $0x10,%esp
+     79b:	e9 41 fe ff ff       	jmp    5e1 <try_exec+0x31>
+  int need_slash = (n > 0 && dst[n-1] != '/');
+     7a0:	80 bc 15 67 ff ff ff 	cmpb   $0x2f,-0x99(%ebp,%edx,1)
+     7a7:	2f 
+     7a8:	74 1a                	je     7c4 <try_exec+0x214>
+  if(need_slash && n < dstsz - 1)
+     7aa:	83 fa 7f             	cmp    $0x7f,%edx
+     7ad:	0f 84 d9 fe ff ff    	je     68c <try_exec+0xdc>
+    dst[n++] = '/';
+     7b3:	8b 85 dc fe ff ff    	mov    -0x124(%ebp),%eax
+     7b9:	83 c2 01             	add    $0x1,%edx
+     7bc:	c6 84 05 68 ff ff ff 	movb   $0x2f,-0x98(%ebp,%eax,1)
+     7c3:	2f 
+  dst[n] = 0;
+     7c4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+     7ca:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+     7cd:	c6 01 00             	movb   $0x0,(%ecx)
+  if(n < dstsz - 1)
+     7d0:	83 fa 7f             	cmp    $0x7f,%edx
+     7d3:	0f 84 b7 fe ff ff    	je     690 <try_exec+0xe0>
+     7d9:	e9 52 ff ff ff       	jmp    730 <try_exec+0x180>
+     7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <getcmd>:
+{
+     7e0:	55                   	push   %ebp
+     7e1:	89 e5                	mov    %esp,%ebp
+     7e3:	56                   	push   %esi
+     7e4:	53                   	push   %ebx
+     7e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  hello_show_prompt();
+     7eb:	e8 10 fc ff ff       	call   400 <hello_show_prompt>
+  memset(buf, 0, nbuf);
+     7f0:	83 ec 04             	sub    $0x4,%esp
+     7f3:	56                   	push   %esi
+     7f4:	6a 00                	push   $0x0
+     7f6:	53                   	push   %ebx
+     7f7:	e8 34 0b 00 00       	call   1330 <memset>
+  gets(buf, nbuf);
+     7fc:	58                   	pop    %eax
+     7fd:	5a                   	pop    %edx
+     7fe:	56                   	push   %esi
+     7ff:	53                   	push   %ebx
+     800:	e8 8b 0b 00 00       	call   1390 <gets>
+  if(buf[0] == 0) // EOF
+     805:	83 c4 10             	add    $0x10,%esp
+     808:	80 3b 01             	cmpb   $0x1,(%ebx)
+     80b:	19 c0                	sbb    %eax,%eax
+}
+     80d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     810:	5b                   	pop    %ebx
+     811:	5e                   	pop    %esi
+     812:	5d                   	pop    %ebp
+     813:	c3                   	ret
+     814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     81f:	90                   	nop
+
+00000820 <panic>:
+{
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     826:	ff 75 08             	push   0x8(%ebp)
+     829:	68 e8 21 00 00       	push   $0x21e8
+     82e:	6a 02                	push   $0x2
+     830:	e8 2b 0e 00 00       	call   1660 <printf>
+  exit();
+     835:	e8 79 0c 00 00       	call   14b3 <exit>
+     83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000840 <fork1>:
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     846:	e8 60 0c 00 00       	call   14ab <fork>
+  if(pid == -1)
+     84b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     84e:	74 02                	je     852 <fork1+0x12>
+}
+     850:	c9                   	leave
+     851:	c3                   	ret
+    panic("fork");
+     852:	83 ec 0c             	sub    $0xc,%esp
+     855:	68 47 21 00 00       	push   $0x2147
+     85a:	e8 c1 ff ff ff       	call   820 <panic>
+     85f:	90                   	nop
+
+00000860 <runcmd>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+     864:	83 ec 14             	sub    $0x14,%esp
+     867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     86a:	85 db                	test   %ebx,%ebx
+     86c:	74 3a                	je     8a8 <runcmd+0x48>
+  switch(cmd->type){
+     86e:	83 3b 05             	cmpl   $0x5,(%ebx)
+     871:	0f 87 db 00 00 00    	ja     952 <runcmd+0xf2>
+     877:	8b 03                	mov    (%ebx),%eax
+     879:	ff 24 85 84 23 00 00 	jmp    *0x2384(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     880:	8b 43 04             	mov    0x4(%ebx),%eax
+     883:	85 c0                	test   %eax,%eax
+     885:	74 21                	je     8a8 <runcmd+0x48>
+    try_exec(ecmd->argv[0], ecmd->argv);
+     887:	8d 53 04             	lea    0x4(%ebx),%edx
+     88a:	e8 21 fd ff ff       	call   5b0 <try_exec>
+    printf(2, "hello: exec %s failed\n", ecmd->argv[0]);
+     88f:	51                   	push   %ecx
+     890:	ff 73 04             	push   0x4(%ebx)
+     893:	68 53 21 00 00       	push   $0x2153
+     898:	6a 02                	push   $0x2
+     89a:	e8 c1 0d 00 00       	call   1660 <printf>
+    break;
+     89f:	83 c4 10             	add    $0x10,%esp
+     8a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     8a8:	e8 06 0c 00 00       	call   14b3 <exit>
+    if(fork1() == 0)
+     8ad:	e8 8e ff ff ff       	call   840 <fork1>
+     8b2:	85 c0                	test   %eax,%eax
+     8b4:	75 f2                	jne    8a8 <runcmd+0x48>
+     8b6:	e9 8c 00 00 00       	jmp    947 <runcmd+0xe7>
+    if(pipe(p) < 0)
+     8bb:	83 ec 0c             	sub    $0xc,%esp
+     8be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     8c1:	50                   	push   %eax
+     8c2:	e8 fc 0b 00 00       	call   14c3 <pipe>
+     8c7:	83 c4 10             	add    $0x10,%esp
+     8ca:	85 c0                	test   %eax,%eax
+     8cc:	0f 88 a2 00 00 00    	js     974 <runcmd+0x114>
+    if(fork1() == 0){
+     8d2:	e8 69 ff ff ff       	call   840 <fork1>
+     8d7:	85 c0                	test   %eax,%eax
+     8d9:	0f 84 a2 00 00 00    	je     981 <runcmd+0x121>
+    if(fork1() == 0){
+     8df:	e8 5c ff ff ff       	call   840 <fork1>
+     8e4:	85 c0                	test   %eax,%eax
+     8e6:	0f 84 c3 00 00 00    	je     9af <runcmd+0x14f>
+    close(p[0]);
+     8ec:	83 ec 0c             	sub    $0xc,%esp
+     8ef:	ff 75 f0             	push   -0x10(%ebp)
+     8f2:	e8 e4 0b 00 00       	call   14db <close>
+    close(p[1]);
+     8f7:	58                   	pop    %eax
+     8f8:	ff 75 f4             	push   -0xc(%ebp)
+     8fb:	e8 db 0b 00 00       	call   14db <close>
+    wait();
+     900:	e8 b6 0b 00 00       	call   14bb <wait>
+    wait();
+     905:	e8 b1 0b 00 00       	call   14bb <wait>
+    break;
+     90a:	83 c4 10             	add    $0x10,%esp
+     90d:	eb 99                	jmp    8a8 <runcmd+0x48>
+    if(fork1() == 0)
+     90f:	e8 2c ff ff ff       	call   840 <fork1>
+     914:	85 c0                	test   %eax,%eax
+     916:	74 2f                	je     947 <runcmd+0xe7>
+    wait();
+     918:	e8 9e 0b 00 00       	call   14bb <wait>
+    runcmd(lcmd->right);
+     91d:	83 ec 0c             	sub    $0xc,%esp
+     920:	ff 73 08             	push   0x8(%ebx)
+     923:	e8 38 ff ff ff       	call   860 <runcmd>
+    close(rcmd->fd);
+     928:	83 ec 0c             	sub    $0xc,%esp
+     92b:	ff 73 14             	push   0x14(%ebx)
+     92e:	e8 a8 0b 00 00       	call   14db <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     933:	58                   	pop    %eax
+     934:	5a                   	pop    %edx
+     935:	ff 73 10             	push   0x10(%ebx)
+     938:	ff 73 08             	push   0x8(%ebx)
+     93b:	e8 b3 0b 00 00       	call   14f3 <open>
+     940:	83 c4 10             	add    $0x10,%esp
+     943:	85 c0                	test   %eax,%eax
+     945:	78 18                	js     95f <runcmd+0xff>
+      runcmd(bcmd->cmd);
+     947:	83 ec 0c             	sub    $0xc,%esp
+     94a:	ff 73 04             	push   0x4(%ebx)
+     94d:	e8 0e ff ff ff       	call   860 <runcmd>
+    panic("runcmd");
+     952:	83 ec 0c             	sub    $0xc,%esp
+     955:	68 4c 21 00 00       	push   $0x214c
+     95a:	e8 c1 fe ff ff       	call   820 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     95f:	51                   	push   %ecx
+     960:	ff 73 08             	push   0x8(%ebx)
+     963:	68 6a 21 00 00       	push   $0x216a
+     968:	6a 02                	push   $0x2
+     96a:	e8 f1 0c 00 00       	call   1660 <printf>
+      exit();
+     96f:	e8 3f 0b 00 00       	call   14b3 <exit>
+      panic("pipe");
+     974:	83 ec 0c             	sub    $0xc,%esp
+     977:	68 7a 21 00 00       	push   $0x217a
+     97c:	e8 9f fe ff ff       	call   820 <panic>
+      close(1);
+     981:	83 ec 0c             	sub    $0xc,%esp
+     984:	6a 01                	push   $0x1
+     986:	e8 50 0b 00 00       	call   14db <close>
+      dup(p[1]);
+     98b:	58                   	pop    %eax
+     98c:	ff 75 f4             	push   -0xc(%ebp)
+     98f:	e8 97 0b 00 00       	call   152b <dup>
+      close(p[0]);
+     994:	58                   	pop    %eax
+     995:	ff 75 f0             	push   -0x10(%ebp)
+     998:	e8 3e 0b 00 00       	call   14db <close>
+      close(p[1]);
+     99d:	58                   	pop    %eax
+     99e:	ff 75 f4             	push   -0xc(%ebp)
+     9a1:	e8 35 0b 00 00       	call   14db <close>
+      runcmd(pcmd->left);
+     9a6:	5a                   	pop    %edx
+     9a7:	ff 73 04             	push   0x4(%ebx)
+     9aa:	e8 b1 fe ff ff       	call   860 <runcmd>
+      close(0);
+     9af:	83 ec 0c             	sub    $0xc,%esp
+     9b2:	6a 00                	push   $0x0
+     9b4:	e8 22 0b 00 00       	call   14db <close>
+      dup(p[0]);
+     9b9:	5a                   	pop    %edx
+     9ba:	ff 75 f0             	push   -0x10(%ebp)
+     9bd:	e8 69 0b 00 00       	call   152b <dup>
+      close(p[0]);
+     9c2:	59                   	pop    %ecx
+     9c3:	ff 75 f0             	push   -0x10(%ebp)
+     9c6:	e8 10 0b 00 00       	call   14db <close>
+      close(p[1]);
+     9cb:	58                   	pop    %eax
+     9cc:	ff 75 f4             	push   -0xc(%ebp)
+     9cf:	e8 07 0b 00 00       	call   14db <close>
+      runcmd(pcmd->right);
+     9d4:	58                   	pop    %eax
+     9d5:	ff 73 08             	push   0x8(%ebx)
+     9d8:	e8 83 fe ff ff       	call   860 <runcmd>
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <execcmd>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	53                   	push   %ebx
+     9e4:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     9e7:	6a 54                	push   $0x54
+     9e9:	e8 b2 0e 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9ee:	83 c4 0c             	add    $0xc,%esp
+     9f1:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     9f3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     9f5:	6a 00                	push   $0x0
+     9f7:	50                   	push   %eax
+     9f8:	e8 33 09 00 00       	call   1330 <memset>
+  cmd->type = EXEC;
+     9fd:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+}
+     a03:	89 d8                	mov    %ebx,%eax
+     a05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a08:	c9                   	leave
+     a09:	c3                   	ret
+     a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a10 <redircmd>:
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	53                   	push   %ebx
+     a14:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     a17:	6a 18                	push   $0x18
+     a19:	e8 82 0e 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a1e:	83 c4 0c             	add    $0xc,%esp
+     a21:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     a23:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     a25:	6a 00                	push   $0x0
+     a27:	50                   	push   %eax
+     a28:	e8 03 09 00 00       	call   1330 <memset>
+  cmd->cmd = subcmd;
+     a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     a30:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     a36:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a3c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     a3f:	8b 45 10             	mov    0x10(%ebp),%eax
+     a42:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     a45:	8b 45 14             	mov    0x14(%ebp),%eax
+     a48:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     a4b:	8b 45 18             	mov    0x18(%ebp),%eax
+     a4e:	89 43 14             	mov    %eax,0x14(%ebx)
+}
+     a51:	89 d8                	mov    %ebx,%eax
+     a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a56:	c9                   	leave
+     a57:	c3                   	ret
+     a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+
+00000a60 <pipecmd>:
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	53                   	push   %ebx
+     a64:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     a67:	6a 0c                	push   $0xc
+     a69:	e8 32 0e 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a6e:	83 c4 0c             	add    $0xc,%esp
+     a71:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a73:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     a75:	6a 00                	push   $0x0
+     a77:	50                   	push   %eax
+     a78:	e8 b3 08 00 00       	call   1330 <memset>
+  cmd->left = left;
+     a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     a80:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     a86:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     a89:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a8c:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+     a8f:	89 d8                	mov    %ebx,%eax
+     a91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a94:	c9                   	leave
+     a95:	c3                   	ret
+     a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000aa0 <listcmd>:
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	53                   	push   %ebx
+     aa4:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     aa7:	6a 0c                	push   $0xc
+     aa9:	e8 f2 0d 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     aae:	83 c4 0c             	add    $0xc,%esp
+     ab1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     ab3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     ab5:	6a 00                	push   $0x0
+     ab7:	50                   	push   %eax
+     ab8:	e8 73 08 00 00       	call   1330 <memset>
+  cmd->left = left;
+     abd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     ac0:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     ac6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     ac9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     acc:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+     acf:	89 d8                	mov    %ebx,%eax
+     ad1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ad4:	c9                   	leave
+     ad5:	c3                   	ret
+     ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ae0 <backcmd>:
+{
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	53                   	push   %ebx
+     ae4:	83 ec 10             	sub    $0x10,%esp
+  cmd = malloc(sizeof(*cmd));
+     ae7:	6a 08                	push   $0x8
+     ae9:	e8 b2 0d 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     aee:	83 c4 0c             	add    $0xc,%esp
+     af1:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     af3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     af5:	6a 00                	push   $0x0
+     af7:	50                   	push   %eax
+     af8:	e8 33 08 00 00       	call   1330 <memset>
+  cmd->cmd = subcmd;
+     afd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     b00:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     b06:	89 43 04             	mov    %eax,0x4(%ebx)
+}
+     b09:	89 d8                	mov    %ebx,%eax
+     b0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b0e:	c9                   	leave
+     b0f:	c3                   	ret
+
+00000b10 <gettoken>:
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	57                   	push   %edi
+     b14:	56                   	push   %esi
+     b15:	53                   	push   %ebx
+     b16:	83 ec 0c             	sub    $0xc,%esp
+  s = *ps;
+     b19:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     b1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     b1f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     b22:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     b24:	39 df                	cmp    %ebx,%edi
+     b26:	72 0f                	jb     b37 <gettoken+0x27>
+     b28:	eb 25                	jmp    b4f <gettoken+0x3f>
+     b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     b30:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     b33:	39 fb                	cmp    %edi,%ebx
+     b35:	74 18                	je     b4f <gettoken+0x3f>
+     b37:	0f be 07             	movsbl (%edi),%eax
+     b3a:	83 ec 08             	sub    $0x8,%esp
+     b3d:	50                   	push   %eax
+     b3e:	68 08 2d 00 00       	push   $0x2d08
+     b43:	e8 08 08 00 00       	call   1350 <strchr>
+     b48:	83 c4 10             	add    $0x10,%esp
+     b4b:	85 c0                	test   %eax,%eax
+     b4d:	75 e1                	jne    b30 <gettoken+0x20>
+  if(q)
+     b4f:	85 f6                	test   %esi,%esi
+     b51:	74 02                	je     b55 <gettoken+0x45>
+    *q = s;
+     b53:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     b55:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     b58:	3c 3c                	cmp    $0x3c,%al
+     b5a:	0f 8f d0 00 00 00    	jg     c30 <gettoken+0x120>
+     b60:	3c 3a                	cmp    $0x3a,%al
+     b62:	0f 8f bc 00 00 00    	jg     c24 <gettoken+0x114>
+     b68:	84 c0                	test   %al,%al
+     b6a:	75 44                	jne    bb0 <gettoken+0xa0>
+     b6c:	31 f6                	xor    %esi,%esi
+  if(eq)
+     b6e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     b71:	85 c9                	test   %ecx,%ecx
+     b73:	74 05                	je     b7a <gettoken+0x6a>
+    *eq = s;
+     b75:	8b 45 14             	mov    0x14(%ebp),%eax
+     b78:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     b7a:	39 df                	cmp    %ebx,%edi
+     b7c:	72 09                	jb     b87 <gettoken+0x77>
+     b7e:	eb 1f                	jmp    b9f <gettoken+0x8f>
+    s++;
+     b80:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     b83:	39 fb                	cmp    %edi,%ebx
+     b85:	74 18                	je     b9f <gettoken+0x8f>
+     b87:	0f be 07             	movsbl (%edi),%eax
+     b8a:	83 ec 08             	sub    $0x8,%esp
+     b8d:	50                   	push   %eax
+     b8e:	68 08 2d 00 00       	push   $0x2d08
+     b93:	e8 b8 07 00 00       	call   1350 <strchr>
+     b98:	83 c4 10             	add    $0x10,%esp
+     b9b:	85 c0                	test   %eax,%eax
+     b9d:	75 e1                	jne    b80 <gettoken+0x70>
+  *ps = s;
+     b9f:	8b 45 08             	mov    0x8(%ebp),%eax
+     ba2:	89 38                	mov    %edi,(%eax)
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	89 f0                	mov    %esi,%eax
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	5f                   	pop    %edi
+     bac:	5d                   	pop    %ebp
+     bad:	c3                   	ret
+     bae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     bb0:	79 66                	jns    c18 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     bb2:	39 df                	cmp    %ebx,%edi
+     bb4:	72 39                	jb     bef <gettoken+0xdf>
+  if(eq)
+     bb6:	8b 55 14             	mov    0x14(%ebp),%edx
+     bb9:	85 d2                	test   %edx,%edx
+     bbb:	0f 84 b3 00 00 00    	je     c74 <gettoken+0x164>
+    *eq = s;
+     bc1:	8b 45 14             	mov    0x14(%ebp),%eax
+     bc4:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     bc6:	e9 a9 00 00 00       	jmp    c74 <gettoken+0x164>
+     bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bcf:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     bd0:	0f be 07             	movsbl (%edi),%eax
+     bd3:	83 ec 08             	sub    $0x8,%esp
+     bd6:	50                   	push   %eax
+     bd7:	68 00 2d 00 00       	push   $0x2d00
+     bdc:	e8 6f 07 00 00       	call   1350 <strchr>
+     be1:	83 c4 10             	add    $0x10,%esp
+     be4:	85 c0                	test   %eax,%eax
+     be6:	75 1f                	jne    c07 <gettoken+0xf7>
+      s++;
+     be8:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     beb:	39 fb                	cmp    %edi,%ebx
+     bed:	74 77                	je     c66 <gettoken+0x156>
+     bef:	0f be 07             	movsbl (%edi),%eax
+     bf2:	83 ec 08             	sub    $0x8,%esp
+     bf5:	50                   	push   %eax
+     bf6:	68 08 2d 00 00       	push   $0x2d08
+     bfb:	e8 50 07 00 00       	call   1350 <strchr>
+     c00:	83 c4 10             	add    $0x10,%esp
+     c03:	85 c0                	test   %eax,%eax
+     c05:	74 c9                	je     bd0 <gettoken+0xc0>
+    ret = 'a';
+     c07:	be 61 00 00 00       	mov    $0x61,%esi
+     c0c:	e9 5d ff ff ff       	jmp    b6e <gettoken+0x5e>
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     c18:	3c 26                	cmp    $0x26,%al
+     c1a:	74 08                	je     c24 <gettoken+0x114>
+     c1c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     c1f:	80 f9 01             	cmp    $0x1,%cl
+     c22:	77 8e                	ja     bb2 <gettoken+0xa2>
+  ret = *s;
+     c24:	0f be f0             	movsbl %al,%esi
+    s++;
+     c27:	83 c7 01             	add    $0x1,%edi
+    break;
+     c2a:	e9 3f ff ff ff       	jmp    b6e <gettoken+0x5e>
+     c2f:	90                   	nop
+  switch(*s){
+     c30:	3c 3e                	cmp    $0x3e,%al
+     c32:	75 1c                	jne    c50 <gettoken+0x140>
+    if(*s == '>'){
+     c34:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     c38:	74 1f                	je     c59 <gettoken+0x149>
+    s++;
+     c3a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     c3d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     c42:	e9 27 ff ff ff       	jmp    b6e <gettoken+0x5e>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     c50:	3c 7c                	cmp    $0x7c,%al
+     c52:	74 d0                	je     c24 <gettoken+0x114>
+     c54:	e9 59 ff ff ff       	jmp    bb2 <gettoken+0xa2>
+      s++;
+     c59:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     c5c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     c61:	e9 08 ff ff ff       	jmp    b6e <gettoken+0x5e>
+  if(eq)
+     c66:	8b 45 14             	mov    0x14(%ebp),%eax
+     c69:	85 c0                	test   %eax,%eax
+     c6b:	74 05                	je     c72 <gettoken+0x162>
+    *eq = s;
+     c6d:	8b 45 14             	mov    0x14(%ebp),%eax
+     c70:	89 18                	mov    %ebx,(%eax)
+      s++;
+     c72:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     c74:	be 61 00 00 00       	mov    $0x61,%esi
+     c79:	e9 21 ff ff ff       	jmp    b9f <gettoken+0x8f>
+     c7e:	66 90                	xchg   %ax,%ax
+
+00000c80 <peek>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	57                   	push   %edi
+     c84:	56                   	push   %esi
+     c85:	53                   	push   %ebx
+     c86:	83 ec 0c             	sub    $0xc,%esp
+     c89:	8b 7d 08             	mov    0x8(%ebp),%edi
+     c8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  s = *ps;
+     c8f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     c91:	39 f3                	cmp    %esi,%ebx
+     c93:	72 12                	jb     ca7 <peek+0x27>
+     c95:	eb 28                	jmp    cbf <peek+0x3f>
+     c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c9e:	66 90                	xchg   %ax,%ax
+    s++;
+     ca0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     ca3:	39 de                	cmp    %ebx,%esi
+     ca5:	74 18                	je     cbf <peek+0x3f>
+     ca7:	0f be 03             	movsbl (%ebx),%eax
+     caa:	83 ec 08             	sub    $0x8,%esp
+     cad:	50                   	push   %eax
+     cae:	68 08 2d 00 00       	push   $0x2d08
+     cb3:	e8 98 06 00 00       	call   1350 <strchr>
+     cb8:	83 c4 10             	add    $0x10,%esp
+     cbb:	85 c0                	test   %eax,%eax
+     cbd:	75 e1                	jne    ca0 <peek+0x20>
+  *ps = s;
+     cbf:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     cc1:	0f be 03             	movsbl (%ebx),%eax
+     cc4:	31 d2                	xor    %edx,%edx
+     cc6:	84 c0                	test   %al,%al
+     cc8:	75 0e                	jne    cd8 <peek+0x58>
+}
+     cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ccd:	89 d0                	mov    %edx,%eax
+     ccf:	5b                   	pop    %ebx
+     cd0:	5e                   	pop    %esi
+     cd1:	5f                   	pop    %edi
+     cd2:	5d                   	pop    %ebp
+     cd3:	c3                   	ret
+     cd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     cd8:	83 ec 08             	sub    $0x8,%esp
+     cdb:	50                   	push   %eax
+     cdc:	ff 75 10             	push   0x10(%ebp)
+     cdf:	e8 6c 06 00 00       	call   1350 <strchr>
+     ce4:	83 c4 10             	add    $0x10,%esp
+     ce7:	31 d2                	xor    %edx,%edx
+     ce9:	85 c0                	test   %eax,%eax
+     ceb:	0f 95 c2             	setne  %dl
+}
+     cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf1:	5b                   	pop    %ebx
+     cf2:	89 d0                	mov    %edx,%eax
+     cf4:	5e                   	pop    %esi
+     cf5:	5f                   	pop    %edi
+     cf6:	5d                   	pop    %ebp
+     cf7:	c3                   	ret
+     cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cff:	90                   	nop
+
+00000d00 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+     d05:	53                   	push   %ebx
+     d06:	83 ec 2c             	sub    $0x2c,%esp
+     d09:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     d0f:	90                   	nop
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	68 9c 21 00 00       	push   $0x219c
+     d18:	53                   	push   %ebx
+     d19:	56                   	push   %esi
+     d1a:	e8 61 ff ff ff       	call   c80 <peek>
+     d1f:	83 c4 10             	add    $0x10,%esp
+     d22:	85 c0                	test   %eax,%eax
+     d24:	0f 84 f6 00 00 00    	je     e20 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     d2a:	6a 00                	push   $0x0
+     d2c:	6a 00                	push   $0x0
+     d2e:	53                   	push   %ebx
+     d2f:	56                   	push   %esi
+     d30:	e8 db fd ff ff       	call   b10 <gettoken>
+     d35:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     d37:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     d3a:	50                   	push   %eax
+     d3b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d3e:	50                   	push   %eax
+     d3f:	53                   	push   %ebx
+     d40:	56                   	push   %esi
+     d41:	e8 ca fd ff ff       	call   b10 <gettoken>
+     d46:	83 c4 20             	add    $0x20,%esp
+     d49:	83 f8 61             	cmp    $0x61,%eax
+     d4c:	0f 85 d9 00 00 00    	jne    e2b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     d52:	83 ff 3c             	cmp    $0x3c,%edi
+     d55:	74 69                	je     dc0 <parseredirs+0xc0>
+     d57:	83 ff 3e             	cmp    $0x3e,%edi
+     d5a:	74 05                	je     d61 <parseredirs+0x61>
+     d5c:	83 ff 2b             	cmp    $0x2b,%edi
+     d5f:	75 af                	jne    d10 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     d61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d64:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     d67:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     d6a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     d6d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     d70:	6a 18                	push   $0x18
+     d72:	e8 29 0b 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d77:	83 c4 0c             	add    $0xc,%esp
+     d7a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     d7c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     d7e:	6a 00                	push   $0x0
+     d80:	50                   	push   %eax
+     d81:	e8 aa 05 00 00       	call   1330 <memset>
+  cmd->type = REDIR;
+     d86:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     d8f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     d92:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     d95:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     d98:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     d9b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     d9e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     da5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     da8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     daf:	89 7d 08             	mov    %edi,0x8(%ebp)
+     db2:	e9 59 ff ff ff       	jmp    d10 <parseredirs+0x10>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     dc0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     dc3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     dc6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     dc9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     dcc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     dcf:	6a 18                	push   $0x18
+     dd1:	e8 ca 0a 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     dd6:	83 c4 0c             	add    $0xc,%esp
+     dd9:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     ddb:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     ddd:	6a 00                	push   $0x0
+     ddf:	50                   	push   %eax
+     de0:	e8 4b 05 00 00       	call   1330 <memset>
+  cmd->cmd = subcmd;
+     de5:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     de8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     deb:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     dee:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     df1:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     df7:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     dfa:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     dfd:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     e00:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     e03:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     e0a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     e11:	e9 fa fe ff ff       	jmp    d10 <parseredirs+0x10>
+     e16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e1d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     e20:	8b 45 08             	mov    0x8(%ebp),%eax
+     e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e26:	5b                   	pop    %ebx
+     e27:	5e                   	pop    %esi
+     e28:	5f                   	pop    %edi
+     e29:	5d                   	pop    %ebp
+     e2a:	c3                   	ret
+      panic("missing file for redirection");
+     e2b:	83 ec 0c             	sub    $0xc,%esp
+     e2e:	68 7f 21 00 00       	push   $0x217f
+     e33:	e8 e8 f9 ff ff       	call   820 <panic>
+     e38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+
+00000e40 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	57                   	push   %edi
+     e44:	56                   	push   %esi
+     e45:	53                   	push   %ebx
+     e46:	83 ec 30             	sub    $0x30,%esp
+     e49:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     e4f:	68 9f 21 00 00       	push   $0x219f
+     e54:	56                   	push   %esi
+     e55:	53                   	push   %ebx
+     e56:	e8 25 fe ff ff       	call   c80 <peek>
+     e5b:	83 c4 10             	add    $0x10,%esp
+     e5e:	85 c0                	test   %eax,%eax
+     e60:	0f 85 aa 00 00 00    	jne    f10 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     e66:	83 ec 0c             	sub    $0xc,%esp
+     e69:	89 c7                	mov    %eax,%edi
+     e6b:	6a 54                	push   $0x54
+     e6d:	e8 2e 0a 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     e72:	83 c4 0c             	add    $0xc,%esp
+     e75:	6a 54                	push   $0x54
+     e77:	6a 00                	push   $0x0
+     e79:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     e7c:	50                   	push   %eax
+     e7d:	e8 ae 04 00 00       	call   1330 <memset>
+  cmd->type = EXEC;
+     e82:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     e85:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     e88:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     e8e:	56                   	push   %esi
+     e8f:	53                   	push   %ebx
+     e90:	50                   	push   %eax
+     e91:	e8 6a fe ff ff       	call   d00 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     e96:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     e99:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     e9c:	eb 15                	jmp    eb3 <parseexec+0x73>
+     e9e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     ea0:	83 ec 04             	sub    $0x4,%esp
+     ea3:	56                   	push   %esi
+     ea4:	53                   	push   %ebx
+     ea5:	ff 75 d4             	push   -0x2c(%ebp)
+     ea8:	e8 53 fe ff ff       	call   d00 <parseredirs>
+     ead:	83 c4 10             	add    $0x10,%esp
+     eb0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     eb3:	83 ec 04             	sub    $0x4,%esp
+     eb6:	68 b6 21 00 00       	push   $0x21b6
+     ebb:	56                   	push   %esi
+     ebc:	53                   	push   %ebx
+     ebd:	e8 be fd ff ff       	call   c80 <peek>
+     ec2:	83 c4 10             	add    $0x10,%esp
+     ec5:	85 c0                	test   %eax,%eax
+     ec7:	75 5f                	jne    f28 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     ec9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ecc:	50                   	push   %eax
+     ecd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     ed0:	50                   	push   %eax
+     ed1:	56                   	push   %esi
+     ed2:	53                   	push   %ebx
+     ed3:	e8 38 fc ff ff       	call   b10 <gettoken>
+     ed8:	83 c4 10             	add    $0x10,%esp
+     edb:	85 c0                	test   %eax,%eax
+     edd:	74 49                	je     f28 <parseexec+0xe8>
+    if(tok != 'a')
+     edf:	83 f8 61             	cmp    $0x61,%eax
+     ee2:	75 62                	jne    f46 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     ee4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ee7:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     eea:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     eee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ef1:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     ef5:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     ef8:	83 ff 0a             	cmp    $0xa,%edi
+     efb:	75 a3                	jne    ea0 <parseexec+0x60>
+      panic("too many args");
+     efd:	83 ec 0c             	sub    $0xc,%esp
+     f00:	68 a8 21 00 00       	push   $0x21a8
+     f05:	e8 16 f9 ff ff       	call   820 <panic>
+     f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     f10:	89 75 0c             	mov    %esi,0xc(%ebp)
+     f13:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f19:	5b                   	pop    %ebx
+     f1a:	5e                   	pop    %esi
+     f1b:	5f                   	pop    %edi
+     f1c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     f1d:	e9 ae 01 00 00       	jmp    10d0 <parseblock>
+     f22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     f28:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f2b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     f32:	00 
+  cmd->eargv[argc] = 0;
+     f33:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     f3a:	00 
+}
+     f3b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     f3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f41:	5b                   	pop    %ebx
+     f42:	5e                   	pop    %esi
+     f43:	5f                   	pop    %edi
+     f44:	5d                   	pop    %ebp
+     f45:	c3                   	ret
+      panic("syntax");
+     f46:	83 ec 0c             	sub    $0xc,%esp
+     f49:	68 a1 21 00 00       	push   $0x21a1
+     f4e:	e8 cd f8 ff ff       	call   820 <panic>
+     f53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f60 <parsepipe>:
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	57                   	push   %edi
+     f64:	56                   	push   %esi
+     f65:	53                   	push   %ebx
+     f66:	83 ec 14             	sub    $0x14,%esp
+     f69:	8b 75 08             	mov    0x8(%ebp),%esi
+     f6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     f6f:	57                   	push   %edi
+     f70:	56                   	push   %esi
+     f71:	e8 ca fe ff ff       	call   e40 <parseexec>
+  if(peek(ps, es, "|")){
+     f76:	83 c4 0c             	add    $0xc,%esp
+     f79:	68 bb 21 00 00       	push   $0x21bb
+  cmd = parseexec(ps, es);
+     f7e:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     f80:	57                   	push   %edi
+     f81:	56                   	push   %esi
+     f82:	e8 f9 fc ff ff       	call   c80 <peek>
+     f87:	83 c4 10             	add    $0x10,%esp
+     f8a:	85 c0                	test   %eax,%eax
+     f8c:	75 12                	jne    fa0 <parsepipe+0x40>
+}
+     f8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f91:	89 d8                	mov    %ebx,%eax
+     f93:	5b                   	pop    %ebx
+     f94:	5e                   	pop    %esi
+     f95:	5f                   	pop    %edi
+     f96:	5d                   	pop    %ebp
+     f97:	c3                   	ret
+     f98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     fa0:	6a 00                	push   $0x0
+     fa2:	6a 00                	push   $0x0
+     fa4:	57                   	push   %edi
+     fa5:	56                   	push   %esi
+     fa6:	e8 65 fb ff ff       	call   b10 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     fab:	58                   	pop    %eax
+     fac:	5a                   	pop    %edx
+     fad:	57                   	push   %edi
+     fae:	56                   	push   %esi
+     faf:	e8 ac ff ff ff       	call   f60 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     fb4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     fbb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     fbd:	e8 de 08 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     fc2:	83 c4 0c             	add    $0xc,%esp
+     fc5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     fc7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     fc9:	6a 00                	push   $0x0
+     fcb:	50                   	push   %eax
+     fcc:	e8 5f 03 00 00       	call   1330 <memset>
+  cmd->left = left;
+     fd1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     fd4:	83 c4 10             	add    $0x10,%esp
+     fd7:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     fd9:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     fdf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     fe1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     fe4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fe7:	5b                   	pop    %ebx
+     fe8:	5e                   	pop    %esi
+     fe9:	5f                   	pop    %edi
+     fea:	5d                   	pop    %ebp
+     feb:	c3                   	ret
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <parseline>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 24             	sub    $0x24,%esp
+     ff9:	8b 75 08             	mov    0x8(%ebp),%esi
+     ffc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     fff:	57                   	push   %edi
+    1000:	56                   	push   %esi
+    1001:	e8 5a ff ff ff       	call   f60 <parsepipe>
+  while(peek(ps, es, "&")){
+    1006:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+    1009:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+    100b:	eb 3b                	jmp    1048 <parseline+0x58>
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+    1010:	6a 00                	push   $0x0
+    1012:	6a 00                	push   $0x0
+    1014:	57                   	push   %edi
+    1015:	56                   	push   %esi
+    1016:	e8 f5 fa ff ff       	call   b10 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+    101b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+    1022:	e8 79 08 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    1027:	83 c4 0c             	add    $0xc,%esp
+    102a:	6a 08                	push   $0x8
+    102c:	6a 00                	push   $0x0
+    102e:	50                   	push   %eax
+    102f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1032:	e8 f9 02 00 00       	call   1330 <memset>
+  cmd->type = BACK;
+    1037:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+    103a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+    103d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+    1043:	89 5a 04             	mov    %ebx,0x4(%edx)
+    1046:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+    1048:	83 ec 04             	sub    $0x4,%esp
+    104b:	68 bd 21 00 00       	push   $0x21bd
+    1050:	57                   	push   %edi
+    1051:	56                   	push   %esi
+    1052:	e8 29 fc ff ff       	call   c80 <peek>
+    1057:	83 c4 10             	add    $0x10,%esp
+    105a:	85 c0                	test   %eax,%eax
+    105c:	75 b2                	jne    1010 <parseline+0x20>
+  if(peek(ps, es, ";")){
+    105e:	83 ec 04             	sub    $0x4,%esp
+    1061:	68 b9 21 00 00       	push   $0x21b9
+    1066:	57                   	push   %edi
+    1067:	56                   	push   %esi
+    1068:	e8 13 fc ff ff       	call   c80 <peek>
+    106d:	83 c4 10             	add    $0x10,%esp
+    1070:	85 c0                	test   %eax,%eax
+    1072:	75 0c                	jne    1080 <parseline+0x90>
+}
+    1074:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1077:	89 d8                	mov    %ebx,%eax
+    1079:	5b                   	pop    %ebx
+    107a:	5e                   	pop    %esi
+    107b:	5f                   	pop    %edi
+    107c:	5d                   	pop    %ebp
+    107d:	c3                   	ret
+    107e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+    1080:	6a 00                	push   $0x0
+    1082:	6a 00                	push   $0x0
+    1084:	57                   	push   %edi
+    1085:	56                   	push   %esi
+    1086:	e8 85 fa ff ff       	call   b10 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+    108b:	58                   	pop    %eax
+    108c:	5a                   	pop    %edx
+    108d:	57                   	push   %edi
+    108e:	56                   	push   %esi
+    108f:	e8 5c ff ff ff       	call   ff0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+    1094:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+    109b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+    109d:	e8 fe 07 00 00       	call   18a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+    10a2:	83 c4 0c             	add    $0xc,%esp
+    10a5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+    10a7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+    10a9:	6a 00                	push   $0x0
+    10ab:	50                   	push   %eax
+    10ac:	e8 7f 02 00 00       	call   1330 <memset>
+  cmd->left = left;
+    10b1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+    10b4:	83 c4 10             	add    $0x10,%esp
+    10b7:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+    10b9:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+    10bf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+    10c1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+    10c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10c7:	5b                   	pop    %ebx
+    10c8:	5e                   	pop    %esi
+    10c9:	5f                   	pop    %edi
+    10ca:	5d                   	pop    %ebp
+    10cb:	c3                   	ret
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000010d0 <parseblock>:
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	57                   	push   %edi
+    10d4:	56                   	push   %esi
+    10d5:	53                   	push   %ebx
+    10d6:	83 ec 10             	sub    $0x10,%esp
+    10d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    10dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+    10df:	68 9f 21 00 00       	push   $0x219f
+    10e4:	56                   	push   %esi
+    10e5:	53                   	push   %ebx
+    10e6:	e8 95 fb ff ff       	call   c80 <peek>
+    10eb:	83 c4 10             	add    $0x10,%esp
+    10ee:	85 c0                	test   %eax,%eax
+    10f0:	74 4a                	je     113c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+    10f2:	6a 00                	push   $0x0
+    10f4:	6a 00                	push   $0x0
+    10f6:	56                   	push   %esi
+    10f7:	53                   	push   %ebx
+    10f8:	e8 13 fa ff ff       	call   b10 <gettoken>
+  cmd = parseline(ps, es);
+    10fd:	58                   	pop    %eax
+    10fe:	5a                   	pop    %edx
+    10ff:	56                   	push   %esi
+    1100:	53                   	push   %ebx
+    1101:	e8 ea fe ff ff       	call   ff0 <parseline>
+  if(!peek(ps, es, ")"))
+    1106:	83 c4 0c             	add    $0xc,%esp
+    1109:	68 db 21 00 00       	push   $0x21db
+  cmd = parseline(ps, es);
+    110e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+    1110:	56                   	push   %esi
+    1111:	53                   	push   %ebx
+    1112:	e8 69 fb ff ff       	call   c80 <peek>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	85 c0                	test   %eax,%eax
+    111c:	74 2b                	je     1149 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+    111e:	6a 00                	push   $0x0
+    1120:	6a 00                	push   $0x0
+    1122:	56                   	push   %esi
+    1123:	53                   	push   %ebx
+    1124:	e8 e7 f9 ff ff       	call   b10 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+    1129:	83 c4 0c             	add    $0xc,%esp
+    112c:	56                   	push   %esi
+    112d:	53                   	push   %ebx
+    112e:	57                   	push   %edi
+    112f:	e8 cc fb ff ff       	call   d00 <parseredirs>
+}
+    1134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1137:	5b                   	pop    %ebx
+    1138:	5e                   	pop    %esi
+    1139:	5f                   	pop    %edi
+    113a:	5d                   	pop    %ebp
+    113b:	c3                   	ret
+    panic("parseblock");
+    113c:	83 ec 0c             	sub    $0xc,%esp
+    113f:	68 bf 21 00 00       	push   $0x21bf
+    1144:	e8 d7 f6 ff ff       	call   820 <panic>
+    panic("syntax - missing )");
+    1149:	83 ec 0c             	sub    $0xc,%esp
+    114c:	68 ca 21 00 00       	push   $0x21ca
+    1151:	e8 ca f6 ff ff       	call   820 <panic>
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001160 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	53                   	push   %ebx
+    1164:	83 ec 04             	sub    $0x4,%esp
+    1167:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    116a:	85 db                	test   %ebx,%ebx
+    116c:	0f 84 7e 00 00 00    	je     11f0 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+    1172:	83 3b 05             	cmpl   $0x5,(%ebx)
+    1175:	77 20                	ja     1197 <nulterminate+0x37>
+    1177:	8b 03                	mov    (%ebx),%eax
+    1179:	ff 24 85 9c 23 00 00 	jmp    *0x239c(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+    1180:	83 ec 0c             	sub    $0xc,%esp
+    1183:	ff 73 04             	push   0x4(%ebx)
+    1186:	e8 d5 ff ff ff       	call   1160 <nulterminate>
+    nulterminate(lcmd->right);
+    118b:	58                   	pop    %eax
+    118c:	ff 73 08             	push   0x8(%ebx)
+    118f:	e8 cc ff ff ff       	call   1160 <nulterminate>
+    break;
+    1194:	83 c4 10             	add    $0x10,%esp
+    return 0;
+    1197:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+    1199:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119c:	c9                   	leave
+    119d:	c3                   	ret
+    119e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+    11a0:	83 ec 0c             	sub    $0xc,%esp
+    11a3:	ff 73 04             	push   0x4(%ebx)
+    11a6:	e8 b5 ff ff ff       	call   1160 <nulterminate>
+    break;
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	eb e7                	jmp    1197 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+    11b0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+    11b3:	8d 43 08             	lea    0x8(%ebx),%eax
+    11b6:	85 c9                	test   %ecx,%ecx
+    11b8:	74 dd                	je     1197 <nulterminate+0x37>
+    11ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+    11c0:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+    11c3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+    11c6:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+    11c9:	8b 50 fc             	mov    -0x4(%eax),%edx
+    11cc:	85 d2                	test   %edx,%edx
+    11ce:	75 f0                	jne    11c0 <nulterminate+0x60>
+    11d0:	eb c5                	jmp    1197 <nulterminate+0x37>
+    11d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+    11d8:	83 ec 0c             	sub    $0xc,%esp
+    11db:	ff 73 04             	push   0x4(%ebx)
+    11de:	e8 7d ff ff ff       	call   1160 <nulterminate>
+    *rcmd->efile = 0;
+    11e3:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+    11e6:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    11e9:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    11ec:	eb a9                	jmp    1197 <nulterminate+0x37>
+    11ee:	66 90                	xchg   %ax,%ax
+    return 0;
+    11f0:	31 c0                	xor    %eax,%eax
+    11f2:	eb a5                	jmp    1199 <nulterminate+0x39>
+    11f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11ff:	90                   	nop
+
+00001200 <parsecmd>:
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	57                   	push   %edi
+    1204:	56                   	push   %esi
+  cmd = parseline(&s, es);
+    1205:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+    1208:	53                   	push   %ebx
+    1209:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+    120c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    120f:	53                   	push   %ebx
+    1210:	e8 eb 00 00 00       	call   1300 <strlen>
+  cmd = parseline(&s, es);
+    1215:	59                   	pop    %ecx
+    1216:	5e                   	pop    %esi
+  es = s + strlen(s);
+    1217:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+    1219:	53                   	push   %ebx
+    121a:	57                   	push   %edi
+    121b:	e8 d0 fd ff ff       	call   ff0 <parseline>
+  peek(&s, es, "");
+    1220:	83 c4 0c             	add    $0xc,%esp
+    1223:	68 38 21 00 00       	push   $0x2138
+  cmd = parseline(&s, es);
+    1228:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+    122a:	53                   	push   %ebx
+    122b:	57                   	push   %edi
+    122c:	e8 4f fa ff ff       	call   c80 <peek>
+  if(s != es){
+    1231:	8b 45 08             	mov    0x8(%ebp),%eax
+    1234:	83 c4 10             	add    $0x10,%esp
+    1237:	39 d8                	cmp    %ebx,%eax
+    1239:	75 13                	jne    124e <parsecmd+0x4e>
+  nulterminate(cmd);
+    123b:	83 ec 0c             	sub    $0xc,%esp
+    123e:	56                   	push   %esi
+    123f:	e8 1c ff ff ff       	call   1160 <nulterminate>
+}
+    1244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1247:	89 f0                	mov    %esi,%eax
+    1249:	5b                   	pop    %ebx
+    124a:	5e                   	pop    %esi
+    124b:	5f                   	pop    %edi
+    124c:	5d                   	pop    %ebp
+    124d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+    124e:	52                   	push   %edx
+    124f:	50                   	push   %eax
+    1250:	68 dd 21 00 00       	push   $0x21dd
+    1255:	6a 02                	push   $0x2
+    1257:	e8 04 04 00 00       	call   1660 <printf>
+    panic("syntax");
+    125c:	c7 04 24 a1 21 00 00 	movl   $0x21a1,(%esp)
+    1263:	e8 b8 f5 ff ff       	call   820 <panic>
+    1268:	66 90                	xchg   %ax,%ax
+    126a:	66 90                	xchg   %ax,%ax
+    126c:	66 90                	xchg   %ax,%ax
+    126e:	66 90                	xchg   %ax,%ax
+
+00001270 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1271:	31 c0                	xor    %eax,%eax
+{
+    1273:	89 e5                	mov    %esp,%ebp
+    1275:	53                   	push   %ebx
+    1276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1287:	83 c0 01             	add    $0x1,%eax
+    128a:	84 d2                	test   %dl,%dl
+    128c:	75 f2                	jne    1280 <strcpy+0x10>
+    ;
+  return os;
+}
+    128e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1291:	89 c8                	mov    %ecx,%eax
+    1293:	c9                   	leave
+    1294:	c3                   	ret
+    1295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000012a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    12a0:	55                   	push   %ebp
+    12a1:	89 e5                	mov    %esp,%ebp
+    12a3:	53                   	push   %ebx
+    12a4:	8b 55 08             	mov    0x8(%ebp),%edx
+    12a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    12aa:	0f b6 02             	movzbl (%edx),%eax
+    12ad:	84 c0                	test   %al,%al
+    12af:	75 17                	jne    12c8 <strcmp+0x28>
+    12b1:	eb 3a                	jmp    12ed <strcmp+0x4d>
+    12b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12b7:	90                   	nop
+    12b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    12bc:	83 c2 01             	add    $0x1,%edx
+    12bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    12c2:	84 c0                	test   %al,%al
+    12c4:	74 1a                	je     12e0 <strcmp+0x40>
+    p++, q++;
+    12c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    12c8:	0f b6 19             	movzbl (%ecx),%ebx
+    12cb:	38 c3                	cmp    %al,%bl
+    12cd:	74 e9                	je     12b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    12cf:	29 d8                	sub    %ebx,%eax
+}
+    12d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12d4:	c9                   	leave
+    12d5:	c3                   	ret
+    12d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    12e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    12e4:	31 c0                	xor    %eax,%eax
+    12e6:	29 d8                	sub    %ebx,%eax
+}
+    12e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12eb:	c9                   	leave
+    12ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    12ed:	0f b6 19             	movzbl (%ecx),%ebx
+    12f0:	31 c0                	xor    %eax,%eax
+    12f2:	eb db                	jmp    12cf <strcmp+0x2f>
+    12f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+
+00001300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1306:	80 3a 00             	cmpb   $0x0,(%edx)
+    1309:	74 15                	je     1320 <strlen+0x20>
+    130b:	31 c0                	xor    %eax,%eax
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+    1310:	83 c0 01             	add    $0x1,%eax
+    1313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1317:	89 c1                	mov    %eax,%ecx
+    1319:	75 f5                	jne    1310 <strlen+0x10>
+    ;
+  return n;
+}
+    131b:	89 c8                	mov    %ecx,%eax
+    131d:	5d                   	pop    %ebp
+    131e:	c3                   	ret
+    131f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1320:	31 c9                	xor    %ecx,%ecx
+}
+    1322:	5d                   	pop    %ebp
+    1323:	89 c8                	mov    %ecx,%eax
+    1325:	c3                   	ret
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1330:	55                   	push   %ebp
+    1331:	89 e5                	mov    %esp,%ebp
+    1333:	57                   	push   %edi
+    1334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    133a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    133d:	89 d7                	mov    %edx,%edi
+    133f:	fc                   	cld
+    1340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1345:	89 d0                	mov    %edx,%eax
+    1347:	c9                   	leave
+    1348:	c3                   	ret
+    1349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1350:	55                   	push   %ebp
+    1351:	89 e5                	mov    %esp,%ebp
+    1353:	8b 45 08             	mov    0x8(%ebp),%eax
+    1356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    135a:	0f b6 10             	movzbl (%eax),%edx
+    135d:	84 d2                	test   %dl,%dl
+    135f:	75 12                	jne    1373 <strchr+0x23>
+    1361:	eb 1d                	jmp    1380 <strchr+0x30>
+    1363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1367:	90                   	nop
+    1368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    136c:	83 c0 01             	add    $0x1,%eax
+    136f:	84 d2                	test   %dl,%dl
+    1371:	74 0d                	je     1380 <strchr+0x30>
+    if(*s == c)
+    1373:	38 d1                	cmp    %dl,%cl
+    1375:	75 f1                	jne    1368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1377:	5d                   	pop    %ebp
+    1378:	c3                   	ret
+    1379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1380:	31 c0                	xor    %eax,%eax
+}
+    1382:	5d                   	pop    %ebp
+    1383:	c3                   	ret
+    1384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    138f:	90                   	nop
+
+00001390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1390:	55                   	push   %ebp
+    1391:	89 e5                	mov    %esp,%ebp
+    1393:	57                   	push   %edi
+    1394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1399:	31 db                	xor    %ebx,%ebx
+{
+    139b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    139e:	eb 27                	jmp    13c7 <gets+0x37>
+    cc = read(0, &c, 1);
+    13a0:	83 ec 04             	sub    $0x4,%esp
+    13a3:	6a 01                	push   $0x1
+    13a5:	56                   	push   %esi
+    13a6:	6a 00                	push   $0x0
+    13a8:	e8 1e 01 00 00       	call   14cb <read>
+    if(cc < 1)
+    13ad:	83 c4 10             	add    $0x10,%esp
+    13b0:	85 c0                	test   %eax,%eax
+    13b2:	7e 1d                	jle    13d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    13b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    13b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    13bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    13bf:	3c 0a                	cmp    $0xa,%al
+    13c1:	74 10                	je     13d3 <gets+0x43>
+    13c3:	3c 0d                	cmp    $0xd,%al
+    13c5:	74 0c                	je     13d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    13c7:	89 df                	mov    %ebx,%edi
+    13c9:	83 c3 01             	add    $0x1,%ebx
+    13cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    13cf:	7c cf                	jl     13a0 <gets+0x10>
+    13d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    13d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    13d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    13da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13dd:	5b                   	pop    %ebx
+    13de:	5e                   	pop    %esi
+    13df:	5f                   	pop    %edi
+    13e0:	5d                   	pop    %ebp
+    13e1:	c3                   	ret
+    13e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000013f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    13f0:	55                   	push   %ebp
+    13f1:	89 e5                	mov    %esp,%ebp
+    13f3:	56                   	push   %esi
+    13f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    13f5:	83 ec 08             	sub    $0x8,%esp
+    13f8:	6a 00                	push   $0x0
+    13fa:	ff 75 08             	push   0x8(%ebp)
+    13fd:	e8 f1 00 00 00       	call   14f3 <open>
+  if(fd < 0)
+    1402:	83 c4 10             	add    $0x10,%esp
+    1405:	85 c0                	test   %eax,%eax
+    1407:	78 27                	js     1430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1409:	83 ec 08             	sub    $0x8,%esp
+    140c:	ff 75 0c             	push   0xc(%ebp)
+    140f:	89 c3                	mov    %eax,%ebx
+    1411:	50                   	push   %eax
+    1412:	e8 f4 00 00 00       	call   150b <fstat>
+  close(fd);
+    1417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    141a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    141c:	e8 ba 00 00 00       	call   14db <close>
+  return r;
+    1421:	83 c4 10             	add    $0x10,%esp
+}
+    1424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1427:	89 f0                	mov    %esi,%eax
+    1429:	5b                   	pop    %ebx
+    142a:	5e                   	pop    %esi
+    142b:	5d                   	pop    %ebp
+    142c:	c3                   	ret
+    142d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1435:	eb ed                	jmp    1424 <stat+0x34>
+    1437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    143e:	66 90                	xchg   %ax,%ax
+
+00001440 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	53                   	push   %ebx
+    1444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1447:	0f be 02             	movsbl (%edx),%eax
+    144a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    144d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1455:	77 1e                	ja     1475 <atoi+0x35>
+    1457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1460:	83 c2 01             	add    $0x1,%edx
+    1463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    146a:	0f be 02             	movsbl (%edx),%eax
+    146d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1470:	80 fb 09             	cmp    $0x9,%bl
+    1473:	76 eb                	jbe    1460 <atoi+0x20>
+  return n;
+}
+    1475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1478:	89 c8                	mov    %ecx,%eax
+    147a:	c9                   	leave
+    147b:	c3                   	ret
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001480 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	57                   	push   %edi
+    1484:	56                   	push   %esi
+    1485:	8b 45 10             	mov    0x10(%ebp),%eax
+    1488:	8b 55 08             	mov    0x8(%ebp),%edx
+    148b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    148e:	85 c0                	test   %eax,%eax
+    1490:	7e 13                	jle    14a5 <memmove+0x25>
+    1492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1494:	89 d7                	mov    %edx,%edi
+    1496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    14a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    14a1:	39 f8                	cmp    %edi,%eax
+    14a3:	75 fb                	jne    14a0 <memmove+0x20>
+  return vdst;
+}
+    14a5:	5e                   	pop    %esi
+    14a6:	89 d0                	mov    %edx,%eax
+    14a8:	5f                   	pop    %edi
+    14a9:	5d                   	pop    %ebp
+    14aa:	c3                   	ret
+
+000014ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    14ab:	b8 01 00 00 00       	mov    $0x1,%eax
+    14b0:	cd 40                	int    $0x40
+    14b2:	c3                   	ret
+
+000014b3 <exit>:
+SYSCALL(exit)
+    14b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    14b8:	cd 40                	int    $0x40
+    14ba:	c3                   	ret
+
+000014bb <wait>:
+SYSCALL(wait)
+    14bb:	b8 03 00 00 00       	mov    $0x3,%eax
+    14c0:	cd 40                	int    $0x40
+    14c2:	c3                   	ret
+
+000014c3 <pipe>:
+SYSCALL(pipe)
+    14c3:	b8 04 00 00 00       	mov    $0x4,%eax
+    14c8:	cd 40                	int    $0x40
+    14ca:	c3                   	ret
+
+000014cb <read>:
+SYSCALL(read)
+    14cb:	b8 05 00 00 00       	mov    $0x5,%eax
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <write>:
+SYSCALL(write)
+    14d3:	b8 10 00 00 00       	mov    $0x10,%eax
+    14d8:	cd 40                	int    $0x40
+    14da:	c3                   	ret
+
+000014db <close>:
+SYSCALL(close)
+    14db:	b8 15 00 00 00       	mov    $0x15,%eax
+    14e0:	cd 40                	int    $0x40
+    14e2:	c3                   	ret
+
+000014e3 <kill>:
+SYSCALL(kill)
+    14e3:	b8 06 00 00 00       	mov    $0x6,%eax
+    14e8:	cd 40                	int    $0x40
+    14ea:	c3                   	ret
+
+000014eb <exec>:
+SYSCALL(exec)
+    14eb:	b8 07 00 00 00       	mov    $0x7,%eax
+    14f0:	cd 40                	int    $0x40
+    14f2:	c3                   	ret
+
+000014f3 <open>:
+SYSCALL(open)
+    14f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    14f8:	cd 40                	int    $0x40
+    14fa:	c3                   	ret
+
+000014fb <mknod>:
+SYSCALL(mknod)
+    14fb:	b8 11 00 00 00       	mov    $0x11,%eax
+    1500:	cd 40                	int    $0x40
+    1502:	c3                   	ret
+
+00001503 <unlink>:
+SYSCALL(unlink)
+    1503:	b8 12 00 00 00       	mov    $0x12,%eax
+    1508:	cd 40                	int    $0x40
+    150a:	c3                   	ret
+
+0000150b <fstat>:
+SYSCALL(fstat)
+    150b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1510:	cd 40                	int    $0x40
+    1512:	c3                   	ret
+
+00001513 <link>:
+SYSCALL(link)
+    1513:	b8 13 00 00 00       	mov    $0x13,%eax
+    1518:	cd 40                	int    $0x40
+    151a:	c3                   	ret
+
+0000151b <mkdir>:
+SYSCALL(mkdir)
+    151b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1520:	cd 40                	int    $0x40
+    1522:	c3                   	ret
+
+00001523 <chdir>:
+SYSCALL(chdir)
+    1523:	b8 09 00 00 00       	mov    $0x9,%eax
+    1528:	cd 40                	int    $0x40
+    152a:	c3                   	ret
+
+0000152b <dup>:
+SYSCALL(dup)
+    152b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1530:	cd 40                	int    $0x40
+    1532:	c3                   	ret
+
+00001533 <getpid>:
+SYSCALL(getpid)
+    1533:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1538:	cd 40                	int    $0x40
+    153a:	c3                   	ret
+
+0000153b <sbrk>:
+SYSCALL(sbrk)
+    153b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1540:	cd 40                	int    $0x40
+    1542:	c3                   	ret
+
+00001543 <sleep>:
+SYSCALL(sleep)
+    1543:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1548:	cd 40                	int    $0x40
+    154a:	c3                   	ret
+
+0000154b <uptime>:
+SYSCALL(uptime)
+    154b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1550:	cd 40                	int    $0x40
+    1552:	c3                   	ret
+
+00001553 <poll>:
+SYSCALL(poll)
+    1553:	b8 16 00 00 00       	mov    $0x16,%eax
+    1558:	cd 40                	int    $0x40
+    155a:	c3                   	ret
+
+0000155b <fcntl>:
+SYSCALL(fcntl)
+    155b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1560:	cd 40                	int    $0x40
+    1562:	c3                   	ret
+
+00001563 <lseek>:
+SYSCALL(lseek)
+    1563:	b8 18 00 00 00       	mov    $0x18,%eax
+    1568:	cd 40                	int    $0x40
+    156a:	c3                   	ret
+
+0000156b <pread>:
+SYSCALL(pread)
+    156b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1570:	cd 40                	int    $0x40
+    1572:	c3                   	ret
+
+00001573 <pwrite>:
+SYSCALL(pwrite)
+    1573:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1578:	cd 40                	int    $0x40
+    157a:	c3                   	ret
+
+0000157b <readv>:
+SYSCALL(readv)
+    157b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1580:	cd 40                	int    $0x40
+    1582:	c3                   	ret
+
+00001583 <writev>:
+SYSCALL(writev)
+    1583:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1588:	cd 40                	int    $0x40
+    158a:	c3                   	ret
+
+0000158b <getdents>:
+SYSCALL(getdents)
+    158b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1590:	cd 40                	int    $0x40
+    1592:	c3                   	ret
+
+00001593 <splice>:
+SYSCALL(splice)
+    1593:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1598:	cd 40                	int    $0x40
+    159a:	c3                   	ret
+
+0000159b <ioring_setup>:
+SYSCALL(ioring_setup)
+    159b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15a0:	cd 40                	int    $0x40
+    15a2:	c3                   	ret
+
+000015a3 <ioring_enter>:
+SYSCALL(ioring_enter)
+    15a3:	b8 20 00 00 00       	mov    $0x20,%eax
+    15a8:	cd 40                	int    $0x40
+    15aa:	c3                   	ret
+
+000015ab <batch>:
+SYSCALL(batch)
+    15ab:	b8 21 00 00 00       	mov    $0x21,%eax
+    15b0:	cd 40                	int    $0x40
+    15b2:	c3                   	ret
+    15b3:	66 90                	xchg   %ax,%ax
+    15b5:	66 90                	xchg   %ax,%ax
+    15b7:	66 90                	xchg   %ax,%ax
+    15b9:	66 90                	xchg   %ax,%ax
+    15bb:	66 90                	xchg   %ax,%ax
+    15bd:	66 90                	xchg   %ax,%ax
+    15bf:	90                   	nop
+
+000015c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    15c0:	55                   	push   %ebp
+    15c1:	89 e5                	mov    %esp,%ebp
+    15c3:	57                   	push   %edi
+    15c4:	56                   	push   %esi
+    15c5:	53                   	push   %ebx
+    15c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    15c8:	89 d1                	mov    %edx,%ecx
+{
+    15ca:	83 ec 3c             	sub    $0x3c,%esp
+    15cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    15d0:	85 d2                	test   %edx,%edx
+    15d2:	0f 89 80 00 00 00    	jns    1658 <printint+0x98>
+    15d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    15dc:	74 7a                	je     1658 <printint+0x98>
+    x = -xx;
+    15de:	f7 d9                	neg    %ecx
+    neg = 1;
+    15e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    15e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    15e8:	31 f6                	xor    %esi,%esi
+    15ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    15f0:	89 c8                	mov    %ecx,%eax
+    15f2:	31 d2                	xor    %edx,%edx
+    15f4:	89 f7                	mov    %esi,%edi
+    15f6:	f7 f3                	div    %ebx
+    15f8:	8d 76 01             	lea    0x1(%esi),%esi
+    15fb:	0f b6 92 14 24 00 00 	movzbl 0x2414(%edx),%edx
+    1602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1606:	89 ca                	mov    %ecx,%edx
+    1608:	89 c1                	mov    %eax,%ecx
+    160a:	39 da                	cmp    %ebx,%edx
+    160c:	73 e2                	jae    15f0 <printint+0x30>
+  if(neg)
+    160e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1611:	85 c0                	test   %eax,%eax
+    1613:	74 07                	je     161c <printint+0x5c>
+    buf[i++] = '-';
+    1615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    161a:	89 f7                	mov    %esi,%edi
+    161c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    161f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1622:	01 df                	add    %ebx,%edi
+    1624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    162b:	83 ec 04             	sub    $0x4,%esp
+    162e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1634:	6a 01                	push   $0x1
+    1636:	50                   	push   %eax
+    1637:	56                   	push   %esi
+    1638:	e8 96 fe ff ff       	call   14d3 <write>
+  while(--i >= 0)
+    163d:	89 f8                	mov    %edi,%eax
+    163f:	83 c4 10             	add    $0x10,%esp
+    1642:	83 ef 01             	sub    $0x1,%edi
+    1645:	39 d8                	cmp    %ebx,%eax
+    1647:	75 df                	jne    1628 <printint+0x68>
+}
+    1649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    164c:	5b                   	pop    %ebx
+    164d:	5e                   	pop    %esi
+    164e:	5f                   	pop    %edi
+    164f:	5d                   	pop    %ebp
+    1650:	c3                   	ret
+    1651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1658:	31 c0                	xor    %eax,%eax
+    165a:	eb 89                	jmp    15e5 <printint+0x25>
+    165c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    166c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    166f:	0f b6 1e             	movzbl (%esi),%ebx
+    1672:	83 c6 01             	add    $0x1,%esi
+    1675:	84 db                	test   %bl,%bl
+    1677:	74 67                	je     16e0 <printf+0x80>
+    1679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    167c:	31 d2                	xor    %edx,%edx
+    167e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1681:	eb 34                	jmp    16b7 <printf+0x57>
+    1683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1687:	90                   	nop
+    1688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    168b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1690:	83 f8 25             	cmp    $0x25,%eax
+    1693:	74 18                	je     16ad <printf+0x4d>
+  write(fd, &c, 1);
+    1695:	83 ec 04             	sub    $0x4,%esp
+    1698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    169b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    169e:	6a 01                	push   $0x1
+    16a0:	50                   	push   %eax
+    16a1:	57                   	push   %edi
+    16a2:	e8 2c fe ff ff       	call   14d3 <write>
+    16a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    16aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    16ad:	0f b6 1e             	movzbl (%esi),%ebx
+    16b0:	83 c6 01             	add    $0x1,%esi
+    16b3:	84 db                	test   %bl,%bl
+    16b5:	74 29                	je     16e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    16b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    16ba:	85 d2                	test   %edx,%edx
+    16bc:	74 ca                	je     1688 <printf+0x28>
+      }
+    } else if(state == '%'){
+    16be:	83 fa 25             	cmp    $0x25,%edx
+    16c1:	75 ea                	jne    16ad <printf+0x4d>
+      if(c == 'd'){
+    16c3:	83 f8 25             	cmp    $0x25,%eax
+    16c6:	0f 84 24 01 00 00    	je     17f0 <printf+0x190>
+    16cc:	83 e8 63             	sub    $0x63,%eax
+    16cf:	83 f8 15             	cmp    $0x15,%eax
+    16d2:	77 1c                	ja     16f0 <printf+0x90>
+    16d4:	ff 24 85 bc 23 00 00 	jmp    *0x23bc(,%eax,4)
+    16db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    16e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16e3:	5b                   	pop    %ebx
+    16e4:	5e                   	pop    %esi
+    16e5:	5f                   	pop    %edi
+    16e6:	5d                   	pop    %ebp
+    16e7:	c3                   	ret
+    16e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ef:	90                   	nop
+  write(fd, &c, 1);
+    16f0:	83 ec 04             	sub    $0x4,%esp
+    16f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    16f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    16fa:	6a 01                	push   $0x1
+    16fc:	52                   	push   %edx
+    16fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1700:	57                   	push   %edi
+    1701:	e8 cd fd ff ff       	call   14d3 <write>
+    1706:	83 c4 0c             	add    $0xc,%esp
+    1709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    170c:	6a 01                	push   $0x1
+    170e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1711:	52                   	push   %edx
+    1712:	57                   	push   %edi
+    1713:	e8 bb fd ff ff       	call   14d3 <write>
+        putc(fd, c);
+    1718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    171b:	31 d2                	xor    %edx,%edx
+    171d:	eb 8e                	jmp    16ad <printf+0x4d>
+    171f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1723:	83 ec 0c             	sub    $0xc,%esp
+    1726:	b9 10 00 00 00       	mov    $0x10,%ecx
+    172b:	8b 13                	mov    (%ebx),%edx
+    172d:	6a 00                	push   $0x0
+    172f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1734:	e8 87 fe ff ff       	call   15c0 <printint>
+        ap++;
+    1739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    173c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    173f:	31 d2                	xor    %edx,%edx
+    1741:	e9 67 ff ff ff       	jmp    16ad <printf+0x4d>
+    1746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    174d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1755:	83 c0 04             	add    $0x4,%eax
+    1758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    175b:	85 db                	test   %ebx,%ebx
+    175d:	0f 84 9d 00 00 00    	je     1800 <printf+0x1a0>
+        while(*s != 0){
+    1763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1768:	84 c0                	test   %al,%al
+    176a:	0f 84 3d ff ff ff    	je     16ad <printf+0x4d>
+    1770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1776:	89 de                	mov    %ebx,%esi
+    1778:	89 d3                	mov    %edx,%ebx
+    177a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1780:	83 ec 04             	sub    $0x4,%esp
+    1783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1789:	6a 01                	push   $0x1
+    178b:	53                   	push   %ebx
+    178c:	57                   	push   %edi
+    178d:	e8 41 fd ff ff       	call   14d3 <write>
+        while(*s != 0){
+    1792:	0f b6 06             	movzbl (%esi),%eax
+    1795:	83 c4 10             	add    $0x10,%esp
+    1798:	84 c0                	test   %al,%al
+    179a:	75 e4                	jne    1780 <printf+0x120>
+      state = 0;
+    179c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    179f:	31 d2                	xor    %edx,%edx
+    17a1:	e9 07 ff ff ff       	jmp    16ad <printf+0x4d>
+    17a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    17b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    17b3:	83 ec 0c             	sub    $0xc,%esp
+    17b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    17bb:	8b 13                	mov    (%ebx),%edx
+    17bd:	6a 01                	push   $0x1
+    17bf:	e9 6b ff ff ff       	jmp    172f <printf+0xcf>
+    17c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    17c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    17cb:	83 ec 04             	sub    $0x4,%esp
+    17ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    17d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    17d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    17d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    17d9:	6a 01                	push   $0x1
+    17db:	52                   	push   %edx
+    17dc:	57                   	push   %edi
+    17dd:	e8 f1 fc ff ff       	call   14d3 <write>
+        ap++;
+    17e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    17e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    17e8:	31 d2                	xor    %edx,%edx
+    17ea:	e9 be fe ff ff       	jmp    16ad <printf+0x4d>
+    17ef:	90                   	nop
+  write(fd, &c, 1);
+    17f0:	83 ec 04             	sub    $0x4,%esp
+    17f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    17f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    17f9:	6a 01                	push   $0x1
+    17fb:	e9 11 ff ff ff       	jmp    1711 <printf+0xb1>
+    1800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1805:	bb b4 23 00 00       	mov    $0x23b4,%ebx
+    180a:	e9 61 ff ff ff       	jmp    1770 <printf+0x110>
+    180f:	90                   	nop
+
+00001810 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1810:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1811:	a1 08 2e 00 00       	mov    0x2e08,%eax
+{
+    1816:	89 e5                	mov    %esp,%ebp
+    1818:	57                   	push   %edi
+    1819:	56                   	push   %esi
+    181a:	53                   	push   %ebx
+    181b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    181e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1828:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    182a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    182c:	39 ca                	cmp    %ecx,%edx
+    182e:	73 30                	jae    1860 <free+0x50>
+    1830:	39 c1                	cmp    %eax,%ecx
+    1832:	72 04                	jb     1838 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1834:	39 c2                	cmp    %eax,%edx
+    1836:	72 f0                	jb     1828 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1838:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    183b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    183e:	39 f8                	cmp    %edi,%eax
+    1840:	74 2e                	je     1870 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1842:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1845:	8b 42 04             	mov    0x4(%edx),%eax
+    1848:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    184b:	39 f1                	cmp    %esi,%ecx
+    184d:	74 38                	je     1887 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    184f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1851:	5b                   	pop    %ebx
+  freep = p;
+    1852:	89 15 08 2e 00 00    	mov    %edx,0x2e08
+}
+    1858:	5e                   	pop    %esi
+    1859:	5f                   	pop    %edi
+    185a:	5d                   	pop    %ebp
+    185b:	c3                   	ret
+    185c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1860:	39 c1                	cmp    %eax,%ecx
+    1862:	72 d0                	jb     1834 <free+0x24>
+    1864:	eb c2                	jmp    1828 <free+0x18>
+    1866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1870:	03 70 04             	add    0x4(%eax),%esi
+    1873:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1876:	8b 02                	mov    (%edx),%eax
+    1878:	8b 00                	mov    (%eax),%eax
+    187a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    187d:	8b 42 04             	mov    0x4(%edx),%eax
+    1880:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1883:	39 f1                	cmp    %esi,%ecx
+    1885:	75 c8                	jne    184f <free+0x3f>
+    p->s.size += bp->s.size;
+    1887:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    188a:	89 15 08 2e 00 00    	mov    %edx,0x2e08
+    p->s.size += bp->s.size;
+    1890:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1893:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1896:	89 0a                	mov    %ecx,(%edx)
+}
+    1898:	5b                   	pop    %ebx
+    1899:	5e                   	pop    %esi
+    189a:	5f                   	pop    %edi
+    189b:	5d                   	pop    %ebp
+    189c:	c3                   	ret
+    189d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000018a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    18a0:	55                   	push   %ebp
+    18a1:	89 e5                	mov    %esp,%ebp
+    18a3:	57                   	push   %edi
+    18a4:	56                   	push   %esi
+    18a5:	53                   	push   %ebx
+    18a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    18ac:	8b 15 08 2e 00 00    	mov    0x2e08,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18b2:	8d 78 07             	lea    0x7(%eax),%edi
+    18b5:	c1 ef 03             	shr    $0x3,%edi
+    18b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    18bb:	85 d2                	test   %edx,%edx
+    18bd:	0f 84 8d 00 00 00    	je     1950 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    18c5:	8b 48 04             	mov    0x4(%eax),%ecx
+    18c8:	39 f9                	cmp    %edi,%ecx
+    18ca:	73 64                	jae    1930 <malloc+0x90>
+  if(nu < 4096)
+    18cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    18d1:	39 df                	cmp    %ebx,%edi
+    18d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    18d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    18dd:	eb 0a                	jmp    18e9 <malloc+0x49>
+    18df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    18e2:	8b 48 04             	mov    0x4(%eax),%ecx
+    18e5:	39 f9                	cmp    %edi,%ecx
+    18e7:	73 47                	jae    1930 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    18e9:	89 c2                	mov    %eax,%edx
+    18eb:	39 05 08 2e 00 00    	cmp    %eax,0x2e08
+    18f1:	75 ed                	jne    18e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    18f3:	83 ec 0c             	sub    $0xc,%esp
+    18f6:	56                   	push   %esi
+    18f7:	e8 3f fc ff ff       	call   153b <sbrk>
+  if(p == (char*)-1)
+    18fc:	83 c4 10             	add    $0x10,%esp
+    18ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1902:	74 1c                	je     1920 <malloc+0x80>
+  hp->s.size = nu;
+    1904:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1907:	83 ec 0c             	sub    $0xc,%esp
+    190a:	83 c0 08             	add    $0x8,%eax
+    190d:	50                   	push   %eax
+    190e:	e8 fd fe ff ff       	call   1810 <free>
+  return freep;
+    1913:	8b 15 08 2e 00 00    	mov    0x2e08,%edx
+      if((p = morecore(nunits)) == 0)
+    1919:	83 c4 10             	add    $0x10,%esp
+    191c:	85 d2                	test   %edx,%edx
+    191e:	75 c0                	jne    18e0 <malloc+0x40>
+        return 0;
+  }
+}
+    1920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1923:	31 c0                	xor    %eax,%eax
+}
+    1925:	5b                   	pop    %ebx
+    1926:	5e                   	pop    %esi
+    1927:	5f                   	pop    %edi
+    1928:	5d                   	pop    %ebp
+    1929:	c3                   	ret
+    192a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1930:	39 cf                	cmp    %ecx,%edi
+    1932:	74 4c                	je     1980 <malloc+0xe0>
+        p->s.size -= nunits;
+    1934:	29 f9                	sub    %edi,%ecx
+    1936:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1939:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    193c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    193f:	89 15 08 2e 00 00    	mov    %edx,0x2e08
+}
+    1945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1948:	83 c0 08             	add    $0x8,%eax
+}
+    194b:	5b                   	pop    %ebx
+    194c:	5e                   	pop    %esi
+    194d:	5f                   	pop    %edi
+    194e:	5d                   	pop    %ebp
+    194f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1950:	c7 05 08 2e 00 00 0c 	movl   $0x2e0c,0x2e08
+    1957:	2e 00 00 
+    base.s.size = 0;
+    195a:	b8 0c 2e 00 00       	mov    $0x2e0c,%eax
+    base.s.ptr = freep = prevp = &base;
+    195f:	c7 05 0c 2e 00 00 0c 	movl   $0x2e0c,0x2e0c
+    1966:	2e 00 00 
+    base.s.size = 0;
+    1969:	c7 05 10 2e 00 00 00 	movl   $0x0,0x2e10
+    1970:	00 00 00 
+    if(p->s.size >= nunits){
+    1973:	e9 54 ff ff ff       	jmp    18cc <malloc+0x2c>
+    1978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    197f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1980:	8b 08                	mov    (%eax),%ecx
+    1982:	89 0a                	mov    %ecx,(%edx)
+    1984:	eb b9                	jmp    193f <malloc+0x9f>
+    1986:	66 90                	xchg   %ax,%ax
+    1988:	66 90                	xchg   %ax,%ax
+    198a:	66 90                	xchg   %ax,%ax
+    198c:	66 90                	xchg   %ax,%ax
+    198e:	66 90                	xchg   %ax,%ax
+
+00001990 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	57                   	push   %edi
+    1994:	56                   	push   %esi
+    1995:	53                   	push   %ebx
+    1996:	83 ec 1c             	sub    $0x1c,%esp
+    1999:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+    199c:	85 c9                	test   %ecx,%ecx
+    199e:	7e 51                	jle    19f1 <put+0x61>
+    19a0:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+    19a2:	8b 40 08             	mov    0x8(%eax),%eax
+    19a5:	89 ce                	mov    %ecx,%esi
+    19a7:	85 c0                	test   %eax,%eax
+    19a9:	7e 55                	jle    1a00 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+    19ab:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+    19ae:	8b 51 0c             	mov    0xc(%ecx),%edx
+    19b1:	8b 79 08             	mov    0x8(%ecx),%edi
+    19b4:	01 d7                	add    %edx,%edi
+    19b6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    19b9:	74 65                	je     1a20 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+    19bb:	83 f8 20             	cmp    $0x20,%eax
+    19be:	75 40                	jne    1a00 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+    19c0:	83 ec 04             	sub    $0x4,%esp
+    19c3:	8d 43 10             	lea    0x10(%ebx),%eax
+    19c6:	6a 20                	push   $0x20
+    19c8:	50                   	push   %eax
+    19c9:	ff 33                	push   (%ebx)
+    19cb:	e8 b3 fb ff ff       	call   1583 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+    19d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+    19d3:	31 c0                	xor    %eax,%eax
+    19d5:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    19da:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+    19dd:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    19e4:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    19e7:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    19ea:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+    19ee:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    19f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19f4:	5b                   	pop    %ebx
+    19f5:	5e                   	pop    %esi
+    19f6:	5f                   	pop    %edi
+    19f7:	5d                   	pop    %ebp
+    19f8:	c3                   	ret
+    19f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+    1a00:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+    1a03:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1a06:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+    1a09:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+    1a0d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+    1a10:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    1a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a16:	5b                   	pop    %ebx
+    1a17:	5e                   	pop    %esi
+    1a18:	5f                   	pop    %edi
+    1a19:	5d                   	pop    %ebp
+    1a1a:	c3                   	ret
+    1a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a1f:	90                   	nop
+      last->iov_len += n;
+    1a20:	01 f2                	add    %esi,%edx
+    1a22:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+    1a25:	eb ca                	jmp    19f1 <put+0x61>
+    1a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2e:	66 90                	xchg   %ax,%ax
+
+00001a30 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+    1a30:	55                   	push   %ebp
+    1a31:	89 e5                	mov    %esp,%ebp
+    1a33:	57                   	push   %edi
+    1a34:	89 d7                	mov    %edx,%edi
+    1a36:	56                   	push   %esi
+    1a37:	89 ce                	mov    %ecx,%esi
+    1a39:	53                   	push   %ebx
+    1a3a:	89 c3                	mov    %eax,%ebx
+    1a3c:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+    1a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+    1a42:	8b 53 08             	mov    0x8(%ebx),%edx
+    1a45:	01 c1                	add    %eax,%ecx
+    1a47:	83 f9 40             	cmp    $0x40,%ecx
+    1a4a:	7f 3c                	jg     1a88 <putcopy+0x58>
+    1a4c:	83 fa 20             	cmp    $0x20,%edx
+    1a4f:	74 3f                	je     1a90 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+    1a51:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+    1a57:	83 ec 04             	sub    $0x4,%esp
+    1a5a:	01 d0                	add    %edx,%eax
+    1a5c:	56                   	push   %esi
+    1a5d:	57                   	push   %edi
+    1a5e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1a61:	50                   	push   %eax
+    1a62:	e8 19 fa ff ff       	call   1480 <memmove>
+  put(w, w->buf + w->nbuf, n);
+    1a67:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1a6a:	89 f1                	mov    %esi,%ecx
+    1a6c:	03 53 0c             	add    0xc(%ebx),%edx
+    1a6f:	89 d8                	mov    %ebx,%eax
+    1a71:	e8 1a ff ff ff       	call   1990 <put>
+  w->nbuf += n;
+    1a76:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+    1a79:	83 c4 10             	add    $0x10,%esp
+    1a7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a7f:	5b                   	pop    %ebx
+    1a80:	5e                   	pop    %esi
+    1a81:	5f                   	pop    %edi
+    1a82:	5d                   	pop    %ebp
+    1a83:	c3                   	ret
+    1a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+    1a88:	85 d2                	test   %edx,%edx
+    1a8a:	7e 16                	jle    1aa2 <putcopy+0x72>
+    1a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+    1a90:	83 ec 04             	sub    $0x4,%esp
+    1a93:	8d 43 10             	lea    0x10(%ebx),%eax
+    1a96:	52                   	push   %edx
+    1a97:	50                   	push   %eax
+    1a98:	ff 33                	push   (%ebx)
+    1a9a:	e8 e4 fa ff ff       	call   1583 <writev>
+    1a9f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+    1aa2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    1aa9:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+    1aab:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    1ab2:	eb 9d                	jmp    1a51 <putcopy+0x21>
+    1ab4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1abf:	90                   	nop
+
+00001ac0 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+    1ac6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+    1ac9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+    1ad0:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+    1ad2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+    1ad9:	c7 40 10 25 24 00 00 	movl   $0x2425,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+    1ae0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+    1ae7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+    1aee:	5d                   	pop    %ebp
+    1aef:	c3                   	ret
+
+00001af0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+    1af0:	55                   	push   %ebp
+    1af1:	89 e5                	mov    %esp,%ebp
+    1af3:	57                   	push   %edi
+    1af4:	56                   	push   %esi
+    1af5:	53                   	push   %ebx
+    1af6:	83 ec 1c             	sub    $0x1c,%esp
+    1af9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1afc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1aff:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+    1b02:	8b 47 04             	mov    0x4(%edi),%eax
+    1b05:	85 c0                	test   %eax,%eax
+    1b07:	0f 85 7b 01 00 00    	jne    1c88 <struct_field_str+0x198>
+    w->need_comma = 1;
+    1b0d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    1b14:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1b19:	ba 3a 24 00 00       	mov    $0x243a,%edx
+    1b1e:	89 f8                	mov    %edi,%eax
+    1b20:	e8 6b fe ff ff       	call   1990 <put>
+  put_str(w, key ? key : "");
+    1b25:	85 db                	test   %ebx,%ebx
+    1b27:	b8 38 21 00 00       	mov    $0x2138,%eax
+    1b2c:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    1b2f:	83 ec 0c             	sub    $0xc,%esp
+    1b32:	53                   	push   %ebx
+    1b33:	e8 c8 f7 ff ff       	call   1300 <strlen>
+    1b38:	89 da                	mov    %ebx,%edx
+    1b3a:	89 c1                	mov    %eax,%ecx
+    1b3c:	89 f8                	mov    %edi,%eax
+    1b3e:	e8 4d fe ff ff       	call   1990 <put>
+  put(w, "\":\"", 3);
+    1b43:	b9 03 00 00 00       	mov    $0x3,%ecx
+    1b48:	ba 38 24 00 00       	mov    $0x2438,%edx
+    1b4d:	89 f8                	mov    %edi,%eax
+    1b4f:	e8 3c fe ff ff       	call   1990 <put>
+  put_escaped(w, value ? value : "");
+    1b54:	83 c4 10             	add    $0x10,%esp
+    1b57:	85 f6                	test   %esi,%esi
+    1b59:	0f 84 41 01 00 00    	je     1ca0 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+    1b5f:	0f b6 1e             	movzbl (%esi),%ebx
+    1b62:	89 f2                	mov    %esi,%edx
+    1b64:	84 db                	test   %bl,%bl
+    1b66:	0f 84 40 01 00 00    	je     1cac <struct_field_str+0x1bc>
+    1b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    1b70:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+    1b72:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+    1b75:	80 fb 0d             	cmp    $0xd,%bl
+    1b78:	74 7e                	je     1bf8 <struct_field_str+0x108>
+    1b7a:	7f 5c                	jg     1bd8 <struct_field_str+0xe8>
+    1b7c:	80 fb 09             	cmp    $0x9,%bl
+    1b7f:	0f 84 eb 00 00 00    	je     1c70 <struct_field_str+0x180>
+    1b85:	80 fb 0a             	cmp    $0xa,%bl
+    1b88:	0f 85 95 00 00 00    	jne    1c23 <struct_field_str+0x133>
+    put(w, run, s - run);
+    1b8e:	29 d1                	sub    %edx,%ecx
+    1b90:	89 f8                	mov    %edi,%eax
+    1b92:	e8 f9 fd ff ff       	call   1990 <put>
+      esc = "\\n";
+    1b97:	ba 33 24 00 00       	mov    $0x2433,%edx
+      put(w, esc, 2);
+    1b9c:	b9 02 00 00 00       	mov    $0x2,%ecx
+    1ba1:	89 f8                	mov    %edi,%eax
+    1ba3:	e8 e8 fd ff ff       	call   1990 <put>
+    run = s + 1;
+    1ba8:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+    1baa:	0f b6 1e             	movzbl (%esi),%ebx
+    1bad:	84 db                	test   %bl,%bl
+    1baf:	75 bf                	jne    1b70 <struct_field_str+0x80>
+  put(w, run, s - run);
+    1bb1:	29 d6                	sub    %edx,%esi
+    1bb3:	89 f1                	mov    %esi,%ecx
+    1bb5:	89 f8                	mov    %edi,%eax
+    1bb7:	e8 d4 fd ff ff       	call   1990 <put>
+  put(w, "\"", 1);
+}
+    1bbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+    1bbf:	89 f8                	mov    %edi,%eax
+    1bc1:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+    1bc6:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+    1bc7:	ba 3a 24 00 00       	mov    $0x243a,%edx
+}
+    1bcc:	5e                   	pop    %esi
+    1bcd:	5f                   	pop    %edi
+    1bce:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+    1bcf:	e9 bc fd ff ff       	jmp    1990 <put>
+    1bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    1bd8:	80 fb 22             	cmp    $0x22,%bl
+    1bdb:	74 33                	je     1c10 <struct_field_str+0x120>
+    1bdd:	80 fb 5c             	cmp    $0x5c,%bl
+    1be0:	75 41                	jne    1c23 <struct_field_str+0x133>
+    put(w, run, s - run);
+    1be2:	29 d1                	sub    %edx,%ecx
+    1be4:	89 f8                	mov    %edi,%eax
+    1be6:	e8 a5 fd ff ff       	call   1990 <put>
+      esc = "\\\\";
+    1beb:	ba 27 24 00 00       	mov    $0x2427,%edx
+    1bf0:	eb aa                	jmp    1b9c <struct_field_str+0xac>
+    1bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+    1bf8:	29 d1                	sub    %edx,%ecx
+    1bfa:	89 f8                	mov    %edi,%eax
+    1bfc:	e8 8f fd ff ff       	call   1990 <put>
+      esc = "\\r";
+    1c01:	ba 30 24 00 00       	mov    $0x2430,%edx
+    1c06:	eb 94                	jmp    1b9c <struct_field_str+0xac>
+    1c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c0f:	90                   	nop
+    put(w, run, s - run);
+    1c10:	29 d1                	sub    %edx,%ecx
+    1c12:	89 f8                	mov    %edi,%eax
+    1c14:	e8 77 fd ff ff       	call   1990 <put>
+      esc = "\\\"";
+    1c19:	ba 2a 24 00 00       	mov    $0x242a,%edx
+    1c1e:	e9 79 ff ff ff       	jmp    1b9c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+    1c23:	80 fb 1f             	cmp    $0x1f,%bl
+    1c26:	77 82                	ja     1baa <struct_field_str+0xba>
+    put(w, run, s - run);
+    1c28:	29 d1                	sub    %edx,%ecx
+    1c2a:	89 f8                	mov    %edi,%eax
+    1c2c:	e8 5f fd ff ff       	call   1990 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+    1c31:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+    1c33:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+    1c36:	0f b7 05 54 24 00 00 	movzwl 0x2454,%eax
+    1c3d:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+    1c40:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+    1c45:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+    1c4c:	0f b6 d2             	movzbl %dl,%edx
+    1c4f:	8a 82 3c 24 00 00    	mov    0x243c(%edx),%al
+    1c55:	8a a3 3c 24 00 00    	mov    0x243c(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+    1c5b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+    1c5e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+    1c62:	89 f8                	mov    %edi,%eax
+    1c64:	e8 c7 fd ff ff       	call   1a30 <putcopy>
+    1c69:	e9 3a ff ff ff       	jmp    1ba8 <struct_field_str+0xb8>
+    1c6e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+    1c70:	29 d1                	sub    %edx,%ecx
+    1c72:	89 f8                	mov    %edi,%eax
+    1c74:	e8 17 fd ff ff       	call   1990 <put>
+      esc = "\\t";
+    1c79:	ba 2d 24 00 00       	mov    $0x242d,%edx
+    1c7e:	e9 19 ff ff ff       	jmp    1b9c <struct_field_str+0xac>
+    1c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c87:	90                   	nop
+    put(w, ",", 1);
+    1c88:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1c8d:	ba 36 24 00 00       	mov    $0x2436,%edx
+    1c92:	89 f8                	mov    %edi,%eax
+    1c94:	e8 f7 fc ff ff       	call   1990 <put>
+}
+    1c99:	e9 76 fe ff ff       	jmp    1b14 <struct_field_str+0x24>
+    1c9e:	66 90                	xchg   %ax,%ax
+    1ca0:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+    1ca2:	ba 38 21 00 00       	mov    $0x2138,%edx
+    1ca7:	e9 09 ff ff ff       	jmp    1bb5 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+    1cac:	31 c9                	xor    %ecx,%ecx
+    1cae:	e9 02 ff ff ff       	jmp    1bb5 <struct_field_str+0xc5>
+    1cb3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001cc0 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+    1cc0:	55                   	push   %ebp
+    1cc1:	89 e5                	mov    %esp,%ebp
+    1cc3:	57                   	push   %edi
+    1cc4:	56                   	push   %esi
+    1cc5:	53                   	push   %ebx
+    1cc6:	83 ec 1c             	sub    $0x1c,%esp
+    1cc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1ccc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+    1ccf:	8b 57 04             	mov    0x4(%edi),%edx
+    1cd2:	85 d2                	test   %edx,%edx
+    1cd4:	0f 85 b6 00 00 00    	jne    1d90 <struct_field_int+0xd0>
+    w->need_comma = 1;
+    1cda:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    1ce1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1ce6:	ba 3a 24 00 00       	mov    $0x243a,%edx
+    1ceb:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+    1ced:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+    1cf2:	e8 99 fc ff ff       	call   1990 <put>
+  put_str(w, key ? key : "");
+    1cf7:	85 db                	test   %ebx,%ebx
+    1cf9:	b8 38 21 00 00       	mov    $0x2138,%eax
+    1cfe:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    1d01:	83 ec 0c             	sub    $0xc,%esp
+    1d04:	53                   	push   %ebx
+    1d05:	e8 f6 f5 ff ff       	call   1300 <strlen>
+    1d0a:	89 da                	mov    %ebx,%edx
+    1d0c:	89 c1                	mov    %eax,%ecx
+    1d0e:	89 f8                	mov    %edi,%eax
+    1d10:	e8 7b fc ff ff       	call   1990 <put>
+  put(w, "\":", 2);
+    1d15:	b9 02 00 00 00       	mov    $0x2,%ecx
+    1d1a:	ba 4d 24 00 00       	mov    $0x244d,%edx
+    1d1f:	89 f8                	mov    %edi,%eax
+    1d21:	e8 6a fc ff ff       	call   1990 <put>
+  x = value < 0 ? -(uint)value : value;
+    1d26:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+    1d29:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+    1d2c:	83 c4 10             	add    $0x10,%esp
+    1d2f:	f7 d9                	neg    %ecx
+    1d31:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+    1d35:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+    1d38:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    1d3d:	89 f3                	mov    %esi,%ebx
+    1d3f:	83 ee 01             	sub    $0x1,%esi
+    1d42:	f7 e1                	mul    %ecx
+    1d44:	89 c8                	mov    %ecx,%eax
+    1d46:	c1 ea 03             	shr    $0x3,%edx
+    1d49:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+    1d4c:	01 ff                	add    %edi,%edi
+    1d4e:	29 f8                	sub    %edi,%eax
+    1d50:	83 c0 30             	add    $0x30,%eax
+    1d53:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+    1d57:	89 c8                	mov    %ecx,%eax
+    1d59:	89 d1                	mov    %edx,%ecx
+    1d5b:	83 f8 09             	cmp    $0x9,%eax
+    1d5e:	77 d8                	ja     1d38 <struct_field_int+0x78>
+  if(value < 0)
+    1d60:	8b 45 10             	mov    0x10(%ebp),%eax
+    1d63:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1d66:	85 c0                	test   %eax,%eax
+    1d68:	79 08                	jns    1d72 <struct_field_int+0xb2>
+    buf[--i] = '-';
+    1d6a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+    1d6f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+    1d72:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1d75:	b9 0c 00 00 00       	mov    $0xc,%ecx
+    1d7a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1d7d:	29 f1                	sub    %esi,%ecx
+    1d7f:	89 f8                	mov    %edi,%eax
+    1d81:	e8 aa fc ff ff       	call   1a30 <putcopy>
+  put_int(w, value);
+}
+    1d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d89:	5b                   	pop    %ebx
+    1d8a:	5e                   	pop    %esi
+    1d8b:	5f                   	pop    %edi
+    1d8c:	5d                   	pop    %ebp
+    1d8d:	c3                   	ret
+    1d8e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+    1d90:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1d95:	ba 36 24 00 00       	mov    $0x2436,%edx
+    1d9a:	89 f8                	mov    %edi,%eax
+    1d9c:	e8 ef fb ff ff       	call   1990 <put>
+}
+    1da1:	e9 3b ff ff ff       	jmp    1ce1 <struct_field_int+0x21>
+    1da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001db0 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+    1db0:	55                   	push   %ebp
+    1db1:	89 e5                	mov    %esp,%ebp
+    1db3:	56                   	push   %esi
+    1db4:	53                   	push   %ebx
+    1db5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+    1db8:	8b 43 08             	mov    0x8(%ebx),%eax
+    1dbb:	85 c0                	test   %eax,%eax
+    1dbd:	7e 59                	jle    1e18 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+    1dbf:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+    1dc2:	8b 4a 0c             	mov    0xc(%edx),%ecx
+    1dc5:	8b 72 08             	mov    0x8(%edx),%esi
+    1dc8:	01 ce                	add    %ecx,%esi
+    1dca:	81 fe 50 24 00 00    	cmp    $0x2450,%esi
+    1dd0:	0f 84 aa 00 00 00    	je     1e80 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+    1dd6:	83 f8 20             	cmp    $0x20,%eax
+    1dd9:	75 75                	jne    1e50 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+    1ddb:	83 ec 04             	sub    $0x4,%esp
+    1dde:	8d 73 10             	lea    0x10(%ebx),%esi
+    1de1:	6a 20                	push   $0x20
+    1de3:	56                   	push   %esi
+    1de4:	ff 33                	push   (%ebx)
+    1de6:	e8 98 f7 ff ff       	call   1583 <writev>
+  w->nbuf = 0;
+    1deb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+    1df2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    1df5:	c7 43 10 50 24 00 00 	movl   $0x2450,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+    1dfc:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+    1e03:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+    1e0a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e0f:	eb 5a                	jmp    1e6b <struct_end+0xbb>
+    1e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+    1e18:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1e1b:	83 c0 02             	add    $0x2,%eax
+    1e1e:	c7 04 c3 50 24 00 00 	movl   $0x2450,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    1e25:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    1e2c:	00 
+  w->niov++;
+    1e2d:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+    1e30:	83 fa 01             	cmp    $0x1,%edx
+    1e33:	74 58                	je     1e8d <struct_end+0xdd>
+  w->niov = 0;
+    1e35:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+    1e3c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+    1e43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1e46:	5b                   	pop    %ebx
+    1e47:	5e                   	pop    %esi
+    1e48:	5d                   	pop    %ebp
+    1e49:	c3                   	ret
+    1e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+    1e50:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1e53:	83 c0 02             	add    $0x2,%eax
+    1e56:	8d 73 10             	lea    0x10(%ebx),%esi
+    1e59:	c7 04 c3 50 24 00 00 	movl   $0x2450,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    1e60:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    1e67:	00 
+  w->niov++;
+    1e68:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+    1e6b:	83 ec 04             	sub    $0x4,%esp
+    1e6e:	52                   	push   %edx
+    1e6f:	56                   	push   %esi
+    1e70:	ff 33                	push   (%ebx)
+    1e72:	e8 0c f7 ff ff       	call   1583 <writev>
+    1e77:	83 c4 10             	add    $0x10,%esp
+    1e7a:	eb b9                	jmp    1e35 <struct_end+0x85>
+    1e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+    1e80:	83 c1 02             	add    $0x2,%ecx
+    1e83:	8d 73 10             	lea    0x10(%ebx),%esi
+    1e86:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+    1e89:	89 c2                	mov    %eax,%edx
+    1e8b:	eb de                	jmp    1e6b <struct_end+0xbb>
+    1e8d:	8d 73 10             	lea    0x10(%ebx),%esi
+    1e90:	e9 75 ff ff ff       	jmp    1e0a <struct_end+0x5a>
+    1e95:	66 90                	xchg   %ax,%ax
+    1e97:	66 90                	xchg   %ax,%ax
+    1e99:	66 90                	xchg   %ax,%ax
+    1e9b:	66 90                	xchg   %ax,%ax
+    1e9d:	66 90                	xchg   %ax,%ax
+    1e9f:	90                   	nop
+
+00001ea0 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+    1ea0:	55                   	push   %ebp
+    1ea1:	89 e5                	mov    %esp,%ebp
+    1ea3:	56                   	push   %esi
+    1ea4:	89 c6                	mov    %eax,%esi
+    1ea6:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+    1ea7:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+    1ead:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+    1eb3:	6a 01                	push   $0x1
+    1eb5:	53                   	push   %ebx
+    1eb6:	e8 05 fc ff ff       	call   1ac0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    1ebb:	83 c4 0c             	add    $0xc,%esp
+    1ebe:	56                   	push   %esi
+    1ebf:	68 15 21 00 00       	push   $0x2115
+    1ec4:	53                   	push   %ebx
+    1ec5:	e8 26 fc ff ff       	call   1af0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+    1eca:	83 c4 0c             	add    $0xc,%esp
+    1ecd:	68 56 24 00 00       	push   $0x2456
+    1ed2:	68 67 24 00 00       	push   $0x2467
+    1ed7:	53                   	push   %ebx
+    1ed8:	e8 13 fc ff ff       	call   1af0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+    1edd:	83 c4 0c             	add    $0xc,%esp
+    1ee0:	68 ea 07 00 00       	push   $0x7ea
+    1ee5:	68 6e 24 00 00       	push   $0x246e
+    1eea:	53                   	push   %ebx
+    1eeb:	e8 d0 fd ff ff       	call   1cc0 <struct_field_int>
+  struct_end(&w);
+    1ef0:	89 1c 24             	mov    %ebx,(%esp)
+    1ef3:	e8 b8 fe ff ff       	call   1db0 <struct_end>
+    1ef8:	83 c4 10             	add    $0x10,%esp
+}
+    1efb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1efe:	5b                   	pop    %ebx
+    1eff:	5e                   	pop    %esi
+    1f00:	5d                   	pop    %ebp
+    1f01:	c3                   	ret
+    1f02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001f10 <modern_consume_flags>:
+{
+    1f10:	55                   	push   %ebp
+    1f11:	89 e5                	mov    %esp,%ebp
+    1f13:	57                   	push   %edi
+    1f14:	56                   	push   %esi
+    1f15:	53                   	push   %ebx
+    1f16:	83 ec 0c             	sub    $0xc,%esp
+    1f19:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+    1f1c:	85 f6                	test   %esi,%esi
+    1f1e:	74 06                	je     1f26 <modern_consume_flags+0x16>
+    *json_mode = 0;
+    1f20:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+    1f26:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+    1f2a:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f2f:	7e 4c                	jle    1f7d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+    1f31:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+    1f34:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+    1f37:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+    1f3a:	68 45 22 00 00       	push   $0x2245
+    1f3f:	53                   	push   %ebx
+    1f40:	e8 5b f3 ff ff       	call   12a0 <strcmp>
+    1f45:	83 c4 10             	add    $0x10,%esp
+    1f48:	85 c0                	test   %eax,%eax
+    1f4a:	74 58                	je     1fa4 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+    1f4c:	8b 45 14             	mov    0x14(%ebp),%eax
+    1f4f:	85 c0                	test   %eax,%eax
+    1f51:	74 2a                	je     1f7d <modern_consume_flags+0x6d>
+    1f53:	83 ec 08             	sub    $0x8,%esp
+    1f56:	68 81 24 00 00       	push   $0x2481
+    1f5b:	53                   	push   %ebx
+    1f5c:	e8 3f f3 ff ff       	call   12a0 <strcmp>
+    1f61:	83 c4 10             	add    $0x10,%esp
+    1f64:	85 c0                	test   %eax,%eax
+    1f66:	74 28                	je     1f90 <modern_consume_flags+0x80>
+    1f68:	83 ec 08             	sub    $0x8,%esp
+    1f6b:	68 84 24 00 00       	push   $0x2484
+    1f70:	53                   	push   %ebx
+    1f71:	e8 2a f3 ff ff       	call   12a0 <strcmp>
+    1f76:	83 c4 10             	add    $0x10,%esp
+    1f79:	85 c0                	test   %eax,%eax
+    1f7b:	74 13                	je     1f90 <modern_consume_flags+0x80>
+}
+    1f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f80:	89 f8                	mov    %edi,%eax
+    1f82:	5b                   	pop    %ebx
+    1f83:	5e                   	pop    %esi
+    1f84:	5f                   	pop    %edi
+    1f85:	5d                   	pop    %ebp
+    1f86:	c3                   	ret
+    1f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+    1f90:	85 f6                	test   %esi,%esi
+    1f92:	74 06                	je     1f9a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+    1f94:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+    1f9a:	83 c7 01             	add    $0x1,%edi
+    1f9d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+    1fa0:	75 8f                	jne    1f31 <modern_consume_flags+0x21>
+    1fa2:	eb d9                	jmp    1f7d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+    1fa4:	85 f6                	test   %esi,%esi
+    1fa6:	74 12                	je     1fba <modern_consume_flags+0xaa>
+  if(!json_mode){
+    1fa8:	83 3e 00             	cmpl   $0x0,(%esi)
+    1fab:	74 0d                	je     1fba <modern_consume_flags+0xaa>
+    1fad:	8b 45 08             	mov    0x8(%ebp),%eax
+    1fb0:	e8 eb fe ff ff       	call   1ea0 <modern_print_version.part.0>
+      exit();
+    1fb5:	e8 f9 f4 ff ff       	call   14b3 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    1fba:	83 ec 0c             	sub    $0xc,%esp
+    1fbd:	68 ea 07 00 00       	push   $0x7ea
+    1fc2:	68 56 24 00 00       	push   $0x2456
+    1fc7:	ff 75 08             	push   0x8(%ebp)
+    1fca:	68 73 24 00 00       	push   $0x2473
+    1fcf:	6a 01                	push   $0x1
+    1fd1:	e8 8a f6 ff ff       	call   1660 <printf>
+}
+    1fd6:	83 c4 20             	add    $0x20,%esp
+    1fd9:	eb da                	jmp    1fb5 <modern_consume_flags+0xa5>
+    1fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1fdf:	90                   	nop
+
+00001fe0 <modern_print_version>:
+{
+    1fe0:	55                   	push   %ebp
+    1fe1:	89 e5                	mov    %esp,%ebp
+    1fe3:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    1fe6:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    1fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    1fec:	85 d2                	test   %edx,%edx
+    1fee:	74 10                	je     2000 <modern_print_version+0x20>
+}
+    1ff0:	c9                   	leave
+    1ff1:	e9 aa fe ff ff       	jmp    1ea0 <modern_print_version.part.0>
+    1ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ffd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    2000:	83 ec 0c             	sub    $0xc,%esp
+    2003:	68 ea 07 00 00       	push   $0x7ea
+    2008:	68 56 24 00 00       	push   $0x2456
+    200d:	50                   	push   %eax
+    200e:	68 73 24 00 00       	push   $0x2473
+    2013:	6a 01                	push   $0x1
+    2015:	e8 46 f6 ff ff       	call   1660 <printf>
+}
+    201a:	83 c4 20             	add    $0x20,%esp
+}
+    201d:	c9                   	leave
+    201e:	c3                   	ret
+    201f:	90                   	nop
+
+00002020 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    2020:	55                   	push   %ebp
+    2021:	89 e5                	mov    %esp,%ebp
+    2023:	57                   	push   %edi
+    2024:	56                   	push   %esi
+    2025:	53                   	push   %ebx
+    2026:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    202c:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    202f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    2032:	8b 45 10             	mov    0x10(%ebp),%eax
+    2035:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    2038:	85 d2                	test   %edx,%edx
+    203a:	75 44                	jne    2080 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    203c:	85 f6                	test   %esi,%esi
+    203e:	ba 8b 24 00 00       	mov    $0x248b,%edx
+    2043:	0f 44 f2             	cmove  %edx,%esi
+    2046:	85 c0                	test   %eax,%eax
+    2048:	ba 38 21 00 00       	mov    $0x2138,%edx
+    204d:	0f 44 c2             	cmove  %edx,%eax
+    2050:	85 db                	test   %ebx,%ebx
+    2052:	ba 90 24 00 00       	mov    $0x2490,%edx
+    2057:	0f 44 da             	cmove  %edx,%ebx
+    205a:	83 ec 08             	sub    $0x8,%esp
+    205d:	56                   	push   %esi
+    205e:	50                   	push   %eax
+    205f:	53                   	push   %ebx
+    2060:	ff 75 08             	push   0x8(%ebp)
+    2063:	68 96 24 00 00       	push   $0x2496
+    2068:	6a 01                	push   $0x1
+    206a:	e8 f1 f5 ff ff       	call   1660 <printf>
+    206f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    2072:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2075:	5b                   	pop    %ebx
+    2076:	5e                   	pop    %esi
+    2077:	5f                   	pop    %edi
+    2078:	5d                   	pop    %ebp
+    2079:	c3                   	ret
+    207a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    2080:	83 ec 08             	sub    $0x8,%esp
+    2083:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    2089:	89 45 10             	mov    %eax,0x10(%ebp)
+    208c:	6a 01                	push   $0x1
+    208e:	57                   	push   %edi
+    208f:	e8 2c fa ff ff       	call   1ac0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    2094:	83 c4 0c             	add    $0xc,%esp
+    2097:	ff 75 08             	push   0x8(%ebp)
+    209a:	68 15 21 00 00       	push   $0x2115
+    209f:	57                   	push   %edi
+    20a0:	e8 4b fa ff ff       	call   1af0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    20a5:	83 c4 0c             	add    $0xc,%esp
+    20a8:	ba 90 24 00 00       	mov    $0x2490,%edx
+    20ad:	85 db                	test   %ebx,%ebx
+    20af:	0f 44 da             	cmove  %edx,%ebx
+    20b2:	53                   	push   %ebx
+    20b3:	52                   	push   %edx
+    20b4:	57                   	push   %edi
+    20b5:	e8 36 fa ff ff       	call   1af0 <struct_field_str>
+  if(target)
+    20ba:	8b 45 10             	mov    0x10(%ebp),%eax
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	74 12                	je     20d6 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    20c4:	83 ec 04             	sub    $0x4,%esp
+    20c7:	50                   	push   %eax
+    20c8:	68 a4 24 00 00       	push   $0x24a4
+    20cd:	57                   	push   %edi
+    20ce:	e8 1d fa ff ff       	call   1af0 <struct_field_str>
+    20d3:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    20d6:	85 f6                	test   %esi,%esi
+    20d8:	74 12                	je     20ec <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    20da:	83 ec 04             	sub    $0x4,%esp
+    20dd:	56                   	push   %esi
+    20de:	68 ab 24 00 00       	push   $0x24ab
+    20e3:	57                   	push   %edi
+    20e4:	e8 07 fa ff ff       	call   1af0 <struct_field_str>
+    20e9:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    20ec:	83 ec 0c             	sub    $0xc,%esp
+    20ef:	57                   	push   %edi
+    20f0:	e8 bb fc ff ff       	call   1db0 <struct_end>
+    20f5:	83 c4 10             	add    $0x10,%esp
+}
+    20f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20fb:	5b                   	pop    %ebx
+    20fc:	5e                   	pop    %esi
+    20fd:	5f                   	pop    %edi
+    20fe:	5d                   	pop    %ebp
+    20ff:	c3                   	ret
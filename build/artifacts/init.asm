@@ -0,0 +1,2165 @@
+
+build/bin/user/_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "hello", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 80 0f 00 00       	push   $0xf80
+  19:	e8 55 03 00 00       	call   373 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 78 03 00 00       	call   3ab <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 6c 03 00 00       	call   3ab <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting hello\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 88 0f 00 00       	push   $0xf88
+  50:	6a 01                	push   $0x1
+  52:	e8 89 04 00 00       	call   4e0 <printf>
+    pid = fork();
+  57:	e8 cf 02 00 00       	call   32b <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("bin/hello", argv);
+      printf(1, "init: exec hello failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 c6 02 00 00       	call   33b <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 d4 0f 00 00       	push   $0xfd4
+  85:	6a 01                	push   $0x1
+  87:	e8 54 04 00 00       	call   4e0 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 9e 0f 00 00       	push   $0xf9e
+  98:	6a 01                	push   $0x1
+  9a:	e8 41 04 00 00       	call   4e0 <printf>
+      exit();
+  9f:	e8 8f 02 00 00       	call   333 <exit>
+      exec("bin/hello", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 58 15 00 00       	push   $0x1558
+  ab:	68 b1 0f 00 00       	push   $0xfb1
+  b0:	e8 b6 02 00 00       	call   36b <exec>
+      printf(1, "init: exec hello failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 bb 0f 00 00       	push   $0xfbb
+  bc:	6a 01                	push   $0x1
+  be:	e8 1d 04 00 00       	call   4e0 <printf>
+      exit();
+  c3:	e8 6b 02 00 00       	call   333 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 80 0f 00 00       	push   $0xf80
+  d2:	e8 a4 02 00 00       	call   37b <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 80 0f 00 00       	push   $0xf80
+  e0:	e8 8e 02 00 00       	call   373 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 1e 01 00 00       	call   34b <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 f1 00 00 00       	call   373 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 f4 00 00 00       	call   38b <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 ba 00 00 00       	call   35b <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+
+0000032b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 32b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <exit>:
+SYSCALL(exit)
+ 333:	b8 02 00 00 00       	mov    $0x2,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <wait>:
+SYSCALL(wait)
+ 33b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <pipe>:
+SYSCALL(pipe)
+ 343:	b8 04 00 00 00       	mov    $0x4,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <read>:
+SYSCALL(read)
+ 34b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <write>:
+SYSCALL(write)
+ 353:	b8 10 00 00 00       	mov    $0x10,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <close>:
+SYSCALL(close)
+ 35b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <kill>:
+SYSCALL(kill)
+ 363:	b8 06 00 00 00       	mov    $0x6,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <exec>:
+SYSCALL(exec)
+ 36b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <open>:
+SYSCALL(open)
+ 373:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <mknod>:
+SYSCALL(mknod)
+ 37b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <unlink>:
+SYSCALL(unlink)
+ 383:	b8 12 00 00 00       	mov    $0x12,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <fstat>:
+SYSCALL(fstat)
+ 38b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <link>:
+SYSCALL(link)
+ 393:	b8 13 00 00 00       	mov    $0x13,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <mkdir>:
+SYSCALL(mkdir)
+ 39b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <chdir>:
+SYSCALL(chdir)
+ 3a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <dup>:
+SYSCALL(dup)
+ 3ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <getpid>:
+SYSCALL(getpid)
+ 3b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <sbrk>:
+SYSCALL(sbrk)
+ 3bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <sleep>:
+SYSCALL(sleep)
+ 3c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <uptime>:
+SYSCALL(uptime)
+ 3cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <poll>:
+SYSCALL(poll)
+ 3d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <fcntl>:
+SYSCALL(fcntl)
+ 3db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <lseek>:
+SYSCALL(lseek)
+ 3e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <pread>:
+SYSCALL(pread)
+ 3eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <pwrite>:
+SYSCALL(pwrite)
+ 3f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <readv>:
+SYSCALL(readv)
+ 3fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <writev>:
+SYSCALL(writev)
+ 403:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <getdents>:
+SYSCALL(getdents)
+ 40b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <splice>:
+SYSCALL(splice)
+ 413:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 41b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 423:	b8 20 00 00 00       	mov    $0x20,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <batch>:
+SYSCALL(batch)
+ 42b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+ 433:	66 90                	xchg   %ax,%ax
+ 435:	66 90                	xchg   %ax,%ax
+ 437:	66 90                	xchg   %ax,%ax
+ 439:	66 90                	xchg   %ax,%ax
+ 43b:	66 90                	xchg   %ax,%ax
+ 43d:	66 90                	xchg   %ax,%ax
+ 43f:	90                   	nop
+
+00000440 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 448:	89 d1                	mov    %edx,%ecx
+{
+ 44a:	83 ec 3c             	sub    $0x3c,%esp
+ 44d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 450:	85 d2                	test   %edx,%edx
+ 452:	0f 89 80 00 00 00    	jns    4d8 <printint+0x98>
+ 458:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 45c:	74 7a                	je     4d8 <printint+0x98>
+    x = -xx;
+ 45e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 460:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 465:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 468:	31 f6                	xor    %esi,%esi
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 470:	89 c8                	mov    %ecx,%eax
+ 472:	31 d2                	xor    %edx,%edx
+ 474:	89 f7                	mov    %esi,%edi
+ 476:	f7 f3                	div    %ebx
+ 478:	8d 76 01             	lea    0x1(%esi),%esi
+ 47b:	0f b6 92 3c 10 00 00 	movzbl 0x103c(%edx),%edx
+ 482:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 486:	89 ca                	mov    %ecx,%edx
+ 488:	89 c1                	mov    %eax,%ecx
+ 48a:	39 da                	cmp    %ebx,%edx
+ 48c:	73 e2                	jae    470 <printint+0x30>
+  if(neg)
+ 48e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 491:	85 c0                	test   %eax,%eax
+ 493:	74 07                	je     49c <printint+0x5c>
+    buf[i++] = '-';
+ 495:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 49a:	89 f7                	mov    %esi,%edi
+ 49c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 49f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4a2:	01 df                	add    %ebx,%edi
+ 4a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4ab:	83 ec 04             	sub    $0x4,%esp
+ 4ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4b4:	6a 01                	push   $0x1
+ 4b6:	50                   	push   %eax
+ 4b7:	56                   	push   %esi
+ 4b8:	e8 96 fe ff ff       	call   353 <write>
+  while(--i >= 0)
+ 4bd:	89 f8                	mov    %edi,%eax
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	83 ef 01             	sub    $0x1,%edi
+ 4c5:	39 d8                	cmp    %ebx,%eax
+ 4c7:	75 df                	jne    4a8 <printint+0x68>
+}
+ 4c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cc:	5b                   	pop    %ebx
+ 4cd:	5e                   	pop    %esi
+ 4ce:	5f                   	pop    %edi
+ 4cf:	5d                   	pop    %ebp
+ 4d0:	c3                   	ret
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4d8:	31 c0                	xor    %eax,%eax
+ 4da:	eb 89                	jmp    465 <printint+0x25>
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f2:	83 c6 01             	add    $0x1,%esi
+ 4f5:	84 db                	test   %bl,%bl
+ 4f7:	74 67                	je     560 <printf+0x80>
+ 4f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4fc:	31 d2                	xor    %edx,%edx
+ 4fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 501:	eb 34                	jmp    537 <printf+0x57>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+ 508:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 50b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 510:	83 f8 25             	cmp    $0x25,%eax
+ 513:	74 18                	je     52d <printf+0x4d>
+  write(fd, &c, 1);
+ 515:	83 ec 04             	sub    $0x4,%esp
+ 518:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 51b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51e:	6a 01                	push   $0x1
+ 520:	50                   	push   %eax
+ 521:	57                   	push   %edi
+ 522:	e8 2c fe ff ff       	call   353 <write>
+ 527:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 52a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 52d:	0f b6 1e             	movzbl (%esi),%ebx
+ 530:	83 c6 01             	add    $0x1,%esi
+ 533:	84 db                	test   %bl,%bl
+ 535:	74 29                	je     560 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 537:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 53a:	85 d2                	test   %edx,%edx
+ 53c:	74 ca                	je     508 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 53e:	83 fa 25             	cmp    $0x25,%edx
+ 541:	75 ea                	jne    52d <printf+0x4d>
+      if(c == 'd'){
+ 543:	83 f8 25             	cmp    $0x25,%eax
+ 546:	0f 84 24 01 00 00    	je     670 <printf+0x190>
+ 54c:	83 e8 63             	sub    $0x63,%eax
+ 54f:	83 f8 15             	cmp    $0x15,%eax
+ 552:	77 1c                	ja     570 <printf+0x90>
+ 554:	ff 24 85 e4 0f 00 00 	jmp    *0xfe4(,%eax,4)
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 563:	5b                   	pop    %ebx
+ 564:	5e                   	pop    %esi
+ 565:	5f                   	pop    %edi
+ 566:	5d                   	pop    %ebp
+ 567:	c3                   	ret
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 576:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 57a:	6a 01                	push   $0x1
+ 57c:	52                   	push   %edx
+ 57d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 580:	57                   	push   %edi
+ 581:	e8 cd fd ff ff       	call   353 <write>
+ 586:	83 c4 0c             	add    $0xc,%esp
+ 589:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58c:	6a 01                	push   $0x1
+ 58e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 591:	52                   	push   %edx
+ 592:	57                   	push   %edi
+ 593:	e8 bb fd ff ff       	call   353 <write>
+        putc(fd, c);
+ 598:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59b:	31 d2                	xor    %edx,%edx
+ 59d:	eb 8e                	jmp    52d <printf+0x4d>
+ 59f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5ab:	8b 13                	mov    (%ebx),%edx
+ 5ad:	6a 00                	push   $0x0
+ 5af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5b4:	e8 87 fe ff ff       	call   440 <printint>
+        ap++;
+ 5b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bf:	31 d2                	xor    %edx,%edx
+ 5c1:	e9 67 ff ff ff       	jmp    52d <printf+0x4d>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5d5:	83 c0 04             	add    $0x4,%eax
+ 5d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5db:	85 db                	test   %ebx,%ebx
+ 5dd:	0f 84 9d 00 00 00    	je     680 <printf+0x1a0>
+        while(*s != 0){
+ 5e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	0f 84 3d ff ff ff    	je     52d <printf+0x4d>
+ 5f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5f6:	89 de                	mov    %ebx,%esi
+ 5f8:	89 d3                	mov    %edx,%ebx
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 606:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	53                   	push   %ebx
+ 60c:	57                   	push   %edi
+ 60d:	e8 41 fd ff ff       	call   353 <write>
+        while(*s != 0){
+ 612:	0f b6 06             	movzbl (%esi),%eax
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	84 c0                	test   %al,%al
+ 61a:	75 e4                	jne    600 <printf+0x120>
+      state = 0;
+ 61c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 07 ff ff ff       	jmp    52d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 630:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 63b:	8b 13                	mov    (%ebx),%edx
+ 63d:	6a 01                	push   $0x1
+ 63f:	e9 6b ff ff ff       	jmp    5af <printf+0xcf>
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 648:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 651:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 653:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 656:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	52                   	push   %edx
+ 65c:	57                   	push   %edi
+ 65d:	e8 f1 fc ff ff       	call   353 <write>
+        ap++;
+ 662:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 665:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 668:	31 d2                	xor    %edx,%edx
+ 66a:	e9 be fe ff ff       	jmp    52d <printf+0x4d>
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 676:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 679:	6a 01                	push   $0x1
+ 67b:	e9 11 ff ff ff       	jmp    591 <printf+0xb1>
+ 680:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 685:	bb dd 0f 00 00       	mov    $0xfdd,%ebx
+ 68a:	e9 61 ff ff ff       	jmp    5f0 <printf+0x110>
+ 68f:	90                   	nop
+
+00000690 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 690:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 691:	a1 60 15 00 00       	mov    0x1560,%eax
+{
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	57                   	push   %edi
+ 699:	56                   	push   %esi
+ 69a:	53                   	push   %ebx
+ 69b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 69e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ac:	39 ca                	cmp    %ecx,%edx
+ 6ae:	73 30                	jae    6e0 <free+0x50>
+ 6b0:	39 c1                	cmp    %eax,%ecx
+ 6b2:	72 04                	jb     6b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b4:	39 c2                	cmp    %eax,%edx
+ 6b6:	72 f0                	jb     6a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6be:	39 f8                	cmp    %edi,%eax
+ 6c0:	74 2e                	je     6f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6cb:	39 f1                	cmp    %esi,%ecx
+ 6cd:	74 38                	je     707 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6d1:	5b                   	pop    %ebx
+  freep = p;
+ 6d2:	89 15 60 15 00 00    	mov    %edx,0x1560
+}
+ 6d8:	5e                   	pop    %esi
+ 6d9:	5f                   	pop    %edi
+ 6da:	5d                   	pop    %ebp
+ 6db:	c3                   	ret
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e0:	39 c1                	cmp    %eax,%ecx
+ 6e2:	72 d0                	jb     6b4 <free+0x24>
+ 6e4:	eb c2                	jmp    6a8 <free+0x18>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6f0:	03 70 04             	add    0x4(%eax),%esi
+ 6f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6f6:	8b 02                	mov    (%edx),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 700:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 703:	39 f1                	cmp    %esi,%ecx
+ 705:	75 c8                	jne    6cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 707:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 70a:	89 15 60 15 00 00    	mov    %edx,0x1560
+    p->s.size += bp->s.size;
+ 710:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 713:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 716:	89 0a                	mov    %ecx,(%edx)
+}
+ 718:	5b                   	pop    %ebx
+ 719:	5e                   	pop    %esi
+ 71a:	5f                   	pop    %edi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000720 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 72c:	8b 15 60 15 00 00    	mov    0x1560,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 732:	8d 78 07             	lea    0x7(%eax),%edi
+ 735:	c1 ef 03             	shr    $0x3,%edi
+ 738:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 73b:	85 d2                	test   %edx,%edx
+ 73d:	0f 84 8d 00 00 00    	je     7d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 743:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 745:	8b 48 04             	mov    0x4(%eax),%ecx
+ 748:	39 f9                	cmp    %edi,%ecx
+ 74a:	73 64                	jae    7b0 <malloc+0x90>
+  if(nu < 4096)
+ 74c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 751:	39 df                	cmp    %ebx,%edi
+ 753:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 756:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 75d:	eb 0a                	jmp    769 <malloc+0x49>
+ 75f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 760:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 762:	8b 48 04             	mov    0x4(%eax),%ecx
+ 765:	39 f9                	cmp    %edi,%ecx
+ 767:	73 47                	jae    7b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 769:	89 c2                	mov    %eax,%edx
+ 76b:	39 05 60 15 00 00    	cmp    %eax,0x1560
+ 771:	75 ed                	jne    760 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	56                   	push   %esi
+ 777:	e8 3f fc ff ff       	call   3bb <sbrk>
+  if(p == (char*)-1)
+ 77c:	83 c4 10             	add    $0x10,%esp
+ 77f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 782:	74 1c                	je     7a0 <malloc+0x80>
+  hp->s.size = nu;
+ 784:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 787:	83 ec 0c             	sub    $0xc,%esp
+ 78a:	83 c0 08             	add    $0x8,%eax
+ 78d:	50                   	push   %eax
+ 78e:	e8 fd fe ff ff       	call   690 <free>
+  return freep;
+ 793:	8b 15 60 15 00 00    	mov    0x1560,%edx
+      if((p = morecore(nunits)) == 0)
+ 799:	83 c4 10             	add    $0x10,%esp
+ 79c:	85 d2                	test   %edx,%edx
+ 79e:	75 c0                	jne    760 <malloc+0x40>
+        return 0;
+  }
+}
+ 7a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7a3:	31 c0                	xor    %eax,%eax
+}
+ 7a5:	5b                   	pop    %ebx
+ 7a6:	5e                   	pop    %esi
+ 7a7:	5f                   	pop    %edi
+ 7a8:	5d                   	pop    %ebp
+ 7a9:	c3                   	ret
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7b0:	39 cf                	cmp    %ecx,%edi
+ 7b2:	74 4c                	je     800 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7b4:	29 f9                	sub    %edi,%ecx
+ 7b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7bf:	89 15 60 15 00 00    	mov    %edx,0x1560
+}
+ 7c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7c8:	83 c0 08             	add    $0x8,%eax
+}
+ 7cb:	5b                   	pop    %ebx
+ 7cc:	5e                   	pop    %esi
+ 7cd:	5f                   	pop    %edi
+ 7ce:	5d                   	pop    %ebp
+ 7cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7d0:	c7 05 60 15 00 00 64 	movl   $0x1564,0x1560
+ 7d7:	15 00 00 
+    base.s.size = 0;
+ 7da:	b8 64 15 00 00       	mov    $0x1564,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7df:	c7 05 64 15 00 00 64 	movl   $0x1564,0x1564
+ 7e6:	15 00 00 
+    base.s.size = 0;
+ 7e9:	c7 05 68 15 00 00 00 	movl   $0x0,0x1568
+ 7f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7f3:	e9 54 ff ff ff       	jmp    74c <malloc+0x2c>
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 800:	8b 08                	mov    (%eax),%ecx
+ 802:	89 0a                	mov    %ecx,(%edx)
+ 804:	eb b9                	jmp    7bf <malloc+0x9f>
+ 806:	66 90                	xchg   %ax,%ax
+ 808:	66 90                	xchg   %ax,%ax
+ 80a:	66 90                	xchg   %ax,%ax
+ 80c:	66 90                	xchg   %ax,%ax
+ 80e:	66 90                	xchg   %ax,%ax
+
+00000810 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 1c             	sub    $0x1c,%esp
+ 819:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+ 81c:	85 c9                	test   %ecx,%ecx
+ 81e:	7e 51                	jle    871 <put+0x61>
+ 820:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+ 822:	8b 40 08             	mov    0x8(%eax),%eax
+ 825:	89 ce                	mov    %ecx,%esi
+ 827:	85 c0                	test   %eax,%eax
+ 829:	7e 55                	jle    880 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+ 82b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+ 82e:	8b 51 0c             	mov    0xc(%ecx),%edx
+ 831:	8b 79 08             	mov    0x8(%ecx),%edi
+ 834:	01 d7                	add    %edx,%edi
+ 836:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 839:	74 65                	je     8a0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+ 83b:	83 f8 20             	cmp    $0x20,%eax
+ 83e:	75 40                	jne    880 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 43 10             	lea    0x10(%ebx),%eax
+ 846:	6a 20                	push   $0x20
+ 848:	50                   	push   %eax
+ 849:	ff 33                	push   (%ebx)
+ 84b:	e8 b3 fb ff ff       	call   403 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+ 850:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+ 853:	31 c0                	xor    %eax,%eax
+ 855:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 85a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+ 85d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 864:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ 867:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ 86a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+ 86e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 871:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 874:	5b                   	pop    %ebx
+ 875:	5e                   	pop    %esi
+ 876:	5f                   	pop    %edi
+ 877:	5d                   	pop    %ebp
+ 878:	c3                   	ret
+ 879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+ 880:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+ 883:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 886:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+ 889:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+ 88d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+ 890:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 893:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 896:	5b                   	pop    %ebx
+ 897:	5e                   	pop    %esi
+ 898:	5f                   	pop    %edi
+ 899:	5d                   	pop    %ebp
+ 89a:	c3                   	ret
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+      last->iov_len += n;
+ 8a0:	01 f2                	add    %esi,%edx
+ 8a2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+ 8a5:	eb ca                	jmp    871 <put+0x61>
+ 8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	89 d7                	mov    %edx,%edi
+ 8b6:	56                   	push   %esi
+ 8b7:	89 ce                	mov    %ecx,%esi
+ 8b9:	53                   	push   %ebx
+ 8ba:	89 c3                	mov    %eax,%ebx
+ 8bc:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+ 8bf:	8b 40 0c             	mov    0xc(%eax),%eax
+ 8c2:	8b 53 08             	mov    0x8(%ebx),%edx
+ 8c5:	01 c1                	add    %eax,%ecx
+ 8c7:	83 f9 40             	cmp    $0x40,%ecx
+ 8ca:	7f 3c                	jg     908 <putcopy+0x58>
+ 8cc:	83 fa 20             	cmp    $0x20,%edx
+ 8cf:	74 3f                	je     910 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+ 8d1:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+ 8d7:	83 ec 04             	sub    $0x4,%esp
+ 8da:	01 d0                	add    %edx,%eax
+ 8dc:	56                   	push   %esi
+ 8dd:	57                   	push   %edi
+ 8de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 8e1:	50                   	push   %eax
+ 8e2:	e8 19 fa ff ff       	call   300 <memmove>
+  put(w, w->buf + w->nbuf, n);
+ 8e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 8ea:	89 f1                	mov    %esi,%ecx
+ 8ec:	03 53 0c             	add    0xc(%ebx),%edx
+ 8ef:	89 d8                	mov    %ebx,%eax
+ 8f1:	e8 1a ff ff ff       	call   810 <put>
+  w->nbuf += n;
+ 8f6:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+ 8f9:	83 c4 10             	add    $0x10,%esp
+ 8fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ff:	5b                   	pop    %ebx
+ 900:	5e                   	pop    %esi
+ 901:	5f                   	pop    %edi
+ 902:	5d                   	pop    %ebp
+ 903:	c3                   	ret
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+ 908:	85 d2                	test   %edx,%edx
+ 90a:	7e 16                	jle    922 <putcopy+0x72>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	8d 43 10             	lea    0x10(%ebx),%eax
+ 916:	52                   	push   %edx
+ 917:	50                   	push   %eax
+ 918:	ff 33                	push   (%ebx)
+ 91a:	e8 e4 fa ff ff       	call   403 <writev>
+ 91f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+ 922:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 929:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+ 92b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 932:	eb 9d                	jmp    8d1 <putcopy+0x21>
+ 934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+
+00000940 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+ 946:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+ 949:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+ 950:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+ 952:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+ 959:	c7 40 10 4d 10 00 00 	movl   $0x104d,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+ 960:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+ 967:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+ 96e:	5d                   	pop    %ebp
+ 96f:	c3                   	ret
+
+00000970 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 1c             	sub    $0x1c,%esp
+ 979:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 97c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 97f:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+ 982:	8b 47 04             	mov    0x4(%edi),%eax
+ 985:	85 c0                	test   %eax,%eax
+ 987:	0f 85 7b 01 00 00    	jne    b08 <struct_field_str+0x198>
+    w->need_comma = 1;
+ 98d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ 994:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 999:	ba 62 10 00 00       	mov    $0x1062,%edx
+ 99e:	89 f8                	mov    %edi,%eax
+ 9a0:	e8 6b fe ff ff       	call   810 <put>
+  put_str(w, key ? key : "");
+ 9a5:	85 db                	test   %ebx,%ebx
+ 9a7:	b8 dc 0f 00 00       	mov    $0xfdc,%eax
+ 9ac:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ 9af:	83 ec 0c             	sub    $0xc,%esp
+ 9b2:	53                   	push   %ebx
+ 9b3:	e8 c8 f7 ff ff       	call   180 <strlen>
+ 9b8:	89 da                	mov    %ebx,%edx
+ 9ba:	89 c1                	mov    %eax,%ecx
+ 9bc:	89 f8                	mov    %edi,%eax
+ 9be:	e8 4d fe ff ff       	call   810 <put>
+  put(w, "\":\"", 3);
+ 9c3:	b9 03 00 00 00       	mov    $0x3,%ecx
+ 9c8:	ba 60 10 00 00       	mov    $0x1060,%edx
+ 9cd:	89 f8                	mov    %edi,%eax
+ 9cf:	e8 3c fe ff ff       	call   810 <put>
+  put_escaped(w, value ? value : "");
+ 9d4:	83 c4 10             	add    $0x10,%esp
+ 9d7:	85 f6                	test   %esi,%esi
+ 9d9:	0f 84 41 01 00 00    	je     b20 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+ 9df:	0f b6 1e             	movzbl (%esi),%ebx
+ 9e2:	89 f2                	mov    %esi,%edx
+ 9e4:	84 db                	test   %bl,%bl
+ 9e6:	0f 84 40 01 00 00    	je     b2c <struct_field_str+0x1bc>
+ 9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 9f0:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+ 9f2:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+ 9f5:	80 fb 0d             	cmp    $0xd,%bl
+ 9f8:	74 7e                	je     a78 <struct_field_str+0x108>
+ 9fa:	7f 5c                	jg     a58 <struct_field_str+0xe8>
+ 9fc:	80 fb 09             	cmp    $0x9,%bl
+ 9ff:	0f 84 eb 00 00 00    	je     af0 <struct_field_str+0x180>
+ a05:	80 fb 0a             	cmp    $0xa,%bl
+ a08:	0f 85 95 00 00 00    	jne    aa3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ a0e:	29 d1                	sub    %edx,%ecx
+ a10:	89 f8                	mov    %edi,%eax
+ a12:	e8 f9 fd ff ff       	call   810 <put>
+      esc = "\\n";
+ a17:	ba 5b 10 00 00       	mov    $0x105b,%edx
+      put(w, esc, 2);
+ a1c:	b9 02 00 00 00       	mov    $0x2,%ecx
+ a21:	89 f8                	mov    %edi,%eax
+ a23:	e8 e8 fd ff ff       	call   810 <put>
+    run = s + 1;
+ a28:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+ a2a:	0f b6 1e             	movzbl (%esi),%ebx
+ a2d:	84 db                	test   %bl,%bl
+ a2f:	75 bf                	jne    9f0 <struct_field_str+0x80>
+  put(w, run, s - run);
+ a31:	29 d6                	sub    %edx,%esi
+ a33:	89 f1                	mov    %esi,%ecx
+ a35:	89 f8                	mov    %edi,%eax
+ a37:	e8 d4 fd ff ff       	call   810 <put>
+  put(w, "\"", 1);
+}
+ a3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+ a3f:	89 f8                	mov    %edi,%eax
+ a41:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+ a46:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+ a47:	ba 62 10 00 00       	mov    $0x1062,%edx
+}
+ a4c:	5e                   	pop    %esi
+ a4d:	5f                   	pop    %edi
+ a4e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+ a4f:	e9 bc fd ff ff       	jmp    810 <put>
+ a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ a58:	80 fb 22             	cmp    $0x22,%bl
+ a5b:	74 33                	je     a90 <struct_field_str+0x120>
+ a5d:	80 fb 5c             	cmp    $0x5c,%bl
+ a60:	75 41                	jne    aa3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ a62:	29 d1                	sub    %edx,%ecx
+ a64:	89 f8                	mov    %edi,%eax
+ a66:	e8 a5 fd ff ff       	call   810 <put>
+      esc = "\\\\";
+ a6b:	ba 4f 10 00 00       	mov    $0x104f,%edx
+ a70:	eb aa                	jmp    a1c <struct_field_str+0xac>
+ a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+ a78:	29 d1                	sub    %edx,%ecx
+ a7a:	89 f8                	mov    %edi,%eax
+ a7c:	e8 8f fd ff ff       	call   810 <put>
+      esc = "\\r";
+ a81:	ba 58 10 00 00       	mov    $0x1058,%edx
+ a86:	eb 94                	jmp    a1c <struct_field_str+0xac>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+    put(w, run, s - run);
+ a90:	29 d1                	sub    %edx,%ecx
+ a92:	89 f8                	mov    %edi,%eax
+ a94:	e8 77 fd ff ff       	call   810 <put>
+      esc = "\\\"";
+ a99:	ba 52 10 00 00       	mov    $0x1052,%edx
+ a9e:	e9 79 ff ff ff       	jmp    a1c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+ aa3:	80 fb 1f             	cmp    $0x1f,%bl
+ aa6:	77 82                	ja     a2a <struct_field_str+0xba>
+    put(w, run, s - run);
+ aa8:	29 d1                	sub    %edx,%ecx
+ aaa:	89 f8                	mov    %edi,%eax
+ aac:	e8 5f fd ff ff       	call   810 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+ ab1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+ ab3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+ ab6:	0f b7 05 7c 10 00 00 	movzwl 0x107c,%eax
+ abd:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+ ac0:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+ ac5:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+ acc:	0f b6 d2             	movzbl %dl,%edx
+ acf:	8a 82 64 10 00 00    	mov    0x1064(%edx),%al
+ ad5:	8a a3 64 10 00 00    	mov    0x1064(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+ adb:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+ ade:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+ ae2:	89 f8                	mov    %edi,%eax
+ ae4:	e8 c7 fd ff ff       	call   8b0 <putcopy>
+ ae9:	e9 3a ff ff ff       	jmp    a28 <struct_field_str+0xb8>
+ aee:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+ af0:	29 d1                	sub    %edx,%ecx
+ af2:	89 f8                	mov    %edi,%eax
+ af4:	e8 17 fd ff ff       	call   810 <put>
+      esc = "\\t";
+ af9:	ba 55 10 00 00       	mov    $0x1055,%edx
+ afe:	e9 19 ff ff ff       	jmp    a1c <struct_field_str+0xac>
+ b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b07:	90                   	nop
+    put(w, ",", 1);
+ b08:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b0d:	ba 5e 10 00 00       	mov    $0x105e,%edx
+ b12:	89 f8                	mov    %edi,%eax
+ b14:	e8 f7 fc ff ff       	call   810 <put>
+}
+ b19:	e9 76 fe ff ff       	jmp    994 <struct_field_str+0x24>
+ b1e:	66 90                	xchg   %ax,%ax
+ b20:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+ b22:	ba dc 0f 00 00       	mov    $0xfdc,%edx
+ b27:	e9 09 ff ff ff       	jmp    a35 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+ b2c:	31 c9                	xor    %ecx,%ecx
+ b2e:	e9 02 ff ff ff       	jmp    a35 <struct_field_str+0xc5>
+ b33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b40 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	83 ec 1c             	sub    $0x1c,%esp
+ b49:	8b 7d 08             	mov    0x8(%ebp),%edi
+ b4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+ b4f:	8b 57 04             	mov    0x4(%edi),%edx
+ b52:	85 d2                	test   %edx,%edx
+ b54:	0f 85 b6 00 00 00    	jne    c10 <struct_field_int+0xd0>
+    w->need_comma = 1;
+ b5a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ b61:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b66:	ba 62 10 00 00       	mov    $0x1062,%edx
+ b6b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+ b6d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+ b72:	e8 99 fc ff ff       	call   810 <put>
+  put_str(w, key ? key : "");
+ b77:	85 db                	test   %ebx,%ebx
+ b79:	b8 dc 0f 00 00       	mov    $0xfdc,%eax
+ b7e:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ b81:	83 ec 0c             	sub    $0xc,%esp
+ b84:	53                   	push   %ebx
+ b85:	e8 f6 f5 ff ff       	call   180 <strlen>
+ b8a:	89 da                	mov    %ebx,%edx
+ b8c:	89 c1                	mov    %eax,%ecx
+ b8e:	89 f8                	mov    %edi,%eax
+ b90:	e8 7b fc ff ff       	call   810 <put>
+  put(w, "\":", 2);
+ b95:	b9 02 00 00 00       	mov    $0x2,%ecx
+ b9a:	ba 75 10 00 00       	mov    $0x1075,%edx
+ b9f:	89 f8                	mov    %edi,%eax
+ ba1:	e8 6a fc ff ff       	call   810 <put>
+  x = value < 0 ? -(uint)value : value;
+ ba6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+ ba9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+ bac:	83 c4 10             	add    $0x10,%esp
+ baf:	f7 d9                	neg    %ecx
+ bb1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+ bb5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+ bb8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ bbd:	89 f3                	mov    %esi,%ebx
+ bbf:	83 ee 01             	sub    $0x1,%esi
+ bc2:	f7 e1                	mul    %ecx
+ bc4:	89 c8                	mov    %ecx,%eax
+ bc6:	c1 ea 03             	shr    $0x3,%edx
+ bc9:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ bcc:	01 ff                	add    %edi,%edi
+ bce:	29 f8                	sub    %edi,%eax
+ bd0:	83 c0 30             	add    $0x30,%eax
+ bd3:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ bd7:	89 c8                	mov    %ecx,%eax
+ bd9:	89 d1                	mov    %edx,%ecx
+ bdb:	83 f8 09             	cmp    $0x9,%eax
+ bde:	77 d8                	ja     bb8 <struct_field_int+0x78>
+  if(value < 0)
+ be0:	8b 45 10             	mov    0x10(%ebp),%eax
+ be3:	8b 7d 08             	mov    0x8(%ebp),%edi
+ be6:	85 c0                	test   %eax,%eax
+ be8:	79 08                	jns    bf2 <struct_field_int+0xb2>
+    buf[--i] = '-';
+ bea:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+ bef:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+ bf2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ bf5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+ bfa:	8d 14 30             	lea    (%eax,%esi,1),%edx
+ bfd:	29 f1                	sub    %esi,%ecx
+ bff:	89 f8                	mov    %edi,%eax
+ c01:	e8 aa fc ff ff       	call   8b0 <putcopy>
+  put_int(w, value);
+}
+ c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c09:	5b                   	pop    %ebx
+ c0a:	5e                   	pop    %esi
+ c0b:	5f                   	pop    %edi
+ c0c:	5d                   	pop    %ebp
+ c0d:	c3                   	ret
+ c0e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+ c10:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c15:	ba 5e 10 00 00       	mov    $0x105e,%edx
+ c1a:	89 f8                	mov    %edi,%eax
+ c1c:	e8 ef fb ff ff       	call   810 <put>
+}
+ c21:	e9 3b ff ff ff       	jmp    b61 <struct_field_int+0x21>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c30 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	56                   	push   %esi
+ c34:	53                   	push   %ebx
+ c35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+ c38:	8b 43 08             	mov    0x8(%ebx),%eax
+ c3b:	85 c0                	test   %eax,%eax
+ c3d:	7e 59                	jle    c98 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+ c3f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+ c42:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ c45:	8b 72 08             	mov    0x8(%edx),%esi
+ c48:	01 ce                	add    %ecx,%esi
+ c4a:	81 fe 78 10 00 00    	cmp    $0x1078,%esi
+ c50:	0f 84 aa 00 00 00    	je     d00 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+ c56:	83 f8 20             	cmp    $0x20,%eax
+ c59:	75 75                	jne    cd0 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+ c5b:	83 ec 04             	sub    $0x4,%esp
+ c5e:	8d 73 10             	lea    0x10(%ebx),%esi
+ c61:	6a 20                	push   $0x20
+ c63:	56                   	push   %esi
+ c64:	ff 33                	push   (%ebx)
+ c66:	e8 98 f7 ff ff       	call   403 <writev>
+  w->nbuf = 0;
+ c6b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+ c72:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ c75:	c7 43 10 78 10 00 00 	movl   $0x1078,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+ c7c:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+ c83:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+ c8a:	ba 01 00 00 00       	mov    $0x1,%edx
+ c8f:	eb 5a                	jmp    ceb <struct_end+0xbb>
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+ c98:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c9b:	83 c0 02             	add    $0x2,%eax
+ c9e:	c7 04 c3 78 10 00 00 	movl   $0x1078,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ ca5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ cac:	00 
+  w->niov++;
+ cad:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+ cb0:	83 fa 01             	cmp    $0x1,%edx
+ cb3:	74 58                	je     d0d <struct_end+0xdd>
+  w->niov = 0;
+ cb5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+ cbc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+ cc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cc6:	5b                   	pop    %ebx
+ cc7:	5e                   	pop    %esi
+ cc8:	5d                   	pop    %ebp
+ cc9:	c3                   	ret
+ cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+ cd0:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ cd3:	83 c0 02             	add    $0x2,%eax
+ cd6:	8d 73 10             	lea    0x10(%ebx),%esi
+ cd9:	c7 04 c3 78 10 00 00 	movl   $0x1078,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ ce0:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ ce7:	00 
+  w->niov++;
+ ce8:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+ ceb:	83 ec 04             	sub    $0x4,%esp
+ cee:	52                   	push   %edx
+ cef:	56                   	push   %esi
+ cf0:	ff 33                	push   (%ebx)
+ cf2:	e8 0c f7 ff ff       	call   403 <writev>
+ cf7:	83 c4 10             	add    $0x10,%esp
+ cfa:	eb b9                	jmp    cb5 <struct_end+0x85>
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+ d00:	83 c1 02             	add    $0x2,%ecx
+ d03:	8d 73 10             	lea    0x10(%ebx),%esi
+ d06:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+ d09:	89 c2                	mov    %eax,%edx
+ d0b:	eb de                	jmp    ceb <struct_end+0xbb>
+ d0d:	8d 73 10             	lea    0x10(%ebx),%esi
+ d10:	e9 75 ff ff ff       	jmp    c8a <struct_end+0x5a>
+ d15:	66 90                	xchg   %ax,%ax
+ d17:	66 90                	xchg   %ax,%ax
+ d19:	66 90                	xchg   %ax,%ax
+ d1b:	66 90                	xchg   %ax,%ax
+ d1d:	66 90                	xchg   %ax,%ax
+ d1f:	90                   	nop
+
+00000d20 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	56                   	push   %esi
+ d24:	89 c6                	mov    %eax,%esi
+ d26:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+ d27:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+ d2d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+ d33:	6a 01                	push   $0x1
+ d35:	53                   	push   %ebx
+ d36:	e8 05 fc ff ff       	call   940 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ d3b:	83 c4 0c             	add    $0xc,%esp
+ d3e:	56                   	push   %esi
+ d3f:	68 7e 10 00 00       	push   $0x107e
+ d44:	53                   	push   %ebx
+ d45:	e8 26 fc ff ff       	call   970 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+ d4a:	83 c4 0c             	add    $0xc,%esp
+ d4d:	68 86 10 00 00       	push   $0x1086
+ d52:	68 97 10 00 00       	push   $0x1097
+ d57:	53                   	push   %ebx
+ d58:	e8 13 fc ff ff       	call   970 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+ d5d:	83 c4 0c             	add    $0xc,%esp
+ d60:	68 ea 07 00 00       	push   $0x7ea
+ d65:	68 9e 10 00 00       	push   $0x109e
+ d6a:	53                   	push   %ebx
+ d6b:	e8 d0 fd ff ff       	call   b40 <struct_field_int>
+  struct_end(&w);
+ d70:	89 1c 24             	mov    %ebx,(%esp)
+ d73:	e8 b8 fe ff ff       	call   c30 <struct_end>
+ d78:	83 c4 10             	add    $0x10,%esp
+}
+ d7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d7e:	5b                   	pop    %ebx
+ d7f:	5e                   	pop    %esi
+ d80:	5d                   	pop    %ebp
+ d81:	c3                   	ret
+ d82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d90 <modern_consume_flags>:
+{
+ d90:	55                   	push   %ebp
+ d91:	89 e5                	mov    %esp,%ebp
+ d93:	57                   	push   %edi
+ d94:	56                   	push   %esi
+ d95:	53                   	push   %ebx
+ d96:	83 ec 0c             	sub    $0xc,%esp
+ d99:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+ d9c:	85 f6                	test   %esi,%esi
+ d9e:	74 06                	je     da6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+ da0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+ da6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+ daa:	bf 01 00 00 00       	mov    $0x1,%edi
+ daf:	7e 4c                	jle    dfd <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+ db1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+ db4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+ db7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+ dba:	68 a3 10 00 00       	push   $0x10a3
+ dbf:	53                   	push   %ebx
+ dc0:	e8 5b f3 ff ff       	call   120 <strcmp>
+ dc5:	83 c4 10             	add    $0x10,%esp
+ dc8:	85 c0                	test   %eax,%eax
+ dca:	74 58                	je     e24 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+ dcc:	8b 45 14             	mov    0x14(%ebp),%eax
+ dcf:	85 c0                	test   %eax,%eax
+ dd1:	74 2a                	je     dfd <modern_consume_flags+0x6d>
+ dd3:	83 ec 08             	sub    $0x8,%esp
+ dd6:	68 bb 10 00 00       	push   $0x10bb
+ ddb:	53                   	push   %ebx
+ ddc:	e8 3f f3 ff ff       	call   120 <strcmp>
+ de1:	83 c4 10             	add    $0x10,%esp
+ de4:	85 c0                	test   %eax,%eax
+ de6:	74 28                	je     e10 <modern_consume_flags+0x80>
+ de8:	83 ec 08             	sub    $0x8,%esp
+ deb:	68 be 10 00 00       	push   $0x10be
+ df0:	53                   	push   %ebx
+ df1:	e8 2a f3 ff ff       	call   120 <strcmp>
+ df6:	83 c4 10             	add    $0x10,%esp
+ df9:	85 c0                	test   %eax,%eax
+ dfb:	74 13                	je     e10 <modern_consume_flags+0x80>
+}
+ dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e00:	89 f8                	mov    %edi,%eax
+ e02:	5b                   	pop    %ebx
+ e03:	5e                   	pop    %esi
+ e04:	5f                   	pop    %edi
+ e05:	5d                   	pop    %ebp
+ e06:	c3                   	ret
+ e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+ e10:	85 f6                	test   %esi,%esi
+ e12:	74 06                	je     e1a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+ e14:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+ e1a:	83 c7 01             	add    $0x1,%edi
+ e1d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ e20:	75 8f                	jne    db1 <modern_consume_flags+0x21>
+ e22:	eb d9                	jmp    dfd <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+ e24:	85 f6                	test   %esi,%esi
+ e26:	74 12                	je     e3a <modern_consume_flags+0xaa>
+  if(!json_mode){
+ e28:	83 3e 00             	cmpl   $0x0,(%esi)
+ e2b:	74 0d                	je     e3a <modern_consume_flags+0xaa>
+ e2d:	8b 45 08             	mov    0x8(%ebp),%eax
+ e30:	e8 eb fe ff ff       	call   d20 <modern_print_version.part.0>
+      exit();
+ e35:	e8 f9 f4 ff ff       	call   333 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ e3a:	83 ec 0c             	sub    $0xc,%esp
+ e3d:	68 ea 07 00 00       	push   $0x7ea
+ e42:	68 86 10 00 00       	push   $0x1086
+ e47:	ff 75 08             	push   0x8(%ebp)
+ e4a:	68 ad 10 00 00       	push   $0x10ad
+ e4f:	6a 01                	push   $0x1
+ e51:	e8 8a f6 ff ff       	call   4e0 <printf>
+}
+ e56:	83 c4 20             	add    $0x20,%esp
+ e59:	eb da                	jmp    e35 <modern_consume_flags+0xa5>
+ e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e5f:	90                   	nop
+
+00000e60 <modern_print_version>:
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+ e66:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+ e69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+ e6c:	85 d2                	test   %edx,%edx
+ e6e:	74 10                	je     e80 <modern_print_version+0x20>
+}
+ e70:	c9                   	leave
+ e71:	e9 aa fe ff ff       	jmp    d20 <modern_print_version.part.0>
+ e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e7d:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ e80:	83 ec 0c             	sub    $0xc,%esp
+ e83:	68 ea 07 00 00       	push   $0x7ea
+ e88:	68 86 10 00 00       	push   $0x1086
+ e8d:	50                   	push   %eax
+ e8e:	68 ad 10 00 00       	push   $0x10ad
+ e93:	6a 01                	push   $0x1
+ e95:	e8 46 f6 ff ff       	call   4e0 <printf>
+}
+ e9a:	83 c4 20             	add    $0x20,%esp
+}
+ e9d:	c9                   	leave
+ e9e:	c3                   	ret
+ e9f:	90                   	nop
+
+00000ea0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+ ea0:	55                   	push   %ebp
+ ea1:	89 e5                	mov    %esp,%ebp
+ ea3:	57                   	push   %edi
+ ea4:	56                   	push   %esi
+ ea5:	53                   	push   %ebx
+ ea6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+ eac:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+ eaf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ eb2:	8b 45 10             	mov    0x10(%ebp),%eax
+ eb5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+ eb8:	85 d2                	test   %edx,%edx
+ eba:	75 44                	jne    f00 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+ ebc:	85 f6                	test   %esi,%esi
+ ebe:	ba c5 10 00 00       	mov    $0x10c5,%edx
+ ec3:	0f 44 f2             	cmove  %edx,%esi
+ ec6:	85 c0                	test   %eax,%eax
+ ec8:	ba dc 0f 00 00       	mov    $0xfdc,%edx
+ ecd:	0f 44 c2             	cmove  %edx,%eax
+ ed0:	85 db                	test   %ebx,%ebx
+ ed2:	ba ca 10 00 00       	mov    $0x10ca,%edx
+ ed7:	0f 44 da             	cmove  %edx,%ebx
+ eda:	83 ec 08             	sub    $0x8,%esp
+ edd:	56                   	push   %esi
+ ede:	50                   	push   %eax
+ edf:	53                   	push   %ebx
+ ee0:	ff 75 08             	push   0x8(%ebp)
+ ee3:	68 d0 10 00 00       	push   $0x10d0
+ ee8:	6a 01                	push   $0x1
+ eea:	e8 f1 f5 ff ff       	call   4e0 <printf>
+ eef:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+ ef2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ef5:	5b                   	pop    %ebx
+ ef6:	5e                   	pop    %esi
+ ef7:	5f                   	pop    %edi
+ ef8:	5d                   	pop    %ebp
+ ef9:	c3                   	ret
+ efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+ f00:	83 ec 08             	sub    $0x8,%esp
+ f03:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+ f09:	89 45 10             	mov    %eax,0x10(%ebp)
+ f0c:	6a 01                	push   $0x1
+ f0e:	57                   	push   %edi
+ f0f:	e8 2c fa ff ff       	call   940 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ f14:	83 c4 0c             	add    $0xc,%esp
+ f17:	ff 75 08             	push   0x8(%ebp)
+ f1a:	68 7e 10 00 00       	push   $0x107e
+ f1f:	57                   	push   %edi
+ f20:	e8 4b fa ff ff       	call   970 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+ f25:	83 c4 0c             	add    $0xc,%esp
+ f28:	ba ca 10 00 00       	mov    $0x10ca,%edx
+ f2d:	85 db                	test   %ebx,%ebx
+ f2f:	0f 44 da             	cmove  %edx,%ebx
+ f32:	53                   	push   %ebx
+ f33:	52                   	push   %edx
+ f34:	57                   	push   %edi
+ f35:	e8 36 fa ff ff       	call   970 <struct_field_str>
+  if(target)
+ f3a:	8b 45 10             	mov    0x10(%ebp),%eax
+ f3d:	83 c4 10             	add    $0x10,%esp
+ f40:	85 c0                	test   %eax,%eax
+ f42:	74 12                	je     f56 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+ f44:	83 ec 04             	sub    $0x4,%esp
+ f47:	50                   	push   %eax
+ f48:	68 de 10 00 00       	push   $0x10de
+ f4d:	57                   	push   %edi
+ f4e:	e8 1d fa ff ff       	call   970 <struct_field_str>
+ f53:	83 c4 10             	add    $0x10,%esp
+  if(status)
+ f56:	85 f6                	test   %esi,%esi
+ f58:	74 12                	je     f6c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+ f5a:	83 ec 04             	sub    $0x4,%esp
+ f5d:	56                   	push   %esi
+ f5e:	68 e5 10 00 00       	push   $0x10e5
+ f63:	57                   	push   %edi
+ f64:	e8 07 fa ff ff       	call   970 <struct_field_str>
+ f69:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+ f6c:	83 ec 0c             	sub    $0xc,%esp
+ f6f:	57                   	push   %edi
+ f70:	e8 bb fc ff ff       	call   c30 <struct_end>
+ f75:	83 c4 10             	add    $0x10,%esp
+}
+ f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f7b:	5b                   	pop    %ebx
+ f7c:	5e                   	pop    %esi
+ f7d:	5f                   	pop    %edi
+ f7e:	5d                   	pop    %ebp
+ f7f:	c3                   	ret
@@ -0,0 +1,5419 @@
+
+build/bin/user/_iotests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fourreaders ok, %d ticks\n", uptime() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "iotests starting\n");
+      11:	68 5f 37 00 00       	push   $0x375f
+      16:	6a 01                	push   $0x1
+      18:	e8 c3 26 00 00       	call   26e0 <printf>
+
+  fourreaders();
+      1d:	e8 7e 20 00 00       	call   20a0 <fourreaders>
+  hugefile();
+      22:	e8 59 00 00 00       	call   80 <hugefile>
+  smallfile();
+      27:	e8 44 02 00 00       	call   270 <smallfile>
+
+  pipebench();
+      2c:	e8 ff 03 00 00       	call   430 <pipebench>
+  pipepages();
+      31:	e8 ca 05 00 00       	call   600 <pipepages>
+  cowoom();
+      36:	e8 c5 08 00 00       	call   900 <cowoom>
+  polltest();
+      3b:	e8 10 0a 00 00       	call   a50 <polltest>
+  nonblock();
+      40:	e8 3b 0c 00 00       	call   c80 <nonblock>
+  seektest();
+      45:	e8 26 0e 00 00       	call   e70 <seektest>
+  iovtest();
+      4a:	e8 21 10 00 00       	call   1070 <iovtest>
+  getdentstest();
+      4f:	e8 8c 11 00 00       	call   11e0 <getdentstest>
+  splicetest();
+      54:	e8 87 13 00 00       	call   13e0 <splicetest>
+  ioringtest();
+      59:	e8 82 16 00 00       	call   16e0 <ioringtest>
+  batchtest();
+      5e:	e8 ed 1a 00 00       	call   1b50 <batchtest>
+  batchbench();
+      63:	e8 e8 1d 00 00       	call   1e50 <batchbench>
+
+  printf(1, "iotests ok\n");
+      68:	58                   	pop    %eax
+      69:	5a                   	pop    %edx
+      6a:	68 71 37 00 00       	push   $0x3771
+      6f:	6a 01                	push   $0x1
+      71:	e8 6a 26 00 00       	call   26e0 <printf>
+  exit();
+      76:	e8 b8 24 00 00       	call   2533 <exit>
+      7b:	66 90                	xchg   %ax,%ax
+      7d:	66 90                	xchg   %ax,%ax
+      7f:	90                   	nop
+
+00000080 <hugefile>:
+{
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	56                   	push   %esi
+      84:	53                   	push   %ebx
+  printf(stdout, "huge file test\n");
+      85:	83 ec 08             	sub    $0x8,%esp
+      88:	68 80 31 00 00       	push   $0x3180
+      8d:	ff 35 7c 43 00 00    	push   0x437c
+      93:	e8 48 26 00 00       	call   26e0 <printf>
+  fd = open("huge", O_CREATE|O_RDWR);
+      98:	5b                   	pop    %ebx
+      99:	5e                   	pop    %esi
+      9a:	68 02 02 00 00       	push   $0x202
+      9f:	68 90 31 00 00       	push   $0x3190
+      a4:	e8 ca 24 00 00       	call   2573 <open>
+  if(fd < 0){
+      a9:	83 c4 10             	add    $0x10,%esp
+      ac:	85 c0                	test   %eax,%eax
+      ae:	0f 88 80 01 00 00    	js     234 <hugefile+0x1b4>
+      b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 2*MAXFILE; i++){
+      b6:	31 db                	xor    %ebx,%ebx
+      b8:	eb 11                	jmp    cb <hugefile+0x4b>
+      ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      c0:	83 c3 01             	add    $0x1,%ebx
+      c3:	81 fb 18 01 00 00    	cmp    $0x118,%ebx
+      c9:	74 55                	je     120 <hugefile+0xa0>
+    if(write(fd, buf, BSIZE) != BSIZE)
+      cb:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+      ce:	89 1d 80 43 00 00    	mov    %ebx,0x4380
+    if(write(fd, buf, BSIZE) != BSIZE)
+      d4:	68 00 02 00 00       	push   $0x200
+      d9:	68 80 43 00 00       	push   $0x4380
+      de:	56                   	push   %esi
+      df:	e8 6f 24 00 00       	call   2553 <write>
+      e4:	83 c4 10             	add    $0x10,%esp
+      e7:	3d 00 02 00 00       	cmp    $0x200,%eax
+      ec:	74 d2                	je     c0 <hugefile+0x40>
+  close(fd);
+      ee:	83 ec 0c             	sub    $0xc,%esp
+      f1:	56                   	push   %esi
+      f2:	e8 64 24 00 00       	call   255b <close>
+  if(i == MAXFILE){
+      f7:	83 c4 10             	add    $0x10,%esp
+      fa:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     100:	0f 84 c0 00 00 00    	je     1c6 <hugefile+0x146>
+    printf(stdout, "error: write huge file failed at block %d\n", i);
+     106:	50                   	push   %eax
+     107:	53                   	push   %ebx
+     108:	68 a4 37 00 00       	push   $0x37a4
+     10d:	ff 35 7c 43 00 00    	push   0x437c
+     113:	e8 c8 25 00 00       	call   26e0 <printf>
+    exit();
+     118:	e8 16 24 00 00       	call   2533 <exit>
+     11d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+     120:	83 ec 0c             	sub    $0xc,%esp
+     123:	56                   	push   %esi
+     124:	e8 32 24 00 00       	call   255b <close>
+  fd = open("huge", O_RDONLY);
+     129:	58                   	pop    %eax
+     12a:	5a                   	pop    %edx
+     12b:	6a 00                	push   $0x0
+     12d:	68 90 31 00 00       	push   $0x3190
+     132:	e8 3c 24 00 00       	call   2573 <open>
+  if(fd < 0){
+     137:	83 c4 10             	add    $0x10,%esp
+  fd = open("huge", O_RDONLY);
+     13a:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     13c:	85 c0                	test   %eax,%eax
+     13e:	0f 88 c2 00 00 00    	js     206 <hugefile+0x186>
+  for(n = 0; read(fd, buf, BSIZE) == BSIZE; n++){
+     144:	31 db                	xor    %ebx,%ebx
+     146:	eb 18                	jmp    160 <hugefile+0xe0>
+     148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     14f:	90                   	nop
+    if(((int*)buf)[0] != n){
+     150:	a1 80 43 00 00       	mov    0x4380,%eax
+     155:	39 d8                	cmp    %ebx,%eax
+     157:	0f 85 92 00 00 00    	jne    1ef <hugefile+0x16f>
+  for(n = 0; read(fd, buf, BSIZE) == BSIZE; n++){
+     15d:	83 c3 01             	add    $0x1,%ebx
+     160:	83 ec 04             	sub    $0x4,%esp
+     163:	68 00 02 00 00       	push   $0x200
+     168:	68 80 43 00 00       	push   $0x4380
+     16d:	56                   	push   %esi
+     16e:	e8 d8 23 00 00       	call   254b <read>
+     173:	83 c4 10             	add    $0x10,%esp
+     176:	3d 00 02 00 00       	cmp    $0x200,%eax
+     17b:	74 d3                	je     150 <hugefile+0xd0>
+  close(fd);
+     17d:	83 ec 0c             	sub    $0xc,%esp
+     180:	56                   	push   %esi
+     181:	e8 d5 23 00 00       	call   255b <close>
+  if(n != 2*MAXFILE){
+     186:	83 c4 10             	add    $0x10,%esp
+     189:	81 fb 18 01 00 00    	cmp    $0x118,%ebx
+     18f:	0f 85 b6 00 00 00    	jne    24b <hugefile+0x1cb>
+  if(unlink("huge") < 0){
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	68 90 31 00 00       	push   $0x3190
+     19d:	e8 e1 23 00 00       	call   2583 <unlink>
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	78 74                	js     21d <hugefile+0x19d>
+  printf(stdout, "huge file ok\n");
+     1a9:	83 ec 08             	sub    $0x8,%esp
+     1ac:	68 de 31 00 00       	push   $0x31de
+     1b1:	ff 35 7c 43 00 00    	push   0x437c
+     1b7:	e8 24 25 00 00       	call   26e0 <printf>
+     1bc:	83 c4 10             	add    $0x10,%esp
+}
+     1bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1c2:	5b                   	pop    %ebx
+     1c3:	5e                   	pop    %esi
+     1c4:	5d                   	pop    %ebp
+     1c5:	c3                   	ret
+    unlink("huge");
+     1c6:	83 ec 0c             	sub    $0xc,%esp
+     1c9:	68 90 31 00 00       	push   $0x3190
+     1ce:	e8 b0 23 00 00       	call   2583 <unlink>
+    printf(stdout, "huge file test skipped: no extents\n");
+     1d3:	58                   	pop    %eax
+     1d4:	5a                   	pop    %edx
+     1d5:	68 80 37 00 00       	push   $0x3780
+     1da:	ff 35 7c 43 00 00    	push   0x437c
+     1e0:	e8 fb 24 00 00       	call   26e0 <printf>
+    return;
+     1e5:	83 c4 10             	add    $0x10,%esp
+}
+     1e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1eb:	5b                   	pop    %ebx
+     1ec:	5e                   	pop    %esi
+     1ed:	5d                   	pop    %ebp
+     1ee:	c3                   	ret
+      printf(stdout, "read content of block %d is %d\n",
+     1ef:	50                   	push   %eax
+     1f0:	53                   	push   %ebx
+     1f1:	68 d0 37 00 00       	push   $0x37d0
+     1f6:	ff 35 7c 43 00 00    	push   0x437c
+     1fc:	e8 df 24 00 00       	call   26e0 <printf>
+      exit();
+     201:	e8 2d 23 00 00       	call   2533 <exit>
+    printf(stdout, "error: open huge failed!\n");
+     206:	50                   	push   %eax
+     207:	50                   	push   %eax
+     208:	68 b0 31 00 00       	push   $0x31b0
+     20d:	ff 35 7c 43 00 00    	push   0x437c
+     213:	e8 c8 24 00 00       	call   26e0 <printf>
+    exit();
+     218:	e8 16 23 00 00       	call   2533 <exit>
+    printf(stdout, "unlink huge failed\n");
+     21d:	51                   	push   %ecx
+     21e:	51                   	push   %ecx
+     21f:	68 ca 31 00 00       	push   $0x31ca
+     224:	ff 35 7c 43 00 00    	push   0x437c
+     22a:	e8 b1 24 00 00       	call   26e0 <printf>
+    exit();
+     22f:	e8 ff 22 00 00       	call   2533 <exit>
+    printf(stdout, "error: creat huge failed!\n");
+     234:	51                   	push   %ecx
+     235:	51                   	push   %ecx
+     236:	68 95 31 00 00       	push   $0x3195
+     23b:	ff 35 7c 43 00 00    	push   0x437c
+     241:	e8 9a 24 00 00       	call   26e0 <printf>
+    exit();
+     246:	e8 e8 22 00 00       	call   2533 <exit>
+    printf(stdout, "read only %d blocks from huge\n", n);
+     24b:	56                   	push   %esi
+     24c:	53                   	push   %ebx
+     24d:	68 f0 37 00 00       	push   $0x37f0
+     252:	ff 35 7c 43 00 00    	push   0x437c
+     258:	e8 83 24 00 00       	call   26e0 <printf>
+    exit();
+     25d:	e8 d1 22 00 00       	call   2533 <exit>
+     262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <smallfile>:
+{
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	57                   	push   %edi
+     274:	56                   	push   %esi
+     275:	53                   	push   %ebx
+     276:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "small file test\n");
+     279:	68 ec 31 00 00       	push   $0x31ec
+     27e:	ff 35 7c 43 00 00    	push   0x437c
+     284:	e8 57 24 00 00       	call   26e0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     289:	58                   	pop    %eax
+     28a:	5a                   	pop    %edx
+     28b:	68 02 02 00 00       	push   $0x202
+     290:	68 fd 31 00 00       	push   $0x31fd
+     295:	e8 d9 22 00 00       	call   2573 <open>
+  if(fd < 0){
+     29a:	83 c4 10             	add    $0x10,%esp
+     29d:	85 c0                	test   %eax,%eax
+     29f:	0f 88 6c 01 00 00    	js     411 <smallfile+0x1a1>
+  for(i = 0; i < 100; i++){
+     2a5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     2ac:	89 c3                	mov    %eax,%ebx
+     2ae:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+     2b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(write(fd, &i, 1) != 1){
+     2b8:	83 ec 04             	sub    $0x4,%esp
+     2bb:	6a 01                	push   $0x1
+     2bd:	57                   	push   %edi
+     2be:	53                   	push   %ebx
+     2bf:	e8 8f 22 00 00       	call   2553 <write>
+     2c4:	83 c4 10             	add    $0x10,%esp
+     2c7:	83 f8 01             	cmp    $0x1,%eax
+     2ca:	0f 85 c3 00 00 00    	jne    393 <smallfile+0x123>
+  for(i = 0; i < 100; i++){
+     2d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2d3:	83 c0 01             	add    $0x1,%eax
+     2d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     2d9:	83 f8 63             	cmp    $0x63,%eax
+     2dc:	7e da                	jle    2b8 <smallfile+0x48>
+  close(fd);
+     2de:	83 ec 0c             	sub    $0xc,%esp
+     2e1:	53                   	push   %ebx
+     2e2:	e8 74 22 00 00       	call   255b <close>
+  fd = open("small", O_RDONLY);
+     2e7:	5b                   	pop    %ebx
+     2e8:	5f                   	pop    %edi
+     2e9:	6a 00                	push   $0x0
+     2eb:	68 fd 31 00 00       	push   $0x31fd
+     2f0:	e8 7e 22 00 00       	call   2573 <open>
+  if(fd < 0){
+     2f5:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     2f8:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     2fa:	85 c0                	test   %eax,%eax
+     2fc:	0f 88 e1 00 00 00    	js     3e3 <smallfile+0x173>
+  if(read(fd, buf, sizeof(buf)) != 100){
+     302:	83 ec 04             	sub    $0x4,%esp
+     305:	68 00 20 00 00       	push   $0x2000
+     30a:	68 80 43 00 00       	push   $0x4380
+     30f:	50                   	push   %eax
+     310:	e8 36 22 00 00       	call   254b <read>
+     315:	83 c4 10             	add    $0x10,%esp
+     318:	83 f8 64             	cmp    $0x64,%eax
+     31b:	0f 85 d9 00 00 00    	jne    3fa <smallfile+0x18a>
+  close(fd);
+     321:	83 ec 0c             	sub    $0xc,%esp
+     324:	53                   	push   %ebx
+     325:	e8 31 22 00 00       	call   255b <close>
+  for(i = 0; i < 100; i++){
+     32a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     331:	31 c9                	xor    %ecx,%ecx
+     333:	31 c0                	xor    %eax,%eax
+     335:	83 c4 10             	add    $0x10,%esp
+     338:	eb 08                	jmp    342 <smallfile+0xd2>
+     33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     340:	89 c6                	mov    %eax,%esi
+    if(buf[i] != i){
+     342:	0f be 90 80 43 00 00 	movsbl 0x4380(%eax),%edx
+     349:	39 c2                	cmp    %eax,%edx
+     34b:	75 61                	jne    3ae <smallfile+0x13e>
+  for(i = 0; i < 100; i++){
+     34d:	83 c0 01             	add    $0x1,%eax
+     350:	b9 01 00 00 00       	mov    $0x1,%ecx
+     355:	83 f8 64             	cmp    $0x64,%eax
+     358:	75 e6                	jne    340 <smallfile+0xd0>
+  if(unlink("small") < 0){
+     35a:	83 ec 0c             	sub    $0xc,%esp
+     35d:	c7 45 e4 64 00 00 00 	movl   $0x64,-0x1c(%ebp)
+     364:	68 fd 31 00 00       	push   $0x31fd
+     369:	e8 15 22 00 00       	call   2583 <unlink>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	85 c0                	test   %eax,%eax
+     373:	78 57                	js     3cc <smallfile+0x15c>
+  printf(stdout, "small file ok\n");
+     375:	83 ec 08             	sub    $0x8,%esp
+     378:	68 83 32 00 00       	push   $0x3283
+     37d:	ff 35 7c 43 00 00    	push   0x437c
+     383:	e8 58 23 00 00       	call   26e0 <printf>
+}
+     388:	83 c4 10             	add    $0x10,%esp
+     38b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     38e:	5b                   	pop    %ebx
+     38f:	5e                   	pop    %esi
+     390:	5f                   	pop    %edi
+     391:	5d                   	pop    %ebp
+     392:	c3                   	ret
+      printf(stdout, "error: write small failed at %d\n", i);
+     393:	83 ec 04             	sub    $0x4,%esp
+     396:	ff 75 e4             	push   -0x1c(%ebp)
+     399:	68 10 38 00 00       	push   $0x3810
+     39e:	ff 35 7c 43 00 00    	push   0x437c
+     3a4:	e8 37 23 00 00       	call   26e0 <printf>
+      exit();
+     3a9:	e8 85 21 00 00       	call   2533 <exit>
+     3ae:	84 c9                	test   %cl,%cl
+     3b0:	74 03                	je     3b5 <smallfile+0x145>
+     3b2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      printf(stdout, "small file byte %d is %d\n", i, buf[i]);
+     3b5:	52                   	push   %edx
+     3b6:	50                   	push   %eax
+     3b7:	68 54 32 00 00       	push   $0x3254
+     3bc:	ff 35 7c 43 00 00    	push   0x437c
+     3c2:	e8 19 23 00 00       	call   26e0 <printf>
+      exit();
+     3c7:	e8 67 21 00 00       	call   2533 <exit>
+    printf(stdout, "unlink small failed\n");
+     3cc:	50                   	push   %eax
+     3cd:	50                   	push   %eax
+     3ce:	68 6e 32 00 00       	push   $0x326e
+     3d3:	ff 35 7c 43 00 00    	push   0x437c
+     3d9:	e8 02 23 00 00       	call   26e0 <printf>
+    exit();
+     3de:	e8 50 21 00 00       	call   2533 <exit>
+    printf(stdout, "error: open small failed!\n");
+     3e3:	51                   	push   %ecx
+     3e4:	51                   	push   %ecx
+     3e5:	68 1f 32 00 00       	push   $0x321f
+     3ea:	ff 35 7c 43 00 00    	push   0x437c
+     3f0:	e8 eb 22 00 00       	call   26e0 <printf>
+    exit();
+     3f5:	e8 39 21 00 00       	call   2533 <exit>
+    printf(stdout, "error: read small failed\n");
+     3fa:	52                   	push   %edx
+     3fb:	52                   	push   %edx
+     3fc:	68 3a 32 00 00       	push   $0x323a
+     401:	ff 35 7c 43 00 00    	push   0x437c
+     407:	e8 d4 22 00 00       	call   26e0 <printf>
+    exit();
+     40c:	e8 22 21 00 00       	call   2533 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     411:	50                   	push   %eax
+     412:	50                   	push   %eax
+     413:	68 03 32 00 00       	push   $0x3203
+     418:	ff 35 7c 43 00 00    	push   0x437c
+     41e:	e8 bd 22 00 00       	call   26e0 <printf>
+    exit();
+     423:	e8 0b 21 00 00       	call   2533 <exit>
+     428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <pipebench>:
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	57                   	push   %edi
+     434:	56                   	push   %esi
+     435:	53                   	push   %ebx
+     436:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "pipebench test\n");
+     439:	68 92 32 00 00       	push   $0x3292
+     43e:	6a 01                	push   $0x1
+     440:	e8 9b 22 00 00       	call   26e0 <printf>
+  if(pipe(fds) != 0){
+     445:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     448:	89 04 24             	mov    %eax,(%esp)
+     44b:	e8 f3 20 00 00       	call   2543 <pipe>
+     450:	83 c4 10             	add    $0x10,%esp
+     453:	85 c0                	test   %eax,%eax
+     455:	0f 85 60 01 00 00    	jne    5bb <pipebench+0x18b>
+     45b:	89 c7                	mov    %eax,%edi
+  t0 = uptime();
+     45d:	e8 69 21 00 00       	call   25cb <uptime>
+     462:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     464:	e8 c2 20 00 00       	call   252b <fork>
+  if(pid == 0){
+     469:	85 c0                	test   %eax,%eax
+     46b:	0f 84 bc 00 00 00    	je     52d <pipebench+0xfd>
+  } else if(pid > 0){
+     471:	0f 8e 31 01 00 00    	jle    5a8 <pipebench+0x178>
+    close(fds[1]);
+     477:	83 ec 0c             	sub    $0xc,%esp
+     47a:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     47d:	31 db                	xor    %ebx,%ebx
+    close(fds[1]);
+     47f:	e8 d7 20 00 00       	call   255b <close>
+    while((n = read(fds[0], buf, sizeof(buf))) > 0){
+     484:	83 c4 10             	add    $0x10,%esp
+     487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48e:	66 90                	xchg   %ax,%ax
+     490:	83 ec 04             	sub    $0x4,%esp
+     493:	68 00 20 00 00       	push   $0x2000
+     498:	68 80 43 00 00       	push   $0x4380
+     49d:	ff 75 e0             	push   -0x20(%ebp)
+     4a0:	e8 a6 20 00 00       	call   254b <read>
+     4a5:	83 c4 10             	add    $0x10,%esp
+     4a8:	89 c1                	mov    %eax,%ecx
+     4aa:	85 c0                	test   %eax,%eax
+     4ac:	7e 3e                	jle    4ec <pipebench+0xbc>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     4ae:	89 f8                	mov    %edi,%eax
+     4b0:	32 05 80 43 00 00    	xor    0x4380,%al
+     4b6:	0f b6 c0             	movzbl %al,%eax
+     4b9:	85 c0                	test   %eax,%eax
+     4bb:	0f 85 d2 00 00 00    	jne    593 <pipebench+0x163>
+     4c1:	83 c7 01             	add    $0x1,%edi
+     4c4:	eb 16                	jmp    4dc <pipebench+0xac>
+     4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4cd:	8d 76 00             	lea    0x0(%esi),%esi
+     4d0:	38 90 80 43 00 00    	cmp    %dl,0x4380(%eax)
+     4d6:	0f 85 b5 00 00 00    	jne    591 <pipebench+0x161>
+     4dc:	8d 14 07             	lea    (%edi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     4df:	83 c0 01             	add    $0x1,%eax
+     4e2:	39 c1                	cmp    %eax,%ecx
+     4e4:	75 ea                	jne    4d0 <pipebench+0xa0>
+      total += n;
+     4e6:	01 cb                	add    %ecx,%ebx
+     4e8:	89 d7                	mov    %edx,%edi
+     4ea:	eb a4                	jmp    490 <pipebench+0x60>
+    close(fds[0]);
+     4ec:	83 ec 0c             	sub    $0xc,%esp
+     4ef:	ff 75 e0             	push   -0x20(%ebp)
+     4f2:	e8 64 20 00 00       	call   255b <close>
+    wait();
+     4f7:	e8 3f 20 00 00       	call   253b <wait>
+    if(total != 4*1024*1024){
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+     505:	0f 85 c3 00 00 00    	jne    5ce <pipebench+0x19e>
+  printf(1, "pipebench ok, 4096 KB in %d ticks\n", uptime() - t0);
+     50b:	e8 bb 20 00 00       	call   25cb <uptime>
+     510:	83 ec 04             	sub    $0x4,%esp
+     513:	29 f0                	sub    %esi,%eax
+     515:	50                   	push   %eax
+     516:	68 34 38 00 00       	push   $0x3834
+     51b:	6a 01                	push   $0x1
+     51d:	e8 be 21 00 00       	call   26e0 <printf>
+}
+     522:	83 c4 10             	add    $0x10,%esp
+     525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     528:	5b                   	pop    %ebx
+     529:	5e                   	pop    %esi
+     52a:	5f                   	pop    %edi
+     52b:	5d                   	pop    %ebp
+     52c:	c3                   	ret
+    close(fds[0]);
+     52d:	83 ec 0c             	sub    $0xc,%esp
+     530:	ff 75 e0             	push   -0x20(%ebp)
+    for(total = 0; total < 4*1024*1024; total += n){
+     533:	31 f6                	xor    %esi,%esi
+  seq = 0;
+     535:	31 ff                	xor    %edi,%edi
+    close(fds[0]);
+     537:	e8 1f 20 00 00       	call   255b <close>
+     53c:	83 c4 10             	add    $0x10,%esp
+     53f:	90                   	nop
+      n = 4*1024*1024 - total;
+     540:	bb 00 00 40 00       	mov    $0x400000,%ebx
+      if(n > 8191)
+     545:	b8 ff 1f 00 00       	mov    $0x1fff,%eax
+      n = 4*1024*1024 - total;
+     54a:	29 f3                	sub    %esi,%ebx
+      if(n > 8191)
+     54c:	39 c3                	cmp    %eax,%ebx
+     54e:	0f 4f d8             	cmovg  %eax,%ebx
+      for(i = 0; i < n; i++)
+     551:	31 c0                	xor    %eax,%eax
+     553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     557:	90                   	nop
+        buf[i] = seq++;
+     558:	8d 0c 38             	lea    (%eax,%edi,1),%ecx
+      for(i = 0; i < n; i++)
+     55b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     55e:	88 88 7f 43 00 00    	mov    %cl,0x437f(%eax)
+      for(i = 0; i < n; i++)
+     564:	39 c3                	cmp    %eax,%ebx
+     566:	75 f0                	jne    558 <pipebench+0x128>
+      if(write(fds[1], buf, n) != n){
+     568:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     56b:	01 df                	add    %ebx,%edi
+      if(write(fds[1], buf, n) != n){
+     56d:	53                   	push   %ebx
+     56e:	68 80 43 00 00       	push   $0x4380
+     573:	ff 75 e4             	push   -0x1c(%ebp)
+     576:	e8 d8 1f 00 00       	call   2553 <write>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	39 d8                	cmp    %ebx,%eax
+     580:	75 66                	jne    5e8 <pipebench+0x1b8>
+    for(total = 0; total < 4*1024*1024; total += n){
+     582:	01 de                	add    %ebx,%esi
+     584:	81 fe ff ff 3f 00    	cmp    $0x3fffff,%esi
+     58a:	7e b4                	jle    540 <pipebench+0x110>
+    exit();
+     58c:	e8 a2 1f 00 00       	call   2533 <exit>
+          printf(1, "pipebench: wrong byte at %d\n", total + i);
+     591:	01 c3                	add    %eax,%ebx
+     593:	83 ec 04             	sub    $0x4,%esp
+     596:	53                   	push   %ebx
+     597:	68 c9 32 00 00       	push   $0x32c9
+     59c:	6a 01                	push   $0x1
+     59e:	e8 3d 21 00 00       	call   26e0 <printf>
+          exit();
+     5a3:	e8 8b 1f 00 00       	call   2533 <exit>
+    printf(1, "fork() failed\n");
+     5a8:	50                   	push   %eax
+     5a9:	50                   	push   %eax
+     5aa:	68 00 33 00 00       	push   $0x3300
+     5af:	6a 01                	push   $0x1
+     5b1:	e8 2a 21 00 00       	call   26e0 <printf>
+    exit();
+     5b6:	e8 78 1f 00 00       	call   2533 <exit>
+    printf(1, "pipe() failed\n");
+     5bb:	51                   	push   %ecx
+     5bc:	51                   	push   %ecx
+     5bd:	68 a2 32 00 00       	push   $0x32a2
+     5c2:	6a 01                	push   $0x1
+     5c4:	e8 17 21 00 00       	call   26e0 <printf>
+    exit();
+     5c9:	e8 65 1f 00 00       	call   2533 <exit>
+      printf(1, "pipebench: read %d bytes\n", total);
+     5ce:	52                   	push   %edx
+     5cf:	53                   	push   %ebx
+     5d0:	68 e6 32 00 00       	push   $0x32e6
+     5d5:	6a 01                	push   $0x1
+     5d7:	e8 04 21 00 00       	call   26e0 <printf>
+      exit();
+     5dc:	e8 52 1f 00 00       	call   2533 <exit>
+     5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "pipebench write failed\n");
+     5e8:	83 ec 08             	sub    $0x8,%esp
+     5eb:	68 b1 32 00 00       	push   $0x32b1
+     5f0:	6a 01                	push   $0x1
+     5f2:	e8 e9 20 00 00       	call   26e0 <printf>
+        exit();
+     5f7:	e8 37 1f 00 00       	call   2533 <exit>
+     5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <pipepages>:
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+  pad = 4096 - (uint)a % 4096;
+     604:	bf 00 10 00 00       	mov    $0x1000,%edi
+{
+     609:	56                   	push   %esi
+     60a:	53                   	push   %ebx
+     60b:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "pipepages test\n");
+     60e:	68 0f 33 00 00       	push   $0x330f
+     613:	6a 01                	push   $0x1
+     615:	e8 c6 20 00 00       	call   26e0 <printf>
+  a = sbrk(0);
+     61a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     621:	e8 95 1f 00 00       	call   25bb <sbrk>
+  pad = 4096 - (uint)a % 4096;
+     626:	89 c1                	mov    %eax,%ecx
+  a = sbrk(0);
+     628:	89 c3                	mov    %eax,%ebx
+  if(sbrk(pad + 4*4096) == (char*)-1){
+     62a:	b8 00 50 00 00       	mov    $0x5000,%eax
+  pad = 4096 - (uint)a % 4096;
+     62f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  if(sbrk(pad + 4*4096) == (char*)-1){
+     635:	29 c8                	sub    %ecx,%eax
+  pad = 4096 - (uint)a % 4096;
+     637:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+     63a:	29 cf                	sub    %ecx,%edi
+  if(sbrk(pad + 4*4096) == (char*)-1){
+     63c:	89 04 24             	mov    %eax,(%esp)
+     63f:	e8 77 1f 00 00       	call   25bb <sbrk>
+     644:	83 c4 10             	add    $0x10,%esp
+     647:	83 f8 ff             	cmp    $0xffffffff,%eax
+     64a:	0f 84 7d 02 00 00    	je     8cd <pipepages+0x2cd>
+  if(pipe(fds) != 0){
+     650:	83 ec 0c             	sub    $0xc,%esp
+     653:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  a += pad;
+     656:	01 fb                	add    %edi,%ebx
+  if(pipe(fds) != 0){
+     658:	50                   	push   %eax
+     659:	e8 e5 1e 00 00       	call   2543 <pipe>
+     65e:	83 c4 10             	add    $0x10,%esp
+     661:	85 c0                	test   %eax,%eax
+     663:	0f 85 51 02 00 00    	jne    8ba <pipepages+0x2ba>
+  t0 = uptime();
+     669:	e8 5d 1f 00 00       	call   25cb <uptime>
+     66e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  pid = fork();
+     671:	e8 b5 1e 00 00       	call   252b <fork>
+     676:	89 c7                	mov    %eax,%edi
+  if(pid == 0){
+     678:	85 c0                	test   %eax,%eax
+     67a:	0f 84 8b 01 00 00    	je     80b <pipepages+0x20b>
+  } else if(pid < 0){
+     680:	0f 88 21 02 00 00    	js     8a7 <pipepages+0x2a7>
+  close(fds[1]);
+     686:	83 ec 0c             	sub    $0xc,%esp
+     689:	ff 75 e4             	push   -0x1c(%ebp)
+     68c:	e8 ca 1e 00 00       	call   255b <close>
+  for(round = 0; round < 256; round++){
+     691:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  close(fds[1]);
+     694:	83 c4 10             	add    $0x10,%esp
+  for(round = 0; round < 256; round++){
+     697:	31 d2                	xor    %edx,%edx
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(round % 8 == 7){
+     6a0:	89 d0                	mov    %edx,%eax
+     6a2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     6a5:	8b 7d cc             	mov    -0x34(%ebp),%edi
+    for(pg = 0; pg < 4; pg++){
+     6a8:	31 f6                	xor    %esi,%esi
+      if(round % 8 == 7){
+     6aa:	83 e0 07             	and    $0x7,%eax
+     6ad:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     6b0:	83 7d d0 07          	cmpl   $0x7,-0x30(%ebp)
+        i = read(fds[0], a + pg*4096, 4096);
+     6b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      if(round % 8 == 7){
+     6b7:	0f 84 c3 00 00 00    	je     780 <pipepages+0x180>
+        i = read(fds[0], a + pg*4096, 4096);
+     6bd:	83 ec 04             	sub    $0x4,%esp
+     6c0:	68 00 10 00 00       	push   $0x1000
+     6c5:	57                   	push   %edi
+     6c6:	50                   	push   %eax
+     6c7:	e8 7f 1e 00 00       	call   254b <read>
+     6cc:	83 c4 10             	add    $0x10,%esp
+     6cf:	89 c3                	mov    %eax,%ebx
+      if(i != 4096){
+     6d1:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     6d7:	0f 85 f6 00 00 00    	jne    7d3 <pipepages+0x1d3>
+      if(a[pg*4096] != (char)round || a[pg*4096 + 4095] != pg){
+     6dd:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+     6e1:	38 07                	cmp    %al,(%edi)
+     6e3:	0f 85 94 01 00 00    	jne    87d <pipepages+0x27d>
+     6e9:	0f be 87 ff 0f 00 00 	movsbl 0xfff(%edi),%eax
+     6f0:	39 f0                	cmp    %esi,%eax
+     6f2:	0f 85 85 01 00 00    	jne    87d <pipepages+0x27d>
+    for(pg = 0; pg < 4; pg++){
+     6f8:	83 c6 01             	add    $0x1,%esi
+      a[pg*4096] = -1;
+     6fb:	c6 07 ff             	movb   $0xff,(%edi)
+    for(pg = 0; pg < 4; pg++){
+     6fe:	81 c7 00 10 00 00    	add    $0x1000,%edi
+     704:	83 fe 04             	cmp    $0x4,%esi
+     707:	75 a7                	jne    6b0 <pipepages+0xb0>
+  for(round = 0; round < 256; round++){
+     709:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     70c:	83 c2 01             	add    $0x1,%edx
+     70f:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+     715:	75 89                	jne    6a0 <pipepages+0xa0>
+  if(read(fds[0], buf, 1) != 0){
+     717:	83 ec 04             	sub    $0x4,%esp
+     71a:	6a 01                	push   $0x1
+     71c:	68 80 43 00 00       	push   $0x4380
+     721:	ff 75 e0             	push   -0x20(%ebp)
+     724:	e8 22 1e 00 00       	call   254b <read>
+     729:	83 c4 10             	add    $0x10,%esp
+     72c:	85 c0                	test   %eax,%eax
+     72e:	0f 85 ac 01 00 00    	jne    8e0 <pipepages+0x2e0>
+  close(fds[0]);
+     734:	83 ec 0c             	sub    $0xc,%esp
+     737:	ff 75 e0             	push   -0x20(%ebp)
+     73a:	e8 1c 1e 00 00       	call   255b <close>
+  wait();
+     73f:	e8 f7 1d 00 00       	call   253b <wait>
+  sbrk(-(pad + 4*4096));
+     744:	8b 75 c8             	mov    -0x38(%ebp),%esi
+     747:	81 ee 00 50 00 00    	sub    $0x5000,%esi
+     74d:	89 34 24             	mov    %esi,(%esp)
+     750:	e8 66 1e 00 00       	call   25bb <sbrk>
+  printf(1, "pipepages ok, 4096 KB in %d ticks\n", uptime() - t0);
+     755:	e8 71 1e 00 00       	call   25cb <uptime>
+     75a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     75d:	83 c4 0c             	add    $0xc,%esp
+     760:	29 c8                	sub    %ecx,%eax
+     762:	50                   	push   %eax
+     763:	68 7c 38 00 00       	push   $0x387c
+     768:	6a 01                	push   $0x1
+     76a:	e8 71 1f 00 00       	call   26e0 <printf>
+}
+     76f:	83 c4 10             	add    $0x10,%esp
+     772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     775:	5b                   	pop    %ebx
+     776:	5e                   	pop    %esi
+     777:	5f                   	pop    %edi
+     778:	5d                   	pop    %ebp
+     779:	c3                   	ret
+     77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        for(i = 0; i < 4096; i += n)
+     780:	31 db                	xor    %ebx,%ebx
+     782:	eb 0e                	jmp    792 <pipepages+0x192>
+     784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     788:	01 c3                	add    %eax,%ebx
+     78a:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+     790:	7f 5e                	jg     7f0 <pipepages+0x1f0>
+          if((n = read(fds[0], buf + i, 4096 - i < 1000 ? 4096 - i : 1000)) <= 0)
+     792:	b8 00 10 00 00       	mov    $0x1000,%eax
+     797:	ba e8 03 00 00       	mov    $0x3e8,%edx
+     79c:	83 ec 04             	sub    $0x4,%esp
+     79f:	29 d8                	sub    %ebx,%eax
+     7a1:	39 d0                	cmp    %edx,%eax
+     7a3:	0f 4f c2             	cmovg  %edx,%eax
+     7a6:	50                   	push   %eax
+     7a7:	8d 83 80 43 00 00    	lea    0x4380(%ebx),%eax
+     7ad:	50                   	push   %eax
+     7ae:	ff 75 e0             	push   -0x20(%ebp)
+     7b1:	e8 95 1d 00 00       	call   254b <read>
+     7b6:	83 c4 10             	add    $0x10,%esp
+     7b9:	85 c0                	test   %eax,%eax
+     7bb:	7f cb                	jg     788 <pipepages+0x188>
+        memmove(a + pg*4096, buf, 4096);
+     7bd:	83 ec 04             	sub    $0x4,%esp
+     7c0:	68 00 10 00 00       	push   $0x1000
+     7c5:	68 80 43 00 00       	push   $0x4380
+     7ca:	57                   	push   %edi
+     7cb:	e8 30 1d 00 00       	call   2500 <memmove>
+     7d0:	83 c4 10             	add    $0x10,%esp
+        printf(1, "pipepages: short read\n");
+     7d3:	83 ec 08             	sub    $0x8,%esp
+     7d6:	68 4f 33 00 00       	push   $0x334f
+     7db:	6a 01                	push   $0x1
+     7dd:	e8 fe 1e 00 00       	call   26e0 <printf>
+        exit();
+     7e2:	e8 4c 1d 00 00       	call   2533 <exit>
+     7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ee:	66 90                	xchg   %ax,%ax
+        memmove(a + pg*4096, buf, 4096);
+     7f0:	83 ec 04             	sub    $0x4,%esp
+     7f3:	68 00 10 00 00       	push   $0x1000
+     7f8:	68 80 43 00 00       	push   $0x4380
+     7fd:	57                   	push   %edi
+     7fe:	e8 fd 1c 00 00       	call   2500 <memmove>
+     803:	83 c4 10             	add    $0x10,%esp
+     806:	e9 c6 fe ff ff       	jmp    6d1 <pipepages+0xd1>
+    close(fds[0]);
+     80b:	83 ec 0c             	sub    $0xc,%esp
+     80e:	ff 75 e0             	push   -0x20(%ebp)
+     811:	e8 45 1d 00 00       	call   255b <close>
+     816:	83 c4 10             	add    $0x10,%esp
+     819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        a[pg*4096] = round;
+     820:	89 f8                	mov    %edi,%eax
+      if(write(fds[1], a, 4*4096) != 4*4096){
+     822:	83 ec 04             	sub    $0x4,%esp
+        a[pg*4096 + 4095] = pg;
+     825:	c6 83 ff 0f 00 00 00 	movb   $0x0,0xfff(%ebx)
+        a[pg*4096] = round;
+     82c:	88 03                	mov    %al,(%ebx)
+     82e:	88 83 00 10 00 00    	mov    %al,0x1000(%ebx)
+        a[pg*4096 + 4095] = pg;
+     834:	c6 83 ff 1f 00 00 01 	movb   $0x1,0x1fff(%ebx)
+        a[pg*4096] = round;
+     83b:	88 83 00 20 00 00    	mov    %al,0x2000(%ebx)
+        a[pg*4096 + 4095] = pg;
+     841:	c6 83 ff 2f 00 00 02 	movb   $0x2,0x2fff(%ebx)
+        a[pg*4096] = round;
+     848:	88 83 00 30 00 00    	mov    %al,0x3000(%ebx)
+        a[pg*4096 + 4095] = pg;
+     84e:	c6 83 ff 3f 00 00 03 	movb   $0x3,0x3fff(%ebx)
+      if(write(fds[1], a, 4*4096) != 4*4096){
+     855:	68 00 40 00 00       	push   $0x4000
+     85a:	53                   	push   %ebx
+     85b:	ff 75 e4             	push   -0x1c(%ebp)
+     85e:	e8 f0 1c 00 00       	call   2553 <write>
+     863:	83 c4 10             	add    $0x10,%esp
+     866:	3d 00 40 00 00       	cmp    $0x4000,%eax
+     86b:	75 26                	jne    893 <pipepages+0x293>
+    for(round = 0; round < 256; round++){
+     86d:	83 c7 01             	add    $0x1,%edi
+     870:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+     876:	75 a8                	jne    820 <pipepages+0x220>
+    exit();
+     878:	e8 b6 1c 00 00       	call   2533 <exit>
+        printf(1, "pipepages: round %d page %d wrong\n", round, pg);
+     87d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     880:	56                   	push   %esi
+     881:	52                   	push   %edx
+     882:	68 58 38 00 00       	push   $0x3858
+     887:	6a 01                	push   $0x1
+     889:	e8 52 1e 00 00       	call   26e0 <printf>
+        exit();
+     88e:	e8 a0 1c 00 00       	call   2533 <exit>
+        printf(1, "pipepages write failed\n");
+     893:	83 ec 08             	sub    $0x8,%esp
+     896:	68 37 33 00 00       	push   $0x3337
+     89b:	6a 01                	push   $0x1
+     89d:	e8 3e 1e 00 00       	call   26e0 <printf>
+        exit();
+     8a2:	e8 8c 1c 00 00       	call   2533 <exit>
+    printf(1, "fork() failed\n");
+     8a7:	52                   	push   %edx
+     8a8:	52                   	push   %edx
+     8a9:	68 00 33 00 00       	push   $0x3300
+     8ae:	6a 01                	push   $0x1
+     8b0:	e8 2b 1e 00 00       	call   26e0 <printf>
+    exit();
+     8b5:	e8 79 1c 00 00       	call   2533 <exit>
+    printf(1, "pipe() failed\n");
+     8ba:	51                   	push   %ecx
+     8bb:	51                   	push   %ecx
+     8bc:	68 a2 32 00 00       	push   $0x32a2
+     8c1:	6a 01                	push   $0x1
+     8c3:	e8 18 1e 00 00       	call   26e0 <printf>
+    exit();
+     8c8:	e8 66 1c 00 00       	call   2533 <exit>
+    printf(1, "pipepages: sbrk failed\n");
+     8cd:	53                   	push   %ebx
+     8ce:	53                   	push   %ebx
+     8cf:	68 1f 33 00 00       	push   $0x331f
+     8d4:	6a 01                	push   $0x1
+     8d6:	e8 05 1e 00 00       	call   26e0 <printf>
+    exit();
+     8db:	e8 53 1c 00 00       	call   2533 <exit>
+    printf(1, "pipepages: extra data\n");
+     8e0:	50                   	push   %eax
+     8e1:	50                   	push   %eax
+     8e2:	68 66 33 00 00       	push   $0x3366
+     8e7:	6a 01                	push   $0x1
+     8e9:	e8 f2 1d 00 00       	call   26e0 <printf>
+    exit();
+     8ee:	e8 40 1c 00 00       	call   2533 <exit>
+     8f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000900 <cowoom>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	53                   	push   %ebx
+     904:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "cowoom test\n");
+     907:	68 7d 33 00 00       	push   $0x337d
+     90c:	6a 01                	push   $0x1
+     90e:	e8 cd 1d 00 00       	call   26e0 <printf>
+  pid = fork();
+     913:	e8 13 1c 00 00       	call   252b <fork>
+  if(pid == 0){
+     918:	83 c4 10             	add    $0x10,%esp
+     91b:	85 c0                	test   %eax,%eax
+     91d:	74 11                	je     930 <cowoom+0x30>
+  } else if(pid < 0){
+     91f:	0f 88 0a 01 00 00    	js     a2f <cowoom+0x12f>
+}
+     925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     928:	c9                   	leave
+  wait();
+     929:	e9 0d 1c 00 00       	jmp    253b <wait>
+     92e:	66 90                	xchg   %ax,%ax
+    a = sbrk(0);
+     930:	83 ec 0c             	sub    $0xc,%esp
+     933:	6a 00                	push   $0x0
+     935:	e8 81 1c 00 00       	call   25bb <sbrk>
+    a = sbrk(4096 - (uint)a % 4096 + 4096) + (4096 - (uint)a % 4096);
+     93a:	25 ff 0f 00 00       	and    $0xfff,%eax
+     93f:	89 c3                	mov    %eax,%ebx
+     941:	b8 00 20 00 00       	mov    $0x2000,%eax
+     946:	29 d8                	sub    %ebx,%eax
+     948:	89 04 24             	mov    %eax,(%esp)
+     94b:	e8 6b 1c 00 00       	call   25bb <sbrk>
+     950:	29 d8                	sub    %ebx,%eax
+     952:	8d 98 00 10 00 00    	lea    0x1000(%eax),%ebx
+    if(pipe(fds) != 0 || write(fds[1], a, 4096) != 4096){
+     958:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     95b:	89 04 24             	mov    %eax,(%esp)
+     95e:	e8 e0 1b 00 00       	call   2543 <pipe>
+     963:	83 c4 10             	add    $0x10,%esp
+     966:	85 c0                	test   %eax,%eax
+     968:	0f 85 ae 00 00 00    	jne    a1c <cowoom+0x11c>
+     96e:	83 ec 04             	sub    $0x4,%esp
+     971:	68 00 10 00 00       	push   $0x1000
+     976:	53                   	push   %ebx
+     977:	ff 75 f4             	push   -0xc(%ebp)
+     97a:	e8 d4 1b 00 00       	call   2553 <write>
+     97f:	83 c4 10             	add    $0x10,%esp
+     982:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     987:	0f 85 8f 00 00 00    	jne    a1c <cowoom+0x11c>
+    write(fds[1], "x", 1);
+     98d:	83 ec 04             	sub    $0x4,%esp
+     990:	6a 01                	push   $0x1
+     992:	68 2f 35 00 00       	push   $0x352f
+     997:	ff 75 f4             	push   -0xc(%ebp)
+     99a:	e8 b4 1b 00 00       	call   2553 <write>
+    while(sbrk(4096) != (char*)-1)
+     99f:	83 c4 10             	add    $0x10,%esp
+     9a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     9a8:	83 ec 0c             	sub    $0xc,%esp
+     9ab:	68 00 10 00 00       	push   $0x1000
+     9b0:	e8 06 1c 00 00       	call   25bb <sbrk>
+     9b5:	83 c4 10             	add    $0x10,%esp
+     9b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9bb:	75 eb                	jne    9a8 <cowoom+0xa8>
+    if(read(fds[0], a + 1, 10) != -1 ||
+     9bd:	83 ec 04             	sub    $0x4,%esp
+     9c0:	8d 43 01             	lea    0x1(%ebx),%eax
+     9c3:	6a 0a                	push   $0xa
+     9c5:	50                   	push   %eax
+     9c6:	ff 75 f0             	push   -0x10(%ebp)
+     9c9:	e8 7d 1b 00 00       	call   254b <read>
+     9ce:	83 c4 10             	add    $0x10,%esp
+     9d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9d4:	75 17                	jne    9ed <cowoom+0xed>
+       fstat(fds[0], (struct stat*)(a + 8)) != -1){
+     9d6:	83 ec 08             	sub    $0x8,%esp
+     9d9:	83 c3 08             	add    $0x8,%ebx
+     9dc:	53                   	push   %ebx
+     9dd:	ff 75 f0             	push   -0x10(%ebp)
+     9e0:	e8 a6 1b 00 00       	call   258b <fstat>
+    if(read(fds[0], a + 1, 10) != -1 ||
+     9e5:	83 c4 10             	add    $0x10,%esp
+     9e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9eb:	74 1b                	je     a08 <cowoom+0x108>
+      printf(1, "cowoom: read into a shared page with no memory\n");
+     9ed:	83 ec 08             	sub    $0x8,%esp
+     9f0:	68 a0 38 00 00       	push   $0x38a0
+     9f5:	6a 01                	push   $0x1
+     9f7:	e8 e4 1c 00 00       	call   26e0 <printf>
+      exit();
+     9fc:	e8 32 1b 00 00       	call   2533 <exit>
+     a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "cowoom ok\n");
+     a08:	83 ec 08             	sub    $0x8,%esp
+     a0b:	68 a5 33 00 00       	push   $0x33a5
+     a10:	6a 01                	push   $0x1
+     a12:	e8 c9 1c 00 00       	call   26e0 <printf>
+    exit();
+     a17:	e8 17 1b 00 00       	call   2533 <exit>
+      printf(1, "cowoom: pipe write failed\n");
+     a1c:	52                   	push   %edx
+     a1d:	52                   	push   %edx
+     a1e:	68 8a 33 00 00       	push   $0x338a
+     a23:	6a 01                	push   $0x1
+     a25:	e8 b6 1c 00 00       	call   26e0 <printf>
+      exit();
+     a2a:	e8 04 1b 00 00       	call   2533 <exit>
+    printf(1, "fork() failed\n");
+     a2f:	50                   	push   %eax
+     a30:	50                   	push   %eax
+     a31:	68 00 33 00 00       	push   $0x3300
+     a36:	6a 01                	push   $0x1
+     a38:	e8 a3 1c 00 00       	call   26e0 <printf>
+    exit();
+     a3d:	e8 f1 1a 00 00       	call   2533 <exit>
+     a42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <polltest>:
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	57                   	push   %edi
+     a54:	56                   	push   %esi
+     a55:	53                   	push   %ebx
+     a56:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "poll test\n");
+     a59:	68 b0 33 00 00       	push   $0x33b0
+     a5e:	6a 01                	push   $0x1
+     a60:	e8 7b 1c 00 00       	call   26e0 <printf>
+  if(pipe(a) != 0 || pipe(b) != 0){
+     a65:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     a68:	89 04 24             	mov    %eax,(%esp)
+     a6b:	e8 d3 1a 00 00       	call   2543 <pipe>
+     a70:	83 c4 10             	add    $0x10,%esp
+     a73:	85 c0                	test   %eax,%eax
+     a75:	0f 85 a7 01 00 00    	jne    c22 <polltest+0x1d2>
+     a7b:	83 ec 0c             	sub    $0xc,%esp
+     a7e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     a81:	50                   	push   %eax
+     a82:	e8 bc 1a 00 00       	call   2543 <pipe>
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	85 c0                	test   %eax,%eax
+     a8c:	0f 85 90 01 00 00    	jne    c22 <polltest+0x1d2>
+  pfd[0].fd = a[0];
+     a92:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  if(poll(pfd, 3, 0) != 1 || pfd[0].revents || pfd[1].revents ||
+     a95:	83 ec 04             	sub    $0x4,%esp
+     a98:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+  pfd[0].fd = a[0];
+     a9b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  pfd[0].events = POLLIN;
+     a9e:	b8 01 00 00 00       	mov    $0x1,%eax
+     aa3:	66 89 45 d4          	mov    %ax,-0x2c(%ebp)
+  pfd[1].fd = b[0];
+     aa7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     aaa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  pfd[1].events = POLLIN;
+     aad:	b8 01 00 00 00       	mov    $0x1,%eax
+     ab2:	66 89 45 dc          	mov    %ax,-0x24(%ebp)
+  pfd[2].fd = a[1];
+     ab6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ab9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  pfd[2].events = POLLOUT;
+     abc:	b8 04 00 00 00       	mov    $0x4,%eax
+     ac1:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+  if(poll(pfd, 3, 0) != 1 || pfd[0].revents || pfd[1].revents ||
+     ac5:	6a 00                	push   $0x0
+     ac7:	6a 03                	push   $0x3
+     ac9:	53                   	push   %ebx
+     aca:	e8 04 1b 00 00       	call   25d3 <poll>
+     acf:	83 c4 10             	add    $0x10,%esp
+     ad2:	83 f8 01             	cmp    $0x1,%eax
+     ad5:	0f 85 1f 01 00 00    	jne    bfa <polltest+0x1aa>
+     adb:	0f b7 45 d6          	movzwl -0x2a(%ebp),%eax
+     adf:	66 0b 45 de          	or     -0x22(%ebp),%ax
+     ae3:	0f 85 11 01 00 00    	jne    bfa <polltest+0x1aa>
+     ae9:	66 83 7d e6 04       	cmpw   $0x4,-0x1a(%ebp)
+     aee:	0f 85 06 01 00 00    	jne    bfa <polltest+0x1aa>
+  if(poll(pfd, 2, 3) != 0){
+     af4:	83 ec 04             	sub    $0x4,%esp
+     af7:	6a 03                	push   $0x3
+     af9:	6a 02                	push   $0x2
+     afb:	53                   	push   %ebx
+     afc:	e8 d2 1a 00 00       	call   25d3 <poll>
+     b01:	83 c4 10             	add    $0x10,%esp
+     b04:	85 c0                	test   %eax,%eax
+     b06:	0f 85 29 01 00 00    	jne    c35 <polltest+0x1e5>
+  pid = fork();
+     b0c:	e8 1a 1a 00 00       	call   252b <fork>
+  if(pid == 0){
+     b11:	85 c0                	test   %eax,%eax
+     b13:	0f 84 42 01 00 00    	je     c5b <polltest+0x20b>
+  } else if(pid < 0){
+     b19:	0f 88 29 01 00 00    	js     c48 <polltest+0x1f8>
+  n = poll(pfd, 2, -1);
+     b1f:	83 ec 04             	sub    $0x4,%esp
+     b22:	6a ff                	push   $0xffffffff
+     b24:	6a 02                	push   $0x2
+     b26:	53                   	push   %ebx
+     b27:	e8 a7 1a 00 00       	call   25d3 <poll>
+  if(n != 1 || pfd[0].revents || pfd[1].revents != POLLIN ||
+     b2c:	83 c4 10             	add    $0x10,%esp
+  n = poll(pfd, 2, -1);
+     b2f:	89 c6                	mov    %eax,%esi
+  if(n != 1 || pfd[0].revents || pfd[1].revents != POLLIN ||
+     b31:	83 f8 01             	cmp    $0x1,%eax
+     b34:	0f 85 ab 00 00 00    	jne    be5 <polltest+0x195>
+     b3a:	66 83 7d d6 00       	cmpw   $0x0,-0x2a(%ebp)
+     b3f:	0f 85 a0 00 00 00    	jne    be5 <polltest+0x195>
+     b45:	66 83 7d de 01       	cmpw   $0x1,-0x22(%ebp)
+     b4a:	0f 85 95 00 00 00    	jne    be5 <polltest+0x195>
+     read(b[0], &c, 1) != 1 || c != 'x'){
+     b50:	83 ec 04             	sub    $0x4,%esp
+     b53:	8d 7d bf             	lea    -0x41(%ebp),%edi
+     b56:	6a 01                	push   $0x1
+     b58:	57                   	push   %edi
+     b59:	ff 75 c8             	push   -0x38(%ebp)
+     b5c:	e8 ea 19 00 00       	call   254b <read>
+  if(n != 1 || pfd[0].revents || pfd[1].revents != POLLIN ||
+     b61:	83 c4 10             	add    $0x10,%esp
+     b64:	83 f8 01             	cmp    $0x1,%eax
+     b67:	75 7c                	jne    be5 <polltest+0x195>
+     read(b[0], &c, 1) != 1 || c != 'x'){
+     b69:	80 7d bf 78          	cmpb   $0x78,-0x41(%ebp)
+     b6d:	75 76                	jne    be5 <polltest+0x195>
+  wait();
+     b6f:	e8 c7 19 00 00       	call   253b <wait>
+  close(b[1]);
+     b74:	83 ec 0c             	sub    $0xc,%esp
+     b77:	ff 75 cc             	push   -0x34(%ebp)
+     b7a:	e8 dc 19 00 00       	call   255b <close>
+  if(poll(pfd, 2, -1) != 1 || !(pfd[1].revents & POLLHUP) ||
+     b7f:	83 c4 0c             	add    $0xc,%esp
+     b82:	6a ff                	push   $0xffffffff
+     b84:	6a 02                	push   $0x2
+     b86:	53                   	push   %ebx
+     b87:	e8 47 1a 00 00       	call   25d3 <poll>
+     b8c:	83 c4 10             	add    $0x10,%esp
+     b8f:	83 f8 01             	cmp    $0x1,%eax
+     b92:	75 7a                	jne    c0e <polltest+0x1be>
+     b94:	f6 45 de 10          	testb  $0x10,-0x22(%ebp)
+     b98:	74 74                	je     c0e <polltest+0x1be>
+     read(b[0], &c, 1) != 0){
+     b9a:	83 ec 04             	sub    $0x4,%esp
+     b9d:	6a 01                	push   $0x1
+     b9f:	57                   	push   %edi
+     ba0:	ff 75 c8             	push   -0x38(%ebp)
+     ba3:	e8 a3 19 00 00       	call   254b <read>
+  if(poll(pfd, 2, -1) != 1 || !(pfd[1].revents & POLLHUP) ||
+     ba8:	83 c4 10             	add    $0x10,%esp
+     bab:	85 c0                	test   %eax,%eax
+     bad:	75 5f                	jne    c0e <polltest+0x1be>
+  close(a[0]);
+     baf:	83 ec 0c             	sub    $0xc,%esp
+     bb2:	ff 75 c0             	push   -0x40(%ebp)
+     bb5:	e8 a1 19 00 00       	call   255b <close>
+  close(a[1]);
+     bba:	58                   	pop    %eax
+     bbb:	ff 75 c4             	push   -0x3c(%ebp)
+     bbe:	e8 98 19 00 00       	call   255b <close>
+  close(b[0]);
+     bc3:	5a                   	pop    %edx
+     bc4:	ff 75 c8             	push   -0x38(%ebp)
+     bc7:	e8 8f 19 00 00       	call   255b <close>
+  printf(1, "poll ok\n");
+     bcc:	59                   	pop    %ecx
+     bcd:	5b                   	pop    %ebx
+     bce:	68 eb 33 00 00       	push   $0x33eb
+     bd3:	6a 01                	push   $0x1
+     bd5:	e8 06 1b 00 00       	call   26e0 <printf>
+}
+     bda:	83 c4 10             	add    $0x10,%esp
+     bdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be0:	5b                   	pop    %ebx
+     be1:	5e                   	pop    %esi
+     be2:	5f                   	pop    %edi
+     be3:	5d                   	pop    %ebp
+     be4:	c3                   	ret
+    printf(1, "poll: wrong wakeup, %d ready\n", n);
+     be5:	83 ec 04             	sub    $0x4,%esp
+     be8:	56                   	push   %esi
+     be9:	68 cd 33 00 00       	push   $0x33cd
+     bee:	6a 01                	push   $0x1
+     bf0:	e8 eb 1a 00 00       	call   26e0 <printf>
+    exit();
+     bf5:	e8 39 19 00 00       	call   2533 <exit>
+    printf(1, "poll: empty pipes not reported right\n");
+     bfa:	83 ec 08             	sub    $0x8,%esp
+     bfd:	68 d0 38 00 00       	push   $0x38d0
+     c02:	6a 01                	push   $0x1
+     c04:	e8 d7 1a 00 00       	call   26e0 <printf>
+    exit();
+     c09:	e8 25 19 00 00       	call   2533 <exit>
+    printf(1, "poll: closed pipe not reported\n");
+     c0e:	83 ec 08             	sub    $0x8,%esp
+     c11:	68 f8 38 00 00       	push   $0x38f8
+     c16:	6a 01                	push   $0x1
+     c18:	e8 c3 1a 00 00       	call   26e0 <printf>
+    exit();
+     c1d:	e8 11 19 00 00       	call   2533 <exit>
+    printf(1, "pipe() failed\n");
+     c22:	50                   	push   %eax
+     c23:	50                   	push   %eax
+     c24:	68 a2 32 00 00       	push   $0x32a2
+     c29:	6a 01                	push   $0x1
+     c2b:	e8 b0 1a 00 00       	call   26e0 <printf>
+    exit();
+     c30:	e8 fe 18 00 00       	call   2533 <exit>
+    printf(1, "poll: no timeout\n");
+     c35:	57                   	push   %edi
+     c36:	57                   	push   %edi
+     c37:	68 bb 33 00 00       	push   $0x33bb
+     c3c:	6a 01                	push   $0x1
+     c3e:	e8 9d 1a 00 00       	call   26e0 <printf>
+    exit();
+     c43:	e8 eb 18 00 00       	call   2533 <exit>
+    printf(1, "fork() failed\n");
+     c48:	56                   	push   %esi
+     c49:	56                   	push   %esi
+     c4a:	68 00 33 00 00       	push   $0x3300
+     c4f:	6a 01                	push   $0x1
+     c51:	e8 8a 1a 00 00       	call   26e0 <printf>
+    exit();
+     c56:	e8 d8 18 00 00       	call   2533 <exit>
+    sleep(2);
+     c5b:	83 ec 0c             	sub    $0xc,%esp
+     c5e:	6a 02                	push   $0x2
+     c60:	e8 5e 19 00 00       	call   25c3 <sleep>
+    write(b[1], "x", 1);
+     c65:	83 c4 0c             	add    $0xc,%esp
+     c68:	6a 01                	push   $0x1
+     c6a:	68 2f 35 00 00       	push   $0x352f
+     c6f:	ff 75 cc             	push   -0x34(%ebp)
+     c72:	e8 dc 18 00 00       	call   2553 <write>
+    exit();
+     c77:	e8 b7 18 00 00       	call   2533 <exit>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c80 <nonblock>:
+{
+     c80:	55                   	push   %ebp
+     c81:	89 e5                	mov    %esp,%ebp
+     c83:	56                   	push   %esi
+     c84:	53                   	push   %ebx
+     c85:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "nonblock test\n");
+     c88:	68 f4 33 00 00       	push   $0x33f4
+     c8d:	6a 01                	push   $0x1
+     c8f:	e8 4c 1a 00 00       	call   26e0 <printf>
+  if(pipe(fds) != 0){
+     c94:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     c97:	89 04 24             	mov    %eax,(%esp)
+     c9a:	e8 a4 18 00 00       	call   2543 <pipe>
+     c9f:	83 c4 10             	add    $0x10,%esp
+     ca2:	85 c0                	test   %eax,%eax
+     ca4:	0f 85 ac 01 00 00    	jne    e56 <nonblock+0x1d6>
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+     caa:	83 ec 04             	sub    $0x4,%esp
+     cad:	68 00 04 00 00       	push   $0x400
+     cb2:	6a 02                	push   $0x2
+     cb4:	ff 75 f0             	push   -0x10(%ebp)
+     cb7:	e8 1f 19 00 00       	call   25db <fcntl>
+     cbc:	83 c4 10             	add    $0x10,%esp
+     cbf:	85 c0                	test   %eax,%eax
+     cc1:	0f 85 2f 01 00 00    	jne    df6 <nonblock+0x176>
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+     cc7:	83 ec 04             	sub    $0x4,%esp
+     cca:	68 00 04 00 00       	push   $0x400
+     ccf:	6a 02                	push   $0x2
+     cd1:	ff 75 f4             	push   -0xc(%ebp)
+     cd4:	e8 02 19 00 00       	call   25db <fcntl>
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+     cd9:	83 c4 10             	add    $0x10,%esp
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+     cdc:	89 c3                	mov    %eax,%ebx
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+     cde:	85 c0                	test   %eax,%eax
+     ce0:	0f 85 10 01 00 00    	jne    df6 <nonblock+0x176>
+     fcntl(fds[0], F_GETFL, 0) != (O_RDONLY|O_NONBLOCK)){
+     ce6:	83 ec 04             	sub    $0x4,%esp
+     ce9:	6a 00                	push   $0x0
+     ceb:	6a 01                	push   $0x1
+     ced:	ff 75 f0             	push   -0x10(%ebp)
+     cf0:	e8 e6 18 00 00       	call   25db <fcntl>
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+     cf5:	83 c4 10             	add    $0x10,%esp
+     cf8:	3d 00 04 00 00       	cmp    $0x400,%eax
+     cfd:	0f 85 f3 00 00 00    	jne    df6 <nonblock+0x176>
+  if(read(fds[0], buf, 1) != EWOULDBLOCK){
+     d03:	83 ec 04             	sub    $0x4,%esp
+     d06:	6a 01                	push   $0x1
+     d08:	68 80 43 00 00       	push   $0x4380
+     d0d:	ff 75 f0             	push   -0x10(%ebp)
+     d10:	e8 36 18 00 00       	call   254b <read>
+     d15:	83 c4 10             	add    $0x10,%esp
+     d18:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     d1b:	74 11                	je     d2e <nonblock+0xae>
+     d1d:	e9 fb 00 00 00       	jmp    e1d <nonblock+0x19d>
+     d22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(total = 0; (n = write(fds[1], buf, 1000)) == 1000; total += n)
+     d28:	81 c3 e8 03 00 00    	add    $0x3e8,%ebx
+     d2e:	83 ec 04             	sub    $0x4,%esp
+     d31:	68 e8 03 00 00       	push   $0x3e8
+     d36:	68 80 43 00 00       	push   $0x4380
+     d3b:	ff 75 f4             	push   -0xc(%ebp)
+     d3e:	e8 10 18 00 00       	call   2553 <write>
+     d43:	83 c4 10             	add    $0x10,%esp
+     d46:	89 c6                	mov    %eax,%esi
+     d48:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     d4d:	74 d9                	je     d28 <nonblock+0xa8>
+  if(n < 0 || write(fds[1], buf, 1) != EWOULDBLOCK){
+     d4f:	85 c0                	test   %eax,%eax
+     d51:	0f 88 b3 00 00 00    	js     e0a <nonblock+0x18a>
+     d57:	83 ec 04             	sub    $0x4,%esp
+     d5a:	6a 01                	push   $0x1
+     d5c:	68 80 43 00 00       	push   $0x4380
+     d61:	ff 75 f4             	push   -0xc(%ebp)
+     d64:	e8 ea 17 00 00       	call   2553 <write>
+     d69:	83 c4 10             	add    $0x10,%esp
+     d6c:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     d6f:	0f 85 95 00 00 00    	jne    e0a <nonblock+0x18a>
+  total += n;
+     d75:	01 f3                	add    %esi,%ebx
+  for(n = 0; (n = read(fds[0], buf, sizeof(buf))) > 0; total -= n)
+     d77:	eb 09                	jmp    d82 <nonblock+0x102>
+     d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d80:	29 c3                	sub    %eax,%ebx
+     d82:	83 ec 04             	sub    $0x4,%esp
+     d85:	68 00 20 00 00       	push   $0x2000
+     d8a:	68 80 43 00 00       	push   $0x4380
+     d8f:	ff 75 f0             	push   -0x10(%ebp)
+     d92:	e8 b4 17 00 00       	call   254b <read>
+     d97:	83 c4 10             	add    $0x10,%esp
+     d9a:	85 c0                	test   %eax,%eax
+     d9c:	7f e2                	jg     d80 <nonblock+0x100>
+  if(n != EWOULDBLOCK || total != 0){
+     d9e:	83 f8 fe             	cmp    $0xfffffffe,%eax
+     da1:	0f 85 89 00 00 00    	jne    e30 <nonblock+0x1b0>
+     da7:	85 db                	test   %ebx,%ebx
+     da9:	0f 85 81 00 00 00    	jne    e30 <nonblock+0x1b0>
+  close(fds[1]);
+     daf:	83 ec 0c             	sub    $0xc,%esp
+     db2:	ff 75 f4             	push   -0xc(%ebp)
+     db5:	e8 a1 17 00 00       	call   255b <close>
+  if(read(fds[0], buf, 1) != 0){
+     dba:	83 c4 0c             	add    $0xc,%esp
+     dbd:	6a 01                	push   $0x1
+     dbf:	68 80 43 00 00       	push   $0x4380
+     dc4:	ff 75 f0             	push   -0x10(%ebp)
+     dc7:	e8 7f 17 00 00       	call   254b <read>
+     dcc:	83 c4 10             	add    $0x10,%esp
+     dcf:	85 c0                	test   %eax,%eax
+     dd1:	75 70                	jne    e43 <nonblock+0x1c3>
+  close(fds[0]);
+     dd3:	83 ec 0c             	sub    $0xc,%esp
+     dd6:	ff 75 f0             	push   -0x10(%ebp)
+     dd9:	e8 7d 17 00 00       	call   255b <close>
+  printf(1, "nonblock ok\n");
+     dde:	58                   	pop    %eax
+     ddf:	5a                   	pop    %edx
+     de0:	68 35 34 00 00       	push   $0x3435
+     de5:	6a 01                	push   $0x1
+     de7:	e8 f4 18 00 00       	call   26e0 <printf>
+}
+     dec:	83 c4 10             	add    $0x10,%esp
+     def:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     df2:	5b                   	pop    %ebx
+     df3:	5e                   	pop    %esi
+     df4:	5d                   	pop    %ebp
+     df5:	c3                   	ret
+    printf(1, "nonblock: fcntl failed\n");
+     df6:	83 ec 08             	sub    $0x8,%esp
+     df9:	68 03 34 00 00       	push   $0x3403
+     dfe:	6a 01                	push   $0x1
+     e00:	e8 db 18 00 00       	call   26e0 <printf>
+    exit();
+     e05:	e8 29 17 00 00       	call   2533 <exit>
+    printf(1, "nonblock: write to full pipe did not fail\n");
+     e0a:	50                   	push   %eax
+     e0b:	50                   	push   %eax
+     e0c:	68 44 39 00 00       	push   $0x3944
+     e11:	6a 01                	push   $0x1
+     e13:	e8 c8 18 00 00       	call   26e0 <printf>
+    exit();
+     e18:	e8 16 17 00 00       	call   2533 <exit>
+    printf(1, "nonblock: read of empty pipe did not fail\n");
+     e1d:	50                   	push   %eax
+     e1e:	50                   	push   %eax
+     e1f:	68 18 39 00 00       	push   $0x3918
+     e24:	6a 01                	push   $0x1
+     e26:	e8 b5 18 00 00       	call   26e0 <printf>
+    exit();
+     e2b:	e8 03 17 00 00       	call   2533 <exit>
+    printf(1, "nonblock: read back %d too few bytes\n", total);
+     e30:	56                   	push   %esi
+     e31:	53                   	push   %ebx
+     e32:	68 70 39 00 00       	push   $0x3970
+     e37:	6a 01                	push   $0x1
+     e39:	e8 a2 18 00 00       	call   26e0 <printf>
+    exit();
+     e3e:	e8 f0 16 00 00       	call   2533 <exit>
+    printf(1, "nonblock: no end of file\n");
+     e43:	51                   	push   %ecx
+     e44:	51                   	push   %ecx
+     e45:	68 1b 34 00 00       	push   $0x341b
+     e4a:	6a 01                	push   $0x1
+     e4c:	e8 8f 18 00 00       	call   26e0 <printf>
+    exit();
+     e51:	e8 dd 16 00 00       	call   2533 <exit>
+    printf(1, "pipe() failed\n");
+     e56:	50                   	push   %eax
+     e57:	50                   	push   %eax
+     e58:	68 a2 32 00 00       	push   $0x32a2
+     e5d:	6a 01                	push   $0x1
+     e5f:	e8 7c 18 00 00       	call   26e0 <printf>
+    exit();
+     e64:	e8 ca 16 00 00       	call   2533 <exit>
+     e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e70 <seektest>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+     e75:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "seek test\n");
+     e78:	68 42 34 00 00       	push   $0x3442
+     e7d:	6a 01                	push   $0x1
+     e7f:	e8 5c 18 00 00       	call   26e0 <printf>
+  fd = open("seekfile", O_CREATE|O_RDWR);
+     e84:	5b                   	pop    %ebx
+     e85:	5e                   	pop    %esi
+     e86:	68 02 02 00 00       	push   $0x202
+     e8b:	68 4d 34 00 00       	push   $0x344d
+     e90:	e8 de 16 00 00       	call   2573 <open>
+  if(fd < 0 || write(fd, "abcdefghij", 10) != 10){
+     e95:	83 c4 10             	add    $0x10,%esp
+     e98:	85 c0                	test   %eax,%eax
+     e9a:	0f 88 b6 01 00 00    	js     1056 <seektest+0x1e6>
+     ea0:	83 ec 04             	sub    $0x4,%esp
+     ea3:	89 c3                	mov    %eax,%ebx
+     ea5:	6a 0a                	push   $0xa
+     ea7:	68 6b 34 00 00       	push   $0x346b
+     eac:	50                   	push   %eax
+     ead:	e8 a1 16 00 00       	call   2553 <write>
+     eb2:	83 c4 10             	add    $0x10,%esp
+     eb5:	83 f8 0a             	cmp    $0xa,%eax
+     eb8:	0f 85 98 01 00 00    	jne    1056 <seektest+0x1e6>
+  if(lseek(fd, 3, SEEK_SET) != 3 || read(fd, b, 2) != 2 ||
+     ebe:	83 ec 04             	sub    $0x4,%esp
+     ec1:	6a 00                	push   $0x0
+     ec3:	6a 03                	push   $0x3
+     ec5:	53                   	push   %ebx
+     ec6:	e8 18 17 00 00       	call   25e3 <lseek>
+     ecb:	83 c4 10             	add    $0x10,%esp
+     ece:	83 f8 03             	cmp    $0x3,%eax
+     ed1:	0f 85 57 01 00 00    	jne    102e <seektest+0x1be>
+     ed7:	83 ec 04             	sub    $0x4,%esp
+     eda:	8d 75 f4             	lea    -0xc(%ebp),%esi
+     edd:	6a 02                	push   $0x2
+     edf:	56                   	push   %esi
+     ee0:	53                   	push   %ebx
+     ee1:	e8 65 16 00 00       	call   254b <read>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	83 f8 02             	cmp    $0x2,%eax
+     eec:	0f 85 3c 01 00 00    	jne    102e <seektest+0x1be>
+     ef2:	80 7d f4 64          	cmpb   $0x64,-0xc(%ebp)
+     ef6:	0f 85 32 01 00 00    	jne    102e <seektest+0x1be>
+     b[0] != 'd' || b[1] != 'e' || lseek(fd, -1, SEEK_CUR) != 4 ||
+     efc:	80 7d f5 65          	cmpb   $0x65,-0xb(%ebp)
+     f00:	0f 85 28 01 00 00    	jne    102e <seektest+0x1be>
+     f06:	83 ec 04             	sub    $0x4,%esp
+     f09:	6a 01                	push   $0x1
+     f0b:	6a ff                	push   $0xffffffff
+     f0d:	53                   	push   %ebx
+     f0e:	e8 d0 16 00 00       	call   25e3 <lseek>
+     f13:	83 c4 10             	add    $0x10,%esp
+     f16:	83 f8 04             	cmp    $0x4,%eax
+     f19:	0f 85 0f 01 00 00    	jne    102e <seektest+0x1be>
+     lseek(fd, 0, SEEK_END) != 10 || lseek(fd, 1, SEEK_END) != -1 ||
+     f1f:	83 ec 04             	sub    $0x4,%esp
+     f22:	6a 02                	push   $0x2
+     f24:	6a 00                	push   $0x0
+     f26:	53                   	push   %ebx
+     f27:	e8 b7 16 00 00       	call   25e3 <lseek>
+     b[0] != 'd' || b[1] != 'e' || lseek(fd, -1, SEEK_CUR) != 4 ||
+     f2c:	83 c4 10             	add    $0x10,%esp
+     f2f:	83 f8 0a             	cmp    $0xa,%eax
+     f32:	0f 85 f6 00 00 00    	jne    102e <seektest+0x1be>
+     lseek(fd, 0, SEEK_END) != 10 || lseek(fd, 1, SEEK_END) != -1 ||
+     f38:	83 ec 04             	sub    $0x4,%esp
+     f3b:	6a 02                	push   $0x2
+     f3d:	6a 01                	push   $0x1
+     f3f:	53                   	push   %ebx
+     f40:	e8 9e 16 00 00       	call   25e3 <lseek>
+     f45:	83 c4 10             	add    $0x10,%esp
+     f48:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f4b:	0f 85 dd 00 00 00    	jne    102e <seektest+0x1be>
+     lseek(fd, -11, SEEK_CUR) != -1){
+     f51:	83 ec 04             	sub    $0x4,%esp
+     f54:	6a 01                	push   $0x1
+     f56:	6a f5                	push   $0xfffffff5
+     f58:	53                   	push   %ebx
+     f59:	e8 85 16 00 00       	call   25e3 <lseek>
+     lseek(fd, 0, SEEK_END) != 10 || lseek(fd, 1, SEEK_END) != -1 ||
+     f5e:	83 c4 10             	add    $0x10,%esp
+     f61:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f64:	0f 85 c4 00 00 00    	jne    102e <seektest+0x1be>
+  lseek(fd, 5, SEEK_SET);
+     f6a:	83 ec 04             	sub    $0x4,%esp
+     f6d:	6a 00                	push   $0x0
+     f6f:	6a 05                	push   $0x5
+     f71:	53                   	push   %ebx
+     f72:	e8 6c 16 00 00       	call   25e3 <lseek>
+  if(pwrite(fd, "XY", 2, 1) != 2 || pread(fd, b, 3, 0) != 3 ||
+     f77:	6a 01                	push   $0x1
+     f79:	6a 02                	push   $0x2
+     f7b:	68 89 34 00 00       	push   $0x3489
+     f80:	53                   	push   %ebx
+     f81:	e8 6d 16 00 00       	call   25f3 <pwrite>
+     f86:	83 c4 20             	add    $0x20,%esp
+     f89:	83 f8 02             	cmp    $0x2,%eax
+     f8c:	0f 85 b0 00 00 00    	jne    1042 <seektest+0x1d2>
+     f92:	6a 00                	push   $0x0
+     f94:	6a 03                	push   $0x3
+     f96:	56                   	push   %esi
+     f97:	53                   	push   %ebx
+     f98:	e8 4e 16 00 00       	call   25eb <pread>
+     f9d:	83 c4 10             	add    $0x10,%esp
+     fa0:	83 f8 03             	cmp    $0x3,%eax
+     fa3:	0f 85 99 00 00 00    	jne    1042 <seektest+0x1d2>
+     fa9:	80 7d f4 61          	cmpb   $0x61,-0xc(%ebp)
+     fad:	0f 85 8f 00 00 00    	jne    1042 <seektest+0x1d2>
+     b[0] != 'a' || b[1] != 'X' || b[2] != 'Y' ||
+     fb3:	80 7d f5 58          	cmpb   $0x58,-0xb(%ebp)
+     fb7:	0f 85 85 00 00 00    	jne    1042 <seektest+0x1d2>
+     fbd:	80 7d f6 59          	cmpb   $0x59,-0xa(%ebp)
+     fc1:	75 7f                	jne    1042 <seektest+0x1d2>
+     pread(fd, b, 3, 10) != 0 || pwrite(fd, "Z", 1, 11) != -1 ||
+     fc3:	6a 0a                	push   $0xa
+     fc5:	6a 03                	push   $0x3
+     fc7:	56                   	push   %esi
+     fc8:	53                   	push   %ebx
+     fc9:	e8 1d 16 00 00       	call   25eb <pread>
+     b[0] != 'a' || b[1] != 'X' || b[2] != 'Y' ||
+     fce:	83 c4 10             	add    $0x10,%esp
+     fd1:	85 c0                	test   %eax,%eax
+     fd3:	75 6d                	jne    1042 <seektest+0x1d2>
+     pread(fd, b, 3, 10) != 0 || pwrite(fd, "Z", 1, 11) != -1 ||
+     fd5:	6a 0b                	push   $0xb
+     fd7:	6a 01                	push   $0x1
+     fd9:	68 a6 34 00 00       	push   $0x34a6
+     fde:	53                   	push   %ebx
+     fdf:	e8 0f 16 00 00       	call   25f3 <pwrite>
+     fe4:	83 c4 10             	add    $0x10,%esp
+     fe7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fea:	75 56                	jne    1042 <seektest+0x1d2>
+     lseek(fd, 0, SEEK_CUR) != 5){
+     fec:	83 ec 04             	sub    $0x4,%esp
+     fef:	6a 01                	push   $0x1
+     ff1:	6a 00                	push   $0x0
+     ff3:	53                   	push   %ebx
+     ff4:	e8 ea 15 00 00       	call   25e3 <lseek>
+     pread(fd, b, 3, 10) != 0 || pwrite(fd, "Z", 1, 11) != -1 ||
+     ff9:	83 c4 10             	add    $0x10,%esp
+     ffc:	83 f8 05             	cmp    $0x5,%eax
+     fff:	75 41                	jne    1042 <seektest+0x1d2>
+  close(fd);
+    1001:	83 ec 0c             	sub    $0xc,%esp
+    1004:	53                   	push   %ebx
+    1005:	e8 51 15 00 00       	call   255b <close>
+  unlink("seekfile");
+    100a:	c7 04 24 4d 34 00 00 	movl   $0x344d,(%esp)
+    1011:	e8 6d 15 00 00       	call   2583 <unlink>
+  printf(1, "seek ok\n");
+    1016:	58                   	pop    %eax
+    1017:	5a                   	pop    %edx
+    1018:	68 a8 34 00 00       	push   $0x34a8
+    101d:	6a 01                	push   $0x1
+    101f:	e8 bc 16 00 00       	call   26e0 <printf>
+}
+    1024:	83 c4 10             	add    $0x10,%esp
+    1027:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    102a:	5b                   	pop    %ebx
+    102b:	5e                   	pop    %esi
+    102c:	5d                   	pop    %ebp
+    102d:	c3                   	ret
+    printf(1, "seek: lseek wrong\n");
+    102e:	83 ec 08             	sub    $0x8,%esp
+    1031:	68 76 34 00 00       	push   $0x3476
+    1036:	6a 01                	push   $0x1
+    1038:	e8 a3 16 00 00       	call   26e0 <printf>
+    exit();
+    103d:	e8 f1 14 00 00       	call   2533 <exit>
+    printf(1, "seek: pread/pwrite wrong\n");
+    1042:	83 ec 08             	sub    $0x8,%esp
+    1045:	68 8c 34 00 00       	push   $0x348c
+    104a:	6a 01                	push   $0x1
+    104c:	e8 8f 16 00 00       	call   26e0 <printf>
+    exit();
+    1051:	e8 dd 14 00 00       	call   2533 <exit>
+    printf(1, "seek: create failed\n");
+    1056:	51                   	push   %ecx
+    1057:	51                   	push   %ecx
+    1058:	68 56 34 00 00       	push   $0x3456
+    105d:	6a 01                	push   $0x1
+    105f:	e8 7c 16 00 00       	call   26e0 <printf>
+    exit();
+    1064:	e8 ca 14 00 00       	call   2533 <exit>
+    1069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001070 <iovtest>:
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	56                   	push   %esi
+    1074:	53                   	push   %ebx
+    1075:	83 ec 38             	sub    $0x38,%esp
+  printf(1, "iov test\n");
+    1078:	68 b1 34 00 00       	push   $0x34b1
+    107d:	6a 01                	push   $0x1
+    107f:	e8 5c 16 00 00       	call   26e0 <printf>
+  fd = open("iovfile", O_CREATE|O_RDWR);
+    1084:	58                   	pop    %eax
+    1085:	5a                   	pop    %edx
+    1086:	68 02 02 00 00       	push   $0x202
+    108b:	68 bb 34 00 00       	push   $0x34bb
+    1090:	e8 de 14 00 00       	call   2573 <open>
+  iov[0].iov_base = "abc";
+    1095:	c7 45 e0 c3 34 00 00 	movl   $0x34c3,-0x20(%ebp)
+  if(fd < 0 || writev(fd, iov, 3) != 8){
+    109c:	83 c4 10             	add    $0x10,%esp
+  iov[0].iov_len = 3;
+    109f:	c7 45 e4 03 00 00 00 	movl   $0x3,-0x1c(%ebp)
+  iov[1].iov_base = "";
+    10a6:	c7 45 e8 c9 31 00 00 	movl   $0x31c9,-0x18(%ebp)
+  iov[1].iov_len = 0;
+    10ad:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  iov[2].iov_base = "defgh";
+    10b4:	c7 45 f0 c7 34 00 00 	movl   $0x34c7,-0x10(%ebp)
+  iov[2].iov_len = 5;
+    10bb:	c7 45 f4 05 00 00 00 	movl   $0x5,-0xc(%ebp)
+  if(fd < 0 || writev(fd, iov, 3) != 8){
+    10c2:	85 c0                	test   %eax,%eax
+    10c4:	0f 88 e3 00 00 00    	js     11ad <iovtest+0x13d>
+    10ca:	83 ec 04             	sub    $0x4,%esp
+    10cd:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    10d0:	89 c3                	mov    %eax,%ebx
+    10d2:	6a 03                	push   $0x3
+    10d4:	56                   	push   %esi
+    10d5:	50                   	push   %eax
+    10d6:	e8 28 15 00 00       	call   2603 <writev>
+    10db:	83 c4 10             	add    $0x10,%esp
+    10de:	83 f8 08             	cmp    $0x8,%eax
+    10e1:	0f 85 c6 00 00 00    	jne    11ad <iovtest+0x13d>
+  if(writev(fd, iov, 3) != -1){
+    10e7:	83 ec 04             	sub    $0x4,%esp
+  iov[1].iov_base = (char*)-1;
+    10ea:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%ebp)
+  iov[1].iov_len = 1;
+    10f1:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  if(writev(fd, iov, 3) != -1){
+    10f8:	6a 03                	push   $0x3
+    10fa:	56                   	push   %esi
+    10fb:	53                   	push   %ebx
+    10fc:	e8 02 15 00 00       	call   2603 <writev>
+    1101:	83 c4 10             	add    $0x10,%esp
+    1104:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1107:	0f 85 b3 00 00 00    	jne    11c0 <iovtest+0x150>
+  close(fd);
+    110d:	83 ec 0c             	sub    $0xc,%esp
+    1110:	53                   	push   %ebx
+    1111:	e8 45 14 00 00       	call   255b <close>
+  fd = open("iovfile", O_RDONLY);
+    1116:	59                   	pop    %ecx
+    1117:	5b                   	pop    %ebx
+    1118:	6a 00                	push   $0x0
+    111a:	68 bb 34 00 00       	push   $0x34bb
+    111f:	e8 4f 14 00 00       	call   2573 <open>
+  if(readv(fd, iov, 2) != 8 || a[0] != 'a' || a[3] != 'd' ||
+    1124:	83 c4 0c             	add    $0xc,%esp
+  iov[0].iov_len = sizeof(a);
+    1127:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  fd = open("iovfile", O_RDONLY);
+    112e:	89 c3                	mov    %eax,%ebx
+  iov[0].iov_base = a;
+    1130:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  iov[1].iov_len = sizeof(b);
+    1133:	c7 45 ec 08 00 00 00 	movl   $0x8,-0x14(%ebp)
+  iov[0].iov_base = a;
+    113a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  iov[1].iov_base = b;
+    113d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1140:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(readv(fd, iov, 2) != 8 || a[0] != 'a' || a[3] != 'd' ||
+    1143:	6a 02                	push   $0x2
+    1145:	56                   	push   %esi
+    1146:	53                   	push   %ebx
+    1147:	e8 af 14 00 00       	call   25fb <readv>
+    114c:	83 c4 10             	add    $0x10,%esp
+    114f:	83 f8 08             	cmp    $0x8,%eax
+    1152:	75 45                	jne    1199 <iovtest+0x129>
+    1154:	80 7d d4 61          	cmpb   $0x61,-0x2c(%ebp)
+    1158:	75 3f                	jne    1199 <iovtest+0x129>
+    115a:	80 7d d7 64          	cmpb   $0x64,-0x29(%ebp)
+    115e:	75 39                	jne    1199 <iovtest+0x129>
+    1160:	80 7d d8 65          	cmpb   $0x65,-0x28(%ebp)
+    1164:	75 33                	jne    1199 <iovtest+0x129>
+     b[0] != 'e' || b[3] != 'h'){
+    1166:	80 7d db 68          	cmpb   $0x68,-0x25(%ebp)
+    116a:	75 2d                	jne    1199 <iovtest+0x129>
+  close(fd);
+    116c:	83 ec 0c             	sub    $0xc,%esp
+    116f:	53                   	push   %ebx
+    1170:	e8 e6 13 00 00       	call   255b <close>
+  unlink("iovfile");
+    1175:	c7 04 24 bb 34 00 00 	movl   $0x34bb,(%esp)
+    117c:	e8 02 14 00 00       	call   2583 <unlink>
+  printf(1, "iov ok\n");
+    1181:	58                   	pop    %eax
+    1182:	5a                   	pop    %edx
+    1183:	68 f3 34 00 00       	push   $0x34f3
+    1188:	6a 01                	push   $0x1
+    118a:	e8 51 15 00 00       	call   26e0 <printf>
+}
+    118f:	83 c4 10             	add    $0x10,%esp
+    1192:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1195:	5b                   	pop    %ebx
+    1196:	5e                   	pop    %esi
+    1197:	5d                   	pop    %ebp
+    1198:	c3                   	ret
+    printf(1, "iov: readv wrong\n");
+    1199:	83 ec 08             	sub    $0x8,%esp
+    119c:	68 e1 34 00 00       	push   $0x34e1
+    11a1:	6a 01                	push   $0x1
+    11a3:	e8 38 15 00 00       	call   26e0 <printf>
+    exit();
+    11a8:	e8 86 13 00 00       	call   2533 <exit>
+    printf(1, "iov: writev failed\n");
+    11ad:	50                   	push   %eax
+    11ae:	50                   	push   %eax
+    11af:	68 cd 34 00 00       	push   $0x34cd
+    11b4:	6a 01                	push   $0x1
+    11b6:	e8 25 15 00 00       	call   26e0 <printf>
+    exit();
+    11bb:	e8 73 13 00 00       	call   2533 <exit>
+    printf(1, "iov: writev of bad buffer succeeded\n");
+    11c0:	56                   	push   %esi
+    11c1:	56                   	push   %esi
+    11c2:	68 98 39 00 00       	push   $0x3998
+    11c7:	6a 01                	push   $0x1
+    11c9:	e8 12 15 00 00       	call   26e0 <printf>
+    exit();
+    11ce:	e8 60 13 00 00       	call   2533 <exit>
+    11d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000011e0 <getdentstest>:
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+    11e5:	53                   	push   %ebx
+    11e6:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  printf(1, "getdents test\n");
+    11ec:	68 fb 34 00 00       	push   $0x34fb
+    11f1:	6a 01                	push   $0x1
+    11f3:	e8 e8 14 00 00       	call   26e0 <printf>
+  if(mkdir("gdd") != 0 || chdir("gdd") != 0){
+    11f8:	c7 04 24 0a 35 00 00 	movl   $0x350a,(%esp)
+    11ff:	e8 97 13 00 00       	call   259b <mkdir>
+    1204:	83 c4 10             	add    $0x10,%esp
+    1207:	85 c0                	test   %eax,%eax
+    1209:	0f 85 b4 01 00 00    	jne    13c3 <getdentstest+0x1e3>
+    120f:	83 ec 0c             	sub    $0xc,%esp
+    1212:	68 0a 35 00 00       	push   $0x350a
+    1217:	e8 87 13 00 00       	call   25a3 <chdir>
+    121c:	83 c4 10             	add    $0x10,%esp
+    121f:	85 c0                	test   %eax,%eax
+    1221:	0f 85 9c 01 00 00    	jne    13c3 <getdentstest+0x1e3>
+  name[0] = 'f';
+    1227:	c6 45 89 66          	movb   $0x66,-0x77(%ebp)
+  for(i = 0; i < 10; i++){
+    122b:	31 db                	xor    %ebx,%ebx
+  name[2] = 0;
+    122d:	c6 45 8b 00          	movb   $0x0,-0x75(%ebp)
+  for(i = 0; i < 10; i++){
+    1231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[1] = '0' + i;
+    1238:	8d 43 30             	lea    0x30(%ebx),%eax
+    fd = open(name, O_CREATE|O_RDWR);
+    123b:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+    123e:	88 45 8a             	mov    %al,-0x76(%ebp)
+    fd = open(name, O_CREATE|O_RDWR);
+    1241:	8d 45 89             	lea    -0x77(%ebp),%eax
+    1244:	68 02 02 00 00       	push   $0x202
+    1249:	50                   	push   %eax
+    124a:	e8 24 13 00 00       	call   2573 <open>
+    write(fd, "xxxxxxxxxx", i);
+    124f:	83 c4 0c             	add    $0xc,%esp
+    1252:	53                   	push   %ebx
+    fd = open(name, O_CREATE|O_RDWR);
+    1253:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 10; i++){
+    1255:	83 c3 01             	add    $0x1,%ebx
+    write(fd, "xxxxxxxxxx", i);
+    1258:	68 26 35 00 00       	push   $0x3526
+    125d:	50                   	push   %eax
+    125e:	e8 f0 12 00 00       	call   2553 <write>
+    close(fd);
+    1263:	89 34 24             	mov    %esi,(%esp)
+    1266:	e8 f0 12 00 00       	call   255b <close>
+  for(i = 0; i < 10; i++){
+    126b:	83 c4 10             	add    $0x10,%esp
+    126e:	83 fb 0a             	cmp    $0xa,%ebx
+    1271:	75 c5                	jne    1238 <getdentstest+0x58>
+  unlink("f3");
+    1273:	83 ec 0c             	sub    $0xc,%esp
+    1276:	68 31 35 00 00       	push   $0x3531
+    127b:	e8 03 13 00 00       	call   2583 <unlink>
+  fd = open(".", O_RDONLY);
+    1280:	5b                   	pop    %ebx
+    1281:	5e                   	pop    %esi
+    1282:	6a 00                	push   $0x0
+    1284:	68 5b 35 00 00       	push   $0x355b
+    1289:	e8 e5 12 00 00       	call   2573 <open>
+  seen = 0;
+    128e:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+  while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+    1295:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", O_RDONLY);
+    1298:	89 45 80             	mov    %eax,-0x80(%ebp)
+  while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+    129b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    129f:	90                   	nop
+    12a0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    12a3:	6a 01                	push   $0x1
+    12a5:	6a 48                	push   $0x48
+    12a7:	50                   	push   %eax
+    12a8:	ff 75 80             	push   -0x80(%ebp)
+    12ab:	e8 5b 13 00 00       	call   260b <getdents>
+    12b0:	83 c4 10             	add    $0x10,%esp
+    12b3:	89 c3                	mov    %eax,%ebx
+    12b5:	85 c0                	test   %eax,%eax
+    12b7:	0f 8e 85 00 00 00    	jle    1342 <getdentstest+0x162>
+    for(i = 0; i < n / sizeof(de[0]); i++){
+    12bd:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    12c2:	f7 e3                	mul    %ebx
+    12c4:	89 d7                	mov    %edx,%edi
+    12c6:	c1 ef 04             	shr    $0x4,%edi
+    12c9:	83 fb 17             	cmp    $0x17,%ebx
+    12cc:	76 d2                	jbe    12a0 <getdentstest+0xc0>
+    12ce:	8d 5d a2             	lea    -0x5e(%ebp),%ebx
+    12d1:	31 f6                	xor    %esi,%esi
+    12d3:	eb 0d                	jmp    12e2 <getdentstest+0x102>
+    12d5:	8d 76 00             	lea    0x0(%esi),%esi
+    12d8:	83 c6 01             	add    $0x1,%esi
+    12db:	83 c3 18             	add    $0x18,%ebx
+    12de:	39 fe                	cmp    %edi,%esi
+    12e0:	73 be                	jae    12a0 <getdentstest+0xc0>
+      if(de[i].name[0] != 'f')
+    12e2:	80 3b 66             	cmpb   $0x66,(%ebx)
+    12e5:	75 f1                	jne    12d8 <getdentstest+0xf8>
+      if(stat(de[i].name, &st) < 0 || st.ino != de[i].inum ||
+    12e7:	83 ec 08             	sub    $0x8,%esp
+    12ea:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    12ed:	50                   	push   %eax
+    12ee:	53                   	push   %ebx
+    12ef:	e8 7c 11 00 00       	call   2470 <stat>
+    12f4:	83 c4 10             	add    $0x10,%esp
+    12f7:	85 c0                	test   %eax,%eax
+    12f9:	78 32                	js     132d <getdentstest+0x14d>
+    12fb:	0f b7 43 fe          	movzwl -0x2(%ebx),%eax
+    12ff:	39 45 94             	cmp    %eax,-0x6c(%ebp)
+    1302:	75 29                	jne    132d <getdentstest+0x14d>
+    1304:	0f b7 43 0e          	movzwl 0xe(%ebx),%eax
+    1308:	66 39 45 8c          	cmp    %ax,-0x74(%ebp)
+    130c:	75 1f                	jne    132d <getdentstest+0x14d>
+         st.type != de[i].type || st.size != de[i].size ||
+    130e:	8b 4b 12             	mov    0x12(%ebx),%ecx
+    1311:	39 4d 9c             	cmp    %ecx,-0x64(%ebp)
+    1314:	75 17                	jne    132d <getdentstest+0x14d>
+         de[i].size != de[i].name[1] - '0'){
+    1316:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+    131a:	83 e8 30             	sub    $0x30,%eax
+         st.type != de[i].type || st.size != de[i].size ||
+    131d:	39 c1                	cmp    %eax,%ecx
+    131f:	75 0c                	jne    132d <getdentstest+0x14d>
+      seen |= 1 << (de[i].name[1] - '0');
+    1321:	b8 01 00 00 00       	mov    $0x1,%eax
+    1326:	d3 e0                	shl    %cl,%eax
+    1328:	09 45 84             	or     %eax,-0x7c(%ebp)
+    132b:	eb ab                	jmp    12d8 <getdentstest+0xf8>
+        printf(1, "getdents: %s wrong\n", de[i].name);
+    132d:	83 ec 04             	sub    $0x4,%esp
+    1330:	53                   	push   %ebx
+    1331:	68 34 35 00 00       	push   $0x3534
+    1336:	6a 01                	push   $0x1
+    1338:	e8 a3 13 00 00       	call   26e0 <printf>
+        exit();
+    133d:	e8 f1 11 00 00       	call   2533 <exit>
+  close(fd);
+    1342:	83 ec 0c             	sub    $0xc,%esp
+    1345:	ff 75 80             	push   -0x80(%ebp)
+    1348:	e8 0e 12 00 00       	call   255b <close>
+  if(n < 0 || seen != (0x3ff & ~(1 << 3))){
+    134d:	83 c4 10             	add    $0x10,%esp
+    1350:	85 db                	test   %ebx,%ebx
+    1352:	78 5a                	js     13ae <getdentstest+0x1ce>
+    1354:	81 7d 84 f7 03 00 00 	cmpl   $0x3f7,-0x7c(%ebp)
+    135b:	75 51                	jne    13ae <getdentstest+0x1ce>
+    135d:	bb 30 00 00 00       	mov    $0x30,%ebx
+    unlink(name);
+    1362:	83 ec 0c             	sub    $0xc,%esp
+    1365:	8d 45 89             	lea    -0x77(%ebp),%eax
+    name[1] = '0' + i;
+    1368:	88 5d 8a             	mov    %bl,-0x76(%ebp)
+  for(i = 0; i < 10; i++){
+    136b:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+    136e:	50                   	push   %eax
+    136f:	e8 0f 12 00 00       	call   2583 <unlink>
+  for(i = 0; i < 10; i++){
+    1374:	83 c4 10             	add    $0x10,%esp
+    1377:	80 fb 3a             	cmp    $0x3a,%bl
+    137a:	75 e6                	jne    1362 <getdentstest+0x182>
+  chdir("..");
+    137c:	83 ec 0c             	sub    $0xc,%esp
+    137f:	68 5a 35 00 00       	push   $0x355a
+    1384:	e8 1a 12 00 00       	call   25a3 <chdir>
+  unlink("gdd");
+    1389:	c7 04 24 0a 35 00 00 	movl   $0x350a,(%esp)
+    1390:	e8 ee 11 00 00       	call   2583 <unlink>
+  printf(1, "getdents ok\n");
+    1395:	58                   	pop    %eax
+    1396:	5a                   	pop    %edx
+    1397:	68 5d 35 00 00       	push   $0x355d
+    139c:	6a 01                	push   $0x1
+    139e:	e8 3d 13 00 00       	call   26e0 <printf>
+}
+    13a3:	83 c4 10             	add    $0x10,%esp
+    13a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13a9:	5b                   	pop    %ebx
+    13aa:	5e                   	pop    %esi
+    13ab:	5f                   	pop    %edi
+    13ac:	5d                   	pop    %ebp
+    13ad:	c3                   	ret
+    printf(1, "getdents: saw %x\n", seen);
+    13ae:	51                   	push   %ecx
+    13af:	ff 75 84             	push   -0x7c(%ebp)
+    13b2:	68 48 35 00 00       	push   $0x3548
+    13b7:	6a 01                	push   $0x1
+    13b9:	e8 22 13 00 00       	call   26e0 <printf>
+    exit();
+    13be:	e8 70 11 00 00       	call   2533 <exit>
+    printf(1, "getdents: mkdir failed\n");
+    13c3:	57                   	push   %edi
+    13c4:	57                   	push   %edi
+    13c5:	68 0e 35 00 00       	push   $0x350e
+    13ca:	6a 01                	push   $0x1
+    13cc:	e8 0f 13 00 00       	call   26e0 <printf>
+    exit();
+    13d1:	e8 5d 11 00 00       	call   2533 <exit>
+    13d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000013e0 <splicetest>:
+{
+    13e0:	55                   	push   %ebp
+    13e1:	89 e5                	mov    %esp,%ebp
+    13e3:	57                   	push   %edi
+    13e4:	56                   	push   %esi
+    13e5:	53                   	push   %ebx
+    13e6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "splice test\n");
+    13e9:	68 6a 35 00 00       	push   $0x356a
+    13ee:	6a 01                	push   $0x1
+    13f0:	e8 eb 12 00 00       	call   26e0 <printf>
+  fd = open("splicein", O_CREATE|O_RDWR);
+    13f5:	5b                   	pop    %ebx
+    13f6:	5e                   	pop    %esi
+    13f7:	68 02 02 00 00       	push   $0x202
+    13fc:	68 77 35 00 00       	push   $0x3577
+    1401:	e8 6d 11 00 00       	call   2573 <open>
+    1406:	83 c4 10             	add    $0x10,%esp
+    1409:	31 d2                	xor    %edx,%edx
+    140b:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < sizeof(buf); i++)
+    140d:	31 c0                	xor    %eax,%eax
+    140f:	90                   	nop
+    buf[i] = i * 7;
+    1410:	88 90 80 43 00 00    	mov    %dl,0x4380(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+    1416:	83 c0 01             	add    $0x1,%eax
+    1419:	83 c2 07             	add    $0x7,%edx
+    141c:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1421:	75 ed                	jne    1410 <splicetest+0x30>
+    1423:	be 05 00 00 00       	mov    $0x5,%esi
+    1428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    142f:	90                   	nop
+    write(fd, buf, sizeof(buf));
+    1430:	83 ec 04             	sub    $0x4,%esp
+    1433:	68 00 20 00 00       	push   $0x2000
+    1438:	68 80 43 00 00       	push   $0x4380
+    143d:	53                   	push   %ebx
+    143e:	e8 10 11 00 00       	call   2553 <write>
+  for(i = 0; i < 5; i++)
+    1443:	83 c4 10             	add    $0x10,%esp
+    1446:	83 ee 01             	sub    $0x1,%esi
+    1449:	75 e5                	jne    1430 <splicetest+0x50>
+  close(fd);
+    144b:	83 ec 0c             	sub    $0xc,%esp
+    144e:	53                   	push   %ebx
+    144f:	e8 07 11 00 00       	call   255b <close>
+  if(pipe(fds) != 0){
+    1454:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1457:	89 04 24             	mov    %eax,(%esp)
+    145a:	e8 e4 10 00 00       	call   2543 <pipe>
+    145f:	83 c4 10             	add    $0x10,%esp
+    1462:	89 c3                	mov    %eax,%ebx
+    1464:	85 c0                	test   %eax,%eax
+    1466:	0f 85 05 02 00 00    	jne    1671 <splicetest+0x291>
+  pid = fork();
+    146c:	e8 ba 10 00 00       	call   252b <fork>
+    1471:	89 c6                	mov    %eax,%esi
+  if(pid == 0){
+    1473:	85 c0                	test   %eax,%eax
+    1475:	0f 84 48 01 00 00    	je     15c3 <splicetest+0x1e3>
+  } else if(pid < 0){
+    147b:	0f 88 03 02 00 00    	js     1684 <splicetest+0x2a4>
+  close(fds[1]);
+    1481:	83 ec 0c             	sub    $0xc,%esp
+    1484:	ff 75 e4             	push   -0x1c(%ebp)
+    1487:	e8 cf 10 00 00       	call   255b <close>
+  fd = open("spliceout", O_CREATE|O_RDWR);
+    148c:	5e                   	pop    %esi
+    148d:	5f                   	pop    %edi
+    148e:	68 02 02 00 00       	push   $0x202
+    1493:	68 80 35 00 00       	push   $0x3580
+  for(n = 0; (i = splice(fds[0], fd, 1 << 20)) > 0; n += i)
+    1498:	31 f6                	xor    %esi,%esi
+  fd = open("spliceout", O_CREATE|O_RDWR);
+    149a:	e8 d4 10 00 00       	call   2573 <open>
+  for(n = 0; (i = splice(fds[0], fd, 1 << 20)) > 0; n += i)
+    149f:	83 c4 10             	add    $0x10,%esp
+  fd = open("spliceout", O_CREATE|O_RDWR);
+    14a2:	89 c7                	mov    %eax,%edi
+  for(n = 0; (i = splice(fds[0], fd, 1 << 20)) > 0; n += i)
+    14a4:	eb 0c                	jmp    14b2 <splicetest+0xd2>
+    14a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+    14b0:	01 d6                	add    %edx,%esi
+    14b2:	83 ec 04             	sub    $0x4,%esp
+    14b5:	68 00 00 10 00       	push   $0x100000
+    14ba:	57                   	push   %edi
+    14bb:	ff 75 e0             	push   -0x20(%ebp)
+    14be:	e8 50 11 00 00       	call   2613 <splice>
+    14c3:	83 c4 10             	add    $0x10,%esp
+    14c6:	89 c2                	mov    %eax,%edx
+    14c8:	85 c0                	test   %eax,%eax
+    14ca:	7f e4                	jg     14b0 <splicetest+0xd0>
+  close(fds[0]);
+    14cc:	83 ec 0c             	sub    $0xc,%esp
+    14cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    14d2:	ff 75 e0             	push   -0x20(%ebp)
+    14d5:	e8 81 10 00 00       	call   255b <close>
+  wait();
+    14da:	e8 5c 10 00 00       	call   253b <wait>
+  close(fd);
+    14df:	89 3c 24             	mov    %edi,(%esp)
+    14e2:	e8 74 10 00 00       	call   255b <close>
+  if(i < 0 || n != 5*sizeof(buf) - 3){
+    14e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    14ea:	83 c4 10             	add    $0x10,%esp
+    14ed:	85 d2                	test   %edx,%edx
+    14ef:	0f 88 69 01 00 00    	js     165e <splicetest+0x27e>
+    14f5:	81 fe fd 9f 00 00    	cmp    $0x9ffd,%esi
+    14fb:	0f 85 5d 01 00 00    	jne    165e <splicetest+0x27e>
+  fd = open("spliceout", O_RDWR);
+    1501:	83 ec 08             	sub    $0x8,%esp
+    1504:	be 15 00 00 00       	mov    $0x15,%esi
+    1509:	6a 02                	push   $0x2
+    150b:	68 80 35 00 00       	push   $0x3580
+    1510:	e8 5e 10 00 00       	call   2573 <open>
+    1515:	83 c4 10             	add    $0x10,%esp
+    1518:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++){
+    151a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(read(fd, buf, 1) != 1 || buf[0] != (char)((i + 3) % sizeof(buf) * 7)){
+    1520:	83 ec 04             	sub    $0x4,%esp
+    1523:	6a 01                	push   $0x1
+    1525:	68 80 43 00 00       	push   $0x4380
+    152a:	57                   	push   %edi
+    152b:	e8 1b 10 00 00       	call   254b <read>
+    1530:	83 c4 10             	add    $0x10,%esp
+    1533:	83 f8 01             	cmp    $0x1,%eax
+    1536:	0f 85 fa 00 00 00    	jne    1636 <splicetest+0x256>
+    153c:	89 f0                	mov    %esi,%eax
+    153e:	38 05 80 43 00 00    	cmp    %al,0x4380
+    1544:	0f 85 ec 00 00 00    	jne    1636 <splicetest+0x256>
+  for(i = 0; i < n; i++){
+    154a:	83 c3 01             	add    $0x1,%ebx
+    154d:	83 c6 07             	add    $0x7,%esi
+    1550:	81 fb fd 9f 00 00    	cmp    $0x9ffd,%ebx
+    1556:	75 c8                	jne    1520 <splicetest+0x140>
+  fd2 = open("splicein", O_RDONLY);
+    1558:	83 ec 08             	sub    $0x8,%esp
+    155b:	6a 00                	push   $0x0
+    155d:	68 77 35 00 00       	push   $0x3577
+    1562:	e8 0c 10 00 00       	call   2573 <open>
+  if(splice(fd2, fd, 10) != -1){
+    1567:	83 c4 0c             	add    $0xc,%esp
+    156a:	6a 0a                	push   $0xa
+  fd2 = open("splicein", O_RDONLY);
+    156c:	89 c3                	mov    %eax,%ebx
+  if(splice(fd2, fd, 10) != -1){
+    156e:	57                   	push   %edi
+    156f:	50                   	push   %eax
+    1570:	e8 9e 10 00 00       	call   2613 <splice>
+    1575:	83 c4 10             	add    $0x10,%esp
+    1578:	83 f8 ff             	cmp    $0xffffffff,%eax
+    157b:	0f 85 ca 00 00 00    	jne    164b <splicetest+0x26b>
+  close(fd);
+    1581:	83 ec 0c             	sub    $0xc,%esp
+    1584:	57                   	push   %edi
+    1585:	e8 d1 0f 00 00       	call   255b <close>
+  close(fd2);
+    158a:	89 1c 24             	mov    %ebx,(%esp)
+    158d:	e8 c9 0f 00 00       	call   255b <close>
+  unlink("splicein");
+    1592:	c7 04 24 77 35 00 00 	movl   $0x3577,(%esp)
+    1599:	e8 e5 0f 00 00       	call   2583 <unlink>
+  unlink("spliceout");
+    159e:	c7 04 24 80 35 00 00 	movl   $0x3580,(%esp)
+    15a5:	e8 d9 0f 00 00       	call   2583 <unlink>
+  printf(1, "splice ok\n");
+    15aa:	58                   	pop    %eax
+    15ab:	5a                   	pop    %edx
+    15ac:	68 a1 35 00 00       	push   $0x35a1
+    15b1:	6a 01                	push   $0x1
+    15b3:	e8 28 11 00 00       	call   26e0 <printf>
+}
+    15b8:	83 c4 10             	add    $0x10,%esp
+    15bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    15be:	5b                   	pop    %ebx
+    15bf:	5e                   	pop    %esi
+    15c0:	5f                   	pop    %edi
+    15c1:	5d                   	pop    %ebp
+    15c2:	c3                   	ret
+    close(fds[0]);
+    15c3:	83 ec 0c             	sub    $0xc,%esp
+    15c6:	ff 75 e0             	push   -0x20(%ebp)
+    15c9:	e8 8d 0f 00 00       	call   255b <close>
+    fd = open("splicein", O_RDONLY);
+    15ce:	58                   	pop    %eax
+    15cf:	5a                   	pop    %edx
+    15d0:	6a 00                	push   $0x0
+    15d2:	68 77 35 00 00       	push   $0x3577
+    15d7:	e8 97 0f 00 00       	call   2573 <open>
+    read(fd, buf, 3);
+    15dc:	83 c4 0c             	add    $0xc,%esp
+    15df:	6a 03                	push   $0x3
+    fd = open("splicein", O_RDONLY);
+    15e1:	89 c3                	mov    %eax,%ebx
+    read(fd, buf, 3);
+    15e3:	68 80 43 00 00       	push   $0x4380
+    15e8:	50                   	push   %eax
+    15e9:	e8 5d 0f 00 00       	call   254b <read>
+    for(n = 0; (i = splice(fd, fds[1], 4000)) > 0; n += i)
+    15ee:	83 c4 10             	add    $0x10,%esp
+    15f1:	eb 07                	jmp    15fa <splicetest+0x21a>
+    15f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15f7:	90                   	nop
+    15f8:	01 c6                	add    %eax,%esi
+    15fa:	83 ec 04             	sub    $0x4,%esp
+    15fd:	68 a0 0f 00 00       	push   $0xfa0
+    1602:	ff 75 e4             	push   -0x1c(%ebp)
+    1605:	53                   	push   %ebx
+    1606:	e8 08 10 00 00       	call   2613 <splice>
+    160b:	83 c4 10             	add    $0x10,%esp
+    160e:	85 c0                	test   %eax,%eax
+    1610:	7f e6                	jg     15f8 <splicetest+0x218>
+    if(i < 0 || n != 5*sizeof(buf) - 3){
+    1612:	78 0d                	js     1621 <splicetest+0x241>
+    1614:	81 fe fd 9f 00 00    	cmp    $0x9ffd,%esi
+    161a:	75 05                	jne    1621 <splicetest+0x241>
+    exit();
+    161c:	e8 12 0f 00 00       	call   2533 <exit>
+      printf(1, "splice: file to pipe moved %d\n", n);
+    1621:	83 ec 04             	sub    $0x4,%esp
+    1624:	56                   	push   %esi
+    1625:	68 c0 39 00 00       	push   $0x39c0
+    162a:	6a 01                	push   $0x1
+    162c:	e8 af 10 00 00       	call   26e0 <printf>
+      exit();
+    1631:	e8 fd 0e 00 00       	call   2533 <exit>
+      printf(1, "splice: byte %d wrong\n", i);
+    1636:	83 ec 04             	sub    $0x4,%esp
+    1639:	53                   	push   %ebx
+    163a:	68 8a 35 00 00       	push   $0x358a
+    163f:	6a 01                	push   $0x1
+    1641:	e8 9a 10 00 00       	call   26e0 <printf>
+      exit();
+    1646:	e8 e8 0e 00 00       	call   2533 <exit>
+    printf(1, "splice: file to file succeeded\n");
+    164b:	51                   	push   %ecx
+    164c:	51                   	push   %ecx
+    164d:	68 00 3a 00 00       	push   $0x3a00
+    1652:	6a 01                	push   $0x1
+    1654:	e8 87 10 00 00       	call   26e0 <printf>
+    exit();
+    1659:	e8 d5 0e 00 00       	call   2533 <exit>
+    printf(1, "splice: pipe to file moved %d\n", n);
+    165e:	53                   	push   %ebx
+    165f:	56                   	push   %esi
+    1660:	68 e0 39 00 00       	push   $0x39e0
+    1665:	6a 01                	push   $0x1
+    1667:	e8 74 10 00 00       	call   26e0 <printf>
+    exit();
+    166c:	e8 c2 0e 00 00       	call   2533 <exit>
+    printf(1, "pipe() failed\n");
+    1671:	51                   	push   %ecx
+    1672:	51                   	push   %ecx
+    1673:	68 a2 32 00 00       	push   $0x32a2
+    1678:	6a 01                	push   $0x1
+    167a:	e8 61 10 00 00       	call   26e0 <printf>
+    exit();
+    167f:	e8 af 0e 00 00       	call   2533 <exit>
+    printf(1, "fork() failed\n");
+    1684:	50                   	push   %eax
+    1685:	50                   	push   %eax
+    1686:	68 00 33 00 00       	push   $0x3300
+    168b:	6a 01                	push   $0x1
+    168d:	e8 4e 10 00 00       	call   26e0 <printf>
+    exit();
+    1692:	e8 9c 0e 00 00       	call   2533 <exit>
+    1697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169e:	66 90                	xchg   %ax,%ax
+
+000016a0 <ioqueue>:
+{
+    16a0:	55                   	push   %ebp
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    16a1:	31 d2                	xor    %edx,%edx
+{
+    16a3:	89 e5                	mov    %esp,%ebp
+    16a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    16a8:	8b 41 04             	mov    0x4(%ecx),%eax
+    16ab:	f7 71 10             	divl   0x10(%ecx)
+    16ae:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  e->op = op;
+    16b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    16b4:	8d 44 c1 14          	lea    0x14(%ecx,%eax,8),%eax
+  e->op = op;
+    16b8:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+    16ba:	8b 55 10             	mov    0x10(%ebp),%edx
+    16bd:	89 50 04             	mov    %edx,0x4(%eax)
+  e->buf = p;
+    16c0:	8b 55 14             	mov    0x14(%ebp),%edx
+    16c3:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+    16c6:	8b 55 18             	mov    0x18(%ebp),%edx
+    16c9:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->off = off;
+    16cc:	8b 55 1c             	mov    0x1c(%ebp),%edx
+    16cf:	89 50 10             	mov    %edx,0x10(%eax)
+  e->user = r->sqtail;
+    16d2:	8b 51 04             	mov    0x4(%ecx),%edx
+    16d5:	89 50 14             	mov    %edx,0x14(%eax)
+  r->sqtail++;
+    16d8:	83 c2 01             	add    $0x1,%edx
+    16db:	89 51 04             	mov    %edx,0x4(%ecx)
+}
+    16de:	5d                   	pop    %ebp
+    16df:	c3                   	ret
+
+000016e0 <ioringtest>:
+{
+    16e0:	55                   	push   %ebp
+    16e1:	89 e5                	mov    %esp,%ebp
+    16e3:	57                   	push   %edi
+    16e4:	56                   	push   %esi
+    16e5:	53                   	push   %ebx
+    16e6:	81 ec b4 01 00 00    	sub    $0x1b4,%esp
+  printf(1, "ioring test\n");
+    16ec:	68 ac 35 00 00       	push   $0x35ac
+    16f1:	6a 01                	push   $0x1
+    16f3:	e8 e8 0f 00 00       	call   26e0 <printf>
+  fd = open("ioring", O_CREATE|O_RDWR);
+    16f8:	58                   	pop    %eax
+    16f9:	5a                   	pop    %edx
+    16fa:	68 02 02 00 00       	push   $0x202
+    16ff:	68 b9 35 00 00       	push   $0x35b9
+    1704:	e8 6a 0e 00 00       	call   2573 <open>
+    1709:	83 c4 10             	add    $0x10,%esp
+    170c:	89 85 58 fe ff ff    	mov    %eax,-0x1a8(%ebp)
+  for(i = 0; i < sizeof(buf); i++)
+    1712:	31 c0                	xor    %eax,%eax
+    1714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    buf[i] = i * 3;
+    1718:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  for(i = 0; i < sizeof(buf); i++)
+    171b:	83 c0 01             	add    $0x1,%eax
+    buf[i] = i * 3;
+    171e:	88 90 7f 43 00 00    	mov    %dl,0x437f(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+    1724:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1729:	75 ed                	jne    1718 <ioringtest+0x38>
+  write(fd, buf, sizeof(buf));
+    172b:	83 ec 04             	sub    $0x4,%esp
+    172e:	68 00 20 00 00       	push   $0x2000
+    1733:	68 80 43 00 00       	push   $0x4380
+    1738:	ff b5 58 fe ff ff    	push   -0x1a8(%ebp)
+    173e:	e8 10 0e 00 00       	call   2553 <write>
+  if(ioring_setup(r, 8) != 0 || r->nentries != 8){
+    1743:	5e                   	pop    %esi
+    1744:	5f                   	pop    %edi
+    1745:	6a 08                	push   $0x8
+    1747:	68 80 6b 00 00       	push   $0x6b80
+    174c:	e8 ca 0e 00 00       	call   261b <ioring_setup>
+    1751:	83 c4 10             	add    $0x10,%esp
+    1754:	85 c0                	test   %eax,%eax
+    1756:	0f 85 6d 03 00 00    	jne    1ac9 <ioringtest+0x3e9>
+    175c:	8b 1d 90 6b 00 00    	mov    0x6b90,%ebx
+    1762:	83 fb 08             	cmp    $0x8,%ebx
+    1765:	0f 85 5e 03 00 00    	jne    1ac9 <ioringtest+0x3e9>
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    176b:	8b 15 84 6b 00 00    	mov    0x6b84,%edx
+  for(round = 0; round < 3; round++){
+    1771:	c7 85 5c fe ff ff 00 	movl   $0x0,-0x1a4(%ebp)
+    1778:	00 00 00 
+    177b:	89 95 50 fe ff ff    	mov    %edx,-0x1b0(%ebp)
+    for(i = 0; i < 6; i++)
+    1781:	8b b5 5c fe ff ff    	mov    -0x1a4(%ebp),%esi
+    1787:	8b 85 50 fe ff ff    	mov    -0x1b0(%ebp),%eax
+  for(i = 0; i < sizeof(buf); i++)
+    178d:	8d 8d 68 fe ff ff    	lea    -0x198(%ebp),%ecx
+    1793:	8b bd 58 fe ff ff    	mov    -0x1a8(%ebp),%edi
+    1799:	89 b5 54 fe ff ff    	mov    %esi,-0x1ac(%ebp)
+    179f:	eb 0d                	jmp    17ae <ioringtest+0xce>
+    17a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    17a8:	8b 1d 90 6b 00 00    	mov    0x6b90,%ebx
+    17ae:	31 d2                	xor    %edx,%edx
+    17b0:	f7 f3                	div    %ebx
+    for(i = 0; i < 6; i++)
+    17b2:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    17b5:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    17b8:	8d 04 c5 14 00 00 00 	lea    0x14(,%eax,8),%eax
+  e->op = op;
+    17bf:	c7 80 80 6b 00 00 01 	movl   $0x1,0x6b80(%eax)
+    17c6:	00 00 00 
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    17c9:	8d 90 80 6b 00 00    	lea    0x6b80(%eax),%edx
+  e->fd = fd;
+    17cf:	89 b8 84 6b 00 00    	mov    %edi,0x6b84(%eax)
+  e->buf = p;
+    17d5:	89 88 88 6b 00 00    	mov    %ecx,0x6b88(%eax)
+    for(i = 0; i < 6; i++)
+    17db:	83 c1 40             	add    $0x40,%ecx
+  e->off = off;
+    17de:	89 b0 90 6b 00 00    	mov    %esi,0x6b90(%eax)
+    for(i = 0; i < 6; i++)
+    17e4:	81 c6 e8 03 00 00    	add    $0x3e8,%esi
+  e->n = n;
+    17ea:	c7 80 8c 6b 00 00 40 	movl   $0x40,0x6b8c(%eax)
+    17f1:	00 00 00 
+  e->user = r->sqtail;
+    17f4:	a1 84 6b 00 00       	mov    0x6b84,%eax
+    17f9:	89 42 14             	mov    %eax,0x14(%edx)
+  r->sqtail++;
+    17fc:	83 c0 01             	add    $0x1,%eax
+    17ff:	a3 84 6b 00 00       	mov    %eax,0x6b84
+    for(i = 0; i < 6; i++)
+    1804:	39 d9                	cmp    %ebx,%ecx
+    1806:	75 a0                	jne    17a8 <ioringtest+0xc8>
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    1808:	31 d2                	xor    %edx,%edx
+  e->buf = p;
+    180a:	8d 9d 68 fe ff ff    	lea    -0x198(%ebp),%ebx
+    if(ioring_enter(8) != 8 || r->sqhead != r->sqtail ||
+    1810:	83 ec 0c             	sub    $0xc,%esp
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    1813:	f7 35 90 6b 00 00    	divl   0x6b90
+    1819:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    181c:	8d 04 c5 14 00 00 00 	lea    0x14(,%eax,8),%eax
+  e->op = op;
+    1823:	c7 80 80 6b 00 00 02 	movl   $0x2,0x6b80(%eax)
+    182a:	00 00 00 
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    182d:	8d 90 80 6b 00 00    	lea    0x6b80(%eax),%edx
+  e->fd = fd;
+    1833:	8b 85 58 fe ff ff    	mov    -0x1a8(%ebp),%eax
+  e->buf = p;
+    1839:	c7 42 08 d5 35 00 00 	movl   $0x35d5,0x8(%edx)
+  e->fd = fd;
+    1840:	89 42 04             	mov    %eax,0x4(%edx)
+  e->off = off;
+    1843:	8b 85 5c fe ff ff    	mov    -0x1a4(%ebp),%eax
+  e->n = n;
+    1849:	c7 42 0c 03 00 00 00 	movl   $0x3,0xc(%edx)
+  e->off = off;
+    1850:	05 40 1f 00 00       	add    $0x1f40,%eax
+    1855:	89 42 10             	mov    %eax,0x10(%edx)
+  e->user = r->sqtail;
+    1858:	a1 84 6b 00 00       	mov    0x6b84,%eax
+    185d:	89 42 14             	mov    %eax,0x14(%edx)
+  r->sqtail++;
+    1860:	83 c0 01             	add    $0x1,%eax
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    1863:	31 d2                	xor    %edx,%edx
+  r->sqtail++;
+    1865:	a3 84 6b 00 00       	mov    %eax,0x6b84
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    186a:	f7 35 90 6b 00 00    	divl   0x6b90
+    1870:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1873:	8d 14 c5 14 00 00 00 	lea    0x14(,%eax,8),%edx
+  e->op = op;
+    187a:	c7 82 80 6b 00 00 01 	movl   $0x1,0x6b80(%edx)
+    1881:	00 00 00 
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+    1884:	8d 82 80 6b 00 00    	lea    0x6b80(%edx),%eax
+  e->fd = fd;
+    188a:	c7 82 84 6b 00 00 63 	movl   $0x63,0x6b84(%edx)
+    1891:	00 00 00 
+  e->buf = p;
+    1894:	89 9a 88 6b 00 00    	mov    %ebx,0x6b88(%edx)
+  e->n = n;
+    189a:	c7 82 8c 6b 00 00 40 	movl   $0x40,0x6b8c(%edx)
+    18a1:	00 00 00 
+  e->off = off;
+    18a4:	c7 82 90 6b 00 00 00 	movl   $0x0,0x6b90(%edx)
+    18ab:	00 00 00 
+  e->user = r->sqtail;
+    18ae:	8b 15 84 6b 00 00    	mov    0x6b84,%edx
+    18b4:	89 50 14             	mov    %edx,0x14(%eax)
+  r->sqtail++;
+    18b7:	83 c2 01             	add    $0x1,%edx
+    18ba:	89 15 84 6b 00 00    	mov    %edx,0x6b84
+    if(ioring_enter(8) != 8 || r->sqhead != r->sqtail ||
+    18c0:	6a 08                	push   $0x8
+    18c2:	e8 5c 0d 00 00       	call   2623 <ioring_enter>
+    18c7:	83 c4 10             	add    $0x10,%esp
+    18ca:	83 f8 08             	cmp    $0x8,%eax
+    18cd:	0f 85 dc 01 00 00    	jne    1aaf <ioringtest+0x3cf>
+    18d3:	a1 84 6b 00 00       	mov    0x6b84,%eax
+    18d8:	89 85 50 fe ff ff    	mov    %eax,-0x1b0(%ebp)
+    18de:	39 05 80 6b 00 00    	cmp    %eax,0x6b80
+    18e4:	0f 85 c5 01 00 00    	jne    1aaf <ioringtest+0x3cf>
+       r->cqtail - r->cqhead != 8){
+    18ea:	8b 0d 88 6b 00 00    	mov    0x6b88,%ecx
+    18f0:	a1 8c 6b 00 00       	mov    0x6b8c,%eax
+    18f5:	29 c8                	sub    %ecx,%eax
+    if(ioring_enter(8) != 8 || r->sqhead != r->sqtail ||
+    18f7:	83 f8 08             	cmp    $0x8,%eax
+    18fa:	0f 85 af 01 00 00    	jne    1aaf <ioringtest+0x3cf>
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+    1900:	8b 1d 90 6b 00 00    	mov    0x6b90,%ebx
+    for(i = 0; i < 8; i++){
+    1906:	31 f6                	xor    %esi,%esi
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+    1908:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+    190b:	89 85 60 fe ff ff    	mov    %eax,-0x1a0(%ebp)
+    1911:	8b 85 5c fe ff ff    	mov    -0x1a4(%ebp),%eax
+    1917:	c1 e0 03             	shl    $0x3,%eax
+    191a:	89 85 64 fe ff ff    	mov    %eax,-0x19c(%ebp)
+    1920:	eb 1b                	jmp    193d <ioringtest+0x25d>
+    1922:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+    1928:	83 fa 40             	cmp    $0x40,%edx
+    192b:	0f 85 6b 01 00 00    	jne    1a9c <ioringtest+0x3bc>
+      r->cqhead++;
+    1931:	83 c1 01             	add    $0x1,%ecx
+    for(i = 0; i < 8; i++){
+    1934:	83 c6 01             	add    $0x1,%esi
+      r->cqhead++;
+    1937:	89 0d 88 6b 00 00    	mov    %ecx,0x6b88
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+    193d:	89 c8                	mov    %ecx,%eax
+    193f:	31 d2                	xor    %edx,%edx
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+    1941:	8b bd 64 fe ff ff    	mov    -0x19c(%ebp),%edi
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+    1947:	f7 f3                	div    %ebx
+    1949:	8b 85 60 fe ff ff    	mov    -0x1a0(%ebp),%eax
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+    194f:	01 f7                	add    %esi,%edi
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+    1951:	01 c2                	add    %eax,%edx
+    1953:	8d 14 d5 14 00 00 00 	lea    0x14(,%edx,8),%edx
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+    195a:	8b 82 80 6b 00 00    	mov    0x6b80(%edx),%eax
+    1960:	8b 92 84 6b 00 00    	mov    0x6b84(%edx),%edx
+    1966:	39 f8                	cmp    %edi,%eax
+    1968:	0f 85 2e 01 00 00    	jne    1a9c <ioringtest+0x3bc>
+    196e:	83 fe 05             	cmp    $0x5,%esi
+    1971:	7e b5                	jle    1928 <ioringtest+0x248>
+    1973:	83 fe 06             	cmp    $0x6,%esi
+    1976:	0f 84 f9 00 00 00    	je     1a75 <ioringtest+0x395>
+    197c:	83 fa ff             	cmp    $0xffffffff,%edx
+    197f:	0f 85 17 01 00 00    	jne    1a9c <ioringtest+0x3bc>
+      r->cqhead++;
+    1985:	83 c1 01             	add    $0x1,%ecx
+    1988:	8b bd 54 fe ff ff    	mov    -0x1ac(%ebp),%edi
+    for(i = 0; i < 6; i++)
+    198e:	31 f6                	xor    %esi,%esi
+      r->cqhead++;
+    1990:	89 0d 88 6b 00 00    	mov    %ecx,0x6b88
+    for(i = 0; i < 8; i++){
+    1996:	8d 8d a8 fe ff ff    	lea    -0x158(%ebp),%ecx
+      for(j = 0; j < 64; j++)
+    199c:	8d 41 c0             	lea    -0x40(%ecx),%eax
+    199f:	8d 14 7f             	lea    (%edi,%edi,2),%edx
+    19a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if(out[i][j] != (char)((i*1000 + round + j) * 3)){
+    19a8:	38 10                	cmp    %dl,(%eax)
+    19aa:	0f 85 d7 00 00 00    	jne    1a87 <ioringtest+0x3a7>
+      for(j = 0; j < 64; j++)
+    19b0:	83 c0 01             	add    $0x1,%eax
+    19b3:	83 c2 03             	add    $0x3,%edx
+    19b6:	39 c1                	cmp    %eax,%ecx
+    19b8:	75 ee                	jne    19a8 <ioringtest+0x2c8>
+    for(i = 0; i < 6; i++)
+    19ba:	83 c6 01             	add    $0x1,%esi
+    19bd:	83 c1 40             	add    $0x40,%ecx
+    19c0:	81 c7 e8 03 00 00    	add    $0x3e8,%edi
+    19c6:	83 fe 06             	cmp    $0x6,%esi
+    19c9:	75 d1                	jne    199c <ioringtest+0x2bc>
+  for(round = 0; round < 3; round++){
+    19cb:	83 85 5c fe ff ff 01 	addl   $0x1,-0x1a4(%ebp)
+    19d2:	8b 85 5c fe ff ff    	mov    -0x1a4(%ebp),%eax
+    19d8:	83 f8 03             	cmp    $0x3,%eax
+    19db:	0f 85 a0 fd ff ff    	jne    1781 <ioringtest+0xa1>
+  if(pread(fd, out[0], 5, 8000) != 5 || out[0][0] != 'x' || out[0][2] != 'x' ||
+    19e1:	8d 85 68 fe ff ff    	lea    -0x198(%ebp),%eax
+    19e7:	68 40 1f 00 00       	push   $0x1f40
+    19ec:	6a 05                	push   $0x5
+    19ee:	50                   	push   %eax
+    19ef:	ff b5 58 fe ff ff    	push   -0x1a8(%ebp)
+    19f5:	e8 f1 0b 00 00       	call   25eb <pread>
+    19fa:	83 c4 10             	add    $0x10,%esp
+    19fd:	83 f8 05             	cmp    $0x5,%eax
+    1a00:	0f 85 e9 00 00 00    	jne    1aef <ioringtest+0x40f>
+    1a06:	80 bd 68 fe ff ff 78 	cmpb   $0x78,-0x198(%ebp)
+    1a0d:	0f 85 dc 00 00 00    	jne    1aef <ioringtest+0x40f>
+    1a13:	80 bd 6a fe ff ff 78 	cmpb   $0x78,-0x196(%ebp)
+    1a1a:	0f 85 cf 00 00 00    	jne    1aef <ioringtest+0x40f>
+    1a20:	80 bd 6c fe ff ff 7a 	cmpb   $0x7a,-0x194(%ebp)
+    1a27:	0f 85 c2 00 00 00    	jne    1aef <ioringtest+0x40f>
+  if(ioring_enter(1) != 0){
+    1a2d:	83 ec 0c             	sub    $0xc,%esp
+    1a30:	6a 01                	push   $0x1
+    1a32:	e8 ec 0b 00 00       	call   2623 <ioring_enter>
+    1a37:	83 c4 10             	add    $0x10,%esp
+    1a3a:	85 c0                	test   %eax,%eax
+    1a3c:	0f 85 9a 00 00 00    	jne    1adc <ioringtest+0x3fc>
+  close(fd);
+    1a42:	83 ec 0c             	sub    $0xc,%esp
+    1a45:	ff b5 58 fe ff ff    	push   -0x1a8(%ebp)
+    1a4b:	e8 0b 0b 00 00       	call   255b <close>
+  unlink("ioring");
+    1a50:	c7 04 24 b9 35 00 00 	movl   $0x35b9,(%esp)
+    1a57:	e8 27 0b 00 00       	call   2583 <unlink>
+  printf(1, "ioring ok\n");
+    1a5c:	58                   	pop    %eax
+    1a5d:	5a                   	pop    %edx
+    1a5e:	68 39 36 00 00       	push   $0x3639
+    1a63:	6a 01                	push   $0x1
+    1a65:	e8 76 0c 00 00       	call   26e0 <printf>
+}
+    1a6a:	83 c4 10             	add    $0x10,%esp
+    1a6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a70:	5b                   	pop    %ebx
+    1a71:	5e                   	pop    %esi
+    1a72:	5f                   	pop    %edi
+    1a73:	5d                   	pop    %ebp
+    1a74:	c3                   	ret
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+    1a75:	83 fa 03             	cmp    $0x3,%edx
+    1a78:	75 22                	jne    1a9c <ioringtest+0x3bc>
+      r->cqhead++;
+    1a7a:	83 c1 01             	add    $0x1,%ecx
+    for(i = 0; i < 8; i++){
+    1a7d:	be 07 00 00 00       	mov    $0x7,%esi
+    1a82:	e9 b0 fe ff ff       	jmp    1937 <ioringtest+0x257>
+          printf(1, "ioring: read %d wrong\n", i);
+    1a87:	83 ec 04             	sub    $0x4,%esp
+    1a8a:	56                   	push   %esi
+    1a8b:	68 0d 36 00 00       	push   $0x360d
+    1a90:	6a 01                	push   $0x1
+    1a92:	e8 49 0c 00 00       	call   26e0 <printf>
+          exit();
+    1a97:	e8 97 0a 00 00       	call   2533 <exit>
+        printf(1, "ioring: result %d is %d\n", c->user, c->res);
+    1a9c:	52                   	push   %edx
+    1a9d:	50                   	push   %eax
+    1a9e:	68 f4 35 00 00       	push   $0x35f4
+    1aa3:	6a 01                	push   $0x1
+    1aa5:	e8 36 0c 00 00       	call   26e0 <printf>
+        exit();
+    1aaa:	e8 84 0a 00 00       	call   2533 <exit>
+      printf(1, "ioring: round %d not done\n", round);
+    1aaf:	83 ec 04             	sub    $0x4,%esp
+    1ab2:	ff b5 5c fe ff ff    	push   -0x1a4(%ebp)
+    1ab8:	68 d9 35 00 00       	push   $0x35d9
+    1abd:	6a 01                	push   $0x1
+    1abf:	e8 1c 0c 00 00       	call   26e0 <printf>
+      exit();
+    1ac4:	e8 6a 0a 00 00       	call   2533 <exit>
+    printf(1, "ioring_setup failed\n");
+    1ac9:	53                   	push   %ebx
+    1aca:	53                   	push   %ebx
+    1acb:	68 c0 35 00 00       	push   $0x35c0
+    1ad0:	6a 01                	push   $0x1
+    1ad2:	e8 09 0c 00 00       	call   26e0 <printf>
+    exit();
+    1ad7:	e8 57 0a 00 00       	call   2533 <exit>
+    printf(1, "ioring: empty ring did something\n");
+    1adc:	51                   	push   %ecx
+    1add:	51                   	push   %ecx
+    1ade:	68 20 3a 00 00       	push   $0x3a20
+    1ae3:	6a 01                	push   $0x1
+    1ae5:	e8 f6 0b 00 00       	call   26e0 <printf>
+    exit();
+    1aea:	e8 44 0a 00 00       	call   2533 <exit>
+    printf(1, "ioring: write wrong\n");
+    1aef:	83 ec 08             	sub    $0x8,%esp
+    1af2:	68 24 36 00 00       	push   $0x3624
+    1af7:	6a 01                	push   $0x1
+    1af9:	e8 e2 0b 00 00       	call   26e0 <printf>
+    exit();
+    1afe:	e8 30 0a 00 00       	call   2533 <exit>
+    1b03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001b10 <setop>:
+{
+    1b10:	55                   	push   %ebp
+    1b11:	89 e5                	mov    %esp,%ebp
+  ops[i].num = num;
+    1b13:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1b16:	8b 55 10             	mov    0x10(%ebp),%edx
+    1b19:	c1 e0 05             	shl    $0x5,%eax
+    1b1c:	03 45 08             	add    0x8(%ebp),%eax
+    1b1f:	89 10                	mov    %edx,(%eax)
+  ops[i].link = link;
+    1b21:	8b 55 14             	mov    0x14(%ebp),%edx
+  ops[i].ret = 0;
+    1b24:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  ops[i].link = link;
+    1b2b:	89 50 18             	mov    %edx,0x18(%eax)
+  ops[i].args[0] = a0;
+    1b2e:	8b 55 18             	mov    0x18(%ebp),%edx
+    1b31:	89 50 04             	mov    %edx,0x4(%eax)
+  ops[i].args[1] = a1;
+    1b34:	8b 55 1c             	mov    0x1c(%ebp),%edx
+    1b37:	89 50 08             	mov    %edx,0x8(%eax)
+  ops[i].args[2] = a2;
+    1b3a:	8b 55 20             	mov    0x20(%ebp),%edx
+    1b3d:	89 50 0c             	mov    %edx,0xc(%eax)
+}
+    1b40:	5d                   	pop    %ebp
+    1b41:	c3                   	ret
+    1b42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b50 <batchtest>:
+{
+    1b50:	55                   	push   %ebp
+    1b51:	89 e5                	mov    %esp,%ebp
+    1b53:	53                   	push   %ebx
+  if(batch(ops, 6, BATCH_ABORT) != 5 || ops[0].ret < 0 || ops[1].ret != 5 ||
+    1b54:	8d 9d 38 ff ff ff    	lea    -0xc8(%ebp),%ebx
+{
+    1b5a:	81 ec ec 00 00 00    	sub    $0xec,%esp
+  printf(1, "batch test\n");
+    1b60:	68 44 36 00 00       	push   $0x3644
+    1b65:	6a 01                	push   $0x1
+    1b67:	e8 74 0b 00 00       	call   26e0 <printf>
+  if(batch(ops, 6, BATCH_ABORT) != 5 || ops[0].ret < 0 || ops[1].ret != 5 ||
+    1b6c:	83 c4 0c             	add    $0xc,%esp
+  setop(ops, 2, SYS_fstat, 1, 0, (int)&st, 0);
+    1b6f:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+  ops[i].num = num;
+    1b75:	c7 85 38 ff ff ff 0f 	movl   $0xf,-0xc8(%ebp)
+    1b7c:	00 00 00 
+  setop(ops, 2, SYS_fstat, 1, 0, (int)&st, 0);
+    1b7f:	89 45 80             	mov    %eax,-0x80(%ebp)
+  ops[i].link = link;
+    1b82:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+    1b89:	00 00 00 
+  ops[i].args[0] = a0;
+    1b8c:	c7 85 3c ff ff ff 50 	movl   $0x3650,-0xc4(%ebp)
+    1b93:	36 00 00 
+  ops[i].args[1] = a1;
+    1b96:	c7 85 40 ff ff ff 02 	movl   $0x202,-0xc0(%ebp)
+    1b9d:	02 00 00 
+  ops[i].args[2] = a2;
+    1ba0:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%ebp)
+    1ba7:	00 00 00 
+  ops[i].ret = 0;
+    1baa:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+    1bb1:	00 00 00 
+  ops[i].num = num;
+    1bb4:	c7 85 58 ff ff ff 10 	movl   $0x10,-0xa8(%ebp)
+    1bbb:	00 00 00 
+  ops[i].link = link;
+    1bbe:	c7 85 70 ff ff ff 01 	movl   $0x1,-0x90(%ebp)
+    1bc5:	00 00 00 
+  ops[i].args[0] = a0;
+    1bc8:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+    1bcf:	00 00 00 
+  ops[i].args[1] = a1;
+    1bd2:	c7 85 60 ff ff ff 57 	movl   $0x3657,-0xa0(%ebp)
+    1bd9:	36 00 00 
+  ops[i].args[2] = a2;
+    1bdc:	c7 85 64 ff ff ff 05 	movl   $0x5,-0x9c(%ebp)
+    1be3:	00 00 00 
+  ops[i].ret = 0;
+    1be6:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1bed:	00 00 00 
+  ops[i].num = num;
+    1bf0:	c7 85 78 ff ff ff 08 	movl   $0x8,-0x88(%ebp)
+    1bf7:	00 00 00 
+  ops[i].link = link;
+    1bfa:	c7 45 90 01 00 00 00 	movl   $0x1,-0x70(%ebp)
+  ops[i].args[0] = a0;
+    1c01:	c7 85 7c ff ff ff 00 	movl   $0x0,-0x84(%ebp)
+    1c08:	00 00 00 
+  ops[i].args[2] = a2;
+    1c0b:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+  ops[i].ret = 0;
+    1c12:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+  ops[i].num = num;
+    1c19:	c7 45 98 15 00 00 00 	movl   $0x15,-0x68(%ebp)
+  ops[i].link = link;
+    1c20:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%ebp)
+  ops[i].args[0] = a0;
+    1c27:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+  ops[i].args[1] = a1;
+    1c2e:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+  ops[i].args[2] = a2;
+    1c35:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  ops[i].ret = 0;
+    1c3c:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  ops[i].num = num;
+    1c43:	c7 45 b8 15 00 00 00 	movl   $0x15,-0x48(%ebp)
+  ops[i].link = link;
+    1c4a:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+  ops[i].args[0] = a0;
+    1c51:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+  ops[i].args[1] = a1;
+    1c58:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  ops[i].args[2] = a2;
+    1c5f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  ops[i].ret = 0;
+    1c66:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  ops[i].num = num;
+    1c6d:	c7 45 d8 0b 00 00 00 	movl   $0xb,-0x28(%ebp)
+  ops[i].link = link;
+    1c74:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  ops[i].args[0] = a0;
+    1c7b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  ops[i].args[1] = a1;
+    1c82:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  ops[i].args[2] = a2;
+    1c89:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  ops[i].ret = 0;
+    1c90:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(batch(ops, 6, BATCH_ABORT) != 5 || ops[0].ret < 0 || ops[1].ret != 5 ||
+    1c97:	6a 01                	push   $0x1
+    1c99:	6a 06                	push   $0x6
+    1c9b:	53                   	push   %ebx
+    1c9c:	e8 8a 09 00 00       	call   262b <batch>
+    1ca1:	83 c4 10             	add    $0x10,%esp
+    1ca4:	83 f8 05             	cmp    $0x5,%eax
+    1ca7:	0f 85 6e 01 00 00    	jne    1e1b <batchtest+0x2cb>
+    1cad:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+    1cb3:	85 c9                	test   %ecx,%ecx
+    1cb5:	0f 88 60 01 00 00    	js     1e1b <batchtest+0x2cb>
+    1cbb:	83 bd 74 ff ff ff 05 	cmpl   $0x5,-0x8c(%ebp)
+    1cc2:	0f 85 53 01 00 00    	jne    1e1b <batchtest+0x2cb>
+     ops[2].ret != 0 || st.size != 5 || ops[3].ret != 0 || ops[4].ret != -1 ||
+    1cc8:	83 bd 34 ff ff ff 05 	cmpl   $0x5,-0xcc(%ebp)
+    1ccf:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1cd2:	0f 85 43 01 00 00    	jne    1e1b <batchtest+0x2cb>
+    1cd8:	83 7d d4 ff          	cmpl   $0xffffffff,-0x2c(%ebp)
+    1cdc:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+    1cdf:	0f 85 36 01 00 00    	jne    1e1b <batchtest+0x2cb>
+     ops[5].ret != 0 || ops[1].args[0] != 0 || ops[3].args[0] != 0){
+    1ce5:	09 d0                	or     %edx,%eax
+    1ce7:	0b 45 f4             	or     -0xc(%ebp),%eax
+    1cea:	0b 85 5c ff ff ff    	or     -0xa4(%ebp),%eax
+    1cf0:	0b 45 9c             	or     -0x64(%ebp),%eax
+    1cf3:	0f 85 22 01 00 00    	jne    1e1b <batchtest+0x2cb>
+  if(batch(ops, 4, 0) != 4 || ops[0].ret != getpid() || ops[1].ret != -1 ||
+    1cf9:	83 ec 04             	sub    $0x4,%esp
+  ops[i].num = num;
+    1cfc:	c7 85 38 ff ff ff 0b 	movl   $0xb,-0xc8(%ebp)
+    1d03:	00 00 00 
+  ops[i].link = link;
+    1d06:	c7 85 50 ff ff ff 00 	movl   $0x0,-0xb0(%ebp)
+    1d0d:	00 00 00 
+  ops[i].args[0] = a0;
+    1d10:	c7 85 3c ff ff ff 00 	movl   $0x0,-0xc4(%ebp)
+    1d17:	00 00 00 
+  ops[i].args[1] = a1;
+    1d1a:	c7 85 40 ff ff ff 00 	movl   $0x0,-0xc0(%ebp)
+    1d21:	00 00 00 
+  ops[i].args[2] = a2;
+    1d24:	c7 85 44 ff ff ff 00 	movl   $0x0,-0xbc(%ebp)
+    1d2b:	00 00 00 
+  ops[i].ret = 0;
+    1d2e:	c7 85 54 ff ff ff 00 	movl   $0x0,-0xac(%ebp)
+    1d35:	00 00 00 
+  ops[i].num = num;
+    1d38:	c7 85 58 ff ff ff 01 	movl   $0x1,-0xa8(%ebp)
+    1d3f:	00 00 00 
+  ops[i].link = link;
+    1d42:	c7 85 70 ff ff ff 00 	movl   $0x0,-0x90(%ebp)
+    1d49:	00 00 00 
+  ops[i].args[0] = a0;
+    1d4c:	c7 85 5c ff ff ff 00 	movl   $0x0,-0xa4(%ebp)
+    1d53:	00 00 00 
+  ops[i].args[1] = a1;
+    1d56:	c7 85 60 ff ff ff 00 	movl   $0x0,-0xa0(%ebp)
+    1d5d:	00 00 00 
+  ops[i].args[2] = a2;
+    1d60:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+    1d67:	00 00 00 
+  ops[i].ret = 0;
+    1d6a:	c7 85 74 ff ff ff 00 	movl   $0x0,-0x8c(%ebp)
+    1d71:	00 00 00 
+  ops[i].num = num;
+    1d74:	c7 85 78 ff ff ff 12 	movl   $0x12,-0x88(%ebp)
+    1d7b:	00 00 00 
+  ops[i].link = link;
+    1d7e:	c7 45 90 00 00 00 00 	movl   $0x0,-0x70(%ebp)
+  ops[i].args[0] = a0;
+    1d85:	c7 85 7c ff ff ff 50 	movl   $0x3650,-0x84(%ebp)
+    1d8c:	36 00 00 
+  ops[i].args[1] = a1;
+    1d8f:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%ebp)
+  ops[i].args[2] = a2;
+    1d96:	c7 45 84 00 00 00 00 	movl   $0x0,-0x7c(%ebp)
+  ops[i].ret = 0;
+    1d9d:	c7 45 94 00 00 00 00 	movl   $0x0,-0x6c(%ebp)
+  ops[i].num = num;
+    1da4:	c7 45 98 15 00 00 00 	movl   $0x15,-0x68(%ebp)
+  ops[i].link = link;
+    1dab:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%ebp)
+  ops[i].args[0] = a0;
+    1db2:	c7 45 9c 03 00 00 00 	movl   $0x3,-0x64(%ebp)
+  ops[i].args[1] = a1;
+    1db9:	c7 45 a0 00 00 00 00 	movl   $0x0,-0x60(%ebp)
+  ops[i].args[2] = a2;
+    1dc0:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  ops[i].ret = 0;
+    1dc7:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  if(batch(ops, 4, 0) != 4 || ops[0].ret != getpid() || ops[1].ret != -1 ||
+    1dce:	6a 00                	push   $0x0
+    1dd0:	6a 04                	push   $0x4
+    1dd2:	53                   	push   %ebx
+    1dd3:	e8 53 08 00 00       	call   262b <batch>
+    1dd8:	83 c4 10             	add    $0x10,%esp
+    1ddb:	83 f8 04             	cmp    $0x4,%eax
+    1dde:	75 4f                	jne    1e2f <batchtest+0x2df>
+    1de0:	8b 9d 54 ff ff ff    	mov    -0xac(%ebp),%ebx
+    1de6:	e8 c8 07 00 00       	call   25b3 <getpid>
+    1deb:	39 c3                	cmp    %eax,%ebx
+    1ded:	75 40                	jne    1e2f <batchtest+0x2df>
+    1def:	8b 55 94             	mov    -0x6c(%ebp),%edx
+    1df2:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+    1df8:	85 d2                	test   %edx,%edx
+    1dfa:	75 33                	jne    1e2f <batchtest+0x2df>
+     ops[2].ret != 0 || ops[3].ret != -1){
+    1dfc:	23 45 b4             	and    -0x4c(%ebp),%eax
+    1dff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1e02:	75 2b                	jne    1e2f <batchtest+0x2df>
+  printf(1, "batch ok\n");
+    1e04:	83 ec 08             	sub    $0x8,%esp
+    1e07:	68 73 36 00 00       	push   $0x3673
+    1e0c:	6a 01                	push   $0x1
+    1e0e:	e8 cd 08 00 00       	call   26e0 <printf>
+}
+    1e13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1e16:	83 c4 10             	add    $0x10,%esp
+    1e19:	c9                   	leave
+    1e1a:	c3                   	ret
+    printf(1, "batch: wrong results\n");
+    1e1b:	83 ec 08             	sub    $0x8,%esp
+    1e1e:	68 5d 36 00 00       	push   $0x365d
+    1e23:	6a 01                	push   $0x1
+    1e25:	e8 b6 08 00 00       	call   26e0 <printf>
+    exit();
+    1e2a:	e8 04 07 00 00       	call   2533 <exit>
+    printf(1, "batch: forked or linked forward\n");
+    1e2f:	83 ec 08             	sub    $0x8,%esp
+    1e32:	68 44 3a 00 00       	push   $0x3a44
+    1e37:	6a 01                	push   $0x1
+    1e39:	e8 a2 08 00 00       	call   26e0 <printf>
+    exit();
+    1e3e:	e8 f0 06 00 00       	call   2533 <exit>
+    1e43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001e50 <batchbench>:
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	57                   	push   %edi
+    1e54:	56                   	push   %esi
+    1e55:	53                   	push   %ebx
+    1e56:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "batchbench test\n");
+    1e59:	68 7d 36 00 00       	push   $0x367d
+    1e5e:	6a 01                	push   $0x1
+    1e60:	e8 7b 08 00 00       	call   26e0 <printf>
+  for(i = 0; i < BATCH_MAX; i++)
+    1e65:	ba 80 63 00 00       	mov    $0x6380,%edx
+    1e6a:	83 c4 10             	add    $0x10,%esp
+  printf(1, "batchbench test\n");
+    1e6d:	89 d0                	mov    %edx,%eax
+    1e6f:	90                   	nop
+  ops[i].num = num;
+    1e70:	c7 00 0b 00 00 00    	movl   $0xb,(%eax)
+  for(i = 0; i < BATCH_MAX; i++)
+    1e76:	83 c0 20             	add    $0x20,%eax
+  ops[i].link = link;
+    1e79:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  ops[i].args[0] = a0;
+    1e80:	c7 40 e4 00 00 00 00 	movl   $0x0,-0x1c(%eax)
+  ops[i].args[1] = a1;
+    1e87:	c7 40 e8 00 00 00 00 	movl   $0x0,-0x18(%eax)
+  ops[i].args[2] = a2;
+    1e8e:	c7 40 ec 00 00 00 00 	movl   $0x0,-0x14(%eax)
+  ops[i].ret = 0;
+    1e95:	c7 40 fc 00 00 00 00 	movl   $0x0,-0x4(%eax)
+  for(i = 0; i < BATCH_MAX; i++)
+    1e9c:	3d 80 6b 00 00       	cmp    $0x6b80,%eax
+    1ea1:	75 cd                	jne    1e70 <batchbench+0x20>
+  t0 = uptime();
+    1ea3:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1ea6:	bb 00 fa 00 00       	mov    $0xfa00,%ebx
+    1eab:	e8 1b 07 00 00       	call   25cb <uptime>
+    1eb0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    1eb3:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < 1000*BATCH_MAX; i++)
+    1eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebd:	8d 76 00             	lea    0x0(%esi),%esi
+    getpid();
+    1ec0:	e8 ee 06 00 00       	call   25b3 <getpid>
+  for(i = 0; i < 1000*BATCH_MAX; i++)
+    1ec5:	83 eb 01             	sub    $0x1,%ebx
+    1ec8:	75 f6                	jne    1ec0 <batchbench+0x70>
+  t1 = uptime();
+    1eca:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    1ecd:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    1ed2:	e8 f4 06 00 00       	call   25cb <uptime>
+    1ed7:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+    1eda:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 1000; i++)
+    1edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(batch(ops, BATCH_MAX, 0) != BATCH_MAX){
+    1ee0:	83 ec 04             	sub    $0x4,%esp
+    1ee3:	6a 00                	push   $0x0
+    1ee5:	6a 40                	push   $0x40
+    1ee7:	68 80 63 00 00       	push   $0x6380
+    1eec:	e8 3a 07 00 00       	call   262b <batch>
+    1ef1:	83 c4 10             	add    $0x10,%esp
+    1ef4:	83 f8 40             	cmp    $0x40,%eax
+    1ef7:	0f 85 85 01 00 00    	jne    2082 <batchbench+0x232>
+  for(i = 0; i < 1000; i++)
+    1efd:	83 eb 01             	sub    $0x1,%ebx
+    1f00:	75 de                	jne    1ee0 <batchbench+0x90>
+  fd = open("batchbf", O_CREATE|O_RDWR);
+    1f02:	83 ec 08             	sub    $0x8,%esp
+    1f05:	89 75 bc             	mov    %esi,-0x44(%ebp)
+  t2 = uptime();
+    1f08:	bb 34 08 00 00       	mov    $0x834,%ebx
+    1f0d:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+  fd = open("batchbf", O_CREATE|O_RDWR);
+    1f10:	68 02 02 00 00       	push   $0x202
+    1f15:	68 a8 36 00 00       	push   $0x36a8
+    1f1a:	e8 54 06 00 00       	call   2573 <open>
+  close(fd);
+    1f1f:	89 04 24             	mov    %eax,(%esp)
+    1f22:	e8 34 06 00 00       	call   255b <close>
+  t2 = uptime();
+    1f27:	e8 9f 06 00 00       	call   25cb <uptime>
+    1f2c:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    1f2f:	83 c4 10             	add    $0x10,%esp
+    1f32:	89 45 b8             	mov    %eax,-0x48(%ebp)
+  for(i = 0; i < 100*(BATCH_MAX/3); i++){
+    1f35:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open("batchbf", O_RDONLY);
+    1f38:	83 ec 08             	sub    $0x8,%esp
+    1f3b:	6a 00                	push   $0x0
+    1f3d:	68 a8 36 00 00       	push   $0x36a8
+    1f42:	e8 2c 06 00 00       	call   2573 <open>
+    fstat(fd, &st);
+    1f47:	5a                   	pop    %edx
+    1f48:	59                   	pop    %ecx
+    1f49:	56                   	push   %esi
+    1f4a:	50                   	push   %eax
+    fd = open("batchbf", O_RDONLY);
+    1f4b:	89 c7                	mov    %eax,%edi
+    fstat(fd, &st);
+    1f4d:	e8 39 06 00 00       	call   258b <fstat>
+    close(fd);
+    1f52:	89 3c 24             	mov    %edi,(%esp)
+    1f55:	e8 01 06 00 00       	call   255b <close>
+  for(i = 0; i < 100*(BATCH_MAX/3); i++){
+    1f5a:	83 c4 10             	add    $0x10,%esp
+    1f5d:	83 eb 01             	sub    $0x1,%ebx
+    1f60:	75 d6                	jne    1f38 <batchbench+0xe8>
+  t3 = uptime();
+    1f62:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    1f65:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+    1f68:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1f6b:	e8 5b 06 00 00       	call   25cb <uptime>
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    1f70:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    setop(ops, j, SYS_open, 0, (int)"batchbf", O_RDONLY, 0);
+    1f73:	b9 a8 36 00 00       	mov    $0x36a8,%ecx
+  t3 = uptime();
+    1f78:	89 c3                	mov    %eax,%ebx
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    1f7a:	31 c0                	xor    %eax,%eax
+    1f7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ops[i].args[0] = a0;
+    1f80:	89 42 24             	mov    %eax,0x24(%edx)
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    1f83:	83 c2 60             	add    $0x60,%edx
+  ops[i].args[0] = a0;
+    1f86:	89 42 e4             	mov    %eax,-0x1c(%edx)
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    1f89:	83 c0 03             	add    $0x3,%eax
+  ops[i].num = num;
+    1f8c:	c7 42 a0 0f 00 00 00 	movl   $0xf,-0x60(%edx)
+  ops[i].link = link;
+    1f93:	c7 42 b8 00 00 00 00 	movl   $0x0,-0x48(%edx)
+  ops[i].args[0] = a0;
+    1f9a:	89 4a a4             	mov    %ecx,-0x5c(%edx)
+  ops[i].args[1] = a1;
+    1f9d:	c7 42 a8 00 00 00 00 	movl   $0x0,-0x58(%edx)
+  ops[i].args[2] = a2;
+    1fa4:	c7 42 ac 00 00 00 00 	movl   $0x0,-0x54(%edx)
+  ops[i].ret = 0;
+    1fab:	c7 42 bc 00 00 00 00 	movl   $0x0,-0x44(%edx)
+  ops[i].num = num;
+    1fb2:	c7 42 c0 08 00 00 00 	movl   $0x8,-0x40(%edx)
+  ops[i].link = link;
+    1fb9:	c7 42 d8 01 00 00 00 	movl   $0x1,-0x28(%edx)
+  ops[i].args[1] = a1;
+    1fc0:	89 72 c8             	mov    %esi,-0x38(%edx)
+  ops[i].args[2] = a2;
+    1fc3:	c7 42 cc 00 00 00 00 	movl   $0x0,-0x34(%edx)
+  ops[i].ret = 0;
+    1fca:	c7 42 dc 00 00 00 00 	movl   $0x0,-0x24(%edx)
+  ops[i].num = num;
+    1fd1:	c7 42 e0 15 00 00 00 	movl   $0x15,-0x20(%edx)
+  ops[i].link = link;
+    1fd8:	c7 42 f8 01 00 00 00 	movl   $0x1,-0x8(%edx)
+  ops[i].args[1] = a1;
+    1fdf:	c7 42 e8 00 00 00 00 	movl   $0x0,-0x18(%edx)
+  ops[i].args[2] = a2;
+    1fe6:	c7 42 ec 00 00 00 00 	movl   $0x0,-0x14(%edx)
+  ops[i].ret = 0;
+    1fed:	c7 42 fc 00 00 00 00 	movl   $0x0,-0x4(%edx)
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    1ff4:	83 f8 3f             	cmp    $0x3f,%eax
+    1ff7:	75 87                	jne    1f80 <batchbench+0x130>
+    1ff9:	be 64 00 00 00       	mov    $0x64,%esi
+    1ffe:	66 90                	xchg   %ax,%ax
+    if(batch(ops, j, BATCH_ABORT) != j || ops[j-1].ret != 0){
+    2000:	83 ec 04             	sub    $0x4,%esp
+    2003:	6a 01                	push   $0x1
+    2005:	6a 3f                	push   $0x3f
+    2007:	68 80 63 00 00       	push   $0x6380
+    200c:	e8 1a 06 00 00       	call   262b <batch>
+    2011:	83 c4 10             	add    $0x10,%esp
+    2014:	83 f8 3f             	cmp    $0x3f,%eax
+    2017:	75 55                	jne    206e <batchbench+0x21e>
+    2019:	a1 5c 6b 00 00       	mov    0x6b5c,%eax
+    201e:	85 c0                	test   %eax,%eax
+    2020:	75 4c                	jne    206e <batchbench+0x21e>
+  for(i = 0; i < 100; i++){
+    2022:	83 ee 01             	sub    $0x1,%esi
+    2025:	75 d9                	jne    2000 <batchbench+0x1b0>
+  t4 = uptime();
+    2027:	e8 9f 05 00 00       	call   25cb <uptime>
+  unlink("batchbf");
+    202c:	83 ec 0c             	sub    $0xc,%esp
+    202f:	68 a8 36 00 00       	push   $0x36a8
+  t4 = uptime();
+    2034:	89 c6                	mov    %eax,%esi
+  printf(1, "batchbench ok, %d getpid %d/%d ticks, %d open/fstat/close %d/%d ticks"
+    2036:	29 de                	sub    %ebx,%esi
+  unlink("batchbf");
+    2038:	e8 46 05 00 00       	call   2583 <unlink>
+  printf(1, "batchbench ok, %d getpid %d/%d ticks, %d open/fstat/close %d/%d ticks"
+    203d:	56                   	push   %esi
+    203e:	8b 45 b8             	mov    -0x48(%ebp),%eax
+    2041:	29 c3                	sub    %eax,%ebx
+    2043:	29 f8                	sub    %edi,%eax
+    2045:	53                   	push   %ebx
+    2046:	68 34 08 00 00       	push   $0x834
+    204b:	50                   	push   %eax
+    204c:	8b 45 c0             	mov    -0x40(%ebp),%eax
+    204f:	29 c7                	sub    %eax,%edi
+    2051:	57                   	push   %edi
+    2052:	68 00 fa 00 00       	push   $0xfa00
+    2057:	68 88 3a 00 00       	push   $0x3a88
+    205c:	6a 01                	push   $0x1
+    205e:	e8 7d 06 00 00       	call   26e0 <printf>
+}
+    2063:	83 c4 30             	add    $0x30,%esp
+    2066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2069:	5b                   	pop    %ebx
+    206a:	5e                   	pop    %esi
+    206b:	5f                   	pop    %edi
+    206c:	5d                   	pop    %ebp
+    206d:	c3                   	ret
+      printf(1, "batchbench: open batch failed\n");
+    206e:	83 ec 08             	sub    $0x8,%esp
+    2071:	68 68 3a 00 00       	push   $0x3a68
+    2076:	6a 01                	push   $0x1
+    2078:	e8 63 06 00 00       	call   26e0 <printf>
+      exit();
+    207d:	e8 b1 04 00 00       	call   2533 <exit>
+      printf(1, "batchbench: batch failed\n");
+    2082:	83 ec 08             	sub    $0x8,%esp
+    2085:	68 8e 36 00 00       	push   $0x368e
+    208a:	6a 01                	push   $0x1
+    208c:	e8 4f 06 00 00       	call   26e0 <printf>
+      exit();
+    2091:	e8 9d 04 00 00       	call   2533 <exit>
+    2096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020a0 <fourreaders>:
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+    20a3:	57                   	push   %edi
+    20a4:	56                   	push   %esi
+    20a5:	53                   	push   %ebx
+    20a6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "fourreaders test\n");
+    20a9:	68 b0 36 00 00       	push   $0x36b0
+    20ae:	6a 01                	push   $0x1
+    20b0:	e8 2b 06 00 00       	call   26e0 <printf>
+  unlink("fourreaders");
+    20b5:	c7 04 24 c2 36 00 00 	movl   $0x36c2,(%esp)
+    20bc:	e8 c2 04 00 00       	call   2583 <unlink>
+  fd = open("fourreaders", O_CREATE | O_RDWR);
+    20c1:	5b                   	pop    %ebx
+    20c2:	5e                   	pop    %esi
+    20c3:	68 02 02 00 00       	push   $0x202
+    20c8:	68 c2 36 00 00       	push   $0x36c2
+    20cd:	e8 a1 04 00 00       	call   2573 <open>
+  if(fd < 0){
+    20d2:	83 c4 10             	add    $0x10,%esp
+    20d5:	85 c0                	test   %eax,%eax
+    20d7:	0f 88 a4 01 00 00    	js     2281 <fourreaders+0x1e1>
+      buf[j] = (i*2000 + j) % 251;
+    20dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    20e0:	31 f6                	xor    %esi,%esi
+    20e2:	bf bf bf 8c 82       	mov    $0x828cbfbf,%edi
+    20e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20ee:	66 90                	xchg   %ax,%ax
+    for(j = 0; j < 2000; j++)
+    20f0:	31 c9                	xor    %ecx,%ecx
+    20f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      buf[j] = (i*2000 + j) % 251;
+    20f8:	8d 1c 31             	lea    (%ecx,%esi,1),%ebx
+    for(j = 0; j < 2000; j++)
+    20fb:	83 c1 01             	add    $0x1,%ecx
+      buf[j] = (i*2000 + j) % 251;
+    20fe:	89 d8                	mov    %ebx,%eax
+    2100:	f7 e7                	mul    %edi
+    2102:	c1 ea 07             	shr    $0x7,%edx
+    2105:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    210b:	29 d3                	sub    %edx,%ebx
+    210d:	88 99 7f 43 00 00    	mov    %bl,0x437f(%ecx)
+    for(j = 0; j < 2000; j++)
+    2113:	81 f9 d0 07 00 00    	cmp    $0x7d0,%ecx
+    2119:	75 dd                	jne    20f8 <fourreaders+0x58>
+    if(write(fd, buf, 2000) != 2000){
+    211b:	83 ec 04             	sub    $0x4,%esp
+    211e:	68 d0 07 00 00       	push   $0x7d0
+    2123:	68 80 43 00 00       	push   $0x4380
+    2128:	ff 75 e4             	push   -0x1c(%ebp)
+    212b:	e8 23 04 00 00       	call   2553 <write>
+    2130:	83 c4 10             	add    $0x10,%esp
+    2133:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+    2138:	0f 85 90 01 00 00    	jne    22ce <fourreaders+0x22e>
+  for(i = 0; i < 32; i++){
+    213e:	81 c6 d0 07 00 00    	add    $0x7d0,%esi
+    2144:	81 fe 00 fa 00 00    	cmp    $0xfa00,%esi
+    214a:	75 a4                	jne    20f0 <fourreaders+0x50>
+    214c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  close(fd);
+    214f:	83 ec 0c             	sub    $0xc,%esp
+  t0 = uptime();
+    2152:	be 04 00 00 00       	mov    $0x4,%esi
+  close(fd);
+    2157:	52                   	push   %edx
+    2158:	e8 fe 03 00 00       	call   255b <close>
+  t0 = uptime();
+    215d:	e8 69 04 00 00       	call   25cb <uptime>
+    2162:	83 c4 10             	add    $0x10,%esp
+    2165:	89 c3                	mov    %eax,%ebx
+    pid = fork();
+    2167:	e8 bf 03 00 00       	call   252b <fork>
+    if(pid < 0){
+    216c:	85 c0                	test   %eax,%eax
+    216e:	0f 88 46 01 00 00    	js     22ba <fourreaders+0x21a>
+    if(pid == 0){
+    2174:	74 48                	je     21be <fourreaders+0x11e>
+  for(i = 0; i < 4; i++){
+    2176:	83 ee 01             	sub    $0x1,%esi
+    2179:	75 ec                	jne    2167 <fourreaders+0xc7>
+    wait();
+    217b:	e8 bb 03 00 00       	call   253b <wait>
+    2180:	e8 b6 03 00 00       	call   253b <wait>
+    2185:	e8 b1 03 00 00       	call   253b <wait>
+    218a:	e8 ac 03 00 00       	call   253b <wait>
+  unlink("fourreaders");
+    218f:	83 ec 0c             	sub    $0xc,%esp
+    2192:	68 c2 36 00 00       	push   $0x36c2
+    2197:	e8 e7 03 00 00       	call   2583 <unlink>
+  printf(1, "fourreaders ok, %d ticks\n", uptime() - t0);
+    219c:	e8 2a 04 00 00       	call   25cb <uptime>
+    21a1:	83 c4 0c             	add    $0xc,%esp
+    21a4:	29 d8                	sub    %ebx,%eax
+    21a6:	50                   	push   %eax
+    21a7:	68 45 37 00 00       	push   $0x3745
+    21ac:	6a 01                	push   $0x1
+    21ae:	e8 2d 05 00 00       	call   26e0 <printf>
+}
+    21b3:	83 c4 10             	add    $0x10,%esp
+    21b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21b9:	5b                   	pop    %ebx
+    21ba:	5e                   	pop    %esi
+    21bb:	5f                   	pop    %edi
+    21bc:	5d                   	pop    %ebp
+    21bd:	c3                   	ret
+    21be:	c7 45 dc 08 00 00 00 	movl   $0x8,-0x24(%ebp)
+        fd = open("fourreaders", 0);
+    21c5:	83 ec 08             	sub    $0x8,%esp
+    21c8:	6a 00                	push   $0x0
+    21ca:	68 c2 36 00 00       	push   $0x36c2
+    21cf:	e8 9f 03 00 00       	call   2573 <open>
+        if(fd < 0){
+    21d4:	83 c4 10             	add    $0x10,%esp
+        fd = open("fourreaders", 0);
+    21d7:	89 c6                	mov    %eax,%esi
+        if(fd < 0){
+    21d9:	85 c0                	test   %eax,%eax
+    21db:	0f 88 c6 00 00 00    	js     22a7 <fourreaders+0x207>
+        off = 0;
+    21e1:	31 ff                	xor    %edi,%edi
+    21e3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+        while((n = read(fd, buf, 1000)) > 0){
+    21e6:	83 ec 04             	sub    $0x4,%esp
+    21e9:	68 e8 03 00 00       	push   $0x3e8
+    21ee:	68 80 43 00 00       	push   $0x4380
+    21f3:	56                   	push   %esi
+    21f4:	e8 52 03 00 00       	call   254b <read>
+    21f9:	83 c4 10             	add    $0x10,%esp
+    21fc:	85 c0                	test   %eax,%eax
+    21fe:	7e 46                	jle    2246 <fourreaders+0x1a6>
+          for(j = 0; j < n; j++){
+    2200:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    2203:	31 c9                	xor    %ecx,%ecx
+    2205:	89 c6                	mov    %eax,%esi
+    2207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    220e:	66 90                	xchg   %ax,%ax
+            if((uchar)buf[j] != (off + j) % 251){
+    2210:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2213:	0f b6 99 80 43 00 00 	movzbl 0x4380(%ecx),%ebx
+    221a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    221d:	b8 bf bf 8c 82       	mov    $0x828cbfbf,%eax
+    2222:	f7 e7                	mul    %edi
+    2224:	89 f8                	mov    %edi,%eax
+    2226:	c1 ea 07             	shr    $0x7,%edx
+    2229:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+    222f:	29 d0                	sub    %edx,%eax
+    2231:	39 c3                	cmp    %eax,%ebx
+    2233:	75 37                	jne    226c <fourreaders+0x1cc>
+          for(j = 0; j < n; j++){
+    2235:	83 c1 01             	add    $0x1,%ecx
+    2238:	39 ce                	cmp    %ecx,%esi
+    223a:	75 d4                	jne    2210 <fourreaders+0x170>
+          off += n;
+    223c:	89 f0                	mov    %esi,%eax
+    223e:	8b 75 e0             	mov    -0x20(%ebp),%esi
+    2241:	01 45 e4             	add    %eax,-0x1c(%ebp)
+    2244:	eb a0                	jmp    21e6 <fourreaders+0x146>
+        close(fd);
+    2246:	83 ec 0c             	sub    $0xc,%esp
+    2249:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    224c:	56                   	push   %esi
+    224d:	e8 09 03 00 00       	call   255b <close>
+        if(off != 32*2000){
+    2252:	83 c4 10             	add    $0x10,%esp
+    2255:	81 ff 00 fa 00 00    	cmp    $0xfa00,%edi
+    225b:	75 37                	jne    2294 <fourreaders+0x1f4>
+      for(pass = 0; pass < 8; pass++){
+    225d:	83 6d dc 01          	subl   $0x1,-0x24(%ebp)
+    2261:	0f 85 5e ff ff ff    	jne    21c5 <fourreaders+0x125>
+      exit();
+    2267:	e8 c7 02 00 00       	call   2533 <exit>
+              printf(1, "fourreaders: wrong byte at %d\n", off + j);
+    226c:	83 ec 04             	sub    $0x4,%esp
+    226f:	57                   	push   %edi
+    2270:	68 e4 3a 00 00       	push   $0x3ae4
+    2275:	6a 01                	push   $0x1
+    2277:	e8 64 04 00 00       	call   26e0 <printf>
+              exit();
+    227c:	e8 b2 02 00 00       	call   2533 <exit>
+    printf(1, "create fourreaders failed\n");
+    2281:	51                   	push   %ecx
+    2282:	51                   	push   %ecx
+    2283:	68 ce 36 00 00       	push   $0x36ce
+    2288:	6a 01                	push   $0x1
+    228a:	e8 51 04 00 00       	call   26e0 <printf>
+    exit();
+    228f:	e8 9f 02 00 00       	call   2533 <exit>
+          printf(1, "fourreaders: read %d bytes\n", off);
+    2294:	50                   	push   %eax
+    2295:	57                   	push   %edi
+    2296:	68 29 37 00 00       	push   $0x3729
+    229b:	6a 01                	push   $0x1
+    229d:	e8 3e 04 00 00       	call   26e0 <printf>
+          exit();
+    22a2:	e8 8c 02 00 00       	call   2533 <exit>
+          printf(1, "open fourreaders failed\n");
+    22a7:	52                   	push   %edx
+    22a8:	52                   	push   %edx
+    22a9:	68 10 37 00 00       	push   $0x3710
+    22ae:	6a 01                	push   $0x1
+    22b0:	e8 2b 04 00 00       	call   26e0 <printf>
+          exit();
+    22b5:	e8 79 02 00 00       	call   2533 <exit>
+      printf(1, "fork failed\n");
+    22ba:	83 ec 08             	sub    $0x8,%esp
+    22bd:	68 03 37 00 00       	push   $0x3703
+    22c2:	6a 01                	push   $0x1
+    22c4:	e8 17 04 00 00       	call   26e0 <printf>
+      exit();
+    22c9:	e8 65 02 00 00       	call   2533 <exit>
+      printf(1, "write fourreaders failed\n");
+    22ce:	83 ec 08             	sub    $0x8,%esp
+    22d1:	68 e9 36 00 00       	push   $0x36e9
+    22d6:	6a 01                	push   $0x1
+    22d8:	e8 03 04 00 00       	call   26e0 <printf>
+      exit();
+    22dd:	e8 51 02 00 00       	call   2533 <exit>
+    22e2:	66 90                	xchg   %ax,%ax
+    22e4:	66 90                	xchg   %ax,%ax
+    22e6:	66 90                	xchg   %ax,%ax
+    22e8:	66 90                	xchg   %ax,%ax
+    22ea:	66 90                	xchg   %ax,%ax
+    22ec:	66 90                	xchg   %ax,%ax
+    22ee:	66 90                	xchg   %ax,%ax
+
+000022f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    22f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    22f1:	31 c0                	xor    %eax,%eax
+{
+    22f3:	89 e5                	mov    %esp,%ebp
+    22f5:	53                   	push   %ebx
+    22f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    22f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    22fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    2300:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    2304:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    2307:	83 c0 01             	add    $0x1,%eax
+    230a:	84 d2                	test   %dl,%dl
+    230c:	75 f2                	jne    2300 <strcpy+0x10>
+    ;
+  return os;
+}
+    230e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2311:	89 c8                	mov    %ecx,%eax
+    2313:	c9                   	leave
+    2314:	c3                   	ret
+    2315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    231c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002320 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    2320:	55                   	push   %ebp
+    2321:	89 e5                	mov    %esp,%ebp
+    2323:	53                   	push   %ebx
+    2324:	8b 55 08             	mov    0x8(%ebp),%edx
+    2327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    232a:	0f b6 02             	movzbl (%edx),%eax
+    232d:	84 c0                	test   %al,%al
+    232f:	75 17                	jne    2348 <strcmp+0x28>
+    2331:	eb 3a                	jmp    236d <strcmp+0x4d>
+    2333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2337:	90                   	nop
+    2338:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    233c:	83 c2 01             	add    $0x1,%edx
+    233f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    2342:	84 c0                	test   %al,%al
+    2344:	74 1a                	je     2360 <strcmp+0x40>
+    p++, q++;
+    2346:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    2348:	0f b6 19             	movzbl (%ecx),%ebx
+    234b:	38 c3                	cmp    %al,%bl
+    234d:	74 e9                	je     2338 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    234f:	29 d8                	sub    %ebx,%eax
+}
+    2351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2354:	c9                   	leave
+    2355:	c3                   	ret
+    2356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    235d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    2360:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    2364:	31 c0                	xor    %eax,%eax
+    2366:	29 d8                	sub    %ebx,%eax
+}
+    2368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    236b:	c9                   	leave
+    236c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    236d:	0f b6 19             	movzbl (%ecx),%ebx
+    2370:	31 c0                	xor    %eax,%eax
+    2372:	eb db                	jmp    234f <strcmp+0x2f>
+    2374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    237b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    237f:	90                   	nop
+
+00002380 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    2380:	55                   	push   %ebp
+    2381:	89 e5                	mov    %esp,%ebp
+    2383:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    2386:	80 3a 00             	cmpb   $0x0,(%edx)
+    2389:	74 15                	je     23a0 <strlen+0x20>
+    238b:	31 c0                	xor    %eax,%eax
+    238d:	8d 76 00             	lea    0x0(%esi),%esi
+    2390:	83 c0 01             	add    $0x1,%eax
+    2393:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    2397:	89 c1                	mov    %eax,%ecx
+    2399:	75 f5                	jne    2390 <strlen+0x10>
+    ;
+  return n;
+}
+    239b:	89 c8                	mov    %ecx,%eax
+    239d:	5d                   	pop    %ebp
+    239e:	c3                   	ret
+    239f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    23a0:	31 c9                	xor    %ecx,%ecx
+}
+    23a2:	5d                   	pop    %ebp
+    23a3:	89 c8                	mov    %ecx,%eax
+    23a5:	c3                   	ret
+    23a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000023b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    23b0:	55                   	push   %ebp
+    23b1:	89 e5                	mov    %esp,%ebp
+    23b3:	57                   	push   %edi
+    23b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    23b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    23ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+    23bd:	89 d7                	mov    %edx,%edi
+    23bf:	fc                   	cld
+    23c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    23c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    23c5:	89 d0                	mov    %edx,%eax
+    23c7:	c9                   	leave
+    23c8:	c3                   	ret
+    23c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000023d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    23d0:	55                   	push   %ebp
+    23d1:	89 e5                	mov    %esp,%ebp
+    23d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    23d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    23da:	0f b6 10             	movzbl (%eax),%edx
+    23dd:	84 d2                	test   %dl,%dl
+    23df:	75 12                	jne    23f3 <strchr+0x23>
+    23e1:	eb 1d                	jmp    2400 <strchr+0x30>
+    23e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    23e7:	90                   	nop
+    23e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    23ec:	83 c0 01             	add    $0x1,%eax
+    23ef:	84 d2                	test   %dl,%dl
+    23f1:	74 0d                	je     2400 <strchr+0x30>
+    if(*s == c)
+    23f3:	38 d1                	cmp    %dl,%cl
+    23f5:	75 f1                	jne    23e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    23f7:	5d                   	pop    %ebp
+    23f8:	c3                   	ret
+    23f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    2400:	31 c0                	xor    %eax,%eax
+}
+    2402:	5d                   	pop    %ebp
+    2403:	c3                   	ret
+    2404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    240b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    240f:	90                   	nop
+
+00002410 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    2410:	55                   	push   %ebp
+    2411:	89 e5                	mov    %esp,%ebp
+    2413:	57                   	push   %edi
+    2414:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    2415:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    2418:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    2419:	31 db                	xor    %ebx,%ebx
+{
+    241b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    241e:	eb 27                	jmp    2447 <gets+0x37>
+    cc = read(0, &c, 1);
+    2420:	83 ec 04             	sub    $0x4,%esp
+    2423:	6a 01                	push   $0x1
+    2425:	56                   	push   %esi
+    2426:	6a 00                	push   $0x0
+    2428:	e8 1e 01 00 00       	call   254b <read>
+    if(cc < 1)
+    242d:	83 c4 10             	add    $0x10,%esp
+    2430:	85 c0                	test   %eax,%eax
+    2432:	7e 1d                	jle    2451 <gets+0x41>
+      break;
+    buf[i++] = c;
+    2434:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    2438:	8b 55 08             	mov    0x8(%ebp),%edx
+    243b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    243f:	3c 0a                	cmp    $0xa,%al
+    2441:	74 10                	je     2453 <gets+0x43>
+    2443:	3c 0d                	cmp    $0xd,%al
+    2445:	74 0c                	je     2453 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    2447:	89 df                	mov    %ebx,%edi
+    2449:	83 c3 01             	add    $0x1,%ebx
+    244c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    244f:	7c cf                	jl     2420 <gets+0x10>
+    2451:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    2453:	8b 45 08             	mov    0x8(%ebp),%eax
+    2456:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    245a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    245d:	5b                   	pop    %ebx
+    245e:	5e                   	pop    %esi
+    245f:	5f                   	pop    %edi
+    2460:	5d                   	pop    %ebp
+    2461:	c3                   	ret
+    2462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002470 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    2470:	55                   	push   %ebp
+    2471:	89 e5                	mov    %esp,%ebp
+    2473:	56                   	push   %esi
+    2474:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    2475:	83 ec 08             	sub    $0x8,%esp
+    2478:	6a 00                	push   $0x0
+    247a:	ff 75 08             	push   0x8(%ebp)
+    247d:	e8 f1 00 00 00       	call   2573 <open>
+  if(fd < 0)
+    2482:	83 c4 10             	add    $0x10,%esp
+    2485:	85 c0                	test   %eax,%eax
+    2487:	78 27                	js     24b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    2489:	83 ec 08             	sub    $0x8,%esp
+    248c:	ff 75 0c             	push   0xc(%ebp)
+    248f:	89 c3                	mov    %eax,%ebx
+    2491:	50                   	push   %eax
+    2492:	e8 f4 00 00 00       	call   258b <fstat>
+  close(fd);
+    2497:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    249a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    249c:	e8 ba 00 00 00       	call   255b <close>
+  return r;
+    24a1:	83 c4 10             	add    $0x10,%esp
+}
+    24a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24a7:	89 f0                	mov    %esi,%eax
+    24a9:	5b                   	pop    %ebx
+    24aa:	5e                   	pop    %esi
+    24ab:	5d                   	pop    %ebp
+    24ac:	c3                   	ret
+    24ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    24b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    24b5:	eb ed                	jmp    24a4 <stat+0x34>
+    24b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24be:	66 90                	xchg   %ax,%ax
+
+000024c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    24c0:	55                   	push   %ebp
+    24c1:	89 e5                	mov    %esp,%ebp
+    24c3:	53                   	push   %ebx
+    24c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    24c7:	0f be 02             	movsbl (%edx),%eax
+    24ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    24cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    24d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    24d5:	77 1e                	ja     24f5 <atoi+0x35>
+    24d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    24e0:	83 c2 01             	add    $0x1,%edx
+    24e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    24e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    24ea:	0f be 02             	movsbl (%edx),%eax
+    24ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    24f0:	80 fb 09             	cmp    $0x9,%bl
+    24f3:	76 eb                	jbe    24e0 <atoi+0x20>
+  return n;
+}
+    24f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    24f8:	89 c8                	mov    %ecx,%eax
+    24fa:	c9                   	leave
+    24fb:	c3                   	ret
+    24fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002500 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    2500:	55                   	push   %ebp
+    2501:	89 e5                	mov    %esp,%ebp
+    2503:	57                   	push   %edi
+    2504:	56                   	push   %esi
+    2505:	8b 45 10             	mov    0x10(%ebp),%eax
+    2508:	8b 55 08             	mov    0x8(%ebp),%edx
+    250b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    250e:	85 c0                	test   %eax,%eax
+    2510:	7e 13                	jle    2525 <memmove+0x25>
+    2512:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    2514:	89 d7                	mov    %edx,%edi
+    2516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    251d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    2520:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    2521:	39 f8                	cmp    %edi,%eax
+    2523:	75 fb                	jne    2520 <memmove+0x20>
+  return vdst;
+}
+    2525:	5e                   	pop    %esi
+    2526:	89 d0                	mov    %edx,%eax
+    2528:	5f                   	pop    %edi
+    2529:	5d                   	pop    %ebp
+    252a:	c3                   	ret
+
+0000252b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    252b:	b8 01 00 00 00       	mov    $0x1,%eax
+    2530:	cd 40                	int    $0x40
+    2532:	c3                   	ret
+
+00002533 <exit>:
+SYSCALL(exit)
+    2533:	b8 02 00 00 00       	mov    $0x2,%eax
+    2538:	cd 40                	int    $0x40
+    253a:	c3                   	ret
+
+0000253b <wait>:
+SYSCALL(wait)
+    253b:	b8 03 00 00 00       	mov    $0x3,%eax
+    2540:	cd 40                	int    $0x40
+    2542:	c3                   	ret
+
+00002543 <pipe>:
+SYSCALL(pipe)
+    2543:	b8 04 00 00 00       	mov    $0x4,%eax
+    2548:	cd 40                	int    $0x40
+    254a:	c3                   	ret
+
+0000254b <read>:
+SYSCALL(read)
+    254b:	b8 05 00 00 00       	mov    $0x5,%eax
+    2550:	cd 40                	int    $0x40
+    2552:	c3                   	ret
+
+00002553 <write>:
+SYSCALL(write)
+    2553:	b8 10 00 00 00       	mov    $0x10,%eax
+    2558:	cd 40                	int    $0x40
+    255a:	c3                   	ret
+
+0000255b <close>:
+SYSCALL(close)
+    255b:	b8 15 00 00 00       	mov    $0x15,%eax
+    2560:	cd 40                	int    $0x40
+    2562:	c3                   	ret
+
+00002563 <kill>:
+SYSCALL(kill)
+    2563:	b8 06 00 00 00       	mov    $0x6,%eax
+    2568:	cd 40                	int    $0x40
+    256a:	c3                   	ret
+
+0000256b <exec>:
+SYSCALL(exec)
+    256b:	b8 07 00 00 00       	mov    $0x7,%eax
+    2570:	cd 40                	int    $0x40
+    2572:	c3                   	ret
+
+00002573 <open>:
+SYSCALL(open)
+    2573:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2578:	cd 40                	int    $0x40
+    257a:	c3                   	ret
+
+0000257b <mknod>:
+SYSCALL(mknod)
+    257b:	b8 11 00 00 00       	mov    $0x11,%eax
+    2580:	cd 40                	int    $0x40
+    2582:	c3                   	ret
+
+00002583 <unlink>:
+SYSCALL(unlink)
+    2583:	b8 12 00 00 00       	mov    $0x12,%eax
+    2588:	cd 40                	int    $0x40
+    258a:	c3                   	ret
+
+0000258b <fstat>:
+SYSCALL(fstat)
+    258b:	b8 08 00 00 00       	mov    $0x8,%eax
+    2590:	cd 40                	int    $0x40
+    2592:	c3                   	ret
+
+00002593 <link>:
+SYSCALL(link)
+    2593:	b8 13 00 00 00       	mov    $0x13,%eax
+    2598:	cd 40                	int    $0x40
+    259a:	c3                   	ret
+
+0000259b <mkdir>:
+SYSCALL(mkdir)
+    259b:	b8 14 00 00 00       	mov    $0x14,%eax
+    25a0:	cd 40                	int    $0x40
+    25a2:	c3                   	ret
+
+000025a3 <chdir>:
+SYSCALL(chdir)
+    25a3:	b8 09 00 00 00       	mov    $0x9,%eax
+    25a8:	cd 40                	int    $0x40
+    25aa:	c3                   	ret
+
+000025ab <dup>:
+SYSCALL(dup)
+    25ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+    25b0:	cd 40                	int    $0x40
+    25b2:	c3                   	ret
+
+000025b3 <getpid>:
+SYSCALL(getpid)
+    25b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    25b8:	cd 40                	int    $0x40
+    25ba:	c3                   	ret
+
+000025bb <sbrk>:
+SYSCALL(sbrk)
+    25bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    25c0:	cd 40                	int    $0x40
+    25c2:	c3                   	ret
+
+000025c3 <sleep>:
+SYSCALL(sleep)
+    25c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    25c8:	cd 40                	int    $0x40
+    25ca:	c3                   	ret
+
+000025cb <uptime>:
+SYSCALL(uptime)
+    25cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    25d0:	cd 40                	int    $0x40
+    25d2:	c3                   	ret
+
+000025d3 <poll>:
+SYSCALL(poll)
+    25d3:	b8 16 00 00 00       	mov    $0x16,%eax
+    25d8:	cd 40                	int    $0x40
+    25da:	c3                   	ret
+
+000025db <fcntl>:
+SYSCALL(fcntl)
+    25db:	b8 17 00 00 00       	mov    $0x17,%eax
+    25e0:	cd 40                	int    $0x40
+    25e2:	c3                   	ret
+
+000025e3 <lseek>:
+SYSCALL(lseek)
+    25e3:	b8 18 00 00 00       	mov    $0x18,%eax
+    25e8:	cd 40                	int    $0x40
+    25ea:	c3                   	ret
+
+000025eb <pread>:
+SYSCALL(pread)
+    25eb:	b8 19 00 00 00       	mov    $0x19,%eax
+    25f0:	cd 40                	int    $0x40
+    25f2:	c3                   	ret
+
+000025f3 <pwrite>:
+SYSCALL(pwrite)
+    25f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    25f8:	cd 40                	int    $0x40
+    25fa:	c3                   	ret
+
+000025fb <readv>:
+SYSCALL(readv)
+    25fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2600:	cd 40                	int    $0x40
+    2602:	c3                   	ret
+
+00002603 <writev>:
+SYSCALL(writev)
+    2603:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2608:	cd 40                	int    $0x40
+    260a:	c3                   	ret
+
+0000260b <getdents>:
+SYSCALL(getdents)
+    260b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2610:	cd 40                	int    $0x40
+    2612:	c3                   	ret
+
+00002613 <splice>:
+SYSCALL(splice)
+    2613:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    2618:	cd 40                	int    $0x40
+    261a:	c3                   	ret
+
+0000261b <ioring_setup>:
+SYSCALL(ioring_setup)
+    261b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2620:	cd 40                	int    $0x40
+    2622:	c3                   	ret
+
+00002623 <ioring_enter>:
+SYSCALL(ioring_enter)
+    2623:	b8 20 00 00 00       	mov    $0x20,%eax
+    2628:	cd 40                	int    $0x40
+    262a:	c3                   	ret
+
+0000262b <batch>:
+SYSCALL(batch)
+    262b:	b8 21 00 00 00       	mov    $0x21,%eax
+    2630:	cd 40                	int    $0x40
+    2632:	c3                   	ret
+    2633:	66 90                	xchg   %ax,%ax
+    2635:	66 90                	xchg   %ax,%ax
+    2637:	66 90                	xchg   %ax,%ax
+    2639:	66 90                	xchg   %ax,%ax
+    263b:	66 90                	xchg   %ax,%ax
+    263d:	66 90                	xchg   %ax,%ax
+    263f:	90                   	nop
+
+00002640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    2640:	55                   	push   %ebp
+    2641:	89 e5                	mov    %esp,%ebp
+    2643:	57                   	push   %edi
+    2644:	56                   	push   %esi
+    2645:	53                   	push   %ebx
+    2646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    2648:	89 d1                	mov    %edx,%ecx
+{
+    264a:	83 ec 3c             	sub    $0x3c,%esp
+    264d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    2650:	85 d2                	test   %edx,%edx
+    2652:	0f 89 80 00 00 00    	jns    26d8 <printint+0x98>
+    2658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    265c:	74 7a                	je     26d8 <printint+0x98>
+    x = -xx;
+    265e:	f7 d9                	neg    %ecx
+    neg = 1;
+    2660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    2665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    2668:	31 f6                	xor    %esi,%esi
+    266a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    2670:	89 c8                	mov    %ecx,%eax
+    2672:	31 d2                	xor    %edx,%edx
+    2674:	89 f7                	mov    %esi,%edi
+    2676:	f7 f3                	div    %ebx
+    2678:	8d 76 01             	lea    0x1(%esi),%esi
+    267b:	0f b6 92 64 3b 00 00 	movzbl 0x3b64(%edx),%edx
+    2682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    2686:	89 ca                	mov    %ecx,%edx
+    2688:	89 c1                	mov    %eax,%ecx
+    268a:	39 da                	cmp    %ebx,%edx
+    268c:	73 e2                	jae    2670 <printint+0x30>
+  if(neg)
+    268e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    2691:	85 c0                	test   %eax,%eax
+    2693:	74 07                	je     269c <printint+0x5c>
+    buf[i++] = '-';
+    2695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    269a:	89 f7                	mov    %esi,%edi
+    269c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    269f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    26a2:	01 df                	add    %ebx,%edi
+    26a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    26a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    26ab:	83 ec 04             	sub    $0x4,%esp
+    26ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+    26b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    26b4:	6a 01                	push   $0x1
+    26b6:	50                   	push   %eax
+    26b7:	56                   	push   %esi
+    26b8:	e8 96 fe ff ff       	call   2553 <write>
+  while(--i >= 0)
+    26bd:	89 f8                	mov    %edi,%eax
+    26bf:	83 c4 10             	add    $0x10,%esp
+    26c2:	83 ef 01             	sub    $0x1,%edi
+    26c5:	39 d8                	cmp    %ebx,%eax
+    26c7:	75 df                	jne    26a8 <printint+0x68>
+}
+    26c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    26cc:	5b                   	pop    %ebx
+    26cd:	5e                   	pop    %esi
+    26ce:	5f                   	pop    %edi
+    26cf:	5d                   	pop    %ebp
+    26d0:	c3                   	ret
+    26d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    26d8:	31 c0                	xor    %eax,%eax
+    26da:	eb 89                	jmp    2665 <printint+0x25>
+    26dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000026e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    26e0:	55                   	push   %ebp
+    26e1:	89 e5                	mov    %esp,%ebp
+    26e3:	57                   	push   %edi
+    26e4:	56                   	push   %esi
+    26e5:	53                   	push   %ebx
+    26e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    26e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    26ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    26ef:	0f b6 1e             	movzbl (%esi),%ebx
+    26f2:	83 c6 01             	add    $0x1,%esi
+    26f5:	84 db                	test   %bl,%bl
+    26f7:	74 67                	je     2760 <printf+0x80>
+    26f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    26fc:	31 d2                	xor    %edx,%edx
+    26fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    2701:	eb 34                	jmp    2737 <printf+0x57>
+    2703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2707:	90                   	nop
+    2708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    270b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    2710:	83 f8 25             	cmp    $0x25,%eax
+    2713:	74 18                	je     272d <printf+0x4d>
+  write(fd, &c, 1);
+    2715:	83 ec 04             	sub    $0x4,%esp
+    2718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    271b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    271e:	6a 01                	push   $0x1
+    2720:	50                   	push   %eax
+    2721:	57                   	push   %edi
+    2722:	e8 2c fe ff ff       	call   2553 <write>
+    2727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    272a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    272d:	0f b6 1e             	movzbl (%esi),%ebx
+    2730:	83 c6 01             	add    $0x1,%esi
+    2733:	84 db                	test   %bl,%bl
+    2735:	74 29                	je     2760 <printf+0x80>
+    c = fmt[i] & 0xff;
+    2737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    273a:	85 d2                	test   %edx,%edx
+    273c:	74 ca                	je     2708 <printf+0x28>
+      }
+    } else if(state == '%'){
+    273e:	83 fa 25             	cmp    $0x25,%edx
+    2741:	75 ea                	jne    272d <printf+0x4d>
+      if(c == 'd'){
+    2743:	83 f8 25             	cmp    $0x25,%eax
+    2746:	0f 84 24 01 00 00    	je     2870 <printf+0x190>
+    274c:	83 e8 63             	sub    $0x63,%eax
+    274f:	83 f8 15             	cmp    $0x15,%eax
+    2752:	77 1c                	ja     2770 <printf+0x90>
+    2754:	ff 24 85 0c 3b 00 00 	jmp    *0x3b0c(,%eax,4)
+    275b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    275f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    2760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2763:	5b                   	pop    %ebx
+    2764:	5e                   	pop    %esi
+    2765:	5f                   	pop    %edi
+    2766:	5d                   	pop    %ebp
+    2767:	c3                   	ret
+    2768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    276f:	90                   	nop
+  write(fd, &c, 1);
+    2770:	83 ec 04             	sub    $0x4,%esp
+    2773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    277a:	6a 01                	push   $0x1
+    277c:	52                   	push   %edx
+    277d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    2780:	57                   	push   %edi
+    2781:	e8 cd fd ff ff       	call   2553 <write>
+    2786:	83 c4 0c             	add    $0xc,%esp
+    2789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    278c:	6a 01                	push   $0x1
+    278e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    2791:	52                   	push   %edx
+    2792:	57                   	push   %edi
+    2793:	e8 bb fd ff ff       	call   2553 <write>
+        putc(fd, c);
+    2798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    279b:	31 d2                	xor    %edx,%edx
+    279d:	eb 8e                	jmp    272d <printf+0x4d>
+    279f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    27a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    27a3:	83 ec 0c             	sub    $0xc,%esp
+    27a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    27ab:	8b 13                	mov    (%ebx),%edx
+    27ad:	6a 00                	push   $0x0
+    27af:	89 f8                	mov    %edi,%eax
+        ap++;
+    27b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    27b4:	e8 87 fe ff ff       	call   2640 <printint>
+        ap++;
+    27b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    27bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    27bf:	31 d2                	xor    %edx,%edx
+    27c1:	e9 67 ff ff ff       	jmp    272d <printf+0x4d>
+    27c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    27d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    27d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    27d5:	83 c0 04             	add    $0x4,%eax
+    27d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    27db:	85 db                	test   %ebx,%ebx
+    27dd:	0f 84 9d 00 00 00    	je     2880 <printf+0x1a0>
+        while(*s != 0){
+    27e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    27e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    27e8:	84 c0                	test   %al,%al
+    27ea:	0f 84 3d ff ff ff    	je     272d <printf+0x4d>
+    27f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    27f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    27f6:	89 de                	mov    %ebx,%esi
+    27f8:	89 d3                	mov    %edx,%ebx
+    27fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    2800:	83 ec 04             	sub    $0x4,%esp
+    2803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    2806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    2809:	6a 01                	push   $0x1
+    280b:	53                   	push   %ebx
+    280c:	57                   	push   %edi
+    280d:	e8 41 fd ff ff       	call   2553 <write>
+        while(*s != 0){
+    2812:	0f b6 06             	movzbl (%esi),%eax
+    2815:	83 c4 10             	add    $0x10,%esp
+    2818:	84 c0                	test   %al,%al
+    281a:	75 e4                	jne    2800 <printf+0x120>
+      state = 0;
+    281c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    281f:	31 d2                	xor    %edx,%edx
+    2821:	e9 07 ff ff ff       	jmp    272d <printf+0x4d>
+    2826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    282d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    2830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2833:	83 ec 0c             	sub    $0xc,%esp
+    2836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    283b:	8b 13                	mov    (%ebx),%edx
+    283d:	6a 01                	push   $0x1
+    283f:	e9 6b ff ff ff       	jmp    27af <printf+0xcf>
+    2844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    2848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    284b:	83 ec 04             	sub    $0x4,%esp
+    284e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    2851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    2853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    2856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    2859:	6a 01                	push   $0x1
+    285b:	52                   	push   %edx
+    285c:	57                   	push   %edi
+    285d:	e8 f1 fc ff ff       	call   2553 <write>
+        ap++;
+    2862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    2865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    2868:	31 d2                	xor    %edx,%edx
+    286a:	e9 be fe ff ff       	jmp    272d <printf+0x4d>
+    286f:	90                   	nop
+  write(fd, &c, 1);
+    2870:	83 ec 04             	sub    $0x4,%esp
+    2873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    2876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2879:	6a 01                	push   $0x1
+    287b:	e9 11 ff ff ff       	jmp    2791 <printf+0xb1>
+    2880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    2885:	bb 03 3b 00 00       	mov    $0x3b03,%ebx
+    288a:	e9 61 ff ff ff       	jmp    27f0 <printf+0x110>
+    288f:	90                   	nop
+
+00002890 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2891:	a1 94 6c 00 00       	mov    0x6c94,%eax
+{
+    2896:	89 e5                	mov    %esp,%ebp
+    2898:	57                   	push   %edi
+    2899:	56                   	push   %esi
+    289a:	53                   	push   %ebx
+    289b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    289e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    28aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28ac:	39 ca                	cmp    %ecx,%edx
+    28ae:	73 30                	jae    28e0 <free+0x50>
+    28b0:	39 c1                	cmp    %eax,%ecx
+    28b2:	72 04                	jb     28b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    28b4:	39 c2                	cmp    %eax,%edx
+    28b6:	72 f0                	jb     28a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    28b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    28bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    28be:	39 f8                	cmp    %edi,%eax
+    28c0:	74 2e                	je     28f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    28c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    28c5:	8b 42 04             	mov    0x4(%edx),%eax
+    28c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    28cb:	39 f1                	cmp    %esi,%ecx
+    28cd:	74 38                	je     2907 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    28cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    28d1:	5b                   	pop    %ebx
+  freep = p;
+    28d2:	89 15 94 6c 00 00    	mov    %edx,0x6c94
+}
+    28d8:	5e                   	pop    %esi
+    28d9:	5f                   	pop    %edi
+    28da:	5d                   	pop    %ebp
+    28db:	c3                   	ret
+    28dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    28e0:	39 c1                	cmp    %eax,%ecx
+    28e2:	72 d0                	jb     28b4 <free+0x24>
+    28e4:	eb c2                	jmp    28a8 <free+0x18>
+    28e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    28f0:	03 70 04             	add    0x4(%eax),%esi
+    28f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    28f6:	8b 02                	mov    (%edx),%eax
+    28f8:	8b 00                	mov    (%eax),%eax
+    28fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    28fd:	8b 42 04             	mov    0x4(%edx),%eax
+    2900:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2903:	39 f1                	cmp    %esi,%ecx
+    2905:	75 c8                	jne    28cf <free+0x3f>
+    p->s.size += bp->s.size;
+    2907:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    290a:	89 15 94 6c 00 00    	mov    %edx,0x6c94
+    p->s.size += bp->s.size;
+    2910:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2913:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2916:	89 0a                	mov    %ecx,(%edx)
+}
+    2918:	5b                   	pop    %ebx
+    2919:	5e                   	pop    %esi
+    291a:	5f                   	pop    %edi
+    291b:	5d                   	pop    %ebp
+    291c:	c3                   	ret
+    291d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002920 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2920:	55                   	push   %ebp
+    2921:	89 e5                	mov    %esp,%ebp
+    2923:	57                   	push   %edi
+    2924:	56                   	push   %esi
+    2925:	53                   	push   %ebx
+    2926:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2929:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    292c:	8b 15 94 6c 00 00    	mov    0x6c94,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2932:	8d 78 07             	lea    0x7(%eax),%edi
+    2935:	c1 ef 03             	shr    $0x3,%edi
+    2938:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    293b:	85 d2                	test   %edx,%edx
+    293d:	0f 84 8d 00 00 00    	je     29d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2943:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2945:	8b 48 04             	mov    0x4(%eax),%ecx
+    2948:	39 f9                	cmp    %edi,%ecx
+    294a:	73 64                	jae    29b0 <malloc+0x90>
+  if(nu < 4096)
+    294c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2951:	39 df                	cmp    %ebx,%edi
+    2953:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2956:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    295d:	eb 0a                	jmp    2969 <malloc+0x49>
+    295f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2960:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2962:	8b 48 04             	mov    0x4(%eax),%ecx
+    2965:	39 f9                	cmp    %edi,%ecx
+    2967:	73 47                	jae    29b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2969:	89 c2                	mov    %eax,%edx
+    296b:	39 05 94 6c 00 00    	cmp    %eax,0x6c94
+    2971:	75 ed                	jne    2960 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2973:	83 ec 0c             	sub    $0xc,%esp
+    2976:	56                   	push   %esi
+    2977:	e8 3f fc ff ff       	call   25bb <sbrk>
+  if(p == (char*)-1)
+    297c:	83 c4 10             	add    $0x10,%esp
+    297f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2982:	74 1c                	je     29a0 <malloc+0x80>
+  hp->s.size = nu;
+    2984:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2987:	83 ec 0c             	sub    $0xc,%esp
+    298a:	83 c0 08             	add    $0x8,%eax
+    298d:	50                   	push   %eax
+    298e:	e8 fd fe ff ff       	call   2890 <free>
+  return freep;
+    2993:	8b 15 94 6c 00 00    	mov    0x6c94,%edx
+      if((p = morecore(nunits)) == 0)
+    2999:	83 c4 10             	add    $0x10,%esp
+    299c:	85 d2                	test   %edx,%edx
+    299e:	75 c0                	jne    2960 <malloc+0x40>
+        return 0;
+  }
+}
+    29a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    29a3:	31 c0                	xor    %eax,%eax
+}
+    29a5:	5b                   	pop    %ebx
+    29a6:	5e                   	pop    %esi
+    29a7:	5f                   	pop    %edi
+    29a8:	5d                   	pop    %ebp
+    29a9:	c3                   	ret
+    29aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    29b0:	39 cf                	cmp    %ecx,%edi
+    29b2:	74 4c                	je     2a00 <malloc+0xe0>
+        p->s.size -= nunits;
+    29b4:	29 f9                	sub    %edi,%ecx
+    29b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    29b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    29bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    29bf:	89 15 94 6c 00 00    	mov    %edx,0x6c94
+}
+    29c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    29c8:	83 c0 08             	add    $0x8,%eax
+}
+    29cb:	5b                   	pop    %ebx
+    29cc:	5e                   	pop    %esi
+    29cd:	5f                   	pop    %edi
+    29ce:	5d                   	pop    %ebp
+    29cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    29d0:	c7 05 94 6c 00 00 98 	movl   $0x6c98,0x6c94
+    29d7:	6c 00 00 
+    base.s.size = 0;
+    29da:	b8 98 6c 00 00       	mov    $0x6c98,%eax
+    base.s.ptr = freep = prevp = &base;
+    29df:	c7 05 98 6c 00 00 98 	movl   $0x6c98,0x6c98
+    29e6:	6c 00 00 
+    base.s.size = 0;
+    29e9:	c7 05 9c 6c 00 00 00 	movl   $0x0,0x6c9c
+    29f0:	00 00 00 
+    if(p->s.size >= nunits){
+    29f3:	e9 54 ff ff ff       	jmp    294c <malloc+0x2c>
+    29f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2a00:	8b 08                	mov    (%eax),%ecx
+    2a02:	89 0a                	mov    %ecx,(%edx)
+    2a04:	eb b9                	jmp    29bf <malloc+0x9f>
+    2a06:	66 90                	xchg   %ax,%ax
+    2a08:	66 90                	xchg   %ax,%ax
+    2a0a:	66 90                	xchg   %ax,%ax
+    2a0c:	66 90                	xchg   %ax,%ax
+    2a0e:	66 90                	xchg   %ax,%ax
+
+00002a10 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+    2a10:	55                   	push   %ebp
+    2a11:	89 e5                	mov    %esp,%ebp
+    2a13:	57                   	push   %edi
+    2a14:	56                   	push   %esi
+    2a15:	53                   	push   %ebx
+    2a16:	83 ec 1c             	sub    $0x1c,%esp
+    2a19:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+    2a1c:	85 c9                	test   %ecx,%ecx
+    2a1e:	7e 51                	jle    2a71 <put+0x61>
+    2a20:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+    2a22:	8b 40 08             	mov    0x8(%eax),%eax
+    2a25:	89 ce                	mov    %ecx,%esi
+    2a27:	85 c0                	test   %eax,%eax
+    2a29:	7e 55                	jle    2a80 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+    2a2b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+    2a2e:	8b 51 0c             	mov    0xc(%ecx),%edx
+    2a31:	8b 79 08             	mov    0x8(%ecx),%edi
+    2a34:	01 d7                	add    %edx,%edi
+    2a36:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    2a39:	74 65                	je     2aa0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+    2a3b:	83 f8 20             	cmp    $0x20,%eax
+    2a3e:	75 40                	jne    2a80 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+    2a40:	83 ec 04             	sub    $0x4,%esp
+    2a43:	8d 43 10             	lea    0x10(%ebx),%eax
+    2a46:	6a 20                	push   $0x20
+    2a48:	50                   	push   %eax
+    2a49:	ff 33                	push   (%ebx)
+    2a4b:	e8 b3 fb ff ff       	call   2603 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+    2a50:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+    2a53:	31 c0                	xor    %eax,%eax
+    2a55:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    2a5a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+    2a5d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    2a64:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    2a67:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    2a6a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+    2a6e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    2a71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a74:	5b                   	pop    %ebx
+    2a75:	5e                   	pop    %esi
+    2a76:	5f                   	pop    %edi
+    2a77:	5d                   	pop    %ebp
+    2a78:	c3                   	ret
+    2a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+    2a80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+    2a83:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    2a86:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+    2a89:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+    2a8d:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+    2a90:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    2a93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2a96:	5b                   	pop    %ebx
+    2a97:	5e                   	pop    %esi
+    2a98:	5f                   	pop    %edi
+    2a99:	5d                   	pop    %ebp
+    2a9a:	c3                   	ret
+    2a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2a9f:	90                   	nop
+      last->iov_len += n;
+    2aa0:	01 f2                	add    %esi,%edx
+    2aa2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+    2aa5:	eb ca                	jmp    2a71 <put+0x61>
+    2aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2aae:	66 90                	xchg   %ax,%ax
+
+00002ab0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+    2ab0:	55                   	push   %ebp
+    2ab1:	89 e5                	mov    %esp,%ebp
+    2ab3:	57                   	push   %edi
+    2ab4:	89 d7                	mov    %edx,%edi
+    2ab6:	56                   	push   %esi
+    2ab7:	89 ce                	mov    %ecx,%esi
+    2ab9:	53                   	push   %ebx
+    2aba:	89 c3                	mov    %eax,%ebx
+    2abc:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+    2abf:	8b 40 0c             	mov    0xc(%eax),%eax
+    2ac2:	8b 53 08             	mov    0x8(%ebx),%edx
+    2ac5:	01 c1                	add    %eax,%ecx
+    2ac7:	83 f9 40             	cmp    $0x40,%ecx
+    2aca:	7f 3c                	jg     2b08 <putcopy+0x58>
+    2acc:	83 fa 20             	cmp    $0x20,%edx
+    2acf:	74 3f                	je     2b10 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+    2ad1:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+    2ad7:	83 ec 04             	sub    $0x4,%esp
+    2ada:	01 d0                	add    %edx,%eax
+    2adc:	56                   	push   %esi
+    2add:	57                   	push   %edi
+    2ade:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    2ae1:	50                   	push   %eax
+    2ae2:	e8 19 fa ff ff       	call   2500 <memmove>
+  put(w, w->buf + w->nbuf, n);
+    2ae7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    2aea:	89 f1                	mov    %esi,%ecx
+    2aec:	03 53 0c             	add    0xc(%ebx),%edx
+    2aef:	89 d8                	mov    %ebx,%eax
+    2af1:	e8 1a ff ff ff       	call   2a10 <put>
+  w->nbuf += n;
+    2af6:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+    2af9:	83 c4 10             	add    $0x10,%esp
+    2afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2aff:	5b                   	pop    %ebx
+    2b00:	5e                   	pop    %esi
+    2b01:	5f                   	pop    %edi
+    2b02:	5d                   	pop    %ebp
+    2b03:	c3                   	ret
+    2b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+    2b08:	85 d2                	test   %edx,%edx
+    2b0a:	7e 16                	jle    2b22 <putcopy+0x72>
+    2b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+    2b10:	83 ec 04             	sub    $0x4,%esp
+    2b13:	8d 43 10             	lea    0x10(%ebx),%eax
+    2b16:	52                   	push   %edx
+    2b17:	50                   	push   %eax
+    2b18:	ff 33                	push   (%ebx)
+    2b1a:	e8 e4 fa ff ff       	call   2603 <writev>
+    2b1f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+    2b22:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    2b29:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+    2b2b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    2b32:	eb 9d                	jmp    2ad1 <putcopy+0x21>
+    2b34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2b3f:	90                   	nop
+
+00002b40 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+    2b40:	55                   	push   %ebp
+    2b41:	89 e5                	mov    %esp,%ebp
+    2b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+    2b46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+    2b49:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+    2b50:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+    2b52:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+    2b59:	c7 40 10 75 3b 00 00 	movl   $0x3b75,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+    2b60:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+    2b67:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+    2b6e:	5d                   	pop    %ebp
+    2b6f:	c3                   	ret
+
+00002b70 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+    2b70:	55                   	push   %ebp
+    2b71:	89 e5                	mov    %esp,%ebp
+    2b73:	57                   	push   %edi
+    2b74:	56                   	push   %esi
+    2b75:	53                   	push   %ebx
+    2b76:	83 ec 1c             	sub    $0x1c,%esp
+    2b79:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2b7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    2b7f:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+    2b82:	8b 47 04             	mov    0x4(%edi),%eax
+    2b85:	85 c0                	test   %eax,%eax
+    2b87:	0f 85 7b 01 00 00    	jne    2d08 <struct_field_str+0x198>
+    w->need_comma = 1;
+    2b8d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    2b94:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2b99:	ba 8a 3b 00 00       	mov    $0x3b8a,%edx
+    2b9e:	89 f8                	mov    %edi,%eax
+    2ba0:	e8 6b fe ff ff       	call   2a10 <put>
+  put_str(w, key ? key : "");
+    2ba5:	85 db                	test   %ebx,%ebx
+    2ba7:	b8 c9 31 00 00       	mov    $0x31c9,%eax
+    2bac:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    2baf:	83 ec 0c             	sub    $0xc,%esp
+    2bb2:	53                   	push   %ebx
+    2bb3:	e8 c8 f7 ff ff       	call   2380 <strlen>
+    2bb8:	89 da                	mov    %ebx,%edx
+    2bba:	89 c1                	mov    %eax,%ecx
+    2bbc:	89 f8                	mov    %edi,%eax
+    2bbe:	e8 4d fe ff ff       	call   2a10 <put>
+  put(w, "\":\"", 3);
+    2bc3:	b9 03 00 00 00       	mov    $0x3,%ecx
+    2bc8:	ba 88 3b 00 00       	mov    $0x3b88,%edx
+    2bcd:	89 f8                	mov    %edi,%eax
+    2bcf:	e8 3c fe ff ff       	call   2a10 <put>
+  put_escaped(w, value ? value : "");
+    2bd4:	83 c4 10             	add    $0x10,%esp
+    2bd7:	85 f6                	test   %esi,%esi
+    2bd9:	0f 84 41 01 00 00    	je     2d20 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+    2bdf:	0f b6 1e             	movzbl (%esi),%ebx
+    2be2:	89 f2                	mov    %esi,%edx
+    2be4:	84 db                	test   %bl,%bl
+    2be6:	0f 84 40 01 00 00    	je     2d2c <struct_field_str+0x1bc>
+    2bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    2bf0:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+    2bf2:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+    2bf5:	80 fb 0d             	cmp    $0xd,%bl
+    2bf8:	74 7e                	je     2c78 <struct_field_str+0x108>
+    2bfa:	7f 5c                	jg     2c58 <struct_field_str+0xe8>
+    2bfc:	80 fb 09             	cmp    $0x9,%bl
+    2bff:	0f 84 eb 00 00 00    	je     2cf0 <struct_field_str+0x180>
+    2c05:	80 fb 0a             	cmp    $0xa,%bl
+    2c08:	0f 85 95 00 00 00    	jne    2ca3 <struct_field_str+0x133>
+    put(w, run, s - run);
+    2c0e:	29 d1                	sub    %edx,%ecx
+    2c10:	89 f8                	mov    %edi,%eax
+    2c12:	e8 f9 fd ff ff       	call   2a10 <put>
+      esc = "\\n";
+    2c17:	ba 83 3b 00 00       	mov    $0x3b83,%edx
+      put(w, esc, 2);
+    2c1c:	b9 02 00 00 00       	mov    $0x2,%ecx
+    2c21:	89 f8                	mov    %edi,%eax
+    2c23:	e8 e8 fd ff ff       	call   2a10 <put>
+    run = s + 1;
+    2c28:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+    2c2a:	0f b6 1e             	movzbl (%esi),%ebx
+    2c2d:	84 db                	test   %bl,%bl
+    2c2f:	75 bf                	jne    2bf0 <struct_field_str+0x80>
+  put(w, run, s - run);
+    2c31:	29 d6                	sub    %edx,%esi
+    2c33:	89 f1                	mov    %esi,%ecx
+    2c35:	89 f8                	mov    %edi,%eax
+    2c37:	e8 d4 fd ff ff       	call   2a10 <put>
+  put(w, "\"", 1);
+}
+    2c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+    2c3f:	89 f8                	mov    %edi,%eax
+    2c41:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+    2c46:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+    2c47:	ba 8a 3b 00 00       	mov    $0x3b8a,%edx
+}
+    2c4c:	5e                   	pop    %esi
+    2c4d:	5f                   	pop    %edi
+    2c4e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+    2c4f:	e9 bc fd ff ff       	jmp    2a10 <put>
+    2c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    2c58:	80 fb 22             	cmp    $0x22,%bl
+    2c5b:	74 33                	je     2c90 <struct_field_str+0x120>
+    2c5d:	80 fb 5c             	cmp    $0x5c,%bl
+    2c60:	75 41                	jne    2ca3 <struct_field_str+0x133>
+    put(w, run, s - run);
+    2c62:	29 d1                	sub    %edx,%ecx
+    2c64:	89 f8                	mov    %edi,%eax
+    2c66:	e8 a5 fd ff ff       	call   2a10 <put>
+      esc = "\\\\";
+    2c6b:	ba 77 3b 00 00       	mov    $0x3b77,%edx
+    2c70:	eb aa                	jmp    2c1c <struct_field_str+0xac>
+    2c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+    2c78:	29 d1                	sub    %edx,%ecx
+    2c7a:	89 f8                	mov    %edi,%eax
+    2c7c:	e8 8f fd ff ff       	call   2a10 <put>
+      esc = "\\r";
+    2c81:	ba 80 3b 00 00       	mov    $0x3b80,%edx
+    2c86:	eb 94                	jmp    2c1c <struct_field_str+0xac>
+    2c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c8f:	90                   	nop
+    put(w, run, s - run);
+    2c90:	29 d1                	sub    %edx,%ecx
+    2c92:	89 f8                	mov    %edi,%eax
+    2c94:	e8 77 fd ff ff       	call   2a10 <put>
+      esc = "\\\"";
+    2c99:	ba 7a 3b 00 00       	mov    $0x3b7a,%edx
+    2c9e:	e9 79 ff ff ff       	jmp    2c1c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+    2ca3:	80 fb 1f             	cmp    $0x1f,%bl
+    2ca6:	77 82                	ja     2c2a <struct_field_str+0xba>
+    put(w, run, s - run);
+    2ca8:	29 d1                	sub    %edx,%ecx
+    2caa:	89 f8                	mov    %edi,%eax
+    2cac:	e8 5f fd ff ff       	call   2a10 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+    2cb1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+    2cb3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+    2cb6:	0f b7 05 a4 3b 00 00 	movzwl 0x3ba4,%eax
+    2cbd:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+    2cc0:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+    2cc5:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+    2ccc:	0f b6 d2             	movzbl %dl,%edx
+    2ccf:	8a 82 8c 3b 00 00    	mov    0x3b8c(%edx),%al
+    2cd5:	8a a3 8c 3b 00 00    	mov    0x3b8c(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+    2cdb:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+    2cde:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+    2ce2:	89 f8                	mov    %edi,%eax
+    2ce4:	e8 c7 fd ff ff       	call   2ab0 <putcopy>
+    2ce9:	e9 3a ff ff ff       	jmp    2c28 <struct_field_str+0xb8>
+    2cee:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+    2cf0:	29 d1                	sub    %edx,%ecx
+    2cf2:	89 f8                	mov    %edi,%eax
+    2cf4:	e8 17 fd ff ff       	call   2a10 <put>
+      esc = "\\t";
+    2cf9:	ba 7d 3b 00 00       	mov    $0x3b7d,%edx
+    2cfe:	e9 19 ff ff ff       	jmp    2c1c <struct_field_str+0xac>
+    2d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d07:	90                   	nop
+    put(w, ",", 1);
+    2d08:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2d0d:	ba 86 3b 00 00       	mov    $0x3b86,%edx
+    2d12:	89 f8                	mov    %edi,%eax
+    2d14:	e8 f7 fc ff ff       	call   2a10 <put>
+}
+    2d19:	e9 76 fe ff ff       	jmp    2b94 <struct_field_str+0x24>
+    2d1e:	66 90                	xchg   %ax,%ax
+    2d20:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+    2d22:	ba c9 31 00 00       	mov    $0x31c9,%edx
+    2d27:	e9 09 ff ff ff       	jmp    2c35 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+    2d2c:	31 c9                	xor    %ecx,%ecx
+    2d2e:	e9 02 ff ff ff       	jmp    2c35 <struct_field_str+0xc5>
+    2d33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002d40 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+    2d40:	55                   	push   %ebp
+    2d41:	89 e5                	mov    %esp,%ebp
+    2d43:	57                   	push   %edi
+    2d44:	56                   	push   %esi
+    2d45:	53                   	push   %ebx
+    2d46:	83 ec 1c             	sub    $0x1c,%esp
+    2d49:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2d4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+    2d4f:	8b 57 04             	mov    0x4(%edi),%edx
+    2d52:	85 d2                	test   %edx,%edx
+    2d54:	0f 85 b6 00 00 00    	jne    2e10 <struct_field_int+0xd0>
+    w->need_comma = 1;
+    2d5a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    2d61:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2d66:	ba 8a 3b 00 00       	mov    $0x3b8a,%edx
+    2d6b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+    2d6d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+    2d72:	e8 99 fc ff ff       	call   2a10 <put>
+  put_str(w, key ? key : "");
+    2d77:	85 db                	test   %ebx,%ebx
+    2d79:	b8 c9 31 00 00       	mov    $0x31c9,%eax
+    2d7e:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    2d81:	83 ec 0c             	sub    $0xc,%esp
+    2d84:	53                   	push   %ebx
+    2d85:	e8 f6 f5 ff ff       	call   2380 <strlen>
+    2d8a:	89 da                	mov    %ebx,%edx
+    2d8c:	89 c1                	mov    %eax,%ecx
+    2d8e:	89 f8                	mov    %edi,%eax
+    2d90:	e8 7b fc ff ff       	call   2a10 <put>
+  put(w, "\":", 2);
+    2d95:	b9 02 00 00 00       	mov    $0x2,%ecx
+    2d9a:	ba 9d 3b 00 00       	mov    $0x3b9d,%edx
+    2d9f:	89 f8                	mov    %edi,%eax
+    2da1:	e8 6a fc ff ff       	call   2a10 <put>
+  x = value < 0 ? -(uint)value : value;
+    2da6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+    2da9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+    2dac:	83 c4 10             	add    $0x10,%esp
+    2daf:	f7 d9                	neg    %ecx
+    2db1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+    2db5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+    2db8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    2dbd:	89 f3                	mov    %esi,%ebx
+    2dbf:	83 ee 01             	sub    $0x1,%esi
+    2dc2:	f7 e1                	mul    %ecx
+    2dc4:	89 c8                	mov    %ecx,%eax
+    2dc6:	c1 ea 03             	shr    $0x3,%edx
+    2dc9:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+    2dcc:	01 ff                	add    %edi,%edi
+    2dce:	29 f8                	sub    %edi,%eax
+    2dd0:	83 c0 30             	add    $0x30,%eax
+    2dd3:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+    2dd7:	89 c8                	mov    %ecx,%eax
+    2dd9:	89 d1                	mov    %edx,%ecx
+    2ddb:	83 f8 09             	cmp    $0x9,%eax
+    2dde:	77 d8                	ja     2db8 <struct_field_int+0x78>
+  if(value < 0)
+    2de0:	8b 45 10             	mov    0x10(%ebp),%eax
+    2de3:	8b 7d 08             	mov    0x8(%ebp),%edi
+    2de6:	85 c0                	test   %eax,%eax
+    2de8:	79 08                	jns    2df2 <struct_field_int+0xb2>
+    buf[--i] = '-';
+    2dea:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+    2def:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+    2df2:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    2df5:	b9 0c 00 00 00       	mov    $0xc,%ecx
+    2dfa:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    2dfd:	29 f1                	sub    %esi,%ecx
+    2dff:	89 f8                	mov    %edi,%eax
+    2e01:	e8 aa fc ff ff       	call   2ab0 <putcopy>
+  put_int(w, value);
+}
+    2e06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2e09:	5b                   	pop    %ebx
+    2e0a:	5e                   	pop    %esi
+    2e0b:	5f                   	pop    %edi
+    2e0c:	5d                   	pop    %ebp
+    2e0d:	c3                   	ret
+    2e0e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+    2e10:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2e15:	ba 86 3b 00 00       	mov    $0x3b86,%edx
+    2e1a:	89 f8                	mov    %edi,%eax
+    2e1c:	e8 ef fb ff ff       	call   2a10 <put>
+}
+    2e21:	e9 3b ff ff ff       	jmp    2d61 <struct_field_int+0x21>
+    2e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002e30 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+    2e30:	55                   	push   %ebp
+    2e31:	89 e5                	mov    %esp,%ebp
+    2e33:	56                   	push   %esi
+    2e34:	53                   	push   %ebx
+    2e35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+    2e38:	8b 43 08             	mov    0x8(%ebx),%eax
+    2e3b:	85 c0                	test   %eax,%eax
+    2e3d:	7e 59                	jle    2e98 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+    2e3f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+    2e42:	8b 4a 0c             	mov    0xc(%edx),%ecx
+    2e45:	8b 72 08             	mov    0x8(%edx),%esi
+    2e48:	01 ce                	add    %ecx,%esi
+    2e4a:	81 fe a0 3b 00 00    	cmp    $0x3ba0,%esi
+    2e50:	0f 84 aa 00 00 00    	je     2f00 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+    2e56:	83 f8 20             	cmp    $0x20,%eax
+    2e59:	75 75                	jne    2ed0 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+    2e5b:	83 ec 04             	sub    $0x4,%esp
+    2e5e:	8d 73 10             	lea    0x10(%ebx),%esi
+    2e61:	6a 20                	push   $0x20
+    2e63:	56                   	push   %esi
+    2e64:	ff 33                	push   (%ebx)
+    2e66:	e8 98 f7 ff ff       	call   2603 <writev>
+  w->nbuf = 0;
+    2e6b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+    2e72:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    2e75:	c7 43 10 a0 3b 00 00 	movl   $0x3ba0,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+    2e7c:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+    2e83:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+    2e8a:	ba 01 00 00 00       	mov    $0x1,%edx
+    2e8f:	eb 5a                	jmp    2eeb <struct_end+0xbb>
+    2e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+    2e98:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    2e9b:	83 c0 02             	add    $0x2,%eax
+    2e9e:	c7 04 c3 a0 3b 00 00 	movl   $0x3ba0,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    2ea5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    2eac:	00 
+  w->niov++;
+    2ead:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+    2eb0:	83 fa 01             	cmp    $0x1,%edx
+    2eb3:	74 58                	je     2f0d <struct_end+0xdd>
+  w->niov = 0;
+    2eb5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+    2ebc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+    2ec3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2ec6:	5b                   	pop    %ebx
+    2ec7:	5e                   	pop    %esi
+    2ec8:	5d                   	pop    %ebp
+    2ec9:	c3                   	ret
+    2eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+    2ed0:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    2ed3:	83 c0 02             	add    $0x2,%eax
+    2ed6:	8d 73 10             	lea    0x10(%ebx),%esi
+    2ed9:	c7 04 c3 a0 3b 00 00 	movl   $0x3ba0,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    2ee0:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    2ee7:	00 
+  w->niov++;
+    2ee8:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+    2eeb:	83 ec 04             	sub    $0x4,%esp
+    2eee:	52                   	push   %edx
+    2eef:	56                   	push   %esi
+    2ef0:	ff 33                	push   (%ebx)
+    2ef2:	e8 0c f7 ff ff       	call   2603 <writev>
+    2ef7:	83 c4 10             	add    $0x10,%esp
+    2efa:	eb b9                	jmp    2eb5 <struct_end+0x85>
+    2efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+    2f00:	83 c1 02             	add    $0x2,%ecx
+    2f03:	8d 73 10             	lea    0x10(%ebx),%esi
+    2f06:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+    2f09:	89 c2                	mov    %eax,%edx
+    2f0b:	eb de                	jmp    2eeb <struct_end+0xbb>
+    2f0d:	8d 73 10             	lea    0x10(%ebx),%esi
+    2f10:	e9 75 ff ff ff       	jmp    2e8a <struct_end+0x5a>
+    2f15:	66 90                	xchg   %ax,%ax
+    2f17:	66 90                	xchg   %ax,%ax
+    2f19:	66 90                	xchg   %ax,%ax
+    2f1b:	66 90                	xchg   %ax,%ax
+    2f1d:	66 90                	xchg   %ax,%ax
+    2f1f:	90                   	nop
+
+00002f20 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+    2f20:	55                   	push   %ebp
+    2f21:	89 e5                	mov    %esp,%ebp
+    2f23:	56                   	push   %esi
+    2f24:	89 c6                	mov    %eax,%esi
+    2f26:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+    2f27:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+    2f2d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+    2f33:	6a 01                	push   $0x1
+    2f35:	53                   	push   %ebx
+    2f36:	e8 05 fc ff ff       	call   2b40 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    2f3b:	83 c4 0c             	add    $0xc,%esp
+    2f3e:	56                   	push   %esi
+    2f3f:	68 a6 3b 00 00       	push   $0x3ba6
+    2f44:	53                   	push   %ebx
+    2f45:	e8 26 fc ff ff       	call   2b70 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+    2f4a:	83 c4 0c             	add    $0xc,%esp
+    2f4d:	68 ae 3b 00 00       	push   $0x3bae
+    2f52:	68 bf 3b 00 00       	push   $0x3bbf
+    2f57:	53                   	push   %ebx
+    2f58:	e8 13 fc ff ff       	call   2b70 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+    2f5d:	83 c4 0c             	add    $0xc,%esp
+    2f60:	68 ea 07 00 00       	push   $0x7ea
+    2f65:	68 c6 3b 00 00       	push   $0x3bc6
+    2f6a:	53                   	push   %ebx
+    2f6b:	e8 d0 fd ff ff       	call   2d40 <struct_field_int>
+  struct_end(&w);
+    2f70:	89 1c 24             	mov    %ebx,(%esp)
+    2f73:	e8 b8 fe ff ff       	call   2e30 <struct_end>
+    2f78:	83 c4 10             	add    $0x10,%esp
+}
+    2f7b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2f7e:	5b                   	pop    %ebx
+    2f7f:	5e                   	pop    %esi
+    2f80:	5d                   	pop    %ebp
+    2f81:	c3                   	ret
+    2f82:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2f89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002f90 <modern_consume_flags>:
+{
+    2f90:	55                   	push   %ebp
+    2f91:	89 e5                	mov    %esp,%ebp
+    2f93:	57                   	push   %edi
+    2f94:	56                   	push   %esi
+    2f95:	53                   	push   %ebx
+    2f96:	83 ec 0c             	sub    $0xc,%esp
+    2f99:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+    2f9c:	85 f6                	test   %esi,%esi
+    2f9e:	74 06                	je     2fa6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+    2fa0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+    2fa6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+    2faa:	bf 01 00 00 00       	mov    $0x1,%edi
+    2faf:	7e 4c                	jle    2ffd <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+    2fb1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+    2fb4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+    2fb7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+    2fba:	68 cb 3b 00 00       	push   $0x3bcb
+    2fbf:	53                   	push   %ebx
+    2fc0:	e8 5b f3 ff ff       	call   2320 <strcmp>
+    2fc5:	83 c4 10             	add    $0x10,%esp
+    2fc8:	85 c0                	test   %eax,%eax
+    2fca:	74 58                	je     3024 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+    2fcc:	8b 45 14             	mov    0x14(%ebp),%eax
+    2fcf:	85 c0                	test   %eax,%eax
+    2fd1:	74 2a                	je     2ffd <modern_consume_flags+0x6d>
+    2fd3:	83 ec 08             	sub    $0x8,%esp
+    2fd6:	68 e3 3b 00 00       	push   $0x3be3
+    2fdb:	53                   	push   %ebx
+    2fdc:	e8 3f f3 ff ff       	call   2320 <strcmp>
+    2fe1:	83 c4 10             	add    $0x10,%esp
+    2fe4:	85 c0                	test   %eax,%eax
+    2fe6:	74 28                	je     3010 <modern_consume_flags+0x80>
+    2fe8:	83 ec 08             	sub    $0x8,%esp
+    2feb:	68 e6 3b 00 00       	push   $0x3be6
+    2ff0:	53                   	push   %ebx
+    2ff1:	e8 2a f3 ff ff       	call   2320 <strcmp>
+    2ff6:	83 c4 10             	add    $0x10,%esp
+    2ff9:	85 c0                	test   %eax,%eax
+    2ffb:	74 13                	je     3010 <modern_consume_flags+0x80>
+}
+    2ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3000:	89 f8                	mov    %edi,%eax
+    3002:	5b                   	pop    %ebx
+    3003:	5e                   	pop    %esi
+    3004:	5f                   	pop    %edi
+    3005:	5d                   	pop    %ebp
+    3006:	c3                   	ret
+    3007:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    300e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+    3010:	85 f6                	test   %esi,%esi
+    3012:	74 06                	je     301a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+    3014:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+    301a:	83 c7 01             	add    $0x1,%edi
+    301d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+    3020:	75 8f                	jne    2fb1 <modern_consume_flags+0x21>
+    3022:	eb d9                	jmp    2ffd <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+    3024:	85 f6                	test   %esi,%esi
+    3026:	74 12                	je     303a <modern_consume_flags+0xaa>
+  if(!json_mode){
+    3028:	83 3e 00             	cmpl   $0x0,(%esi)
+    302b:	74 0d                	je     303a <modern_consume_flags+0xaa>
+    302d:	8b 45 08             	mov    0x8(%ebp),%eax
+    3030:	e8 eb fe ff ff       	call   2f20 <modern_print_version.part.0>
+      exit();
+    3035:	e8 f9 f4 ff ff       	call   2533 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    303a:	83 ec 0c             	sub    $0xc,%esp
+    303d:	68 ea 07 00 00       	push   $0x7ea
+    3042:	68 ae 3b 00 00       	push   $0x3bae
+    3047:	ff 75 08             	push   0x8(%ebp)
+    304a:	68 d5 3b 00 00       	push   $0x3bd5
+    304f:	6a 01                	push   $0x1
+    3051:	e8 8a f6 ff ff       	call   26e0 <printf>
+}
+    3056:	83 c4 20             	add    $0x20,%esp
+    3059:	eb da                	jmp    3035 <modern_consume_flags+0xa5>
+    305b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    305f:	90                   	nop
+
+00003060 <modern_print_version>:
+{
+    3060:	55                   	push   %ebp
+    3061:	89 e5                	mov    %esp,%ebp
+    3063:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    3066:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    3069:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    306c:	85 d2                	test   %edx,%edx
+    306e:	74 10                	je     3080 <modern_print_version+0x20>
+}
+    3070:	c9                   	leave
+    3071:	e9 aa fe ff ff       	jmp    2f20 <modern_print_version.part.0>
+    3076:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    307d:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    3080:	83 ec 0c             	sub    $0xc,%esp
+    3083:	68 ea 07 00 00       	push   $0x7ea
+    3088:	68 ae 3b 00 00       	push   $0x3bae
+    308d:	50                   	push   %eax
+    308e:	68 d5 3b 00 00       	push   $0x3bd5
+    3093:	6a 01                	push   $0x1
+    3095:	e8 46 f6 ff ff       	call   26e0 <printf>
+}
+    309a:	83 c4 20             	add    $0x20,%esp
+}
+    309d:	c9                   	leave
+    309e:	c3                   	ret
+    309f:	90                   	nop
+
+000030a0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    30a0:	55                   	push   %ebp
+    30a1:	89 e5                	mov    %esp,%ebp
+    30a3:	57                   	push   %edi
+    30a4:	56                   	push   %esi
+    30a5:	53                   	push   %ebx
+    30a6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    30ac:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    30af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    30b2:	8b 45 10             	mov    0x10(%ebp),%eax
+    30b5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    30b8:	85 d2                	test   %edx,%edx
+    30ba:	75 44                	jne    3100 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    30bc:	85 f6                	test   %esi,%esi
+    30be:	ba ed 3b 00 00       	mov    $0x3bed,%edx
+    30c3:	0f 44 f2             	cmove  %edx,%esi
+    30c6:	85 c0                	test   %eax,%eax
+    30c8:	ba c9 31 00 00       	mov    $0x31c9,%edx
+    30cd:	0f 44 c2             	cmove  %edx,%eax
+    30d0:	85 db                	test   %ebx,%ebx
+    30d2:	ba f2 3b 00 00       	mov    $0x3bf2,%edx
+    30d7:	0f 44 da             	cmove  %edx,%ebx
+    30da:	83 ec 08             	sub    $0x8,%esp
+    30dd:	56                   	push   %esi
+    30de:	50                   	push   %eax
+    30df:	53                   	push   %ebx
+    30e0:	ff 75 08             	push   0x8(%ebp)
+    30e3:	68 f8 3b 00 00       	push   $0x3bf8
+    30e8:	6a 01                	push   $0x1
+    30ea:	e8 f1 f5 ff ff       	call   26e0 <printf>
+    30ef:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    30f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    30f5:	5b                   	pop    %ebx
+    30f6:	5e                   	pop    %esi
+    30f7:	5f                   	pop    %edi
+    30f8:	5d                   	pop    %ebp
+    30f9:	c3                   	ret
+    30fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    3100:	83 ec 08             	sub    $0x8,%esp
+    3103:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    3109:	89 45 10             	mov    %eax,0x10(%ebp)
+    310c:	6a 01                	push   $0x1
+    310e:	57                   	push   %edi
+    310f:	e8 2c fa ff ff       	call   2b40 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    3114:	83 c4 0c             	add    $0xc,%esp
+    3117:	ff 75 08             	push   0x8(%ebp)
+    311a:	68 a6 3b 00 00       	push   $0x3ba6
+    311f:	57                   	push   %edi
+    3120:	e8 4b fa ff ff       	call   2b70 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    3125:	83 c4 0c             	add    $0xc,%esp
+    3128:	ba f2 3b 00 00       	mov    $0x3bf2,%edx
+    312d:	85 db                	test   %ebx,%ebx
+    312f:	0f 44 da             	cmove  %edx,%ebx
+    3132:	53                   	push   %ebx
+    3133:	52                   	push   %edx
+    3134:	57                   	push   %edi
+    3135:	e8 36 fa ff ff       	call   2b70 <struct_field_str>
+  if(target)
+    313a:	8b 45 10             	mov    0x10(%ebp),%eax
+    313d:	83 c4 10             	add    $0x10,%esp
+    3140:	85 c0                	test   %eax,%eax
+    3142:	74 12                	je     3156 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    3144:	83 ec 04             	sub    $0x4,%esp
+    3147:	50                   	push   %eax
+    3148:	68 06 3c 00 00       	push   $0x3c06
+    314d:	57                   	push   %edi
+    314e:	e8 1d fa ff ff       	call   2b70 <struct_field_str>
+    3153:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    3156:	85 f6                	test   %esi,%esi
+    3158:	74 12                	je     316c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    315a:	83 ec 04             	sub    $0x4,%esp
+    315d:	56                   	push   %esi
+    315e:	68 0d 3c 00 00       	push   $0x3c0d
+    3163:	57                   	push   %edi
+    3164:	e8 07 fa ff ff       	call   2b70 <struct_field_str>
+    3169:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    316c:	83 ec 0c             	sub    $0xc,%esp
+    316f:	57                   	push   %edi
+    3170:	e8 bb fc ff ff       	call   2e30 <struct_end>
+    3175:	83 c4 10             	add    $0x10,%esp
+}
+    3178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    317b:	5b                   	pop    %ebx
+    317c:	5e                   	pop    %esi
+    317d:	5f                   	pop    %edi
+    317e:	5d                   	pop    %ebp
+    317f:	c3                   	ret
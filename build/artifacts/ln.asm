@@ -0,0 +1,2103 @@
+
+build/bin/user/_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 f0 0e 00 00       	push   $0xef0
+  1e:	6a 02                	push   $0x2
+  20:	e8 2b 04 00 00       	call   450 <printf>
+    exit();
+  25:	e8 79 02 00 00       	call   2a3 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 cc 02 00 00       	call   303 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 60 02 00 00       	call   2a3 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 03 0f 00 00       	push   $0xf03
+  4e:	6a 02                	push   $0x2
+  50:	e8 fb 03 00 00       	call   450 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 1e 01 00 00       	call   2bb <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 f1 00 00 00       	call   2e3 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 f4 00 00 00       	call   2fb <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 ba 00 00 00       	call   2cb <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+
+0000029b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 29b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <exit>:
+SYSCALL(exit)
+ 2a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <wait>:
+SYSCALL(wait)
+ 2ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <pipe>:
+SYSCALL(pipe)
+ 2b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <read>:
+SYSCALL(read)
+ 2bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <write>:
+SYSCALL(write)
+ 2c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <close>:
+SYSCALL(close)
+ 2cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <kill>:
+SYSCALL(kill)
+ 2d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <exec>:
+SYSCALL(exec)
+ 2db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <open>:
+SYSCALL(open)
+ 2e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <mknod>:
+SYSCALL(mknod)
+ 2eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <unlink>:
+SYSCALL(unlink)
+ 2f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <fstat>:
+SYSCALL(fstat)
+ 2fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <link>:
+SYSCALL(link)
+ 303:	b8 13 00 00 00       	mov    $0x13,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mkdir>:
+SYSCALL(mkdir)
+ 30b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <chdir>:
+SYSCALL(chdir)
+ 313:	b8 09 00 00 00       	mov    $0x9,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <dup>:
+SYSCALL(dup)
+ 31b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <getpid>:
+SYSCALL(getpid)
+ 323:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <sbrk>:
+SYSCALL(sbrk)
+ 32b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <sleep>:
+SYSCALL(sleep)
+ 333:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <uptime>:
+SYSCALL(uptime)
+ 33b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <poll>:
+SYSCALL(poll)
+ 343:	b8 16 00 00 00       	mov    $0x16,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <fcntl>:
+SYSCALL(fcntl)
+ 34b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <lseek>:
+SYSCALL(lseek)
+ 353:	b8 18 00 00 00       	mov    $0x18,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <pread>:
+SYSCALL(pread)
+ 35b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <pwrite>:
+SYSCALL(pwrite)
+ 363:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <readv>:
+SYSCALL(readv)
+ 36b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <writev>:
+SYSCALL(writev)
+ 373:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <getdents>:
+SYSCALL(getdents)
+ 37b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <splice>:
+SYSCALL(splice)
+ 383:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 38b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 393:	b8 20 00 00 00       	mov    $0x20,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <batch>:
+SYSCALL(batch)
+ 39b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+ 3a3:	66 90                	xchg   %ax,%ax
+ 3a5:	66 90                	xchg   %ax,%ax
+ 3a7:	66 90                	xchg   %ax,%ax
+ 3a9:	66 90                	xchg   %ax,%ax
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3b8:	89 d1                	mov    %edx,%ecx
+{
+ 3ba:	83 ec 3c             	sub    $0x3c,%esp
+ 3bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3c0:	85 d2                	test   %edx,%edx
+ 3c2:	0f 89 80 00 00 00    	jns    448 <printint+0x98>
+ 3c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3cc:	74 7a                	je     448 <printint+0x98>
+    x = -xx;
+ 3ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3d8:	31 f6                	xor    %esi,%esi
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3e0:	89 c8                	mov    %ecx,%eax
+ 3e2:	31 d2                	xor    %edx,%edx
+ 3e4:	89 f7                	mov    %esi,%edi
+ 3e6:	f7 f3                	div    %ebx
+ 3e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3eb:	0f b6 92 78 0f 00 00 	movzbl 0xf78(%edx),%edx
+ 3f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 3f6:	89 ca                	mov    %ecx,%edx
+ 3f8:	89 c1                	mov    %eax,%ecx
+ 3fa:	39 da                	cmp    %ebx,%edx
+ 3fc:	73 e2                	jae    3e0 <printint+0x30>
+  if(neg)
+ 3fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 401:	85 c0                	test   %eax,%eax
+ 403:	74 07                	je     40c <printint+0x5c>
+    buf[i++] = '-';
+ 405:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 40a:	89 f7                	mov    %esi,%edi
+ 40c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 40f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 412:	01 df                	add    %ebx,%edi
+ 414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 418:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 41b:	83 ec 04             	sub    $0x4,%esp
+ 41e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 421:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 424:	6a 01                	push   $0x1
+ 426:	50                   	push   %eax
+ 427:	56                   	push   %esi
+ 428:	e8 96 fe ff ff       	call   2c3 <write>
+  while(--i >= 0)
+ 42d:	89 f8                	mov    %edi,%eax
+ 42f:	83 c4 10             	add    $0x10,%esp
+ 432:	83 ef 01             	sub    $0x1,%edi
+ 435:	39 d8                	cmp    %ebx,%eax
+ 437:	75 df                	jne    418 <printint+0x68>
+}
+ 439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43c:	5b                   	pop    %ebx
+ 43d:	5e                   	pop    %esi
+ 43e:	5f                   	pop    %edi
+ 43f:	5d                   	pop    %ebp
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 448:	31 c0                	xor    %eax,%eax
+ 44a:	eb 89                	jmp    3d5 <printint+0x25>
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 459:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 45c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 45f:	0f b6 1e             	movzbl (%esi),%ebx
+ 462:	83 c6 01             	add    $0x1,%esi
+ 465:	84 db                	test   %bl,%bl
+ 467:	74 67                	je     4d0 <printf+0x80>
+ 469:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 46c:	31 d2                	xor    %edx,%edx
+ 46e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 471:	eb 34                	jmp    4a7 <printf+0x57>
+ 473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 477:	90                   	nop
+ 478:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 47b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 480:	83 f8 25             	cmp    $0x25,%eax
+ 483:	74 18                	je     49d <printf+0x4d>
+  write(fd, &c, 1);
+ 485:	83 ec 04             	sub    $0x4,%esp
+ 488:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 48b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 48e:	6a 01                	push   $0x1
+ 490:	50                   	push   %eax
+ 491:	57                   	push   %edi
+ 492:	e8 2c fe ff ff       	call   2c3 <write>
+ 497:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 49a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 49d:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a0:	83 c6 01             	add    $0x1,%esi
+ 4a3:	84 db                	test   %bl,%bl
+ 4a5:	74 29                	je     4d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4aa:	85 d2                	test   %edx,%edx
+ 4ac:	74 ca                	je     478 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ae:	83 fa 25             	cmp    $0x25,%edx
+ 4b1:	75 ea                	jne    49d <printf+0x4d>
+      if(c == 'd'){
+ 4b3:	83 f8 25             	cmp    $0x25,%eax
+ 4b6:	0f 84 24 01 00 00    	je     5e0 <printf+0x190>
+ 4bc:	83 e8 63             	sub    $0x63,%eax
+ 4bf:	83 f8 15             	cmp    $0x15,%eax
+ 4c2:	77 1c                	ja     4e0 <printf+0x90>
+ 4c4:	ff 24 85 20 0f 00 00 	jmp    *0xf20(,%eax,4)
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4d3:	5b                   	pop    %ebx
+ 4d4:	5e                   	pop    %esi
+ 4d5:	5f                   	pop    %edi
+ 4d6:	5d                   	pop    %ebp
+ 4d7:	c3                   	ret
+ 4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+  write(fd, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4ea:	6a 01                	push   $0x1
+ 4ec:	52                   	push   %edx
+ 4ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 4f0:	57                   	push   %edi
+ 4f1:	e8 cd fd ff ff       	call   2c3 <write>
+ 4f6:	83 c4 0c             	add    $0xc,%esp
+ 4f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4fc:	6a 01                	push   $0x1
+ 4fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 501:	52                   	push   %edx
+ 502:	57                   	push   %edi
+ 503:	e8 bb fd ff ff       	call   2c3 <write>
+        putc(fd, c);
+ 508:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 50b:	31 d2                	xor    %edx,%edx
+ 50d:	eb 8e                	jmp    49d <printf+0x4d>
+ 50f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 510:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 513:	83 ec 0c             	sub    $0xc,%esp
+ 516:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 51b:	8b 13                	mov    (%ebx),%edx
+ 51d:	6a 00                	push   $0x0
+ 51f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 521:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 524:	e8 87 fe ff ff       	call   3b0 <printint>
+        ap++;
+ 529:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 52c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52f:	31 d2                	xor    %edx,%edx
+ 531:	e9 67 ff ff ff       	jmp    49d <printf+0x4d>
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 540:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 543:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 545:	83 c0 04             	add    $0x4,%eax
+ 548:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 54b:	85 db                	test   %ebx,%ebx
+ 54d:	0f 84 9d 00 00 00    	je     5f0 <printf+0x1a0>
+        while(*s != 0){
+ 553:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 556:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 558:	84 c0                	test   %al,%al
+ 55a:	0f 84 3d ff ff ff    	je     49d <printf+0x4d>
+ 560:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 563:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 566:	89 de                	mov    %ebx,%esi
+ 568:	89 d3                	mov    %edx,%ebx
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 576:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 579:	6a 01                	push   $0x1
+ 57b:	53                   	push   %ebx
+ 57c:	57                   	push   %edi
+ 57d:	e8 41 fd ff ff       	call   2c3 <write>
+        while(*s != 0){
+ 582:	0f b6 06             	movzbl (%esi),%eax
+ 585:	83 c4 10             	add    $0x10,%esp
+ 588:	84 c0                	test   %al,%al
+ 58a:	75 e4                	jne    570 <printf+0x120>
+      state = 0;
+ 58c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 07 ff ff ff       	jmp    49d <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5ab:	8b 13                	mov    (%ebx),%edx
+ 5ad:	6a 01                	push   $0x1
+ 5af:	e9 6b ff ff ff       	jmp    51f <printf+0xcf>
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	52                   	push   %edx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 f1 fc ff ff       	call   2c3 <write>
+        ap++;
+ 5d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5d8:	31 d2                	xor    %edx,%edx
+ 5da:	e9 be fe ff ff       	jmp    49d <printf+0x4d>
+ 5df:	90                   	nop
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	e9 11 ff ff ff       	jmp    501 <printf+0xb1>
+ 5f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 5f5:	bb 17 0f 00 00       	mov    $0xf17,%ebx
+ 5fa:	e9 61 ff ff ff       	jmp    560 <printf+0x110>
+ 5ff:	90                   	nop
+
+00000600 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 600:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 601:	a1 94 14 00 00       	mov    0x1494,%eax
+{
+ 606:	89 e5                	mov    %esp,%ebp
+ 608:	57                   	push   %edi
+ 609:	56                   	push   %esi
+ 60a:	53                   	push   %ebx
+ 60b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 60e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 618:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 61a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 61c:	39 ca                	cmp    %ecx,%edx
+ 61e:	73 30                	jae    650 <free+0x50>
+ 620:	39 c1                	cmp    %eax,%ecx
+ 622:	72 04                	jb     628 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 624:	39 c2                	cmp    %eax,%edx
+ 626:	72 f0                	jb     618 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 628:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 62b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 62e:	39 f8                	cmp    %edi,%eax
+ 630:	74 2e                	je     660 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 632:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 635:	8b 42 04             	mov    0x4(%edx),%eax
+ 638:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 63b:	39 f1                	cmp    %esi,%ecx
+ 63d:	74 38                	je     677 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 63f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 641:	5b                   	pop    %ebx
+  freep = p;
+ 642:	89 15 94 14 00 00    	mov    %edx,0x1494
+}
+ 648:	5e                   	pop    %esi
+ 649:	5f                   	pop    %edi
+ 64a:	5d                   	pop    %ebp
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 650:	39 c1                	cmp    %eax,%ecx
+ 652:	72 d0                	jb     624 <free+0x24>
+ 654:	eb c2                	jmp    618 <free+0x18>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 660:	03 70 04             	add    0x4(%eax),%esi
+ 663:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 666:	8b 02                	mov    (%edx),%eax
+ 668:	8b 00                	mov    (%eax),%eax
+ 66a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 66d:	8b 42 04             	mov    0x4(%edx),%eax
+ 670:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 673:	39 f1                	cmp    %esi,%ecx
+ 675:	75 c8                	jne    63f <free+0x3f>
+    p->s.size += bp->s.size;
+ 677:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 67a:	89 15 94 14 00 00    	mov    %edx,0x1494
+    p->s.size += bp->s.size;
+ 680:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 683:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 686:	89 0a                	mov    %ecx,(%edx)
+}
+ 688:	5b                   	pop    %ebx
+ 689:	5e                   	pop    %esi
+ 68a:	5f                   	pop    %edi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 699:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 69c:	8b 15 94 14 00 00    	mov    0x1494,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6a5:	c1 ef 03             	shr    $0x3,%edi
+ 6a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6ab:	85 d2                	test   %edx,%edx
+ 6ad:	0f 84 8d 00 00 00    	je     740 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6b8:	39 f9                	cmp    %edi,%ecx
+ 6ba:	73 64                	jae    720 <malloc+0x90>
+  if(nu < 4096)
+ 6bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6c1:	39 df                	cmp    %ebx,%edi
+ 6c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6cd:	eb 0a                	jmp    6d9 <malloc+0x49>
+ 6cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d5:	39 f9                	cmp    %edi,%ecx
+ 6d7:	73 47                	jae    720 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6d9:	89 c2                	mov    %eax,%edx
+ 6db:	39 05 94 14 00 00    	cmp    %eax,0x1494
+ 6e1:	75 ed                	jne    6d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	56                   	push   %esi
+ 6e7:	e8 3f fc ff ff       	call   32b <sbrk>
+  if(p == (char*)-1)
+ 6ec:	83 c4 10             	add    $0x10,%esp
+ 6ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6f2:	74 1c                	je     710 <malloc+0x80>
+  hp->s.size = nu;
+ 6f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6f7:	83 ec 0c             	sub    $0xc,%esp
+ 6fa:	83 c0 08             	add    $0x8,%eax
+ 6fd:	50                   	push   %eax
+ 6fe:	e8 fd fe ff ff       	call   600 <free>
+  return freep;
+ 703:	8b 15 94 14 00 00    	mov    0x1494,%edx
+      if((p = morecore(nunits)) == 0)
+ 709:	83 c4 10             	add    $0x10,%esp
+ 70c:	85 d2                	test   %edx,%edx
+ 70e:	75 c0                	jne    6d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 713:	31 c0                	xor    %eax,%eax
+}
+ 715:	5b                   	pop    %ebx
+ 716:	5e                   	pop    %esi
+ 717:	5f                   	pop    %edi
+ 718:	5d                   	pop    %ebp
+ 719:	c3                   	ret
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 720:	39 cf                	cmp    %ecx,%edi
+ 722:	74 4c                	je     770 <malloc+0xe0>
+        p->s.size -= nunits;
+ 724:	29 f9                	sub    %edi,%ecx
+ 726:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 729:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 72c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 72f:	89 15 94 14 00 00    	mov    %edx,0x1494
+}
+ 735:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 738:	83 c0 08             	add    $0x8,%eax
+}
+ 73b:	5b                   	pop    %ebx
+ 73c:	5e                   	pop    %esi
+ 73d:	5f                   	pop    %edi
+ 73e:	5d                   	pop    %ebp
+ 73f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 740:	c7 05 94 14 00 00 98 	movl   $0x1498,0x1494
+ 747:	14 00 00 
+    base.s.size = 0;
+ 74a:	b8 98 14 00 00       	mov    $0x1498,%eax
+    base.s.ptr = freep = prevp = &base;
+ 74f:	c7 05 98 14 00 00 98 	movl   $0x1498,0x1498
+ 756:	14 00 00 
+    base.s.size = 0;
+ 759:	c7 05 9c 14 00 00 00 	movl   $0x0,0x149c
+ 760:	00 00 00 
+    if(p->s.size >= nunits){
+ 763:	e9 54 ff ff ff       	jmp    6bc <malloc+0x2c>
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 770:	8b 08                	mov    (%eax),%ecx
+ 772:	89 0a                	mov    %ecx,(%edx)
+ 774:	eb b9                	jmp    72f <malloc+0x9f>
+ 776:	66 90                	xchg   %ax,%ax
+ 778:	66 90                	xchg   %ax,%ax
+ 77a:	66 90                	xchg   %ax,%ax
+ 77c:	66 90                	xchg   %ax,%ax
+ 77e:	66 90                	xchg   %ax,%ax
+
+00000780 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	83 ec 1c             	sub    $0x1c,%esp
+ 789:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+ 78c:	85 c9                	test   %ecx,%ecx
+ 78e:	7e 51                	jle    7e1 <put+0x61>
+ 790:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+ 792:	8b 40 08             	mov    0x8(%eax),%eax
+ 795:	89 ce                	mov    %ecx,%esi
+ 797:	85 c0                	test   %eax,%eax
+ 799:	7e 55                	jle    7f0 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+ 79b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+ 79e:	8b 51 0c             	mov    0xc(%ecx),%edx
+ 7a1:	8b 79 08             	mov    0x8(%ecx),%edi
+ 7a4:	01 d7                	add    %edx,%edi
+ 7a6:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 7a9:	74 65                	je     810 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+ 7ab:	83 f8 20             	cmp    $0x20,%eax
+ 7ae:	75 40                	jne    7f0 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	8d 43 10             	lea    0x10(%ebx),%eax
+ 7b6:	6a 20                	push   $0x20
+ 7b8:	50                   	push   %eax
+ 7b9:	ff 33                	push   (%ebx)
+ 7bb:	e8 b3 fb ff ff       	call   373 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+ 7c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+ 7c3:	31 c0                	xor    %eax,%eax
+ 7c5:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 7ca:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+ 7cd:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 7d4:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ 7d7:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ 7da:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+ 7de:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 7e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e4:	5b                   	pop    %ebx
+ 7e5:	5e                   	pop    %esi
+ 7e6:	5f                   	pop    %edi
+ 7e7:	5d                   	pop    %ebp
+ 7e8:	c3                   	ret
+ 7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+ 7f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+ 7f3:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 7f6:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+ 7f9:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+ 7fd:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+ 800:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 803:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 806:	5b                   	pop    %ebx
+ 807:	5e                   	pop    %esi
+ 808:	5f                   	pop    %edi
+ 809:	5d                   	pop    %ebp
+ 80a:	c3                   	ret
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+      last->iov_len += n;
+ 810:	01 f2                	add    %esi,%edx
+ 812:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+ 815:	eb ca                	jmp    7e1 <put+0x61>
+ 817:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81e:	66 90                	xchg   %ax,%ax
+
+00000820 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	89 d7                	mov    %edx,%edi
+ 826:	56                   	push   %esi
+ 827:	89 ce                	mov    %ecx,%esi
+ 829:	53                   	push   %ebx
+ 82a:	89 c3                	mov    %eax,%ebx
+ 82c:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+ 82f:	8b 40 0c             	mov    0xc(%eax),%eax
+ 832:	8b 53 08             	mov    0x8(%ebx),%edx
+ 835:	01 c1                	add    %eax,%ecx
+ 837:	83 f9 40             	cmp    $0x40,%ecx
+ 83a:	7f 3c                	jg     878 <putcopy+0x58>
+ 83c:	83 fa 20             	cmp    $0x20,%edx
+ 83f:	74 3f                	je     880 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+ 841:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+ 847:	83 ec 04             	sub    $0x4,%esp
+ 84a:	01 d0                	add    %edx,%eax
+ 84c:	56                   	push   %esi
+ 84d:	57                   	push   %edi
+ 84e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 851:	50                   	push   %eax
+ 852:	e8 19 fa ff ff       	call   270 <memmove>
+  put(w, w->buf + w->nbuf, n);
+ 857:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 85a:	89 f1                	mov    %esi,%ecx
+ 85c:	03 53 0c             	add    0xc(%ebx),%edx
+ 85f:	89 d8                	mov    %ebx,%eax
+ 861:	e8 1a ff ff ff       	call   780 <put>
+  w->nbuf += n;
+ 866:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+ 869:	83 c4 10             	add    $0x10,%esp
+ 86c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 86f:	5b                   	pop    %ebx
+ 870:	5e                   	pop    %esi
+ 871:	5f                   	pop    %edi
+ 872:	5d                   	pop    %ebp
+ 873:	c3                   	ret
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+ 878:	85 d2                	test   %edx,%edx
+ 87a:	7e 16                	jle    892 <putcopy+0x72>
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 43 10             	lea    0x10(%ebx),%eax
+ 886:	52                   	push   %edx
+ 887:	50                   	push   %eax
+ 888:	ff 33                	push   (%ebx)
+ 88a:	e8 e4 fa ff ff       	call   373 <writev>
+ 88f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+ 892:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 899:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+ 89b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 8a2:	eb 9d                	jmp    841 <putcopy+0x21>
+ 8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+
+000008b0 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+ 8b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+ 8b9:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+ 8c0:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+ 8c2:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+ 8c9:	c7 40 10 89 0f 00 00 	movl   $0xf89,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+ 8d0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+ 8d7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+
+000008e0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 1c             	sub    $0x1c,%esp
+ 8e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 8ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 8ef:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+ 8f2:	8b 47 04             	mov    0x4(%edi),%eax
+ 8f5:	85 c0                	test   %eax,%eax
+ 8f7:	0f 85 7b 01 00 00    	jne    a78 <struct_field_str+0x198>
+    w->need_comma = 1;
+ 8fd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ 904:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 909:	ba 9e 0f 00 00       	mov    $0xf9e,%edx
+ 90e:	89 f8                	mov    %edi,%eax
+ 910:	e8 6b fe ff ff       	call   780 <put>
+  put_str(w, key ? key : "");
+ 915:	85 db                	test   %ebx,%ebx
+ 917:	b8 f6 0f 00 00       	mov    $0xff6,%eax
+ 91c:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ 91f:	83 ec 0c             	sub    $0xc,%esp
+ 922:	53                   	push   %ebx
+ 923:	e8 c8 f7 ff ff       	call   f0 <strlen>
+ 928:	89 da                	mov    %ebx,%edx
+ 92a:	89 c1                	mov    %eax,%ecx
+ 92c:	89 f8                	mov    %edi,%eax
+ 92e:	e8 4d fe ff ff       	call   780 <put>
+  put(w, "\":\"", 3);
+ 933:	b9 03 00 00 00       	mov    $0x3,%ecx
+ 938:	ba 9c 0f 00 00       	mov    $0xf9c,%edx
+ 93d:	89 f8                	mov    %edi,%eax
+ 93f:	e8 3c fe ff ff       	call   780 <put>
+  put_escaped(w, value ? value : "");
+ 944:	83 c4 10             	add    $0x10,%esp
+ 947:	85 f6                	test   %esi,%esi
+ 949:	0f 84 41 01 00 00    	je     a90 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+ 94f:	0f b6 1e             	movzbl (%esi),%ebx
+ 952:	89 f2                	mov    %esi,%edx
+ 954:	84 db                	test   %bl,%bl
+ 956:	0f 84 40 01 00 00    	je     a9c <struct_field_str+0x1bc>
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 960:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+ 962:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+ 965:	80 fb 0d             	cmp    $0xd,%bl
+ 968:	74 7e                	je     9e8 <struct_field_str+0x108>
+ 96a:	7f 5c                	jg     9c8 <struct_field_str+0xe8>
+ 96c:	80 fb 09             	cmp    $0x9,%bl
+ 96f:	0f 84 eb 00 00 00    	je     a60 <struct_field_str+0x180>
+ 975:	80 fb 0a             	cmp    $0xa,%bl
+ 978:	0f 85 95 00 00 00    	jne    a13 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 97e:	29 d1                	sub    %edx,%ecx
+ 980:	89 f8                	mov    %edi,%eax
+ 982:	e8 f9 fd ff ff       	call   780 <put>
+      esc = "\\n";
+ 987:	ba 97 0f 00 00       	mov    $0xf97,%edx
+      put(w, esc, 2);
+ 98c:	b9 02 00 00 00       	mov    $0x2,%ecx
+ 991:	89 f8                	mov    %edi,%eax
+ 993:	e8 e8 fd ff ff       	call   780 <put>
+    run = s + 1;
+ 998:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+ 99a:	0f b6 1e             	movzbl (%esi),%ebx
+ 99d:	84 db                	test   %bl,%bl
+ 99f:	75 bf                	jne    960 <struct_field_str+0x80>
+  put(w, run, s - run);
+ 9a1:	29 d6                	sub    %edx,%esi
+ 9a3:	89 f1                	mov    %esi,%ecx
+ 9a5:	89 f8                	mov    %edi,%eax
+ 9a7:	e8 d4 fd ff ff       	call   780 <put>
+  put(w, "\"", 1);
+}
+ 9ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+ 9af:	89 f8                	mov    %edi,%eax
+ 9b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+ 9b6:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+ 9b7:	ba 9e 0f 00 00       	mov    $0xf9e,%edx
+}
+ 9bc:	5e                   	pop    %esi
+ 9bd:	5f                   	pop    %edi
+ 9be:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+ 9bf:	e9 bc fd ff ff       	jmp    780 <put>
+ 9c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 9c8:	80 fb 22             	cmp    $0x22,%bl
+ 9cb:	74 33                	je     a00 <struct_field_str+0x120>
+ 9cd:	80 fb 5c             	cmp    $0x5c,%bl
+ 9d0:	75 41                	jne    a13 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 9d2:	29 d1                	sub    %edx,%ecx
+ 9d4:	89 f8                	mov    %edi,%eax
+ 9d6:	e8 a5 fd ff ff       	call   780 <put>
+      esc = "\\\\";
+ 9db:	ba 8b 0f 00 00       	mov    $0xf8b,%edx
+ 9e0:	eb aa                	jmp    98c <struct_field_str+0xac>
+ 9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+ 9e8:	29 d1                	sub    %edx,%ecx
+ 9ea:	89 f8                	mov    %edi,%eax
+ 9ec:	e8 8f fd ff ff       	call   780 <put>
+      esc = "\\r";
+ 9f1:	ba 94 0f 00 00       	mov    $0xf94,%edx
+ 9f6:	eb 94                	jmp    98c <struct_field_str+0xac>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+    put(w, run, s - run);
+ a00:	29 d1                	sub    %edx,%ecx
+ a02:	89 f8                	mov    %edi,%eax
+ a04:	e8 77 fd ff ff       	call   780 <put>
+      esc = "\\\"";
+ a09:	ba 8e 0f 00 00       	mov    $0xf8e,%edx
+ a0e:	e9 79 ff ff ff       	jmp    98c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+ a13:	80 fb 1f             	cmp    $0x1f,%bl
+ a16:	77 82                	ja     99a <struct_field_str+0xba>
+    put(w, run, s - run);
+ a18:	29 d1                	sub    %edx,%ecx
+ a1a:	89 f8                	mov    %edi,%eax
+ a1c:	e8 5f fd ff ff       	call   780 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+ a21:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+ a23:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+ a26:	0f b7 05 b8 0f 00 00 	movzwl 0xfb8,%eax
+ a2d:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+ a30:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+ a35:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+ a3c:	0f b6 d2             	movzbl %dl,%edx
+ a3f:	8a 82 a0 0f 00 00    	mov    0xfa0(%edx),%al
+ a45:	8a a3 a0 0f 00 00    	mov    0xfa0(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+ a4b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+ a4e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+ a52:	89 f8                	mov    %edi,%eax
+ a54:	e8 c7 fd ff ff       	call   820 <putcopy>
+ a59:	e9 3a ff ff ff       	jmp    998 <struct_field_str+0xb8>
+ a5e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+ a60:	29 d1                	sub    %edx,%ecx
+ a62:	89 f8                	mov    %edi,%eax
+ a64:	e8 17 fd ff ff       	call   780 <put>
+      esc = "\\t";
+ a69:	ba 91 0f 00 00       	mov    $0xf91,%edx
+ a6e:	e9 19 ff ff ff       	jmp    98c <struct_field_str+0xac>
+ a73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a77:	90                   	nop
+    put(w, ",", 1);
+ a78:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a7d:	ba 9a 0f 00 00       	mov    $0xf9a,%edx
+ a82:	89 f8                	mov    %edi,%eax
+ a84:	e8 f7 fc ff ff       	call   780 <put>
+}
+ a89:	e9 76 fe ff ff       	jmp    904 <struct_field_str+0x24>
+ a8e:	66 90                	xchg   %ax,%ax
+ a90:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+ a92:	ba f6 0f 00 00       	mov    $0xff6,%edx
+ a97:	e9 09 ff ff ff       	jmp    9a5 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+ a9c:	31 c9                	xor    %ecx,%ecx
+ a9e:	e9 02 ff ff ff       	jmp    9a5 <struct_field_str+0xc5>
+ aa3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ab0 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	57                   	push   %edi
+ ab4:	56                   	push   %esi
+ ab5:	53                   	push   %ebx
+ ab6:	83 ec 1c             	sub    $0x1c,%esp
+ ab9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ abc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+ abf:	8b 57 04             	mov    0x4(%edi),%edx
+ ac2:	85 d2                	test   %edx,%edx
+ ac4:	0f 85 b6 00 00 00    	jne    b80 <struct_field_int+0xd0>
+    w->need_comma = 1;
+ aca:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ ad1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ ad6:	ba 9e 0f 00 00       	mov    $0xf9e,%edx
+ adb:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+ add:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+ ae2:	e8 99 fc ff ff       	call   780 <put>
+  put_str(w, key ? key : "");
+ ae7:	85 db                	test   %ebx,%ebx
+ ae9:	b8 f6 0f 00 00       	mov    $0xff6,%eax
+ aee:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ af1:	83 ec 0c             	sub    $0xc,%esp
+ af4:	53                   	push   %ebx
+ af5:	e8 f6 f5 ff ff       	call   f0 <strlen>
+ afa:	89 da                	mov    %ebx,%edx
+ afc:	89 c1                	mov    %eax,%ecx
+ afe:	89 f8                	mov    %edi,%eax
+ b00:	e8 7b fc ff ff       	call   780 <put>
+  put(w, "\":", 2);
+ b05:	b9 02 00 00 00       	mov    $0x2,%ecx
+ b0a:	ba b1 0f 00 00       	mov    $0xfb1,%edx
+ b0f:	89 f8                	mov    %edi,%eax
+ b11:	e8 6a fc ff ff       	call   780 <put>
+  x = value < 0 ? -(uint)value : value;
+ b16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+ b19:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+ b1c:	83 c4 10             	add    $0x10,%esp
+ b1f:	f7 d9                	neg    %ecx
+ b21:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+ b25:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+ b28:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ b2d:	89 f3                	mov    %esi,%ebx
+ b2f:	83 ee 01             	sub    $0x1,%esi
+ b32:	f7 e1                	mul    %ecx
+ b34:	89 c8                	mov    %ecx,%eax
+ b36:	c1 ea 03             	shr    $0x3,%edx
+ b39:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ b3c:	01 ff                	add    %edi,%edi
+ b3e:	29 f8                	sub    %edi,%eax
+ b40:	83 c0 30             	add    $0x30,%eax
+ b43:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ b47:	89 c8                	mov    %ecx,%eax
+ b49:	89 d1                	mov    %edx,%ecx
+ b4b:	83 f8 09             	cmp    $0x9,%eax
+ b4e:	77 d8                	ja     b28 <struct_field_int+0x78>
+  if(value < 0)
+ b50:	8b 45 10             	mov    0x10(%ebp),%eax
+ b53:	8b 7d 08             	mov    0x8(%ebp),%edi
+ b56:	85 c0                	test   %eax,%eax
+ b58:	79 08                	jns    b62 <struct_field_int+0xb2>
+    buf[--i] = '-';
+ b5a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+ b5f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+ b62:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ b65:	b9 0c 00 00 00       	mov    $0xc,%ecx
+ b6a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+ b6d:	29 f1                	sub    %esi,%ecx
+ b6f:	89 f8                	mov    %edi,%eax
+ b71:	e8 aa fc ff ff       	call   820 <putcopy>
+  put_int(w, value);
+}
+ b76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b79:	5b                   	pop    %ebx
+ b7a:	5e                   	pop    %esi
+ b7b:	5f                   	pop    %edi
+ b7c:	5d                   	pop    %ebp
+ b7d:	c3                   	ret
+ b7e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+ b80:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b85:	ba 9a 0f 00 00       	mov    $0xf9a,%edx
+ b8a:	89 f8                	mov    %edi,%eax
+ b8c:	e8 ef fb ff ff       	call   780 <put>
+}
+ b91:	e9 3b ff ff ff       	jmp    ad1 <struct_field_int+0x21>
+ b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	56                   	push   %esi
+ ba4:	53                   	push   %ebx
+ ba5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+ ba8:	8b 43 08             	mov    0x8(%ebx),%eax
+ bab:	85 c0                	test   %eax,%eax
+ bad:	7e 59                	jle    c08 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+ baf:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+ bb2:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ bb5:	8b 72 08             	mov    0x8(%edx),%esi
+ bb8:	01 ce                	add    %ecx,%esi
+ bba:	81 fe b4 0f 00 00    	cmp    $0xfb4,%esi
+ bc0:	0f 84 aa 00 00 00    	je     c70 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+ bc6:	83 f8 20             	cmp    $0x20,%eax
+ bc9:	75 75                	jne    c40 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+ bcb:	83 ec 04             	sub    $0x4,%esp
+ bce:	8d 73 10             	lea    0x10(%ebx),%esi
+ bd1:	6a 20                	push   $0x20
+ bd3:	56                   	push   %esi
+ bd4:	ff 33                	push   (%ebx)
+ bd6:	e8 98 f7 ff ff       	call   373 <writev>
+  w->nbuf = 0;
+ bdb:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+ be2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ be5:	c7 43 10 b4 0f 00 00 	movl   $0xfb4,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+ bec:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+ bf3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+ bfa:	ba 01 00 00 00       	mov    $0x1,%edx
+ bff:	eb 5a                	jmp    c5b <struct_end+0xbb>
+ c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+ c08:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c0b:	83 c0 02             	add    $0x2,%eax
+ c0e:	c7 04 c3 b4 0f 00 00 	movl   $0xfb4,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ c15:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ c1c:	00 
+  w->niov++;
+ c1d:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+ c20:	83 fa 01             	cmp    $0x1,%edx
+ c23:	74 58                	je     c7d <struct_end+0xdd>
+  w->niov = 0;
+ c25:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+ c2c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+ c33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c36:	5b                   	pop    %ebx
+ c37:	5e                   	pop    %esi
+ c38:	5d                   	pop    %ebp
+ c39:	c3                   	ret
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+ c40:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c43:	83 c0 02             	add    $0x2,%eax
+ c46:	8d 73 10             	lea    0x10(%ebx),%esi
+ c49:	c7 04 c3 b4 0f 00 00 	movl   $0xfb4,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ c50:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ c57:	00 
+  w->niov++;
+ c58:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+ c5b:	83 ec 04             	sub    $0x4,%esp
+ c5e:	52                   	push   %edx
+ c5f:	56                   	push   %esi
+ c60:	ff 33                	push   (%ebx)
+ c62:	e8 0c f7 ff ff       	call   373 <writev>
+ c67:	83 c4 10             	add    $0x10,%esp
+ c6a:	eb b9                	jmp    c25 <struct_end+0x85>
+ c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+ c70:	83 c1 02             	add    $0x2,%ecx
+ c73:	8d 73 10             	lea    0x10(%ebx),%esi
+ c76:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+ c79:	89 c2                	mov    %eax,%edx
+ c7b:	eb de                	jmp    c5b <struct_end+0xbb>
+ c7d:	8d 73 10             	lea    0x10(%ebx),%esi
+ c80:	e9 75 ff ff ff       	jmp    bfa <struct_end+0x5a>
+ c85:	66 90                	xchg   %ax,%ax
+ c87:	66 90                	xchg   %ax,%ax
+ c89:	66 90                	xchg   %ax,%ax
+ c8b:	66 90                	xchg   %ax,%ax
+ c8d:	66 90                	xchg   %ax,%ax
+ c8f:	90                   	nop
+
+00000c90 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	56                   	push   %esi
+ c94:	89 c6                	mov    %eax,%esi
+ c96:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+ c97:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+ c9d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+ ca3:	6a 01                	push   $0x1
+ ca5:	53                   	push   %ebx
+ ca6:	e8 05 fc ff ff       	call   8b0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ cab:	83 c4 0c             	add    $0xc,%esp
+ cae:	56                   	push   %esi
+ caf:	68 ba 0f 00 00       	push   $0xfba
+ cb4:	53                   	push   %ebx
+ cb5:	e8 26 fc ff ff       	call   8e0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+ cba:	83 c4 0c             	add    $0xc,%esp
+ cbd:	68 c2 0f 00 00       	push   $0xfc2
+ cc2:	68 d3 0f 00 00       	push   $0xfd3
+ cc7:	53                   	push   %ebx
+ cc8:	e8 13 fc ff ff       	call   8e0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+ ccd:	83 c4 0c             	add    $0xc,%esp
+ cd0:	68 ea 07 00 00       	push   $0x7ea
+ cd5:	68 da 0f 00 00       	push   $0xfda
+ cda:	53                   	push   %ebx
+ cdb:	e8 d0 fd ff ff       	call   ab0 <struct_field_int>
+  struct_end(&w);
+ ce0:	89 1c 24             	mov    %ebx,(%esp)
+ ce3:	e8 b8 fe ff ff       	call   ba0 <struct_end>
+ ce8:	83 c4 10             	add    $0x10,%esp
+}
+ ceb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cee:	5b                   	pop    %ebx
+ cef:	5e                   	pop    %esi
+ cf0:	5d                   	pop    %ebp
+ cf1:	c3                   	ret
+ cf2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d00 <modern_consume_flags>:
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 0c             	sub    $0xc,%esp
+ d09:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+ d0c:	85 f6                	test   %esi,%esi
+ d0e:	74 06                	je     d16 <modern_consume_flags+0x16>
+    *json_mode = 0;
+ d10:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+ d16:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+ d1a:	bf 01 00 00 00       	mov    $0x1,%edi
+ d1f:	7e 4c                	jle    d6d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+ d21:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+ d24:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+ d27:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+ d2a:	68 df 0f 00 00       	push   $0xfdf
+ d2f:	53                   	push   %ebx
+ d30:	e8 5b f3 ff ff       	call   90 <strcmp>
+ d35:	83 c4 10             	add    $0x10,%esp
+ d38:	85 c0                	test   %eax,%eax
+ d3a:	74 58                	je     d94 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+ d3c:	8b 45 14             	mov    0x14(%ebp),%eax
+ d3f:	85 c0                	test   %eax,%eax
+ d41:	74 2a                	je     d6d <modern_consume_flags+0x6d>
+ d43:	83 ec 08             	sub    $0x8,%esp
+ d46:	68 f7 0f 00 00       	push   $0xff7
+ d4b:	53                   	push   %ebx
+ d4c:	e8 3f f3 ff ff       	call   90 <strcmp>
+ d51:	83 c4 10             	add    $0x10,%esp
+ d54:	85 c0                	test   %eax,%eax
+ d56:	74 28                	je     d80 <modern_consume_flags+0x80>
+ d58:	83 ec 08             	sub    $0x8,%esp
+ d5b:	68 fa 0f 00 00       	push   $0xffa
+ d60:	53                   	push   %ebx
+ d61:	e8 2a f3 ff ff       	call   90 <strcmp>
+ d66:	83 c4 10             	add    $0x10,%esp
+ d69:	85 c0                	test   %eax,%eax
+ d6b:	74 13                	je     d80 <modern_consume_flags+0x80>
+}
+ d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d70:	89 f8                	mov    %edi,%eax
+ d72:	5b                   	pop    %ebx
+ d73:	5e                   	pop    %esi
+ d74:	5f                   	pop    %edi
+ d75:	5d                   	pop    %ebp
+ d76:	c3                   	ret
+ d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+ d80:	85 f6                	test   %esi,%esi
+ d82:	74 06                	je     d8a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+ d84:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+ d8a:	83 c7 01             	add    $0x1,%edi
+ d8d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ d90:	75 8f                	jne    d21 <modern_consume_flags+0x21>
+ d92:	eb d9                	jmp    d6d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+ d94:	85 f6                	test   %esi,%esi
+ d96:	74 12                	je     daa <modern_consume_flags+0xaa>
+  if(!json_mode){
+ d98:	83 3e 00             	cmpl   $0x0,(%esi)
+ d9b:	74 0d                	je     daa <modern_consume_flags+0xaa>
+ d9d:	8b 45 08             	mov    0x8(%ebp),%eax
+ da0:	e8 eb fe ff ff       	call   c90 <modern_print_version.part.0>
+      exit();
+ da5:	e8 f9 f4 ff ff       	call   2a3 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ daa:	83 ec 0c             	sub    $0xc,%esp
+ dad:	68 ea 07 00 00       	push   $0x7ea
+ db2:	68 c2 0f 00 00       	push   $0xfc2
+ db7:	ff 75 08             	push   0x8(%ebp)
+ dba:	68 e9 0f 00 00       	push   $0xfe9
+ dbf:	6a 01                	push   $0x1
+ dc1:	e8 8a f6 ff ff       	call   450 <printf>
+}
+ dc6:	83 c4 20             	add    $0x20,%esp
+ dc9:	eb da                	jmp    da5 <modern_consume_flags+0xa5>
+ dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dcf:	90                   	nop
+
+00000dd0 <modern_print_version>:
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+ dd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+ dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+ ddc:	85 d2                	test   %edx,%edx
+ dde:	74 10                	je     df0 <modern_print_version+0x20>
+}
+ de0:	c9                   	leave
+ de1:	e9 aa fe ff ff       	jmp    c90 <modern_print_version.part.0>
+ de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	68 ea 07 00 00       	push   $0x7ea
+ df8:	68 c2 0f 00 00       	push   $0xfc2
+ dfd:	50                   	push   %eax
+ dfe:	68 e9 0f 00 00       	push   $0xfe9
+ e03:	6a 01                	push   $0x1
+ e05:	e8 46 f6 ff ff       	call   450 <printf>
+}
+ e0a:	83 c4 20             	add    $0x20,%esp
+}
+ e0d:	c9                   	leave
+ e0e:	c3                   	ret
+ e0f:	90                   	nop
+
+00000e10 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+ e10:	55                   	push   %ebp
+ e11:	89 e5                	mov    %esp,%ebp
+ e13:	57                   	push   %edi
+ e14:	56                   	push   %esi
+ e15:	53                   	push   %ebx
+ e16:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+ e1c:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+ e1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ e22:	8b 45 10             	mov    0x10(%ebp),%eax
+ e25:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+ e28:	85 d2                	test   %edx,%edx
+ e2a:	75 44                	jne    e70 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+ e2c:	85 f6                	test   %esi,%esi
+ e2e:	ba 01 10 00 00       	mov    $0x1001,%edx
+ e33:	0f 44 f2             	cmove  %edx,%esi
+ e36:	85 c0                	test   %eax,%eax
+ e38:	ba f6 0f 00 00       	mov    $0xff6,%edx
+ e3d:	0f 44 c2             	cmove  %edx,%eax
+ e40:	85 db                	test   %ebx,%ebx
+ e42:	ba 06 10 00 00       	mov    $0x1006,%edx
+ e47:	0f 44 da             	cmove  %edx,%ebx
+ e4a:	83 ec 08             	sub    $0x8,%esp
+ e4d:	56                   	push   %esi
+ e4e:	50                   	push   %eax
+ e4f:	53                   	push   %ebx
+ e50:	ff 75 08             	push   0x8(%ebp)
+ e53:	68 0c 10 00 00       	push   $0x100c
+ e58:	6a 01                	push   $0x1
+ e5a:	e8 f1 f5 ff ff       	call   450 <printf>
+ e5f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+ e62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e65:	5b                   	pop    %ebx
+ e66:	5e                   	pop    %esi
+ e67:	5f                   	pop    %edi
+ e68:	5d                   	pop    %ebp
+ e69:	c3                   	ret
+ e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+ e70:	83 ec 08             	sub    $0x8,%esp
+ e73:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+ e79:	89 45 10             	mov    %eax,0x10(%ebp)
+ e7c:	6a 01                	push   $0x1
+ e7e:	57                   	push   %edi
+ e7f:	e8 2c fa ff ff       	call   8b0 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ e84:	83 c4 0c             	add    $0xc,%esp
+ e87:	ff 75 08             	push   0x8(%ebp)
+ e8a:	68 ba 0f 00 00       	push   $0xfba
+ e8f:	57                   	push   %edi
+ e90:	e8 4b fa ff ff       	call   8e0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+ e95:	83 c4 0c             	add    $0xc,%esp
+ e98:	ba 06 10 00 00       	mov    $0x1006,%edx
+ e9d:	85 db                	test   %ebx,%ebx
+ e9f:	0f 44 da             	cmove  %edx,%ebx
+ ea2:	53                   	push   %ebx
+ ea3:	52                   	push   %edx
+ ea4:	57                   	push   %edi
+ ea5:	e8 36 fa ff ff       	call   8e0 <struct_field_str>
+  if(target)
+ eaa:	8b 45 10             	mov    0x10(%ebp),%eax
+ ead:	83 c4 10             	add    $0x10,%esp
+ eb0:	85 c0                	test   %eax,%eax
+ eb2:	74 12                	je     ec6 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+ eb4:	83 ec 04             	sub    $0x4,%esp
+ eb7:	50                   	push   %eax
+ eb8:	68 1a 10 00 00       	push   $0x101a
+ ebd:	57                   	push   %edi
+ ebe:	e8 1d fa ff ff       	call   8e0 <struct_field_str>
+ ec3:	83 c4 10             	add    $0x10,%esp
+  if(status)
+ ec6:	85 f6                	test   %esi,%esi
+ ec8:	74 12                	je     edc <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+ eca:	83 ec 04             	sub    $0x4,%esp
+ ecd:	56                   	push   %esi
+ ece:	68 21 10 00 00       	push   $0x1021
+ ed3:	57                   	push   %edi
+ ed4:	e8 07 fa ff ff       	call   8e0 <struct_field_str>
+ ed9:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+ edc:	83 ec 0c             	sub    $0xc,%esp
+ edf:	57                   	push   %edi
+ ee0:	e8 bb fc ff ff       	call   ba0 <struct_end>
+ ee5:	83 c4 10             	add    $0x10,%esp
+}
+ ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ eeb:	5b                   	pop    %ebx
+ eec:	5e                   	pop    %esi
+ eed:	5f                   	pop    %edi
+ eee:	5d                   	pop    %ebp
+ eef:	c3                   	ret
@@ -0,0 +1,2585 @@
+
+build/bin/user/_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 14             	sub    $0x14,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i = modern_consume_flags("ls", argc, argv, 1, &json_mode);
+      19:	68 a4 1a 00 00       	push   $0x1aa4
+      1e:	6a 01                	push   $0x1
+      20:	57                   	push   %edi
+      21:	56                   	push   %esi
+      22:	68 1c 14 00 00       	push   $0x141c
+      27:	e8 94 11 00 00       	call   11c0 <modern_consume_flags>
+
+  if(i >= argc){
+      2c:	83 c4 20             	add    $0x20,%esp
+      2f:	89 c3                	mov    %eax,%ebx
+      31:	39 c6                	cmp    %eax,%esi
+      33:	7e 1d                	jle    52 <main+0x52>
+      35:	8d 76 00             	lea    0x0(%esi),%esi
+    ls(".");
+    exit();
+  }
+  for(; i<argc; i++)
+    ls(argv[i]);
+      38:	83 ec 0c             	sub    $0xc,%esp
+      3b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(; i<argc; i++)
+      3e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      41:	e8 ca 01 00 00       	call   210 <ls>
+  for(; i<argc; i++)
+      46:	83 c4 10             	add    $0x10,%esp
+      49:	39 de                	cmp    %ebx,%esi
+      4b:	75 eb                	jne    38 <main+0x38>
+  exit();
+      4d:	e8 11 07 00 00       	call   763 <exit>
+    ls(".");
+      52:	83 ec 0c             	sub    $0xc,%esp
+      55:	68 07 14 00 00       	push   $0x1407
+      5a:	e8 b1 01 00 00       	call   210 <ls>
+    exit();
+      5f:	e8 ff 06 00 00       	call   763 <exit>
+      64:	66 90                	xchg   %ax,%ax
+      66:	66 90                	xchg   %ax,%ax
+      68:	66 90                	xchg   %ax,%ax
+      6a:	66 90                	xchg   %ax,%ax
+      6c:	66 90                	xchg   %ax,%ax
+      6e:	66 90                	xchg   %ax,%ax
+
+00000070 <emit_entry.part.0>:
+emit_entry(const char *path, const char *name, struct stat *st)
+      70:	55                   	push   %ebp
+      71:	89 e5                	mov    %esp,%ebp
+      73:	57                   	push   %edi
+      74:	89 d7                	mov    %edx,%edi
+      76:	56                   	push   %esi
+      77:	89 ce                	mov    %ecx,%esi
+      79:	53                   	push   %ebx
+  struct_begin(&w, 1);
+      7a:	8d 9d 98 fe ff ff    	lea    -0x168(%ebp),%ebx
+emit_entry(const char *path, const char *name, struct stat *st)
+      80:	81 ec 74 01 00 00    	sub    $0x174,%esp
+      86:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+  struct_begin(&w, 1);
+      8c:	6a 01                	push   $0x1
+      8e:	53                   	push   %ebx
+      8f:	e8 dc 0c 00 00       	call   d70 <struct_begin>
+  struct_field_str(&w, "path", path);
+      94:	8b 85 94 fe ff ff    	mov    -0x16c(%ebp),%eax
+      9a:	83 c4 0c             	add    $0xc,%esp
+      9d:	50                   	push   %eax
+      9e:	68 b8 13 00 00       	push   $0x13b8
+      a3:	53                   	push   %ebx
+      a4:	e8 f7 0c 00 00       	call   da0 <struct_field_str>
+  struct_field_str(&w, "name", name);
+      a9:	83 c4 0c             	add    $0xc,%esp
+      ac:	57                   	push   %edi
+      ad:	68 bd 13 00 00       	push   $0x13bd
+      b2:	53                   	push   %ebx
+      b3:	e8 e8 0c 00 00       	call   da0 <struct_field_str>
+  switch(type){
+      b8:	0f b7 06             	movzwl (%esi),%eax
+      bb:	83 c4 10             	add    $0x10,%esp
+      be:	ba b0 13 00 00       	mov    $0x13b0,%edx
+      c3:	83 e8 01             	sub    $0x1,%eax
+      c6:	66 83 f8 02          	cmp    $0x2,%ax
+      ca:	77 0a                	ja     d6 <emit_entry.part.0+0x66>
+      cc:	0f b7 c0             	movzwl %ax,%eax
+      cf:	8b 14 85 30 14 00 00 	mov    0x1430(,%eax,4),%edx
+  struct_field_str(&w, "type", typestr(st->type));
+      d6:	83 ec 04             	sub    $0x4,%esp
+      d9:	52                   	push   %edx
+      da:	68 c2 13 00 00       	push   $0x13c2
+      df:	53                   	push   %ebx
+      e0:	e8 bb 0c 00 00       	call   da0 <struct_field_str>
+  struct_field_int(&w, "inode", st->ino);
+      e5:	83 c4 0c             	add    $0xc,%esp
+      e8:	ff 76 08             	push   0x8(%esi)
+      eb:	68 c7 13 00 00       	push   $0x13c7
+      f0:	53                   	push   %ebx
+      f1:	e8 7a 0e 00 00       	call   f70 <struct_field_int>
+  struct_field_int(&w, "size", st->size);
+      f6:	83 c4 0c             	add    $0xc,%esp
+      f9:	ff 76 10             	push   0x10(%esi)
+      fc:	68 cd 13 00 00       	push   $0x13cd
+     101:	53                   	push   %ebx
+     102:	e8 69 0e 00 00       	call   f70 <struct_field_int>
+  struct_end(&w);
+     107:	89 1c 24             	mov    %ebx,(%esp)
+     10a:	e8 51 0f 00 00       	call   1060 <struct_end>
+     10f:	83 c4 10             	add    $0x10,%esp
+}
+     112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     115:	5b                   	pop    %ebx
+     116:	5e                   	pop    %esi
+     117:	5f                   	pop    %edi
+     118:	5d                   	pop    %ebp
+     119:	c3                   	ret
+     11a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000120 <fmtname>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	56                   	push   %esi
+     124:	53                   	push   %ebx
+     125:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+     128:	83 ec 0c             	sub    $0xc,%esp
+     12b:	56                   	push   %esi
+     12c:	e8 7f 04 00 00       	call   5b0 <strlen>
+     131:	83 c4 10             	add    $0x10,%esp
+     134:	01 f0                	add    %esi,%eax
+     136:	89 c3                	mov    %eax,%ebx
+     138:	73 0f                	jae    149 <fmtname+0x29>
+     13a:	eb 12                	jmp    14e <fmtname+0x2e>
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     140:	8d 43 ff             	lea    -0x1(%ebx),%eax
+     143:	39 f0                	cmp    %esi,%eax
+     145:	72 0a                	jb     151 <fmtname+0x31>
+     147:	89 c3                	mov    %eax,%ebx
+     149:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+     14c:	75 f2                	jne    140 <fmtname+0x20>
+  p++;
+     14e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+     151:	83 ec 0c             	sub    $0xc,%esp
+     154:	53                   	push   %ebx
+     155:	e8 56 04 00 00       	call   5b0 <strlen>
+     15a:	83 c4 10             	add    $0x10,%esp
+     15d:	83 f8 0d             	cmp    $0xd,%eax
+     160:	77 4a                	ja     1ac <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+     162:	83 ec 0c             	sub    $0xc,%esp
+     165:	53                   	push   %ebx
+     166:	e8 45 04 00 00       	call   5b0 <strlen>
+     16b:	83 c4 0c             	add    $0xc,%esp
+     16e:	50                   	push   %eax
+     16f:	53                   	push   %ebx
+     170:	68 94 1a 00 00       	push   $0x1a94
+     175:	e8 b6 05 00 00       	call   730 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+     17a:	89 1c 24             	mov    %ebx,(%esp)
+     17d:	e8 2e 04 00 00       	call   5b0 <strlen>
+     182:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+     185:	bb 94 1a 00 00       	mov    $0x1a94,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+     18a:	89 c6                	mov    %eax,%esi
+     18c:	e8 1f 04 00 00       	call   5b0 <strlen>
+     191:	ba 0e 00 00 00       	mov    $0xe,%edx
+     196:	83 c4 0c             	add    $0xc,%esp
+     199:	29 f2                	sub    %esi,%edx
+     19b:	05 94 1a 00 00       	add    $0x1a94,%eax
+     1a0:	52                   	push   %edx
+     1a1:	6a 20                	push   $0x20
+     1a3:	50                   	push   %eax
+     1a4:	e8 37 04 00 00       	call   5e0 <memset>
+  return buf;
+     1a9:	83 c4 10             	add    $0x10,%esp
+}
+     1ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1af:	89 d8                	mov    %ebx,%eax
+     1b1:	5b                   	pop    %ebx
+     1b2:	5e                   	pop    %esi
+     1b3:	5d                   	pop    %ebp
+     1b4:	c3                   	ret
+     1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <emit_entry>:
+  if(!json_mode){
+     1c0:	83 3d a4 1a 00 00 00 	cmpl   $0x0,0x1aa4
+     1c7:	74 07                	je     1d0 <emit_entry+0x10>
+     1c9:	e9 a2 fe ff ff       	jmp    70 <emit_entry.part.0>
+     1ce:	66 90                	xchg   %ax,%ax
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	57                   	push   %edi
+     1d4:	56                   	push   %esi
+     1d5:	53                   	push   %ebx
+     1d6:	83 ec 18             	sub    $0x18,%esp
+    printf(1, "%s %d %d %d\n", fmtname((char*)path), st->type, st->ino, st->size);
+     1d9:	8b 71 10             	mov    0x10(%ecx),%esi
+     1dc:	8b 59 08             	mov    0x8(%ecx),%ebx
+     1df:	0f bf 39             	movswl (%ecx),%edi
+     1e2:	50                   	push   %eax
+     1e3:	e8 38 ff ff ff       	call   120 <fmtname>
+     1e8:	5a                   	pop    %edx
+     1e9:	59                   	pop    %ecx
+     1ea:	56                   	push   %esi
+     1eb:	53                   	push   %ebx
+     1ec:	57                   	push   %edi
+     1ed:	50                   	push   %eax
+     1ee:	68 d2 13 00 00       	push   $0x13d2
+     1f3:	6a 01                	push   $0x1
+     1f5:	e8 16 07 00 00       	call   910 <printf>
+     1fa:	83 c4 20             	add    $0x20,%esp
+}
+     1fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     200:	5b                   	pop    %ebx
+     201:	5e                   	pop    %esi
+     202:	5f                   	pop    %edi
+     203:	5d                   	pop    %ebp
+     204:	c3                   	ret
+     205:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <ls>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	57                   	push   %edi
+     214:	56                   	push   %esi
+     215:	53                   	push   %ebx
+     216:	81 ec c4 03 00 00    	sub    $0x3c4,%esp
+     21c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((fd = open(path, 0)) < 0){
+     21f:	6a 00                	push   $0x0
+     221:	53                   	push   %ebx
+     222:	e8 7c 05 00 00       	call   7a3 <open>
+     227:	83 c4 10             	add    $0x10,%esp
+     22a:	89 85 38 fc ff ff    	mov    %eax,-0x3c8(%ebp)
+     230:	85 c0                	test   %eax,%eax
+     232:	0f 88 20 02 00 00    	js     458 <ls+0x248>
+  if(fstat(fd, &st) < 0){
+     238:	83 ec 08             	sub    $0x8,%esp
+     23b:	8d 85 54 fc ff ff    	lea    -0x3ac(%ebp),%eax
+     241:	50                   	push   %eax
+     242:	ff b5 38 fc ff ff    	push   -0x3c8(%ebp)
+     248:	e8 6e 05 00 00       	call   7bb <fstat>
+     24d:	83 c4 10             	add    $0x10,%esp
+     250:	85 c0                	test   %eax,%eax
+     252:	0f 88 38 02 00 00    	js     490 <ls+0x280>
+  switch(st.type){
+     258:	0f b7 85 54 fc ff ff 	movzwl -0x3ac(%ebp),%eax
+     25f:	66 83 f8 01          	cmp    $0x1,%ax
+     263:	0f 84 e7 00 00 00    	je     350 <ls+0x140>
+     269:	66 83 f8 02          	cmp    $0x2,%ax
+     26d:	74 21                	je     290 <ls+0x80>
+  close(fd);
+     26f:	83 ec 0c             	sub    $0xc,%esp
+     272:	ff b5 38 fc ff ff    	push   -0x3c8(%ebp)
+     278:	e8 0e 05 00 00       	call   78b <close>
+     27d:	83 c4 10             	add    $0x10,%esp
+}
+     280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     283:	5b                   	pop    %ebx
+     284:	5e                   	pop    %esi
+     285:	5f                   	pop    %edi
+     286:	5d                   	pop    %ebp
+     287:	c3                   	ret
+     288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+  const char *start = path + strlen(path);
+     290:	83 ec 0c             	sub    $0xc,%esp
+     293:	53                   	push   %ebx
+     294:	e8 17 03 00 00       	call   5b0 <strlen>
+  while(p > path && *(p-1) == '/')
+     299:	83 c4 10             	add    $0x10,%esp
+  const char *start = path + strlen(path);
+     29c:	01 d8                	add    %ebx,%eax
+  while(p > path && *(p-1) == '/')
+     29e:	39 c3                	cmp    %eax,%ebx
+     2a0:	72 35                	jb     2d7 <ls+0xc7>
+     2a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  memmove(dst, start, len);
+     2a8:	83 ec 04             	sub    $0x4,%esp
+     2ab:	6a 00                	push   $0x0
+     2ad:	50                   	push   %eax
+     2ae:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     2b4:	89 85 40 fc ff ff    	mov    %eax,-0x3c0(%ebp)
+     2ba:	50                   	push   %eax
+     2bb:	e8 70 04 00 00       	call   730 <memmove>
+  dst[len] = '\0';
+     2c0:	c6 85 e8 fd ff ff 00 	movb   $0x0,-0x218(%ebp)
+     2c7:	83 c4 10             	add    $0x10,%esp
+     2ca:	e9 1b 02 00 00       	jmp    4ea <ls+0x2da>
+     2cf:	90                   	nop
+    p--;
+     2d0:	83 e8 01             	sub    $0x1,%eax
+  while(p > path && *(p-1) == '/')
+     2d3:	39 c3                	cmp    %eax,%ebx
+     2d5:	74 d1                	je     2a8 <ls+0x98>
+     2d7:	80 78 ff 2f          	cmpb   $0x2f,-0x1(%eax)
+     2db:	74 f3                	je     2d0 <ls+0xc0>
+  while(start > path && *(start-1) != '/')
+     2dd:	39 c3                	cmp    %eax,%ebx
+     2df:	73 c7                	jae    2a8 <ls+0x98>
+     2e1:	89 c2                	mov    %eax,%edx
+     2e3:	eb 0a                	jmp    2ef <ls+0xdf>
+     2e5:	8d 76 00             	lea    0x0(%esi),%esi
+    start--;
+     2e8:	83 ea 01             	sub    $0x1,%edx
+  while(start > path && *(start-1) != '/')
+     2eb:	39 d3                	cmp    %edx,%ebx
+     2ed:	74 06                	je     2f5 <ls+0xe5>
+     2ef:	80 7a ff 2f          	cmpb   $0x2f,-0x1(%edx)
+     2f3:	75 f3                	jne    2e8 <ls+0xd8>
+  int len = p - start;
+     2f5:	29 d0                	sub    %edx,%eax
+     2f7:	89 c6                	mov    %eax,%esi
+  if(len >= dstsz)
+     2f9:	83 f8 0e             	cmp    $0xe,%eax
+     2fc:	0f 8e be 01 00 00    	jle    4c0 <ls+0x2b0>
+  memmove(dst, start, len);
+     302:	83 ec 04             	sub    $0x4,%esp
+     305:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     30b:	6a 0e                	push   $0xe
+     30d:	52                   	push   %edx
+     30e:	89 85 40 fc ff ff    	mov    %eax,-0x3c0(%ebp)
+     314:	50                   	push   %eax
+     315:	e8 16 04 00 00       	call   730 <memmove>
+  dst[len] = '\0';
+     31a:	c6 85 f6 fd ff ff 00 	movb   $0x0,-0x20a(%ebp)
+     321:	83 c4 10             	add    $0x10,%esp
+      emit_entry(path, json_mode ? namebuf : fmtname(path), &st);
+     324:	a1 a4 1a 00 00       	mov    0x1aa4,%eax
+     329:	8b 95 40 fc ff ff    	mov    -0x3c0(%ebp),%edx
+     32f:	85 c0                	test   %eax,%eax
+     331:	0f 84 ce 01 00 00    	je     505 <ls+0x2f5>
+     337:	8d 8d 54 fc ff ff    	lea    -0x3ac(%ebp),%ecx
+     33d:	89 d8                	mov    %ebx,%eax
+     33f:	e8 7c fe ff ff       	call   1c0 <emit_entry>
+    break;
+     344:	e9 26 ff ff ff       	jmp    26f <ls+0x5f>
+     349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     350:	83 ec 0c             	sub    $0xc,%esp
+     353:	53                   	push   %ebx
+     354:	e8 57 02 00 00       	call   5b0 <strlen>
+     359:	83 c4 10             	add    $0x10,%esp
+     35c:	83 c0 10             	add    $0x10,%eax
+     35f:	3d 00 02 00 00       	cmp    $0x200,%eax
+     364:	0f 87 0e 01 00 00    	ja     478 <ls+0x268>
+    strcpy(buf, path);
+     36a:	83 ec 08             	sub    $0x8,%esp
+     36d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     373:	53                   	push   %ebx
+     374:	89 c6                	mov    %eax,%esi
+     376:	89 85 40 fc ff ff    	mov    %eax,-0x3c0(%ebp)
+     37c:	50                   	push   %eax
+     37d:	e8 9e 01 00 00       	call   520 <strcpy>
+    p = buf+strlen(buf);
+     382:	89 34 24             	mov    %esi,(%esp)
+     385:	e8 26 02 00 00       	call   5b0 <strlen>
+    while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+     38a:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     38d:	01 f0                	add    %esi,%eax
+     38f:	89 85 3c fc ff ff    	mov    %eax,-0x3c4(%ebp)
+    *p++ = '/';
+     395:	8d 78 01             	lea    0x1(%eax),%edi
+     398:	c6 00 2f             	movb   $0x2f,(%eax)
+    while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+     39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     39f:	90                   	nop
+     3a0:	8d 85 68 fc ff ff    	lea    -0x398(%ebp),%eax
+     3a6:	6a 01                	push   $0x1
+     3a8:	68 80 01 00 00       	push   $0x180
+     3ad:	50                   	push   %eax
+     3ae:	ff b5 38 fc ff ff    	push   -0x3c8(%ebp)
+     3b4:	e8 82 04 00 00       	call   83b <getdents>
+     3b9:	83 c4 10             	add    $0x10,%esp
+     3bc:	89 c1                	mov    %eax,%ecx
+     3be:	85 c0                	test   %eax,%eax
+     3c0:	0f 8e a9 fe ff ff    	jle    26f <ls+0x5f>
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     3c6:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+     3cb:	8d 9d 6a fc ff ff    	lea    -0x396(%ebp),%ebx
+     3d1:	31 f6                	xor    %esi,%esi
+     3d3:	f7 e1                	mul    %ecx
+     3d5:	c1 ea 04             	shr    $0x4,%edx
+     3d8:	89 95 44 fc ff ff    	mov    %edx,-0x3bc(%ebp)
+     3de:	83 f9 17             	cmp    $0x17,%ecx
+     3e1:	76 bd                	jbe    3a0 <ls+0x190>
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+        memmove(p, de[i].name, DIRSIZ);
+     3e8:	83 ec 04             	sub    $0x4,%esp
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     3eb:	83 c6 01             	add    $0x1,%esi
+        memmove(p, de[i].name, DIRSIZ);
+     3ee:	6a 0e                	push   $0xe
+     3f0:	53                   	push   %ebx
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     3f1:	83 c3 18             	add    $0x18,%ebx
+        memmove(p, de[i].name, DIRSIZ);
+     3f4:	57                   	push   %edi
+     3f5:	e8 36 03 00 00       	call   730 <memmove>
+        p[DIRSIZ] = 0;
+     3fa:	8b 85 3c fc ff ff    	mov    -0x3c4(%ebp),%eax
+        emit_entry(buf, p, &st);
+     400:	8d 8d 54 fc ff ff    	lea    -0x3ac(%ebp),%ecx
+     406:	89 fa                	mov    %edi,%edx
+        p[DIRSIZ] = 0;
+     408:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+        st.type = de[i].type;
+     40c:	0f b7 43 f6          	movzwl -0xa(%ebx),%eax
+     410:	66 89 85 54 fc ff ff 	mov    %ax,-0x3ac(%ebp)
+        st.ino = de[i].inum;
+     417:	0f b7 43 e6          	movzwl -0x1a(%ebx),%eax
+     41b:	89 85 5c fc ff ff    	mov    %eax,-0x3a4(%ebp)
+        st.nlink = de[i].nlink;
+     421:	0f b7 43 f8          	movzwl -0x8(%ebx),%eax
+     425:	66 89 85 60 fc ff ff 	mov    %ax,-0x3a0(%ebp)
+        st.size = de[i].size;
+     42c:	8b 43 fa             	mov    -0x6(%ebx),%eax
+     42f:	89 85 64 fc ff ff    	mov    %eax,-0x39c(%ebp)
+        emit_entry(buf, p, &st);
+     435:	8b 85 40 fc ff ff    	mov    -0x3c0(%ebp),%eax
+     43b:	e8 80 fd ff ff       	call   1c0 <emit_entry>
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     440:	8b 85 44 fc ff ff    	mov    -0x3bc(%ebp),%eax
+     446:	83 c4 10             	add    $0x10,%esp
+     449:	39 c6                	cmp    %eax,%esi
+     44b:	72 9b                	jb     3e8 <ls+0x1d8>
+     44d:	e9 4e ff ff ff       	jmp    3a0 <ls+0x190>
+     452:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     458:	83 ec 04             	sub    $0x4,%esp
+     45b:	53                   	push   %ebx
+     45c:	68 df 13 00 00       	push   $0x13df
+     461:	6a 02                	push   $0x2
+     463:	e8 a8 04 00 00       	call   910 <printf>
+    return;
+     468:	83 c4 10             	add    $0x10,%esp
+}
+     46b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     46e:	5b                   	pop    %ebx
+     46f:	5e                   	pop    %esi
+     470:	5f                   	pop    %edi
+     471:	5d                   	pop    %ebp
+     472:	c3                   	ret
+     473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     477:	90                   	nop
+      printf(1, "ls: path too long\n");
+     478:	83 ec 08             	sub    $0x8,%esp
+     47b:	68 09 14 00 00       	push   $0x1409
+     480:	6a 01                	push   $0x1
+     482:	e8 89 04 00 00       	call   910 <printf>
+      break;
+     487:	83 c4 10             	add    $0x10,%esp
+     48a:	e9 e0 fd ff ff       	jmp    26f <ls+0x5f>
+     48f:	90                   	nop
+    printf(2, "ls: cannot stat %s\n", path);
+     490:	83 ec 04             	sub    $0x4,%esp
+     493:	53                   	push   %ebx
+     494:	68 f3 13 00 00       	push   $0x13f3
+     499:	6a 02                	push   $0x2
+     49b:	e8 70 04 00 00       	call   910 <printf>
+    close(fd);
+     4a0:	5a                   	pop    %edx
+     4a1:	ff b5 38 fc ff ff    	push   -0x3c8(%ebp)
+     4a7:	e8 df 02 00 00       	call   78b <close>
+    return;
+     4ac:	83 c4 10             	add    $0x10,%esp
+}
+     4af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4b2:	5b                   	pop    %ebx
+     4b3:	5e                   	pop    %esi
+     4b4:	5f                   	pop    %edi
+     4b5:	5d                   	pop    %ebp
+     4b6:	c3                   	ret
+     4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4be:	66 90                	xchg   %ax,%ax
+  memmove(dst, start, len);
+     4c0:	83 ec 04             	sub    $0x4,%esp
+     4c3:	50                   	push   %eax
+     4c4:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     4ca:	52                   	push   %edx
+     4cb:	89 85 40 fc ff ff    	mov    %eax,-0x3c0(%ebp)
+     4d1:	50                   	push   %eax
+     4d2:	e8 59 02 00 00       	call   730 <memmove>
+  dst[len] = '\0';
+     4d7:	c6 84 35 e8 fd ff ff 	movb   $0x0,-0x218(%ebp,%esi,1)
+     4de:	00 
+  if(len == 0 && dstsz > 1)
+     4df:	83 c4 10             	add    $0x10,%esp
+     4e2:	85 f6                	test   %esi,%esi
+     4e4:	0f 85 3a fe ff ff    	jne    324 <ls+0x114>
+    strcpy(dst, ".");
+     4ea:	83 ec 08             	sub    $0x8,%esp
+     4ed:	68 07 14 00 00       	push   $0x1407
+     4f2:	ff b5 40 fc ff ff    	push   -0x3c0(%ebp)
+     4f8:	e8 23 00 00 00       	call   520 <strcpy>
+     4fd:	83 c4 10             	add    $0x10,%esp
+     500:	e9 1f fe ff ff       	jmp    324 <ls+0x114>
+      emit_entry(path, json_mode ? namebuf : fmtname(path), &st);
+     505:	83 ec 0c             	sub    $0xc,%esp
+     508:	53                   	push   %ebx
+     509:	e8 12 fc ff ff       	call   120 <fmtname>
+     50e:	83 c4 10             	add    $0x10,%esp
+     511:	89 c2                	mov    %eax,%edx
+     513:	e9 1f fe ff ff       	jmp    337 <ls+0x127>
+     518:	66 90                	xchg   %ax,%ax
+     51a:	66 90                	xchg   %ax,%ax
+     51c:	66 90                	xchg   %ax,%ax
+     51e:	66 90                	xchg   %ax,%ax
+
+00000520 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     520:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     521:	31 c0                	xor    %eax,%eax
+{
+     523:	89 e5                	mov    %esp,%ebp
+     525:	53                   	push   %ebx
+     526:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     529:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     530:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     534:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     537:	83 c0 01             	add    $0x1,%eax
+     53a:	84 d2                	test   %dl,%dl
+     53c:	75 f2                	jne    530 <strcpy+0x10>
+    ;
+  return os;
+}
+     53e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     541:	89 c8                	mov    %ecx,%eax
+     543:	c9                   	leave
+     544:	c3                   	ret
+     545:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	53                   	push   %ebx
+     554:	8b 55 08             	mov    0x8(%ebp),%edx
+     557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     55a:	0f b6 02             	movzbl (%edx),%eax
+     55d:	84 c0                	test   %al,%al
+     55f:	75 17                	jne    578 <strcmp+0x28>
+     561:	eb 3a                	jmp    59d <strcmp+0x4d>
+     563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     567:	90                   	nop
+     568:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     56c:	83 c2 01             	add    $0x1,%edx
+     56f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     572:	84 c0                	test   %al,%al
+     574:	74 1a                	je     590 <strcmp+0x40>
+    p++, q++;
+     576:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     578:	0f b6 19             	movzbl (%ecx),%ebx
+     57b:	38 c3                	cmp    %al,%bl
+     57d:	74 e9                	je     568 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     57f:	29 d8                	sub    %ebx,%eax
+}
+     581:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     584:	c9                   	leave
+     585:	c3                   	ret
+     586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     590:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     594:	31 c0                	xor    %eax,%eax
+     596:	29 d8                	sub    %ebx,%eax
+}
+     598:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     59b:	c9                   	leave
+     59c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     59d:	0f b6 19             	movzbl (%ecx),%ebx
+     5a0:	31 c0                	xor    %eax,%eax
+     5a2:	eb db                	jmp    57f <strcmp+0x2f>
+     5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5af:	90                   	nop
+
+000005b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     5b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     5b9:	74 15                	je     5d0 <strlen+0x20>
+     5bb:	31 c0                	xor    %eax,%eax
+     5bd:	8d 76 00             	lea    0x0(%esi),%esi
+     5c0:	83 c0 01             	add    $0x1,%eax
+     5c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     5c7:	89 c1                	mov    %eax,%ecx
+     5c9:	75 f5                	jne    5c0 <strlen+0x10>
+    ;
+  return n;
+}
+     5cb:	89 c8                	mov    %ecx,%eax
+     5cd:	5d                   	pop    %ebp
+     5ce:	c3                   	ret
+     5cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     5d0:	31 c9                	xor    %ecx,%ecx
+}
+     5d2:	5d                   	pop    %ebp
+     5d3:	89 c8                	mov    %ecx,%eax
+     5d5:	c3                   	ret
+     5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     5e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     5ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ed:	89 d7                	mov    %edx,%edi
+     5ef:	fc                   	cld
+     5f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     5f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     5f5:	89 d0                	mov    %edx,%eax
+     5f7:	c9                   	leave
+     5f8:	c3                   	ret
+     5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	8b 45 08             	mov    0x8(%ebp),%eax
+     606:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     60a:	0f b6 10             	movzbl (%eax),%edx
+     60d:	84 d2                	test   %dl,%dl
+     60f:	75 12                	jne    623 <strchr+0x23>
+     611:	eb 1d                	jmp    630 <strchr+0x30>
+     613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     617:	90                   	nop
+     618:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     61c:	83 c0 01             	add    $0x1,%eax
+     61f:	84 d2                	test   %dl,%dl
+     621:	74 0d                	je     630 <strchr+0x30>
+    if(*s == c)
+     623:	38 d1                	cmp    %dl,%cl
+     625:	75 f1                	jne    618 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     627:	5d                   	pop    %ebp
+     628:	c3                   	ret
+     629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     630:	31 c0                	xor    %eax,%eax
+}
+     632:	5d                   	pop    %ebp
+     633:	c3                   	ret
+     634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     63f:	90                   	nop
+
+00000640 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	57                   	push   %edi
+     644:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     645:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     648:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     649:	31 db                	xor    %ebx,%ebx
+{
+     64b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     64e:	eb 27                	jmp    677 <gets+0x37>
+    cc = read(0, &c, 1);
+     650:	83 ec 04             	sub    $0x4,%esp
+     653:	6a 01                	push   $0x1
+     655:	56                   	push   %esi
+     656:	6a 00                	push   $0x0
+     658:	e8 1e 01 00 00       	call   77b <read>
+    if(cc < 1)
+     65d:	83 c4 10             	add    $0x10,%esp
+     660:	85 c0                	test   %eax,%eax
+     662:	7e 1d                	jle    681 <gets+0x41>
+      break;
+    buf[i++] = c;
+     664:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     668:	8b 55 08             	mov    0x8(%ebp),%edx
+     66b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     66f:	3c 0a                	cmp    $0xa,%al
+     671:	74 10                	je     683 <gets+0x43>
+     673:	3c 0d                	cmp    $0xd,%al
+     675:	74 0c                	je     683 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     677:	89 df                	mov    %ebx,%edi
+     679:	83 c3 01             	add    $0x1,%ebx
+     67c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     67f:	7c cf                	jl     650 <gets+0x10>
+     681:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     683:	8b 45 08             	mov    0x8(%ebp),%eax
+     686:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     68a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     68d:	5b                   	pop    %ebx
+     68e:	5e                   	pop    %esi
+     68f:	5f                   	pop    %edi
+     690:	5d                   	pop    %ebp
+     691:	c3                   	ret
+     692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	56                   	push   %esi
+     6a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     6a5:	83 ec 08             	sub    $0x8,%esp
+     6a8:	6a 00                	push   $0x0
+     6aa:	ff 75 08             	push   0x8(%ebp)
+     6ad:	e8 f1 00 00 00       	call   7a3 <open>
+  if(fd < 0)
+     6b2:	83 c4 10             	add    $0x10,%esp
+     6b5:	85 c0                	test   %eax,%eax
+     6b7:	78 27                	js     6e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     6b9:	83 ec 08             	sub    $0x8,%esp
+     6bc:	ff 75 0c             	push   0xc(%ebp)
+     6bf:	89 c3                	mov    %eax,%ebx
+     6c1:	50                   	push   %eax
+     6c2:	e8 f4 00 00 00       	call   7bb <fstat>
+  close(fd);
+     6c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     6ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+     6cc:	e8 ba 00 00 00       	call   78b <close>
+  return r;
+     6d1:	83 c4 10             	add    $0x10,%esp
+}
+     6d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6d7:	89 f0                	mov    %esi,%eax
+     6d9:	5b                   	pop    %ebx
+     6da:	5e                   	pop    %esi
+     6db:	5d                   	pop    %ebp
+     6dc:	c3                   	ret
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     6e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6e5:	eb ed                	jmp    6d4 <stat+0x34>
+     6e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ee:	66 90                	xchg   %ax,%ax
+
+000006f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	53                   	push   %ebx
+     6f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     6f7:	0f be 02             	movsbl (%edx),%eax
+     6fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     6fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     705:	77 1e                	ja     725 <atoi+0x35>
+     707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     710:	83 c2 01             	add    $0x1,%edx
+     713:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     716:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     71a:	0f be 02             	movsbl (%edx),%eax
+     71d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     720:	80 fb 09             	cmp    $0x9,%bl
+     723:	76 eb                	jbe    710 <atoi+0x20>
+  return n;
+}
+     725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     728:	89 c8                	mov    %ecx,%eax
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+     72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	57                   	push   %edi
+     734:	56                   	push   %esi
+     735:	8b 45 10             	mov    0x10(%ebp),%eax
+     738:	8b 55 08             	mov    0x8(%ebp),%edx
+     73b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     73e:	85 c0                	test   %eax,%eax
+     740:	7e 13                	jle    755 <memmove+0x25>
+     742:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     744:	89 d7                	mov    %edx,%edi
+     746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     750:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     751:	39 f8                	cmp    %edi,%eax
+     753:	75 fb                	jne    750 <memmove+0x20>
+  return vdst;
+}
+     755:	5e                   	pop    %esi
+     756:	89 d0                	mov    %edx,%eax
+     758:	5f                   	pop    %edi
+     759:	5d                   	pop    %ebp
+     75a:	c3                   	ret
+
+0000075b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     75b:	b8 01 00 00 00       	mov    $0x1,%eax
+     760:	cd 40                	int    $0x40
+     762:	c3                   	ret
+
+00000763 <exit>:
+SYSCALL(exit)
+     763:	b8 02 00 00 00       	mov    $0x2,%eax
+     768:	cd 40                	int    $0x40
+     76a:	c3                   	ret
+
+0000076b <wait>:
+SYSCALL(wait)
+     76b:	b8 03 00 00 00       	mov    $0x3,%eax
+     770:	cd 40                	int    $0x40
+     772:	c3                   	ret
+
+00000773 <pipe>:
+SYSCALL(pipe)
+     773:	b8 04 00 00 00       	mov    $0x4,%eax
+     778:	cd 40                	int    $0x40
+     77a:	c3                   	ret
+
+0000077b <read>:
+SYSCALL(read)
+     77b:	b8 05 00 00 00       	mov    $0x5,%eax
+     780:	cd 40                	int    $0x40
+     782:	c3                   	ret
+
+00000783 <write>:
+SYSCALL(write)
+     783:	b8 10 00 00 00       	mov    $0x10,%eax
+     788:	cd 40                	int    $0x40
+     78a:	c3                   	ret
+
+0000078b <close>:
+SYSCALL(close)
+     78b:	b8 15 00 00 00       	mov    $0x15,%eax
+     790:	cd 40                	int    $0x40
+     792:	c3                   	ret
+
+00000793 <kill>:
+SYSCALL(kill)
+     793:	b8 06 00 00 00       	mov    $0x6,%eax
+     798:	cd 40                	int    $0x40
+     79a:	c3                   	ret
+
+0000079b <exec>:
+SYSCALL(exec)
+     79b:	b8 07 00 00 00       	mov    $0x7,%eax
+     7a0:	cd 40                	int    $0x40
+     7a2:	c3                   	ret
+
+000007a3 <open>:
+SYSCALL(open)
+     7a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7a8:	cd 40                	int    $0x40
+     7aa:	c3                   	ret
+
+000007ab <mknod>:
+SYSCALL(mknod)
+     7ab:	b8 11 00 00 00       	mov    $0x11,%eax
+     7b0:	cd 40                	int    $0x40
+     7b2:	c3                   	ret
+
+000007b3 <unlink>:
+SYSCALL(unlink)
+     7b3:	b8 12 00 00 00       	mov    $0x12,%eax
+     7b8:	cd 40                	int    $0x40
+     7ba:	c3                   	ret
+
+000007bb <fstat>:
+SYSCALL(fstat)
+     7bb:	b8 08 00 00 00       	mov    $0x8,%eax
+     7c0:	cd 40                	int    $0x40
+     7c2:	c3                   	ret
+
+000007c3 <link>:
+SYSCALL(link)
+     7c3:	b8 13 00 00 00       	mov    $0x13,%eax
+     7c8:	cd 40                	int    $0x40
+     7ca:	c3                   	ret
+
+000007cb <mkdir>:
+SYSCALL(mkdir)
+     7cb:	b8 14 00 00 00       	mov    $0x14,%eax
+     7d0:	cd 40                	int    $0x40
+     7d2:	c3                   	ret
+
+000007d3 <chdir>:
+SYSCALL(chdir)
+     7d3:	b8 09 00 00 00       	mov    $0x9,%eax
+     7d8:	cd 40                	int    $0x40
+     7da:	c3                   	ret
+
+000007db <dup>:
+SYSCALL(dup)
+     7db:	b8 0a 00 00 00       	mov    $0xa,%eax
+     7e0:	cd 40                	int    $0x40
+     7e2:	c3                   	ret
+
+000007e3 <getpid>:
+SYSCALL(getpid)
+     7e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     7e8:	cd 40                	int    $0x40
+     7ea:	c3                   	ret
+
+000007eb <sbrk>:
+SYSCALL(sbrk)
+     7eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     7f0:	cd 40                	int    $0x40
+     7f2:	c3                   	ret
+
+000007f3 <sleep>:
+SYSCALL(sleep)
+     7f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     7f8:	cd 40                	int    $0x40
+     7fa:	c3                   	ret
+
+000007fb <uptime>:
+SYSCALL(uptime)
+     7fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     800:	cd 40                	int    $0x40
+     802:	c3                   	ret
+
+00000803 <poll>:
+SYSCALL(poll)
+     803:	b8 16 00 00 00       	mov    $0x16,%eax
+     808:	cd 40                	int    $0x40
+     80a:	c3                   	ret
+
+0000080b <fcntl>:
+SYSCALL(fcntl)
+     80b:	b8 17 00 00 00       	mov    $0x17,%eax
+     810:	cd 40                	int    $0x40
+     812:	c3                   	ret
+
+00000813 <lseek>:
+SYSCALL(lseek)
+     813:	b8 18 00 00 00       	mov    $0x18,%eax
+     818:	cd 40                	int    $0x40
+     81a:	c3                   	ret
+
+0000081b <pread>:
+SYSCALL(pread)
+     81b:	b8 19 00 00 00       	mov    $0x19,%eax
+     820:	cd 40                	int    $0x40
+     822:	c3                   	ret
+
+00000823 <pwrite>:
+SYSCALL(pwrite)
+     823:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     828:	cd 40                	int    $0x40
+     82a:	c3                   	ret
+
+0000082b <readv>:
+SYSCALL(readv)
+     82b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     830:	cd 40                	int    $0x40
+     832:	c3                   	ret
+
+00000833 <writev>:
+SYSCALL(writev)
+     833:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     838:	cd 40                	int    $0x40
+     83a:	c3                   	ret
+
+0000083b <getdents>:
+SYSCALL(getdents)
+     83b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <splice>:
+SYSCALL(splice)
+     843:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <ioring_setup>:
+SYSCALL(ioring_setup)
+     84b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <ioring_enter>:
+SYSCALL(ioring_enter)
+     853:	b8 20 00 00 00       	mov    $0x20,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <batch>:
+SYSCALL(batch)
+     85b:	b8 21 00 00 00       	mov    $0x21,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+     863:	66 90                	xchg   %ax,%ax
+     865:	66 90                	xchg   %ax,%ax
+     867:	66 90                	xchg   %ax,%ax
+     869:	66 90                	xchg   %ax,%ax
+     86b:	66 90                	xchg   %ax,%ax
+     86d:	66 90                	xchg   %ax,%ax
+     86f:	90                   	nop
+
+00000870 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	57                   	push   %edi
+     874:	56                   	push   %esi
+     875:	53                   	push   %ebx
+     876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     878:	89 d1                	mov    %edx,%ecx
+{
+     87a:	83 ec 3c             	sub    $0x3c,%esp
+     87d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     880:	85 d2                	test   %edx,%edx
+     882:	0f 89 80 00 00 00    	jns    908 <printint+0x98>
+     888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     88c:	74 7a                	je     908 <printint+0x98>
+    x = -xx;
+     88e:	f7 d9                	neg    %ecx
+    neg = 1;
+     890:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     895:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     898:	31 f6                	xor    %esi,%esi
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     8a0:	89 c8                	mov    %ecx,%eax
+     8a2:	31 d2                	xor    %edx,%edx
+     8a4:	89 f7                	mov    %esi,%edi
+     8a6:	f7 f3                	div    %ebx
+     8a8:	8d 76 01             	lea    0x1(%esi),%esi
+     8ab:	0f b6 92 9c 14 00 00 	movzbl 0x149c(%edx),%edx
+     8b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     8b6:	89 ca                	mov    %ecx,%edx
+     8b8:	89 c1                	mov    %eax,%ecx
+     8ba:	39 da                	cmp    %ebx,%edx
+     8bc:	73 e2                	jae    8a0 <printint+0x30>
+  if(neg)
+     8be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     8c1:	85 c0                	test   %eax,%eax
+     8c3:	74 07                	je     8cc <printint+0x5c>
+    buf[i++] = '-';
+     8c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     8ca:	89 f7                	mov    %esi,%edi
+     8cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     8cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     8d2:	01 df                	add    %ebx,%edi
+     8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     8d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     8db:	83 ec 04             	sub    $0x4,%esp
+     8de:	88 45 d7             	mov    %al,-0x29(%ebp)
+     8e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     8e4:	6a 01                	push   $0x1
+     8e6:	50                   	push   %eax
+     8e7:	56                   	push   %esi
+     8e8:	e8 96 fe ff ff       	call   783 <write>
+  while(--i >= 0)
+     8ed:	89 f8                	mov    %edi,%eax
+     8ef:	83 c4 10             	add    $0x10,%esp
+     8f2:	83 ef 01             	sub    $0x1,%edi
+     8f5:	39 d8                	cmp    %ebx,%eax
+     8f7:	75 df                	jne    8d8 <printint+0x68>
+}
+     8f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8fc:	5b                   	pop    %ebx
+     8fd:	5e                   	pop    %esi
+     8fe:	5f                   	pop    %edi
+     8ff:	5d                   	pop    %ebp
+     900:	c3                   	ret
+     901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     908:	31 c0                	xor    %eax,%eax
+     90a:	eb 89                	jmp    895 <printint+0x25>
+     90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     919:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     91c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     91f:	0f b6 1e             	movzbl (%esi),%ebx
+     922:	83 c6 01             	add    $0x1,%esi
+     925:	84 db                	test   %bl,%bl
+     927:	74 67                	je     990 <printf+0x80>
+     929:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     92c:	31 d2                	xor    %edx,%edx
+     92e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     931:	eb 34                	jmp    967 <printf+0x57>
+     933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     937:	90                   	nop
+     938:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     93b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     940:	83 f8 25             	cmp    $0x25,%eax
+     943:	74 18                	je     95d <printf+0x4d>
+  write(fd, &c, 1);
+     945:	83 ec 04             	sub    $0x4,%esp
+     948:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     94b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     94e:	6a 01                	push   $0x1
+     950:	50                   	push   %eax
+     951:	57                   	push   %edi
+     952:	e8 2c fe ff ff       	call   783 <write>
+     957:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     95a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     95d:	0f b6 1e             	movzbl (%esi),%ebx
+     960:	83 c6 01             	add    $0x1,%esi
+     963:	84 db                	test   %bl,%bl
+     965:	74 29                	je     990 <printf+0x80>
+    c = fmt[i] & 0xff;
+     967:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     96a:	85 d2                	test   %edx,%edx
+     96c:	74 ca                	je     938 <printf+0x28>
+      }
+    } else if(state == '%'){
+     96e:	83 fa 25             	cmp    $0x25,%edx
+     971:	75 ea                	jne    95d <printf+0x4d>
+      if(c == 'd'){
+     973:	83 f8 25             	cmp    $0x25,%eax
+     976:	0f 84 24 01 00 00    	je     aa0 <printf+0x190>
+     97c:	83 e8 63             	sub    $0x63,%eax
+     97f:	83 f8 15             	cmp    $0x15,%eax
+     982:	77 1c                	ja     9a0 <printf+0x90>
+     984:	ff 24 85 44 14 00 00 	jmp    *0x1444(,%eax,4)
+     98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     993:	5b                   	pop    %ebx
+     994:	5e                   	pop    %esi
+     995:	5f                   	pop    %edi
+     996:	5d                   	pop    %ebp
+     997:	c3                   	ret
+     998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99f:	90                   	nop
+  write(fd, &c, 1);
+     9a0:	83 ec 04             	sub    $0x4,%esp
+     9a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     9a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     9aa:	6a 01                	push   $0x1
+     9ac:	52                   	push   %edx
+     9ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     9b0:	57                   	push   %edi
+     9b1:	e8 cd fd ff ff       	call   783 <write>
+     9b6:	83 c4 0c             	add    $0xc,%esp
+     9b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     9bc:	6a 01                	push   $0x1
+     9be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     9c1:	52                   	push   %edx
+     9c2:	57                   	push   %edi
+     9c3:	e8 bb fd ff ff       	call   783 <write>
+        putc(fd, c);
+     9c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9cb:	31 d2                	xor    %edx,%edx
+     9cd:	eb 8e                	jmp    95d <printf+0x4d>
+     9cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     9d3:	83 ec 0c             	sub    $0xc,%esp
+     9d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     9db:	8b 13                	mov    (%ebx),%edx
+     9dd:	6a 00                	push   $0x0
+     9df:	89 f8                	mov    %edi,%eax
+        ap++;
+     9e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     9e4:	e8 87 fe ff ff       	call   870 <printint>
+        ap++;
+     9e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     9ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     9ef:	31 d2                	xor    %edx,%edx
+     9f1:	e9 67 ff ff ff       	jmp    95d <printf+0x4d>
+     9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     a05:	83 c0 04             	add    $0x4,%eax
+     a08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     a0b:	85 db                	test   %ebx,%ebx
+     a0d:	0f 84 9d 00 00 00    	je     ab0 <printf+0x1a0>
+        while(*s != 0){
+     a13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     a16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     a18:	84 c0                	test   %al,%al
+     a1a:	0f 84 3d ff ff ff    	je     95d <printf+0x4d>
+     a20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     a23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     a26:	89 de                	mov    %ebx,%esi
+     a28:	89 d3                	mov    %edx,%ebx
+     a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     a30:	83 ec 04             	sub    $0x4,%esp
+     a33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     a36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     a39:	6a 01                	push   $0x1
+     a3b:	53                   	push   %ebx
+     a3c:	57                   	push   %edi
+     a3d:	e8 41 fd ff ff       	call   783 <write>
+        while(*s != 0){
+     a42:	0f b6 06             	movzbl (%esi),%eax
+     a45:	83 c4 10             	add    $0x10,%esp
+     a48:	84 c0                	test   %al,%al
+     a4a:	75 e4                	jne    a30 <printf+0x120>
+      state = 0;
+     a4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     a4f:	31 d2                	xor    %edx,%edx
+     a51:	e9 07 ff ff ff       	jmp    95d <printf+0x4d>
+     a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a63:	83 ec 0c             	sub    $0xc,%esp
+     a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     a6b:	8b 13                	mov    (%ebx),%edx
+     a6d:	6a 01                	push   $0x1
+     a6f:	e9 6b ff ff ff       	jmp    9df <printf+0xcf>
+     a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     a78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     a7b:	83 ec 04             	sub    $0x4,%esp
+     a7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     a81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     a83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     a86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     a89:	6a 01                	push   $0x1
+     a8b:	52                   	push   %edx
+     a8c:	57                   	push   %edi
+     a8d:	e8 f1 fc ff ff       	call   783 <write>
+        ap++;
+     a92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     a95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a98:	31 d2                	xor    %edx,%edx
+     a9a:	e9 be fe ff ff       	jmp    95d <printf+0x4d>
+     a9f:	90                   	nop
+  write(fd, &c, 1);
+     aa0:	83 ec 04             	sub    $0x4,%esp
+     aa3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     aa6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     aa9:	6a 01                	push   $0x1
+     aab:	e9 11 ff ff ff       	jmp    9c1 <printf+0xb1>
+     ab0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     ab5:	bb 3c 14 00 00       	mov    $0x143c,%ebx
+     aba:	e9 61 ff ff ff       	jmp    a20 <printf+0x110>
+     abf:	90                   	nop
+
+00000ac0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ac0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ac1:	a1 a8 1a 00 00       	mov    0x1aa8,%eax
+{
+     ac6:	89 e5                	mov    %esp,%ebp
+     ac8:	57                   	push   %edi
+     ac9:	56                   	push   %esi
+     aca:	53                   	push   %ebx
+     acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     ace:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ad8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ada:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     adc:	39 ca                	cmp    %ecx,%edx
+     ade:	73 30                	jae    b10 <free+0x50>
+     ae0:	39 c1                	cmp    %eax,%ecx
+     ae2:	72 04                	jb     ae8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ae4:	39 c2                	cmp    %eax,%edx
+     ae6:	72 f0                	jb     ad8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ae8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     aeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     aee:	39 f8                	cmp    %edi,%eax
+     af0:	74 2e                	je     b20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     af2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     af5:	8b 42 04             	mov    0x4(%edx),%eax
+     af8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     afb:	39 f1                	cmp    %esi,%ecx
+     afd:	74 38                	je     b37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     aff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     b01:	5b                   	pop    %ebx
+  freep = p;
+     b02:	89 15 a8 1a 00 00    	mov    %edx,0x1aa8
+}
+     b08:	5e                   	pop    %esi
+     b09:	5f                   	pop    %edi
+     b0a:	5d                   	pop    %ebp
+     b0b:	c3                   	ret
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     b10:	39 c1                	cmp    %eax,%ecx
+     b12:	72 d0                	jb     ae4 <free+0x24>
+     b14:	eb c2                	jmp    ad8 <free+0x18>
+     b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     b20:	03 70 04             	add    0x4(%eax),%esi
+     b23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     b26:	8b 02                	mov    (%edx),%eax
+     b28:	8b 00                	mov    (%eax),%eax
+     b2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     b2d:	8b 42 04             	mov    0x4(%edx),%eax
+     b30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     b33:	39 f1                	cmp    %esi,%ecx
+     b35:	75 c8                	jne    aff <free+0x3f>
+    p->s.size += bp->s.size;
+     b37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     b3a:	89 15 a8 1a 00 00    	mov    %edx,0x1aa8
+    p->s.size += bp->s.size;
+     b40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     b43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     b46:	89 0a                	mov    %ecx,(%edx)
+}
+     b48:	5b                   	pop    %ebx
+     b49:	5e                   	pop    %esi
+     b4a:	5f                   	pop    %edi
+     b4b:	5d                   	pop    %ebp
+     b4c:	c3                   	ret
+     b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+     b55:	53                   	push   %ebx
+     b56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     b5c:	8b 15 a8 1a 00 00    	mov    0x1aa8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     b62:	8d 78 07             	lea    0x7(%eax),%edi
+     b65:	c1 ef 03             	shr    $0x3,%edi
+     b68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     b6b:	85 d2                	test   %edx,%edx
+     b6d:	0f 84 8d 00 00 00    	je     c00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     b73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     b75:	8b 48 04             	mov    0x4(%eax),%ecx
+     b78:	39 f9                	cmp    %edi,%ecx
+     b7a:	73 64                	jae    be0 <malloc+0x90>
+  if(nu < 4096)
+     b7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     b81:	39 df                	cmp    %ebx,%edi
+     b83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     b86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     b8d:	eb 0a                	jmp    b99 <malloc+0x49>
+     b8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     b90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     b92:	8b 48 04             	mov    0x4(%eax),%ecx
+     b95:	39 f9                	cmp    %edi,%ecx
+     b97:	73 47                	jae    be0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     b99:	89 c2                	mov    %eax,%edx
+     b9b:	39 05 a8 1a 00 00    	cmp    %eax,0x1aa8
+     ba1:	75 ed                	jne    b90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     ba3:	83 ec 0c             	sub    $0xc,%esp
+     ba6:	56                   	push   %esi
+     ba7:	e8 3f fc ff ff       	call   7eb <sbrk>
+  if(p == (char*)-1)
+     bac:	83 c4 10             	add    $0x10,%esp
+     baf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     bb2:	74 1c                	je     bd0 <malloc+0x80>
+  hp->s.size = nu;
+     bb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     bb7:	83 ec 0c             	sub    $0xc,%esp
+     bba:	83 c0 08             	add    $0x8,%eax
+     bbd:	50                   	push   %eax
+     bbe:	e8 fd fe ff ff       	call   ac0 <free>
+  return freep;
+     bc3:	8b 15 a8 1a 00 00    	mov    0x1aa8,%edx
+      if((p = morecore(nunits)) == 0)
+     bc9:	83 c4 10             	add    $0x10,%esp
+     bcc:	85 d2                	test   %edx,%edx
+     bce:	75 c0                	jne    b90 <malloc+0x40>
+        return 0;
+  }
+}
+     bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     bd3:	31 c0                	xor    %eax,%eax
+}
+     bd5:	5b                   	pop    %ebx
+     bd6:	5e                   	pop    %esi
+     bd7:	5f                   	pop    %edi
+     bd8:	5d                   	pop    %ebp
+     bd9:	c3                   	ret
+     bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     be0:	39 cf                	cmp    %ecx,%edi
+     be2:	74 4c                	je     c30 <malloc+0xe0>
+        p->s.size -= nunits;
+     be4:	29 f9                	sub    %edi,%ecx
+     be6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     be9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     bec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     bef:	89 15 a8 1a 00 00    	mov    %edx,0x1aa8
+}
+     bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     bf8:	83 c0 08             	add    $0x8,%eax
+}
+     bfb:	5b                   	pop    %ebx
+     bfc:	5e                   	pop    %esi
+     bfd:	5f                   	pop    %edi
+     bfe:	5d                   	pop    %ebp
+     bff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     c00:	c7 05 a8 1a 00 00 ac 	movl   $0x1aac,0x1aa8
+     c07:	1a 00 00 
+    base.s.size = 0;
+     c0a:	b8 ac 1a 00 00       	mov    $0x1aac,%eax
+    base.s.ptr = freep = prevp = &base;
+     c0f:	c7 05 ac 1a 00 00 ac 	movl   $0x1aac,0x1aac
+     c16:	1a 00 00 
+    base.s.size = 0;
+     c19:	c7 05 b0 1a 00 00 00 	movl   $0x0,0x1ab0
+     c20:	00 00 00 
+    if(p->s.size >= nunits){
+     c23:	e9 54 ff ff ff       	jmp    b7c <malloc+0x2c>
+     c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     c30:	8b 08                	mov    (%eax),%ecx
+     c32:	89 0a                	mov    %ecx,(%edx)
+     c34:	eb b9                	jmp    bef <malloc+0x9f>
+     c36:	66 90                	xchg   %ax,%ax
+     c38:	66 90                	xchg   %ax,%ax
+     c3a:	66 90                	xchg   %ax,%ax
+     c3c:	66 90                	xchg   %ax,%ax
+     c3e:	66 90                	xchg   %ax,%ax
+
+00000c40 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	83 ec 1c             	sub    $0x1c,%esp
+     c49:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+     c4c:	85 c9                	test   %ecx,%ecx
+     c4e:	7e 51                	jle    ca1 <put+0x61>
+     c50:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+     c52:	8b 40 08             	mov    0x8(%eax),%eax
+     c55:	89 ce                	mov    %ecx,%esi
+     c57:	85 c0                	test   %eax,%eax
+     c59:	7e 55                	jle    cb0 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+     c5b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+     c5e:	8b 51 0c             	mov    0xc(%ecx),%edx
+     c61:	8b 79 08             	mov    0x8(%ecx),%edi
+     c64:	01 d7                	add    %edx,%edi
+     c66:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+     c69:	74 65                	je     cd0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+     c6b:	83 f8 20             	cmp    $0x20,%eax
+     c6e:	75 40                	jne    cb0 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+     c70:	83 ec 04             	sub    $0x4,%esp
+     c73:	8d 43 10             	lea    0x10(%ebx),%eax
+     c76:	6a 20                	push   $0x20
+     c78:	50                   	push   %eax
+     c79:	ff 33                	push   (%ebx)
+     c7b:	e8 b3 fb ff ff       	call   833 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+     c80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+     c83:	31 c0                	xor    %eax,%eax
+     c85:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     c8a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+     c8d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     c94:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+     c97:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+     c9a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+     c9e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ca4:	5b                   	pop    %ebx
+     ca5:	5e                   	pop    %esi
+     ca6:	5f                   	pop    %edi
+     ca7:	5d                   	pop    %ebp
+     ca8:	c3                   	ret
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+     cb0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+     cb3:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+     cb6:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+     cb9:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+     cbd:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+     cc0:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+     cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc6:	5b                   	pop    %ebx
+     cc7:	5e                   	pop    %esi
+     cc8:	5f                   	pop    %edi
+     cc9:	5d                   	pop    %ebp
+     cca:	c3                   	ret
+     ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+      last->iov_len += n;
+     cd0:	01 f2                	add    %esi,%edx
+     cd2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+     cd5:	eb ca                	jmp    ca1 <put+0x61>
+     cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cde:	66 90                	xchg   %ax,%ax
+
+00000ce0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	57                   	push   %edi
+     ce4:	89 d7                	mov    %edx,%edi
+     ce6:	56                   	push   %esi
+     ce7:	89 ce                	mov    %ecx,%esi
+     ce9:	53                   	push   %ebx
+     cea:	89 c3                	mov    %eax,%ebx
+     cec:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+     cef:	8b 40 0c             	mov    0xc(%eax),%eax
+     cf2:	8b 53 08             	mov    0x8(%ebx),%edx
+     cf5:	01 c1                	add    %eax,%ecx
+     cf7:	83 f9 40             	cmp    $0x40,%ecx
+     cfa:	7f 3c                	jg     d38 <putcopy+0x58>
+     cfc:	83 fa 20             	cmp    $0x20,%edx
+     cff:	74 3f                	je     d40 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+     d01:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+     d07:	83 ec 04             	sub    $0x4,%esp
+     d0a:	01 d0                	add    %edx,%eax
+     d0c:	56                   	push   %esi
+     d0d:	57                   	push   %edi
+     d0e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     d11:	50                   	push   %eax
+     d12:	e8 19 fa ff ff       	call   730 <memmove>
+  put(w, w->buf + w->nbuf, n);
+     d17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d1a:	89 f1                	mov    %esi,%ecx
+     d1c:	03 53 0c             	add    0xc(%ebx),%edx
+     d1f:	89 d8                	mov    %ebx,%eax
+     d21:	e8 1a ff ff ff       	call   c40 <put>
+  w->nbuf += n;
+     d26:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+     d29:	83 c4 10             	add    $0x10,%esp
+     d2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d2f:	5b                   	pop    %ebx
+     d30:	5e                   	pop    %esi
+     d31:	5f                   	pop    %edi
+     d32:	5d                   	pop    %ebp
+     d33:	c3                   	ret
+     d34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+     d38:	85 d2                	test   %edx,%edx
+     d3a:	7e 16                	jle    d52 <putcopy+0x72>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+     d40:	83 ec 04             	sub    $0x4,%esp
+     d43:	8d 43 10             	lea    0x10(%ebx),%eax
+     d46:	52                   	push   %edx
+     d47:	50                   	push   %eax
+     d48:	ff 33                	push   (%ebx)
+     d4a:	e8 e4 fa ff ff       	call   833 <writev>
+     d4f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+     d52:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+     d59:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+     d5b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+     d62:	eb 9d                	jmp    d01 <putcopy+0x21>
+     d64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+
+00000d70 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+     d70:	55                   	push   %ebp
+     d71:	89 e5                	mov    %esp,%ebp
+     d73:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+     d76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+     d79:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+     d80:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+     d82:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+     d89:	c7 40 10 ad 14 00 00 	movl   $0x14ad,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+     d90:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+     d97:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+     d9e:	5d                   	pop    %ebp
+     d9f:	c3                   	ret
+
+00000da0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	57                   	push   %edi
+     da4:	56                   	push   %esi
+     da5:	53                   	push   %ebx
+     da6:	83 ec 1c             	sub    $0x1c,%esp
+     da9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     dac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     daf:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+     db2:	8b 47 04             	mov    0x4(%edi),%eax
+     db5:	85 c0                	test   %eax,%eax
+     db7:	0f 85 7b 01 00 00    	jne    f38 <struct_field_str+0x198>
+    w->need_comma = 1;
+     dbd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     dc4:	b9 01 00 00 00       	mov    $0x1,%ecx
+     dc9:	ba c2 14 00 00       	mov    $0x14c2,%edx
+     dce:	89 f8                	mov    %edi,%eax
+     dd0:	e8 6b fe ff ff       	call   c40 <put>
+  put_str(w, key ? key : "");
+     dd5:	85 db                	test   %ebx,%ebx
+     dd7:	b8 de 13 00 00       	mov    $0x13de,%eax
+     ddc:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     ddf:	83 ec 0c             	sub    $0xc,%esp
+     de2:	53                   	push   %ebx
+     de3:	e8 c8 f7 ff ff       	call   5b0 <strlen>
+     de8:	89 da                	mov    %ebx,%edx
+     dea:	89 c1                	mov    %eax,%ecx
+     dec:	89 f8                	mov    %edi,%eax
+     dee:	e8 4d fe ff ff       	call   c40 <put>
+  put(w, "\":\"", 3);
+     df3:	b9 03 00 00 00       	mov    $0x3,%ecx
+     df8:	ba c0 14 00 00       	mov    $0x14c0,%edx
+     dfd:	89 f8                	mov    %edi,%eax
+     dff:	e8 3c fe ff ff       	call   c40 <put>
+  put_escaped(w, value ? value : "");
+     e04:	83 c4 10             	add    $0x10,%esp
+     e07:	85 f6                	test   %esi,%esi
+     e09:	0f 84 41 01 00 00    	je     f50 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+     e0f:	0f b6 1e             	movzbl (%esi),%ebx
+     e12:	89 f2                	mov    %esi,%edx
+     e14:	84 db                	test   %bl,%bl
+     e16:	0f 84 40 01 00 00    	je     f5c <struct_field_str+0x1bc>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     e20:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+     e22:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+     e25:	80 fb 0d             	cmp    $0xd,%bl
+     e28:	74 7e                	je     ea8 <struct_field_str+0x108>
+     e2a:	7f 5c                	jg     e88 <struct_field_str+0xe8>
+     e2c:	80 fb 09             	cmp    $0x9,%bl
+     e2f:	0f 84 eb 00 00 00    	je     f20 <struct_field_str+0x180>
+     e35:	80 fb 0a             	cmp    $0xa,%bl
+     e38:	0f 85 95 00 00 00    	jne    ed3 <struct_field_str+0x133>
+    put(w, run, s - run);
+     e3e:	29 d1                	sub    %edx,%ecx
+     e40:	89 f8                	mov    %edi,%eax
+     e42:	e8 f9 fd ff ff       	call   c40 <put>
+      esc = "\\n";
+     e47:	ba bb 14 00 00       	mov    $0x14bb,%edx
+      put(w, esc, 2);
+     e4c:	b9 02 00 00 00       	mov    $0x2,%ecx
+     e51:	89 f8                	mov    %edi,%eax
+     e53:	e8 e8 fd ff ff       	call   c40 <put>
+    run = s + 1;
+     e58:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+     e5a:	0f b6 1e             	movzbl (%esi),%ebx
+     e5d:	84 db                	test   %bl,%bl
+     e5f:	75 bf                	jne    e20 <struct_field_str+0x80>
+  put(w, run, s - run);
+     e61:	29 d6                	sub    %edx,%esi
+     e63:	89 f1                	mov    %esi,%ecx
+     e65:	89 f8                	mov    %edi,%eax
+     e67:	e8 d4 fd ff ff       	call   c40 <put>
+  put(w, "\"", 1);
+}
+     e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+     e6f:	89 f8                	mov    %edi,%eax
+     e71:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+     e76:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+     e77:	ba c2 14 00 00       	mov    $0x14c2,%edx
+}
+     e7c:	5e                   	pop    %esi
+     e7d:	5f                   	pop    %edi
+     e7e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+     e7f:	e9 bc fd ff ff       	jmp    c40 <put>
+     e84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+     e88:	80 fb 22             	cmp    $0x22,%bl
+     e8b:	74 33                	je     ec0 <struct_field_str+0x120>
+     e8d:	80 fb 5c             	cmp    $0x5c,%bl
+     e90:	75 41                	jne    ed3 <struct_field_str+0x133>
+    put(w, run, s - run);
+     e92:	29 d1                	sub    %edx,%ecx
+     e94:	89 f8                	mov    %edi,%eax
+     e96:	e8 a5 fd ff ff       	call   c40 <put>
+      esc = "\\\\";
+     e9b:	ba af 14 00 00       	mov    $0x14af,%edx
+     ea0:	eb aa                	jmp    e4c <struct_field_str+0xac>
+     ea2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+     ea8:	29 d1                	sub    %edx,%ecx
+     eaa:	89 f8                	mov    %edi,%eax
+     eac:	e8 8f fd ff ff       	call   c40 <put>
+      esc = "\\r";
+     eb1:	ba b8 14 00 00       	mov    $0x14b8,%edx
+     eb6:	eb 94                	jmp    e4c <struct_field_str+0xac>
+     eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+    put(w, run, s - run);
+     ec0:	29 d1                	sub    %edx,%ecx
+     ec2:	89 f8                	mov    %edi,%eax
+     ec4:	e8 77 fd ff ff       	call   c40 <put>
+      esc = "\\\"";
+     ec9:	ba b2 14 00 00       	mov    $0x14b2,%edx
+     ece:	e9 79 ff ff ff       	jmp    e4c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+     ed3:	80 fb 1f             	cmp    $0x1f,%bl
+     ed6:	77 82                	ja     e5a <struct_field_str+0xba>
+    put(w, run, s - run);
+     ed8:	29 d1                	sub    %edx,%ecx
+     eda:	89 f8                	mov    %edi,%eax
+     edc:	e8 5f fd ff ff       	call   c40 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+     ee1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+     ee3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+     ee6:	0f b7 05 dc 14 00 00 	movzwl 0x14dc,%eax
+     eed:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+     ef0:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+     ef5:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+     efc:	0f b6 d2             	movzbl %dl,%edx
+     eff:	8a 82 c4 14 00 00    	mov    0x14c4(%edx),%al
+     f05:	8a a3 c4 14 00 00    	mov    0x14c4(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+     f0b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+     f0e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+     f12:	89 f8                	mov    %edi,%eax
+     f14:	e8 c7 fd ff ff       	call   ce0 <putcopy>
+     f19:	e9 3a ff ff ff       	jmp    e58 <struct_field_str+0xb8>
+     f1e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+     f20:	29 d1                	sub    %edx,%ecx
+     f22:	89 f8                	mov    %edi,%eax
+     f24:	e8 17 fd ff ff       	call   c40 <put>
+      esc = "\\t";
+     f29:	ba b5 14 00 00       	mov    $0x14b5,%edx
+     f2e:	e9 19 ff ff ff       	jmp    e4c <struct_field_str+0xac>
+     f33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f37:	90                   	nop
+    put(w, ",", 1);
+     f38:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f3d:	ba be 14 00 00       	mov    $0x14be,%edx
+     f42:	89 f8                	mov    %edi,%eax
+     f44:	e8 f7 fc ff ff       	call   c40 <put>
+}
+     f49:	e9 76 fe ff ff       	jmp    dc4 <struct_field_str+0x24>
+     f4e:	66 90                	xchg   %ax,%ax
+     f50:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+     f52:	ba de 13 00 00       	mov    $0x13de,%edx
+     f57:	e9 09 ff ff ff       	jmp    e65 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+     f5c:	31 c9                	xor    %ecx,%ecx
+     f5e:	e9 02 ff ff ff       	jmp    e65 <struct_field_str+0xc5>
+     f63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f70 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	57                   	push   %edi
+     f74:	56                   	push   %esi
+     f75:	53                   	push   %ebx
+     f76:	83 ec 1c             	sub    $0x1c,%esp
+     f79:	8b 7d 08             	mov    0x8(%ebp),%edi
+     f7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+     f7f:	8b 57 04             	mov    0x4(%edi),%edx
+     f82:	85 d2                	test   %edx,%edx
+     f84:	0f 85 b6 00 00 00    	jne    1040 <struct_field_int+0xd0>
+    w->need_comma = 1;
+     f8a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+     f91:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f96:	ba c2 14 00 00       	mov    $0x14c2,%edx
+     f9b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+     f9d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+     fa2:	e8 99 fc ff ff       	call   c40 <put>
+  put_str(w, key ? key : "");
+     fa7:	85 db                	test   %ebx,%ebx
+     fa9:	b8 de 13 00 00       	mov    $0x13de,%eax
+     fae:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+     fb1:	83 ec 0c             	sub    $0xc,%esp
+     fb4:	53                   	push   %ebx
+     fb5:	e8 f6 f5 ff ff       	call   5b0 <strlen>
+     fba:	89 da                	mov    %ebx,%edx
+     fbc:	89 c1                	mov    %eax,%ecx
+     fbe:	89 f8                	mov    %edi,%eax
+     fc0:	e8 7b fc ff ff       	call   c40 <put>
+  put(w, "\":", 2);
+     fc5:	b9 02 00 00 00       	mov    $0x2,%ecx
+     fca:	ba d5 14 00 00       	mov    $0x14d5,%edx
+     fcf:	89 f8                	mov    %edi,%eax
+     fd1:	e8 6a fc ff ff       	call   c40 <put>
+  x = value < 0 ? -(uint)value : value;
+     fd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+     fd9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+     fdc:	83 c4 10             	add    $0x10,%esp
+     fdf:	f7 d9                	neg    %ecx
+     fe1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+     fe5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+     fe8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     fed:	89 f3                	mov    %esi,%ebx
+     fef:	83 ee 01             	sub    $0x1,%esi
+     ff2:	f7 e1                	mul    %ecx
+     ff4:	89 c8                	mov    %ecx,%eax
+     ff6:	c1 ea 03             	shr    $0x3,%edx
+     ff9:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+     ffc:	01 ff                	add    %edi,%edi
+     ffe:	29 f8                	sub    %edi,%eax
+    1000:	83 c0 30             	add    $0x30,%eax
+    1003:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+    1007:	89 c8                	mov    %ecx,%eax
+    1009:	89 d1                	mov    %edx,%ecx
+    100b:	83 f8 09             	cmp    $0x9,%eax
+    100e:	77 d8                	ja     fe8 <struct_field_int+0x78>
+  if(value < 0)
+    1010:	8b 45 10             	mov    0x10(%ebp),%eax
+    1013:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1016:	85 c0                	test   %eax,%eax
+    1018:	79 08                	jns    1022 <struct_field_int+0xb2>
+    buf[--i] = '-';
+    101a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+    101f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+    1022:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1025:	b9 0c 00 00 00       	mov    $0xc,%ecx
+    102a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    102d:	29 f1                	sub    %esi,%ecx
+    102f:	89 f8                	mov    %edi,%eax
+    1031:	e8 aa fc ff ff       	call   ce0 <putcopy>
+  put_int(w, value);
+}
+    1036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1039:	5b                   	pop    %ebx
+    103a:	5e                   	pop    %esi
+    103b:	5f                   	pop    %edi
+    103c:	5d                   	pop    %ebp
+    103d:	c3                   	ret
+    103e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+    1040:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1045:	ba be 14 00 00       	mov    $0x14be,%edx
+    104a:	89 f8                	mov    %edi,%eax
+    104c:	e8 ef fb ff ff       	call   c40 <put>
+}
+    1051:	e9 3b ff ff ff       	jmp    f91 <struct_field_int+0x21>
+    1056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001060 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	56                   	push   %esi
+    1064:	53                   	push   %ebx
+    1065:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+    1068:	8b 43 08             	mov    0x8(%ebx),%eax
+    106b:	85 c0                	test   %eax,%eax
+    106d:	7e 59                	jle    10c8 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+    106f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+    1072:	8b 4a 0c             	mov    0xc(%edx),%ecx
+    1075:	8b 72 08             	mov    0x8(%edx),%esi
+    1078:	01 ce                	add    %ecx,%esi
+    107a:	81 fe d8 14 00 00    	cmp    $0x14d8,%esi
+    1080:	0f 84 aa 00 00 00    	je     1130 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+    1086:	83 f8 20             	cmp    $0x20,%eax
+    1089:	75 75                	jne    1100 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+    108b:	83 ec 04             	sub    $0x4,%esp
+    108e:	8d 73 10             	lea    0x10(%ebx),%esi
+    1091:	6a 20                	push   $0x20
+    1093:	56                   	push   %esi
+    1094:	ff 33                	push   (%ebx)
+    1096:	e8 98 f7 ff ff       	call   833 <writev>
+  w->nbuf = 0;
+    109b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+    10a2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    10a5:	c7 43 10 d8 14 00 00 	movl   $0x14d8,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+    10ac:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+    10b3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+    10ba:	ba 01 00 00 00       	mov    $0x1,%edx
+    10bf:	eb 5a                	jmp    111b <struct_end+0xbb>
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+    10c8:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    10cb:	83 c0 02             	add    $0x2,%eax
+    10ce:	c7 04 c3 d8 14 00 00 	movl   $0x14d8,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    10d5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    10dc:	00 
+  w->niov++;
+    10dd:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+    10e0:	83 fa 01             	cmp    $0x1,%edx
+    10e3:	74 58                	je     113d <struct_end+0xdd>
+  w->niov = 0;
+    10e5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+    10ec:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+    10f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10f6:	5b                   	pop    %ebx
+    10f7:	5e                   	pop    %esi
+    10f8:	5d                   	pop    %ebp
+    10f9:	c3                   	ret
+    10fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+    1100:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1103:	83 c0 02             	add    $0x2,%eax
+    1106:	8d 73 10             	lea    0x10(%ebx),%esi
+    1109:	c7 04 c3 d8 14 00 00 	movl   $0x14d8,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    1110:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    1117:	00 
+  w->niov++;
+    1118:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+    111b:	83 ec 04             	sub    $0x4,%esp
+    111e:	52                   	push   %edx
+    111f:	56                   	push   %esi
+    1120:	ff 33                	push   (%ebx)
+    1122:	e8 0c f7 ff ff       	call   833 <writev>
+    1127:	83 c4 10             	add    $0x10,%esp
+    112a:	eb b9                	jmp    10e5 <struct_end+0x85>
+    112c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+    1130:	83 c1 02             	add    $0x2,%ecx
+    1133:	8d 73 10             	lea    0x10(%ebx),%esi
+    1136:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+    1139:	89 c2                	mov    %eax,%edx
+    113b:	eb de                	jmp    111b <struct_end+0xbb>
+    113d:	8d 73 10             	lea    0x10(%ebx),%esi
+    1140:	e9 75 ff ff ff       	jmp    10ba <struct_end+0x5a>
+    1145:	66 90                	xchg   %ax,%ax
+    1147:	66 90                	xchg   %ax,%ax
+    1149:	66 90                	xchg   %ax,%ax
+    114b:	66 90                	xchg   %ax,%ax
+    114d:	66 90                	xchg   %ax,%ax
+    114f:	90                   	nop
+
+00001150 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	56                   	push   %esi
+    1154:	89 c6                	mov    %eax,%esi
+    1156:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+    1157:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+    115d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+    1163:	6a 01                	push   $0x1
+    1165:	53                   	push   %ebx
+    1166:	e8 05 fc ff ff       	call   d70 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    116b:	83 c4 0c             	add    $0xc,%esp
+    116e:	56                   	push   %esi
+    116f:	68 de 14 00 00       	push   $0x14de
+    1174:	53                   	push   %ebx
+    1175:	e8 26 fc ff ff       	call   da0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+    117a:	83 c4 0c             	add    $0xc,%esp
+    117d:	68 e6 14 00 00       	push   $0x14e6
+    1182:	68 f7 14 00 00       	push   $0x14f7
+    1187:	53                   	push   %ebx
+    1188:	e8 13 fc ff ff       	call   da0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+    118d:	83 c4 0c             	add    $0xc,%esp
+    1190:	68 ea 07 00 00       	push   $0x7ea
+    1195:	68 fe 14 00 00       	push   $0x14fe
+    119a:	53                   	push   %ebx
+    119b:	e8 d0 fd ff ff       	call   f70 <struct_field_int>
+  struct_end(&w);
+    11a0:	89 1c 24             	mov    %ebx,(%esp)
+    11a3:	e8 b8 fe ff ff       	call   1060 <struct_end>
+    11a8:	83 c4 10             	add    $0x10,%esp
+}
+    11ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11ae:	5b                   	pop    %ebx
+    11af:	5e                   	pop    %esi
+    11b0:	5d                   	pop    %ebp
+    11b1:	c3                   	ret
+    11b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011c0 <modern_consume_flags>:
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	57                   	push   %edi
+    11c4:	56                   	push   %esi
+    11c5:	53                   	push   %ebx
+    11c6:	83 ec 0c             	sub    $0xc,%esp
+    11c9:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+    11cc:	85 f6                	test   %esi,%esi
+    11ce:	74 06                	je     11d6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+    11d0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+    11d6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+    11da:	bf 01 00 00 00       	mov    $0x1,%edi
+    11df:	7e 4c                	jle    122d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+    11e1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+    11e4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+    11e7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+    11ea:	68 03 15 00 00       	push   $0x1503
+    11ef:	53                   	push   %ebx
+    11f0:	e8 5b f3 ff ff       	call   550 <strcmp>
+    11f5:	83 c4 10             	add    $0x10,%esp
+    11f8:	85 c0                	test   %eax,%eax
+    11fa:	74 58                	je     1254 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+    11fc:	8b 45 14             	mov    0x14(%ebp),%eax
+    11ff:	85 c0                	test   %eax,%eax
+    1201:	74 2a                	je     122d <modern_consume_flags+0x6d>
+    1203:	83 ec 08             	sub    $0x8,%esp
+    1206:	68 1b 15 00 00       	push   $0x151b
+    120b:	53                   	push   %ebx
+    120c:	e8 3f f3 ff ff       	call   550 <strcmp>
+    1211:	83 c4 10             	add    $0x10,%esp
+    1214:	85 c0                	test   %eax,%eax
+    1216:	74 28                	je     1240 <modern_consume_flags+0x80>
+    1218:	83 ec 08             	sub    $0x8,%esp
+    121b:	68 1e 15 00 00       	push   $0x151e
+    1220:	53                   	push   %ebx
+    1221:	e8 2a f3 ff ff       	call   550 <strcmp>
+    1226:	83 c4 10             	add    $0x10,%esp
+    1229:	85 c0                	test   %eax,%eax
+    122b:	74 13                	je     1240 <modern_consume_flags+0x80>
+}
+    122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1230:	89 f8                	mov    %edi,%eax
+    1232:	5b                   	pop    %ebx
+    1233:	5e                   	pop    %esi
+    1234:	5f                   	pop    %edi
+    1235:	5d                   	pop    %ebp
+    1236:	c3                   	ret
+    1237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    123e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+    1240:	85 f6                	test   %esi,%esi
+    1242:	74 06                	je     124a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+    1244:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+    124a:	83 c7 01             	add    $0x1,%edi
+    124d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+    1250:	75 8f                	jne    11e1 <modern_consume_flags+0x21>
+    1252:	eb d9                	jmp    122d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+    1254:	85 f6                	test   %esi,%esi
+    1256:	74 12                	je     126a <modern_consume_flags+0xaa>
+  if(!json_mode){
+    1258:	83 3e 00             	cmpl   $0x0,(%esi)
+    125b:	74 0d                	je     126a <modern_consume_flags+0xaa>
+    125d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1260:	e8 eb fe ff ff       	call   1150 <modern_print_version.part.0>
+      exit();
+    1265:	e8 f9 f4 ff ff       	call   763 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    126a:	83 ec 0c             	sub    $0xc,%esp
+    126d:	68 ea 07 00 00       	push   $0x7ea
+    1272:	68 e6 14 00 00       	push   $0x14e6
+    1277:	ff 75 08             	push   0x8(%ebp)
+    127a:	68 0d 15 00 00       	push   $0x150d
+    127f:	6a 01                	push   $0x1
+    1281:	e8 8a f6 ff ff       	call   910 <printf>
+}
+    1286:	83 c4 20             	add    $0x20,%esp
+    1289:	eb da                	jmp    1265 <modern_consume_flags+0xa5>
+    128b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    128f:	90                   	nop
+
+00001290 <modern_print_version>:
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    1296:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    1299:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    129c:	85 d2                	test   %edx,%edx
+    129e:	74 10                	je     12b0 <modern_print_version+0x20>
+}
+    12a0:	c9                   	leave
+    12a1:	e9 aa fe ff ff       	jmp    1150 <modern_print_version.part.0>
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    12b0:	83 ec 0c             	sub    $0xc,%esp
+    12b3:	68 ea 07 00 00       	push   $0x7ea
+    12b8:	68 e6 14 00 00       	push   $0x14e6
+    12bd:	50                   	push   %eax
+    12be:	68 0d 15 00 00       	push   $0x150d
+    12c3:	6a 01                	push   $0x1
+    12c5:	e8 46 f6 ff ff       	call   910 <printf>
+}
+    12ca:	83 c4 20             	add    $0x20,%esp
+}
+    12cd:	c9                   	leave
+    12ce:	c3                   	ret
+    12cf:	90                   	nop
+
+000012d0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    12dc:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    12df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    12e2:	8b 45 10             	mov    0x10(%ebp),%eax
+    12e5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    12e8:	85 d2                	test   %edx,%edx
+    12ea:	75 44                	jne    1330 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    12ec:	85 f6                	test   %esi,%esi
+    12ee:	ba 25 15 00 00       	mov    $0x1525,%edx
+    12f3:	0f 44 f2             	cmove  %edx,%esi
+    12f6:	85 c0                	test   %eax,%eax
+    12f8:	ba de 13 00 00       	mov    $0x13de,%edx
+    12fd:	0f 44 c2             	cmove  %edx,%eax
+    1300:	85 db                	test   %ebx,%ebx
+    1302:	ba 2a 15 00 00       	mov    $0x152a,%edx
+    1307:	0f 44 da             	cmove  %edx,%ebx
+    130a:	83 ec 08             	sub    $0x8,%esp
+    130d:	56                   	push   %esi
+    130e:	50                   	push   %eax
+    130f:	53                   	push   %ebx
+    1310:	ff 75 08             	push   0x8(%ebp)
+    1313:	68 30 15 00 00       	push   $0x1530
+    1318:	6a 01                	push   $0x1
+    131a:	e8 f1 f5 ff ff       	call   910 <printf>
+    131f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    1322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1325:	5b                   	pop    %ebx
+    1326:	5e                   	pop    %esi
+    1327:	5f                   	pop    %edi
+    1328:	5d                   	pop    %ebp
+    1329:	c3                   	ret
+    132a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    1330:	83 ec 08             	sub    $0x8,%esp
+    1333:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    1339:	89 45 10             	mov    %eax,0x10(%ebp)
+    133c:	6a 01                	push   $0x1
+    133e:	57                   	push   %edi
+    133f:	e8 2c fa ff ff       	call   d70 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    1344:	83 c4 0c             	add    $0xc,%esp
+    1347:	ff 75 08             	push   0x8(%ebp)
+    134a:	68 de 14 00 00       	push   $0x14de
+    134f:	57                   	push   %edi
+    1350:	e8 4b fa ff ff       	call   da0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    1355:	83 c4 0c             	add    $0xc,%esp
+    1358:	ba 2a 15 00 00       	mov    $0x152a,%edx
+    135d:	85 db                	test   %ebx,%ebx
+    135f:	0f 44 da             	cmove  %edx,%ebx
+    1362:	53                   	push   %ebx
+    1363:	52                   	push   %edx
+    1364:	57                   	push   %edi
+    1365:	e8 36 fa ff ff       	call   da0 <struct_field_str>
+  if(target)
+    136a:	8b 45 10             	mov    0x10(%ebp),%eax
+    136d:	83 c4 10             	add    $0x10,%esp
+    1370:	85 c0                	test   %eax,%eax
+    1372:	74 12                	je     1386 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    1374:	83 ec 04             	sub    $0x4,%esp
+    1377:	50                   	push   %eax
+    1378:	68 3e 15 00 00       	push   $0x153e
+    137d:	57                   	push   %edi
+    137e:	e8 1d fa ff ff       	call   da0 <struct_field_str>
+    1383:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    1386:	85 f6                	test   %esi,%esi
+    1388:	74 12                	je     139c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    138a:	83 ec 04             	sub    $0x4,%esp
+    138d:	56                   	push   %esi
+    138e:	68 45 15 00 00       	push   $0x1545
+    1393:	57                   	push   %edi
+    1394:	e8 07 fa ff ff       	call   da0 <struct_field_str>
+    1399:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    139c:	83 ec 0c             	sub    $0xc,%esp
+    139f:	57                   	push   %edi
+    13a0:	e8 bb fc ff ff       	call   1060 <struct_end>
+    13a5:	83 c4 10             	add    $0x10,%esp
+}
+    13a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13ab:	5b                   	pop    %ebx
+    13ac:	5e                   	pop    %esi
+    13ad:	5f                   	pop    %edi
+    13ae:	5d                   	pop    %ebp
+    13af:	c3                   	ret
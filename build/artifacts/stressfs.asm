@@ -0,0 +1,2187 @@
+
+build/bin/user/_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 b0 0f 00 00       	push   $0xfb0
+  44:	6a 01                	push   $0x1
+  46:	e8 c5 04 00 00       	call   510 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 f8 02 00 00       	call   35b <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 c3 0f 00 00       	push   $0xfc3
+  78:	6a 01                	push   $0x1
+  7a:	e8 91 04 00 00       	call   510 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 06 03 00 00       	call   3a3 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 cc 02 00 00       	call   383 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 c3 02 00 00       	call   38b <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 cd 0f 00 00       	push   $0xfcd
+  cf:	6a 01                	push   $0x1
+  d1:	e8 3a 04 00 00       	call   510 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 b8 02 00 00       	call   3a3 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 7c 02 00 00       	call   37b <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 7b 02 00 00       	call   38b <close>
+
+  wait();
+ 110:	e8 56 02 00 00       	call   36b <wait>
+
+  exit();
+ 115:	e8 49 02 00 00       	call   363 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 1e 01 00 00       	call   37b <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 f1 00 00 00       	call   3a3 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 f4 00 00 00       	call   3bb <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 ba 00 00 00       	call   38b <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+
+0000035b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <exit>:
+SYSCALL(exit)
+ 363:	b8 02 00 00 00       	mov    $0x2,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <wait>:
+SYSCALL(wait)
+ 36b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <pipe>:
+SYSCALL(pipe)
+ 373:	b8 04 00 00 00       	mov    $0x4,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <read>:
+SYSCALL(read)
+ 37b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <write>:
+SYSCALL(write)
+ 383:	b8 10 00 00 00       	mov    $0x10,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <close>:
+SYSCALL(close)
+ 38b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <kill>:
+SYSCALL(kill)
+ 393:	b8 06 00 00 00       	mov    $0x6,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <exec>:
+SYSCALL(exec)
+ 39b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <open>:
+SYSCALL(open)
+ 3a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <mknod>:
+SYSCALL(mknod)
+ 3ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <unlink>:
+SYSCALL(unlink)
+ 3b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <fstat>:
+SYSCALL(fstat)
+ 3bb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <link>:
+SYSCALL(link)
+ 3c3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mkdir>:
+SYSCALL(mkdir)
+ 3cb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <chdir>:
+SYSCALL(chdir)
+ 3d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <dup>:
+SYSCALL(dup)
+ 3db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <getpid>:
+SYSCALL(getpid)
+ 3e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <sbrk>:
+SYSCALL(sbrk)
+ 3eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <sleep>:
+SYSCALL(sleep)
+ 3f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <uptime>:
+SYSCALL(uptime)
+ 3fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <poll>:
+SYSCALL(poll)
+ 403:	b8 16 00 00 00       	mov    $0x16,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <fcntl>:
+SYSCALL(fcntl)
+ 40b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <lseek>:
+SYSCALL(lseek)
+ 413:	b8 18 00 00 00       	mov    $0x18,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <pread>:
+SYSCALL(pread)
+ 41b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pwrite>:
+SYSCALL(pwrite)
+ 423:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <readv>:
+SYSCALL(readv)
+ 42b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <writev>:
+SYSCALL(writev)
+ 433:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <getdents>:
+SYSCALL(getdents)
+ 43b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <splice>:
+SYSCALL(splice)
+ 443:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 44b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 453:	b8 20 00 00 00       	mov    $0x20,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <batch>:
+SYSCALL(batch)
+ 45b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+ 463:	66 90                	xchg   %ax,%ax
+ 465:	66 90                	xchg   %ax,%ax
+ 467:	66 90                	xchg   %ax,%ax
+ 469:	66 90                	xchg   %ax,%ax
+ 46b:	66 90                	xchg   %ax,%ax
+ 46d:	66 90                	xchg   %ax,%ax
+ 46f:	90                   	nop
+
+00000470 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 478:	89 d1                	mov    %edx,%ecx
+{
+ 47a:	83 ec 3c             	sub    $0x3c,%esp
+ 47d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 480:	85 d2                	test   %edx,%edx
+ 482:	0f 89 80 00 00 00    	jns    508 <printint+0x98>
+ 488:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 48c:	74 7a                	je     508 <printint+0x98>
+    x = -xx;
+ 48e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 490:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 495:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 498:	31 f6                	xor    %esi,%esi
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4a0:	89 c8                	mov    %ecx,%eax
+ 4a2:	31 d2                	xor    %edx,%edx
+ 4a4:	89 f7                	mov    %esi,%edi
+ 4a6:	f7 f3                	div    %ebx
+ 4a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4ab:	0f b6 92 34 10 00 00 	movzbl 0x1034(%edx),%edx
+ 4b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4b6:	89 ca                	mov    %ecx,%edx
+ 4b8:	89 c1                	mov    %eax,%ecx
+ 4ba:	39 da                	cmp    %ebx,%edx
+ 4bc:	73 e2                	jae    4a0 <printint+0x30>
+  if(neg)
+ 4be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4c1:	85 c0                	test   %eax,%eax
+ 4c3:	74 07                	je     4cc <printint+0x5c>
+    buf[i++] = '-';
+ 4c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ca:	89 f7                	mov    %esi,%edi
+ 4cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4d2:	01 df                	add    %ebx,%edi
+ 4d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	50                   	push   %eax
+ 4e7:	56                   	push   %esi
+ 4e8:	e8 96 fe ff ff       	call   383 <write>
+  while(--i >= 0)
+ 4ed:	89 f8                	mov    %edi,%eax
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	83 ef 01             	sub    $0x1,%edi
+ 4f5:	39 d8                	cmp    %ebx,%eax
+ 4f7:	75 df                	jne    4d8 <printint+0x68>
+}
+ 4f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4fc:	5b                   	pop    %ebx
+ 4fd:	5e                   	pop    %esi
+ 4fe:	5f                   	pop    %edi
+ 4ff:	5d                   	pop    %ebp
+ 500:	c3                   	ret
+ 501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 508:	31 c0                	xor    %eax,%eax
+ 50a:	eb 89                	jmp    495 <printint+0x25>
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 519:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 51c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 51f:	0f b6 1e             	movzbl (%esi),%ebx
+ 522:	83 c6 01             	add    $0x1,%esi
+ 525:	84 db                	test   %bl,%bl
+ 527:	74 67                	je     590 <printf+0x80>
+ 529:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 52c:	31 d2                	xor    %edx,%edx
+ 52e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 531:	eb 34                	jmp    567 <printf+0x57>
+ 533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 537:	90                   	nop
+ 538:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 53b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 540:	83 f8 25             	cmp    $0x25,%eax
+ 543:	74 18                	je     55d <printf+0x4d>
+  write(fd, &c, 1);
+ 545:	83 ec 04             	sub    $0x4,%esp
+ 548:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54e:	6a 01                	push   $0x1
+ 550:	50                   	push   %eax
+ 551:	57                   	push   %edi
+ 552:	e8 2c fe ff ff       	call   383 <write>
+ 557:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 55a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 55d:	0f b6 1e             	movzbl (%esi),%ebx
+ 560:	83 c6 01             	add    $0x1,%esi
+ 563:	84 db                	test   %bl,%bl
+ 565:	74 29                	je     590 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 567:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 56a:	85 d2                	test   %edx,%edx
+ 56c:	74 ca                	je     538 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 56e:	83 fa 25             	cmp    $0x25,%edx
+ 571:	75 ea                	jne    55d <printf+0x4d>
+      if(c == 'd'){
+ 573:	83 f8 25             	cmp    $0x25,%eax
+ 576:	0f 84 24 01 00 00    	je     6a0 <printf+0x190>
+ 57c:	83 e8 63             	sub    $0x63,%eax
+ 57f:	83 f8 15             	cmp    $0x15,%eax
+ 582:	77 1c                	ja     5a0 <printf+0x90>
+ 584:	ff 24 85 dc 0f 00 00 	jmp    *0xfdc(,%eax,4)
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5f                   	pop    %edi
+ 596:	5d                   	pop    %ebp
+ 597:	c3                   	ret
+ 598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5aa:	6a 01                	push   $0x1
+ 5ac:	52                   	push   %edx
+ 5ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5b0:	57                   	push   %edi
+ 5b1:	e8 cd fd ff ff       	call   383 <write>
+ 5b6:	83 c4 0c             	add    $0xc,%esp
+ 5b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5bc:	6a 01                	push   $0x1
+ 5be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5c1:	52                   	push   %edx
+ 5c2:	57                   	push   %edi
+ 5c3:	e8 bb fd ff ff       	call   383 <write>
+        putc(fd, c);
+ 5c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cb:	31 d2                	xor    %edx,%edx
+ 5cd:	eb 8e                	jmp    55d <printf+0x4d>
+ 5cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5db:	8b 13                	mov    (%ebx),%edx
+ 5dd:	6a 00                	push   $0x0
+ 5df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5e4:	e8 87 fe ff ff       	call   470 <printint>
+        ap++;
+ 5e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 67 ff ff ff       	jmp    55d <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 600:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 603:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 605:	83 c0 04             	add    $0x4,%eax
+ 608:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 60b:	85 db                	test   %ebx,%ebx
+ 60d:	0f 84 9d 00 00 00    	je     6b0 <printf+0x1a0>
+        while(*s != 0){
+ 613:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 616:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 618:	84 c0                	test   %al,%al
+ 61a:	0f 84 3d ff ff ff    	je     55d <printf+0x4d>
+ 620:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 623:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 626:	89 de                	mov    %ebx,%esi
+ 628:	89 d3                	mov    %edx,%ebx
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 636:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 639:	6a 01                	push   $0x1
+ 63b:	53                   	push   %ebx
+ 63c:	57                   	push   %edi
+ 63d:	e8 41 fd ff ff       	call   383 <write>
+        while(*s != 0){
+ 642:	0f b6 06             	movzbl (%esi),%eax
+ 645:	83 c4 10             	add    $0x10,%esp
+ 648:	84 c0                	test   %al,%al
+ 64a:	75 e4                	jne    630 <printf+0x120>
+      state = 0;
+ 64c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 07 ff ff ff       	jmp    55d <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 660:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 663:	83 ec 0c             	sub    $0xc,%esp
+ 666:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 66b:	8b 13                	mov    (%ebx),%edx
+ 66d:	6a 01                	push   $0x1
+ 66f:	e9 6b ff ff ff       	jmp    5df <printf+0xcf>
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 678:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 681:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 683:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 686:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	52                   	push   %edx
+ 68c:	57                   	push   %edi
+ 68d:	e8 f1 fc ff ff       	call   383 <write>
+        ap++;
+ 692:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 695:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 698:	31 d2                	xor    %edx,%edx
+ 69a:	e9 be fe ff ff       	jmp    55d <printf+0x4d>
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	e9 11 ff ff ff       	jmp    5c1 <printf+0xb1>
+ 6b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6b5:	bb d3 0f 00 00       	mov    $0xfd3,%ebx
+ 6ba:	e9 61 ff ff ff       	jmp    620 <printf+0x110>
+ 6bf:	90                   	nop
+
+000006c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c1:	a1 5c 15 00 00       	mov    0x155c,%eax
+{
+ 6c6:	89 e5                	mov    %esp,%ebp
+ 6c8:	57                   	push   %edi
+ 6c9:	56                   	push   %esi
+ 6ca:	53                   	push   %ebx
+ 6cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6dc:	39 ca                	cmp    %ecx,%edx
+ 6de:	73 30                	jae    710 <free+0x50>
+ 6e0:	39 c1                	cmp    %eax,%ecx
+ 6e2:	72 04                	jb     6e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e4:	39 c2                	cmp    %eax,%edx
+ 6e6:	72 f0                	jb     6d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ee:	39 f8                	cmp    %edi,%eax
+ 6f0:	74 2e                	je     720 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6fb:	39 f1                	cmp    %esi,%ecx
+ 6fd:	74 38                	je     737 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 701:	5b                   	pop    %ebx
+  freep = p;
+ 702:	89 15 5c 15 00 00    	mov    %edx,0x155c
+}
+ 708:	5e                   	pop    %esi
+ 709:	5f                   	pop    %edi
+ 70a:	5d                   	pop    %ebp
+ 70b:	c3                   	ret
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 710:	39 c1                	cmp    %eax,%ecx
+ 712:	72 d0                	jb     6e4 <free+0x24>
+ 714:	eb c2                	jmp    6d8 <free+0x18>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 720:	03 70 04             	add    0x4(%eax),%esi
+ 723:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 726:	8b 02                	mov    (%edx),%eax
+ 728:	8b 00                	mov    (%eax),%eax
+ 72a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 72d:	8b 42 04             	mov    0x4(%edx),%eax
+ 730:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 733:	39 f1                	cmp    %esi,%ecx
+ 735:	75 c8                	jne    6ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 737:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 73a:	89 15 5c 15 00 00    	mov    %edx,0x155c
+    p->s.size += bp->s.size;
+ 740:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 743:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 746:	89 0a                	mov    %ecx,(%edx)
+}
+ 748:	5b                   	pop    %ebx
+ 749:	5e                   	pop    %esi
+ 74a:	5f                   	pop    %edi
+ 74b:	5d                   	pop    %ebp
+ 74c:	c3                   	ret
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000750 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 759:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 75c:	8b 15 5c 15 00 00    	mov    0x155c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 762:	8d 78 07             	lea    0x7(%eax),%edi
+ 765:	c1 ef 03             	shr    $0x3,%edi
+ 768:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 76b:	85 d2                	test   %edx,%edx
+ 76d:	0f 84 8d 00 00 00    	je     800 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 773:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 775:	8b 48 04             	mov    0x4(%eax),%ecx
+ 778:	39 f9                	cmp    %edi,%ecx
+ 77a:	73 64                	jae    7e0 <malloc+0x90>
+  if(nu < 4096)
+ 77c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 781:	39 df                	cmp    %ebx,%edi
+ 783:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 786:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 78d:	eb 0a                	jmp    799 <malloc+0x49>
+ 78f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 790:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 792:	8b 48 04             	mov    0x4(%eax),%ecx
+ 795:	39 f9                	cmp    %edi,%ecx
+ 797:	73 47                	jae    7e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 799:	89 c2                	mov    %eax,%edx
+ 79b:	39 05 5c 15 00 00    	cmp    %eax,0x155c
+ 7a1:	75 ed                	jne    790 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	56                   	push   %esi
+ 7a7:	e8 3f fc ff ff       	call   3eb <sbrk>
+  if(p == (char*)-1)
+ 7ac:	83 c4 10             	add    $0x10,%esp
+ 7af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7b2:	74 1c                	je     7d0 <malloc+0x80>
+  hp->s.size = nu;
+ 7b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7b7:	83 ec 0c             	sub    $0xc,%esp
+ 7ba:	83 c0 08             	add    $0x8,%eax
+ 7bd:	50                   	push   %eax
+ 7be:	e8 fd fe ff ff       	call   6c0 <free>
+  return freep;
+ 7c3:	8b 15 5c 15 00 00    	mov    0x155c,%edx
+      if((p = morecore(nunits)) == 0)
+ 7c9:	83 c4 10             	add    $0x10,%esp
+ 7cc:	85 d2                	test   %edx,%edx
+ 7ce:	75 c0                	jne    790 <malloc+0x40>
+        return 0;
+  }
+}
+ 7d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7d3:	31 c0                	xor    %eax,%eax
+}
+ 7d5:	5b                   	pop    %ebx
+ 7d6:	5e                   	pop    %esi
+ 7d7:	5f                   	pop    %edi
+ 7d8:	5d                   	pop    %ebp
+ 7d9:	c3                   	ret
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7e0:	39 cf                	cmp    %ecx,%edi
+ 7e2:	74 4c                	je     830 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7e4:	29 f9                	sub    %edi,%ecx
+ 7e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7ef:	89 15 5c 15 00 00    	mov    %edx,0x155c
+}
+ 7f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7f8:	83 c0 08             	add    $0x8,%eax
+}
+ 7fb:	5b                   	pop    %ebx
+ 7fc:	5e                   	pop    %esi
+ 7fd:	5f                   	pop    %edi
+ 7fe:	5d                   	pop    %ebp
+ 7ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 800:	c7 05 5c 15 00 00 60 	movl   $0x1560,0x155c
+ 807:	15 00 00 
+    base.s.size = 0;
+ 80a:	b8 60 15 00 00       	mov    $0x1560,%eax
+    base.s.ptr = freep = prevp = &base;
+ 80f:	c7 05 60 15 00 00 60 	movl   $0x1560,0x1560
+ 816:	15 00 00 
+    base.s.size = 0;
+ 819:	c7 05 64 15 00 00 00 	movl   $0x0,0x1564
+ 820:	00 00 00 
+    if(p->s.size >= nunits){
+ 823:	e9 54 ff ff ff       	jmp    77c <malloc+0x2c>
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 830:	8b 08                	mov    (%eax),%ecx
+ 832:	89 0a                	mov    %ecx,(%edx)
+ 834:	eb b9                	jmp    7ef <malloc+0x9f>
+ 836:	66 90                	xchg   %ax,%ax
+ 838:	66 90                	xchg   %ax,%ax
+ 83a:	66 90                	xchg   %ax,%ax
+ 83c:	66 90                	xchg   %ax,%ax
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 1c             	sub    $0x1c,%esp
+ 849:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+ 84c:	85 c9                	test   %ecx,%ecx
+ 84e:	7e 51                	jle    8a1 <put+0x61>
+ 850:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+ 852:	8b 40 08             	mov    0x8(%eax),%eax
+ 855:	89 ce                	mov    %ecx,%esi
+ 857:	85 c0                	test   %eax,%eax
+ 859:	7e 55                	jle    8b0 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+ 85b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+ 85e:	8b 51 0c             	mov    0xc(%ecx),%edx
+ 861:	8b 79 08             	mov    0x8(%ecx),%edi
+ 864:	01 d7                	add    %edx,%edi
+ 866:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 869:	74 65                	je     8d0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+ 86b:	83 f8 20             	cmp    $0x20,%eax
+ 86e:	75 40                	jne    8b0 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	8d 43 10             	lea    0x10(%ebx),%eax
+ 876:	6a 20                	push   $0x20
+ 878:	50                   	push   %eax
+ 879:	ff 33                	push   (%ebx)
+ 87b:	e8 b3 fb ff ff       	call   433 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+ 880:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+ 883:	31 c0                	xor    %eax,%eax
+ 885:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 88a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+ 88d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 894:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ 897:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ 89a:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+ 89e:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 8a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a4:	5b                   	pop    %ebx
+ 8a5:	5e                   	pop    %esi
+ 8a6:	5f                   	pop    %edi
+ 8a7:	5d                   	pop    %ebp
+ 8a8:	c3                   	ret
+ 8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+ 8b0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+ 8b3:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 8b6:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+ 8b9:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+ 8bd:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+ 8c0:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 8c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c6:	5b                   	pop    %ebx
+ 8c7:	5e                   	pop    %esi
+ 8c8:	5f                   	pop    %edi
+ 8c9:	5d                   	pop    %ebp
+ 8ca:	c3                   	ret
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+      last->iov_len += n;
+ 8d0:	01 f2                	add    %esi,%edx
+ 8d2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+ 8d5:	eb ca                	jmp    8a1 <put+0x61>
+ 8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	89 d7                	mov    %edx,%edi
+ 8e6:	56                   	push   %esi
+ 8e7:	89 ce                	mov    %ecx,%esi
+ 8e9:	53                   	push   %ebx
+ 8ea:	89 c3                	mov    %eax,%ebx
+ 8ec:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+ 8ef:	8b 40 0c             	mov    0xc(%eax),%eax
+ 8f2:	8b 53 08             	mov    0x8(%ebx),%edx
+ 8f5:	01 c1                	add    %eax,%ecx
+ 8f7:	83 f9 40             	cmp    $0x40,%ecx
+ 8fa:	7f 3c                	jg     938 <putcopy+0x58>
+ 8fc:	83 fa 20             	cmp    $0x20,%edx
+ 8ff:	74 3f                	je     940 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+ 901:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+ 907:	83 ec 04             	sub    $0x4,%esp
+ 90a:	01 d0                	add    %edx,%eax
+ 90c:	56                   	push   %esi
+ 90d:	57                   	push   %edi
+ 90e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 911:	50                   	push   %eax
+ 912:	e8 19 fa ff ff       	call   330 <memmove>
+  put(w, w->buf + w->nbuf, n);
+ 917:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 91a:	89 f1                	mov    %esi,%ecx
+ 91c:	03 53 0c             	add    0xc(%ebx),%edx
+ 91f:	89 d8                	mov    %ebx,%eax
+ 921:	e8 1a ff ff ff       	call   840 <put>
+  w->nbuf += n;
+ 926:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+ 929:	83 c4 10             	add    $0x10,%esp
+ 92c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 92f:	5b                   	pop    %ebx
+ 930:	5e                   	pop    %esi
+ 931:	5f                   	pop    %edi
+ 932:	5d                   	pop    %ebp
+ 933:	c3                   	ret
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+ 938:	85 d2                	test   %edx,%edx
+ 93a:	7e 16                	jle    952 <putcopy+0x72>
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 43 10             	lea    0x10(%ebx),%eax
+ 946:	52                   	push   %edx
+ 947:	50                   	push   %eax
+ 948:	ff 33                	push   (%ebx)
+ 94a:	e8 e4 fa ff ff       	call   433 <writev>
+ 94f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+ 952:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 959:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+ 95b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 962:	eb 9d                	jmp    901 <putcopy+0x21>
+ 964:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+
+00000970 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+ 976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+ 979:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+ 980:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+ 982:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+ 989:	c7 40 10 45 10 00 00 	movl   $0x1045,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+ 990:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+ 997:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+ 99e:	5d                   	pop    %ebp
+ 99f:	c3                   	ret
+
+000009a0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 1c             	sub    $0x1c,%esp
+ 9a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 9ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 9af:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+ 9b2:	8b 47 04             	mov    0x4(%edi),%eax
+ 9b5:	85 c0                	test   %eax,%eax
+ 9b7:	0f 85 7b 01 00 00    	jne    b38 <struct_field_str+0x198>
+    w->need_comma = 1;
+ 9bd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ 9c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 9c9:	ba 5a 10 00 00       	mov    $0x105a,%edx
+ 9ce:	89 f8                	mov    %edi,%eax
+ 9d0:	e8 6b fe ff ff       	call   840 <put>
+  put_str(w, key ? key : "");
+ 9d5:	85 db                	test   %ebx,%ebx
+ 9d7:	b8 cc 0f 00 00       	mov    $0xfcc,%eax
+ 9dc:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ 9df:	83 ec 0c             	sub    $0xc,%esp
+ 9e2:	53                   	push   %ebx
+ 9e3:	e8 c8 f7 ff ff       	call   1b0 <strlen>
+ 9e8:	89 da                	mov    %ebx,%edx
+ 9ea:	89 c1                	mov    %eax,%ecx
+ 9ec:	89 f8                	mov    %edi,%eax
+ 9ee:	e8 4d fe ff ff       	call   840 <put>
+  put(w, "\":\"", 3);
+ 9f3:	b9 03 00 00 00       	mov    $0x3,%ecx
+ 9f8:	ba 58 10 00 00       	mov    $0x1058,%edx
+ 9fd:	89 f8                	mov    %edi,%eax
+ 9ff:	e8 3c fe ff ff       	call   840 <put>
+  put_escaped(w, value ? value : "");
+ a04:	83 c4 10             	add    $0x10,%esp
+ a07:	85 f6                	test   %esi,%esi
+ a09:	0f 84 41 01 00 00    	je     b50 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+ a0f:	0f b6 1e             	movzbl (%esi),%ebx
+ a12:	89 f2                	mov    %esi,%edx
+ a14:	84 db                	test   %bl,%bl
+ a16:	0f 84 40 01 00 00    	je     b5c <struct_field_str+0x1bc>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ a20:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+ a22:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+ a25:	80 fb 0d             	cmp    $0xd,%bl
+ a28:	74 7e                	je     aa8 <struct_field_str+0x108>
+ a2a:	7f 5c                	jg     a88 <struct_field_str+0xe8>
+ a2c:	80 fb 09             	cmp    $0x9,%bl
+ a2f:	0f 84 eb 00 00 00    	je     b20 <struct_field_str+0x180>
+ a35:	80 fb 0a             	cmp    $0xa,%bl
+ a38:	0f 85 95 00 00 00    	jne    ad3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ a3e:	29 d1                	sub    %edx,%ecx
+ a40:	89 f8                	mov    %edi,%eax
+ a42:	e8 f9 fd ff ff       	call   840 <put>
+      esc = "\\n";
+ a47:	ba 53 10 00 00       	mov    $0x1053,%edx
+      put(w, esc, 2);
+ a4c:	b9 02 00 00 00       	mov    $0x2,%ecx
+ a51:	89 f8                	mov    %edi,%eax
+ a53:	e8 e8 fd ff ff       	call   840 <put>
+    run = s + 1;
+ a58:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+ a5a:	0f b6 1e             	movzbl (%esi),%ebx
+ a5d:	84 db                	test   %bl,%bl
+ a5f:	75 bf                	jne    a20 <struct_field_str+0x80>
+  put(w, run, s - run);
+ a61:	29 d6                	sub    %edx,%esi
+ a63:	89 f1                	mov    %esi,%ecx
+ a65:	89 f8                	mov    %edi,%eax
+ a67:	e8 d4 fd ff ff       	call   840 <put>
+  put(w, "\"", 1);
+}
+ a6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+ a6f:	89 f8                	mov    %edi,%eax
+ a71:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+ a76:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+ a77:	ba 5a 10 00 00       	mov    $0x105a,%edx
+}
+ a7c:	5e                   	pop    %esi
+ a7d:	5f                   	pop    %edi
+ a7e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+ a7f:	e9 bc fd ff ff       	jmp    840 <put>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ a88:	80 fb 22             	cmp    $0x22,%bl
+ a8b:	74 33                	je     ac0 <struct_field_str+0x120>
+ a8d:	80 fb 5c             	cmp    $0x5c,%bl
+ a90:	75 41                	jne    ad3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ a92:	29 d1                	sub    %edx,%ecx
+ a94:	89 f8                	mov    %edi,%eax
+ a96:	e8 a5 fd ff ff       	call   840 <put>
+      esc = "\\\\";
+ a9b:	ba 47 10 00 00       	mov    $0x1047,%edx
+ aa0:	eb aa                	jmp    a4c <struct_field_str+0xac>
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+ aa8:	29 d1                	sub    %edx,%ecx
+ aaa:	89 f8                	mov    %edi,%eax
+ aac:	e8 8f fd ff ff       	call   840 <put>
+      esc = "\\r";
+ ab1:	ba 50 10 00 00       	mov    $0x1050,%edx
+ ab6:	eb 94                	jmp    a4c <struct_field_str+0xac>
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+    put(w, run, s - run);
+ ac0:	29 d1                	sub    %edx,%ecx
+ ac2:	89 f8                	mov    %edi,%eax
+ ac4:	e8 77 fd ff ff       	call   840 <put>
+      esc = "\\\"";
+ ac9:	ba 4a 10 00 00       	mov    $0x104a,%edx
+ ace:	e9 79 ff ff ff       	jmp    a4c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+ ad3:	80 fb 1f             	cmp    $0x1f,%bl
+ ad6:	77 82                	ja     a5a <struct_field_str+0xba>
+    put(w, run, s - run);
+ ad8:	29 d1                	sub    %edx,%ecx
+ ada:	89 f8                	mov    %edi,%eax
+ adc:	e8 5f fd ff ff       	call   840 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+ ae1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+ ae3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+ ae6:	0f b7 05 74 10 00 00 	movzwl 0x1074,%eax
+ aed:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+ af0:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+ af5:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+ afc:	0f b6 d2             	movzbl %dl,%edx
+ aff:	8a 82 5c 10 00 00    	mov    0x105c(%edx),%al
+ b05:	8a a3 5c 10 00 00    	mov    0x105c(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+ b0b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+ b0e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+ b12:	89 f8                	mov    %edi,%eax
+ b14:	e8 c7 fd ff ff       	call   8e0 <putcopy>
+ b19:	e9 3a ff ff ff       	jmp    a58 <struct_field_str+0xb8>
+ b1e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+ b20:	29 d1                	sub    %edx,%ecx
+ b22:	89 f8                	mov    %edi,%eax
+ b24:	e8 17 fd ff ff       	call   840 <put>
+      esc = "\\t";
+ b29:	ba 4d 10 00 00       	mov    $0x104d,%edx
+ b2e:	e9 19 ff ff ff       	jmp    a4c <struct_field_str+0xac>
+ b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b37:	90                   	nop
+    put(w, ",", 1);
+ b38:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b3d:	ba 56 10 00 00       	mov    $0x1056,%edx
+ b42:	89 f8                	mov    %edi,%eax
+ b44:	e8 f7 fc ff ff       	call   840 <put>
+}
+ b49:	e9 76 fe ff ff       	jmp    9c4 <struct_field_str+0x24>
+ b4e:	66 90                	xchg   %ax,%ax
+ b50:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+ b52:	ba cc 0f 00 00       	mov    $0xfcc,%edx
+ b57:	e9 09 ff ff ff       	jmp    a65 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+ b5c:	31 c9                	xor    %ecx,%ecx
+ b5e:	e9 02 ff ff ff       	jmp    a65 <struct_field_str+0xc5>
+ b63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b70 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+ b76:	83 ec 1c             	sub    $0x1c,%esp
+ b79:	8b 7d 08             	mov    0x8(%ebp),%edi
+ b7c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+ b7f:	8b 57 04             	mov    0x4(%edi),%edx
+ b82:	85 d2                	test   %edx,%edx
+ b84:	0f 85 b6 00 00 00    	jne    c40 <struct_field_int+0xd0>
+    w->need_comma = 1;
+ b8a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ b91:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b96:	ba 5a 10 00 00       	mov    $0x105a,%edx
+ b9b:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+ b9d:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+ ba2:	e8 99 fc ff ff       	call   840 <put>
+  put_str(w, key ? key : "");
+ ba7:	85 db                	test   %ebx,%ebx
+ ba9:	b8 cc 0f 00 00       	mov    $0xfcc,%eax
+ bae:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ bb1:	83 ec 0c             	sub    $0xc,%esp
+ bb4:	53                   	push   %ebx
+ bb5:	e8 f6 f5 ff ff       	call   1b0 <strlen>
+ bba:	89 da                	mov    %ebx,%edx
+ bbc:	89 c1                	mov    %eax,%ecx
+ bbe:	89 f8                	mov    %edi,%eax
+ bc0:	e8 7b fc ff ff       	call   840 <put>
+  put(w, "\":", 2);
+ bc5:	b9 02 00 00 00       	mov    $0x2,%ecx
+ bca:	ba 6d 10 00 00       	mov    $0x106d,%edx
+ bcf:	89 f8                	mov    %edi,%eax
+ bd1:	e8 6a fc ff ff       	call   840 <put>
+  x = value < 0 ? -(uint)value : value;
+ bd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+ bd9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	f7 d9                	neg    %ecx
+ be1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+ be5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+ be8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ bed:	89 f3                	mov    %esi,%ebx
+ bef:	83 ee 01             	sub    $0x1,%esi
+ bf2:	f7 e1                	mul    %ecx
+ bf4:	89 c8                	mov    %ecx,%eax
+ bf6:	c1 ea 03             	shr    $0x3,%edx
+ bf9:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ bfc:	01 ff                	add    %edi,%edi
+ bfe:	29 f8                	sub    %edi,%eax
+ c00:	83 c0 30             	add    $0x30,%eax
+ c03:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ c07:	89 c8                	mov    %ecx,%eax
+ c09:	89 d1                	mov    %edx,%ecx
+ c0b:	83 f8 09             	cmp    $0x9,%eax
+ c0e:	77 d8                	ja     be8 <struct_field_int+0x78>
+  if(value < 0)
+ c10:	8b 45 10             	mov    0x10(%ebp),%eax
+ c13:	8b 7d 08             	mov    0x8(%ebp),%edi
+ c16:	85 c0                	test   %eax,%eax
+ c18:	79 08                	jns    c22 <struct_field_int+0xb2>
+    buf[--i] = '-';
+ c1a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+ c1f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+ c22:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ c25:	b9 0c 00 00 00       	mov    $0xc,%ecx
+ c2a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+ c2d:	29 f1                	sub    %esi,%ecx
+ c2f:	89 f8                	mov    %edi,%eax
+ c31:	e8 aa fc ff ff       	call   8e0 <putcopy>
+  put_int(w, value);
+}
+ c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c39:	5b                   	pop    %ebx
+ c3a:	5e                   	pop    %esi
+ c3b:	5f                   	pop    %edi
+ c3c:	5d                   	pop    %ebp
+ c3d:	c3                   	ret
+ c3e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+ c40:	b9 01 00 00 00       	mov    $0x1,%ecx
+ c45:	ba 56 10 00 00       	mov    $0x1056,%edx
+ c4a:	89 f8                	mov    %edi,%eax
+ c4c:	e8 ef fb ff ff       	call   840 <put>
+}
+ c51:	e9 3b ff ff ff       	jmp    b91 <struct_field_int+0x21>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	56                   	push   %esi
+ c64:	53                   	push   %ebx
+ c65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+ c68:	8b 43 08             	mov    0x8(%ebx),%eax
+ c6b:	85 c0                	test   %eax,%eax
+ c6d:	7e 59                	jle    cc8 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+ c6f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+ c72:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ c75:	8b 72 08             	mov    0x8(%edx),%esi
+ c78:	01 ce                	add    %ecx,%esi
+ c7a:	81 fe 70 10 00 00    	cmp    $0x1070,%esi
+ c80:	0f 84 aa 00 00 00    	je     d30 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+ c86:	83 f8 20             	cmp    $0x20,%eax
+ c89:	75 75                	jne    d00 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+ c8b:	83 ec 04             	sub    $0x4,%esp
+ c8e:	8d 73 10             	lea    0x10(%ebx),%esi
+ c91:	6a 20                	push   $0x20
+ c93:	56                   	push   %esi
+ c94:	ff 33                	push   (%ebx)
+ c96:	e8 98 f7 ff ff       	call   433 <writev>
+  w->nbuf = 0;
+ c9b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+ ca2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ ca5:	c7 43 10 70 10 00 00 	movl   $0x1070,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+ cac:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+ cb3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+ cba:	ba 01 00 00 00       	mov    $0x1,%edx
+ cbf:	eb 5a                	jmp    d1b <struct_end+0xbb>
+ cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+ cc8:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ ccb:	83 c0 02             	add    $0x2,%eax
+ cce:	c7 04 c3 70 10 00 00 	movl   $0x1070,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ cd5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ cdc:	00 
+  w->niov++;
+ cdd:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+ ce0:	83 fa 01             	cmp    $0x1,%edx
+ ce3:	74 58                	je     d3d <struct_end+0xdd>
+  w->niov = 0;
+ ce5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+ cec:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+ cf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cf6:	5b                   	pop    %ebx
+ cf7:	5e                   	pop    %esi
+ cf8:	5d                   	pop    %ebp
+ cf9:	c3                   	ret
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+ d00:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ d03:	83 c0 02             	add    $0x2,%eax
+ d06:	8d 73 10             	lea    0x10(%ebx),%esi
+ d09:	c7 04 c3 70 10 00 00 	movl   $0x1070,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ d10:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ d17:	00 
+  w->niov++;
+ d18:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+ d1b:	83 ec 04             	sub    $0x4,%esp
+ d1e:	52                   	push   %edx
+ d1f:	56                   	push   %esi
+ d20:	ff 33                	push   (%ebx)
+ d22:	e8 0c f7 ff ff       	call   433 <writev>
+ d27:	83 c4 10             	add    $0x10,%esp
+ d2a:	eb b9                	jmp    ce5 <struct_end+0x85>
+ d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+ d30:	83 c1 02             	add    $0x2,%ecx
+ d33:	8d 73 10             	lea    0x10(%ebx),%esi
+ d36:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+ d39:	89 c2                	mov    %eax,%edx
+ d3b:	eb de                	jmp    d1b <struct_end+0xbb>
+ d3d:	8d 73 10             	lea    0x10(%ebx),%esi
+ d40:	e9 75 ff ff ff       	jmp    cba <struct_end+0x5a>
+ d45:	66 90                	xchg   %ax,%ax
+ d47:	66 90                	xchg   %ax,%ax
+ d49:	66 90                	xchg   %ax,%ax
+ d4b:	66 90                	xchg   %ax,%ax
+ d4d:	66 90                	xchg   %ax,%ax
+ d4f:	90                   	nop
+
+00000d50 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	56                   	push   %esi
+ d54:	89 c6                	mov    %eax,%esi
+ d56:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+ d57:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+ d5d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+ d63:	6a 01                	push   $0x1
+ d65:	53                   	push   %ebx
+ d66:	e8 05 fc ff ff       	call   970 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ d6b:	83 c4 0c             	add    $0xc,%esp
+ d6e:	56                   	push   %esi
+ d6f:	68 76 10 00 00       	push   $0x1076
+ d74:	53                   	push   %ebx
+ d75:	e8 26 fc ff ff       	call   9a0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+ d7a:	83 c4 0c             	add    $0xc,%esp
+ d7d:	68 7e 10 00 00       	push   $0x107e
+ d82:	68 8f 10 00 00       	push   $0x108f
+ d87:	53                   	push   %ebx
+ d88:	e8 13 fc ff ff       	call   9a0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+ d8d:	83 c4 0c             	add    $0xc,%esp
+ d90:	68 ea 07 00 00       	push   $0x7ea
+ d95:	68 96 10 00 00       	push   $0x1096
+ d9a:	53                   	push   %ebx
+ d9b:	e8 d0 fd ff ff       	call   b70 <struct_field_int>
+  struct_end(&w);
+ da0:	89 1c 24             	mov    %ebx,(%esp)
+ da3:	e8 b8 fe ff ff       	call   c60 <struct_end>
+ da8:	83 c4 10             	add    $0x10,%esp
+}
+ dab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ dae:	5b                   	pop    %ebx
+ daf:	5e                   	pop    %esi
+ db0:	5d                   	pop    %ebp
+ db1:	c3                   	ret
+ db2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000dc0 <modern_consume_flags>:
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	57                   	push   %edi
+ dc4:	56                   	push   %esi
+ dc5:	53                   	push   %ebx
+ dc6:	83 ec 0c             	sub    $0xc,%esp
+ dc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+ dcc:	85 f6                	test   %esi,%esi
+ dce:	74 06                	je     dd6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+ dd0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+ dd6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+ dda:	bf 01 00 00 00       	mov    $0x1,%edi
+ ddf:	7e 4c                	jle    e2d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+ de1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+ de4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+ de7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+ dea:	68 9b 10 00 00       	push   $0x109b
+ def:	53                   	push   %ebx
+ df0:	e8 5b f3 ff ff       	call   150 <strcmp>
+ df5:	83 c4 10             	add    $0x10,%esp
+ df8:	85 c0                	test   %eax,%eax
+ dfa:	74 58                	je     e54 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+ dfc:	8b 45 14             	mov    0x14(%ebp),%eax
+ dff:	85 c0                	test   %eax,%eax
+ e01:	74 2a                	je     e2d <modern_consume_flags+0x6d>
+ e03:	83 ec 08             	sub    $0x8,%esp
+ e06:	68 b3 10 00 00       	push   $0x10b3
+ e0b:	53                   	push   %ebx
+ e0c:	e8 3f f3 ff ff       	call   150 <strcmp>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	85 c0                	test   %eax,%eax
+ e16:	74 28                	je     e40 <modern_consume_flags+0x80>
+ e18:	83 ec 08             	sub    $0x8,%esp
+ e1b:	68 b6 10 00 00       	push   $0x10b6
+ e20:	53                   	push   %ebx
+ e21:	e8 2a f3 ff ff       	call   150 <strcmp>
+ e26:	83 c4 10             	add    $0x10,%esp
+ e29:	85 c0                	test   %eax,%eax
+ e2b:	74 13                	je     e40 <modern_consume_flags+0x80>
+}
+ e2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e30:	89 f8                	mov    %edi,%eax
+ e32:	5b                   	pop    %ebx
+ e33:	5e                   	pop    %esi
+ e34:	5f                   	pop    %edi
+ e35:	5d                   	pop    %ebp
+ e36:	c3                   	ret
+ e37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+ e40:	85 f6                	test   %esi,%esi
+ e42:	74 06                	je     e4a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+ e44:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+ e4a:	83 c7 01             	add    $0x1,%edi
+ e4d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ e50:	75 8f                	jne    de1 <modern_consume_flags+0x21>
+ e52:	eb d9                	jmp    e2d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+ e54:	85 f6                	test   %esi,%esi
+ e56:	74 12                	je     e6a <modern_consume_flags+0xaa>
+  if(!json_mode){
+ e58:	83 3e 00             	cmpl   $0x0,(%esi)
+ e5b:	74 0d                	je     e6a <modern_consume_flags+0xaa>
+ e5d:	8b 45 08             	mov    0x8(%ebp),%eax
+ e60:	e8 eb fe ff ff       	call   d50 <modern_print_version.part.0>
+      exit();
+ e65:	e8 f9 f4 ff ff       	call   363 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ e6a:	83 ec 0c             	sub    $0xc,%esp
+ e6d:	68 ea 07 00 00       	push   $0x7ea
+ e72:	68 7e 10 00 00       	push   $0x107e
+ e77:	ff 75 08             	push   0x8(%ebp)
+ e7a:	68 a5 10 00 00       	push   $0x10a5
+ e7f:	6a 01                	push   $0x1
+ e81:	e8 8a f6 ff ff       	call   510 <printf>
+}
+ e86:	83 c4 20             	add    $0x20,%esp
+ e89:	eb da                	jmp    e65 <modern_consume_flags+0xa5>
+ e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e8f:	90                   	nop
+
+00000e90 <modern_print_version>:
+{
+ e90:	55                   	push   %ebp
+ e91:	89 e5                	mov    %esp,%ebp
+ e93:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+ e96:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+ e99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+ e9c:	85 d2                	test   %edx,%edx
+ e9e:	74 10                	je     eb0 <modern_print_version+0x20>
+}
+ ea0:	c9                   	leave
+ ea1:	e9 aa fe ff ff       	jmp    d50 <modern_print_version.part.0>
+ ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ead:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ eb0:	83 ec 0c             	sub    $0xc,%esp
+ eb3:	68 ea 07 00 00       	push   $0x7ea
+ eb8:	68 7e 10 00 00       	push   $0x107e
+ ebd:	50                   	push   %eax
+ ebe:	68 a5 10 00 00       	push   $0x10a5
+ ec3:	6a 01                	push   $0x1
+ ec5:	e8 46 f6 ff ff       	call   510 <printf>
+}
+ eca:	83 c4 20             	add    $0x20,%esp
+}
+ ecd:	c9                   	leave
+ ece:	c3                   	ret
+ ecf:	90                   	nop
+
+00000ed0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+ ed0:	55                   	push   %ebp
+ ed1:	89 e5                	mov    %esp,%ebp
+ ed3:	57                   	push   %edi
+ ed4:	56                   	push   %esi
+ ed5:	53                   	push   %ebx
+ ed6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+ edc:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+ edf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ ee2:	8b 45 10             	mov    0x10(%ebp),%eax
+ ee5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+ ee8:	85 d2                	test   %edx,%edx
+ eea:	75 44                	jne    f30 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+ eec:	85 f6                	test   %esi,%esi
+ eee:	ba bd 10 00 00       	mov    $0x10bd,%edx
+ ef3:	0f 44 f2             	cmove  %edx,%esi
+ ef6:	85 c0                	test   %eax,%eax
+ ef8:	ba cc 0f 00 00       	mov    $0xfcc,%edx
+ efd:	0f 44 c2             	cmove  %edx,%eax
+ f00:	85 db                	test   %ebx,%ebx
+ f02:	ba c2 10 00 00       	mov    $0x10c2,%edx
+ f07:	0f 44 da             	cmove  %edx,%ebx
+ f0a:	83 ec 08             	sub    $0x8,%esp
+ f0d:	56                   	push   %esi
+ f0e:	50                   	push   %eax
+ f0f:	53                   	push   %ebx
+ f10:	ff 75 08             	push   0x8(%ebp)
+ f13:	68 c8 10 00 00       	push   $0x10c8
+ f18:	6a 01                	push   $0x1
+ f1a:	e8 f1 f5 ff ff       	call   510 <printf>
+ f1f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+ f22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ f25:	5b                   	pop    %ebx
+ f26:	5e                   	pop    %esi
+ f27:	5f                   	pop    %edi
+ f28:	5d                   	pop    %ebp
+ f29:	c3                   	ret
+ f2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+ f30:	83 ec 08             	sub    $0x8,%esp
+ f33:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+ f39:	89 45 10             	mov    %eax,0x10(%ebp)
+ f3c:	6a 01                	push   $0x1
+ f3e:	57                   	push   %edi
+ f3f:	e8 2c fa ff ff       	call   970 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ f44:	83 c4 0c             	add    $0xc,%esp
+ f47:	ff 75 08             	push   0x8(%ebp)
+ f4a:	68 76 10 00 00       	push   $0x1076
+ f4f:	57                   	push   %edi
+ f50:	e8 4b fa ff ff       	call   9a0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+ f55:	83 c4 0c             	add    $0xc,%esp
+ f58:	ba c2 10 00 00       	mov    $0x10c2,%edx
+ f5d:	85 db                	test   %ebx,%ebx
+ f5f:	0f 44 da             	cmove  %edx,%ebx
+ f62:	53                   	push   %ebx
+ f63:	52                   	push   %edx
+ f64:	57                   	push   %edi
+ f65:	e8 36 fa ff ff       	call   9a0 <struct_field_str>
+  if(target)
+ f6a:	8b 45 10             	mov    0x10(%ebp),%eax
+ f6d:	83 c4 10             	add    $0x10,%esp
+ f70:	85 c0                	test   %eax,%eax
+ f72:	74 12                	je     f86 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+ f74:	83 ec 04             	sub    $0x4,%esp
+ f77:	50                   	push   %eax
+ f78:	68 d6 10 00 00       	push   $0x10d6
+ f7d:	57                   	push   %edi
+ f7e:	e8 1d fa ff ff       	call   9a0 <struct_field_str>
+ f83:	83 c4 10             	add    $0x10,%esp
+  if(status)
+ f86:	85 f6                	test   %esi,%esi
+ f88:	74 12                	je     f9c <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+ f8a:	83 ec 04             	sub    $0x4,%esp
+ f8d:	56                   	push   %esi
+ f8e:	68 dd 10 00 00       	push   $0x10dd
+ f93:	57                   	push   %edi
+ f94:	e8 07 fa ff ff       	call   9a0 <struct_field_str>
+ f99:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+ f9c:	83 ec 0c             	sub    $0xc,%esp
+ f9f:	57                   	push   %edi
+ fa0:	e8 bb fc ff ff       	call   c60 <struct_end>
+ fa5:	83 c4 10             	add    $0x10,%esp
+}
+ fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ fab:	5b                   	pop    %ebx
+ fac:	5e                   	pop    %esi
+ fad:	5f                   	pop    %edi
+ fae:	5d                   	pop    %ebp
+ faf:	c3                   	ret
@@ -0,0 +1,3690 @@
+
+build/bin/user/_ted:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+static void editor_copy(char *dst, const char *src, int max);
+static void emit_error(const char *msg);
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 94 02 00 00    	sub    $0x294,%esp
+      17:	8b 19                	mov    (%ecx),%ebx
+      19:	8b 71 04             	mov    0x4(%ecx),%esi
+  int argi = modern_consume_flags("hello-edit", argc, argv, 1, &json_mode);
+      1c:	68 40 28 00 00       	push   $0x2840
+      21:	6a 01                	push   $0x1
+      23:	56                   	push   %esi
+      24:	53                   	push   %ebx
+      25:	68 cc 1e 00 00       	push   $0x1ecc
+      2a:	e8 a1 1c 00 00       	call   1cd0 <modern_consume_flags>
+
+  if(argi < argc)
+      2f:	83 c4 20             	add    $0x20,%esp
+      32:	39 c3                	cmp    %eax,%ebx
+      34:	0f 8f 43 05 00 00    	jg     57d <main+0x57d>
+    set_filename(argv[argi]);
+
+  if(current_file[0])
+      3a:	80 3d 60 28 00 00 00 	cmpb   $0x0,0x2860
+      41:	0f 85 27 05 00 00    	jne    56e <main+0x56e>
+      47:	8d b5 98 fd ff ff    	lea    -0x268(%ebp),%esi
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+
+static void
+editor_prompt(void)
+{
+  if(json_mode){
+      50:	a1 40 28 00 00       	mov    0x2840,%eax
+      55:	85 c0                	test   %eax,%eax
+      57:	0f 85 7b 02 00 00    	jne    2d8 <main+0x2d8>
+    struct_field_str(&w, "file", current_file);
+    struct_field_int(&w, "lines", line_count);
+    struct_field_int(&w, "dirty", dirty);
+    struct_end(&w);
+  } else {
+    printf(1, "edit(%s%s) > ", current_file[0] ? current_file : "(new)", dirty ? "*" : "");
+      5d:	a1 e0 28 00 00       	mov    0x28e0,%eax
+      62:	ba df 1e 00 00       	mov    $0x1edf,%edx
+      67:	b9 60 28 00 00       	mov    $0x2860,%ecx
+      6c:	85 c0                	test   %eax,%eax
+      6e:	b8 27 1f 00 00       	mov    $0x1f27,%eax
+      73:	0f 45 d0             	cmovne %eax,%edx
+      76:	80 3d 60 28 00 00 00 	cmpb   $0x0,0x2860
+      7d:	b8 29 1f 00 00       	mov    $0x1f29,%eax
+      82:	0f 45 c1             	cmovne %ecx,%eax
+      85:	52                   	push   %edx
+      86:	50                   	push   %eax
+      87:	68 3c 1f 00 00       	push   $0x1f3c
+      8c:	6a 01                	push   $0x1
+      8e:	e8 8d 13 00 00       	call   1420 <printf>
+      93:	83 c4 10             	add    $0x10,%esp
+    if(gets(buf, sizeof(buf)) == 0)
+      96:	83 ec 08             	sub    $0x8,%esp
+      99:	68 00 01 00 00       	push   $0x100
+      9e:	56                   	push   %esi
+      9f:	e8 ac 10 00 00       	call   1150 <gets>
+      a4:	83 c4 10             	add    $0x10,%esp
+      a7:	85 c0                	test   %eax,%eax
+      a9:	0f 84 62 03 00 00    	je     411 <main+0x411>
+}
+
+static void
+trim(char *s)
+{
+  int n = strlen(s);
+      af:	83 ec 0c             	sub    $0xc,%esp
+      b2:	56                   	push   %esi
+      b3:	e8 08 10 00 00       	call   10c0 <strlen>
+  while(n > 0 && (s[n-1] == '\n' || s[n-1] == '\r' || s[n-1] == ' ' || s[n-1] == '\t'))
+      b8:	83 c4 10             	add    $0x10,%esp
+      bb:	85 c0                	test   %eax,%eax
+      bd:	7e 18                	jle    d7 <main+0xd7>
+      bf:	8d 44 06 ff          	lea    -0x1(%esi,%eax,1),%eax
+      c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c7:	90                   	nop
+      c8:	0f b6 38             	movzbl (%eax),%edi
+      cb:	8d 57 f7             	lea    -0x9(%edi),%edx
+      ce:	80 fa 17             	cmp    $0x17,%dl
+      d1:	0f 86 d9 01 00 00    	jbe    2b0 <main+0x2b0>
+  while(*s == ' ' || *s == '\t')
+      d7:	0f b6 85 98 fd ff ff 	movzbl -0x268(%ebp),%eax
+      de:	89 f3                	mov    %esi,%ebx
+      e0:	3c 09                	cmp    $0x9,%al
+      e2:	74 0c                	je     f0 <main+0xf0>
+      e4:	3c 20                	cmp    $0x20,%al
+      e6:	75 17                	jne    ff <main+0xff>
+      e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ef:	90                   	nop
+      f0:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    s++;
+      f4:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t')
+      f7:	3c 20                	cmp    $0x20,%al
+      f9:	74 f5                	je     f0 <main+0xf0>
+      fb:	3c 09                	cmp    $0x9,%al
+      fd:	74 f1                	je     f0 <main+0xf0>
+    if(line[0] == 0)
+      ff:	84 c0                	test   %al,%al
+     101:	0f 84 49 ff ff ff    	je     50 <main+0x50>
+}
+
+static int
+begin_with_digit(const char *s)
+{
+  return *s >= '0' && *s <= '9';
+     107:	8d 50 d0             	lea    -0x30(%eax),%edx
+    if(begin_with_digit(line)){
+     10a:	80 fa 09             	cmp    $0x9,%dl
+     10d:	0f 86 13 03 00 00    	jbe    426 <main+0x426>
+    if(line[0] == 'q' && line[1] == '!' && line[2] == 0){
+     113:	3c 71                	cmp    $0x71,%al
+     115:	0f 84 c5 02 00 00    	je     3e0 <main+0x3e0>
+    if((line[0] == 'q' || line[0] == 'Q') && line[1] == 0){
+     11b:	3c 51                	cmp    $0x51,%al
+     11d:	0f 84 fd 02 00 00    	je     420 <main+0x420>
+
+static void
+to_upper(char *dst, const char *src, int max)
+{
+  int i = 0;
+  while(src[i] && src[i] != ' ' && src[i] != '\t' && i < max-1){
+     123:	0f b6 03             	movzbl (%ebx),%eax
+     126:	a8 df                	test   $0xdf,%al
+     128:	0f 84 84 04 00 00    	je     5b2 <main+0x5b2>
+     12e:	31 d2                	xor    %edx,%edx
+     130:	89 df                	mov    %ebx,%edi
+     132:	3c 09                	cmp    $0x9,%al
+     134:	75 0e                	jne    144 <main+0x144>
+     136:	e9 77 04 00 00       	jmp    5b2 <main+0x5b2>
+     13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     13f:	90                   	nop
+     140:	a8 df                	test   $0xdf,%al
+     142:	74 29                	je     16d <main+0x16d>
+    char c = src[i];
+    if(c >= 'a' && c <= 'z')
+     144:	8d 58 9f             	lea    -0x61(%eax),%ebx
+      c -= 32;
+     147:	8d 48 e0             	lea    -0x20(%eax),%ecx
+     14a:	80 fb 1a             	cmp    $0x1a,%bl
+     14d:	0f 42 c1             	cmovb  %ecx,%eax
+    dst[i++] = c;
+     150:	83 c2 01             	add    $0x1,%edx
+  while(src[i] && src[i] != ' ' && src[i] != '\t' && i < max-1){
+     153:	83 fa 0f             	cmp    $0xf,%edx
+    dst[i++] = c;
+     156:	88 84 15 77 fd ff ff 	mov    %al,-0x289(%ebp,%edx,1)
+  while(src[i] && src[i] != ' ' && src[i] != '\t' && i < max-1){
+     15d:	0f b6 04 17          	movzbl (%edi,%edx,1),%eax
+     161:	0f 95 c3             	setne  %bl
+     164:	3c 09                	cmp    $0x9,%al
+     166:	0f 95 c1             	setne  %cl
+     169:	84 cb                	test   %cl,%bl
+     16b:	75 d3                	jne    140 <main+0x140>
+  }
+  dst[i] = 0;
+     16d:	c6 84 15 78 fd ff ff 	movb   $0x0,-0x288(%ebp,%edx,1)
+     174:	00 
+     175:	89 fb                	mov    %edi,%ebx
+  while(*args && *args != ' ' && *args != '\t')
+     177:	eb 0b                	jmp    184 <main+0x184>
+     179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     180:	3c 09                	cmp    $0x9,%al
+     182:	74 1c                	je     1a0 <main+0x1a0>
+     184:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    args++;
+     188:	83 c3 01             	add    $0x1,%ebx
+  while(*args && *args != ' ' && *args != '\t')
+     18b:	a8 df                	test   $0xdf,%al
+     18d:	75 f1                	jne    180 <main+0x180>
+  while(*s == ' ' || *s == '\t')
+     18f:	3c 09                	cmp    $0x9,%al
+     191:	74 0d                	je     1a0 <main+0x1a0>
+     193:	3c 20                	cmp    $0x20,%al
+     195:	75 18                	jne    1af <main+0x1af>
+     197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19e:	66 90                	xchg   %ax,%ax
+     1a0:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    s++;
+     1a4:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t')
+     1a7:	3c 20                	cmp    $0x20,%al
+     1a9:	74 f5                	je     1a0 <main+0x1a0>
+     1ab:	3c 09                	cmp    $0x9,%al
+     1ad:	74 f1                	je     1a0 <main+0x1a0>
+}
+
+static int
+command_is(const char *cmd, const char *word)
+{
+  return strcmp(cmd, word) == 0;
+     1af:	83 ec 08             	sub    $0x8,%esp
+     1b2:	8d bd 78 fd ff ff    	lea    -0x288(%ebp),%edi
+     1b8:	68 83 1f 00 00       	push   $0x1f83
+     1bd:	57                   	push   %edi
+     1be:	e8 9d 0e 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "HELP") || command_is(cmd, "H")){
+     1c3:	83 c4 10             	add    $0x10,%esp
+     1c6:	85 c0                	test   %eax,%eax
+     1c8:	0f 84 82 01 00 00    	je     350 <main+0x350>
+  return strcmp(cmd, word) == 0;
+     1ce:	83 ec 08             	sub    $0x8,%esp
+     1d1:	68 fa 1f 00 00       	push   $0x1ffa
+     1d6:	57                   	push   %edi
+     1d7:	e8 84 0e 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "HELP") || command_is(cmd, "H")){
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	85 c0                	test   %eax,%eax
+     1e1:	0f 84 69 01 00 00    	je     350 <main+0x350>
+  return strcmp(cmd, word) == 0;
+     1e7:	83 ec 08             	sub    $0x8,%esp
+     1ea:	68 fc 1f 00 00       	push   $0x1ffc
+     1ef:	57                   	push   %edi
+     1f0:	e8 6b 0e 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "LIST") || command_is(cmd, "L")){
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	85 c0                	test   %eax,%eax
+     1fa:	0f 85 b6 02 00 00    	jne    4b6 <main+0x4b6>
+    if(args[0] == 0){
+     200:	0f be 03             	movsbl (%ebx),%eax
+     203:	84 c0                	test   %al,%al
+     205:	0f 84 46 04 00 00    	je     651 <main+0x651>
+  while(*p >= '0' && *p <= '9'){
+     20b:	8d 50 d0             	lea    -0x30(%eax),%edx
+  int n = 0;
+     20e:	31 c9                	xor    %ecx,%ecx
+  while(*p >= '0' && *p <= '9'){
+     210:	80 fa 09             	cmp    $0x9,%dl
+     213:	0f 87 d2 03 00 00    	ja     5eb <main+0x5eb>
+     219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *p - '0';
+     220:	8d 14 89             	lea    (%ecx,%ecx,4),%edx
+    p++;
+     223:	83 c3 01             	add    $0x1,%ebx
+    n = n*10 + *p - '0';
+     226:	8d 4c 50 d0          	lea    -0x30(%eax,%edx,2),%ecx
+  while(*p >= '0' && *p <= '9'){
+     22a:	0f be 03             	movsbl (%ebx),%eax
+     22d:	8d 50 d0             	lea    -0x30(%eax),%edx
+     230:	80 fa 09             	cmp    $0x9,%dl
+     233:	76 eb                	jbe    220 <main+0x220>
+  while(*s == ' ' || *s == '\t')
+     235:	3c 09                	cmp    $0x9,%al
+     237:	74 0f                	je     248 <main+0x248>
+     239:	3c 20                	cmp    $0x20,%al
+     23b:	0f 85 dd 03 00 00    	jne    61e <main+0x61e>
+     241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     248:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+    s++;
+     24c:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t')
+     24f:	3c 20                	cmp    $0x20,%al
+     251:	74 f5                	je     248 <main+0x248>
+     253:	3c 09                	cmp    $0x9,%al
+     255:	74 f1                	je     248 <main+0x248>
+    if(args[0] == 0){
+     257:	84 c0                	test   %al,%al
+     259:	0f 84 02 04 00 00    	je     661 <main+0x661>
+  int n = 0;
+     25f:	31 d2                	xor    %edx,%edx
+  while(*p >= '0' && *p <= '9'){
+     261:	8d 78 d0             	lea    -0x30(%eax),%edi
+  int n = 0;
+     264:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  while(*p >= '0' && *p <= '9'){
+     26a:	89 fa                	mov    %edi,%edx
+     26c:	80 fa 09             	cmp    $0x9,%dl
+     26f:	0f 87 ad 03 00 00    	ja     622 <main+0x622>
+     275:	89 cf                	mov    %ecx,%edi
+     277:	31 d2                	xor    %edx,%edx
+     279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = n*10 + *p - '0';
+     280:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    p++;
+     283:	83 c3 01             	add    $0x1,%ebx
+    n = n*10 + *p - '0';
+     286:	8d 54 50 d0          	lea    -0x30(%eax,%edx,2),%edx
+  while(*p >= '0' && *p <= '9'){
+     28a:	0f be 03             	movsbl (%ebx),%eax
+     28d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     290:	80 f9 09             	cmp    $0x9,%cl
+     293:	76 eb                	jbe    280 <main+0x280>
+    list_lines(start, end);
+     295:	89 f8                	mov    %edi,%eax
+     297:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+     29d:	e8 9e 07 00 00       	call   a40 <list_lines>
+    return;
+     2a2:	e9 a9 fd ff ff       	jmp    50 <main+0x50>
+     2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ae:	66 90                	xchg   %ax,%ax
+  while(n > 0 && (s[n-1] == '\n' || s[n-1] == '\r' || s[n-1] == ' ' || s[n-1] == '\t'))
+     2b0:	b9 ec ff 7f ff       	mov    $0xff7fffec,%ecx
+     2b5:	0f a3 d1             	bt     %edx,%ecx
+     2b8:	0f 82 19 fe ff ff    	jb     d7 <main+0xd7>
+    s[--n] = 0;
+     2be:	c6 00 00             	movb   $0x0,(%eax)
+  while(n > 0 && (s[n-1] == '\n' || s[n-1] == '\r' || s[n-1] == ' ' || s[n-1] == '\t'))
+     2c1:	8d 50 ff             	lea    -0x1(%eax),%edx
+     2c4:	39 f0                	cmp    %esi,%eax
+     2c6:	0f 84 0b fe ff ff    	je     d7 <main+0xd7>
+     2cc:	89 d0                	mov    %edx,%eax
+     2ce:	e9 f5 fd ff ff       	jmp    c8 <main+0xc8>
+     2d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2d7:	90                   	nop
+    struct_begin(&w, 1);
+     2d8:	8d 9d 98 fe ff ff    	lea    -0x168(%ebp),%ebx
+     2de:	83 ec 08             	sub    $0x8,%esp
+     2e1:	6a 01                	push   $0x1
+     2e3:	53                   	push   %ebx
+     2e4:	e8 97 15 00 00       	call   1880 <struct_begin>
+    struct_field_str(&w, "prompt", "hello-edit");
+     2e9:	83 c4 0c             	add    $0xc,%esp
+     2ec:	68 cc 1e 00 00       	push   $0x1ecc
+     2f1:	68 2f 1f 00 00       	push   $0x1f2f
+     2f6:	53                   	push   %ebx
+     2f7:	e8 b4 15 00 00       	call   18b0 <struct_field_str>
+    struct_field_str(&w, "file", current_file);
+     2fc:	83 c4 0c             	add    $0xc,%esp
+     2ff:	68 60 28 00 00       	push   $0x2860
+     304:	68 92 20 00 00       	push   $0x2092
+     309:	53                   	push   %ebx
+     30a:	e8 a1 15 00 00       	call   18b0 <struct_field_str>
+    struct_field_int(&w, "lines", line_count);
+     30f:	83 c4 0c             	add    $0xc,%esp
+     312:	ff 35 e4 28 00 00    	push   0x28e4
+     318:	68 36 1f 00 00       	push   $0x1f36
+     31d:	53                   	push   %ebx
+     31e:	e8 5d 17 00 00       	call   1a80 <struct_field_int>
+    struct_field_int(&w, "dirty", dirty);
+     323:	83 c4 0c             	add    $0xc,%esp
+     326:	ff 35 e0 28 00 00    	push   0x28e0
+     32c:	68 c0 1e 00 00       	push   $0x1ec0
+     331:	53                   	push   %ebx
+     332:	e8 49 17 00 00       	call   1a80 <struct_field_int>
+    struct_end(&w);
+     337:	89 1c 24             	mov    %ebx,(%esp)
+     33a:	e8 31 18 00 00       	call   1b70 <struct_end>
+     33f:	83 c4 10             	add    $0x10,%esp
+     342:	e9 4f fd ff ff       	jmp    96 <main+0x96>
+     347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34e:	66 90                	xchg   %ax,%ax
+  printf(1, "hello-edit BASIC-style usage:\n");
+     350:	83 ec 08             	sub    $0x8,%esp
+     353:	68 bc 20 00 00       	push   $0x20bc
+     358:	6a 01                	push   $0x1
+     35a:	e8 c1 10 00 00       	call   1420 <printf>
+  printf(1, "  <num> text   set a line (empty text deletes)\n");
+     35f:	58                   	pop    %eax
+     360:	5a                   	pop    %edx
+     361:	68 dc 20 00 00       	push   $0x20dc
+     366:	6a 01                	push   $0x1
+     368:	e8 b3 10 00 00       	call   1420 <printf>
+  printf(1, "  LIST [a [b]] list program lines\n");
+     36d:	59                   	pop    %ecx
+     36e:	5b                   	pop    %ebx
+     36f:	68 0c 21 00 00       	push   $0x210c
+     374:	6a 01                	push   $0x1
+     376:	e8 a5 10 00 00       	call   1420 <printf>
+  printf(1, "  DELETE n     delete line n\n");
+     37b:	5f                   	pop    %edi
+     37c:	58                   	pop    %eax
+     37d:	68 88 1f 00 00       	push   $0x1f88
+     382:	6a 01                	push   $0x1
+     384:	e8 97 10 00 00       	call   1420 <printf>
+  printf(1, "  NEW          clear buffer\n");
+     389:	58                   	pop    %eax
+     38a:	5a                   	pop    %edx
+     38b:	68 a6 1f 00 00       	push   $0x1fa6
+     390:	6a 01                	push   $0x1
+     392:	e8 89 10 00 00       	call   1420 <printf>
+  printf(1, "  OPEN file    load file (line numbers optional)\n");
+     397:	59                   	pop    %ecx
+     398:	5b                   	pop    %ebx
+     399:	68 30 21 00 00       	push   $0x2130
+     39e:	6a 01                	push   $0x1
+     3a0:	e8 7b 10 00 00       	call   1420 <printf>
+  printf(1, "  WRITE [file] save program\n");
+     3a5:	5f                   	pop    %edi
+     3a6:	58                   	pop    %eax
+     3a7:	68 c3 1f 00 00       	push   $0x1fc3
+     3ac:	6a 01                	push   $0x1
+     3ae:	e8 6d 10 00 00       	call   1420 <printf>
+  printf(1, "  HELP         this text\n");
+     3b3:	58                   	pop    %eax
+     3b4:	5a                   	pop    %edx
+     3b5:	68 e0 1f 00 00       	push   $0x1fe0
+     3ba:	6a 01                	push   $0x1
+     3bc:	e8 5f 10 00 00       	call   1420 <printf>
+  printf(1, "  Q or Q!      quit (Q! ignores unsaved edits)\n");
+     3c1:	59                   	pop    %ecx
+     3c2:	5b                   	pop    %ebx
+     3c3:	68 64 21 00 00       	push   $0x2164
+     3c8:	6a 01                	push   $0x1
+     3ca:	e8 51 10 00 00       	call   1420 <printf>
+}
+     3cf:	83 c4 10             	add    $0x10,%esp
+     3d2:	e9 79 fc ff ff       	jmp    50 <main+0x50>
+     3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3de:	66 90                	xchg   %ax,%ax
+    if(line[0] == 'q' && line[1] == '!' && line[2] == 0){
+     3e0:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+     3e4:	3c 21                	cmp    $0x21,%al
+     3e6:	0f 84 55 01 00 00    	je     541 <main+0x541>
+    if((line[0] == 'q' || line[0] == 'Q') && line[1] == 0){
+     3ec:	84 c0                	test   %al,%al
+     3ee:	0f 85 2f fd ff ff    	jne    123 <main+0x123>
+      if(dirty){
+     3f4:	8b 3d e0 28 00 00    	mov    0x28e0,%edi
+     3fa:	85 ff                	test   %edi,%edi
+     3fc:	0f 85 5d 01 00 00    	jne    55f <main+0x55f>
+      emit_status("quit", "clean");
+     402:	ba c6 1e 00 00       	mov    $0x1ec6,%edx
+     407:	b8 65 1f 00 00       	mov    $0x1f65,%eax
+     40c:	e8 ef 05 00 00       	call   a00 <emit_status>
+  exit();
+     411:	e8 5d 0e 00 00       	call   1273 <exit>
+     416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     41d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(line[0] == 'q' && line[1] == '!' && line[2] == 0){
+     420:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+     424:	eb c6                	jmp    3ec <main+0x3ec>
+  while(*p >= '0' && *p <= '9'){
+     426:	0f be 03             	movsbl (%ebx),%eax
+     429:	8d 50 d0             	lea    -0x30(%eax),%edx
+     42c:	80 fa 09             	cmp    $0x9,%dl
+     42f:	77 52                	ja     483 <main+0x483>
+  int n = 0;
+     431:	31 ff                	xor    %edi,%edi
+     433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     437:	90                   	nop
+    n = n*10 + *p - '0';
+     438:	8d 14 bf             	lea    (%edi,%edi,4),%edx
+    p++;
+     43b:	83 c3 01             	add    $0x1,%ebx
+    n = n*10 + *p - '0';
+     43e:	8d 7c 50 d0          	lea    -0x30(%eax,%edx,2),%edi
+  while(*p >= '0' && *p <= '9'){
+     442:	0f be 03             	movsbl (%ebx),%eax
+     445:	8d 50 d0             	lea    -0x30(%eax),%edx
+     448:	80 fa 09             	cmp    $0x9,%dl
+     44b:	76 eb                	jbe    438 <main+0x438>
+  if(!ok || number <= 0){
+     44d:	85 ff                	test   %edi,%edi
+     44f:	74 32                	je     483 <main+0x483>
+  while(*s == ' ' || *s == '\t')
+     451:	3c 09                	cmp    $0x9,%al
+     453:	74 0b                	je     460 <main+0x460>
+     455:	3c 20                	cmp    $0x20,%al
+     457:	75 16                	jne    46f <main+0x46f>
+     459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     460:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    s++;
+     464:	83 c3 01             	add    $0x1,%ebx
+  while(*s == ' ' || *s == '\t')
+     467:	3c 20                	cmp    $0x20,%al
+     469:	74 f5                	je     460 <main+0x460>
+     46b:	3c 09                	cmp    $0x9,%al
+     46d:	74 f1                	je     460 <main+0x460>
+  if(text[0] == 0){
+     46f:	84 c0                	test   %al,%al
+     471:	0f 85 47 01 00 00    	jne    5be <main+0x5be>
+    delete_line_number(number, 1);
+     477:	89 f8                	mov    %edi,%eax
+     479:	e8 b2 06 00 00       	call   b30 <delete_line_number.constprop.0>
+     47e:	e9 cd fb ff ff       	jmp    50 <main+0x50>
+  if(json_mode)
+     483:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     48a:	0f 84 41 01 00 00    	je     5d1 <main+0x5d1>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     490:	83 ec 0c             	sub    $0xc,%esp
+     493:	68 e7 1e 00 00       	push   $0x1ee7
+     498:	6a 01                	push   $0x1
+     49a:	68 4a 1f 00 00       	push   $0x1f4a
+     49f:	68 e7 1e 00 00       	push   $0x1ee7
+     4a4:	68 cc 1e 00 00       	push   $0x1ecc
+     4a9:	e8 32 19 00 00       	call   1de0 <modern_emit_status>
+}
+     4ae:	83 c4 20             	add    $0x20,%esp
+     4b1:	e9 9a fb ff ff       	jmp    50 <main+0x50>
+  return strcmp(cmd, word) == 0;
+     4b6:	50                   	push   %eax
+     4b7:	50                   	push   %eax
+     4b8:	68 01 20 00 00       	push   $0x2001
+     4bd:	57                   	push   %edi
+     4be:	e8 9d 0b 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "LIST") || command_is(cmd, "L")){
+     4c3:	83 c4 10             	add    $0x10,%esp
+     4c6:	85 c0                	test   %eax,%eax
+     4c8:	0f 84 32 fd ff ff    	je     200 <main+0x200>
+  return strcmp(cmd, word) == 0;
+     4ce:	50                   	push   %eax
+     4cf:	50                   	push   %eax
+     4d0:	68 27 20 00 00       	push   $0x2027
+     4d5:	57                   	push   %edi
+     4d6:	e8 85 0b 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "DELETE") || command_is(cmd, "D")){
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	85 c0                	test   %eax,%eax
+     4e0:	0f 85 c9 01 00 00    	jne    6af <main+0x6af>
+  int any = 0;
+     4e6:	31 ff                	xor    %edi,%edi
+  int n = 0;
+     4e8:	31 d2                	xor    %edx,%edx
+  while(*p >= '0' && *p <= '9'){
+     4ea:	eb 0f                	jmp    4fb <main+0x4fb>
+    n = n*10 + *p - '0';
+     4ec:	6b d2 0a             	imul   $0xa,%edx,%edx
+    p++;
+     4ef:	83 c3 01             	add    $0x1,%ebx
+    any = 1;
+     4f2:	bf 01 00 00 00       	mov    $0x1,%edi
+    n = n*10 + *p - '0';
+     4f7:	8d 54 02 d0          	lea    -0x30(%edx,%eax,1),%edx
+  while(*p >= '0' && *p <= '9'){
+     4fb:	0f be 03             	movsbl (%ebx),%eax
+     4fe:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     501:	80 f9 09             	cmp    $0x9,%cl
+     504:	76 e6                	jbe    4ec <main+0x4ec>
+    if(!ok){
+     506:	85 ff                	test   %edi,%edi
+     508:	0f 85 95 01 00 00    	jne    6a3 <main+0x6a3>
+  if(json_mode)
+     50e:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     515:	0f 84 0c 02 00 00    	je     727 <main+0x727>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     51b:	83 ec 0c             	sub    $0xc,%esp
+     51e:	68 e7 1e 00 00       	push   $0x1ee7
+     523:	6a 01                	push   $0x1
+     525:	68 30 20 00 00       	push   $0x2030
+     52a:	68 e7 1e 00 00       	push   $0x1ee7
+     52f:	68 cc 1e 00 00       	push   $0x1ecc
+     534:	e8 a7 18 00 00       	call   1de0 <modern_emit_status>
+}
+     539:	83 c4 20             	add    $0x20,%esp
+     53c:	e9 0f fb ff ff       	jmp    50 <main+0x50>
+    if(line[0] == 'q' && line[1] == '!' && line[2] == 0){
+     541:	80 7b 02 00          	cmpb   $0x0,0x2(%ebx)
+     545:	0f 85 d8 fb ff ff    	jne    123 <main+0x123>
+      emit_status("quit", "forced");
+     54b:	ba 5e 1f 00 00       	mov    $0x1f5e,%edx
+     550:	b8 65 1f 00 00       	mov    $0x1f65,%eax
+     555:	e8 a6 04 00 00       	call   a00 <emit_status>
+      break;
+     55a:	e9 b2 fe ff ff       	jmp    411 <main+0x411>
+        emit_error("buffer modified (use Q!)");
+     55f:	b8 6a 1f 00 00       	mov    $0x1f6a,%eax
+     564:	e8 77 05 00 00       	call   ae0 <emit_error>
+        continue;
+     569:	e9 e2 fa ff ff       	jmp    50 <main+0x50>
+    load_file(current_file);
+     56e:	b8 60 28 00 00       	mov    $0x2860,%eax
+     573:	e8 18 08 00 00       	call   d90 <load_file>
+     578:	e9 ca fa ff ff       	jmp    47 <main+0x47>
+    set_filename(argv[argi]);
+     57d:	8b 0c 86             	mov    (%esi,%eax,4),%ecx
+  int i = 0;
+     580:	31 c0                	xor    %eax,%eax
+  while(i < max - 1 && src && src[i]){
+     582:	85 c9                	test   %ecx,%ecx
+     584:	75 18                	jne    59e <main+0x59e>
+     586:	eb 1e                	jmp    5a6 <main+0x5a6>
+     588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+    dst[i] = src[i];
+     590:	88 90 60 28 00 00    	mov    %dl,0x2860(%eax)
+    i++;
+     596:	83 c0 01             	add    $0x1,%eax
+  while(i < max - 1 && src && src[i]){
+     599:	83 f8 7f             	cmp    $0x7f,%eax
+     59c:	74 08                	je     5a6 <main+0x5a6>
+     59e:	0f b6 14 01          	movzbl (%ecx,%eax,1),%edx
+     5a2:	84 d2                	test   %dl,%dl
+     5a4:	75 ea                	jne    590 <main+0x590>
+  dst[i] = 0;
+     5a6:	c6 80 60 28 00 00 00 	movb   $0x0,0x2860(%eax)
+     5ad:	e9 88 fa ff ff       	jmp    3a <main+0x3a>
+  dst[i] = 0;
+     5b2:	c6 85 78 fd ff ff 00 	movb   $0x0,-0x288(%ebp)
+  while(*args && *args != ' ' && *args != '\t')
+     5b9:	e9 d1 fb ff ff       	jmp    18f <main+0x18f>
+    upsert_line(number, text, 1);
+     5be:	b9 01 00 00 00       	mov    $0x1,%ecx
+     5c3:	89 da                	mov    %ebx,%edx
+     5c5:	89 f8                	mov    %edi,%eax
+     5c7:	e8 f4 05 00 00       	call   bc0 <upsert_line>
+     5cc:	e9 7f fa ff ff       	jmp    50 <main+0x50>
+    printf(1, "hello-edit: %s\n", msg);
+     5d1:	50                   	push   %eax
+     5d2:	68 4a 1f 00 00       	push   $0x1f4a
+     5d7:	68 ed 1e 00 00       	push   $0x1eed
+     5dc:	6a 01                	push   $0x1
+     5de:	e8 3d 0e 00 00       	call   1420 <printf>
+     5e3:	83 c4 10             	add    $0x10,%esp
+     5e6:	e9 65 fa ff ff       	jmp    50 <main+0x50>
+  if(json_mode)
+     5eb:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     5f2:	0f 84 91 00 00 00    	je     689 <main+0x689>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     5f8:	83 ec 0c             	sub    $0xc,%esp
+     5fb:	68 e7 1e 00 00       	push   $0x1ee7
+     600:	6a 01                	push   $0x1
+     602:	68 03 20 00 00       	push   $0x2003
+     607:	68 e7 1e 00 00       	push   $0x1ee7
+     60c:	68 cc 1e 00 00       	push   $0x1ecc
+     611:	e8 ca 17 00 00       	call   1de0 <modern_emit_status>
+}
+     616:	83 c4 20             	add    $0x20,%esp
+     619:	e9 32 fa ff ff       	jmp    50 <main+0x50>
+    if(args[0] == 0){
+     61e:	84 c0                	test   %al,%al
+     620:	74 3f                	je     661 <main+0x661>
+  if(json_mode)
+     622:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     629:	74 44                	je     66f <main+0x66f>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     62b:	83 ec 0c             	sub    $0xc,%esp
+     62e:	68 e7 1e 00 00       	push   $0x1ee7
+     633:	6a 01                	push   $0x1
+     635:	68 16 20 00 00       	push   $0x2016
+     63a:	68 e7 1e 00 00       	push   $0x1ee7
+     63f:	68 cc 1e 00 00       	push   $0x1ecc
+     644:	e8 97 17 00 00       	call   1de0 <modern_emit_status>
+}
+     649:	83 c4 20             	add    $0x20,%esp
+     64c:	e9 ff f9 ff ff       	jmp    50 <main+0x50>
+      list_lines(-1, -1);
+     651:	83 ca ff             	or     $0xffffffff,%edx
+     654:	83 c8 ff             	or     $0xffffffff,%eax
+     657:	e8 e4 03 00 00       	call   a40 <list_lines>
+      return;
+     65c:	e9 ef f9 ff ff       	jmp    50 <main+0x50>
+      list_lines(start, start);
+     661:	89 ca                	mov    %ecx,%edx
+     663:	89 c8                	mov    %ecx,%eax
+     665:	e8 d6 03 00 00       	call   a40 <list_lines>
+      return;
+     66a:	e9 e1 f9 ff ff       	jmp    50 <main+0x50>
+    printf(1, "hello-edit: %s\n", msg);
+     66f:	50                   	push   %eax
+     670:	68 16 20 00 00       	push   $0x2016
+     675:	68 ed 1e 00 00       	push   $0x1eed
+     67a:	6a 01                	push   $0x1
+     67c:	e8 9f 0d 00 00       	call   1420 <printf>
+     681:	83 c4 10             	add    $0x10,%esp
+     684:	e9 c7 f9 ff ff       	jmp    50 <main+0x50>
+     689:	51                   	push   %ecx
+     68a:	68 03 20 00 00       	push   $0x2003
+     68f:	68 ed 1e 00 00       	push   $0x1eed
+     694:	6a 01                	push   $0x1
+     696:	e8 85 0d 00 00       	call   1420 <printf>
+     69b:	83 c4 10             	add    $0x10,%esp
+     69e:	e9 ad f9 ff ff       	jmp    50 <main+0x50>
+    delete_line_number(number, 1);
+     6a3:	89 d0                	mov    %edx,%eax
+     6a5:	e8 86 04 00 00       	call   b30 <delete_line_number.constprop.0>
+    return;
+     6aa:	e9 a1 f9 ff ff       	jmp    50 <main+0x50>
+  return strcmp(cmd, word) == 0;
+     6af:	50                   	push   %eax
+     6b0:	50                   	push   %eax
+     6b1:	68 2e 20 00 00       	push   $0x202e
+     6b6:	57                   	push   %edi
+     6b7:	e8 a4 09 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "DELETE") || command_is(cmd, "D")){
+     6bc:	83 c4 10             	add    $0x10,%esp
+     6bf:	85 c0                	test   %eax,%eax
+     6c1:	0f 84 1f fe ff ff    	je     4e6 <main+0x4e6>
+  return strcmp(cmd, word) == 0;
+     6c7:	50                   	push   %eax
+     6c8:	50                   	push   %eax
+     6c9:	68 45 20 00 00       	push   $0x2045
+     6ce:	57                   	push   %edi
+     6cf:	e8 8c 09 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "NEW")){
+     6d4:	83 c4 10             	add    $0x10,%esp
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	0f 84 d1 01 00 00    	je     8b0 <main+0x8b0>
+  return strcmp(cmd, word) == 0;
+     6df:	51                   	push   %ecx
+     6e0:	51                   	push   %ecx
+     6e1:	68 54 20 00 00       	push   $0x2054
+     6e6:	57                   	push   %edi
+     6e7:	e8 74 09 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "OPEN") || command_is(cmd, "O")){
+     6ec:	83 c4 10             	add    $0x10,%esp
+     6ef:	85 c0                	test   %eax,%eax
+     6f1:	75 74                	jne    767 <main+0x767>
+    if(args[0] == 0){
+     6f3:	80 3b 00             	cmpb   $0x0,(%ebx)
+     6f6:	75 63                	jne    75b <main+0x75b>
+  if(json_mode)
+     6f8:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     6ff:	74 40                	je     741 <main+0x741>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     701:	83 ec 0c             	sub    $0xc,%esp
+     704:	68 e7 1e 00 00       	push   $0x1ee7
+     709:	6a 01                	push   $0x1
+     70b:	68 5b 20 00 00       	push   $0x205b
+     710:	68 e7 1e 00 00       	push   $0x1ee7
+     715:	68 cc 1e 00 00       	push   $0x1ecc
+     71a:	e8 c1 16 00 00       	call   1de0 <modern_emit_status>
+}
+     71f:	83 c4 20             	add    $0x20,%esp
+     722:	e9 29 f9 ff ff       	jmp    50 <main+0x50>
+    printf(1, "hello-edit: %s\n", msg);
+     727:	50                   	push   %eax
+     728:	68 30 20 00 00       	push   $0x2030
+     72d:	68 ed 1e 00 00       	push   $0x1eed
+     732:	6a 01                	push   $0x1
+     734:	e8 e7 0c 00 00       	call   1420 <printf>
+     739:	83 c4 10             	add    $0x10,%esp
+     73c:	e9 0f f9 ff ff       	jmp    50 <main+0x50>
+     741:	50                   	push   %eax
+     742:	68 5b 20 00 00       	push   $0x205b
+     747:	68 ed 1e 00 00       	push   $0x1eed
+     74c:	6a 01                	push   $0x1
+     74e:	e8 cd 0c 00 00       	call   1420 <printf>
+     753:	83 c4 10             	add    $0x10,%esp
+     756:	e9 f5 f8 ff ff       	jmp    50 <main+0x50>
+    load_file(args);
+     75b:	89 d8                	mov    %ebx,%eax
+     75d:	e8 2e 06 00 00       	call   d90 <load_file>
+    return;
+     762:	e9 e9 f8 ff ff       	jmp    50 <main+0x50>
+  return strcmp(cmd, word) == 0;
+     767:	52                   	push   %edx
+     768:	52                   	push   %edx
+     769:	68 59 20 00 00       	push   $0x2059
+     76e:	57                   	push   %edi
+     76f:	e8 ec 08 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "OPEN") || command_is(cmd, "O")){
+     774:	83 c4 10             	add    $0x10,%esp
+     777:	85 c0                	test   %eax,%eax
+     779:	0f 84 74 ff ff ff    	je     6f3 <main+0x6f3>
+  return strcmp(cmd, word) == 0;
+     77f:	50                   	push   %eax
+     780:	50                   	push   %eax
+     781:	68 6e 20 00 00       	push   $0x206e
+     786:	57                   	push   %edi
+     787:	e8 d4 08 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "WRITE") || command_is(cmd, "W") || command_is(cmd, "SAVE")){
+     78c:	83 c4 10             	add    $0x10,%esp
+     78f:	85 c0                	test   %eax,%eax
+     791:	0f 85 20 02 00 00    	jne    9b7 <main+0x9b7>
+    const char *name = args[0] ? args : current_file;
+     797:	80 3b 00             	cmpb   $0x0,(%ebx)
+     79a:	0f 84 ff 01 00 00    	je     99f <main+0x99f>
+  int fd = open(name, O_CREATE|O_WRONLY);
+     7a0:	50                   	push   %eax
+     7a1:	50                   	push   %eax
+     7a2:	68 01 02 00 00       	push   $0x201
+     7a7:	53                   	push   %ebx
+     7a8:	e8 06 0b 00 00       	call   12b3 <open>
+  if(fd < 0){
+     7ad:	83 c4 10             	add    $0x10,%esp
+  int fd = open(name, O_CREATE|O_WRONLY);
+     7b0:	89 85 74 fd ff ff    	mov    %eax,-0x28c(%ebp)
+  if(fd < 0){
+     7b6:	85 c0                	test   %eax,%eax
+     7b8:	0f 88 98 01 00 00    	js     956 <main+0x956>
+     7be:	c7 85 70 fd ff ff 00 	movl   $0x2900,-0x290(%ebp)
+     7c5:	29 00 00 
+  for(int i = 0; i < line_count; i++){
+     7c8:	31 ff                	xor    %edi,%edi
+     7ca:	89 bd 6c fd ff ff    	mov    %edi,-0x294(%ebp)
+     7d0:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+     7d6:	3b 05 e4 28 00 00    	cmp    0x28e4,%eax
+     7dc:	0f 8d 15 01 00 00    	jge    8f7 <main+0x8f7>
+    int n = buffer[i].number;
+     7e2:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+     7e8:	8b 00                	mov    (%eax),%eax
+    if(n == 0)
+     7ea:	85 c0                	test   %eax,%eax
+     7ec:	0f 84 f6 00 00 00    	je     8e8 <main+0x8e8>
+      tmp[t++] = '0';
+     7f2:	0f b6 95 98 fe ff ff 	movzbl -0x168(%ebp),%edx
+    int t = 0;
+     7f9:	31 ff                	xor    %edi,%edi
+     7fb:	88 95 98 fe ff ff    	mov    %dl,-0x168(%ebp)
+      tmp[t++] = '0' + (n % 10);
+     801:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     806:	eb 15                	jmp    81d <main+0x81d>
+    while(n > 0 && t < (int)sizeof(tmp)){
+     808:	83 ff 0f             	cmp    $0xf,%edi
+     80b:	7f 14                	jg     821 <main+0x821>
+      tmp[t++] = '0' + (n % 10);
+     80d:	99                   	cltd
+     80e:	83 c7 01             	add    $0x1,%edi
+     811:	f7 f9                	idiv   %ecx
+     813:	83 c2 30             	add    $0x30,%edx
+     816:	88 94 3d 97 fe ff ff 	mov    %dl,-0x169(%ebp,%edi,1)
+    while(n > 0 && t < (int)sizeof(tmp)){
+     81d:	85 c0                	test   %eax,%eax
+     81f:	7f e7                	jg     808 <main+0x808>
+     821:	8d 8d 88 fd ff ff    	lea    -0x278(%ebp),%ecx
+     827:	89 9d 68 fd ff ff    	mov    %ebx,-0x298(%ebp)
+     82d:	89 f8                	mov    %edi,%eax
+     82f:	89 ca                	mov    %ecx,%edx
+     831:	eb 0e                	jmp    841 <main+0x841>
+      numbuf[len++] = tmp[t];
+     833:	0f b6 9c 05 98 fe ff 	movzbl -0x168(%ebp,%eax,1),%ebx
+     83a:	ff 
+     83b:	83 c2 01             	add    $0x1,%edx
+     83e:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while(t-- > 0)
+     841:	83 e8 01             	sub    $0x1,%eax
+     844:	73 ed                	jae    833 <main+0x833>
+    numbuf[len++] = ' ';
+     846:	c6 84 3d 88 fd ff ff 	movb   $0x20,-0x278(%ebp,%edi,1)
+     84d:	20 
+      numbuf[len++] = tmp[t];
+     84e:	83 c7 01             	add    $0x1,%edi
+    numbuf[len++] = ' ';
+     851:	8b 9d 68 fd ff ff    	mov    -0x298(%ebp),%ebx
+    write(fd, numbuf, len);
+     857:	52                   	push   %edx
+     858:	57                   	push   %edi
+     859:	51                   	push   %ecx
+     85a:	ff b5 74 fd ff ff    	push   -0x28c(%ebp)
+     860:	e8 2e 0a 00 00       	call   1293 <write>
+    write(fd, buffer[i].text, strlen(buffer[i].text));
+     865:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+     86b:	8d 78 04             	lea    0x4(%eax),%edi
+     86e:	89 3c 24             	mov    %edi,(%esp)
+     871:	e8 4a 08 00 00       	call   10c0 <strlen>
+     876:	83 c4 0c             	add    $0xc,%esp
+     879:	50                   	push   %eax
+     87a:	57                   	push   %edi
+     87b:	8b bd 74 fd ff ff    	mov    -0x28c(%ebp),%edi
+     881:	57                   	push   %edi
+     882:	e8 0c 0a 00 00       	call   1293 <write>
+    write(fd, "\n", 1);
+     887:	83 c4 0c             	add    $0xc,%esp
+     88a:	6a 01                	push   $0x1
+     88c:	68 de 1e 00 00       	push   $0x1ede
+     891:	57                   	push   %edi
+     892:	e8 fc 09 00 00       	call   1293 <write>
+  for(int i = 0; i < line_count; i++){
+     897:	83 85 6c fd ff ff 01 	addl   $0x1,-0x294(%ebp)
+     89e:	83 c4 10             	add    $0x10,%esp
+     8a1:	81 85 70 fd ff ff a4 	addl   $0xa4,-0x290(%ebp)
+     8a8:	00 00 00 
+     8ab:	e9 20 ff ff ff       	jmp    7d0 <main+0x7d0>
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+  dirty = 0;
+     8b3:	31 db                	xor    %ebx,%ebx
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     8b5:	68 c6 1e 00 00       	push   $0x1ec6
+     8ba:	ff 35 40 28 00 00    	push   0x2840
+     8c0:	68 49 20 00 00       	push   $0x2049
+     8c5:	68 50 20 00 00       	push   $0x2050
+     8ca:	68 cc 1e 00 00       	push   $0x1ecc
+  dirty = 0;
+     8cf:	89 1d e4 28 00 00    	mov    %ebx,0x28e4
+     8d5:	89 1d e0 28 00 00    	mov    %ebx,0x28e0
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     8db:	e8 00 15 00 00       	call   1de0 <modern_emit_status>
+}
+     8e0:	83 c4 20             	add    $0x20,%esp
+     8e3:	e9 68 f7 ff ff       	jmp    50 <main+0x50>
+      tmp[t++] = '0';
+     8e8:	ba 30 00 00 00       	mov    $0x30,%edx
+     8ed:	bf 01 00 00 00       	mov    $0x1,%edi
+     8f2:	e9 04 ff ff ff       	jmp    7fb <main+0x7fb>
+  close(fd);
+     8f7:	83 ec 0c             	sub    $0xc,%esp
+     8fa:	ff b5 74 fd ff ff    	push   -0x28c(%ebp)
+     900:	e8 96 09 00 00       	call   129b <close>
+  dirty = 0;
+     905:	31 c0                	xor    %eax,%eax
+     907:	83 c4 10             	add    $0x10,%esp
+     90a:	a3 e0 28 00 00       	mov    %eax,0x28e0
+  int i = 0;
+     90f:	31 c0                	xor    %eax,%eax
+     911:	eb 0e                	jmp    921 <main+0x921>
+    dst[i] = src[i];
+     913:	88 90 60 28 00 00    	mov    %dl,0x2860(%eax)
+    i++;
+     919:	83 c0 01             	add    $0x1,%eax
+  while(i < max - 1 && src && src[i]){
+     91c:	83 f8 7f             	cmp    $0x7f,%eax
+     91f:	74 08                	je     929 <main+0x929>
+     921:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     925:	84 d2                	test   %dl,%dl
+     927:	75 ea                	jne    913 <main+0x913>
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     929:	83 ec 0c             	sub    $0xc,%esp
+  dst[i] = 0;
+     92c:	c6 80 60 28 00 00 00 	movb   $0x0,0x2860(%eax)
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     933:	68 c6 1e 00 00       	push   $0x1ec6
+     938:	ff 35 40 28 00 00    	push   0x2840
+     93e:	53                   	push   %ebx
+     93f:	68 97 20 00 00       	push   $0x2097
+     944:	68 cc 1e 00 00       	push   $0x1ecc
+     949:	e8 92 14 00 00       	call   1de0 <modern_emit_status>
+}
+     94e:	83 c4 20             	add    $0x20,%esp
+     951:	e9 fa f6 ff ff       	jmp    50 <main+0x50>
+  if(json_mode)
+     956:	83 3d 40 28 00 00 00 	cmpl   $0x0,0x2840
+     95d:	74 26                	je     985 <main+0x985>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     95f:	83 ec 0c             	sub    $0xc,%esp
+     962:	68 e7 1e 00 00       	push   $0x1ee7
+     967:	6a 01                	push   $0x1
+     969:	68 85 20 00 00       	push   $0x2085
+     96e:	68 e7 1e 00 00       	push   $0x1ee7
+     973:	68 cc 1e 00 00       	push   $0x1ecc
+     978:	e8 63 14 00 00       	call   1de0 <modern_emit_status>
+}
+     97d:	83 c4 20             	add    $0x20,%esp
+     980:	e9 cb f6 ff ff       	jmp    50 <main+0x50>
+    printf(1, "hello-edit: %s\n", msg);
+     985:	51                   	push   %ecx
+     986:	68 85 20 00 00       	push   $0x2085
+     98b:	68 ed 1e 00 00       	push   $0x1eed
+     990:	6a 01                	push   $0x1
+     992:	e8 89 0a 00 00       	call   1420 <printf>
+     997:	83 c4 10             	add    $0x10,%esp
+     99a:	e9 b1 f6 ff ff       	jmp    50 <main+0x50>
+    if(name[0] == 0){
+     99f:	80 3d 60 28 00 00 00 	cmpb   $0x0,0x2860
+     9a6:	75 4e                	jne    9f6 <main+0x9f6>
+      emit_error("no filename");
+     9a8:	b8 79 20 00 00       	mov    $0x2079,%eax
+     9ad:	e8 2e 01 00 00       	call   ae0 <emit_error>
+      return;
+     9b2:	e9 99 f6 ff ff       	jmp    50 <main+0x50>
+  return strcmp(cmd, word) == 0;
+     9b7:	50                   	push   %eax
+     9b8:	50                   	push   %eax
+     9b9:	68 47 20 00 00       	push   $0x2047
+     9be:	57                   	push   %edi
+     9bf:	e8 9c 06 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "WRITE") || command_is(cmd, "W") || command_is(cmd, "SAVE")){
+     9c4:	83 c4 10             	add    $0x10,%esp
+     9c7:	85 c0                	test   %eax,%eax
+     9c9:	0f 84 c8 fd ff ff    	je     797 <main+0x797>
+  return strcmp(cmd, word) == 0;
+     9cf:	50                   	push   %eax
+     9d0:	50                   	push   %eax
+     9d1:	68 74 20 00 00       	push   $0x2074
+     9d6:	57                   	push   %edi
+     9d7:	e8 84 06 00 00       	call   1060 <strcmp>
+  if(command_is(cmd, "WRITE") || command_is(cmd, "W") || command_is(cmd, "SAVE")){
+     9dc:	83 c4 10             	add    $0x10,%esp
+     9df:	85 c0                	test   %eax,%eax
+     9e1:	0f 84 b0 fd ff ff    	je     797 <main+0x797>
+  emit_error("unknown command (type HELP)");
+     9e7:	b8 9d 20 00 00       	mov    $0x209d,%eax
+     9ec:	e8 ef 00 00 00       	call   ae0 <emit_error>
+     9f1:	e9 5a f6 ff ff       	jmp    50 <main+0x50>
+    const char *name = args[0] ? args : current_file;
+     9f6:	bb 60 28 00 00       	mov    $0x2860,%ebx
+     9fb:	e9 a0 fd ff ff       	jmp    7a0 <main+0x7a0>
+
+00000a00 <emit_status>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 c1                	mov    %eax,%ecx
+     a03:	89 e5                	mov    %esp,%ebp
+     a05:	53                   	push   %ebx
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     a06:	bb c0 1e 00 00       	mov    $0x1ec0,%ebx
+{
+     a0b:	83 ec 10             	sub    $0x10,%esp
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     a0e:	a1 e0 28 00 00       	mov    0x28e0,%eax
+     a13:	85 c0                	test   %eax,%eax
+     a15:	b8 c6 1e 00 00       	mov    $0x1ec6,%eax
+     a1a:	0f 45 c3             	cmovne %ebx,%eax
+     a1d:	50                   	push   %eax
+     a1e:	ff 35 40 28 00 00    	push   0x2840
+     a24:	52                   	push   %edx
+     a25:	51                   	push   %ecx
+     a26:	68 cc 1e 00 00       	push   $0x1ecc
+     a2b:	e8 b0 13 00 00       	call   1de0 <modern_emit_status>
+}
+     a30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a33:	83 c4 20             	add    $0x20,%esp
+     a36:	c9                   	leave
+     a37:	c3                   	ret
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+
+00000a40 <list_lines>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	83 ec 1c             	sub    $0x1c,%esp
+     a49:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(line_count == 0){
+     a4c:	8b 15 e4 28 00 00    	mov    0x28e4,%edx
+     a52:	85 d2                	test   %edx,%edx
+     a54:	74 6a                	je     ac0 <list_lines+0x80>
+  for(int i = 0; i < line_count; i++){
+     a56:	7e 7a                	jle    ad2 <list_lines+0x92>
+    if(start >= 0 && number < start)
+     a58:	89 c7                	mov    %eax,%edi
+    if(end >= 0 && number > end)
+     a5a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     a5d:	89 c1                	mov    %eax,%ecx
+     a5f:	bb 04 29 00 00       	mov    $0x2904,%ebx
+    if(start >= 0 && number < start)
+     a64:	f7 d7                	not    %edi
+  for(int i = 0; i < line_count; i++){
+     a66:	31 f6                	xor    %esi,%esi
+    if(start >= 0 && number < start)
+     a68:	c1 ef 1f             	shr    $0x1f,%edi
+    if(end >= 0 && number > end)
+     a6b:	f7 d2                	not    %edx
+     a6d:	89 f8                	mov    %edi,%eax
+     a6f:	c1 ea 1f             	shr    $0x1f,%edx
+     a72:	89 cf                	mov    %ecx,%edi
+     a74:	88 45 e7             	mov    %al,-0x19(%ebp)
+     a77:	eb 18                	jmp    a91 <list_lines+0x51>
+     a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(int i = 0; i < line_count; i++){
+     a80:	83 c6 01             	add    $0x1,%esi
+     a83:	81 c3 a4 00 00 00    	add    $0xa4,%ebx
+     a89:	3b 35 e4 28 00 00    	cmp    0x28e4,%esi
+     a8f:	7d 41                	jge    ad2 <list_lines+0x92>
+    int number = buffer[i].number;
+     a91:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    if(start >= 0 && number < start)
+     a94:	39 c7                	cmp    %eax,%edi
+     a96:	7e 06                	jle    a9e <list_lines+0x5e>
+     a98:	80 7d e7 00          	cmpb   $0x0,-0x19(%ebp)
+     a9c:	75 e2                	jne    a80 <list_lines+0x40>
+    if(end >= 0 && number > end)
+     a9e:	84 d2                	test   %dl,%dl
+     aa0:	74 05                	je     aa7 <list_lines+0x67>
+     aa2:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+     aa5:	7c d9                	jl     a80 <list_lines+0x40>
+     aa7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    printf(1, "%d %s\n", number, buffer[i].text);
+     aaa:	53                   	push   %ebx
+     aab:	50                   	push   %eax
+     aac:	68 e0 1e 00 00       	push   $0x1ee0
+     ab1:	6a 01                	push   $0x1
+     ab3:	e8 68 09 00 00       	call   1420 <printf>
+     ab8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     abb:	83 c4 10             	add    $0x10,%esp
+     abe:	eb c0                	jmp    a80 <list_lines+0x40>
+    printf(1, "(empty)\n");
+     ac0:	83 ec 08             	sub    $0x8,%esp
+     ac3:	68 d7 1e 00 00       	push   $0x1ed7
+     ac8:	6a 01                	push   $0x1
+     aca:	e8 51 09 00 00       	call   1420 <printf>
+    return;
+     acf:	83 c4 10             	add    $0x10,%esp
+}
+     ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ad5:	5b                   	pop    %ebx
+     ad6:	5e                   	pop    %esi
+     ad7:	5f                   	pop    %edi
+     ad8:	5d                   	pop    %ebp
+     ad9:	c3                   	ret
+     ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ae0 <emit_error>:
+{
+     ae0:	55                   	push   %ebp
+     ae1:	89 e5                	mov    %esp,%ebp
+     ae3:	83 ec 08             	sub    $0x8,%esp
+  if(json_mode)
+     ae6:	8b 15 40 28 00 00    	mov    0x2840,%edx
+     aec:	85 d2                	test   %edx,%edx
+     aee:	74 20                	je     b10 <emit_error+0x30>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	68 e7 1e 00 00       	push   $0x1ee7
+     af8:	6a 01                	push   $0x1
+     afa:	50                   	push   %eax
+     afb:	68 e7 1e 00 00       	push   $0x1ee7
+     b00:	68 cc 1e 00 00       	push   $0x1ecc
+     b05:	e8 d6 12 00 00       	call   1de0 <modern_emit_status>
+}
+     b0a:	83 c4 20             	add    $0x20,%esp
+     b0d:	c9                   	leave
+     b0e:	c3                   	ret
+     b0f:	90                   	nop
+    printf(1, "hello-edit: %s\n", msg);
+     b10:	83 ec 04             	sub    $0x4,%esp
+     b13:	50                   	push   %eax
+     b14:	68 ed 1e 00 00       	push   $0x1eed
+     b19:	6a 01                	push   $0x1
+     b1b:	e8 00 09 00 00       	call   1420 <printf>
+     b20:	83 c4 10             	add    $0x10,%esp
+}
+     b23:	c9                   	leave
+     b24:	c3                   	ret
+     b25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <delete_line_number.constprop.0>:
+delete_line_number(int number, int mark_dirty)
+     b30:	55                   	push   %ebp
+     b31:	89 c1                	mov    %eax,%ecx
+     b33:	31 d2                	xor    %edx,%edx
+     b35:	89 e5                	mov    %esp,%ebp
+     b37:	57                   	push   %edi
+     b38:	56                   	push   %esi
+  while(i < line_count && buffer[i].number < number)
+     b39:	8b 35 e4 28 00 00    	mov    0x28e4,%esi
+delete_line_number(int number, int mark_dirty)
+     b3f:	53                   	push   %ebx
+  while(i < line_count && buffer[i].number < number)
+     b40:	85 f6                	test   %esi,%esi
+     b42:	7f 13                	jg     b57 <delete_line_number.constprop.0+0x27>
+     b44:	eb 6e                	jmp    bb4 <delete_line_number.constprop.0+0x84>
+     b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    i++;
+     b50:	83 c2 01             	add    $0x1,%edx
+  while(i < line_count && buffer[i].number < number)
+     b53:	39 f2                	cmp    %esi,%edx
+     b55:	74 5d                	je     bb4 <delete_line_number.constprop.0+0x84>
+     b57:	69 c2 a4 00 00 00    	imul   $0xa4,%edx,%eax
+     b5d:	39 88 00 29 00 00    	cmp    %ecx,0x2900(%eax)
+     b63:	7c eb                	jl     b50 <delete_line_number.constprop.0+0x20>
+  if(idx >= line_count || buffer[idx].number != number)
+     b65:	39 d6                	cmp    %edx,%esi
+     b67:	7e 4b                	jle    bb4 <delete_line_number.constprop.0+0x84>
+     b69:	3b 88 00 29 00 00    	cmp    0x2900(%eax),%ecx
+     b6f:	75 43                	jne    bb4 <delete_line_number.constprop.0+0x84>
+  for(int i = idx; i < line_count-1; i++)
+     b71:	8d 5e ff             	lea    -0x1(%esi),%ebx
+     b74:	39 d3                	cmp    %edx,%ebx
+     b76:	7e 2c                	jle    ba4 <delete_line_number.constprop.0+0x74>
+     b78:	69 f6 a4 00 00 00    	imul   $0xa4,%esi,%esi
+     b7e:	8d 96 5c ff ff ff    	lea    -0xa4(%esi),%edx
+     b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    buffer[i] = buffer[i+1];
+     b88:	8d b8 00 29 00 00    	lea    0x2900(%eax),%edi
+     b8e:	8d b0 a4 29 00 00    	lea    0x29a4(%eax),%esi
+  for(int i = idx; i < line_count-1; i++)
+     b94:	05 a4 00 00 00       	add    $0xa4,%eax
+    buffer[i] = buffer[i+1];
+     b99:	b9 29 00 00 00       	mov    $0x29,%ecx
+     b9e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(int i = idx; i < line_count-1; i++)
+     ba0:	39 d0                	cmp    %edx,%eax
+     ba2:	75 e4                	jne    b88 <delete_line_number.constprop.0+0x58>
+  line_count--;
+     ba4:	89 1d e4 28 00 00    	mov    %ebx,0x28e4
+    dirty = 1;
+     baa:	c7 05 e0 28 00 00 01 	movl   $0x1,0x28e0
+     bb1:	00 00 00 
+}
+     bb4:	5b                   	pop    %ebx
+     bb5:	5e                   	pop    %esi
+     bb6:	5f                   	pop    %edi
+     bb7:	5d                   	pop    %ebp
+     bb8:	c3                   	ret
+     bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <upsert_line>:
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 2c             	sub    $0x2c,%esp
+     bc9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(line_count >= MAX_LINES){
+     bcc:	8b 0d e4 28 00 00    	mov    0x28e4,%ecx
+     bd2:	81 f9 ff 01 00 00    	cmp    $0x1ff,%ecx
+     bd8:	0f 8f 02 01 00 00    	jg     ce0 <upsert_line+0x120>
+     bde:	89 d6                	mov    %edx,%esi
+  while(i < line_count && buffer[i].number < number)
+     be0:	89 c3                	mov    %eax,%ebx
+  int i = 0;
+     be2:	31 d2                	xor    %edx,%edx
+  while(i < line_count && buffer[i].number < number)
+     be4:	85 c9                	test   %ecx,%ecx
+     be6:	7f 13                	jg     bfb <upsert_line+0x3b>
+     be8:	e9 87 01 00 00       	jmp    d74 <upsert_line+0x1b4>
+     bed:	8d 76 00             	lea    0x0(%esi),%esi
+    i++;
+     bf0:	83 c2 01             	add    $0x1,%edx
+  while(i < line_count && buffer[i].number < number)
+     bf3:	39 d1                	cmp    %edx,%ecx
+     bf5:	0f 84 c5 00 00 00    	je     cc0 <upsert_line+0x100>
+     bfb:	69 c2 a4 00 00 00    	imul   $0xa4,%edx,%eax
+     c01:	3b 98 00 29 00 00    	cmp    0x2900(%eax),%ebx
+     c07:	7f e7                	jg     bf0 <upsert_line+0x30>
+  if(idx < line_count && buffer[idx].number == number){
+     c09:	8d 78 04             	lea    0x4(%eax),%edi
+     c0c:	89 7d e0             	mov    %edi,-0x20(%ebp)
+     c0f:	39 d1                	cmp    %edx,%ecx
+     c11:	7e 50                	jle    c63 <upsert_line+0xa3>
+     c13:	8d b8 00 29 00 00    	lea    0x2900(%eax),%edi
+     c19:	39 98 00 29 00 00    	cmp    %ebx,0x2900(%eax)
+     c1f:	0f 84 1b 01 00 00    	je     d40 <upsert_line+0x180>
+     c25:	69 c1 a4 00 00 00    	imul   $0xa4,%ecx,%eax
+     c2b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+     c2e:	89 55 d8             	mov    %edx,-0x28(%ebp)
+     c31:	89 fa                	mov    %edi,%edx
+     c33:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     c36:	89 f3                	mov    %esi,%ebx
+     c38:	05 00 29 00 00       	add    $0x2900,%eax
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+      buffer[i] = buffer[i-1];
+     c40:	8d b0 5c ff ff ff    	lea    -0xa4(%eax),%esi
+     c46:	89 c7                	mov    %eax,%edi
+    for(int i = line_count; i > idx; i--)
+     c48:	2d a4 00 00 00       	sub    $0xa4,%eax
+      buffer[i] = buffer[i-1];
+     c4d:	b9 29 00 00 00       	mov    $0x29,%ecx
+     c52:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(int i = line_count; i > idx; i--)
+     c54:	39 d0                	cmp    %edx,%eax
+     c56:	75 e8                	jne    c40 <upsert_line+0x80>
+     c58:	89 de                	mov    %ebx,%esi
+     c5a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+     c5d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+     c60:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    buffer[idx].number = number;
+     c63:	69 d2 a4 00 00 00    	imul   $0xa4,%edx,%edx
+    editor_copy(buffer[idx].text, text, MAX_COLS);
+     c69:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  int i = 0;
+     c6c:	31 c0                	xor    %eax,%eax
+    editor_copy(buffer[idx].text, text, MAX_COLS);
+     c6e:	81 c7 00 29 00 00    	add    $0x2900,%edi
+    buffer[idx].number = number;
+     c74:	89 9a 00 29 00 00    	mov    %ebx,0x2900(%edx)
+  while(i < max - 1 && src && src[i]){
+     c7a:	eb 12                	jmp    c8e <upsert_line+0xce>
+     c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    dst[i] = src[i];
+     c80:	88 1c 07             	mov    %bl,(%edi,%eax,1)
+    i++;
+     c83:	8d 42 01             	lea    0x1(%edx),%eax
+  while(i < max - 1 && src && src[i]){
+     c86:	81 fa 9e 00 00 00    	cmp    $0x9e,%edx
+     c8c:	74 42                	je     cd0 <upsert_line+0x110>
+     c8e:	0f b6 1c 06          	movzbl (%esi,%eax,1),%ebx
+     c92:	89 c2                	mov    %eax,%edx
+     c94:	84 db                	test   %bl,%bl
+     c96:	75 e8                	jne    c80 <upsert_line+0xc0>
+    line_count++;
+     c98:	8d 41 01             	lea    0x1(%ecx),%eax
+  dst[i] = 0;
+     c9b:	c6 04 17 00          	movb   $0x0,(%edi,%edx,1)
+    line_count++;
+     c9f:	a3 e4 28 00 00       	mov    %eax,0x28e4
+  if(mark_dirty)
+     ca4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ca7:	85 c0                	test   %eax,%eax
+     ca9:	74 0a                	je     cb5 <upsert_line+0xf5>
+    dirty = 1;
+     cab:	c7 05 e0 28 00 00 01 	movl   $0x1,0x28e0
+     cb2:	00 00 00 
+}
+     cb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cb8:	5b                   	pop    %ebx
+     cb9:	5e                   	pop    %esi
+     cba:	5f                   	pop    %edi
+     cbb:	5d                   	pop    %ebp
+     cbc:	c3                   	ret
+     cbd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(idx < line_count && buffer[idx].number == number){
+     cc0:	69 c1 a4 00 00 00    	imul   $0xa4,%ecx,%eax
+     cc6:	83 c0 04             	add    $0x4,%eax
+     cc9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     ccc:	eb 95                	jmp    c63 <upsert_line+0xa3>
+     cce:	66 90                	xchg   %ax,%ax
+     cd0:	ba 9f 00 00 00       	mov    $0x9f,%edx
+     cd5:	eb c1                	jmp    c98 <upsert_line+0xd8>
+     cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cde:	66 90                	xchg   %ax,%ax
+  if(json_mode)
+     ce0:	8b 15 40 28 00 00    	mov    0x2840,%edx
+     ce6:	85 d2                	test   %edx,%edx
+     ce8:	74 2e                	je     d18 <upsert_line+0x158>
+    modern_emit_status("hello-edit", "error", msg, 1, "error");
+     cea:	83 ec 0c             	sub    $0xc,%esp
+     ced:	68 e7 1e 00 00       	push   $0x1ee7
+     cf2:	6a 01                	push   $0x1
+     cf4:	68 fd 1e 00 00       	push   $0x1efd
+     cf9:	68 e7 1e 00 00       	push   $0x1ee7
+     cfe:	68 cc 1e 00 00       	push   $0x1ecc
+     d03:	e8 d8 10 00 00       	call   1de0 <modern_emit_status>
+}
+     d08:	83 c4 20             	add    $0x20,%esp
+}
+     d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d0e:	5b                   	pop    %ebx
+     d0f:	5e                   	pop    %esi
+     d10:	5f                   	pop    %edi
+     d11:	5d                   	pop    %ebp
+     d12:	c3                   	ret
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+    printf(1, "hello-edit: %s\n", msg);
+     d18:	83 ec 04             	sub    $0x4,%esp
+     d1b:	68 fd 1e 00 00       	push   $0x1efd
+     d20:	68 ed 1e 00 00       	push   $0x1eed
+     d25:	6a 01                	push   $0x1
+     d27:	e8 f4 06 00 00       	call   1420 <printf>
+     d2c:	83 c4 10             	add    $0x10,%esp
+}
+     d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d32:	5b                   	pop    %ebx
+     d33:	5e                   	pop    %esi
+     d34:	5f                   	pop    %edi
+     d35:	5d                   	pop    %ebp
+     d36:	c3                   	ret
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+  int i = 0;
+     d40:	31 d2                	xor    %edx,%edx
+     d42:	eb 16                	jmp    d5a <upsert_line+0x19a>
+     d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    dst[i] = src[i];
+     d48:	88 9c 02 04 29 00 00 	mov    %bl,0x2904(%edx,%eax,1)
+    i++;
+     d4f:	8d 51 01             	lea    0x1(%ecx),%edx
+  while(i < max - 1 && src && src[i]){
+     d52:	81 f9 9e 00 00 00    	cmp    $0x9e,%ecx
+     d58:	74 26                	je     d80 <upsert_line+0x1c0>
+     d5a:	0f b6 1c 16          	movzbl (%esi,%edx,1),%ebx
+     d5e:	89 d1                	mov    %edx,%ecx
+     d60:	84 db                	test   %bl,%bl
+     d62:	75 e4                	jne    d48 <upsert_line+0x188>
+  dst[i] = 0;
+     d64:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d67:	c6 84 08 00 29 00 00 	movb   $0x0,0x2900(%eax,%ecx,1)
+     d6e:	00 
+     d6f:	e9 30 ff ff ff       	jmp    ca4 <upsert_line+0xe4>
+  while(i < line_count && buffer[i].number < number)
+     d74:	c7 45 e0 04 00 00 00 	movl   $0x4,-0x20(%ebp)
+     d7b:	e9 e3 fe ff ff       	jmp    c63 <upsert_line+0xa3>
+     d80:	b9 9f 00 00 00       	mov    $0x9f,%ecx
+     d85:	eb dd                	jmp    d64 <upsert_line+0x1a4>
+     d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d8e:	66 90                	xchg   %ax,%ax
+
+00000d90 <load_file>:
+{
+     d90:	55                   	push   %ebp
+     d91:	89 e5                	mov    %esp,%ebp
+     d93:	57                   	push   %edi
+     d94:	56                   	push   %esi
+     d95:	53                   	push   %ebx
+     d96:	89 c3                	mov    %eax,%ebx
+     d98:	81 ec d4 00 00 00    	sub    $0xd4,%esp
+  int fd = open(name, O_RDONLY);
+     d9e:	6a 00                	push   $0x0
+     da0:	50                   	push   %eax
+     da1:	e8 0d 05 00 00       	call   12b3 <open>
+  if(fd < 0){
+     da6:	83 c4 10             	add    $0x10,%esp
+  line_count = 0;
+     da9:	c7 05 e4 28 00 00 00 	movl   $0x0,0x28e4
+     db0:	00 00 00 
+  dirty = 0;
+     db3:	c7 05 e0 28 00 00 00 	movl   $0x0,0x28e0
+     dba:	00 00 00 
+  if(fd < 0){
+     dbd:	85 c0                	test   %eax,%eax
+     dbf:	0f 88 03 02 00 00    	js     fc8 <load_file+0x238>
+  int last = 0;
+     dc5:	c7 85 34 ff ff ff 00 	movl   $0x0,-0xcc(%ebp)
+     dcc:	00 00 00 
+     dcf:	89 c6                	mov    %eax,%esi
+  int pos = 0;
+     dd1:	31 ff                	xor    %edi,%edi
+     dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dd7:	90                   	nop
+  while(read(fd, &ch, 1) == 1){
+     dd8:	83 ec 04             	sub    $0x4,%esp
+     ddb:	8d 85 47 ff ff ff    	lea    -0xb9(%ebp),%eax
+     de1:	6a 01                	push   $0x1
+     de3:	50                   	push   %eax
+     de4:	56                   	push   %esi
+     de5:	e8 a1 04 00 00       	call   128b <read>
+     dea:	83 c4 10             	add    $0x10,%esp
+     ded:	83 f8 01             	cmp    $0x1,%eax
+     df0:	75 2e                	jne    e20 <load_file+0x90>
+    if(ch == '\r')
+     df2:	0f b6 85 47 ff ff ff 	movzbl -0xb9(%ebp),%eax
+     df9:	3c 0d                	cmp    $0xd,%al
+     dfb:	74 db                	je     dd8 <load_file+0x48>
+    if(ch == '\n'){
+     dfd:	3c 0a                	cmp    $0xa,%al
+     dff:	0f 84 13 01 00 00    	je     f18 <load_file+0x188>
+    if(pos < MAX_COLS-1)
+     e05:	81 ff 9e 00 00 00    	cmp    $0x9e,%edi
+     e0b:	7f cb                	jg     dd8 <load_file+0x48>
+      linebuf[pos++] = ch;
+     e0d:	88 84 3d 48 ff ff ff 	mov    %al,-0xb8(%ebp,%edi,1)
+     e14:	83 c7 01             	add    $0x1,%edi
+     e17:	eb bf                	jmp    dd8 <load_file+0x48>
+     e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(pos > 0){
+     e20:	85 ff                	test   %edi,%edi
+     e22:	74 64                	je     e88 <load_file+0xf8>
+    linebuf[pos] = 0;
+     e24:	c6 84 3d 48 ff ff ff 	movb   $0x0,-0xb8(%ebp,%edi,1)
+     e2b:	00 
+  while(*p >= '0' && *p <= '9'){
+     e2c:	0f be 85 48 ff ff ff 	movsbl -0xb8(%ebp),%eax
+     e33:	8d 50 d0             	lea    -0x30(%eax),%edx
+     e36:	80 fa 09             	cmp    $0x9,%dl
+     e39:	0f 87 b5 00 00 00    	ja     ef4 <load_file+0x164>
+  char *p = *s;
+     e3f:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+  int n = 0;
+     e45:	31 ff                	xor    %edi,%edi
+     e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *p - '0';
+     e50:	8d 0c bf             	lea    (%edi,%edi,4),%ecx
+    p++;
+     e53:	83 c2 01             	add    $0x1,%edx
+    n = n*10 + *p - '0';
+     e56:	8d 7c 48 d0          	lea    -0x30(%eax,%ecx,2),%edi
+  while(*p >= '0' && *p <= '9'){
+     e5a:	0f be 02             	movsbl (%edx),%eax
+     e5d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     e60:	80 f9 09             	cmp    $0x9,%cl
+     e63:	76 eb                	jbe    e50 <load_file+0xc0>
+  while(*s == ' ' || *s == '\t')
+     e65:	3c 09                	cmp    $0x9,%al
+     e67:	74 07                	je     e70 <load_file+0xe0>
+     e69:	3c 20                	cmp    $0x20,%al
+     e6b:	75 12                	jne    e7f <load_file+0xef>
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+     e70:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    s++;
+     e74:	83 c2 01             	add    $0x1,%edx
+  while(*s == ' ' || *s == '\t')
+     e77:	3c 20                	cmp    $0x20,%al
+     e79:	74 f5                	je     e70 <load_file+0xe0>
+     e7b:	3c 09                	cmp    $0x9,%al
+     e7d:	74 f1                	je     e70 <load_file+0xe0>
+    upsert_line(number, line, 0);
+     e7f:	31 c9                	xor    %ecx,%ecx
+     e81:	89 f8                	mov    %edi,%eax
+     e83:	e8 38 fd ff ff       	call   bc0 <upsert_line>
+  close(fd);
+     e88:	83 ec 0c             	sub    $0xc,%esp
+     e8b:	56                   	push   %esi
+     e8c:	e8 0a 04 00 00       	call   129b <close>
+  dirty = 0;
+     e91:	83 c4 10             	add    $0x10,%esp
+  int i = 0;
+     e94:	31 c0                	xor    %eax,%eax
+  dirty = 0;
+     e96:	c7 05 e0 28 00 00 00 	movl   $0x0,0x28e0
+     e9d:	00 00 00 
+  while(i < max - 1 && src && src[i]){
+     ea0:	eb 18                	jmp    eba <load_file+0x12a>
+     ea2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dst[i] = src[i];
+     ea8:	88 88 60 28 00 00    	mov    %cl,0x2860(%eax)
+    i++;
+     eae:	8d 42 01             	lea    0x1(%edx),%eax
+  while(i < max - 1 && src && src[i]){
+     eb1:	83 fa 7e             	cmp    $0x7e,%edx
+     eb4:	0f 84 fe 00 00 00    	je     fb8 <load_file+0x228>
+     eba:	0f b6 0c 03          	movzbl (%ebx,%eax,1),%ecx
+     ebe:	89 c2                	mov    %eax,%edx
+     ec0:	84 c9                	test   %cl,%cl
+     ec2:	75 e4                	jne    ea8 <load_file+0x118>
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     ec4:	83 ec 0c             	sub    $0xc,%esp
+  dst[i] = 0;
+     ec7:	c6 82 60 28 00 00 00 	movb   $0x0,0x2860(%edx)
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     ece:	68 c6 1e 00 00       	push   $0x1ec6
+     ed3:	ff 35 40 28 00 00    	push   0x2840
+     ed9:	53                   	push   %ebx
+     eda:	68 22 1f 00 00       	push   $0x1f22
+     edf:	68 cc 1e 00 00       	push   $0x1ecc
+     ee4:	e8 f7 0e 00 00       	call   1de0 <modern_emit_status>
+     ee9:	83 c4 20             	add    $0x20,%esp
+}
+     eec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eef:	5b                   	pop    %ebx
+     ef0:	5e                   	pop    %esi
+     ef1:	5f                   	pop    %edi
+     ef2:	5d                   	pop    %ebp
+     ef3:	c3                   	ret
+      number = last + 10;
+     ef4:	8b bd 34 ff ff ff    	mov    -0xcc(%ebp),%edi
+    char *line = linebuf;
+     efa:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+    upsert_line(number, line, 0);
+     f00:	31 c9                	xor    %ecx,%ecx
+      number = last + 10;
+     f02:	83 c7 0a             	add    $0xa,%edi
+    upsert_line(number, line, 0);
+     f05:	89 f8                	mov    %edi,%eax
+     f07:	e8 b4 fc ff ff       	call   bc0 <upsert_line>
+     f0c:	e9 77 ff ff ff       	jmp    e88 <load_file+0xf8>
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      linebuf[pos] = 0;
+     f18:	c6 84 3d 48 ff ff ff 	movb   $0x0,-0xb8(%ebp,%edi,1)
+     f1f:	00 
+  while(*p >= '0' && *p <= '9'){
+     f20:	0f be 85 48 ff ff ff 	movsbl -0xb8(%ebp),%eax
+     f27:	8d 50 d0             	lea    -0x30(%eax),%edx
+     f2a:	80 fa 09             	cmp    $0x9,%dl
+     f2d:	77 60                	ja     f8f <load_file+0x1ff>
+  char *p = *s;
+     f2f:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+  int n = 0;
+     f35:	31 ff                	xor    %edi,%edi
+     f37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f3e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *p - '0';
+     f40:	8d 0c bf             	lea    (%edi,%edi,4),%ecx
+    p++;
+     f43:	83 c2 01             	add    $0x1,%edx
+    n = n*10 + *p - '0';
+     f46:	8d 7c 48 d0          	lea    -0x30(%eax,%ecx,2),%edi
+  while(*p >= '0' && *p <= '9'){
+     f4a:	0f be 02             	movsbl (%edx),%eax
+     f4d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     f50:	80 f9 09             	cmp    $0x9,%cl
+     f53:	76 eb                	jbe    f40 <load_file+0x1b0>
+  while(*s == ' ' || *s == '\t')
+     f55:	8b 8d 34 ff ff ff    	mov    -0xcc(%ebp),%ecx
+     f5b:	39 f9                	cmp    %edi,%ecx
+     f5d:	0f 4c cf             	cmovl  %edi,%ecx
+     f60:	89 8d 34 ff ff ff    	mov    %ecx,-0xcc(%ebp)
+     f66:	3c 09                	cmp    $0x9,%al
+     f68:	74 06                	je     f70 <load_file+0x1e0>
+     f6a:	3c 20                	cmp    $0x20,%al
+     f6c:	75 11                	jne    f7f <load_file+0x1ef>
+     f6e:	66 90                	xchg   %ax,%ax
+     f70:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    s++;
+     f74:	83 c2 01             	add    $0x1,%edx
+  while(*s == ' ' || *s == '\t')
+     f77:	3c 20                	cmp    $0x20,%al
+     f79:	74 f5                	je     f70 <load_file+0x1e0>
+     f7b:	3c 09                	cmp    $0x9,%al
+     f7d:	74 f1                	je     f70 <load_file+0x1e0>
+      upsert_line(number, line, 0);
+     f7f:	89 f8                	mov    %edi,%eax
+     f81:	31 c9                	xor    %ecx,%ecx
+      pos = 0;
+     f83:	31 ff                	xor    %edi,%edi
+      upsert_line(number, line, 0);
+     f85:	e8 36 fc ff ff       	call   bc0 <upsert_line>
+      continue;
+     f8a:	e9 49 fe ff ff       	jmp    dd8 <load_file+0x48>
+        number = (last += 10);
+     f8f:	8b bd 34 ff ff ff    	mov    -0xcc(%ebp),%edi
+      char *line = linebuf;
+     f95:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+      upsert_line(number, line, 0);
+     f9b:	31 c9                	xor    %ecx,%ecx
+        number = (last += 10);
+     f9d:	83 c7 0a             	add    $0xa,%edi
+      upsert_line(number, line, 0);
+     fa0:	89 f8                	mov    %edi,%eax
+        number = (last += 10);
+     fa2:	89 bd 34 ff ff ff    	mov    %edi,-0xcc(%ebp)
+      pos = 0;
+     fa8:	31 ff                	xor    %edi,%edi
+      upsert_line(number, line, 0);
+     faa:	e8 11 fc ff ff       	call   bc0 <upsert_line>
+      continue;
+     faf:	e9 24 fe ff ff       	jmp    dd8 <load_file+0x48>
+     fb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fb8:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     fbd:	e9 02 ff ff ff       	jmp    ec4 <load_file+0x134>
+     fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "hello-edit: new file %s\n", name);
+     fc8:	83 ec 04             	sub    $0x4,%esp
+     fcb:	53                   	push   %ebx
+     fcc:	68 09 1f 00 00       	push   $0x1f09
+     fd1:	6a 01                	push   $0x1
+     fd3:	e8 48 04 00 00       	call   1420 <printf>
+     fd8:	83 c4 10             	add    $0x10,%esp
+  int i = 0;
+     fdb:	31 c0                	xor    %eax,%eax
+     fdd:	eb 0f                	jmp    fee <load_file+0x25e>
+     fdf:	90                   	nop
+    dst[i] = src[i];
+     fe0:	88 88 60 28 00 00    	mov    %cl,0x2860(%eax)
+    i++;
+     fe6:	8d 42 01             	lea    0x1(%edx),%eax
+  while(i < max - 1 && src && src[i]){
+     fe9:	83 fa 7e             	cmp    $0x7e,%edx
+     fec:	74 2e                	je     101c <load_file+0x28c>
+     fee:	0f b6 0c 03          	movzbl (%ebx,%eax,1),%ecx
+     ff2:	89 c2                	mov    %eax,%edx
+     ff4:	84 c9                	test   %cl,%cl
+     ff6:	75 e8                	jne    fe0 <load_file+0x250>
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+     ff8:	a1 e0 28 00 00       	mov    0x28e0,%eax
+  dst[i] = 0;
+     ffd:	c6 82 60 28 00 00 00 	movb   $0x0,0x2860(%edx)
+  modern_emit_status("hello-edit", event, detail, json_mode, dirty ? "dirty" : "clean");
+    1004:	ba c0 1e 00 00       	mov    $0x1ec0,%edx
+    1009:	85 c0                	test   %eax,%eax
+    100b:	b8 c6 1e 00 00       	mov    $0x1ec6,%eax
+    1010:	0f 45 c2             	cmovne %edx,%eax
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	50                   	push   %eax
+    1017:	e9 b7 fe ff ff       	jmp    ed3 <load_file+0x143>
+    101c:	ba 7f 00 00 00       	mov    $0x7f,%edx
+    1021:	eb d5                	jmp    ff8 <load_file+0x268>
+    1023:	66 90                	xchg   %ax,%ax
+    1025:	66 90                	xchg   %ax,%ax
+    1027:	66 90                	xchg   %ax,%ax
+    1029:	66 90                	xchg   %ax,%ax
+    102b:	66 90                	xchg   %ax,%ax
+    102d:	66 90                	xchg   %ax,%ax
+    102f:	90                   	nop
+
+00001030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    1030:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1031:	31 c0                	xor    %eax,%eax
+{
+    1033:	89 e5                	mov    %esp,%ebp
+    1035:	53                   	push   %ebx
+    1036:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1039:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    103c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1040:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1044:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1047:	83 c0 01             	add    $0x1,%eax
+    104a:	84 d2                	test   %dl,%dl
+    104c:	75 f2                	jne    1040 <strcpy+0x10>
+    ;
+  return os;
+}
+    104e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1051:	89 c8                	mov    %ecx,%eax
+    1053:	c9                   	leave
+    1054:	c3                   	ret
+    1055:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	53                   	push   %ebx
+    1064:	8b 55 08             	mov    0x8(%ebp),%edx
+    1067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    106a:	0f b6 02             	movzbl (%edx),%eax
+    106d:	84 c0                	test   %al,%al
+    106f:	75 17                	jne    1088 <strcmp+0x28>
+    1071:	eb 3a                	jmp    10ad <strcmp+0x4d>
+    1073:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1077:	90                   	nop
+    1078:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    107c:	83 c2 01             	add    $0x1,%edx
+    107f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1082:	84 c0                	test   %al,%al
+    1084:	74 1a                	je     10a0 <strcmp+0x40>
+    p++, q++;
+    1086:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1088:	0f b6 19             	movzbl (%ecx),%ebx
+    108b:	38 c3                	cmp    %al,%bl
+    108d:	74 e9                	je     1078 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    108f:	29 d8                	sub    %ebx,%eax
+}
+    1091:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1094:	c9                   	leave
+    1095:	c3                   	ret
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    10a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    10a4:	31 c0                	xor    %eax,%eax
+    10a6:	29 d8                	sub    %ebx,%eax
+}
+    10a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ab:	c9                   	leave
+    10ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    10ad:	0f b6 19             	movzbl (%ecx),%ebx
+    10b0:	31 c0                	xor    %eax,%eax
+    10b2:	eb db                	jmp    108f <strcmp+0x2f>
+    10b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10bf:	90                   	nop
+
+000010c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    10c6:	80 3a 00             	cmpb   $0x0,(%edx)
+    10c9:	74 15                	je     10e0 <strlen+0x20>
+    10cb:	31 c0                	xor    %eax,%eax
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+    10d0:	83 c0 01             	add    $0x1,%eax
+    10d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    10d7:	89 c1                	mov    %eax,%ecx
+    10d9:	75 f5                	jne    10d0 <strlen+0x10>
+    ;
+  return n;
+}
+    10db:	89 c8                	mov    %ecx,%eax
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+    10df:	90                   	nop
+  for(n = 0; s[n]; n++)
+    10e0:	31 c9                	xor    %ecx,%ecx
+}
+    10e2:	5d                   	pop    %ebp
+    10e3:	89 c8                	mov    %ecx,%eax
+    10e5:	c3                   	ret
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    10f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10fd:	89 d7                	mov    %edx,%edi
+    10ff:	fc                   	cld
+    1100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1105:	89 d0                	mov    %edx,%eax
+    1107:	c9                   	leave
+    1108:	c3                   	ret
+    1109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	8b 45 08             	mov    0x8(%ebp),%eax
+    1116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    111a:	0f b6 10             	movzbl (%eax),%edx
+    111d:	84 d2                	test   %dl,%dl
+    111f:	75 12                	jne    1133 <strchr+0x23>
+    1121:	eb 1d                	jmp    1140 <strchr+0x30>
+    1123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1127:	90                   	nop
+    1128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    112c:	83 c0 01             	add    $0x1,%eax
+    112f:	84 d2                	test   %dl,%dl
+    1131:	74 0d                	je     1140 <strchr+0x30>
+    if(*s == c)
+    1133:	38 d1                	cmp    %dl,%cl
+    1135:	75 f1                	jne    1128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1137:	5d                   	pop    %ebp
+    1138:	c3                   	ret
+    1139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1140:	31 c0                	xor    %eax,%eax
+}
+    1142:	5d                   	pop    %ebp
+    1143:	c3                   	ret
+    1144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    114b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    114f:	90                   	nop
+
+00001150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	57                   	push   %edi
+    1154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1159:	31 db                	xor    %ebx,%ebx
+{
+    115b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    115e:	eb 27                	jmp    1187 <gets+0x37>
+    cc = read(0, &c, 1);
+    1160:	83 ec 04             	sub    $0x4,%esp
+    1163:	6a 01                	push   $0x1
+    1165:	56                   	push   %esi
+    1166:	6a 00                	push   $0x0
+    1168:	e8 1e 01 00 00       	call   128b <read>
+    if(cc < 1)
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	85 c0                	test   %eax,%eax
+    1172:	7e 1d                	jle    1191 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1178:	8b 55 08             	mov    0x8(%ebp),%edx
+    117b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    117f:	3c 0a                	cmp    $0xa,%al
+    1181:	74 10                	je     1193 <gets+0x43>
+    1183:	3c 0d                	cmp    $0xd,%al
+    1185:	74 0c                	je     1193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1187:	89 df                	mov    %ebx,%edi
+    1189:	83 c3 01             	add    $0x1,%ebx
+    118c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    118f:	7c cf                	jl     1160 <gets+0x10>
+    1191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1193:	8b 45 08             	mov    0x8(%ebp),%eax
+    1196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    119d:	5b                   	pop    %ebx
+    119e:	5e                   	pop    %esi
+    119f:	5f                   	pop    %edi
+    11a0:	5d                   	pop    %ebp
+    11a1:	c3                   	ret
+    11a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000011b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	56                   	push   %esi
+    11b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11b5:	83 ec 08             	sub    $0x8,%esp
+    11b8:	6a 00                	push   $0x0
+    11ba:	ff 75 08             	push   0x8(%ebp)
+    11bd:	e8 f1 00 00 00       	call   12b3 <open>
+  if(fd < 0)
+    11c2:	83 c4 10             	add    $0x10,%esp
+    11c5:	85 c0                	test   %eax,%eax
+    11c7:	78 27                	js     11f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    11c9:	83 ec 08             	sub    $0x8,%esp
+    11cc:	ff 75 0c             	push   0xc(%ebp)
+    11cf:	89 c3                	mov    %eax,%ebx
+    11d1:	50                   	push   %eax
+    11d2:	e8 f4 00 00 00       	call   12cb <fstat>
+  close(fd);
+    11d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    11da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    11dc:	e8 ba 00 00 00       	call   129b <close>
+  return r;
+    11e1:	83 c4 10             	add    $0x10,%esp
+}
+    11e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e7:	89 f0                	mov    %esi,%eax
+    11e9:	5b                   	pop    %ebx
+    11ea:	5e                   	pop    %esi
+    11eb:	5d                   	pop    %ebp
+    11ec:	c3                   	ret
+    11ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    11f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11f5:	eb ed                	jmp    11e4 <stat+0x34>
+    11f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fe:	66 90                	xchg   %ax,%ax
+
+00001200 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1200:	55                   	push   %ebp
+    1201:	89 e5                	mov    %esp,%ebp
+    1203:	53                   	push   %ebx
+    1204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1207:	0f be 02             	movsbl (%edx),%eax
+    120a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    120d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1215:	77 1e                	ja     1235 <atoi+0x35>
+    1217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1220:	83 c2 01             	add    $0x1,%edx
+    1223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    122a:	0f be 02             	movsbl (%edx),%eax
+    122d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1230:	80 fb 09             	cmp    $0x9,%bl
+    1233:	76 eb                	jbe    1220 <atoi+0x20>
+  return n;
+}
+    1235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1238:	89 c8                	mov    %ecx,%eax
+    123a:	c9                   	leave
+    123b:	c3                   	ret
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	8b 45 10             	mov    0x10(%ebp),%eax
+    1248:	8b 55 08             	mov    0x8(%ebp),%edx
+    124b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    124e:	85 c0                	test   %eax,%eax
+    1250:	7e 13                	jle    1265 <memmove+0x25>
+    1252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1254:	89 d7                	mov    %edx,%edi
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1261:	39 f8                	cmp    %edi,%eax
+    1263:	75 fb                	jne    1260 <memmove+0x20>
+  return vdst;
+}
+    1265:	5e                   	pop    %esi
+    1266:	89 d0                	mov    %edx,%eax
+    1268:	5f                   	pop    %edi
+    1269:	5d                   	pop    %ebp
+    126a:	c3                   	ret
+
+0000126b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    126b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1270:	cd 40                	int    $0x40
+    1272:	c3                   	ret
+
+00001273 <exit>:
+SYSCALL(exit)
+    1273:	b8 02 00 00 00       	mov    $0x2,%eax
+    1278:	cd 40                	int    $0x40
+    127a:	c3                   	ret
+
+0000127b <wait>:
+SYSCALL(wait)
+    127b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1280:	cd 40                	int    $0x40
+    1282:	c3                   	ret
+
+00001283 <pipe>:
+SYSCALL(pipe)
+    1283:	b8 04 00 00 00       	mov    $0x4,%eax
+    1288:	cd 40                	int    $0x40
+    128a:	c3                   	ret
+
+0000128b <read>:
+SYSCALL(read)
+    128b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1290:	cd 40                	int    $0x40
+    1292:	c3                   	ret
+
+00001293 <write>:
+SYSCALL(write)
+    1293:	b8 10 00 00 00       	mov    $0x10,%eax
+    1298:	cd 40                	int    $0x40
+    129a:	c3                   	ret
+
+0000129b <close>:
+SYSCALL(close)
+    129b:	b8 15 00 00 00       	mov    $0x15,%eax
+    12a0:	cd 40                	int    $0x40
+    12a2:	c3                   	ret
+
+000012a3 <kill>:
+SYSCALL(kill)
+    12a3:	b8 06 00 00 00       	mov    $0x6,%eax
+    12a8:	cd 40                	int    $0x40
+    12aa:	c3                   	ret
+
+000012ab <exec>:
+SYSCALL(exec)
+    12ab:	b8 07 00 00 00       	mov    $0x7,%eax
+    12b0:	cd 40                	int    $0x40
+    12b2:	c3                   	ret
+
+000012b3 <open>:
+SYSCALL(open)
+    12b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12b8:	cd 40                	int    $0x40
+    12ba:	c3                   	ret
+
+000012bb <mknod>:
+SYSCALL(mknod)
+    12bb:	b8 11 00 00 00       	mov    $0x11,%eax
+    12c0:	cd 40                	int    $0x40
+    12c2:	c3                   	ret
+
+000012c3 <unlink>:
+SYSCALL(unlink)
+    12c3:	b8 12 00 00 00       	mov    $0x12,%eax
+    12c8:	cd 40                	int    $0x40
+    12ca:	c3                   	ret
+
+000012cb <fstat>:
+SYSCALL(fstat)
+    12cb:	b8 08 00 00 00       	mov    $0x8,%eax
+    12d0:	cd 40                	int    $0x40
+    12d2:	c3                   	ret
+
+000012d3 <link>:
+SYSCALL(link)
+    12d3:	b8 13 00 00 00       	mov    $0x13,%eax
+    12d8:	cd 40                	int    $0x40
+    12da:	c3                   	ret
+
+000012db <mkdir>:
+SYSCALL(mkdir)
+    12db:	b8 14 00 00 00       	mov    $0x14,%eax
+    12e0:	cd 40                	int    $0x40
+    12e2:	c3                   	ret
+
+000012e3 <chdir>:
+SYSCALL(chdir)
+    12e3:	b8 09 00 00 00       	mov    $0x9,%eax
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <dup>:
+SYSCALL(dup)
+    12eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    12f0:	cd 40                	int    $0x40
+    12f2:	c3                   	ret
+
+000012f3 <getpid>:
+SYSCALL(getpid)
+    12f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    12f8:	cd 40                	int    $0x40
+    12fa:	c3                   	ret
+
+000012fb <sbrk>:
+SYSCALL(sbrk)
+    12fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <sleep>:
+SYSCALL(sleep)
+    1303:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1308:	cd 40                	int    $0x40
+    130a:	c3                   	ret
+
+0000130b <uptime>:
+SYSCALL(uptime)
+    130b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1310:	cd 40                	int    $0x40
+    1312:	c3                   	ret
+
+00001313 <poll>:
+SYSCALL(poll)
+    1313:	b8 16 00 00 00       	mov    $0x16,%eax
+    1318:	cd 40                	int    $0x40
+    131a:	c3                   	ret
+
+0000131b <fcntl>:
+SYSCALL(fcntl)
+    131b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1320:	cd 40                	int    $0x40
+    1322:	c3                   	ret
+
+00001323 <lseek>:
+SYSCALL(lseek)
+    1323:	b8 18 00 00 00       	mov    $0x18,%eax
+    1328:	cd 40                	int    $0x40
+    132a:	c3                   	ret
+
+0000132b <pread>:
+SYSCALL(pread)
+    132b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1330:	cd 40                	int    $0x40
+    1332:	c3                   	ret
+
+00001333 <pwrite>:
+SYSCALL(pwrite)
+    1333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1338:	cd 40                	int    $0x40
+    133a:	c3                   	ret
+
+0000133b <readv>:
+SYSCALL(readv)
+    133b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1340:	cd 40                	int    $0x40
+    1342:	c3                   	ret
+
+00001343 <writev>:
+SYSCALL(writev)
+    1343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1348:	cd 40                	int    $0x40
+    134a:	c3                   	ret
+
+0000134b <getdents>:
+SYSCALL(getdents)
+    134b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <splice>:
+SYSCALL(splice)
+    1353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1358:	cd 40                	int    $0x40
+    135a:	c3                   	ret
+
+0000135b <ioring_setup>:
+SYSCALL(ioring_setup)
+    135b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1360:	cd 40                	int    $0x40
+    1362:	c3                   	ret
+
+00001363 <ioring_enter>:
+SYSCALL(ioring_enter)
+    1363:	b8 20 00 00 00       	mov    $0x20,%eax
+    1368:	cd 40                	int    $0x40
+    136a:	c3                   	ret
+
+0000136b <batch>:
+SYSCALL(batch)
+    136b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1370:	cd 40                	int    $0x40
+    1372:	c3                   	ret
+    1373:	66 90                	xchg   %ax,%ax
+    1375:	66 90                	xchg   %ax,%ax
+    1377:	66 90                	xchg   %ax,%ax
+    1379:	66 90                	xchg   %ax,%ax
+    137b:	66 90                	xchg   %ax,%ax
+    137d:	66 90                	xchg   %ax,%ax
+    137f:	90                   	nop
+
+00001380 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	56                   	push   %esi
+    1385:	53                   	push   %ebx
+    1386:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1388:	89 d1                	mov    %edx,%ecx
+{
+    138a:	83 ec 3c             	sub    $0x3c,%esp
+    138d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1390:	85 d2                	test   %edx,%edx
+    1392:	0f 89 80 00 00 00    	jns    1418 <printint+0x98>
+    1398:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    139c:	74 7a                	je     1418 <printint+0x98>
+    x = -xx;
+    139e:	f7 d9                	neg    %ecx
+    neg = 1;
+    13a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    13a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    13a8:	31 f6                	xor    %esi,%esi
+    13aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    13b0:	89 c8                	mov    %ecx,%eax
+    13b2:	31 d2                	xor    %edx,%edx
+    13b4:	89 f7                	mov    %esi,%edi
+    13b6:	f7 f3                	div    %ebx
+    13b8:	8d 76 01             	lea    0x1(%esi),%esi
+    13bb:	0f b6 92 f4 21 00 00 	movzbl 0x21f4(%edx),%edx
+    13c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    13c6:	89 ca                	mov    %ecx,%edx
+    13c8:	89 c1                	mov    %eax,%ecx
+    13ca:	39 da                	cmp    %ebx,%edx
+    13cc:	73 e2                	jae    13b0 <printint+0x30>
+  if(neg)
+    13ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    13d1:	85 c0                	test   %eax,%eax
+    13d3:	74 07                	je     13dc <printint+0x5c>
+    buf[i++] = '-';
+    13d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    13da:	89 f7                	mov    %esi,%edi
+    13dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    13df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    13e2:	01 df                	add    %ebx,%edi
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    13e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    13eb:	83 ec 04             	sub    $0x4,%esp
+    13ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+    13f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    13f4:	6a 01                	push   $0x1
+    13f6:	50                   	push   %eax
+    13f7:	56                   	push   %esi
+    13f8:	e8 96 fe ff ff       	call   1293 <write>
+  while(--i >= 0)
+    13fd:	89 f8                	mov    %edi,%eax
+    13ff:	83 c4 10             	add    $0x10,%esp
+    1402:	83 ef 01             	sub    $0x1,%edi
+    1405:	39 d8                	cmp    %ebx,%eax
+    1407:	75 df                	jne    13e8 <printint+0x68>
+}
+    1409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    140c:	5b                   	pop    %ebx
+    140d:	5e                   	pop    %esi
+    140e:	5f                   	pop    %edi
+    140f:	5d                   	pop    %ebp
+    1410:	c3                   	ret
+    1411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1418:	31 c0                	xor    %eax,%eax
+    141a:	eb 89                	jmp    13a5 <printint+0x25>
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001420 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1429:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    142c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    142f:	0f b6 1e             	movzbl (%esi),%ebx
+    1432:	83 c6 01             	add    $0x1,%esi
+    1435:	84 db                	test   %bl,%bl
+    1437:	74 67                	je     14a0 <printf+0x80>
+    1439:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    143c:	31 d2                	xor    %edx,%edx
+    143e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1441:	eb 34                	jmp    1477 <printf+0x57>
+    1443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1447:	90                   	nop
+    1448:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    144b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1450:	83 f8 25             	cmp    $0x25,%eax
+    1453:	74 18                	je     146d <printf+0x4d>
+  write(fd, &c, 1);
+    1455:	83 ec 04             	sub    $0x4,%esp
+    1458:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    145b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    145e:	6a 01                	push   $0x1
+    1460:	50                   	push   %eax
+    1461:	57                   	push   %edi
+    1462:	e8 2c fe ff ff       	call   1293 <write>
+    1467:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    146a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    146d:	0f b6 1e             	movzbl (%esi),%ebx
+    1470:	83 c6 01             	add    $0x1,%esi
+    1473:	84 db                	test   %bl,%bl
+    1475:	74 29                	je     14a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1477:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    147a:	85 d2                	test   %edx,%edx
+    147c:	74 ca                	je     1448 <printf+0x28>
+      }
+    } else if(state == '%'){
+    147e:	83 fa 25             	cmp    $0x25,%edx
+    1481:	75 ea                	jne    146d <printf+0x4d>
+      if(c == 'd'){
+    1483:	83 f8 25             	cmp    $0x25,%eax
+    1486:	0f 84 24 01 00 00    	je     15b0 <printf+0x190>
+    148c:	83 e8 63             	sub    $0x63,%eax
+    148f:	83 f8 15             	cmp    $0x15,%eax
+    1492:	77 1c                	ja     14b0 <printf+0x90>
+    1494:	ff 24 85 9c 21 00 00 	jmp    *0x219c(,%eax,4)
+    149b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    149f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    14a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14a3:	5b                   	pop    %ebx
+    14a4:	5e                   	pop    %esi
+    14a5:	5f                   	pop    %edi
+    14a6:	5d                   	pop    %ebp
+    14a7:	c3                   	ret
+    14a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14af:	90                   	nop
+  write(fd, &c, 1);
+    14b0:	83 ec 04             	sub    $0x4,%esp
+    14b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    14b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    14ba:	6a 01                	push   $0x1
+    14bc:	52                   	push   %edx
+    14bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    14c0:	57                   	push   %edi
+    14c1:	e8 cd fd ff ff       	call   1293 <write>
+    14c6:	83 c4 0c             	add    $0xc,%esp
+    14c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14cc:	6a 01                	push   $0x1
+    14ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    14d1:	52                   	push   %edx
+    14d2:	57                   	push   %edi
+    14d3:	e8 bb fd ff ff       	call   1293 <write>
+        putc(fd, c);
+    14d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    14db:	31 d2                	xor    %edx,%edx
+    14dd:	eb 8e                	jmp    146d <printf+0x4d>
+    14df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    14e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    14e3:	83 ec 0c             	sub    $0xc,%esp
+    14e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    14eb:	8b 13                	mov    (%ebx),%edx
+    14ed:	6a 00                	push   $0x0
+    14ef:	89 f8                	mov    %edi,%eax
+        ap++;
+    14f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    14f4:	e8 87 fe ff ff       	call   1380 <printint>
+        ap++;
+    14f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    14fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    14ff:	31 d2                	xor    %edx,%edx
+    1501:	e9 67 ff ff ff       	jmp    146d <printf+0x4d>
+    1506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1510:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1513:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1515:	83 c0 04             	add    $0x4,%eax
+    1518:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    151b:	85 db                	test   %ebx,%ebx
+    151d:	0f 84 9d 00 00 00    	je     15c0 <printf+0x1a0>
+        while(*s != 0){
+    1523:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1526:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1528:	84 c0                	test   %al,%al
+    152a:	0f 84 3d ff ff ff    	je     146d <printf+0x4d>
+    1530:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1533:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1536:	89 de                	mov    %ebx,%esi
+    1538:	89 d3                	mov    %edx,%ebx
+    153a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1540:	83 ec 04             	sub    $0x4,%esp
+    1543:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1546:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1549:	6a 01                	push   $0x1
+    154b:	53                   	push   %ebx
+    154c:	57                   	push   %edi
+    154d:	e8 41 fd ff ff       	call   1293 <write>
+        while(*s != 0){
+    1552:	0f b6 06             	movzbl (%esi),%eax
+    1555:	83 c4 10             	add    $0x10,%esp
+    1558:	84 c0                	test   %al,%al
+    155a:	75 e4                	jne    1540 <printf+0x120>
+      state = 0;
+    155c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    155f:	31 d2                	xor    %edx,%edx
+    1561:	e9 07 ff ff ff       	jmp    146d <printf+0x4d>
+    1566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    156d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1573:	83 ec 0c             	sub    $0xc,%esp
+    1576:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    157b:	8b 13                	mov    (%ebx),%edx
+    157d:	6a 01                	push   $0x1
+    157f:	e9 6b ff ff ff       	jmp    14ef <printf+0xcf>
+    1584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1588:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    158b:	83 ec 04             	sub    $0x4,%esp
+    158e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1591:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1593:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1596:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1599:	6a 01                	push   $0x1
+    159b:	52                   	push   %edx
+    159c:	57                   	push   %edi
+    159d:	e8 f1 fc ff ff       	call   1293 <write>
+        ap++;
+    15a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    15a8:	31 d2                	xor    %edx,%edx
+    15aa:	e9 be fe ff ff       	jmp    146d <printf+0x4d>
+    15af:	90                   	nop
+  write(fd, &c, 1);
+    15b0:	83 ec 04             	sub    $0x4,%esp
+    15b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    15b9:	6a 01                	push   $0x1
+    15bb:	e9 11 ff ff ff       	jmp    14d1 <printf+0xb1>
+    15c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    15c5:	bb 94 21 00 00       	mov    $0x2194,%ebx
+    15ca:	e9 61 ff ff ff       	jmp    1530 <printf+0x110>
+    15cf:	90                   	nop
+
+000015d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    15d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15d1:	a1 00 71 01 00       	mov    0x17100,%eax
+{
+    15d6:	89 e5                	mov    %esp,%ebp
+    15d8:	57                   	push   %edi
+    15d9:	56                   	push   %esi
+    15da:	53                   	push   %ebx
+    15db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    15de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15ec:	39 ca                	cmp    %ecx,%edx
+    15ee:	73 30                	jae    1620 <free+0x50>
+    15f0:	39 c1                	cmp    %eax,%ecx
+    15f2:	72 04                	jb     15f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15f4:	39 c2                	cmp    %eax,%edx
+    15f6:	72 f0                	jb     15e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    15f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    15fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    15fe:	39 f8                	cmp    %edi,%eax
+    1600:	74 2e                	je     1630 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1602:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1605:	8b 42 04             	mov    0x4(%edx),%eax
+    1608:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    160b:	39 f1                	cmp    %esi,%ecx
+    160d:	74 38                	je     1647 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    160f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1611:	5b                   	pop    %ebx
+  freep = p;
+    1612:	89 15 00 71 01 00    	mov    %edx,0x17100
+}
+    1618:	5e                   	pop    %esi
+    1619:	5f                   	pop    %edi
+    161a:	5d                   	pop    %ebp
+    161b:	c3                   	ret
+    161c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1620:	39 c1                	cmp    %eax,%ecx
+    1622:	72 d0                	jb     15f4 <free+0x24>
+    1624:	eb c2                	jmp    15e8 <free+0x18>
+    1626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    162d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1630:	03 70 04             	add    0x4(%eax),%esi
+    1633:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1636:	8b 02                	mov    (%edx),%eax
+    1638:	8b 00                	mov    (%eax),%eax
+    163a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    163d:	8b 42 04             	mov    0x4(%edx),%eax
+    1640:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1643:	39 f1                	cmp    %esi,%ecx
+    1645:	75 c8                	jne    160f <free+0x3f>
+    p->s.size += bp->s.size;
+    1647:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    164a:	89 15 00 71 01 00    	mov    %edx,0x17100
+    p->s.size += bp->s.size;
+    1650:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1653:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1656:	89 0a                	mov    %ecx,(%edx)
+}
+    1658:	5b                   	pop    %ebx
+    1659:	5e                   	pop    %esi
+    165a:	5f                   	pop    %edi
+    165b:	5d                   	pop    %ebp
+    165c:	c3                   	ret
+    165d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001660 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1660:	55                   	push   %ebp
+    1661:	89 e5                	mov    %esp,%ebp
+    1663:	57                   	push   %edi
+    1664:	56                   	push   %esi
+    1665:	53                   	push   %ebx
+    1666:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1669:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    166c:	8b 15 00 71 01 00    	mov    0x17100,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1672:	8d 78 07             	lea    0x7(%eax),%edi
+    1675:	c1 ef 03             	shr    $0x3,%edi
+    1678:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    167b:	85 d2                	test   %edx,%edx
+    167d:	0f 84 8d 00 00 00    	je     1710 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1683:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1685:	8b 48 04             	mov    0x4(%eax),%ecx
+    1688:	39 f9                	cmp    %edi,%ecx
+    168a:	73 64                	jae    16f0 <malloc+0x90>
+  if(nu < 4096)
+    168c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1691:	39 df                	cmp    %ebx,%edi
+    1693:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1696:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    169d:	eb 0a                	jmp    16a9 <malloc+0x49>
+    169f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    16a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    16a5:	39 f9                	cmp    %edi,%ecx
+    16a7:	73 47                	jae    16f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    16a9:	89 c2                	mov    %eax,%edx
+    16ab:	39 05 00 71 01 00    	cmp    %eax,0x17100
+    16b1:	75 ed                	jne    16a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    16b3:	83 ec 0c             	sub    $0xc,%esp
+    16b6:	56                   	push   %esi
+    16b7:	e8 3f fc ff ff       	call   12fb <sbrk>
+  if(p == (char*)-1)
+    16bc:	83 c4 10             	add    $0x10,%esp
+    16bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16c2:	74 1c                	je     16e0 <malloc+0x80>
+  hp->s.size = nu;
+    16c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    16c7:	83 ec 0c             	sub    $0xc,%esp
+    16ca:	83 c0 08             	add    $0x8,%eax
+    16cd:	50                   	push   %eax
+    16ce:	e8 fd fe ff ff       	call   15d0 <free>
+  return freep;
+    16d3:	8b 15 00 71 01 00    	mov    0x17100,%edx
+      if((p = morecore(nunits)) == 0)
+    16d9:	83 c4 10             	add    $0x10,%esp
+    16dc:	85 d2                	test   %edx,%edx
+    16de:	75 c0                	jne    16a0 <malloc+0x40>
+        return 0;
+  }
+}
+    16e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    16e3:	31 c0                	xor    %eax,%eax
+}
+    16e5:	5b                   	pop    %ebx
+    16e6:	5e                   	pop    %esi
+    16e7:	5f                   	pop    %edi
+    16e8:	5d                   	pop    %ebp
+    16e9:	c3                   	ret
+    16ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    16f0:	39 cf                	cmp    %ecx,%edi
+    16f2:	74 4c                	je     1740 <malloc+0xe0>
+        p->s.size -= nunits;
+    16f4:	29 f9                	sub    %edi,%ecx
+    16f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    16f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    16fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    16ff:	89 15 00 71 01 00    	mov    %edx,0x17100
+}
+    1705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1708:	83 c0 08             	add    $0x8,%eax
+}
+    170b:	5b                   	pop    %ebx
+    170c:	5e                   	pop    %esi
+    170d:	5f                   	pop    %edi
+    170e:	5d                   	pop    %ebp
+    170f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1710:	c7 05 00 71 01 00 04 	movl   $0x17104,0x17100
+    1717:	71 01 00 
+    base.s.size = 0;
+    171a:	b8 04 71 01 00       	mov    $0x17104,%eax
+    base.s.ptr = freep = prevp = &base;
+    171f:	c7 05 04 71 01 00 04 	movl   $0x17104,0x17104
+    1726:	71 01 00 
+    base.s.size = 0;
+    1729:	c7 05 08 71 01 00 00 	movl   $0x0,0x17108
+    1730:	00 00 00 
+    if(p->s.size >= nunits){
+    1733:	e9 54 ff ff ff       	jmp    168c <malloc+0x2c>
+    1738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    173f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1740:	8b 08                	mov    (%eax),%ecx
+    1742:	89 0a                	mov    %ecx,(%edx)
+    1744:	eb b9                	jmp    16ff <malloc+0x9f>
+    1746:	66 90                	xchg   %ax,%ax
+    1748:	66 90                	xchg   %ax,%ax
+    174a:	66 90                	xchg   %ax,%ax
+    174c:	66 90                	xchg   %ax,%ax
+    174e:	66 90                	xchg   %ax,%ax
+
+00001750 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+    1750:	55                   	push   %ebp
+    1751:	89 e5                	mov    %esp,%ebp
+    1753:	57                   	push   %edi
+    1754:	56                   	push   %esi
+    1755:	53                   	push   %ebx
+    1756:	83 ec 1c             	sub    $0x1c,%esp
+    1759:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+    175c:	85 c9                	test   %ecx,%ecx
+    175e:	7e 51                	jle    17b1 <put+0x61>
+    1760:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+    1762:	8b 40 08             	mov    0x8(%eax),%eax
+    1765:	89 ce                	mov    %ecx,%esi
+    1767:	85 c0                	test   %eax,%eax
+    1769:	7e 55                	jle    17c0 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+    176b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+    176e:	8b 51 0c             	mov    0xc(%ecx),%edx
+    1771:	8b 79 08             	mov    0x8(%ecx),%edi
+    1774:	01 d7                	add    %edx,%edi
+    1776:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+    1779:	74 65                	je     17e0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+    177b:	83 f8 20             	cmp    $0x20,%eax
+    177e:	75 40                	jne    17c0 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+    1780:	83 ec 04             	sub    $0x4,%esp
+    1783:	8d 43 10             	lea    0x10(%ebx),%eax
+    1786:	6a 20                	push   $0x20
+    1788:	50                   	push   %eax
+    1789:	ff 33                	push   (%ebx)
+    178b:	e8 b3 fb ff ff       	call   1343 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+    1790:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+    1793:	31 c0                	xor    %eax,%eax
+    1795:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    179a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+    179d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    17a4:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    17a7:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    17aa:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+    17ae:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    17b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17b4:	5b                   	pop    %ebx
+    17b5:	5e                   	pop    %esi
+    17b6:	5f                   	pop    %edi
+    17b7:	5d                   	pop    %ebp
+    17b8:	c3                   	ret
+    17b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+    17c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+    17c3:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    17c6:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+    17c9:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+    17cd:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+    17d0:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+    17d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17d6:	5b                   	pop    %ebx
+    17d7:	5e                   	pop    %esi
+    17d8:	5f                   	pop    %edi
+    17d9:	5d                   	pop    %ebp
+    17da:	c3                   	ret
+    17db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17df:	90                   	nop
+      last->iov_len += n;
+    17e0:	01 f2                	add    %esi,%edx
+    17e2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+    17e5:	eb ca                	jmp    17b1 <put+0x61>
+    17e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ee:	66 90                	xchg   %ax,%ax
+
+000017f0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+    17f0:	55                   	push   %ebp
+    17f1:	89 e5                	mov    %esp,%ebp
+    17f3:	57                   	push   %edi
+    17f4:	89 d7                	mov    %edx,%edi
+    17f6:	56                   	push   %esi
+    17f7:	89 ce                	mov    %ecx,%esi
+    17f9:	53                   	push   %ebx
+    17fa:	89 c3                	mov    %eax,%ebx
+    17fc:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+    17ff:	8b 40 0c             	mov    0xc(%eax),%eax
+    1802:	8b 53 08             	mov    0x8(%ebx),%edx
+    1805:	01 c1                	add    %eax,%ecx
+    1807:	83 f9 40             	cmp    $0x40,%ecx
+    180a:	7f 3c                	jg     1848 <putcopy+0x58>
+    180c:	83 fa 20             	cmp    $0x20,%edx
+    180f:	74 3f                	je     1850 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+    1811:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+    1817:	83 ec 04             	sub    $0x4,%esp
+    181a:	01 d0                	add    %edx,%eax
+    181c:	56                   	push   %esi
+    181d:	57                   	push   %edi
+    181e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    1821:	50                   	push   %eax
+    1822:	e8 19 fa ff ff       	call   1240 <memmove>
+  put(w, w->buf + w->nbuf, n);
+    1827:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    182a:	89 f1                	mov    %esi,%ecx
+    182c:	03 53 0c             	add    0xc(%ebx),%edx
+    182f:	89 d8                	mov    %ebx,%eax
+    1831:	e8 1a ff ff ff       	call   1750 <put>
+  w->nbuf += n;
+    1836:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+    1839:	83 c4 10             	add    $0x10,%esp
+    183c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    183f:	5b                   	pop    %ebx
+    1840:	5e                   	pop    %esi
+    1841:	5f                   	pop    %edi
+    1842:	5d                   	pop    %ebp
+    1843:	c3                   	ret
+    1844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+    1848:	85 d2                	test   %edx,%edx
+    184a:	7e 16                	jle    1862 <putcopy+0x72>
+    184c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+    1850:	83 ec 04             	sub    $0x4,%esp
+    1853:	8d 43 10             	lea    0x10(%ebx),%eax
+    1856:	52                   	push   %edx
+    1857:	50                   	push   %eax
+    1858:	ff 33                	push   (%ebx)
+    185a:	e8 e4 fa ff ff       	call   1343 <writev>
+    185f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+    1862:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+    1869:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+    186b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+    1872:	eb 9d                	jmp    1811 <putcopy+0x21>
+    1874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    187b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    187f:	90                   	nop
+
+00001880 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+    1886:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+    1889:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+    1890:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+    1892:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+    1899:	c7 40 10 05 22 00 00 	movl   $0x2205,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+    18a0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+    18a7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+    18ae:	5d                   	pop    %ebp
+    18af:	c3                   	ret
+
+000018b0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	57                   	push   %edi
+    18b4:	56                   	push   %esi
+    18b5:	53                   	push   %ebx
+    18b6:	83 ec 1c             	sub    $0x1c,%esp
+    18b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+    18bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    18bf:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+    18c2:	8b 47 04             	mov    0x4(%edi),%eax
+    18c5:	85 c0                	test   %eax,%eax
+    18c7:	0f 85 7b 01 00 00    	jne    1a48 <struct_field_str+0x198>
+    w->need_comma = 1;
+    18cd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    18d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+    18d9:	ba 1a 22 00 00       	mov    $0x221a,%edx
+    18de:	89 f8                	mov    %edi,%eax
+    18e0:	e8 6b fe ff ff       	call   1750 <put>
+  put_str(w, key ? key : "");
+    18e5:	85 db                	test   %ebx,%ebx
+    18e7:	b8 df 1e 00 00       	mov    $0x1edf,%eax
+    18ec:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    18ef:	83 ec 0c             	sub    $0xc,%esp
+    18f2:	53                   	push   %ebx
+    18f3:	e8 c8 f7 ff ff       	call   10c0 <strlen>
+    18f8:	89 da                	mov    %ebx,%edx
+    18fa:	89 c1                	mov    %eax,%ecx
+    18fc:	89 f8                	mov    %edi,%eax
+    18fe:	e8 4d fe ff ff       	call   1750 <put>
+  put(w, "\":\"", 3);
+    1903:	b9 03 00 00 00       	mov    $0x3,%ecx
+    1908:	ba 18 22 00 00       	mov    $0x2218,%edx
+    190d:	89 f8                	mov    %edi,%eax
+    190f:	e8 3c fe ff ff       	call   1750 <put>
+  put_escaped(w, value ? value : "");
+    1914:	83 c4 10             	add    $0x10,%esp
+    1917:	85 f6                	test   %esi,%esi
+    1919:	0f 84 41 01 00 00    	je     1a60 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+    191f:	0f b6 1e             	movzbl (%esi),%ebx
+    1922:	89 f2                	mov    %esi,%edx
+    1924:	84 db                	test   %bl,%bl
+    1926:	0f 84 40 01 00 00    	je     1a6c <struct_field_str+0x1bc>
+    192c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    1930:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+    1932:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+    1935:	80 fb 0d             	cmp    $0xd,%bl
+    1938:	74 7e                	je     19b8 <struct_field_str+0x108>
+    193a:	7f 5c                	jg     1998 <struct_field_str+0xe8>
+    193c:	80 fb 09             	cmp    $0x9,%bl
+    193f:	0f 84 eb 00 00 00    	je     1a30 <struct_field_str+0x180>
+    1945:	80 fb 0a             	cmp    $0xa,%bl
+    1948:	0f 85 95 00 00 00    	jne    19e3 <struct_field_str+0x133>
+    put(w, run, s - run);
+    194e:	29 d1                	sub    %edx,%ecx
+    1950:	89 f8                	mov    %edi,%eax
+    1952:	e8 f9 fd ff ff       	call   1750 <put>
+      esc = "\\n";
+    1957:	ba 13 22 00 00       	mov    $0x2213,%edx
+      put(w, esc, 2);
+    195c:	b9 02 00 00 00       	mov    $0x2,%ecx
+    1961:	89 f8                	mov    %edi,%eax
+    1963:	e8 e8 fd ff ff       	call   1750 <put>
+    run = s + 1;
+    1968:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+    196a:	0f b6 1e             	movzbl (%esi),%ebx
+    196d:	84 db                	test   %bl,%bl
+    196f:	75 bf                	jne    1930 <struct_field_str+0x80>
+  put(w, run, s - run);
+    1971:	29 d6                	sub    %edx,%esi
+    1973:	89 f1                	mov    %esi,%ecx
+    1975:	89 f8                	mov    %edi,%eax
+    1977:	e8 d4 fd ff ff       	call   1750 <put>
+  put(w, "\"", 1);
+}
+    197c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+    197f:	89 f8                	mov    %edi,%eax
+    1981:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+    1986:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+    1987:	ba 1a 22 00 00       	mov    $0x221a,%edx
+}
+    198c:	5e                   	pop    %esi
+    198d:	5f                   	pop    %edi
+    198e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+    198f:	e9 bc fd ff ff       	jmp    1750 <put>
+    1994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+    1998:	80 fb 22             	cmp    $0x22,%bl
+    199b:	74 33                	je     19d0 <struct_field_str+0x120>
+    199d:	80 fb 5c             	cmp    $0x5c,%bl
+    19a0:	75 41                	jne    19e3 <struct_field_str+0x133>
+    put(w, run, s - run);
+    19a2:	29 d1                	sub    %edx,%ecx
+    19a4:	89 f8                	mov    %edi,%eax
+    19a6:	e8 a5 fd ff ff       	call   1750 <put>
+      esc = "\\\\";
+    19ab:	ba 07 22 00 00       	mov    $0x2207,%edx
+    19b0:	eb aa                	jmp    195c <struct_field_str+0xac>
+    19b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+    19b8:	29 d1                	sub    %edx,%ecx
+    19ba:	89 f8                	mov    %edi,%eax
+    19bc:	e8 8f fd ff ff       	call   1750 <put>
+      esc = "\\r";
+    19c1:	ba 10 22 00 00       	mov    $0x2210,%edx
+    19c6:	eb 94                	jmp    195c <struct_field_str+0xac>
+    19c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19cf:	90                   	nop
+    put(w, run, s - run);
+    19d0:	29 d1                	sub    %edx,%ecx
+    19d2:	89 f8                	mov    %edi,%eax
+    19d4:	e8 77 fd ff ff       	call   1750 <put>
+      esc = "\\\"";
+    19d9:	ba 0a 22 00 00       	mov    $0x220a,%edx
+    19de:	e9 79 ff ff ff       	jmp    195c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+    19e3:	80 fb 1f             	cmp    $0x1f,%bl
+    19e6:	77 82                	ja     196a <struct_field_str+0xba>
+    put(w, run, s - run);
+    19e8:	29 d1                	sub    %edx,%ecx
+    19ea:	89 f8                	mov    %edi,%eax
+    19ec:	e8 5f fd ff ff       	call   1750 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+    19f1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+    19f3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+    19f6:	0f b7 05 34 22 00 00 	movzwl 0x2234,%eax
+    19fd:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+    1a00:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+    1a05:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+    1a0c:	0f b6 d2             	movzbl %dl,%edx
+    1a0f:	8a 82 1c 22 00 00    	mov    0x221c(%edx),%al
+    1a15:	8a a3 1c 22 00 00    	mov    0x221c(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+    1a1b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+    1a1e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+    1a22:	89 f8                	mov    %edi,%eax
+    1a24:	e8 c7 fd ff ff       	call   17f0 <putcopy>
+    1a29:	e9 3a ff ff ff       	jmp    1968 <struct_field_str+0xb8>
+    1a2e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+    1a30:	29 d1                	sub    %edx,%ecx
+    1a32:	89 f8                	mov    %edi,%eax
+    1a34:	e8 17 fd ff ff       	call   1750 <put>
+      esc = "\\t";
+    1a39:	ba 0d 22 00 00       	mov    $0x220d,%edx
+    1a3e:	e9 19 ff ff ff       	jmp    195c <struct_field_str+0xac>
+    1a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a47:	90                   	nop
+    put(w, ",", 1);
+    1a48:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1a4d:	ba 16 22 00 00       	mov    $0x2216,%edx
+    1a52:	89 f8                	mov    %edi,%eax
+    1a54:	e8 f7 fc ff ff       	call   1750 <put>
+}
+    1a59:	e9 76 fe ff ff       	jmp    18d4 <struct_field_str+0x24>
+    1a5e:	66 90                	xchg   %ax,%ax
+    1a60:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+    1a62:	ba df 1e 00 00       	mov    $0x1edf,%edx
+    1a67:	e9 09 ff ff ff       	jmp    1975 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+    1a6c:	31 c9                	xor    %ecx,%ecx
+    1a6e:	e9 02 ff ff ff       	jmp    1975 <struct_field_str+0xc5>
+    1a73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001a80 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+    1a80:	55                   	push   %ebp
+    1a81:	89 e5                	mov    %esp,%ebp
+    1a83:	57                   	push   %edi
+    1a84:	56                   	push   %esi
+    1a85:	53                   	push   %ebx
+    1a86:	83 ec 1c             	sub    $0x1c,%esp
+    1a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1a8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+    1a8f:	8b 57 04             	mov    0x4(%edi),%edx
+    1a92:	85 d2                	test   %edx,%edx
+    1a94:	0f 85 b6 00 00 00    	jne    1b50 <struct_field_int+0xd0>
+    w->need_comma = 1;
+    1a9a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+    1aa1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1aa6:	ba 1a 22 00 00       	mov    $0x221a,%edx
+    1aab:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+    1aad:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+    1ab2:	e8 99 fc ff ff       	call   1750 <put>
+  put_str(w, key ? key : "");
+    1ab7:	85 db                	test   %ebx,%ebx
+    1ab9:	b8 df 1e 00 00       	mov    $0x1edf,%eax
+    1abe:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+    1ac1:	83 ec 0c             	sub    $0xc,%esp
+    1ac4:	53                   	push   %ebx
+    1ac5:	e8 f6 f5 ff ff       	call   10c0 <strlen>
+    1aca:	89 da                	mov    %ebx,%edx
+    1acc:	89 c1                	mov    %eax,%ecx
+    1ace:	89 f8                	mov    %edi,%eax
+    1ad0:	e8 7b fc ff ff       	call   1750 <put>
+  put(w, "\":", 2);
+    1ad5:	b9 02 00 00 00       	mov    $0x2,%ecx
+    1ada:	ba 2d 22 00 00       	mov    $0x222d,%edx
+    1adf:	89 f8                	mov    %edi,%eax
+    1ae1:	e8 6a fc ff ff       	call   1750 <put>
+  x = value < 0 ? -(uint)value : value;
+    1ae6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+    1ae9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+    1aec:	83 c4 10             	add    $0x10,%esp
+    1aef:	f7 d9                	neg    %ecx
+    1af1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+    1af5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+    1af8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    1afd:	89 f3                	mov    %esi,%ebx
+    1aff:	83 ee 01             	sub    $0x1,%esi
+    1b02:	f7 e1                	mul    %ecx
+    1b04:	89 c8                	mov    %ecx,%eax
+    1b06:	c1 ea 03             	shr    $0x3,%edx
+    1b09:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+    1b0c:	01 ff                	add    %edi,%edi
+    1b0e:	29 f8                	sub    %edi,%eax
+    1b10:	83 c0 30             	add    $0x30,%eax
+    1b13:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+    1b17:	89 c8                	mov    %ecx,%eax
+    1b19:	89 d1                	mov    %edx,%ecx
+    1b1b:	83 f8 09             	cmp    $0x9,%eax
+    1b1e:	77 d8                	ja     1af8 <struct_field_int+0x78>
+  if(value < 0)
+    1b20:	8b 45 10             	mov    0x10(%ebp),%eax
+    1b23:	8b 7d 08             	mov    0x8(%ebp),%edi
+    1b26:	85 c0                	test   %eax,%eax
+    1b28:	79 08                	jns    1b32 <struct_field_int+0xb2>
+    buf[--i] = '-';
+    1b2a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+    1b2f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+    1b32:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1b35:	b9 0c 00 00 00       	mov    $0xc,%ecx
+    1b3a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+    1b3d:	29 f1                	sub    %esi,%ecx
+    1b3f:	89 f8                	mov    %edi,%eax
+    1b41:	e8 aa fc ff ff       	call   17f0 <putcopy>
+  put_int(w, value);
+}
+    1b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b49:	5b                   	pop    %ebx
+    1b4a:	5e                   	pop    %esi
+    1b4b:	5f                   	pop    %edi
+    1b4c:	5d                   	pop    %ebp
+    1b4d:	c3                   	ret
+    1b4e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+    1b50:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1b55:	ba 16 22 00 00       	mov    $0x2216,%edx
+    1b5a:	89 f8                	mov    %edi,%eax
+    1b5c:	e8 ef fb ff ff       	call   1750 <put>
+}
+    1b61:	e9 3b ff ff ff       	jmp    1aa1 <struct_field_int+0x21>
+    1b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001b70 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+    1b70:	55                   	push   %ebp
+    1b71:	89 e5                	mov    %esp,%ebp
+    1b73:	56                   	push   %esi
+    1b74:	53                   	push   %ebx
+    1b75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+    1b78:	8b 43 08             	mov    0x8(%ebx),%eax
+    1b7b:	85 c0                	test   %eax,%eax
+    1b7d:	7e 59                	jle    1bd8 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+    1b7f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+    1b82:	8b 4a 0c             	mov    0xc(%edx),%ecx
+    1b85:	8b 72 08             	mov    0x8(%edx),%esi
+    1b88:	01 ce                	add    %ecx,%esi
+    1b8a:	81 fe 30 22 00 00    	cmp    $0x2230,%esi
+    1b90:	0f 84 aa 00 00 00    	je     1c40 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+    1b96:	83 f8 20             	cmp    $0x20,%eax
+    1b99:	75 75                	jne    1c10 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+    1b9b:	83 ec 04             	sub    $0x4,%esp
+    1b9e:	8d 73 10             	lea    0x10(%ebx),%esi
+    1ba1:	6a 20                	push   $0x20
+    1ba3:	56                   	push   %esi
+    1ba4:	ff 33                	push   (%ebx)
+    1ba6:	e8 98 f7 ff ff       	call   1343 <writev>
+  w->nbuf = 0;
+    1bab:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+    1bb2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+    1bb5:	c7 43 10 30 22 00 00 	movl   $0x2230,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+    1bbc:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+    1bc3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+    1bca:	ba 01 00 00 00       	mov    $0x1,%edx
+    1bcf:	eb 5a                	jmp    1c2b <struct_end+0xbb>
+    1bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+    1bd8:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1bdb:	83 c0 02             	add    $0x2,%eax
+    1bde:	c7 04 c3 30 22 00 00 	movl   $0x2230,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    1be5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    1bec:	00 
+  w->niov++;
+    1bed:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+    1bf0:	83 fa 01             	cmp    $0x1,%edx
+    1bf3:	74 58                	je     1c4d <struct_end+0xdd>
+  w->niov = 0;
+    1bf5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+    1bfc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+    1c03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c06:	5b                   	pop    %ebx
+    1c07:	5e                   	pop    %esi
+    1c08:	5d                   	pop    %ebp
+    1c09:	c3                   	ret
+    1c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+    1c10:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+    1c13:	83 c0 02             	add    $0x2,%eax
+    1c16:	8d 73 10             	lea    0x10(%ebx),%esi
+    1c19:	c7 04 c3 30 22 00 00 	movl   $0x2230,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+    1c20:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+    1c27:	00 
+  w->niov++;
+    1c28:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+    1c2b:	83 ec 04             	sub    $0x4,%esp
+    1c2e:	52                   	push   %edx
+    1c2f:	56                   	push   %esi
+    1c30:	ff 33                	push   (%ebx)
+    1c32:	e8 0c f7 ff ff       	call   1343 <writev>
+    1c37:	83 c4 10             	add    $0x10,%esp
+    1c3a:	eb b9                	jmp    1bf5 <struct_end+0x85>
+    1c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+    1c40:	83 c1 02             	add    $0x2,%ecx
+    1c43:	8d 73 10             	lea    0x10(%ebx),%esi
+    1c46:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+    1c49:	89 c2                	mov    %eax,%edx
+    1c4b:	eb de                	jmp    1c2b <struct_end+0xbb>
+    1c4d:	8d 73 10             	lea    0x10(%ebx),%esi
+    1c50:	e9 75 ff ff ff       	jmp    1bca <struct_end+0x5a>
+    1c55:	66 90                	xchg   %ax,%ax
+    1c57:	66 90                	xchg   %ax,%ax
+    1c59:	66 90                	xchg   %ax,%ax
+    1c5b:	66 90                	xchg   %ax,%ax
+    1c5d:	66 90                	xchg   %ax,%ax
+    1c5f:	90                   	nop
+
+00001c60 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+    1c60:	55                   	push   %ebp
+    1c61:	89 e5                	mov    %esp,%ebp
+    1c63:	56                   	push   %esi
+    1c64:	89 c6                	mov    %eax,%esi
+    1c66:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+    1c67:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+    1c6d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+    1c73:	6a 01                	push   $0x1
+    1c75:	53                   	push   %ebx
+    1c76:	e8 05 fc ff ff       	call   1880 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    1c7b:	83 c4 0c             	add    $0xc,%esp
+    1c7e:	56                   	push   %esi
+    1c7f:	68 36 22 00 00       	push   $0x2236
+    1c84:	53                   	push   %ebx
+    1c85:	e8 26 fc ff ff       	call   18b0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+    1c8a:	83 c4 0c             	add    $0xc,%esp
+    1c8d:	68 3e 22 00 00       	push   $0x223e
+    1c92:	68 4f 22 00 00       	push   $0x224f
+    1c97:	53                   	push   %ebx
+    1c98:	e8 13 fc ff ff       	call   18b0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+    1c9d:	83 c4 0c             	add    $0xc,%esp
+    1ca0:	68 ea 07 00 00       	push   $0x7ea
+    1ca5:	68 56 22 00 00       	push   $0x2256
+    1caa:	53                   	push   %ebx
+    1cab:	e8 d0 fd ff ff       	call   1a80 <struct_field_int>
+  struct_end(&w);
+    1cb0:	89 1c 24             	mov    %ebx,(%esp)
+    1cb3:	e8 b8 fe ff ff       	call   1b70 <struct_end>
+    1cb8:	83 c4 10             	add    $0x10,%esp
+}
+    1cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1cbe:	5b                   	pop    %ebx
+    1cbf:	5e                   	pop    %esi
+    1cc0:	5d                   	pop    %ebp
+    1cc1:	c3                   	ret
+    1cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001cd0 <modern_consume_flags>:
+{
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 0c             	sub    $0xc,%esp
+    1cd9:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+    1cdc:	85 f6                	test   %esi,%esi
+    1cde:	74 06                	je     1ce6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+    1ce0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+    1ce6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+    1cea:	bf 01 00 00 00       	mov    $0x1,%edi
+    1cef:	7e 4c                	jle    1d3d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+    1cf1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+    1cf4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+    1cf7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+    1cfa:	68 5b 22 00 00       	push   $0x225b
+    1cff:	53                   	push   %ebx
+    1d00:	e8 5b f3 ff ff       	call   1060 <strcmp>
+    1d05:	83 c4 10             	add    $0x10,%esp
+    1d08:	85 c0                	test   %eax,%eax
+    1d0a:	74 58                	je     1d64 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+    1d0c:	8b 45 14             	mov    0x14(%ebp),%eax
+    1d0f:	85 c0                	test   %eax,%eax
+    1d11:	74 2a                	je     1d3d <modern_consume_flags+0x6d>
+    1d13:	83 ec 08             	sub    $0x8,%esp
+    1d16:	68 73 22 00 00       	push   $0x2273
+    1d1b:	53                   	push   %ebx
+    1d1c:	e8 3f f3 ff ff       	call   1060 <strcmp>
+    1d21:	83 c4 10             	add    $0x10,%esp
+    1d24:	85 c0                	test   %eax,%eax
+    1d26:	74 28                	je     1d50 <modern_consume_flags+0x80>
+    1d28:	83 ec 08             	sub    $0x8,%esp
+    1d2b:	68 76 22 00 00       	push   $0x2276
+    1d30:	53                   	push   %ebx
+    1d31:	e8 2a f3 ff ff       	call   1060 <strcmp>
+    1d36:	83 c4 10             	add    $0x10,%esp
+    1d39:	85 c0                	test   %eax,%eax
+    1d3b:	74 13                	je     1d50 <modern_consume_flags+0x80>
+}
+    1d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d40:	89 f8                	mov    %edi,%eax
+    1d42:	5b                   	pop    %ebx
+    1d43:	5e                   	pop    %esi
+    1d44:	5f                   	pop    %edi
+    1d45:	5d                   	pop    %ebp
+    1d46:	c3                   	ret
+    1d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d4e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+    1d50:	85 f6                	test   %esi,%esi
+    1d52:	74 06                	je     1d5a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+    1d54:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+    1d5a:	83 c7 01             	add    $0x1,%edi
+    1d5d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+    1d60:	75 8f                	jne    1cf1 <modern_consume_flags+0x21>
+    1d62:	eb d9                	jmp    1d3d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+    1d64:	85 f6                	test   %esi,%esi
+    1d66:	74 12                	je     1d7a <modern_consume_flags+0xaa>
+  if(!json_mode){
+    1d68:	83 3e 00             	cmpl   $0x0,(%esi)
+    1d6b:	74 0d                	je     1d7a <modern_consume_flags+0xaa>
+    1d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d70:	e8 eb fe ff ff       	call   1c60 <modern_print_version.part.0>
+      exit();
+    1d75:	e8 f9 f4 ff ff       	call   1273 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    1d7a:	83 ec 0c             	sub    $0xc,%esp
+    1d7d:	68 ea 07 00 00       	push   $0x7ea
+    1d82:	68 3e 22 00 00       	push   $0x223e
+    1d87:	ff 75 08             	push   0x8(%ebp)
+    1d8a:	68 65 22 00 00       	push   $0x2265
+    1d8f:	6a 01                	push   $0x1
+    1d91:	e8 8a f6 ff ff       	call   1420 <printf>
+}
+    1d96:	83 c4 20             	add    $0x20,%esp
+    1d99:	eb da                	jmp    1d75 <modern_consume_flags+0xa5>
+    1d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d9f:	90                   	nop
+
+00001da0 <modern_print_version>:
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+    1da6:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+    1da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+    1dac:	85 d2                	test   %edx,%edx
+    1dae:	74 10                	je     1dc0 <modern_print_version+0x20>
+}
+    1db0:	c9                   	leave
+    1db1:	e9 aa fe ff ff       	jmp    1c60 <modern_print_version.part.0>
+    1db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+    1dc0:	83 ec 0c             	sub    $0xc,%esp
+    1dc3:	68 ea 07 00 00       	push   $0x7ea
+    1dc8:	68 3e 22 00 00       	push   $0x223e
+    1dcd:	50                   	push   %eax
+    1dce:	68 65 22 00 00       	push   $0x2265
+    1dd3:	6a 01                	push   $0x1
+    1dd5:	e8 46 f6 ff ff       	call   1420 <printf>
+}
+    1dda:	83 c4 20             	add    $0x20,%esp
+}
+    1ddd:	c9                   	leave
+    1dde:	c3                   	ret
+    1ddf:	90                   	nop
+
+00001de0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+    1de0:	55                   	push   %ebp
+    1de1:	89 e5                	mov    %esp,%ebp
+    1de3:	57                   	push   %edi
+    1de4:	56                   	push   %esi
+    1de5:	53                   	push   %ebx
+    1de6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+    1dec:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+    1def:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    1df2:	8b 45 10             	mov    0x10(%ebp),%eax
+    1df5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+    1df8:	85 d2                	test   %edx,%edx
+    1dfa:	75 44                	jne    1e40 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+    1dfc:	85 f6                	test   %esi,%esi
+    1dfe:	ba 7d 22 00 00       	mov    $0x227d,%edx
+    1e03:	0f 44 f2             	cmove  %edx,%esi
+    1e06:	85 c0                	test   %eax,%eax
+    1e08:	ba df 1e 00 00       	mov    $0x1edf,%edx
+    1e0d:	0f 44 c2             	cmove  %edx,%eax
+    1e10:	85 db                	test   %ebx,%ebx
+    1e12:	ba 82 22 00 00       	mov    $0x2282,%edx
+    1e17:	0f 44 da             	cmove  %edx,%ebx
+    1e1a:	83 ec 08             	sub    $0x8,%esp
+    1e1d:	56                   	push   %esi
+    1e1e:	50                   	push   %eax
+    1e1f:	53                   	push   %ebx
+    1e20:	ff 75 08             	push   0x8(%ebp)
+    1e23:	68 88 22 00 00       	push   $0x2288
+    1e28:	6a 01                	push   $0x1
+    1e2a:	e8 f1 f5 ff ff       	call   1420 <printf>
+    1e2f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+    1e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e35:	5b                   	pop    %ebx
+    1e36:	5e                   	pop    %esi
+    1e37:	5f                   	pop    %edi
+    1e38:	5d                   	pop    %ebp
+    1e39:	c3                   	ret
+    1e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+    1e40:	83 ec 08             	sub    $0x8,%esp
+    1e43:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+    1e49:	89 45 10             	mov    %eax,0x10(%ebp)
+    1e4c:	6a 01                	push   $0x1
+    1e4e:	57                   	push   %edi
+    1e4f:	e8 2c fa ff ff       	call   1880 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+    1e54:	83 c4 0c             	add    $0xc,%esp
+    1e57:	ff 75 08             	push   0x8(%ebp)
+    1e5a:	68 36 22 00 00       	push   $0x2236
+    1e5f:	57                   	push   %edi
+    1e60:	e8 4b fa ff ff       	call   18b0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+    1e65:	83 c4 0c             	add    $0xc,%esp
+    1e68:	ba 82 22 00 00       	mov    $0x2282,%edx
+    1e6d:	85 db                	test   %ebx,%ebx
+    1e6f:	0f 44 da             	cmove  %edx,%ebx
+    1e72:	53                   	push   %ebx
+    1e73:	52                   	push   %edx
+    1e74:	57                   	push   %edi
+    1e75:	e8 36 fa ff ff       	call   18b0 <struct_field_str>
+  if(target)
+    1e7a:	8b 45 10             	mov    0x10(%ebp),%eax
+    1e7d:	83 c4 10             	add    $0x10,%esp
+    1e80:	85 c0                	test   %eax,%eax
+    1e82:	74 12                	je     1e96 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+    1e84:	83 ec 04             	sub    $0x4,%esp
+    1e87:	50                   	push   %eax
+    1e88:	68 96 22 00 00       	push   $0x2296
+    1e8d:	57                   	push   %edi
+    1e8e:	e8 1d fa ff ff       	call   18b0 <struct_field_str>
+    1e93:	83 c4 10             	add    $0x10,%esp
+  if(status)
+    1e96:	85 f6                	test   %esi,%esi
+    1e98:	74 12                	je     1eac <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+    1e9a:	83 ec 04             	sub    $0x4,%esp
+    1e9d:	56                   	push   %esi
+    1e9e:	68 9d 22 00 00       	push   $0x229d
+    1ea3:	57                   	push   %edi
+    1ea4:	e8 07 fa ff ff       	call   18b0 <struct_field_str>
+    1ea9:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+    1eac:	83 ec 0c             	sub    $0xc,%esp
+    1eaf:	57                   	push   %edi
+    1eb0:	e8 bb fc ff ff       	call   1b70 <struct_end>
+    1eb5:	83 c4 10             	add    $0x10,%esp
+}
+    1eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ebb:	5b                   	pop    %ebx
+    1ebc:	5e                   	pop    %esi
+    1ebd:	5f                   	pop    %edi
+    1ebe:	5d                   	pop    %ebp
+    1ebf:	c3                   	ret
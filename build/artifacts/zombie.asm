@@ -0,0 +1,2078 @@
+
+build/bin/user/_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 55 02 00 00       	call   26b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 df 02 00 00       	call   303 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 47 02 00 00       	call   273 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 1e 01 00 00       	call   28b <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 f1 00 00 00       	call   2b3 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 f4 00 00 00       	call   2cb <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 ba 00 00 00       	call   29b <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+
+0000026b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 26b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 270:	cd 40                	int    $0x40
+ 272:	c3                   	ret
+
+00000273 <exit>:
+SYSCALL(exit)
+ 273:	b8 02 00 00 00       	mov    $0x2,%eax
+ 278:	cd 40                	int    $0x40
+ 27a:	c3                   	ret
+
+0000027b <wait>:
+SYSCALL(wait)
+ 27b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <pipe>:
+SYSCALL(pipe)
+ 283:	b8 04 00 00 00       	mov    $0x4,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <read>:
+SYSCALL(read)
+ 28b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <write>:
+SYSCALL(write)
+ 293:	b8 10 00 00 00       	mov    $0x10,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <close>:
+SYSCALL(close)
+ 29b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <kill>:
+SYSCALL(kill)
+ 2a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <exec>:
+SYSCALL(exec)
+ 2ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <open>:
+SYSCALL(open)
+ 2b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <mknod>:
+SYSCALL(mknod)
+ 2bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <unlink>:
+SYSCALL(unlink)
+ 2c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <fstat>:
+SYSCALL(fstat)
+ 2cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <link>:
+SYSCALL(link)
+ 2d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <mkdir>:
+SYSCALL(mkdir)
+ 2db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <chdir>:
+SYSCALL(chdir)
+ 2e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <dup>:
+SYSCALL(dup)
+ 2eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <getpid>:
+SYSCALL(getpid)
+ 2f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <sbrk>:
+SYSCALL(sbrk)
+ 2fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <sleep>:
+SYSCALL(sleep)
+ 303:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <uptime>:
+SYSCALL(uptime)
+ 30b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <poll>:
+SYSCALL(poll)
+ 313:	b8 16 00 00 00       	mov    $0x16,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fcntl>:
+SYSCALL(fcntl)
+ 31b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <lseek>:
+SYSCALL(lseek)
+ 323:	b8 18 00 00 00       	mov    $0x18,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <pread>:
+SYSCALL(pread)
+ 32b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <pwrite>:
+SYSCALL(pwrite)
+ 333:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <readv>:
+SYSCALL(readv)
+ 33b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <writev>:
+SYSCALL(writev)
+ 343:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <getdents>:
+SYSCALL(getdents)
+ 34b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <splice>:
+SYSCALL(splice)
+ 353:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <ioring_setup>:
+SYSCALL(ioring_setup)
+ 35b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <ioring_enter>:
+SYSCALL(ioring_enter)
+ 363:	b8 20 00 00 00       	mov    $0x20,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <batch>:
+SYSCALL(batch)
+ 36b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+ 373:	66 90                	xchg   %ax,%ax
+ 375:	66 90                	xchg   %ax,%ax
+ 377:	66 90                	xchg   %ax,%ax
+ 379:	66 90                	xchg   %ax,%ax
+ 37b:	66 90                	xchg   %ax,%ax
+ 37d:	66 90                	xchg   %ax,%ax
+ 37f:	90                   	nop
+
+00000380 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	53                   	push   %ebx
+ 386:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 388:	89 d1                	mov    %edx,%ecx
+{
+ 38a:	83 ec 3c             	sub    $0x3c,%esp
+ 38d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 390:	85 d2                	test   %edx,%edx
+ 392:	0f 89 80 00 00 00    	jns    418 <printint+0x98>
+ 398:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 39c:	74 7a                	je     418 <printint+0x98>
+    x = -xx;
+ 39e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3a8:	31 f6                	xor    %esi,%esi
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 3b0:	89 c8                	mov    %ecx,%eax
+ 3b2:	31 d2                	xor    %edx,%edx
+ 3b4:	89 f7                	mov    %esi,%edi
+ 3b6:	f7 f3                	div    %ebx
+ 3b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 3bb:	0f b6 92 20 0f 00 00 	movzbl 0xf20(%edx),%edx
+ 3c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 3c6:	89 ca                	mov    %ecx,%edx
+ 3c8:	89 c1                	mov    %eax,%ecx
+ 3ca:	39 da                	cmp    %ebx,%edx
+ 3cc:	73 e2                	jae    3b0 <printint+0x30>
+  if(neg)
+ 3ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 3d1:	85 c0                	test   %eax,%eax
+ 3d3:	74 07                	je     3dc <printint+0x5c>
+    buf[i++] = '-';
+ 3d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 3da:	89 f7                	mov    %esi,%edi
+ 3dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 3df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 3e2:	01 df                	add    %ebx,%edi
+ 3e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 3e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 3eb:	83 ec 04             	sub    $0x4,%esp
+ 3ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 3f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 3f4:	6a 01                	push   $0x1
+ 3f6:	50                   	push   %eax
+ 3f7:	56                   	push   %esi
+ 3f8:	e8 96 fe ff ff       	call   293 <write>
+  while(--i >= 0)
+ 3fd:	89 f8                	mov    %edi,%eax
+ 3ff:	83 c4 10             	add    $0x10,%esp
+ 402:	83 ef 01             	sub    $0x1,%edi
+ 405:	39 d8                	cmp    %ebx,%eax
+ 407:	75 df                	jne    3e8 <printint+0x68>
+}
+ 409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40c:	5b                   	pop    %ebx
+ 40d:	5e                   	pop    %esi
+ 40e:	5f                   	pop    %edi
+ 40f:	5d                   	pop    %ebp
+ 410:	c3                   	ret
+ 411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 418:	31 c0                	xor    %eax,%eax
+ 41a:	eb 89                	jmp    3a5 <printint+0x25>
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	56                   	push   %esi
+ 425:	53                   	push   %ebx
+ 426:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 429:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 42c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 42f:	0f b6 1e             	movzbl (%esi),%ebx
+ 432:	83 c6 01             	add    $0x1,%esi
+ 435:	84 db                	test   %bl,%bl
+ 437:	74 67                	je     4a0 <printf+0x80>
+ 439:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 43c:	31 d2                	xor    %edx,%edx
+ 43e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 441:	eb 34                	jmp    477 <printf+0x57>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 44b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 450:	83 f8 25             	cmp    $0x25,%eax
+ 453:	74 18                	je     46d <printf+0x4d>
+  write(fd, &c, 1);
+ 455:	83 ec 04             	sub    $0x4,%esp
+ 458:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 45b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 45e:	6a 01                	push   $0x1
+ 460:	50                   	push   %eax
+ 461:	57                   	push   %edi
+ 462:	e8 2c fe ff ff       	call   293 <write>
+ 467:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 46a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 46d:	0f b6 1e             	movzbl (%esi),%ebx
+ 470:	83 c6 01             	add    $0x1,%esi
+ 473:	84 db                	test   %bl,%bl
+ 475:	74 29                	je     4a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 477:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 47a:	85 d2                	test   %edx,%edx
+ 47c:	74 ca                	je     448 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 47e:	83 fa 25             	cmp    $0x25,%edx
+ 481:	75 ea                	jne    46d <printf+0x4d>
+      if(c == 'd'){
+ 483:	83 f8 25             	cmp    $0x25,%eax
+ 486:	0f 84 24 01 00 00    	je     5b0 <printf+0x190>
+ 48c:	83 e8 63             	sub    $0x63,%eax
+ 48f:	83 f8 15             	cmp    $0x15,%eax
+ 492:	77 1c                	ja     4b0 <printf+0x90>
+ 494:	ff 24 85 c8 0e 00 00 	jmp    *0xec8(,%eax,4)
+ 49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 49f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4a3:	5b                   	pop    %ebx
+ 4a4:	5e                   	pop    %esi
+ 4a5:	5f                   	pop    %edi
+ 4a6:	5d                   	pop    %ebp
+ 4a7:	c3                   	ret
+ 4a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+  write(fd, &c, 1);
+ 4b0:	83 ec 04             	sub    $0x4,%esp
+ 4b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 4b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 4ba:	6a 01                	push   $0x1
+ 4bc:	52                   	push   %edx
+ 4bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 4c0:	57                   	push   %edi
+ 4c1:	e8 cd fd ff ff       	call   293 <write>
+ 4c6:	83 c4 0c             	add    $0xc,%esp
+ 4c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4cc:	6a 01                	push   $0x1
+ 4ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 4d1:	52                   	push   %edx
+ 4d2:	57                   	push   %edi
+ 4d3:	e8 bb fd ff ff       	call   293 <write>
+        putc(fd, c);
+ 4d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4db:	31 d2                	xor    %edx,%edx
+ 4dd:	eb 8e                	jmp    46d <printf+0x4d>
+ 4df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 4e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 4e3:	83 ec 0c             	sub    $0xc,%esp
+ 4e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4eb:	8b 13                	mov    (%ebx),%edx
+ 4ed:	6a 00                	push   $0x0
+ 4ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 4f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 4f4:	e8 87 fe ff ff       	call   380 <printint>
+        ap++;
+ 4f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 4fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4ff:	31 d2                	xor    %edx,%edx
+ 501:	e9 67 ff ff ff       	jmp    46d <printf+0x4d>
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 510:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 513:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 515:	83 c0 04             	add    $0x4,%eax
+ 518:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 51b:	85 db                	test   %ebx,%ebx
+ 51d:	0f 84 9d 00 00 00    	je     5c0 <printf+0x1a0>
+        while(*s != 0){
+ 523:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 526:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 528:	84 c0                	test   %al,%al
+ 52a:	0f 84 3d ff ff ff    	je     46d <printf+0x4d>
+ 530:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 533:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 536:	89 de                	mov    %ebx,%esi
+ 538:	89 d3                	mov    %edx,%ebx
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 540:	83 ec 04             	sub    $0x4,%esp
+ 543:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 546:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 549:	6a 01                	push   $0x1
+ 54b:	53                   	push   %ebx
+ 54c:	57                   	push   %edi
+ 54d:	e8 41 fd ff ff       	call   293 <write>
+        while(*s != 0){
+ 552:	0f b6 06             	movzbl (%esi),%eax
+ 555:	83 c4 10             	add    $0x10,%esp
+ 558:	84 c0                	test   %al,%al
+ 55a:	75 e4                	jne    540 <printf+0x120>
+      state = 0;
+ 55c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 55f:	31 d2                	xor    %edx,%edx
+ 561:	e9 07 ff ff ff       	jmp    46d <printf+0x4d>
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 573:	83 ec 0c             	sub    $0xc,%esp
+ 576:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 57b:	8b 13                	mov    (%ebx),%edx
+ 57d:	6a 01                	push   $0x1
+ 57f:	e9 6b ff ff ff       	jmp    4ef <printf+0xcf>
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 588:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 591:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 593:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 596:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 599:	6a 01                	push   $0x1
+ 59b:	52                   	push   %edx
+ 59c:	57                   	push   %edi
+ 59d:	e8 f1 fc ff ff       	call   293 <write>
+        ap++;
+ 5a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5a8:	31 d2                	xor    %edx,%edx
+ 5aa:	e9 be fe ff ff       	jmp    46d <printf+0x4d>
+ 5af:	90                   	nop
+  write(fd, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b9:	6a 01                	push   $0x1
+ 5bb:	e9 11 ff ff ff       	jmp    4d1 <printf+0xb1>
+ 5c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 5c5:	bb c0 0e 00 00       	mov    $0xec0,%ebx
+ 5ca:	e9 61 ff ff ff       	jmp    530 <printf+0x110>
+ 5cf:	90                   	nop
+
+000005d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d1:	a1 38 14 00 00       	mov    0x1438,%eax
+{
+ 5d6:	89 e5                	mov    %esp,%ebp
+ 5d8:	57                   	push   %edi
+ 5d9:	56                   	push   %esi
+ 5da:	53                   	push   %ebx
+ 5db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 5de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5ec:	39 ca                	cmp    %ecx,%edx
+ 5ee:	73 30                	jae    620 <free+0x50>
+ 5f0:	39 c1                	cmp    %eax,%ecx
+ 5f2:	72 04                	jb     5f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5f4:	39 c2                	cmp    %eax,%edx
+ 5f6:	72 f0                	jb     5e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5fe:	39 f8                	cmp    %edi,%eax
+ 600:	74 2e                	je     630 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 602:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 605:	8b 42 04             	mov    0x4(%edx),%eax
+ 608:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 60b:	39 f1                	cmp    %esi,%ecx
+ 60d:	74 38                	je     647 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 60f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 611:	5b                   	pop    %ebx
+  freep = p;
+ 612:	89 15 38 14 00 00    	mov    %edx,0x1438
+}
+ 618:	5e                   	pop    %esi
+ 619:	5f                   	pop    %edi
+ 61a:	5d                   	pop    %ebp
+ 61b:	c3                   	ret
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 620:	39 c1                	cmp    %eax,%ecx
+ 622:	72 d0                	jb     5f4 <free+0x24>
+ 624:	eb c2                	jmp    5e8 <free+0x18>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 630:	03 70 04             	add    0x4(%eax),%esi
+ 633:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 636:	8b 02                	mov    (%edx),%eax
+ 638:	8b 00                	mov    (%eax),%eax
+ 63a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 63d:	8b 42 04             	mov    0x4(%edx),%eax
+ 640:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 643:	39 f1                	cmp    %esi,%ecx
+ 645:	75 c8                	jne    60f <free+0x3f>
+    p->s.size += bp->s.size;
+ 647:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 64a:	89 15 38 14 00 00    	mov    %edx,0x1438
+    p->s.size += bp->s.size;
+ 650:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 653:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 656:	89 0a                	mov    %ecx,(%edx)
+}
+ 658:	5b                   	pop    %ebx
+ 659:	5e                   	pop    %esi
+ 65a:	5f                   	pop    %edi
+ 65b:	5d                   	pop    %ebp
+ 65c:	c3                   	ret
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000660 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 669:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 66c:	8b 15 38 14 00 00    	mov    0x1438,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 672:	8d 78 07             	lea    0x7(%eax),%edi
+ 675:	c1 ef 03             	shr    $0x3,%edi
+ 678:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 67b:	85 d2                	test   %edx,%edx
+ 67d:	0f 84 8d 00 00 00    	je     710 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 683:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 685:	8b 48 04             	mov    0x4(%eax),%ecx
+ 688:	39 f9                	cmp    %edi,%ecx
+ 68a:	73 64                	jae    6f0 <malloc+0x90>
+  if(nu < 4096)
+ 68c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 691:	39 df                	cmp    %ebx,%edi
+ 693:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 696:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 69d:	eb 0a                	jmp    6a9 <malloc+0x49>
+ 69f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6a5:	39 f9                	cmp    %edi,%ecx
+ 6a7:	73 47                	jae    6f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6a9:	89 c2                	mov    %eax,%edx
+ 6ab:	39 05 38 14 00 00    	cmp    %eax,0x1438
+ 6b1:	75 ed                	jne    6a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	56                   	push   %esi
+ 6b7:	e8 3f fc ff ff       	call   2fb <sbrk>
+  if(p == (char*)-1)
+ 6bc:	83 c4 10             	add    $0x10,%esp
+ 6bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6c2:	74 1c                	je     6e0 <malloc+0x80>
+  hp->s.size = nu;
+ 6c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6c7:	83 ec 0c             	sub    $0xc,%esp
+ 6ca:	83 c0 08             	add    $0x8,%eax
+ 6cd:	50                   	push   %eax
+ 6ce:	e8 fd fe ff ff       	call   5d0 <free>
+  return freep;
+ 6d3:	8b 15 38 14 00 00    	mov    0x1438,%edx
+      if((p = morecore(nunits)) == 0)
+ 6d9:	83 c4 10             	add    $0x10,%esp
+ 6dc:	85 d2                	test   %edx,%edx
+ 6de:	75 c0                	jne    6a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 6e3:	31 c0                	xor    %eax,%eax
+}
+ 6e5:	5b                   	pop    %ebx
+ 6e6:	5e                   	pop    %esi
+ 6e7:	5f                   	pop    %edi
+ 6e8:	5d                   	pop    %ebp
+ 6e9:	c3                   	ret
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 6f0:	39 cf                	cmp    %ecx,%edi
+ 6f2:	74 4c                	je     740 <malloc+0xe0>
+        p->s.size -= nunits;
+ 6f4:	29 f9                	sub    %edi,%ecx
+ 6f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 6ff:	89 15 38 14 00 00    	mov    %edx,0x1438
+}
+ 705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 708:	83 c0 08             	add    $0x8,%eax
+}
+ 70b:	5b                   	pop    %ebx
+ 70c:	5e                   	pop    %esi
+ 70d:	5f                   	pop    %edi
+ 70e:	5d                   	pop    %ebp
+ 70f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 710:	c7 05 38 14 00 00 3c 	movl   $0x143c,0x1438
+ 717:	14 00 00 
+    base.s.size = 0;
+ 71a:	b8 3c 14 00 00       	mov    $0x143c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 71f:	c7 05 3c 14 00 00 3c 	movl   $0x143c,0x143c
+ 726:	14 00 00 
+    base.s.size = 0;
+ 729:	c7 05 40 14 00 00 00 	movl   $0x0,0x1440
+ 730:	00 00 00 
+    if(p->s.size >= nunits){
+ 733:	e9 54 ff ff ff       	jmp    68c <malloc+0x2c>
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 740:	8b 08                	mov    (%eax),%ecx
+ 742:	89 0a                	mov    %ecx,(%edx)
+ 744:	eb b9                	jmp    6ff <malloc+0x9f>
+ 746:	66 90                	xchg   %ax,%ax
+ 748:	66 90                	xchg   %ax,%ax
+ 74a:	66 90                	xchg   %ax,%ax
+ 74c:	66 90                	xchg   %ax,%ax
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <put>:
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 1c             	sub    $0x1c,%esp
+ 759:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  struct iovec *last;
+
+  if(n <= 0)
+ 75c:	85 c9                	test   %ecx,%ecx
+ 75e:	7e 51                	jle    7b1 <put+0x61>
+ 760:	89 c3                	mov    %eax,%ebx
+    return;
+  if(w->niov > 0){
+ 762:	8b 40 08             	mov    0x8(%eax),%eax
+ 765:	89 ce                	mov    %ecx,%esi
+ 767:	85 c0                	test   %eax,%eax
+ 769:	7e 55                	jle    7c0 <put+0x70>
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+ 76b:	8d 0c c3             	lea    (%ebx,%eax,8),%ecx
+ 76e:	8b 51 0c             	mov    0xc(%ecx),%edx
+ 771:	8b 79 08             	mov    0x8(%ecx),%edi
+ 774:	01 d7                	add    %edx,%edi
+ 776:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 779:	74 65                	je     7e0 <put+0x90>
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+ 77b:	83 f8 20             	cmp    $0x20,%eax
+ 77e:	75 40                	jne    7c0 <put+0x70>
+    writev(w->fd, w->iov, w->niov);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	8d 43 10             	lea    0x10(%ebx),%eax
+ 786:	6a 20                	push   $0x20
+ 788:	50                   	push   %eax
+ 789:	ff 33                	push   (%ebx)
+ 78b:	e8 b3 fb ff ff       	call   343 <writev>
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+ 790:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+}
+ 793:	31 c0                	xor    %eax,%eax
+ 795:	ba 01 00 00 00       	mov    $0x1,%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 79a:	83 c0 02             	add    $0x2,%eax
+  w->nbuf = 0;
+ 79d:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 7a4:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ 7a7:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ 7aa:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->niov++;
+ 7ae:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 7b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b4:	5b                   	pop    %ebx
+ 7b5:	5e                   	pop    %esi
+ 7b6:	5f                   	pop    %edi
+ 7b7:	5d                   	pop    %ebp
+ 7b8:	c3                   	ret
+ 7b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->iov[w->niov].iov_base = (void*)s;
+ 7c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  w->niov++;
+ 7c3:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ 7c6:	83 c0 02             	add    $0x2,%eax
+  w->iov[w->niov].iov_len = n;
+ 7c9:	89 74 c3 04          	mov    %esi,0x4(%ebx,%eax,8)
+  w->iov[w->niov].iov_base = (void*)s;
+ 7cd:	89 3c c3             	mov    %edi,(%ebx,%eax,8)
+  w->niov++;
+ 7d0:	89 53 08             	mov    %edx,0x8(%ebx)
+}
+ 7d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d6:	5b                   	pop    %ebx
+ 7d7:	5e                   	pop    %esi
+ 7d8:	5f                   	pop    %edi
+ 7d9:	5d                   	pop    %ebp
+ 7da:	c3                   	ret
+ 7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+      last->iov_len += n;
+ 7e0:	01 f2                	add    %esi,%edx
+ 7e2:	89 51 0c             	mov    %edx,0xc(%ecx)
+      return;
+ 7e5:	eb ca                	jmp    7b1 <put+0x61>
+ 7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ee:	66 90                	xchg   %ax,%ax
+
+000007f0 <putcopy>:
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	89 d7                	mov    %edx,%edi
+ 7f6:	56                   	push   %esi
+ 7f7:	89 ce                	mov    %ecx,%esi
+ 7f9:	53                   	push   %ebx
+ 7fa:	89 c3                	mov    %eax,%ebx
+ 7fc:	83 ec 1c             	sub    $0x1c,%esp
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+ 7ff:	8b 40 0c             	mov    0xc(%eax),%eax
+ 802:	8b 53 08             	mov    0x8(%ebx),%edx
+ 805:	01 c1                	add    %eax,%ecx
+ 807:	83 f9 40             	cmp    $0x40,%ecx
+ 80a:	7f 3c                	jg     848 <putcopy+0x58>
+ 80c:	83 fa 20             	cmp    $0x20,%edx
+ 80f:	74 3f                	je     850 <putcopy+0x60>
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+ 811:	8d 93 10 01 00 00    	lea    0x110(%ebx),%edx
+ 817:	83 ec 04             	sub    $0x4,%esp
+ 81a:	01 d0                	add    %edx,%eax
+ 81c:	56                   	push   %esi
+ 81d:	57                   	push   %edi
+ 81e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 821:	50                   	push   %eax
+ 822:	e8 19 fa ff ff       	call   240 <memmove>
+  put(w, w->buf + w->nbuf, n);
+ 827:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 82a:	89 f1                	mov    %esi,%ecx
+ 82c:	03 53 0c             	add    0xc(%ebx),%edx
+ 82f:	89 d8                	mov    %ebx,%eax
+ 831:	e8 1a ff ff ff       	call   750 <put>
+  w->nbuf += n;
+ 836:	01 73 0c             	add    %esi,0xc(%ebx)
+}
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83f:	5b                   	pop    %ebx
+ 840:	5e                   	pop    %esi
+ 841:	5f                   	pop    %edi
+ 842:	5d                   	pop    %ebp
+ 843:	c3                   	ret
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(w->niov > 0)
+ 848:	85 d2                	test   %edx,%edx
+ 84a:	7e 16                	jle    862 <putcopy+0x72>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    writev(w->fd, w->iov, w->niov);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 43 10             	lea    0x10(%ebx),%eax
+ 856:	52                   	push   %edx
+ 857:	50                   	push   %eax
+ 858:	ff 33                	push   (%ebx)
+ 85a:	e8 e4 fa ff ff       	call   343 <writev>
+ 85f:	83 c4 10             	add    $0x10,%esp
+  w->niov = 0;
+ 862:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+}
+ 869:	31 c0                	xor    %eax,%eax
+  w->nbuf = 0;
+ 86b:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+}
+ 872:	eb 9d                	jmp    811 <putcopy+0x21>
+ 874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+
+00000880 <struct_begin>:
+    w->need_comma = 1;
+}
+
+void
+struct_begin(struct struct_writer *w, int fd)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	8b 45 08             	mov    0x8(%ebp),%eax
+  w->fd = fd;
+ 886:	8b 55 0c             	mov    0xc(%ebp),%edx
+  w->need_comma = 0;
+ 889:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  w->fd = fd;
+ 890:	89 10                	mov    %edx,(%eax)
+  w->niov = 0;
+  w->nbuf = 0;
+ 892:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  w->iov[w->niov].iov_base = (void*)s;
+ 899:	c7 40 10 31 0f 00 00 	movl   $0xf31,0x10(%eax)
+  w->iov[w->niov].iov_len = n;
+ 8a0:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%eax)
+  w->niov++;
+ 8a7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  put(w, "{", 1);
+}
+ 8ae:	5d                   	pop    %ebp
+ 8af:	c3                   	ret
+
+000008b0 <struct_field_str>:
+
+void
+struct_field_str(struct struct_writer *w, const char *key, const char *value)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 1c             	sub    $0x1c,%esp
+ 8b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 8bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 8bf:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(w->need_comma)
+ 8c2:	8b 47 04             	mov    0x4(%edi),%eax
+ 8c5:	85 c0                	test   %eax,%eax
+ 8c7:	0f 85 7b 01 00 00    	jne    a48 <struct_field_str+0x198>
+    w->need_comma = 1;
+ 8cd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ 8d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 8d9:	ba 46 0f 00 00       	mov    $0xf46,%edx
+ 8de:	89 f8                	mov    %edi,%eax
+ 8e0:	e8 6b fe ff ff       	call   750 <put>
+  put_str(w, key ? key : "");
+ 8e5:	85 db                	test   %ebx,%ebx
+ 8e7:	b8 9e 0f 00 00       	mov    $0xf9e,%eax
+ 8ec:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ 8ef:	83 ec 0c             	sub    $0xc,%esp
+ 8f2:	53                   	push   %ebx
+ 8f3:	e8 c8 f7 ff ff       	call   c0 <strlen>
+ 8f8:	89 da                	mov    %ebx,%edx
+ 8fa:	89 c1                	mov    %eax,%ecx
+ 8fc:	89 f8                	mov    %edi,%eax
+ 8fe:	e8 4d fe ff ff       	call   750 <put>
+  put(w, "\":\"", 3);
+ 903:	b9 03 00 00 00       	mov    $0x3,%ecx
+ 908:	ba 44 0f 00 00       	mov    $0xf44,%edx
+ 90d:	89 f8                	mov    %edi,%eax
+ 90f:	e8 3c fe ff ff       	call   750 <put>
+  put_escaped(w, value ? value : "");
+ 914:	83 c4 10             	add    $0x10,%esp
+ 917:	85 f6                	test   %esi,%esi
+ 919:	0f 84 41 01 00 00    	je     a60 <struct_field_str+0x1b0>
+  for(run = s; *s; s++){
+ 91f:	0f b6 1e             	movzbl (%esi),%ebx
+ 922:	89 f2                	mov    %esi,%edx
+ 924:	84 db                	test   %bl,%bl
+ 926:	0f 84 40 01 00 00    	je     a6c <struct_field_str+0x1bc>
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 930:	89 f1                	mov    %esi,%ecx
+    run = s + 1;
+ 932:	83 c6 01             	add    $0x1,%esi
+    switch(c){
+ 935:	80 fb 0d             	cmp    $0xd,%bl
+ 938:	74 7e                	je     9b8 <struct_field_str+0x108>
+ 93a:	7f 5c                	jg     998 <struct_field_str+0xe8>
+ 93c:	80 fb 09             	cmp    $0x9,%bl
+ 93f:	0f 84 eb 00 00 00    	je     a30 <struct_field_str+0x180>
+ 945:	80 fb 0a             	cmp    $0xa,%bl
+ 948:	0f 85 95 00 00 00    	jne    9e3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 94e:	29 d1                	sub    %edx,%ecx
+ 950:	89 f8                	mov    %edi,%eax
+ 952:	e8 f9 fd ff ff       	call   750 <put>
+      esc = "\\n";
+ 957:	ba 3f 0f 00 00       	mov    $0xf3f,%edx
+      put(w, esc, 2);
+ 95c:	b9 02 00 00 00       	mov    $0x2,%ecx
+ 961:	89 f8                	mov    %edi,%eax
+ 963:	e8 e8 fd ff ff       	call   750 <put>
+    run = s + 1;
+ 968:	89 f2                	mov    %esi,%edx
+  for(run = s; *s; s++){
+ 96a:	0f b6 1e             	movzbl (%esi),%ebx
+ 96d:	84 db                	test   %bl,%bl
+ 96f:	75 bf                	jne    930 <struct_field_str+0x80>
+  put(w, run, s - run);
+ 971:	29 d6                	sub    %edx,%esi
+ 973:	89 f1                	mov    %esi,%ecx
+ 975:	89 f8                	mov    %edi,%eax
+ 977:	e8 d4 fd ff ff       	call   750 <put>
+  put(w, "\"", 1);
+}
+ 97c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  put(w, "\"", 1);
+ 97f:	89 f8                	mov    %edi,%eax
+ 981:	b9 01 00 00 00       	mov    $0x1,%ecx
+}
+ 986:	5b                   	pop    %ebx
+  put(w, "\"", 1);
+ 987:	ba 46 0f 00 00       	mov    $0xf46,%edx
+}
+ 98c:	5e                   	pop    %esi
+ 98d:	5f                   	pop    %edi
+ 98e:	5d                   	pop    %ebp
+  put(w, "\"", 1);
+ 98f:	e9 bc fd ff ff       	jmp    750 <put>
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+ 998:	80 fb 22             	cmp    $0x22,%bl
+ 99b:	74 33                	je     9d0 <struct_field_str+0x120>
+ 99d:	80 fb 5c             	cmp    $0x5c,%bl
+ 9a0:	75 41                	jne    9e3 <struct_field_str+0x133>
+    put(w, run, s - run);
+ 9a2:	29 d1                	sub    %edx,%ecx
+ 9a4:	89 f8                	mov    %edi,%eax
+ 9a6:	e8 a5 fd ff ff       	call   750 <put>
+      esc = "\\\\";
+ 9ab:	ba 33 0f 00 00       	mov    $0xf33,%edx
+ 9b0:	eb aa                	jmp    95c <struct_field_str+0xac>
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    put(w, run, s - run);
+ 9b8:	29 d1                	sub    %edx,%ecx
+ 9ba:	89 f8                	mov    %edi,%eax
+ 9bc:	e8 8f fd ff ff       	call   750 <put>
+      esc = "\\r";
+ 9c1:	ba 3c 0f 00 00       	mov    $0xf3c,%edx
+ 9c6:	eb 94                	jmp    95c <struct_field_str+0xac>
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+    put(w, run, s - run);
+ 9d0:	29 d1                	sub    %edx,%ecx
+ 9d2:	89 f8                	mov    %edi,%eax
+ 9d4:	e8 77 fd ff ff       	call   750 <put>
+      esc = "\\\"";
+ 9d9:	ba 36 0f 00 00       	mov    $0xf36,%edx
+ 9de:	e9 79 ff ff ff       	jmp    95c <struct_field_str+0xac>
+      if((uchar)c >= 0x20)
+ 9e3:	80 fb 1f             	cmp    $0x1f,%bl
+ 9e6:	77 82                	ja     96a <struct_field_str+0xba>
+    put(w, run, s - run);
+ 9e8:	29 d1                	sub    %edx,%ecx
+ 9ea:	89 f8                	mov    %edi,%eax
+ 9ec:	e8 5f fd ff ff       	call   750 <put>
+      buf[4] = hex[(c >> 4) & 0xf];
+ 9f1:	89 da                	mov    %ebx,%edx
+      buf[5] = hex[c & 0xf];
+ 9f3:	83 e3 0f             	and    $0xf,%ebx
+      buf[4] = hex[(c >> 4) & 0xf];
+ 9f6:	0f b7 05 60 0f 00 00 	movzwl 0xf60,%eax
+ 9fd:	c0 ea 04             	shr    $0x4,%dl
+      putcopy(w, buf, sizeof(buf));
+ a00:	b9 06 00 00 00       	mov    $0x6,%ecx
+      buf[0] = '\\';
+ a05:	c7 45 e0 5c 75 30 30 	movl   $0x3030755c,-0x20(%ebp)
+      buf[4] = hex[(c >> 4) & 0xf];
+ a0c:	0f b6 d2             	movzbl %dl,%edx
+ a0f:	8a 82 48 0f 00 00    	mov    0xf48(%edx),%al
+ a15:	8a a3 48 0f 00 00    	mov    0xf48(%ebx),%ah
+      putcopy(w, buf, sizeof(buf));
+ a1b:	8d 55 e0             	lea    -0x20(%ebp),%edx
+      buf[4] = hex[(c >> 4) & 0xf];
+ a1e:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+      putcopy(w, buf, sizeof(buf));
+ a22:	89 f8                	mov    %edi,%eax
+ a24:	e8 c7 fd ff ff       	call   7f0 <putcopy>
+ a29:	e9 3a ff ff ff       	jmp    968 <struct_field_str+0xb8>
+ a2e:	66 90                	xchg   %ax,%ax
+    put(w, run, s - run);
+ a30:	29 d1                	sub    %edx,%ecx
+ a32:	89 f8                	mov    %edi,%eax
+ a34:	e8 17 fd ff ff       	call   750 <put>
+      esc = "\\t";
+ a39:	ba 39 0f 00 00       	mov    $0xf39,%edx
+ a3e:	e9 19 ff ff ff       	jmp    95c <struct_field_str+0xac>
+ a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a47:	90                   	nop
+    put(w, ",", 1);
+ a48:	b9 01 00 00 00       	mov    $0x1,%ecx
+ a4d:	ba 42 0f 00 00       	mov    $0xf42,%edx
+ a52:	89 f8                	mov    %edi,%eax
+ a54:	e8 f7 fc ff ff       	call   750 <put>
+}
+ a59:	e9 76 fe ff ff       	jmp    8d4 <struct_field_str+0x24>
+ a5e:	66 90                	xchg   %ax,%ax
+ a60:	31 c9                	xor    %ecx,%ecx
+  put_escaped(w, value ? value : "");
+ a62:	ba 9e 0f 00 00       	mov    $0xf9e,%edx
+ a67:	e9 09 ff ff ff       	jmp    975 <struct_field_str+0xc5>
+  for(run = s; *s; s++){
+ a6c:	31 c9                	xor    %ecx,%ecx
+ a6e:	e9 02 ff ff ff       	jmp    975 <struct_field_str+0xc5>
+ a73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a80 <struct_field_int>:
+
+void
+struct_field_int(struct struct_writer *w, const char *key, int value)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 1c             	sub    $0x1c,%esp
+ a89:	8b 7d 08             	mov    0x8(%ebp),%edi
+ a8c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(w->need_comma)
+ a8f:	8b 57 04             	mov    0x4(%edi),%edx
+ a92:	85 d2                	test   %edx,%edx
+ a94:	0f 85 b6 00 00 00    	jne    b50 <struct_field_int+0xd0>
+    w->need_comma = 1;
+ a9a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%edi)
+  begin_field(w);
+  put(w, "\"", 1);
+ aa1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ aa6:	ba 46 0f 00 00       	mov    $0xf46,%edx
+ aab:	89 f8                	mov    %edi,%eax
+  put_str(w, key ? key : "");
+ aad:	be 0c 00 00 00       	mov    $0xc,%esi
+  put(w, "\"", 1);
+ ab2:	e8 99 fc ff ff       	call   750 <put>
+  put_str(w, key ? key : "");
+ ab7:	85 db                	test   %ebx,%ebx
+ ab9:	b8 9e 0f 00 00       	mov    $0xf9e,%eax
+ abe:	0f 44 d8             	cmove  %eax,%ebx
+    put(w, s, strlen(s));
+ ac1:	83 ec 0c             	sub    $0xc,%esp
+ ac4:	53                   	push   %ebx
+ ac5:	e8 f6 f5 ff ff       	call   c0 <strlen>
+ aca:	89 da                	mov    %ebx,%edx
+ acc:	89 c1                	mov    %eax,%ecx
+ ace:	89 f8                	mov    %edi,%eax
+ ad0:	e8 7b fc ff ff       	call   750 <put>
+  put(w, "\":", 2);
+ ad5:	b9 02 00 00 00       	mov    $0x2,%ecx
+ ada:	ba 59 0f 00 00       	mov    $0xf59,%edx
+ adf:	89 f8                	mov    %edi,%eax
+ ae1:	e8 6a fc ff ff       	call   750 <put>
+  x = value < 0 ? -(uint)value : value;
+ ae6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    buf[--i] = '0' + x % 10;
+ ae9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  x = value < 0 ? -(uint)value : value;
+ aec:	83 c4 10             	add    $0x10,%esp
+ aef:	f7 d9                	neg    %ecx
+ af1:	0f 48 4d 10          	cmovs  0x10(%ebp),%ecx
+ af5:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + x % 10;
+ af8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ afd:	89 f3                	mov    %esi,%ebx
+ aff:	83 ee 01             	sub    $0x1,%esi
+ b02:	f7 e1                	mul    %ecx
+ b04:	89 c8                	mov    %ecx,%eax
+ b06:	c1 ea 03             	shr    $0x3,%edx
+ b09:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ b0c:	01 ff                	add    %edi,%edi
+ b0e:	29 f8                	sub    %edi,%eax
+ b10:	83 c0 30             	add    $0x30,%eax
+ b13:	88 44 35 dc          	mov    %al,-0x24(%ebp,%esi,1)
+  } while((x /= 10) != 0);
+ b17:	89 c8                	mov    %ecx,%eax
+ b19:	89 d1                	mov    %edx,%ecx
+ b1b:	83 f8 09             	cmp    $0x9,%eax
+ b1e:	77 d8                	ja     af8 <struct_field_int+0x78>
+  if(value < 0)
+ b20:	8b 45 10             	mov    0x10(%ebp),%eax
+ b23:	8b 7d 08             	mov    0x8(%ebp),%edi
+ b26:	85 c0                	test   %eax,%eax
+ b28:	79 08                	jns    b32 <struct_field_int+0xb2>
+    buf[--i] = '-';
+ b2a:	c6 44 1d da 2d       	movb   $0x2d,-0x26(%ebp,%ebx,1)
+ b2f:	8d 73 fe             	lea    -0x2(%ebx),%esi
+  putcopy(w, buf + i, sizeof(buf) - i);
+ b32:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ b35:	b9 0c 00 00 00       	mov    $0xc,%ecx
+ b3a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+ b3d:	29 f1                	sub    %esi,%ecx
+ b3f:	89 f8                	mov    %edi,%eax
+ b41:	e8 aa fc ff ff       	call   7f0 <putcopy>
+  put_int(w, value);
+}
+ b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b49:	5b                   	pop    %ebx
+ b4a:	5e                   	pop    %esi
+ b4b:	5f                   	pop    %edi
+ b4c:	5d                   	pop    %ebp
+ b4d:	c3                   	ret
+ b4e:	66 90                	xchg   %ax,%ax
+    put(w, ",", 1);
+ b50:	b9 01 00 00 00       	mov    $0x1,%ecx
+ b55:	ba 42 0f 00 00       	mov    $0xf42,%edx
+ b5a:	89 f8                	mov    %edi,%eax
+ b5c:	e8 ef fb ff ff       	call   750 <put>
+}
+ b61:	e9 3b ff ff ff       	jmp    aa1 <struct_field_int+0x21>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b70 <struct_end>:
+
+void
+struct_end(struct struct_writer *w)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	56                   	push   %esi
+ b74:	53                   	push   %ebx
+ b75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(w->niov > 0){
+ b78:	8b 43 08             	mov    0x8(%ebx),%eax
+ b7b:	85 c0                	test   %eax,%eax
+ b7d:	7e 59                	jle    bd8 <struct_end+0x68>
+    if((const char*)last->iov_base + last->iov_len == s){
+ b7f:	8d 14 c3             	lea    (%ebx,%eax,8),%edx
+ b82:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ b85:	8b 72 08             	mov    0x8(%edx),%esi
+ b88:	01 ce                	add    %ecx,%esi
+ b8a:	81 fe 5c 0f 00 00    	cmp    $0xf5c,%esi
+ b90:	0f 84 aa 00 00 00    	je     c40 <struct_end+0xd0>
+  if(w->niov == STRUCT_NIOV)
+ b96:	83 f8 20             	cmp    $0x20,%eax
+ b99:	75 75                	jne    c10 <struct_end+0xa0>
+    writev(w->fd, w->iov, w->niov);
+ b9b:	83 ec 04             	sub    $0x4,%esp
+ b9e:	8d 73 10             	lea    0x10(%ebx),%esi
+ ba1:	6a 20                	push   $0x20
+ ba3:	56                   	push   %esi
+ ba4:	ff 33                	push   (%ebx)
+ ba6:	e8 98 f7 ff ff       	call   343 <writev>
+  w->nbuf = 0;
+ bab:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  w->niov++;
+ bb2:	83 c4 10             	add    $0x10,%esp
+  w->iov[w->niov].iov_base = (void*)s;
+ bb5:	c7 43 10 5c 0f 00 00 	movl   $0xf5c,0x10(%ebx)
+  w->iov[w->niov].iov_len = n;
+ bbc:	c7 43 14 02 00 00 00 	movl   $0x2,0x14(%ebx)
+  w->niov++;
+ bc3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+{
+ bca:	ba 01 00 00 00       	mov    $0x1,%edx
+ bcf:	eb 5a                	jmp    c2b <struct_end+0xbb>
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  w->niov++;
+ bd8:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ bdb:	83 c0 02             	add    $0x2,%eax
+ bde:	c7 04 c3 5c 0f 00 00 	movl   $0xf5c,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ be5:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ bec:	00 
+  w->niov++;
+ bed:	89 53 08             	mov    %edx,0x8(%ebx)
+  if(w->niov > 0)
+ bf0:	83 fa 01             	cmp    $0x1,%edx
+ bf3:	74 58                	je     c4d <struct_end+0xdd>
+  w->niov = 0;
+ bf5:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  w->nbuf = 0;
+ bfc:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  put(w, "}\n", 2);
+  flush(w);
+}
+ c03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c06:	5b                   	pop    %ebx
+ c07:	5e                   	pop    %esi
+ c08:	5d                   	pop    %ebp
+ c09:	c3                   	ret
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  w->niov++;
+ c10:	8d 50 01             	lea    0x1(%eax),%edx
+  w->iov[w->niov].iov_base = (void*)s;
+ c13:	83 c0 02             	add    $0x2,%eax
+ c16:	8d 73 10             	lea    0x10(%ebx),%esi
+ c19:	c7 04 c3 5c 0f 00 00 	movl   $0xf5c,(%ebx,%eax,8)
+  w->iov[w->niov].iov_len = n;
+ c20:	c7 44 c3 04 02 00 00 	movl   $0x2,0x4(%ebx,%eax,8)
+ c27:	00 
+  w->niov++;
+ c28:	89 53 08             	mov    %edx,0x8(%ebx)
+    writev(w->fd, w->iov, w->niov);
+ c2b:	83 ec 04             	sub    $0x4,%esp
+ c2e:	52                   	push   %edx
+ c2f:	56                   	push   %esi
+ c30:	ff 33                	push   (%ebx)
+ c32:	e8 0c f7 ff ff       	call   343 <writev>
+ c37:	83 c4 10             	add    $0x10,%esp
+ c3a:	eb b9                	jmp    bf5 <struct_end+0x85>
+ c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      last->iov_len += n;
+ c40:	83 c1 02             	add    $0x2,%ecx
+ c43:	8d 73 10             	lea    0x10(%ebx),%esi
+ c46:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  if(w->niov > 0)
+ c49:	89 c2                	mov    %eax,%edx
+ c4b:	eb de                	jmp    c2b <struct_end+0xbb>
+ c4d:	8d 73 10             	lea    0x10(%ebx),%esi
+ c50:	e9 75 ff ff ff       	jmp    bca <struct_end+0x5a>
+ c55:	66 90                	xchg   %ax,%ax
+ c57:	66 90                	xchg   %ax,%ax
+ c59:	66 90                	xchg   %ax,%ax
+ c5b:	66 90                	xchg   %ax,%ax
+ c5d:	66 90                	xchg   %ax,%ax
+ c5f:	90                   	nop
+
+00000c60 <modern_print_version.part.0>:
+  }
+  return i;
+}
+
+void
+modern_print_version(const char *cmd, int json_mode)
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	56                   	push   %esi
+ c64:	89 c6                	mov    %eax,%esi
+ c66:	53                   	push   %ebx
+  if(!json_mode){
+    modern_plain_version(cmd);
+    return;
+  }
+  struct struct_writer w;
+  struct_begin(&w, 1);
+ c67:	8d 9d a8 fe ff ff    	lea    -0x158(%ebp),%ebx
+modern_print_version(const char *cmd, int json_mode)
+ c6d:	81 ec 58 01 00 00    	sub    $0x158,%esp
+  struct_begin(&w, 1);
+ c73:	6a 01                	push   $0x1
+ c75:	53                   	push   %ebx
+ c76:	e8 05 fc ff ff       	call   880 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ c7b:	83 c4 0c             	add    $0xc,%esp
+ c7e:	56                   	push   %esi
+ c7f:	68 62 0f 00 00       	push   $0xf62
+ c84:	53                   	push   %ebx
+ c85:	e8 26 fc ff ff       	call   8b0 <struct_field_str>
+  struct_field_str(&w, "vendor", MODERN_VENDOR);
+ c8a:	83 c4 0c             	add    $0xc,%esp
+ c8d:	68 6a 0f 00 00       	push   $0xf6a
+ c92:	68 7b 0f 00 00       	push   $0xf7b
+ c97:	53                   	push   %ebx
+ c98:	e8 13 fc ff ff       	call   8b0 <struct_field_str>
+  struct_field_int(&w, "year", MODERN_YEAR);
+ c9d:	83 c4 0c             	add    $0xc,%esp
+ ca0:	68 ea 07 00 00       	push   $0x7ea
+ ca5:	68 82 0f 00 00       	push   $0xf82
+ caa:	53                   	push   %ebx
+ cab:	e8 d0 fd ff ff       	call   a80 <struct_field_int>
+  struct_end(&w);
+ cb0:	89 1c 24             	mov    %ebx,(%esp)
+ cb3:	e8 b8 fe ff ff       	call   b70 <struct_end>
+ cb8:	83 c4 10             	add    $0x10,%esp
+}
+ cbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cbe:	5b                   	pop    %ebx
+ cbf:	5e                   	pop    %esi
+ cc0:	5d                   	pop    %ebp
+ cc1:	c3                   	ret
+ cc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <modern_consume_flags>:
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	57                   	push   %edi
+ cd4:	56                   	push   %esi
+ cd5:	53                   	push   %ebx
+ cd6:	83 ec 0c             	sub    $0xc,%esp
+ cd9:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(json_mode)
+ cdc:	85 f6                	test   %esi,%esi
+ cde:	74 06                	je     ce6 <modern_consume_flags+0x16>
+    *json_mode = 0;
+ ce0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  for(i = 1; i < argc; i++){
+ ce6:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+ cea:	bf 01 00 00 00       	mov    $0x1,%edi
+ cef:	7e 4c                	jle    d3d <modern_consume_flags+0x6d>
+    char *arg = argv[i];
+ cf1:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(strcmp(arg, "--version") == 0){
+ cf4:	83 ec 08             	sub    $0x8,%esp
+    char *arg = argv[i];
+ cf7:	8b 1c b8             	mov    (%eax,%edi,4),%ebx
+    if(strcmp(arg, "--version") == 0){
+ cfa:	68 87 0f 00 00       	push   $0xf87
+ cff:	53                   	push   %ebx
+ d00:	e8 5b f3 ff ff       	call   60 <strcmp>
+ d05:	83 c4 10             	add    $0x10,%esp
+ d08:	85 c0                	test   %eax,%eax
+ d0a:	74 58                	je     d64 <modern_consume_flags+0x94>
+    if(supports_json && (strcmp(arg, "-J") == 0 || strcmp(arg, "--json") == 0)){
+ d0c:	8b 45 14             	mov    0x14(%ebp),%eax
+ d0f:	85 c0                	test   %eax,%eax
+ d11:	74 2a                	je     d3d <modern_consume_flags+0x6d>
+ d13:	83 ec 08             	sub    $0x8,%esp
+ d16:	68 9f 0f 00 00       	push   $0xf9f
+ d1b:	53                   	push   %ebx
+ d1c:	e8 3f f3 ff ff       	call   60 <strcmp>
+ d21:	83 c4 10             	add    $0x10,%esp
+ d24:	85 c0                	test   %eax,%eax
+ d26:	74 28                	je     d50 <modern_consume_flags+0x80>
+ d28:	83 ec 08             	sub    $0x8,%esp
+ d2b:	68 a2 0f 00 00       	push   $0xfa2
+ d30:	53                   	push   %ebx
+ d31:	e8 2a f3 ff ff       	call   60 <strcmp>
+ d36:	83 c4 10             	add    $0x10,%esp
+ d39:	85 c0                	test   %eax,%eax
+ d3b:	74 13                	je     d50 <modern_consume_flags+0x80>
+}
+ d3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d40:	89 f8                	mov    %edi,%eax
+ d42:	5b                   	pop    %ebx
+ d43:	5e                   	pop    %esi
+ d44:	5f                   	pop    %edi
+ d45:	5d                   	pop    %ebp
+ d46:	c3                   	ret
+ d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4e:	66 90                	xchg   %ax,%ax
+      if(json_mode)
+ d50:	85 f6                	test   %esi,%esi
+ d52:	74 06                	je     d5a <modern_consume_flags+0x8a>
+        *json_mode = 1;
+ d54:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+  for(i = 1; i < argc; i++){
+ d5a:	83 c7 01             	add    $0x1,%edi
+ d5d:	39 7d 0c             	cmp    %edi,0xc(%ebp)
+ d60:	75 8f                	jne    cf1 <modern_consume_flags+0x21>
+ d62:	eb d9                	jmp    d3d <modern_consume_flags+0x6d>
+      modern_print_version(cmd, json_mode ? *json_mode : 0);
+ d64:	85 f6                	test   %esi,%esi
+ d66:	74 12                	je     d7a <modern_consume_flags+0xaa>
+  if(!json_mode){
+ d68:	83 3e 00             	cmpl   $0x0,(%esi)
+ d6b:	74 0d                	je     d7a <modern_consume_flags+0xaa>
+ d6d:	8b 45 08             	mov    0x8(%ebp),%eax
+ d70:	e8 eb fe ff ff       	call   c60 <modern_print_version.part.0>
+      exit();
+ d75:	e8 f9 f4 ff ff       	call   273 <exit>
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ d7a:	83 ec 0c             	sub    $0xc,%esp
+ d7d:	68 ea 07 00 00       	push   $0x7ea
+ d82:	68 6a 0f 00 00       	push   $0xf6a
+ d87:	ff 75 08             	push   0x8(%ebp)
+ d8a:	68 91 0f 00 00       	push   $0xf91
+ d8f:	6a 01                	push   $0x1
+ d91:	e8 8a f6 ff ff       	call   420 <printf>
+}
+ d96:	83 c4 20             	add    $0x20,%esp
+ d99:	eb da                	jmp    d75 <modern_consume_flags+0xa5>
+ d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d9f:	90                   	nop
+
+00000da0 <modern_print_version>:
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	83 ec 08             	sub    $0x8,%esp
+  if(!json_mode){
+ da6:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+ da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!json_mode){
+ dac:	85 d2                	test   %edx,%edx
+ dae:	74 10                	je     dc0 <modern_print_version+0x20>
+}
+ db0:	c9                   	leave
+ db1:	e9 aa fe ff ff       	jmp    c60 <modern_print_version.part.0>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+  printf(1, "%s (c) %s %d\n", cmd, MODERN_VENDOR, MODERN_YEAR);
+ dc0:	83 ec 0c             	sub    $0xc,%esp
+ dc3:	68 ea 07 00 00       	push   $0x7ea
+ dc8:	68 6a 0f 00 00       	push   $0xf6a
+ dcd:	50                   	push   %eax
+ dce:	68 91 0f 00 00       	push   $0xf91
+ dd3:	6a 01                	push   $0x1
+ dd5:	e8 46 f6 ff ff       	call   420 <printf>
+}
+ dda:	83 c4 20             	add    $0x20,%esp
+}
+ ddd:	c9                   	leave
+ dde:	c3                   	ret
+ ddf:	90                   	nop
+
+00000de0 <modern_emit_status>:
+
+modern_emit_status(const char *cmd, const char *event, const char *target, int json_mode, const char *status)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	57                   	push   %edi
+ de4:	56                   	push   %esi
+ de5:	53                   	push   %ebx
+ de6:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  if(!json_mode){
+ dec:	8b 55 14             	mov    0x14(%ebp),%edx
+{
+ def:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ df2:	8b 45 10             	mov    0x10(%ebp),%eax
+ df5:	8b 75 18             	mov    0x18(%ebp),%esi
+  if(!json_mode){
+ df8:	85 d2                	test   %edx,%edx
+ dfa:	75 44                	jne    e40 <modern_emit_status+0x60>
+    printf(1, "%s: %s %s %s\n", cmd, event ? event : "event", target ? target : "", status ? status : "done");
+ dfc:	85 f6                	test   %esi,%esi
+ dfe:	ba a9 0f 00 00       	mov    $0xfa9,%edx
+ e03:	0f 44 f2             	cmove  %edx,%esi
+ e06:	85 c0                	test   %eax,%eax
+ e08:	ba 9e 0f 00 00       	mov    $0xf9e,%edx
+ e0d:	0f 44 c2             	cmove  %edx,%eax
+ e10:	85 db                	test   %ebx,%ebx
+ e12:	ba ae 0f 00 00       	mov    $0xfae,%edx
+ e17:	0f 44 da             	cmove  %edx,%ebx
+ e1a:	83 ec 08             	sub    $0x8,%esp
+ e1d:	56                   	push   %esi
+ e1e:	50                   	push   %eax
+ e1f:	53                   	push   %ebx
+ e20:	ff 75 08             	push   0x8(%ebp)
+ e23:	68 b4 0f 00 00       	push   $0xfb4
+ e28:	6a 01                	push   $0x1
+ e2a:	e8 f1 f5 ff ff       	call   420 <printf>
+ e2f:	83 c4 20             	add    $0x20,%esp
+  if(target)
+    struct_field_str(&w, "target", target);
+  if(status)
+    struct_field_str(&w, "status", status);
+  struct_end(&w);
+}
+ e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e35:	5b                   	pop    %ebx
+ e36:	5e                   	pop    %esi
+ e37:	5f                   	pop    %edi
+ e38:	5d                   	pop    %ebp
+ e39:	c3                   	ret
+ e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  struct_begin(&w, 1);
+ e40:	83 ec 08             	sub    $0x8,%esp
+ e43:	8d bd 98 fe ff ff    	lea    -0x168(%ebp),%edi
+ e49:	89 45 10             	mov    %eax,0x10(%ebp)
+ e4c:	6a 01                	push   $0x1
+ e4e:	57                   	push   %edi
+ e4f:	e8 2c fa ff ff       	call   880 <struct_begin>
+  struct_field_str(&w, "command", cmd);
+ e54:	83 c4 0c             	add    $0xc,%esp
+ e57:	ff 75 08             	push   0x8(%ebp)
+ e5a:	68 62 0f 00 00       	push   $0xf62
+ e5f:	57                   	push   %edi
+ e60:	e8 4b fa ff ff       	call   8b0 <struct_field_str>
+  struct_field_str(&w, "event", event ? event : "event");
+ e65:	83 c4 0c             	add    $0xc,%esp
+ e68:	ba ae 0f 00 00       	mov    $0xfae,%edx
+ e6d:	85 db                	test   %ebx,%ebx
+ e6f:	0f 44 da             	cmove  %edx,%ebx
+ e72:	53                   	push   %ebx
+ e73:	52                   	push   %edx
+ e74:	57                   	push   %edi
+ e75:	e8 36 fa ff ff       	call   8b0 <struct_field_str>
+  if(target)
+ e7a:	8b 45 10             	mov    0x10(%ebp),%eax
+ e7d:	83 c4 10             	add    $0x10,%esp
+ e80:	85 c0                	test   %eax,%eax
+ e82:	74 12                	je     e96 <modern_emit_status+0xb6>
+    struct_field_str(&w, "target", target);
+ e84:	83 ec 04             	sub    $0x4,%esp
+ e87:	50                   	push   %eax
+ e88:	68 c2 0f 00 00       	push   $0xfc2
+ e8d:	57                   	push   %edi
+ e8e:	e8 1d fa ff ff       	call   8b0 <struct_field_str>
+ e93:	83 c4 10             	add    $0x10,%esp
+  if(status)
+ e96:	85 f6                	test   %esi,%esi
+ e98:	74 12                	je     eac <modern_emit_status+0xcc>
+    struct_field_str(&w, "status", status);
+ e9a:	83 ec 04             	sub    $0x4,%esp
+ e9d:	56                   	push   %esi
+ e9e:	68 c9 0f 00 00       	push   $0xfc9
+ ea3:	57                   	push   %edi
+ ea4:	e8 07 fa ff ff       	call   8b0 <struct_field_str>
+ ea9:	83 c4 10             	add    $0x10,%esp
+  struct_end(&w);
+ eac:	83 ec 0c             	sub    $0xc,%esp
+ eaf:	57                   	push   %edi
+ eb0:	e8 bb fc ff ff       	call   b70 <struct_end>
+ eb5:	83 c4 10             	add    $0x10,%esp
+}
+ eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ebb:	5b                   	pop    %ebx
+ ebc:	5e                   	pop    %esi
+ ebd:	5f                   	pop    %edi
+ ebe:	5d                   	pop    %ebp
+ ebf:	c3                   	ret
@@ -0,0 +1,281 @@
+// Report how close together a file system image keeps each
+// file's inode and data: for every file, the inode's group and
+// block, how many runs of contiguous blocks its data is in, and
+// how far its first data block is from its inode. Ends with a
+// summary and the use of each allocation group.
+//
+// Usage: fslocality fs.img
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define stat xv6_stat  // avoid clash with host struct stat
+#include "types.h"
+#include "fs.h"
+#include "stat.h"
+#include "param.h"
+
+int fsfd;
+struct superblock sb;
+
+// Totals over all files.
+int nfiles, ninline, ningroup, nwithdata;
+uint nruns, nblks;
+unsigned long dist;
+
+// The blocks of the file being walked.
+uint *blks;
+uint nb, maxnb;
+
+ushort
+xshort(ushort x)
+{
+  uchar *a = (uchar*)&x;
+  return a[0] | (a[1] << 8);
+}
+
+uint
+xint(uint x)
+{
+  uchar *a = (uchar*)&x;
+  return a[0] | (a[1] << 8) | (a[2] << 16) | ((uint)a[3] << 24);
+}
+
+void
+rsect(uint sec, void *buf)
+{
+  if(sb.size && sec >= sb.size){
+    fprintf(stderr, "fslocality: block %u out of range\n", sec);
+    exit(1);
+  }
+  if(lseek(fsfd, (off_t)sec * BSIZE, 0) != (off_t)sec * BSIZE ||
+     read(fsfd, buf, BSIZE) != BSIZE){
+    perror("read");
+    exit(1);
+  }
+}
+
+void
+rinode(uint inum, struct dinode *ip)
+{
+  char buf[BSIZE];
+
+  rsect(IBLOCK(inum, sb), buf);
+  *ip = ((struct dinode*)buf)[inum % IPB];
+}
+
+int
+group(uint b)
+{
+  if(sb.features & FS_GROUPS)
+    return b / sb.groupsize;
+  return 0;
+}
+
+void
+addblk(uint b)
+{
+  if(nb == maxnb){
+    maxnb = maxnb ? 2*maxnb : 64;
+    if((blks = realloc(blks, maxnb * sizeof(uint))) == 0){
+      perror("realloc");
+      exit(1);
+    }
+  }
+  blks[nb++] = b;
+}
+
+// Add the data blocks of the extent tree node h, in file order.
+void
+extwalk(struct exthdr *h)
+{
+  struct extent *e;
+  char buf[BSIZE];
+  uint i, j;
+
+  e = EXT(h);
+  for(i = 0; i < xshort(h->n); i++){
+    if(xshort(h->depth) == 0){
+      for(j = 0; j < xint(e[i].len); j++)
+        addblk(xint(e[i].start) + j);
+    } else {
+      rsect(xint(e[i].start), buf);
+      extwalk((struct exthdr*)buf);
+    }
+  }
+}
+
+// Collect the data blocks of din into blks[0..nb).
+// Returns 0 if its data is in the inode.
+int
+mapfile(struct dinode *din)
+{
+  uint indirect[NINDIRECT], n, i;
+
+  nb = 0;
+  n = (xint(din->size) + BSIZE - 1) / BSIZE;
+  if((sb.features & FS_INLINE) && xshort(din->type) == T_FILE &&
+     xint(din->size) <= INLINESZ)
+    return 0;
+  if(sb.features & FS_EXTENTS){
+    extwalk((struct exthdr*)din->addrs);
+  } else {
+    for(i = 0; i < NDIRECT; i++)
+      addblk(xint(din->addrs[i]));
+    if(n > NDIRECT){
+      rsect(xint(din->addrs[NDIRECT]), indirect);
+      for(i = 0; i < NINDIRECT; i++)
+        addblk(xint(indirect[i]));
+    }
+  }
+  if(nb > n)
+    nb = n;
+  return 1;
+}
+
+void
+report(char *path, uint inum, struct dinode *din)
+{
+  uint i, runs, ib, d;
+
+  nfiles++;
+  ib = IBLOCK(inum, sb);
+  if(!mapfile(din)){
+    ninline++;
+    printf("%-24s %4u %5d %6u %7u %5s %6s\n", path, inum, group(ib), ib,
+           xint(din->size), "-", "inline");
+    return;
+  }
+  runs = 0;
+  for(i = 0; i < nb; i++)
+    if(i == 0 || blks[i] != blks[i-1] + 1)
+      runs++;
+  nruns += runs;
+  nblks += nb;
+  if(nb == 0){
+    printf("%-24s %4u %5d %6u %7u %5u %6s\n", path, inum, group(ib), ib,
+           xint(din->size), runs, "-");
+    return;
+  }
+  nwithdata++;
+  d = blks[0] > ib ? blks[0] - ib : ib - blks[0];
+  dist += d;
+  if(group(blks[0]) == group(ib))
+    ningroup++;
+  printf("%-24s %4u %5d %6u %7u %5u %6u\n", path, inum, group(ib), ib,
+         xint(din->size), runs, d);
+}
+
+// Report on every file under directory dir, whose path is path.
+void
+walk(uint dir, char *path)
+{
+  struct dinode din, child;
+  struct dirent *de;
+  char buf[BSIZE], name[512];
+  uint i, j, n, *b;
+
+  rinode(dir, &din);
+  report(*path ? path : "/", dir, &din);
+  mapfile(&din);
+  n = nb;
+  if((b = malloc(n * sizeof(uint))) == 0){
+    perror("malloc");
+    exit(1);
+  }
+  memmove(b, blks, n * sizeof(uint));
+
+  // Slots of a hashed directory's index read as empty entries.
+  for(i = 0; i < n; i++){
+    rsect(b[i], buf);
+    for(j = 0; j < BSIZE / sizeof(struct dirent); j++){
+      de = (struct dirent*)buf + j;
+      if(xshort(de->inum) == 0 ||
+         strncmp(de->name, ".", DIRSIZ) == 0 || strncmp(de->name, "..", DIRSIZ) == 0)
+        continue;
+      snprintf(name, sizeof(name), "%s/%.*s", path, DIRSIZ, de->name);
+      rinode(xshort(de->inum), &child);
+      if(xshort(child.type) == T_DIR)
+        walk(xshort(de->inum), name);
+      else
+        report(name, xshort(de->inum), &child);
+    }
+  }
+  free(b);
+}
+
+// Print how many blocks and inodes of each group are in use.
+void
+groups(void)
+{
+  uchar buf[BSIZE];
+  struct dinode din;
+  uint g, i, n, nblk, bused, iused, span;
+
+  span = (sb.features & FS_GROUPS) ? sb.groupsize : BPB;
+  n = (sb.size + span - 1) / span;
+  printf("\ngroup  blocks  used  inodes  used\n");
+  for(g = 0; g < n; g++){
+    rsect(BBLOCK(g*span, sb), buf);
+    nblk = sb.size - g*span < span ? sb.size - g*span : span;
+    bused = 0;
+    for(i = 0; i < nblk; i++)
+      if(buf[i/8] & (1 << (i%8)))
+        bused++;
+    iused = 0;
+    if(sb.features & FS_GROUPS){
+      for(i = 0; i < sb.ipg; i++){
+        rinode(g*sb.ipg + i, &din);
+        if(xshort(din.type) != 0)
+          iused++;
+      }
+      printf("%5u %7u %5u %7u %5u\n", g, nblk, bused, sb.ipg, iused);
+    } else
+      printf("%5u %7u %5u %7s %5s\n", g, nblk, bused, "-", "-");
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  char buf[BSIZE];
+
+  if(argc != 2){
+    fprintf(stderr, "Usage: fslocality fs.img\n");
+    exit(1);
+  }
+  if((fsfd = open(argv[1], O_RDONLY)) < 0){
+    perror(argv[1]);
+    exit(1);
+  }
+  rsect(1, buf);
+  memmove(&sb, buf, sizeof(sb));
+  sb.size = xint(sb.size);
+  sb.ninodes = xint(sb.ninodes);
+  sb.inodestart = xint(sb.inodestart);
+  sb.bmapstart = xint(sb.bmapstart);
+  sb.features = xint(sb.features);
+  sb.ngroups = xint(sb.ngroups);
+  sb.groupsize = xint(sb.groupsize);
+  sb.ipg = xint(sb.ipg);
+  if((sb.bsize ? xint(sb.bsize) : 512) != BSIZE){
+    fprintf(stderr, "fslocality: image has %u-byte blocks, built for %d\n",
+            xint(sb.bsize), BSIZE);
+    exit(1);
+  }
+
+  printf("%-24s %4s %5s %6s %7s %5s %6s\n",
+         "path", "inum", "group", "iblock", "size", "runs", "dist");
+  walk(ROOTINO, "");
+  groups();
+
+  printf("\n%d files, %d inline; %d of %d with data start in their inode's group\n",
+         nfiles, ninline, ningroup, nwithdata);
+  if(nwithdata)
+    printf("mean inode-to-data distance %lu blocks, %.2f runs per file\n",
+           dist / nwithdata, (double)nruns / nwithdata);
+  exit(0);
+}
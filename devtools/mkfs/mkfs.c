@@ -0,0 +1,656 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+
+#define stat xv6_stat  // avoid clash with host struct stat
+#include "types.h"
+#include "fs.h"
+#include "stat.h"
+#include "param.h"
+
+#ifndef static_assert
+#define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
+#endif
+
+#define NINODES 200
+
+// Disk layout:
+// [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
+// or, with -g, allocation groups after the log (see fs.h).
+
+#define MAXGROUPS (FSSIZE/MINGROUP + 1)
+
+int nbitmap = FSSIZE/(BSIZE*8) + 1;
+int ninodeblocks = NINODES / IPB + 1;
+int nlog = LOGSIZE;
+int nopblocks = MAXOPBLOCKS;
+int features;
+int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
+int nblocks;  // Number of data blocks
+
+// Without -g, the whole disk is allocated as a single group.
+int ngroups = 1;
+uint groupsize = FSSIZE;
+uint ipg = NINODES;  // inodes per group
+
+int fsfd;
+struct superblock sb;
+char zeroes[BSIZE];
+uint freeinode[MAXGROUPS];  // next free inode in each group
+uint freeblock[MAXGROUPS];  // next free block in each group
+int curgroup;               // group that newblock() allocates from
+int dirgroup;               // group of the last new directory
+
+
+void balloc(void);
+uint newblock(void);
+void wsect(uint, void*);
+void winode(uint, struct dinode*);
+void rinode(uint inum, struct dinode *ip);
+void rsect(uint sec, void *buf);
+uint ialloc(ushort type, uint parent);
+void iappend(uint inum, void *p, int n);
+void iinline(uint inum, void *p, int n);
+uint mkdirent(uint parent, char *name, ushort type);
+uint lookup(uint dir, char *name);
+uint extmap(struct dinode *din, uint fbn, int alloc);
+
+// convert to intel byte order
+ushort
+xshort(ushort x)
+{
+  ushort y;
+  uchar *a = (uchar*)&y;
+  a[0] = x;
+  a[1] = x >> 8;
+  return y;
+}
+
+uint
+xint(uint x)
+{
+  uint y;
+  uchar *a = (uchar*)&y;
+  a[0] = x;
+  a[1] = x >> 8;
+  a[2] = x >> 16;
+  a[3] = x >> 24;
+  return y;
+}
+
+static void
+usage(void)
+{
+  fprintf(stderr, "Usage: mkfs [-l logblocks] [-o opblocks] [-g groupblocks] [-e] [-i] fs.img files...\n");
+  exit(1);
+}
+
+// The number of file data blocks one FS operation may write,
+// worked out as the kernel's log_datablocks() does.
+int
+datablocks(void)
+{
+  int n, max, nmap;
+
+  nmap = (features & FS_EXTENTS) ? 2*EXTMAXDEPTH+1 : 1;
+  max = nmap > 1 ? NEXTBLK : MAXFILE;
+  if(!LOGORDERED)
+    n = (nopblocks-1-nmap-2) / 2;
+  else if(nbitmap + 1 + nmap <= nopblocks)
+    n = max;
+  else
+    n = nopblocks-1-nmap-1;
+  return n < max ? n : max;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, img, cc, n, fd;
+  uint rootino, dir, inum, off;
+  char buf[BSIZE], *name, *slash;
+  struct dinode din;
+
+  static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
+
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-e") == 0){
+      features |= FS_EXTENTS;
+      continue;
+    }
+    if(strcmp(argv[i], "-i") == 0){
+      features |= FS_INLINE;
+      continue;
+    }
+    if(i + 1 >= argc)
+      usage();
+    if(strcmp(argv[i], "-l") == 0)
+      nlog = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-o") == 0)
+      nopblocks = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-g") == 0){
+      groupsize = atoi(argv[++i]);
+      features |= FS_GROUPS;
+    }
+    else
+      usage();
+  }
+  if(i >= argc)
+    usage();
+  img = i;
+
+  // The log header must fit in one block and every logged block
+  // stays pinned in the kernel's buffer cache until commit. An
+  // op gets at least the MAXOPBLOCKS that the kernel defaults to.
+  if(nlog < MAXOPBLOCKS + 1 || nlog - 1 > MAXLOGSIZE){
+    fprintf(stderr, "mkfs: log size must be between %d and %d blocks\n",
+            MAXOPBLOCKS + 1, MAXLOGSIZE + 1);
+    exit(1);
+  }
+  if(nopblocks < MAXOPBLOCKS || nopblocks > nlog - 1){
+    fprintf(stderr, "mkfs: op blocks must be between %d and %d\n",
+            MAXOPBLOCKS, nlog - 1);
+    exit(1);
+  }
+
+  assert(BSIZE >= 512 && BSIZE <= 4096 && (BSIZE & (BSIZE-1)) == 0);
+  assert((BSIZE % sizeof(struct dinode)) == 0);
+  assert((BSIZE % sizeof(struct dirent)) == 0);
+
+  fsfd = open(argv[img], O_RDWR|O_CREAT|O_TRUNC, 0666);
+  if(fsfd < 0){
+    perror(argv[img]);
+    exit(1);
+  }
+
+  if(features & FS_GROUPS){
+    // One free map block per group, and the inodes spread
+    // evenly over the groups, a whole number of blocks each.
+    if(groupsize < MINGROUP || groupsize > BPB){
+      fprintf(stderr, "mkfs: group size must be between %d and %d blocks\n",
+              MINGROUP, BPB);
+      exit(1);
+    }
+    ngroups = (FSSIZE + groupsize - 1) / groupsize;
+    ipg = (NINODES + ngroups - 1) / ngroups;
+    ipg = (ipg + IPB - 1) / IPB * IPB;
+    ninodeblocks = ngroups * (ipg / IPB);
+    nbitmap = ngroups;
+    if(2 + nlog + 1 + ipg/IPB >= groupsize ||
+       FSSIZE - (ngroups-1)*groupsize <= 1 + ipg/IPB){
+      fprintf(stderr, "mkfs: groups of %d blocks are too small\n", groupsize);
+      exit(1);
+    }
+    // Truncating a file in one op may free blocks in every group,
+    // dirtying all the free map blocks as well as its i-node.
+    if(ngroups + 3 > nopblocks){
+      fprintf(stderr, "mkfs: %d groups need at least %d op blocks\n",
+              ngroups, ngroups + 3);
+      exit(1);
+    }
+  }
+
+  // The kernel refuses to mount a file system on which a write
+  // could not make progress.
+  if(datablocks() < 1){
+    fprintf(stderr, "mkfs: %d op blocks leave no room for file data\n",
+            nopblocks);
+    exit(1);
+  }
+
+  nmeta = 2 + nlog + ninodeblocks + nbitmap;
+  nblocks = FSSIZE - nmeta;
+
+  sb.size = xint(FSSIZE);
+  sb.nblocks = xint(nblocks);
+  sb.ninodes = xint(ngroups * ipg);
+  sb.nlog = xint(nlog);
+  sb.logstart = xint(2);
+  if(features & FS_GROUPS){
+    sb.bmapstart = xint(2+nlog);
+    sb.inodestart = xint(2+nlog+1);
+    sb.ngroups = xint(ngroups);
+    sb.groupsize = xint(groupsize);
+    sb.ipg = xint(ipg);
+  } else {
+    sb.inodestart = xint(2+nlog);
+    sb.bmapstart = xint(2+nlog+ninodeblocks);
+  }
+  sb.opblocks = xint(nopblocks);
+  sb.features = xint(features);
+  sb.bsize = xint(BSIZE);
+
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  if(features & FS_GROUPS)
+    printf("%d allocation groups of %d blocks, %d inodes each\n",
+           ngroups, groupsize, ipg);
+  printf("block size %d\n", BSIZE);
+  printf("log: %d blocks, %d blocks per op\n", nlog, nopblocks);
+  if(features & FS_EXTENTS)
+    printf("extent-mapped inodes\n");
+  if(features & FS_INLINE)
+    printf("inline data for files up to %d bytes\n", (int)INLINESZ);
+
+  // The first free block and inode of each group.
+  for(i = 0; i < ngroups; i++){
+    if(features & FS_GROUPS)
+      freeblock[i] = GDATA(i, sb);
+    else
+      freeblock[i] = nmeta;
+    freeinode[i] = i ? i*ipg : 1;
+  }
+
+  for(i = 0; i < FSSIZE; i++)
+    wsect(i, zeroes);
+
+  memset(buf, 0, sizeof(buf));
+  memmove(buf, &sb, sizeof(sb));
+  wsect(1, buf);
+
+  rootino = ialloc(T_DIR, 0);
+  assert(rootino == ROOTINO);
+  mkdirent(rootino, ".", 0);
+  mkdirent(rootino, "..", 0);
+
+  for(i = img + 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      perror(argv[i]);
+      exit(1);
+    }
+
+    // Create the directories leading up to the file.
+    dir = rootino;
+    name = argv[i];
+    while((slash = strchr(name, '/')) != 0){
+      *slash = 0;
+      if(*name && (inum = lookup(dir, name)) == 0)
+        inum = mkdirent(dir, name, T_DIR);
+      if(*name)
+        dir = inum;
+      name = slash + 1;
+    }
+
+    // Skip leading _ in name when writing to file system.
+    // The binaries are named _rm, _cat, etc. to keep the
+    // build operating system from trying to execute them
+    // in place of system binaries like rm and cat.
+    if(name[0] == '_')
+      ++name;
+
+    inum = mkdirent(dir, name, T_FILE);
+    cc = read(fd, buf, sizeof(buf));
+    if((features & FS_INLINE) && cc >= 0 && cc <= INLINESZ){
+      // Small enough to keep in the inode, if that was all.
+      if((n = read(fd, buf + cc, 1)) == 0){
+        iinline(inum, buf, cc);
+        close(fd);
+        continue;
+      }
+      cc += n;
+    }
+    while(cc > 0){
+      iappend(inum, buf, cc);
+      cc = read(fd, buf, sizeof(buf));
+    }
+
+    close(fd);
+  }
+
+  // fix size of root inode dir
+  rinode(rootino, &din);
+  off = xint(din.size);
+  off = ((off/BSIZE) + 1) * BSIZE;
+  din.size = xint(off);
+  winode(rootino, &din);
+
+  balloc();
+
+  exit(0);
+}
+
+void
+wsect(uint sec, void *buf)
+{
+  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+    perror("lseek");
+    exit(1);
+  }
+  if(write(fsfd, buf, BSIZE) != BSIZE){
+    perror("write");
+    exit(1);
+  }
+}
+
+void
+winode(uint inum, struct dinode *ip)
+{
+  char buf[BSIZE];
+  uint bn;
+  struct dinode *dip;
+
+  bn = IBLOCK(inum, sb);
+  rsect(bn, buf);
+  dip = ((struct dinode*)buf) + (inum % IPB);
+  *dip = *ip;
+  wsect(bn, buf);
+}
+
+void
+rinode(uint inum, struct dinode *ip)
+{
+  char buf[BSIZE];
+  uint bn;
+  struct dinode *dip;
+
+  bn = IBLOCK(inum, sb);
+  rsect(bn, buf);
+  dip = ((struct dinode*)buf) + (inum % IPB);
+  *ip = *dip;
+}
+
+void
+rsect(uint sec, void *buf)
+{
+  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+    perror("lseek");
+    exit(1);
+  }
+  if(read(fsfd, buf, BSIZE) != BSIZE){
+    perror("read");
+    exit(1);
+  }
+}
+
+// Allocate an inode in the group of inode parent, or for a
+// directory in the next group in turn, or failing that in
+// the first group after it with one to spare.
+uint
+ialloc(ushort type, uint parent)
+{
+  uint inum;
+  int i, g;
+  struct dinode din;
+
+  g = parent / ipg;
+  if(type == T_DIR && parent != 0){
+    dirgroup = (dirgroup + 1) % ngroups;
+    g = dirgroup;
+  }
+  for(i = 0; i < ngroups; i++, g = (g + 1) % ngroups)
+    if(freeinode[g] < (g+1)*ipg)
+      break;
+  if(i == ngroups){
+    fprintf(stderr, "mkfs: out of inodes\n");
+    exit(1);
+  }
+  inum = freeinode[g]++;
+
+  bzero(&din, sizeof(din));
+  din.type = xshort(type);
+  din.nlink = xshort(1);
+  din.size = xint(0);
+  winode(inum, &din);
+  return inum;
+}
+
+// Add an entry called name to directory parent. If type is
+// non-zero, allocate a new inode of that type for it (with
+// . and .. if it is a directory); otherwise the entry is one
+// of parent's own . and .. links.
+uint
+mkdirent(uint parent, char *name, ushort type)
+{
+  uint inum;
+  struct dirent de;
+  struct dinode din;
+
+  inum = parent;
+  if(type)
+    inum = ialloc(type, parent);
+
+  bzero(&de, sizeof(de));
+  de.inum = xshort(inum);
+  strncpy(de.name, name, DIRSIZ);
+  iappend(parent, &de, sizeof(de));
+
+  if(type == T_DIR){
+    mkdirent(inum, ".", 0);
+    bzero(&de, sizeof(de));
+    de.inum = xshort(parent);
+    strcpy(de.name, "..");
+    iappend(inum, &de, sizeof(de));
+    rinode(parent, &din);
+    din.nlink = xshort(xshort(din.nlink) + 1);  // for ".."
+    winode(parent, &din);
+  }
+  return inum;
+}
+
+// Return the inode number of name in directory dir, or 0.
+uint
+lookup(uint dir, char *name)
+{
+  char buf[BSIZE];
+  uint off, bn, addr;
+  struct dinode din;
+  struct dirent *de;
+
+  rinode(dir, &din);
+  for(off = 0; off < xint(din.size); off += sizeof(*de)){
+    bn = off / BSIZE;
+    if(features & FS_EXTENTS)
+      addr = extmap(&din, bn, 0);
+    else {
+      assert(bn < NDIRECT);
+      addr = xint(din.addrs[bn]);
+    }
+    rsect(addr, buf);
+    de = (struct dirent*)(buf + off % BSIZE);
+    if(de->inum != 0 && strncmp(de->name, name, DIRSIZ) == 0)
+      return xshort(de->inum);
+  }
+  return 0;
+}
+
+// Write each group's free map. Every group has used a prefix
+// of its blocks, counting its own meta blocks (and for group 0
+// the boot block, super block and log).
+void
+balloc(void)
+{
+  uchar buf[BSIZE];
+  int g, i, used;
+  uint bn;
+
+  for(g = 0; g < ngroups; g++){
+    used = freeblock[g] - g*groupsize;
+    bn = (features & FS_GROUPS) ? GSTART(g, sb) : sb.bmapstart;
+    printf("balloc: first %d blocks have been allocated\n", used);
+    assert(used < BSIZE*8);
+    bzero(buf, BSIZE);
+    for(i = 0; i < used; i++){
+      buf[i/8] = buf[i/8] | (0x1 << (i%8));
+    }
+    printf("balloc: write bitmap block at sector %d\n", bn);
+    wsect(bn, buf);
+  }
+}
+
+// Allocate a data block from group curgroup, or if it is full
+// from the first group after it with room.
+uint
+newblock(void)
+{
+  int i, g;
+  uint end;
+
+  g = curgroup;
+  for(i = 0; i < ngroups; i++, g = (g + 1) % ngroups){
+    end = (g + 1) * groupsize;
+    if(end > FSSIZE)
+      end = FSSIZE;
+    if(freeblock[g] < end){
+      curgroup = g;
+      return freeblock[g]++;
+    }
+  }
+  fprintf(stderr, "mkfs: out of blocks\n");
+  exit(1);
+}
+
+// Return the disk block holding block fbn of extent-mapped
+// inode din, or 0. If alloc is set, fbn must be the block just
+// past the end of the file; allocate it, growing the last extent
+// when the new block is contiguous with it. mkfs only builds
+// trees of depth 0 and 1, which is plenty for the files it copies.
+uint
+extmap(struct dinode *din, uint fbn, int alloc)
+{
+  struct exthdr *root, *h;
+  struct extent *e;
+  char buf[BSIZE];
+  uint leaf, n, i, lbn, start, len, b;
+
+  root = (struct exthdr*)din->addrs;
+  h = root;
+  leaf = 0;
+  if(xshort(root->depth) > 0){
+    assert(xshort(root->depth) == 1);
+    e = EXT(root);
+    for(i = xshort(root->n) - 1; i > 0 && xint(e[i].lbn) > fbn; i--)
+      ;
+    leaf = xint(e[i].start);
+    rsect(leaf, buf);
+    h = (struct exthdr*)buf;
+  }
+
+  e = EXT(h);
+  n = xshort(h->n);
+  for(i = 0; i < n; i++){
+    lbn = xint(e[i].lbn);
+    len = xint(e[i].len);
+    if(fbn >= lbn && fbn < lbn + len)
+      return xint(e[i].start) + fbn - lbn;
+  }
+  if(!alloc)
+    return 0;
+
+  b = newblock();
+  if(n > 0){
+    start = xint(e[n-1].start);
+    len = xint(e[n-1].len);
+    assert(xint(e[n-1].lbn) + len == fbn);
+    if(start + len == b){
+      e[n-1].len = xint(len + 1);
+      goto done;
+    }
+  }
+
+  if(h == root && n == NEXTROOT){
+    // Move the root's extents into a leaf.
+    leaf = newblock();
+    bzero(buf, sizeof(buf));
+    memmove(buf, root, sizeof(struct exthdr) + n*sizeof(struct extent));
+    root->depth = xshort(1);
+    root->n = xshort(1);
+    EXT(root)[0].lbn = xint(0);
+    EXT(root)[0].start = xint(leaf);
+    EXT(root)[0].len = xint(0);
+    h = (struct exthdr*)buf;
+  } else if(h != root && n == NEXTBLK){
+    // Start a new leaf.
+    i = xshort(root->n);
+    if(i == NEXTROOT){
+      fprintf(stderr, "mkfs: file too fragmented\n");
+      exit(1);
+    }
+    leaf = newblock();
+    bzero(buf, sizeof(buf));
+    EXT(root)[i].lbn = xint(fbn);
+    EXT(root)[i].start = xint(leaf);
+    EXT(root)[i].len = xint(0);
+    root->n = xshort(i + 1);
+    h = (struct exthdr*)buf;
+  }
+  n = xshort(h->n);
+  e = EXT(h);
+  e[n].lbn = xint(fbn);
+  e[n].start = xint(b);
+  e[n].len = xint(1);
+  h->n = xshort(n + 1);
+
+done:
+  if(leaf)
+    wsect(leaf, buf);
+  return b;
+}
+
+// Store the n bytes at p as the whole contents of file inum.
+void
+iinline(uint inum, void *p, int n)
+{
+  struct dinode din;
+
+  assert(n <= INLINESZ);
+  rinode(inum, &din);
+  memmove(din.addrs, p, n);
+  din.size = xint(n);
+  winode(inum, &din);
+}
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+void
+iappend(uint inum, void *xp, int n)
+{
+  char *p = (char*)xp;
+  uint fbn, off, n1;
+  struct dinode din;
+  char buf[BSIZE];
+  uint indirect[NINDIRECT];
+  uint x;
+
+  rinode(inum, &din);
+  off = xint(din.size);
+  curgroup = inum / ipg;
+  // printf("append inum %d at off %d sz %d\n", inum, off, n);
+  while(n > 0){
+    fbn = off / BSIZE;
+    if(features & FS_EXTENTS){
+      if((x = extmap(&din, fbn, 0)) == 0)
+        x = extmap(&din, fbn, 1);
+      goto mapped;
+    }
+    assert(fbn < MAXFILE);
+    if(fbn < NDIRECT){
+      if(xint(din.addrs[fbn]) == 0){
+        din.addrs[fbn] = xint(newblock());
+      }
+      x = xint(din.addrs[fbn]);
+    } else {
+      if(xint(din.addrs[NDIRECT]) == 0){
+        din.addrs[NDIRECT] = xint(newblock());
+      }
+      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      if(indirect[fbn - NDIRECT] == 0){
+        indirect[fbn - NDIRECT] = xint(newblock());
+        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      }
+      x = xint(indirect[fbn-NDIRECT]);
+    }
+  mapped:
+    n1 = min(n, (fbn + 1) * BSIZE - off);
+    rsect(x, buf);
+    bcopy(p, buf + off - (fbn * BSIZE), n1);
+    wsect(x, buf);
+    n -= n1;
+    off += n1;
+    p += n1;
+  }
+  din.size = xint(off);
+  winode(inum, &din);
+}
@@ -0,0 +1,15 @@
+// batch(): make a run of system calls with one trap.
+
+#define BATCH_MAXARG 5    // most arguments of a call
+#define BATCH_MAX    64   // most calls in a batch
+
+#define BATCH_ABORT  1    // Stop after a call that returns < 0
+
+// One system call of a batch.
+struct sysop {
+  int num;                  // SYS_ number
+  int args[BATCH_MAXARG];
+  int link;                 // Bit k set: pass the result of the
+                            // earlier call args[k] instead
+  int ret;                  // Result, set by batch()
+};
@@ -1,7 +1,10 @@
 struct buf;
 struct context;
+struct dirent;
 struct file;
 struct inode;
+struct iovec;
+struct pcidev;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -15,6 +18,8 @@ void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+int             bprefetch(uint, uint);
+void            bdone(struct buf*);
 
 // console.c
 void            consoleinit(void);
@@ -31,27 +36,41 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int);
+int             filepoll(struct file*, int, void**);
+int             filepread(struct file*, char*, int, uint);
+int             filepwrite(struct file*, char*, int, uint);
+int             filesplice(struct file*, struct file*, int);
+int             fileseek(struct file*, int, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
-struct inode*   ialloc(uint, short);
+int             dirread(struct inode*, uint*, struct dirent*, struct inode**, int);
+void            dirunlink(struct inode*, char*, uint);
+struct inode*   ialloc(uint, short, uint);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
+void            ilockshared(struct inode*);
+void            iunlockshared(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+int             readiout(struct inode*, uint, uint, int (*)(void*, char*, int), void*);
+int             readiahead(struct inode*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
+int             writeiin(struct inode*, uint, uint, int (*)(void*, char*, int), void*);
 
 // ide.c
 void            ideinit(void);
@@ -66,6 +85,8 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+void            kref(char*);
+int             krefs(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -84,6 +105,10 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_write_data(struct buf*);
+void            log_freeing(struct buf*);
+uchar*          log_committed(struct buf*);
+int             log_datablocks(void);
 void            begin_op();
 void            end_op();
 
@@ -91,6 +116,12 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+int             pcifindclass(uint, uint, struct pcidev*);
+int             pcifinddev(uint, uint, struct pcidev*);
+uint            pciread(struct pcidev*, uint);
+void            pciwrite(struct pcidev*, uint, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -98,8 +129,10 @@ void            picinit(void);
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
-int             piperead(struct pipe*, char*, int);
-int             pipewrite(struct pipe*, char*, int);
+int             pipepoll(struct pipe*, int, void**);
+int             pipewait(struct pipe*, int);
+int             piperead(struct pipe*, char*, int, int);
+int             pipewrite(struct pipe*, char*, int, int);
 
 //PAGEBREAK: 16
 // proc.c
@@ -111,6 +144,9 @@ int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
+void            pollend(void);
+void            pollstart(void**, int);
+void            pollwait(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
@@ -136,6 +172,8 @@ void            popcli(void);
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            releasesleepshared(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
 
@@ -151,6 +189,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argoutptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -160,6 +199,7 @@ void            syscall(void);
 void            timerinit(void);
 
 // trap.c
+extern int      diskirq;
 void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
@@ -185,6 +225,10 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             uvmcow(pde_t*, uint);
+int             uvmwritable(pde_t*, uint, uint);
+char*           uvmshare(pde_t*, char*);
+int             uvmremap(pde_t*, char*, char*);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
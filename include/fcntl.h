@@ -2,3 +2,17 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+#define O_NONBLOCK 0x400  // read and write return EWOULDBLOCK, not wait
+
+// lseek() origins
+#define SEEK_SET  0
+#define SEEK_CUR  1
+#define SEEK_END  2
+
+// fcntl() commands
+#define F_GETFL   1   // return the O_ flags
+#define F_SETFL   2   // set O_NONBLOCK from arg
+
+// Returned by read and write on an O_NONBLOCK descriptor when
+// they would have to wait. Other errors are -1.
+#define EWOULDBLOCK (-2)
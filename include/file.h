@@ -3,6 +3,7 @@ struct file {
   int ref; // reference count
   char readable;
   char writable;
+  char nonblock;  // O_NONBLOCK
   struct pipe *pipe;
   struct inode *ip;
   uint off;
@@ -14,6 +15,9 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext;   // icache hash chain
+  struct inode *prev;    // LRU list of unreferenced inodes
+  struct inode *next;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
@@ -28,8 +32,9 @@ struct inode {
 // table mapping major device number to
 // device functions
 struct devsw {
-  int (*read)(struct inode*, char*, int);
+  int (*read)(struct inode*, char*, int, int);  // last is nonblock
   int (*write)(struct inode*, char*, int);
+  int (*poll)(struct inode*, int, void**);  // see filepoll
 };
 
 extern struct devsw devsw[];
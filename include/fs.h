@@ -3,12 +3,25 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+// Block size; a power of two from 512 to 4096, chosen at build
+// time (FSBSIZE in the Makefile) and recorded by mkfs.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
 //                                          free bit map | data blocks]
 //
+// or, with FS_GROUPS, the disk is cut into allocation groups of
+// groupsize blocks, each with its own free map block, inodes and
+// data, so that a file's inode and data can be close together:
+// [ boot block | super block | log | group 0 meta | group 0 data |
+//                                   group 1 meta | group 1 data | ...]
+// where a group's meta is one free map block (covering just that
+// group) followed by the blocks of its ipg inodes. Group g starts
+// at block g*groupsize, except that group 0's meta follows the log.
+//
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
 struct superblock {
@@ -19,8 +32,18 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint opblocks;     // Max # of log blocks any FS op writes (0: MAXOPBLOCKS)
+  uint features;     // FS_* flags
+  uint bsize;        // Block size in bytes (0: 512)
+  uint ngroups;      // Number of allocation groups (FS_GROUPS)
+  uint groupsize;    // Blocks per allocation group (FS_GROUPS)
+  uint ipg;          // Inodes per allocation group (FS_GROUPS)
 };
 
+#define FS_EXTENTS 0x1  // inodes map their blocks with extents
+#define FS_INLINE  0x2  // small files keep their data in the inode
+#define FS_GROUPS  0x4  // disk is divided into allocation groups
+
 #define NDIRECT 12
 #define NINDIRECT (BSIZE / sizeof(uint))
 #define MAXFILE (NDIRECT + NINDIRECT)
@@ -35,17 +58,55 @@ struct dinode {
   uint addrs[NDIRECT+1];   // Data block addresses
 };
 
+// On a file system with FS_EXTENTS, an inode's addrs[] instead
+// holds the root of a tree of extents, each a run of contiguous
+// disk blocks. Every node is an exthdr followed by its entries,
+// sorted by lbn. In a leaf (depth 0) the entries are extents; in
+// an interior node each entry points to a child node, which
+// covers file blocks from its lbn up to the next entry's lbn.
+// Files only grow at the end, so the tree is only ever appended to.
+struct exthdr {
+  ushort n;      // Number of entries in use
+  ushort depth;  // Levels below this node
+};
+
+struct extent {
+  uint lbn;      // First file block covered
+  uint start;    // First disk block, or block of child node
+  uint len;      // Number of blocks (leaf entries only)
+};
+
+#define EXT(h)    ((struct extent*)((struct exthdr*)(h) + 1))
+#define NEXTROOT  ((sizeof(uint)*(NDIRECT+1) - sizeof(struct exthdr)) / sizeof(struct extent))
+#define NEXTBLK   ((BSIZE - sizeof(struct exthdr)) / sizeof(struct extent))
+#define EXTMAXDEPTH 3
+
+// On a file system with FS_INLINE, a regular file of at most
+// INLINESZ bytes keeps its data in addrs[] instead of a block.
+#define INLINESZ  (sizeof(uint)*(NDIRECT+1))
+
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
-// Block containing inode i
-#define IBLOCK(i, sb)     ((i) / IPB + sb.inodestart)
-
 // Bitmap bits per block
 #define BPB           (BSIZE*8)
 
-// Block of free map containing bit for block b
-#define BBLOCK(b, sb) (b/BPB + sb.bmapstart)
+// Smallest allocation group, in blocks
+#define MINGROUP      128
+
+// First block of allocation group g's free map and inodes,
+// and its first data block
+#define GSTART(g, sb) ((g) ? (g)*(sb).groupsize : (sb).bmapstart)
+#define GDATA(g, sb)  (GSTART(g, sb) + 1 + (sb).ipg/IPB)
+
+// Block containing inode i
+#define IBLOCK(i, sb) (((sb).features & FS_GROUPS) ? \
+  GSTART((i)/(sb).ipg, sb) + 1 + (i)%(sb).ipg/IPB : (i)/IPB + (sb).inodestart)
+
+// Block of free map containing bit for block b, and that bit
+#define BBLOCK(b, sb) (((sb).features & FS_GROUPS) ? \
+  GSTART((b)/(sb).groupsize, sb) : (b)/BPB + (sb).bmapstart)
+#define BBIT(b, sb)   (((sb).features & FS_GROUPS) ? (b)%(sb).groupsize : (b)%BPB)
 
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
@@ -55,3 +116,41 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// getdents() with DENT_STAT returns each entry with the type,
+// link count and size of its inode, saving a stat() per entry.
+#define DENT_STAT 1
+
+struct direntplus {
+  ushort inum;
+  char name[DIRSIZ];
+  short type;
+  short nlink;
+  uint size;
+};
+
+// A directory that outgrows its first block becomes hashed:
+// block 0 keeps "." and "..", followed by the root of an index
+// mapping name hashes to leaf blocks of ordinary dirents. A full
+// root moves its entries into an index node, making a second
+// level. Every index structure starts with a zero ushort and
+// entries are 8 bytes, so each dirent-sized slot of an index
+// reads as an unused dirent.
+#define DX_MAGIC 0xd1d1
+
+struct dxhdr {
+  ushort zero;
+  ushort magic;   // DX_MAGIC
+  ushort depth;   // Index levels below this one (root only)
+  ushort n;       // Number of entries in use
+};
+
+struct dxentry {
+  ushort zero;
+  ushort block;   // File block of leaf or index node
+  uint hash;      // Lowest name hash it holds
+};
+
+#define DXROOT   (2*sizeof(struct dirent))  // offset of root in block 0
+#define NDXROOT  ((BSIZE - DXROOT - sizeof(struct dxhdr)) / sizeof(struct dxentry))
+#define NDXNODE  ((BSIZE - sizeof(struct dxhdr)) / sizeof(struct dxentry))
+
@@ -0,0 +1,40 @@
+// ioring_setup() and ioring_enter(): queue reads and writes of
+// files in a ring in the process's own memory, and collect
+// their results from a second ring, many per system call.
+
+#define IORING_OP_READ   1   // pread(fd, buf, n, off)
+#define IORING_OP_WRITE  2   // pwrite(fd, buf, n, off)
+
+#define IORING_MAX  256      // most entries in a ring
+
+// A queued request.
+struct iosqe {
+  int op;
+  int fd;
+  char *buf;
+  int n;
+  uint off;
+  uint user;    // Passed back in the request's iocqe
+};
+
+// A finished request.
+struct iocqe {
+  uint user;
+  int res;      // What pread() or pwrite() would have returned
+};
+
+// The process adds requests at sq[sqtail % nentries] and
+// advances sqtail; the kernel takes them from sqhead. The kernel
+// adds results at cq[cqtail % nentries] and advances cqtail; the
+// process takes them from cqhead. The two rings follow the
+// header in memory; IORING_SIZE(n) bytes hold one of n entries.
+struct ioring {
+  uint sqhead, sqtail;
+  uint cqhead, cqtail;
+  uint nentries;   // A power of 2, set by ioring_setup()
+};
+
+#define IORING_SQ(r) ((struct iosqe*)((r) + 1))
+#define IORING_CQ(r) ((struct iocqe*)(IORING_SQ(r) + (r)->nentries))
+#define IORING_SIZE(n) \
+  (sizeof(struct ioring) + (n) * (sizeof(struct iosqe) + sizeof(struct iocqe)))
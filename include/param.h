@@ -3,12 +3,16 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE       50  // i-nodes cached before unused ones are recycled
+#define NDENTRY     256  // name cache entries
 #define NDEV         10  // maximum major device number
+#define PIPEPAGES     4  // pages in each pipe's buffer
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define MAXOPBLOCKS  10  // default max # of blocks any FS op writes
+#define LOGSIZE      (MAXOPBLOCKS*3)  // default blocks in on-disk log
+#define MAXLOGSIZE   126  // max data blocks in on-disk log (header fits a block)
+#define LOGORDERED   1  // write file data in place, log only metadata
+#define NBUF         (MAXLOGSIZE+MAXOPBLOCKS*3)  // size of disk block cache
 #define FSSIZE       4000  // size of file system in blocks
 
@@ -0,0 +1,27 @@
+// PCI configuration space.
+
+struct pcidev {
+  uint bus;
+  uint dev;
+  uint func;
+  ushort vendor;
+  ushort device;
+};
+
+// Configuration space registers (byte offsets).
+#define PCI_ID          0x00  // device id << 16 | vendor id
+#define PCI_COMMAND     0x04  // status << 16 | command
+#define PCI_CLASS       0x08  // class, subclass, prog if, revision
+#define PCI_HEADER      0x0C  // header type in bits 16-23
+#define PCI_BAR(n)      (0x10 + 4*(n))
+#define PCI_INTR        0x3C  // interrupt line in bits 0-7
+
+// PCI_COMMAND bits
+#define PCI_CMD_IO      0x0001  // respond to I/O space accesses
+#define PCI_CMD_MEM     0x0002  // respond to memory space accesses
+#define PCI_CMD_MASTER  0x0004  // may act as bus master
+
+#define PCI_BAR_IO      0x1     // BAR is in I/O space
+
+#define PCI_CLASS_STORAGE  0x01
+#define PCI_SUBCLASS_IDE   0x01
@@ -0,0 +1,12 @@
+// poll(): wait until some of a set of file descriptors are ready.
+
+#define POLLIN   0x001   // Data to read (or end of file)
+#define POLLOUT  0x004   // Room to write
+#define POLLHUP  0x010   // Other end of the pipe closed
+#define POLLNVAL 0x020   // fd is not open
+
+struct pollfd {
+  int fd;         // File descriptor, or negative to skip
+  short events;   // Conditions to wait for
+  short revents;  // Conditions that hold, set by poll()
+};
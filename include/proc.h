@@ -43,9 +43,15 @@ struct proc {
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
   struct trapframe *tf;        // Trap frame for current syscall
+  uint sysargs;                // User address of its arguments
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  void **pchans;               // Channels being polled (see pollstart)
+  int npchans;
+  int pwoken;                  // Woken on one of pchans since pollstart
   int killed;                  // If non-zero, have been killed
+  struct ioring *ioring;       // Ring set up by ioring_setup(), or 0
+  uint ioringn;                // Its number of entries
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
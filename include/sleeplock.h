@@ -2,6 +2,8 @@
 struct sleeplock {
   uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
+  int readers;       // Processes holding it shared
+  int writers;       // Processes waiting to hold it exclusively
   
   // For debugging:
   char *name;        // Name of lock.
@@ -1,9 +1,22 @@
 #ifndef STRUCTIO_H
 #define STRUCTIO_H
 
+#include "uio.h"
+
+#define STRUCT_NIOV  IOV_MAX  // pieces of a record held before writing
+#define STRUCT_BUFSZ 64       // bytes of escapes and numbers held
+
+// A record is gathered piece by piece and written with one
+// writev() by struct_end(), or sooner if it outgrows the
+// writer. Strings passed to the struct_field functions are not
+// copied, so they must stay valid until then.
 struct struct_writer {
   int fd;
   int need_comma;
+  int niov;
+  int nbuf;
+  struct iovec iov[STRUCT_NIOV];
+  char buf[STRUCT_BUFSZ];
 };
 
 void struct_begin(struct struct_writer *w, int fd);
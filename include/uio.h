@@ -0,0 +1,12 @@
+#ifndef UIO_H
+#define UIO_H
+
+// One buffer of a readv() or writev().
+struct iovec {
+  void *iov_base;
+  int iov_len;
+};
+
+#define IOV_MAX 32  // most buffers per call
+
+#endif // UIO_H
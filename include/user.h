@@ -1,5 +1,9 @@
 struct stat;
 struct rtcdate;
+struct pollfd;
+struct iovec;
+struct ioring;
+struct sysop;
 
 // system calls
 int fork(void);
@@ -23,6 +27,18 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int poll(struct pollfd*, int, int);
+int fcntl(int, int, int);
+int lseek(int, int, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int readv(int, const struct iovec*, int);
+int writev(int, const struct iovec*, int);
+int getdents(int, void*, int, int);
+int splice(int, int, int);
+int ioring_setup(struct ioring*, int);
+int ioring_enter(int);
+int batch(struct sysop*, int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -0,0 +1,80 @@
+// virtio device definitions, for the legacy PCI interface.
+// See the virtio 1.0 spec, "Legacy Interfaces".
+
+#define VIRTIO_VENDOR         0x1AF4
+#define VIRTIO_DEV_BLK        0x1001  // transitional block device
+
+// Legacy registers, relative to the I/O space in BAR0.
+#define VIRTIO_HOST_FEATURES  0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN      0x08  // physical page of the queue
+#define VIRTIO_QUEUE_SIZE     0x0C
+#define VIRTIO_QUEUE_SEL      0x0E
+#define VIRTIO_QUEUE_NOTIFY   0x10
+#define VIRTIO_STATUS         0x12
+#define VIRTIO_ISR            0x13
+#define VIRTIO_CONFIG         0x14  // device config, without MSI-X
+
+// VIRTIO_STATUS bits
+#define VIRTIO_ST_ACKNOWLEDGE 1
+#define VIRTIO_ST_DRIVER      2
+#define VIRTIO_ST_DRIVER_OK   4
+#define VIRTIO_ST_FAILED      128
+
+// Largest queue the driver supports; the legacy interface makes
+// the driver use whatever size the device reports.
+#define VIRTIO_MAXQ           1024
+
+// Legacy virtqueues align the used ring to a page.
+#define VIRTIO_ALIGN          4096
+
+// A single descriptor, from the spec.
+struct virtq_desc {
+  uint addr;       // physical address, low 32 bits
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VRING_DESC_F_NEXT     1  // chained with another descriptor
+#define VRING_DESC_F_WRITE    2  // device writes (vs read)
+
+// The (entire) avail ring, from the spec.
+struct virtq_avail {
+  ushort flags;
+  ushort idx;      // driver will write ring[idx] next
+  ushort ring[];   // descriptor numbers of chain heads
+};
+
+// One entry in the "used" ring, with which the device tells
+// the driver about completed requests.
+struct virtq_used_elem {
+  uint id;         // index of start of completed descriptor chain
+  uint len;
+};
+
+struct virtq_used {
+  ushort flags;
+  ushort idx;      // device increments when it adds a ring[] entry
+  struct virtq_used_elem ring[];
+};
+
+// Bytes of memory a legacy queue of qsz entries occupies.
+#define VIRTQ_AVAIL_OFF(qsz)  (16*(qsz))
+#define VIRTQ_USED_OFF(qsz) \
+  ((VIRTQ_AVAIL_OFF(qsz) + 6 + 2*(qsz) + VIRTIO_ALIGN - 1) & ~(VIRTIO_ALIGN - 1))
+#define VIRTQ_SIZE(qsz) \
+  ((VIRTQ_USED_OFF(qsz) + 6 + 8*(qsz) + VIRTIO_ALIGN - 1) & ~(VIRTIO_ALIGN - 1))
+
+// The format of the first descriptor in a disk request.
+// To be followed by a descriptor for the block data and
+// a one-byte descriptor for the device to write the status.
+#define VIRTIO_BLK_T_IN       0  // read the disk
+#define VIRTIO_BLK_T_OUT      1  // write the disk
+
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint sector;     // low 32 bits of the 64-bit sector number
+  uint sectorhi;
+};
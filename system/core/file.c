@@ -5,10 +5,16 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "proc.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "poll.h"
+#include "fcntl.h"
+#include "uio.h"
 
 struct devsw devsw[NDEV];
 struct {
@@ -84,74 +90,410 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
-    iunlock(f->ip);
+    iunlockshared(f->ip);
     return 0;
   }
   return -1;
 }
 
+// Return which of the poll events (see poll.h) hold for f, and
+// set chans[0] and chans[1] to channels that get a wakeup when
+// that may change, or 0.
+int
+filepoll(struct file *f, int events, void **chans)
+{
+  struct inode *ip;
+
+  chans[0] = chans[1] = 0;
+  if(!f->readable)
+    events &= ~POLLIN;
+  if(!f->writable)
+    events &= ~POLLOUT;
+  if(f->type == FD_PIPE)
+    return pipepoll(f->pipe, events, chans);
+  if(f->type == FD_INODE){
+    ip = f->ip;
+    if(ip->type == T_DEV && ip->major >= 0 && ip->major < NDEV &&
+       devsw[ip->major].poll)
+      return devsw[ip->major].poll(ip, events, chans);
+    // Files never make the caller wait.
+    return events & (POLLIN|POLLOUT);
+  }
+  panic("filepoll");
+}
+
+// Read from device inode ip, which is locked. Unlike readi(),
+// this tells the device whether the read may wait.
+static int
+devread(struct inode *ip, char *addr, int n, int nonblock)
+{
+  if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+    return -1;
+  return devsw[ip->major].read(ip, addr, n, nonblock);
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
+  int r, shared;
 
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+    return piperead(f->pipe, addr, n, f->nonblock);
   if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    // Readers of the same file can share its lock, but f->off
+    // needs it exclusively if f itself is shared, and devices
+    // may drop the lock while they wait.
+    shared = f->ref == 1 && f->ip->type != T_DEV;
+    if(shared)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
+    if(f->ip->type == T_DEV)
+      r = devread(f->ip, addr, n, f->nonblock);
+    else if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
-    iunlock(f->ip);
+    if(shared)
+      iunlockshared(f->ip);
+    else
+      iunlock(f->ip);
     return r;
   }
   panic("fileread");
 }
 
+// Read from f into the cnt buffers of iov in turn, as one
+// read: a pipe or device fills later buffers only with what it
+// has without waiting, and a short read ends it.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, r, tot, shared;
+
+  if(f->readable == 0)
+    return -1;
+  tot = 0;
+  if(f->type == FD_PIPE){
+    for(i = 0; i < cnt; i++){
+      // A ring page piperead() maps may still be shared with the
+      // writer, and mapped copy-on-write where a later buffer
+      // lies: break that again before reading into it.
+      if(i > 0 && uvmwritable(myproc()->pgdir, (uint)iov[i].iov_base,
+                              iov[i].iov_len) < 0)
+        return tot > 0 ? tot : -1;
+      r = piperead(f->pipe, iov[i].iov_base, iov[i].iov_len,
+                   f->nonblock || tot > 0);
+      if(r < 0)
+        return tot > 0 ? tot : r;
+      tot += r;
+      if(r < iov[i].iov_len)
+        break;
+    }
+    return tot;
+  }
+  if(f->type == FD_INODE){
+    // Locked as in fileread().
+    shared = f->ref == 1 && f->ip->type != T_DEV;
+    if(shared)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
+    for(i = 0; i < cnt; i++){
+      if(f->ip->type == T_DEV)
+        r = devread(f->ip, iov[i].iov_base, iov[i].iov_len,
+                    f->nonblock || tot > 0);
+      else if((r = readi(f->ip, iov[i].iov_base, f->off, iov[i].iov_len)) > 0)
+        f->off += r;
+      if(r < 0){
+        if(tot == 0)
+          tot = r;
+        break;
+      }
+      tot += r;
+      if(r < iov[i].iov_len)
+        break;
+    }
+    if(shared)
+      iunlockshared(f->ip);
+    else
+      iunlock(f->ip);
+    return tot;
+  }
+  panic("filereadv");
+}
+
+// Read from inode file f at offset off, leaving f->off alone.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  int r;
+
+  if(f->readable == 0 || f->type != FD_INODE || f->ip->type == T_DEV)
+    return -1;
+  ilockshared(f->ip);
+  r = off >= f->ip->size ? 0 : readi(f->ip, addr, off, n);
+  iunlockshared(f->ip);
+  return r;
+}
+
 //PAGEBREAK!
+// Write n bytes from addr to inode file f at offset *off,
+// advancing *off past what was written.
+static int
+inodewrite(struct file *f, char *addr, int n, uint *off)
+{
+  int r;
+
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size; log_datablocks()
+  // knows how much of the log a data block costs.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = log_datablocks() * BSIZE;
+  int i = 0;
+  while(i < n){
+    int n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+      *off += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    if(r != n1)
+      panic("short filewrite");
+    i += r;
+  }
+  return i == n ? n : -1;
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
+    return pipewrite(f->pipe, addr, n, f->nonblock);
+  if(f->type == FD_INODE)
+    return inodewrite(f, addr, n, &f->off);
+  panic("filewrite");
+}
+
+// Write the cnt buffers of iov to f in turn. For an inode,
+// as many buffers as fit in a log transaction go in one, so a
+// record built from many small pieces costs one transaction.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, r, n1, done, room, max, tot;
 
+  if(f->writable == 0)
+    return -1;
+  tot = 0;
+  if(f->type == FD_PIPE){
+    for(i = 0; i < cnt; i++){
+      r = pipewrite(f->pipe, iov[i].iov_base, iov[i].iov_len, f->nonblock);
+      if(r < 0)
+        return tot > 0 ? tot : r;
+      tot += r;
+      if(r < iov[i].iov_len)
+        break;
+    }
+    return tot;
+  }
+  if(f->type == FD_INODE){
+    // The writes are contiguous, so max bytes of them touch no
+    // more blocks than one write of max bytes (see inodewrite).
+    max = log_datablocks() * BSIZE;
+    i = done = 0;
+    r = 0;
+    while(i < cnt && r >= 0){
       begin_op();
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+      for(room = max; i < cnt && room > 0; room -= n1){
+        n1 = iov[i].iov_len - done;
+        if(n1 > room)
+          n1 = room;
+        if((r = writei(f->ip, (char*)iov[i].iov_base + done, f->off, n1)) < 0)
+          break;
+        if(r != n1)
+          panic("short filewritev");
         f->off += r;
+        tot += r;
+        if((done += n1) == iov[i].iov_len){
+          i++;
+          done = 0;
+        }
+      }
       iunlock(f->ip);
       end_op();
+    }
+    return r < 0 ? -1 : tot;
+  }
+  panic("filewritev");
+}
+
+// Pieces of a splice(); see readiout() and writeiin().
+static int
+topipe(void *p, char *src, int n)
+{
+  int r;
+
+  r = pipewrite((struct pipe*)p, src, n, 1);
+  return r == EWOULDBLOCK ? 0 : r;
+}
+
+static int
+todev(void *ip, char *src, int n)
+{
+  int r;
+
+  ilock((struct inode*)ip);
+  r = writei((struct inode*)ip, src, 0, n);
+  iunlock((struct inode*)ip);
+  return r;
+}
+
+static int
+frompipe(void *p, char *dst, int n)
+{
+  int r;
+
+  r = piperead((struct pipe*)p, dst, n, 1);
+  return r == EWOULDBLOCK ? 0 : r;
+}
 
+// Move up to n bytes from fin to fout inside the kernel: from
+// a file to a pipe or device straight out of the buffer cache,
+// or from a pipe straight into a file's blocks. Waits only
+// while the pipe is full or empty, never holding the inode.
+// Returns the bytes moved, 0 at the end of fin.
+int
+filesplice(struct file *fin, struct file *fout, int n)
+{
+  int tot, m, r, eof, shared, max;
+
+  if(fin->readable == 0 || fout->writable == 0 || n < 0)
+    return -1;
+  tot = 0;
+
+  if(fin->type == FD_INODE && fin->ip->type == T_FILE &&
+     (fout->type == FD_PIPE || fout->ip->type == T_DEV)){
+    while(tot < n){
+      m = n - tot;
+      if(fout->type == FD_PIPE){
+        // A closed read end is an error, as for write().
+        if((r = pipewait(fout->pipe, 1)) <= 0)
+          break;
+        if(m > r)
+          m = r;
+      }
+      // Locked as in fileread().
+      shared = fin->ref == 1;
+      if(shared)
+        ilockshared(fin->ip);
+      else
+        ilock(fin->ip);
+      if(fout->type == FD_PIPE)
+        r = readiout(fin->ip, fin->off, m, topipe, fout->pipe);
+      else
+        r = readiout(fin->ip, fin->off, m, todev, fout->ip);
+      if(r > 0)
+        fin->off += r;
+      eof = fin->off >= fin->ip->size;
+      if(shared)
+        iunlockshared(fin->ip);
+      else
+        iunlock(fin->ip);
       if(r < 0)
         break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+      tot += r;
+      if(eof)
+        return tot;
     }
-    return i == n ? n : -1;
+    return tot > 0 || n == 0 ? tot : -1;
   }
-  panic("filewrite");
+
+  if(fin->type == FD_PIPE && fout->type == FD_INODE &&
+     fout->ip->type == T_FILE){
+    max = log_datablocks() * BSIZE;
+    while(tot < n){
+      if((r = pipewait(fin->pipe, 0)) < 0)
+        return tot > 0 ? tot : -1;
+      if(r == 0)
+        break;
+      m = n - tot;
+      if(m > r)
+        m = r;
+      if(m > max)
+        m = max;
+      begin_op();
+      ilock(fout->ip);
+      if((r = writeiin(fout->ip, fout->off, m, frompipe, fin->pipe)) > 0)
+        fout->off += r;
+      iunlock(fout->ip);
+      end_op();
+      if(r < 0)
+        return tot > 0 ? tot : -1;
+      tot += r;
+    }
+    return tot;
+  }
+
+  return -1;
+}
+
+// Write to inode file f at offset off, leaving f->off alone.
+// Files have no holes, so off can be at most the file's size.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  if(f->writable == 0 || f->type != FD_INODE || f->ip->type == T_DEV)
+    return -1;
+  return inodewrite(f, addr, n, &off);
+}
+
+// Set f's offset to off from whence (SEEK_SET, SEEK_CUR or
+// SEEK_END). The result must be within the file, since files
+// have no holes. Returns the new offset.
+int
+fileseek(struct file *f, int off, int whence)
+{
+  uint base;
+  int r;
+
+  if(f->type != FD_INODE || f->ip->type == T_DEV)
+    return -1;
+  ilock(f->ip);
+  switch(whence){
+  case SEEK_SET:
+    base = 0;
+    break;
+  case SEEK_CUR:
+    base = f->off;
+    break;
+  case SEEK_END:
+    base = f->ip->size;
+    break;
+  default:
+    iunlock(f->ip);
+    return -1;
+  }
+  if((off < 0 && -off > base) || (off > 0 && base + off > f->ip->size))
+    r = -1;
+  else
+    r = f->off = base + off;
+  iunlock(f->ip);
+  return r;
 }
 
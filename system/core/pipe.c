@@ -7,22 +7,49 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "poll.h"
+#include "fcntl.h"
 
-#define PIPESIZE 512
+// The buffer is a ring of PIPEPAGES pages from kalloc(), which
+// need not be contiguous, so data is copied a page at a time.
+//
+// When a write starts on a page boundary of both the ring and
+// the writer's memory and covers the whole page, the writer's
+// page itself goes into the ring, made copy-on-write (see
+// uvmshare()), instead of being copied. Likewise a read of a
+// whole ring page into a whole page of the reader's memory
+// maps the ring page there (see uvmremap()). So a page-aligned
+// transfer copies nothing unless one side writes to the page
+// while the other still has it. A ring slot whose page has
+// been passed on is 0, or shared, until a write gives it a
+// fresh one.
+#define PIPESIZE (PIPEPAGES*PGSIZE)
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *data[PIPEPAGES];
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
 };
 
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++)
+    if(p->data[i])
+      kfree(p->data[i]);
+  kfree((char*)p);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
   struct pipe *p;
+  int i;
 
   p = 0;
   *f0 = *f1 = 0;
@@ -30,6 +57,11 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  for(i = 0; i < PIPEPAGES; i++)
+    p->data[i] = 0;
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+      goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -38,17 +70,19 @@ pipealloc(struct file **f0, struct file **f1)
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
+  (*f0)->nonblock = 0;
   (*f0)->pipe = p;
   (*f1)->type = FD_PIPE;
   (*f1)->readable = 0;
   (*f1)->writable = 1;
+  (*f1)->nonblock = 0;
   (*f1)->pipe = p;
   return 0;
 
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    pipefree(p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,38 +103,183 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    pipefree(p);
   } else
     release(&p->lock);
 }
 
+// Wait until a nonblocking read (writing == 0) or write of p
+// would not return EWOULDBLOCK, for splice(). Returns how many
+// bytes there are to read or room there is to write, 0 if the
+// other end is closed (and, for reading, the pipe is empty), or
+// -1 if the caller was killed.
+int
+pipewait(struct pipe *p, int writing)
+{
+  int r;
+
+  acquire(&p->lock);
+  for(;;){
+    if(myproc()->killed){
+      r = -1;
+      break;
+    }
+    if(writing){
+      if(!p->readopen || p->nwrite != p->nread + PIPESIZE){
+        r = p->readopen ? PIPESIZE - (p->nwrite - p->nread) : 0;
+        break;
+      }
+      sleep(&p->nwrite, &p->lock);
+    } else {
+      if(p->nwrite != p->nread || !p->writeopen){
+        r = p->nwrite - p->nread;
+        break;
+      }
+      sleep(&p->nread, &p->lock);
+    }
+  }
+  release(&p->lock);
+  return r;
+}
+
+// Return which of events hold for p, for poll(). Readers and
+// writers are woken on &p->nread and &p->nwrite, and so are
+// pollers waiting for them.
+int
+pipepoll(struct pipe *p, int events, void **chans)
+{
+  int r;
+
+  r = 0;
+  acquire(&p->lock);
+  if(events & POLLIN){
+    chans[0] = &p->nread;
+    if(p->nread != p->nwrite)
+      r |= POLLIN;
+    if(!p->writeopen)
+      r |= POLLIN|POLLHUP;
+  }
+  if(events & POLLOUT){
+    chans[1] = &p->nwrite;
+    if(p->nwrite != p->nread + PIPESIZE)
+      r |= POLLOUT;
+    if(!p->readopen)
+      r |= POLLHUP;
+  }
+  release(&p->lock);
+  return r;
+}
+
 //PAGEBREAK: 40
+// Copy as much of addr[0..n) into the pipe as fits, stopping
+// at the end of a page of the ring, or pass the page at addr.
+// Returns the bytes added, or -1 if out of memory.
+static int
+pipeput(struct pipe *p, char *addr, int n)
+{
+  uint off, m, space;
+  char **pg, *page;
+
+  off = p->nwrite % PIPESIZE;
+  space = PIPESIZE - (p->nwrite - p->nread);
+  pg = &p->data[off / PGSIZE];
+  if(off % PGSIZE == 0 && (uint)addr % PGSIZE == 0 && n >= PGSIZE &&
+     space >= PGSIZE && (page = uvmshare(myproc()->pgdir, addr)) != 0){
+    if(*pg)
+      kfree(*pg);
+    *pg = page;
+    p->nwrite += PGSIZE;
+    return PGSIZE;
+  }
+
+  // Don't write through to a page some process still has.
+  if(*pg == 0 || krefs(*pg) > 1){
+    if((page = kalloc()) == 0)
+      return -1;
+    if(*pg){
+      memmove(page, *pg, off % PGSIZE);
+      kfree(*pg);
+    }
+    *pg = page;
+  }
+  m = PGSIZE - off % PGSIZE;
+  if(m > space)
+    m = space;
+  if(m > n)
+    m = n;
+  memmove(*pg + off % PGSIZE, addr, m);
+  p->nwrite += m;
+  return m;
+}
+
+// Copy up to n bytes out of the pipe into addr, stopping at
+// the end of a page of the ring, or map a whole ring page at
+// addr. Returns the bytes taken.
+static int
+pipeget(struct pipe *p, char *addr, int n)
+{
+  uint off, m;
+  char **pg;
+
+  off = p->nread % PIPESIZE;
+  pg = &p->data[off / PGSIZE];
+  if(off % PGSIZE == 0 && (uint)addr % PGSIZE == 0 && n >= PGSIZE &&
+     p->nwrite - p->nread >= PGSIZE &&
+     uvmremap(myproc()->pgdir, addr, *pg) == 0){
+    *pg = 0;
+    p->nread += PGSIZE;
+    return PGSIZE;
+  }
+
+  m = PGSIZE - off % PGSIZE;
+  if(m > p->nwrite - p->nread)
+    m = p->nwrite - p->nread;
+  if(m > n)
+    m = n;
+  memmove(addr, *pg + off % PGSIZE, m);
+  p->nread += m;
+  return m;
+}
+
+// Readers only sleep on an empty pipe and writers on a full
+// one, so each side wakes the other only when it changes
+// that: a write to an empty pipe, a read from a full one.
+// If nonblock, they return what they got done instead of
+// sleeping, or EWOULDBLOCK if that is nothing.
 int
-pipewrite(struct pipe *p, char *addr, int n)
+pipewrite(struct pipe *p, char *addr, int n, int nonblock)
 {
-  int i;
+  int i, m;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
+  for(i = 0; i < n; ){
     while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
       }
-      wakeup(&p->nread);
+      if(nonblock){
+        release(&p->lock);
+        return i > 0 ? i : EWOULDBLOCK;
+      }
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    if(p->nwrite == p->nread)
+      wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+    if((m = pipeput(p, addr + i, n - i)) < 0){
+      release(&p->lock);
+      return -1;
+    }
+    i += m;
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
 
 int
-piperead(struct pipe *p, char *addr, int n)
+piperead(struct pipe *p, char *addr, int n, int nonblock)
 {
-  int i;
+  int i, m;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -108,14 +287,18 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    if(nonblock){
+      release(&p->lock);
+      return EWOULDBLOCK;
+    }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
+  if(p->nwrite == p->nread + PIPESIZE && n > 0)
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  for(i = 0; i < n; i += m){  //DOC: piperead-copy
+    if((m = pipeget(p, addr + i, n - i)) == 0)
       break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
@@ -208,6 +208,10 @@ fork(void)
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
 
+  // The child's copy of memory holds a copy of the ring.
+  np->ioring = curproc->ioring;
+  np->ioringn = curproc->ioringn;
+
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
   pid = np->pid;
@@ -458,10 +462,20 @@ static void
 wakeup1(void *chan)
 {
   struct proc *p;
+  int i;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->state == SLEEPING && p->chan == chan)
       p->state = RUNNABLE;
+    for(i = 0; i < p->npchans; i++){
+      if(p->pchans[i] == chan){
+        p->pwoken = 1;
+        if(p->state == SLEEPING && p->chan == p)
+          p->state = RUNNABLE;
+        break;
+      }
+    }
+  }
 }
 
 // Wake up all processes sleeping on chan.
@@ -473,6 +487,43 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Waiting on many channels at once, for poll(). A wakeup on
+// any of the n channels in chans counts for the current
+// process from pollstart() until pollend() or the next
+// pollstart(). Call pollstart() before checking the conditions
+// the channels stand for, and pollwait() if none hold, so that
+// a wakeup in between is not missed.
+void
+pollstart(void **chans, int n)
+{
+  struct proc *p = myproc();
+
+  acquire(&ptable.lock);
+  p->pchans = chans;
+  p->npchans = n;
+  p->pwoken = 0;
+  release(&ptable.lock);
+}
+
+// Sleep until a wakeup on one of the polled channels, unless
+// there has been one since pollstart().
+void
+pollwait(void)
+{
+  struct proc *p = myproc();
+
+  acquire(&ptable.lock);
+  if(!p->pwoken && !p->killed)
+    sleep(p, &ptable.lock);
+  release(&ptable.lock);
+}
+
+void
+pollend(void)
+{
+  pollstart(0, 0);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -6,12 +6,15 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "batch.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
+// syscall() records where the arguments are in sysargs, which
+// batch() points at the arguments of each call it makes.
 
 // Fetch the int at addr from the current process.
 int
@@ -49,7 +52,7 @@ fetchstr(uint addr, char **pp)
 int
 argint(int n, int *ip)
 {
-  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+  return fetchint(myproc()->sysargs + 4*n, ip);
 }
 
 // Fetch the nth word-sized system call argument as a pointer
@@ -69,6 +72,17 @@ argptr(int n, char **pp, int size)
   return 0;
 }
 
+// Like argptr(), for a block the system call will write to.
+// Breaks copy-on-write there first, so that running out of
+// memory fails the call rather than the kernel's write.
+int
+argoutptr(int n, char **pp, int size)
+{
+  if(argptr(n, pp, size) < 0)
+    return -1;
+  return uvmwritable(myproc()->pgdir, (uint)*pp, size);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -103,6 +117,18 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_poll(void);
+extern int sys_fcntl(void);
+extern int sys_lseek(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_getdents(void);
+extern int sys_splice(void);
+extern int sys_ioring_setup(void);
+extern int sys_ioring_enter(void);
+extern int sys_batch(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -126,6 +152,18 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_poll]    sys_poll,
+[SYS_fcntl]   sys_fcntl,
+[SYS_lseek]   sys_lseek,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_getdents] sys_getdents,
+[SYS_splice]  sys_splice,
+[SYS_ioring_setup] sys_ioring_setup,
+[SYS_ioring_enter] sys_ioring_enter,
+[SYS_batch]   sys_batch,
 };
 
 void
@@ -135,6 +173,7 @@ syscall(void)
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  curproc->sysargs = curproc->tf->esp + 4;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
   } else {
@@ -143,3 +182,66 @@ syscall(void)
     curproc->tf->eax = -1;
   }
 }
+
+// Make the system calls ops[0..n) in turn, all in one trap.
+// Each call's result goes in its ret. An argument marked in a
+// call's link names an earlier call and is passed as that
+// call's result, so that an open() can be followed by fstat()
+// and close() of the file it opened. The call sees the result
+// in its args, but the index is put back afterwards, so the
+// same ops can be made again. With BATCH_ABORT, stops
+// after a call that fails. Returns how many calls were made.
+int
+sys_batch(void)
+{
+  struct proc *curproc = myproc();
+  struct sysop *ops, *op;
+  int n, flags, i, k, num, ret, link, index[BATCH_MAXARG];
+
+  if(argint(1, &n) < 0 || n < 0 || n > BATCH_MAX ||
+     argoutptr(0, (char**)&ops, n*sizeof(*ops)) < 0 || argint(2, &flags) < 0)
+    return -1;
+  for(i = 0; i < n; i++){
+    // An earlier call may have shrunk the process under ops,
+    // or the process may have been killed.
+    op = &ops[i];
+    if((uint)(op + 1) > curproc->sz || curproc->killed)
+      break;
+    // Or shared the page holding op (see uvmshare()).
+    if(uvmwritable(curproc->pgdir, (uint)op, sizeof(*op)) < 0)
+      return -1;
+    num = op->num;
+    ret = 0;
+    // Calls that replace or copy the process would return
+    // somewhere other than here.
+    if(num <= 0 || num >= NELEM(syscalls) || syscalls[num] == 0 ||
+       num == SYS_fork || num == SYS_exit || num == SYS_exec ||
+       num == SYS_batch)
+      ret = -1;
+    link = op->link;
+    for(k = 0; k < BATCH_MAXARG; k++)
+      index[k] = op->args[k];
+    for(k = 0; k < BATCH_MAXARG && ret == 0; k++){
+      if(link & (1 << k)){
+        if(index[k] < 0 || index[k] >= i)
+          ret = -1;
+        else
+          op->args[k] = ops[index[k]].ret;
+      }
+    }
+    if(ret == 0){
+      curproc->sysargs = (uint)op->args;
+      ret = syscalls[num]();
+      if((uint)(op + 1) > curproc->sz ||
+         uvmwritable(curproc->pgdir, (uint)op, sizeof(*op)) < 0)
+        return -1;
+    }
+    for(k = 0; k < BATCH_MAXARG; k++)
+      if(link & (1 << k))
+        op->args[k] = index[k];
+    op->ret = ret;
+    if(ret < 0 && (flags & BATCH_ABORT))
+      return i + 1;
+  }
+  return i;
+}
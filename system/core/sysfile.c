@@ -15,6 +15,9 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "poll.h"
+#include "uio.h"
+#include "ioring.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -73,7 +76,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -90,6 +93,264 @@ sys_write(void)
   return filewrite(f, p, n);
 }
 
+// Fetch the iovec array and count in arguments 1 and 2 into
+// iov, which has room for IOV_MAX, and check that each buffer
+// lies within the process's memory, and with out set, that it
+// can be written as argoutptr() checks. The copy keeps a read
+// into the array itself from changing the buffers midway.
+static int
+argiov(struct iovec *iov, int *pcnt, int out)
+{
+  struct iovec *uiov;
+  uint sz;
+  int i, cnt;
+
+  if(argint(2, &cnt) < 0 || cnt < 0 || cnt > IOV_MAX ||
+     argptr(1, (void*)&uiov, cnt*sizeof(uiov[0])) < 0)
+    return -1;
+  sz = myproc()->sz;
+  for(i = 0; i < cnt; i++){
+    iov[i] = uiov[i];
+    if(iov[i].iov_len < 0 || (uint)iov[i].iov_base > sz ||
+       (uint)iov[i].iov_base + iov[i].iov_len > sz)
+      return -1;
+    if(out && uvmwritable(myproc()->pgdir, (uint)iov[i].iov_base,
+                          iov[i].iov_len) < 0)
+      return -1;
+  }
+  *pcnt = cnt;
+  return 0;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argiov(iov, &cnt, 1) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOV_MAX];
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argiov(iov, &cnt, 0) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
+// Read the entries of directory fd into buf, n bytes long, as
+// whole struct dirents, or struct direntpluses with DENT_STAT,
+// skipping unused ones. Returns the bytes filled; 0 at the end.
+int
+sys_getdents(void)
+{
+  struct file *f;
+  struct dirent de[16];
+  struct inode *ips[16], *ip;
+  struct direntplus *dp;
+  int n, flags, sz, i, m, tot, shared;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, &p, n) < 0 ||
+     argint(3, &flags) < 0)
+    return -1;
+  if(f->type != FD_INODE || !f->readable)
+    return -1;
+  sz = (flags & DENT_STAT) ? sizeof(*dp) : sizeof(de[0]);
+  for(tot = 0; n - tot >= sz; tot += m*sz){
+    m = (n - tot) / sz;
+    if(m > NELEM(de))
+      m = NELEM(de);
+
+    // Locked as in fileread().
+    shared = f->ref == 1;
+    if(shared)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
+    if(f->ip->type == T_DIR)
+      m = dirread(f->ip, &f->off, de, (flags & DENT_STAT) ? ips : 0, m);
+    else
+      m = -1;
+    if(shared)
+      iunlockshared(f->ip);
+    else
+      iunlock(f->ip);
+    if(m < 0)
+      return -1;
+    if(m == 0)
+      break;
+
+    for(i = 0; i < m; i++){
+      if(!(flags & DENT_STAT)){
+        memmove(p + tot + i*sz, &de[i], sz);
+        continue;
+      }
+      dp = (struct direntplus*)(p + tot + i*sz);
+      dp->inum = de[i].inum;
+      memmove(dp->name, de[i].name, DIRSIZ);
+      ip = ips[i];
+      ilockshared(ip);
+      dp->type = ip->type;
+      dp->nlink = ip->nlink;
+      dp->size = ip->size;
+      iunlockshared(ip);
+      begin_op();
+      iput(ip);
+      end_op();
+    }
+  }
+  return tot;
+}
+
+int
+sys_splice(void)
+{
+  struct file *fin, *fout;
+  int n;
+
+  if(argfd(0, 0, &fin) < 0 || argfd(1, 0, &fout) < 0 || argint(2, &n) < 0)
+    return -1;
+  return filesplice(fin, fout, n);
+}
+
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepwrite(f, p, n, off);
+}
+
+// Set up the ring at r, of n entries, for ioring_enter().
+int
+sys_ioring_setup(void)
+{
+  struct ioring *r;
+  int n;
+
+  if(argint(1, &n) < 0 || n <= 0 || n > IORING_MAX || (n & (n-1)) != 0 ||
+     argoutptr(0, (char**)&r, IORING_SIZE(n)) < 0)
+    return -1;
+  r->sqhead = r->sqtail = r->cqhead = r->cqtail = 0;
+  r->nentries = n;
+  myproc()->ioring = r;
+  myproc()->ioringn = n;
+  return 0;
+}
+
+#define IORING_BATCH 16  // requests whose reads start together
+
+// Do up to n of the requests queued in the ring, posting the
+// result of each in the completion ring. The disk reads of a
+// batch of requests are all started before any request is done,
+// so they reach the disk together. Returns how many requests
+// were done: fewer than n if fewer were queued or the completion
+// ring filled up.
+int
+sys_ioring_enter(void)
+{
+  struct proc *p = myproc();
+  struct ioring *r;
+  struct iosqe *sq, *e, sqe[IORING_BATCH];
+  struct iocqe *cq;
+  struct file *f[IORING_BATCH];
+  uint m, mask, room;
+  int n, i, done, res;
+
+  if(argint(0, &n) < 0 || n < 0 || (r = p->ioring) == 0)
+    return -1;
+  // sbrk() may have freed the ring since it was set up.
+  if((uint)r >= p->sz || (uint)r + IORING_SIZE(p->ioringn) > p->sz ||
+     uvmwritable(p->pgdir, (uint)r, IORING_SIZE(p->ioringn)) < 0)
+    return -1;
+  mask = p->ioringn - 1;
+  sq = IORING_SQ(r);
+  cq = (struct iocqe*)(sq + p->ioringn);
+
+  for(done = 0; done < n; done += m){
+    m = n - done;
+    if(m > r->sqtail - r->sqhead)
+      m = r->sqtail - r->sqhead;
+    room = p->ioringn - (r->cqtail - r->cqhead);
+    if(m > room)
+      m = room;
+    if(m > IORING_BATCH)
+      m = IORING_BATCH;
+    if(m == 0)
+      break;
+
+    for(i = 0; i < m; i++){
+      e = &sqe[i];
+      *e = sq[(r->sqhead + i) & mask];
+      f[i] = e->fd >= 0 && e->fd < NOFILE ? p->ofile[e->fd] : 0;
+      if(f[i] && e->op == IORING_OP_READ && f[i]->readable &&
+         f[i]->type == FD_INODE && e->n > 0){
+        ilockshared(f[i]->ip);
+        readiahead(f[i]->ip, e->off, e->n);
+        iunlockshared(f[i]->ip);
+      }
+    }
+
+    for(i = 0; i < m; i++){
+      e = &sqe[i];
+      if(f[i] == 0 || e->n < 0 || (uint)e->buf >= p->sz ||
+         (uint)e->buf + e->n > p->sz ||
+         (e->op == IORING_OP_READ &&
+          uvmwritable(p->pgdir, (uint)e->buf, e->n) < 0))
+        res = -1;
+      else if(e->op == IORING_OP_READ)
+        res = filepread(f[i], e->buf, e->n, e->off);
+      else if(e->op == IORING_OP_WRITE)
+        res = filepwrite(f[i], e->buf, e->n, e->off);
+      else
+        res = -1;
+      cq[r->cqtail & mask].user = e->user;
+      cq[r->cqtail & mask].res = res;
+      r->cqtail++;
+    }
+    r->sqhead += m;
+  }
+  return done;
+}
+
+int
+sys_lseek(void)
+{
+  struct file *f;
+  int off, whence;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &whence) < 0)
+    return -1;
+  return fileseek(f, off, whence);
+}
+
 int
 sys_close(void)
 {
@@ -109,7 +370,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argoutptr(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -185,7 +446,6 @@ int
 sys_unlink(void)
 {
   struct inode *ip, *dp;
-  struct dirent de;
   char name[DIRSIZ], *path;
   uint off;
 
@@ -215,9 +475,7 @@ sys_unlink(void)
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
+  dirunlink(dp, name, off);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -257,7 +515,7 @@ create(char *path, short type, short major, short minor)
     return 0;
   }
 
-  if((ip = ialloc(dp->dev, type)) == 0)
+  if((ip = ialloc(dp->dev, type, dp->inum)) == 0)
     panic("create: ialloc");
 
   ilock(ip);
@@ -271,15 +529,28 @@ create(char *path, short type, short major, short minor)
     iupdate(dp);
     // No ip->nlink++ for ".": avoid cyclic ref count.
     if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
-      panic("create dots");
+      goto bad;
   }
 
+  // A hashed directory can be full, or unable to split a leaf.
   if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
+    goto bad;
 
   iunlockput(dp);
 
   return ip;
+
+bad:
+  // Free the new inode, and anything in it, when iput() drops it.
+  if(type == T_DIR){
+    dp->nlink--;
+    iupdate(dp);
+  }
+  ip->nlink = 0;
+  iupdate(ip);
+  iunlockput(ip);
+  iunlockput(dp);
+  return 0;
 }
 
 int
@@ -307,7 +578,7 @@ sys_open(void)
       return -1;
     }
     ilock(ip);
-    if(ip->type == T_DIR && omode != O_RDONLY){
+    if(ip->type == T_DIR && (omode & (O_WRONLY|O_RDWR))){
       iunlockput(ip);
       end_op();
       return -1;
@@ -329,9 +600,31 @@ sys_open(void)
   f->off = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  f->nonblock = (omode & O_NONBLOCK) != 0;
   return fd;
 }
 
+// Get or set a descriptor's flags. Only O_NONBLOCK can be set;
+// it is shared by descriptors from dup() and fork().
+int
+sys_fcntl(void)
+{
+  struct file *f;
+  int cmd, arg;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &cmd) < 0 || argint(2, &arg) < 0)
+    return -1;
+  switch(cmd){
+  case F_GETFL:
+    return (f->readable ? (f->writable ? O_RDWR : O_RDONLY) : O_WRONLY) |
+           (f->nonblock ? O_NONBLOCK : 0);
+  case F_SETFL:
+    f->nonblock = (arg & O_NONBLOCK) != 0;
+    return 0;
+  }
+  return -1;
+}
+
 int
 sys_mkdir(void)
 {
@@ -426,7 +719,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argoutptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -442,3 +735,65 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Wait until some of the nfds descriptors in fds are ready for
+// the events they ask for, or for timeout ticks (forever if
+// negative). Returns how many are ready, each with revents set.
+int
+sys_poll(void)
+{
+  struct pollfd *fds;
+  struct file *f;
+  void *chans[2*NOFILE+1];
+  int nfds, timeout, i, n, ready, registered;
+  uint t0, t;
+
+  if(argint(1, &nfds) < 0 || argint(2, &timeout) < 0 ||
+     nfds < 0 || nfds > NOFILE ||
+     argoutptr(0, (void*)&fds, nfds*sizeof(fds[0])) < 0)
+    return -1;
+  acquire(&tickslock);
+  t0 = ticks;
+  release(&tickslock);
+
+  // The first pass only finds the channels; the rest watch them
+  // while checking, so that pollwait() misses no wakeup.
+  n = 0;
+  registered = 0;
+  for(;;){
+    pollstart(chans, n);
+    ready = 0;
+    n = 0;
+    for(i = 0; i < nfds; i++){
+      fds[i].revents = 0;
+      if(fds[i].fd < 0)
+        continue;
+      if(fds[i].fd >= NOFILE || (f = myproc()->ofile[fds[i].fd]) == 0)
+        fds[i].revents = POLLNVAL;
+      else {
+        fds[i].revents = filepoll(f, fds[i].events, chans + n);
+        n += 2;
+      }
+      if(fds[i].revents)
+        ready++;
+    }
+    if(timeout > 0)
+      chans[n++] = &ticks;
+    if(ready || timeout == 0 || myproc()->killed)
+      break;
+    if(timeout > 0){
+      acquire(&tickslock);
+      t = ticks;
+      release(&tickslock);
+      if((int)(t - t0) >= timeout)
+        break;
+    }
+    if(registered)
+      pollwait();
+    registered = 1;
+  }
+  pollend();
+  if(myproc()->killed)
+    return -1;
+  return ready;
+}
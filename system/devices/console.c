@@ -10,6 +10,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
+#include "poll.h"
+#include "fcntl.h"
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
@@ -233,7 +235,7 @@ consoleintr(int (*getc)(void))
 }
 
 int
-consoleread(struct inode *ip, char *dst, int n)
+consoleread(struct inode *ip, char *dst, int n, int nonblock)
 {
   uint target;
   int c;
@@ -248,6 +250,11 @@ consoleread(struct inode *ip, char *dst, int n)
         ilock(ip);
         return -1;
       }
+      if(nonblock){
+        release(&cons.lock);
+        ilock(ip);
+        return n < target ? target - n : EWOULDBLOCK;
+      }
       sleep(&input.r, &cons.lock);
     }
     c = input.buf[input.r++ % INPUT_BUF];
@@ -270,6 +277,22 @@ consoleread(struct inode *ip, char *dst, int n)
   return target - n;
 }
 
+int
+consolepoll(struct inode *ip, int events, void **chans)
+{
+  int r;
+
+  r = events & POLLOUT;
+  if(events & POLLIN){
+    chans[0] = &input.r;
+    acquire(&cons.lock);
+    if(input.r != input.w)
+      r |= POLLIN;
+    release(&cons.lock);
+  }
+  return r;
+}
+
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
@@ -292,6 +315,7 @@ consoleinit(void)
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
   cons.locking = 1;
 
   ioapicenable(IRQ_KBD, 0);
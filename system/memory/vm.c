@@ -329,6 +329,8 @@ copyuvm(pde_t *pgdir, uint sz)
       panic("copyuvm: page not present");
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
+    if(flags & PTE_COW)
+      flags = (flags & ~PTE_COW) | PTE_W;
     if((mem = kalloc()) == 0)
       goto bad;
     memmove(mem, (char*)P2V(pa), PGSIZE);
@@ -367,10 +369,14 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    if((pte = walkpgdir(pgdir, (char*)va0, 0)) != 0 && (*pte & PTE_COW))
+      if(uvmcow(pgdir, va0) < 0)
+        return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -386,7 +392,122 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 }
 
 //PAGEBREAK!
-// Blank page.
+// Copy-on-write pages, which let pipes pass whole pages between
+// processes without copying them (see pipe.c). A shared page
+// is mapped read-only with PTE_COW set in every address space
+// that has it; the first write faults, and uvmcow() gives the
+// writer its own copy. kalloc() counts the page's references,
+// so the last holder just gets write access back.
+
+// Flush stale TLB entries for pgdir, if it is in use.
+// Processes are single-threaded, so only this CPU can be
+// using the current process's page table.
+static void
+flushuvm(pde_t *pgdir)
+{
+  if(myproc() && myproc()->pgdir == pgdir)
+    lcr3(V2P(pgdir));
+}
+
+// Make the copy-on-write page at user address va writable,
+// copying it if it is still shared. Called on a page fault.
+// Returns -1 if va is not a copy-on-write page or there is
+// no memory for the copy.
+int
+uvmcow(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *old, *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  pte = walkpgdir(pgdir, (char*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  if(krefs(old) > 1){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(old);
+  } else
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  flushuvm(pgdir);
+  return 0;
+}
+
+// Give pgdir its own copy of every copy-on-write page in the
+// user addresses [va, va+len), before the kernel writes there,
+// so that running out of memory fails the system call instead
+// of the kernel's write faulting. Returns -1 if it does.
+int
+uvmwritable(pde_t *pgdir, uint va, uint len)
+{
+  uint a, last;
+  pte_t *pte;
+
+  if(len == 0)
+    return 0;
+  last = PGROUNDDOWN(va + len - 1);
+  for(a = PGROUNDDOWN(va); ; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) != 0 && (*pte & PTE_COW))
+      if(uvmcow(pgdir, a) < 0)
+        return -1;
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
+// Share the user page at page-aligned address uva: make it
+// copy-on-write for pgdir and return it, with a reference
+// the caller must kfree(). Returns 0 if uva is not a user page.
+char*
+uvmshare(pde_t *pgdir, char *uva)
+{
+  pte_t *pte;
+  char *page;
+
+  if((uint)uva >= KERNBASE || (uint)uva % PGSIZE)
+    return 0;
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+    return 0;
+  if(*pte & PTE_W){
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+    flushuvm(pgdir);
+  }
+  page = P2V(PTE_ADDR(*pte));
+  kref(page);
+  return page;
+}
+
+// Map page, from kalloc(), at page-aligned user address uva
+// in place of the writable page there, which is freed. Takes
+// over the caller's reference to page, and maps it
+// copy-on-write if anyone else still has one.
+// Returns -1 if uva is not a writable user page.
+int
+uvmremap(pde_t *pgdir, char *uva, char *page)
+{
+  pte_t *pte;
+  char *old;
+
+  if((uint)uva >= KERNBASE || (uint)uva % PGSIZE)
+    return -1;
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U) ||
+     (*pte & (PTE_W|PTE_COW)) == 0)
+    return -1;
+  old = P2V(PTE_ADDR(*pte));
+  *pte = V2P(page) | (PTE_FLAGS(*pte) & ~(PTE_W|PTE_COW)) |
+         (krefs(page) > 1 ? PTE_COW : PTE_W);
+  flushuvm(pgdir);
+  kfree(old);
+  return 0;
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
@@ -0,0 +1,95 @@
+// PCI configuration space access through the legacy I/O
+// ports (configuration mechanism #1), and a bus scan for
+// drivers that need to find their controller.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFADDR  0xCF8
+#define PCI_CONFDATA  0xCFC
+
+static uint
+pciaddr(uint bus, uint dev, uint func, uint off)
+{
+  return 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC);
+}
+
+static uint
+pciconfread(uint bus, uint dev, uint func, uint off)
+{
+  outl(PCI_CONFADDR, pciaddr(bus, dev, func, off));
+  return inl(PCI_CONFDATA);
+}
+
+// Read the 32-bit configuration register at off.
+uint
+pciread(struct pcidev *d, uint off)
+{
+  return pciconfread(d->bus, d->dev, d->func, off);
+}
+
+// Write the 32-bit configuration register at off.
+void
+pciwrite(struct pcidev *d, uint off, uint val)
+{
+  outl(PCI_CONFADDR, pciaddr(d->bus, d->dev, d->func, off));
+  outl(PCI_CONFDATA, val);
+}
+
+// Scan every bus for the first function that match() accepts
+// and fill in *d. Returns 0 if there is none.
+static int
+pciscan(int (*match)(uint, uint, uint, uint), uint a, uint b, struct pcidev *d)
+{
+  uint bus, dev, func, nfunc, id;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        id = pciconfread(bus, dev, func, PCI_ID);
+        if((id & 0xFFFF) == 0xFFFF)
+          continue;
+        if(func == 0 && (pciconfread(bus, dev, 0, PCI_HEADER) & 0x800000))
+          nfunc = 8;  // multi-function device
+        if(match(id, pciconfread(bus, dev, func, PCI_CLASS), a, b)){
+          d->bus = bus;
+          d->dev = dev;
+          d->func = func;
+          d->vendor = id & 0xFFFF;
+          d->device = id >> 16;
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+static int
+matchclass(uint id, uint class, uint c, uint sub)
+{
+  return (class >> 24) == c && ((class >> 16) & 0xFF) == sub;
+}
+
+static int
+matchdev(uint id, uint class, uint vendor, uint device)
+{
+  return (id & 0xFFFF) == vendor && (id >> 16) == device;
+}
+
+// Find the first function with the given vendor and device id.
+int
+pcifinddev(uint vendor, uint device, struct pcidev *d)
+{
+  return pciscan(matchdev, vendor, device, d);
+}
+
+// Find the first function with the given class and subclass.
+int
+pcifindclass(uint class, uint subclass, struct pcidev *d)
+{
+  return pciscan(matchclass, class, subclass, d);
+}
@@ -13,6 +13,7 @@ struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+int diskirq = IRQ_IDE;  // disk drivers on PCI use the line the BIOS routed
 
 void
 tvinit(void)
@@ -56,10 +57,6 @@ trap(struct trapframe *tf)
     }
     lapiceoi();
     break;
-  case T_IRQ0 + IRQ_IDE:
-    ideintr();
-    lapiceoi();
-    break;
   case T_IRQ0 + IRQ_IDE+1:
     // Bochs generates spurious IDE1 interrupts.
     break;
@@ -78,8 +75,22 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A write to a copy-on-write page, by the process or by
+    // the kernel copying out to it, gets a private copy.
+    // Anything else is handled as below.
+    if(myproc() && (tf->err & FEC_WR) &&
+       uvmcow(myproc()->pgdir, rcr2()) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
+    if(tf->trapno == T_IRQ0 + diskirq){
+      ideintr();
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
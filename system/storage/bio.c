@@ -21,6 +21,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -33,6 +34,8 @@ struct {
   // Linked list of all buffers, through prev/next.
   // head.next is most recently used.
   struct buf head;
+
+  int nasync;  // reads started by bprefetch() and not yet done
 } bcache;
 
 void
@@ -42,6 +45,11 @@ binit(void)
 
   initlock(&bcache.lock, "bcache");
 
+  // Blocks are whole sectors, and the log snapshots a block
+  // into a page.
+  if(BSIZE % 512 != 0 || BSIZE > PGSIZE)
+    panic("binit: bad BSIZE");
+
 //PAGEBREAK!
   // Create linked list of buffers
   bcache.head.prev = &bcache.head;
@@ -115,6 +123,23 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Drop a reference to b. If it was the last, move b to the
+// head of the MRU list. Caller must hold bcache.lock.
+static void
+bunref(struct buf *b)
+{
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+    b->next = bcache.head.next;
+    b->prev = &bcache.head;
+    bcache.head.next->prev = b;
+    bcache.head.next = b;
+  }
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
@@ -126,17 +151,72 @@ brelse(struct buf *b)
   releasesleep(&b->lock);
 
   acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  bunref(b);
+  release(&bcache.lock);
+}
+
+// Start reading block blockno of dev into the cache, unless it
+// is there already, and return without waiting for the disk.
+// The buffer stays locked until the driver calls bdone(), so a
+// bread() of the block in the meantime waits for the read.
+// Lets one process have many reads in flight at once.
+// Returns 1 if a read was started.
+int
+bprefetch(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  acquire(&bcache.lock);
+
+  // The log may pin up to MAXLOGSIZE dirty buffers; take at
+  // most half of the rest, and leave the others to bget(),
+  // which panics if it can't find one.
+  if(bcache.nasync >= (NBUF - MAXLOGSIZE)/2){
+    release(&bcache.lock);
+    return 0;
+  }
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+    if(b->dev == dev && b->blockno == blockno){
+      release(&bcache.lock);
+      return 0;
+    }
   }
-  
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+      b->dev = dev;
+      b->blockno = blockno;
+      b->flags = 0;
+      b->refcnt = 1;
+      bcache.nasync++;
+      release(&bcache.lock);
+      acquiresleep(&b->lock);
+      b->flags |= B_ASYNC;
+      // Someone who found b in the meantime may have read it.
+      if(b->flags & B_VALID){
+        bdone(b);
+        return 0;
+      }
+      iderw(b);
+      return 1;
+    }
+  }
+  release(&bcache.lock);
+  return 0;
+}
+
+// Release b, whose read bprefetch() started, now that the read
+// is done. The disk driver calls this, usually from its
+// interrupt handler, so it cannot use brelse(): the buffer is
+// not held by the current process.
+void
+bdone(struct buf *b)
+{
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+
+  acquire(&bcache.lock);
+  bcache.nasync--;
+  bunref(b);
   release(&bcache.lock);
 }
 //PAGEBREAK!
@@ -15,6 +15,7 @@
 #include "stat.h"
 #include "mmu.h"
 #include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -52,25 +53,104 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// With FS_GROUPS, each allocation group has a free map block
+// covering just its own blocks; see fs.h.
+#define GROUPS (sb.features & FS_GROUPS)
+#define BSPAN  (GROUPS ? sb.groupsize : BPB)  // blocks one free map block covers
+
+// In-memory summary of each free map block, so that balloc()
+// can skip full ones without reading them and start scanning
+// a block past its leading run of allocated words. A summary
+// is filled in the first time balloc() reads its block, and is
+// protected by that block's buffer lock.
+#define NBMAP  (FSSIZE/MINGROUP + 1)
+
+static struct {
+  int valid;
+  uint nfree;    // free blocks in this bitmap block
+  uint cursor;   // words before this one have no free bits
+} bsum[NBMAP];
+
+// Scan words [from, to) of free map block bp, whose committed
+// copy is c, for a block that is free now and as of the last
+// commit, ignoring bits below skip in the first word.
+// Returns its bit number or -1.
+static int
+bscan(struct buf *bp, uchar *c, uint from, uint to, uint skip)
+{
+  uint *w, *cw, m;
+
+  w = (uint*)bp->data;
+  cw = (uint*)c;
+  for(; from < to; from++, skip = 0){
+    m = ~w[from];
+    if(cw)
+      m &= ~cw[from];
+    m &= ~0U << skip;
+    if(m)
+      return from*32 + bsf(m);
+  }
+  return -1;
+}
+
+// Allocate a disk block, preferably goal (if non-zero) or the
+// first free block after it, so that a file written sequentially
+// ends up contiguous on disk. If zero is set, the block is zeroed
+// through the log; file data written in ordered mode skips that,
+// since it never enters the log.
 static uint
-balloc(uint dev)
+balloc(uint dev, int zero, uint goal)
 {
-  int b, bi, m;
+  int bi, n;
+  uint i, b, span, nbmap, start, bits, nw, *w;
   struct buf *bp;
+  uchar *c;
+
+  if(goal >= sb.size)
+    goal = 0;
+  span = BSPAN;
+  nbmap = (sb.size + span - 1) / span;
+  if(nbmap > NBMAP)
+    panic("balloc: bitmap too big");
+  start = goal / span;
+
+  for(i = 0; i < nbmap; i++){
+    b = (start + i) % nbmap;
+    if(bsum[b].valid && bsum[b].nfree == 0)
+      continue;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+    bp = bread(dev, BBLOCK(b*span, sb));
+    w = (uint*)bp->data;
+    bits = sb.size - b*span;
+    if(bits > span)
+      bits = span;
+    nw = (bits + 31) / 32;
+    if(!bsum[b].valid){
+      bsum[b].nfree = 0;
+      for(n = 0; n < bits; n++)
+        if((bp->data[n/8] & (1 << (n%8))) == 0)
+          bsum[b].nfree++;
+      bsum[b].cursor = 0;
+      bsum[b].valid = 1;
+    }
+    while(bsum[b].cursor < nw && w[bsum[b].cursor] == ~0U)
+      bsum[b].cursor++;
+
+    // Is a block free, also as of the last commit?
+    c = log_committed(bp);
+    bi = -1;
+    if(i == 0 && goal)
+      bi = bscan(bp, c, (goal%span)/32, nw, goal%span%32);
+    if(bi < 0 || bi >= bits)
+      bi = bscan(bp, c, bsum[b].cursor, nw, 0);
+    if(bi >= 0 && bi < bits){
+      bp->data[bi/8] |= 1 << (bi%8);  // Mark block in use.
+      bsum[b].nfree--;
+      log_write(bp);
+      brelse(bp);
+      if(zero)
+        bzero(dev, b*span + bi);
+      return b*span + bi;
     }
     brelse(bp);
   }
@@ -85,11 +165,18 @@ bfree(int dev, uint b)
   int bi, m;
 
   bp = bread(dev, BBLOCK(b, sb));
-  bi = b % BPB;
+  bi = BBIT(b, sb);
   m = 1 << (bi % 8);
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
+  log_freeing(bp);
   bp->data[bi/8] &= ~m;
+  b /= BSPAN;
+  if(bsum[b].valid){
+    bsum[b].nfree++;
+    if(bi/32 < bsum[b].cursor)
+      bsum[b].cursor = bi/32;
+  }
   log_write(bp);
   brelse(bp);
 }
@@ -162,46 +249,248 @@ bfree(int dev, uint b)
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
+//
+// Entries are found through a hash table on (dev, inum). An
+// entry whose ref drops to zero stays in the table, still
+// valid, on an LRU list, so getting the inode again needs no
+// disk read. Entries are carved out of pages from kalloc():
+// the cache grows to NINODE entries and past that recycles the
+// least recently used unreferenced one, growing further only
+// when every entry is in use. The hash chains and the LRU list
+// are protected by icache.lock.
+
+#define NIHASH 61
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *hash[NIHASH];
+  struct inode *free;   // never-used entries, chained by hnext
+  int n;                // entries carved so far
+
+  // Unreferenced entries, most recently used at lru.next.
+  struct inode lru;
 } icache;
 
+// In-memory map of free i-nodes, so that ialloc() reads only
+// the i-node block it allocates from instead of every block
+// in turn. The bits for an i-node block are filled in the
+// first time ialloc() reads that block; after that ialloc()
+// skips the block while it has no free i-nodes, and iput()
+// sets the bit of each i-node it frees. Allocation starts
+// near a caller-supplied i-node (the new file's directory)
+// or else where the last one left off; with FS_GROUPS, new
+// directories instead go to each group in turn, and their
+// files follow them. Protected by icache.lock.
+#define NIMAP  8192    // i-nodes the free map covers
+
+static struct {
+  uchar known[NIMAP/IPB + 1];  // bits for this i-node block are filled in
+  uint free[(NIMAP/IPB + 1)*IPB/32 + 1];  // bit set: i-node is free
+  uint cursor;                 // i-node allocated last
+  uint dirgroup;               // group of the last new directory
+} imap;
+
+// The name cache remembers what dirlookup() found, including
+// names that are not there (inum 0), so that resolving a hot
+// path reads no directory blocks. It is direct-mapped on
+// (dev, directory, name). Entries for a directory are only
+// used and changed while holding that directory's lock (shared,
+// for lookups), and dirlink() and dirunlink() keep them up to
+// date. The
+// dcache.lock spin-lock protects the table itself.
+
+struct {
+  struct spinlock lock;
+  struct {
+    uint dev;
+    uint dir;          // directory i-number; 0 if unused
+    uint inum;         // 0: name is not in dir
+    char name[DIRSIZ];
+  } e[NDENTRY];
+} dcache;
+
+static uint dxhash(char *name);
+
+static int
+dcslot(struct inode *dp, char *name)
+{
+  return (dxhash(name) ^ (dp->inum * 2654435761U) ^ dp->dev) % NDENTRY;
+}
+
+// If the cache knows whether name is in dp, set *inum and return 1.
+static int
+dcget(struct inode *dp, char *name, uint *inum)
+{
+  int i, hit;
+
+  i = dcslot(dp, name);
+  acquire(&dcache.lock);
+  hit = dcache.e[i].dir == dp->inum && dcache.e[i].dev == dp->dev &&
+        namecmp(dcache.e[i].name, name) == 0;
+  if(hit)
+    *inum = dcache.e[i].inum;
+  release(&dcache.lock);
+  return hit;
+}
+
+// Record that name in dp refers to inum (0: no such entry).
+static void
+dcput(struct inode *dp, char *name, uint inum)
+{
+  int i;
+
+  i = dcslot(dp, name);
+  acquire(&dcache.lock);
+  dcache.e[i].dev = dp->dev;
+  dcache.e[i].dir = dp->inum;
+  dcache.e[i].inum = inum;
+  strncpy(dcache.e[i].name, name, DIRSIZ);
+  release(&dcache.lock);
+}
+
+// Forget every name in directory dp, which is being freed.
+static void
+dcpurge(struct inode *dp)
+{
+  int i;
+
+  acquire(&dcache.lock);
+  for(i = 0; i < NDENTRY; i++)
+    if(dcache.e[i].dir == dp->inum && dcache.e[i].dev == dp->dev)
+      dcache.e[i].dir = 0;
+  release(&dcache.lock);
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  initlock(&dcache.lock, "dcache");
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
-          sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+ inodestart %d bmap start %d opblocks %d features %x\n", sb.size,
+          sb.nblocks, sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
+          sb.bmapstart, sb.opblocks, sb.features);
+
+  // The buffer cache and every on-disk structure are sized for
+  // the block size the kernel was built with.
+  if(sb.size == 0 || (sb.bsize ? sb.bsize : 512) != BSIZE)
+    panic("iinit: file system block size mismatch");
+
+  if(GROUPS){
+    cprintf("sb: %d groups of %d blocks, %d inodes each\n",
+            sb.ngroups, sb.groupsize, sb.ipg);
+    if(sb.groupsize < MINGROUP || sb.groupsize > BPB ||
+       sb.ngroups != (sb.size + sb.groupsize - 1) / sb.groupsize ||
+       sb.ipg == 0 || sb.ipg % IPB != 0 || sb.ninodes != sb.ngroups*sb.ipg)
+      panic("iinit: bad allocation groups");
+  }
 }
 
 static struct inode* iget(uint dev, uint inum);
 
+// Add a page worth of entries to the inode cache, if there
+// is a page to spare. Caller must hold icache.lock.
+static void
+igrow(void)
+{
+  struct inode *ip;
+  char *p;
+  int i;
+
+  if((p = kalloc()) == 0)
+    return;
+  memset(p, 0, PGSIZE);
+  for(i = 0; i < PGSIZE / sizeof(struct inode); i++){
+    ip = (struct inode*)p + i;
+    initsleeplock(&ip->lock, "inode");
+    ip->hnext = icache.free;
+    icache.free = ip;
+    icache.n++;
+  }
+}
+
+// Take unreferenced inode ip off the LRU list.
+// Caller must hold icache.lock.
+static void
+lruremove(struct inode *ip)
+{
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+}
+
+// Return a free i-node in i-node block b, as far as the map
+// knows, or 0 if there is none. Caller must hold icache.lock.
+static uint
+imapfind(uint b)
+{
+  uint inum;
+
+  for(inum = b*IPB; inum < (b+1)*IPB; inum++)
+    if(imap.free[inum/32] & (1U << inum%32))
+      return inum;
+  return 0;
+}
+
 //PAGEBREAK!
-// Allocate an inode on device dev.
-// Mark it as allocated by  giving it type type.
+// Allocate an inode on device dev, preferably in the same
+// i-node block as i-node near (if non-zero) or the first block
+// after it with room, so that a directory's files share i-node
+// blocks and allocation group. Mark it as allocated by giving
+// it type type.
 // Returns an unlocked but allocated and referenced inode.
 struct inode*
-ialloc(uint dev, short type)
+ialloc(uint dev, short type, uint near)
 {
-  int inum;
+  uint i, b, nib, inum;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
-    bp = bread(dev, IBLOCK(inum, sb));
-    dip = (struct dinode*)bp->data + inum%IPB;
-    if(dip->type == 0){  // a free inode
+  if(sb.ninodes > NIMAP)
+    panic("ialloc: inode map too big");
+  nib = (sb.ninodes + IPB - 1) / IPB;
+
+  acquire(&icache.lock);
+  if(type == T_DIR && GROUPS){
+    imap.dirgroup = (imap.dirgroup + 1) % sb.ngroups;
+    near = imap.dirgroup * sb.ipg;
+  } else if(near == 0 || near >= sb.ninodes)
+    near = imap.cursor;
+  release(&icache.lock);
+
+  for(i = 0; i < nib; i++){
+    b = (near/IPB + i) % nib;
+    acquire(&icache.lock);
+    inum = imap.known[b] ? imapfind(b) : 1;
+    release(&icache.lock);
+    if(inum == 0)
+      continue;
+
+    bp = bread(dev, IBLOCK(b*IPB, sb));
+    acquire(&icache.lock);
+    if(!imap.known[b]){
+      for(inum = b*IPB; inum < (b+1)*IPB; inum++){
+        dip = (struct dinode*)bp->data + inum%IPB;
+        if(inum != 0 && inum < sb.ninodes && dip->type == 0)
+          imap.free[inum/32] |= 1U << inum%32;
+        else
+          imap.free[inum/32] &= ~(1U << inum%32);
+      }
+      imap.known[b] = 1;
+    }
+    if((inum = imapfind(b)) != 0){
+      imap.free[inum/32] &= ~(1U << inum%32);
+      imap.cursor = inum;
+    }
+    release(&icache.lock);
+
+    if(inum != 0){
+      dip = (struct dinode*)bp->data + inum%IPB;
+      if(dip->type != 0)
+        panic("ialloc: inode map");
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
       log_write(bp);   // mark it allocated on the disk
@@ -241,31 +530,41 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  uint h;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  h = (dev * 31 + inum) % NIHASH;
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lruremove(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle an inode cache entry, or make a new one.
+  if(icache.free == 0 && (icache.n < NINODE || icache.lru.prev == &icache.lru))
+    igrow();
+  if((ip = icache.free) != 0)
+    icache.free = ip->hnext;
+  else if((ip = icache.lru.prev) != &icache.lru){
+    lruremove(ip);
+    for(pp = &icache.hash[(ip->dev * 31 + ip->inum) % NIHASH]; *pp != ip; pp = &(*pp)->hnext)
+      ;
+    *pp = ip->hnext;
+  } else
     panic("iget: no inodes");
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->hnext = icache.hash[h];
+  icache.hash[h] = ip;
   release(&icache.lock);
 
   return ip;
@@ -321,6 +620,34 @@ iunlock(struct inode *ip)
   releasesleep(&ip->lock);
 }
 
+// Lock the given inode for reading only; other readers may
+// hold it too, and none of them may change it. Reads the inode
+// from disk if necessary, holding it exclusively to do that.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+  while(ip->valid == 0){
+    releasesleepshared(&ip->lock);
+    ilock(ip);
+    iunlock(ip);
+    acquiresleepshared(&ip->lock);
+  }
+}
+
+// Unlock an inode locked by ilockshared().
+void
+iunlockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("iunlockshared");
+
+  releasesleepshared(&ip->lock);
+}
+
 // Drop a reference to an in-memory inode.
 // If that was the last reference, the inode cache entry can
 // be recycled.
@@ -339,15 +666,33 @@ iput(struct inode *ip)
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
+      if(ip->type == T_DIR)
+        dcpurge(ip);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
+      acquire(&icache.lock);
+      imap.free[ip->inum/32] |= 1U << ip->inum%32;
+      release(&icache.lock);
     }
   }
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
   ip->ref--;
+  if(ip->ref == 0){
+    // Keep the inode cached, most recently used first; a
+    // freed one has nothing worth keeping, so it goes last.
+    if(ip->valid){
+      ip->next = icache.lru.next;
+      ip->prev = &icache.lru;
+    } else {
+      ip->next = &icache.lru;
+      ip->prev = icache.lru.prev;
+    }
+    ip->next->prev = ip;
+    ip->prev->next = ip;
+  }
   release(&icache.lock);
 }
 
@@ -365,31 +710,210 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. On a file system with
+// FS_EXTENTS, ip->addrs[] is instead the root of an extent tree
+// (see fs.h).
+
+#define EXTENTS (sb.features & FS_EXTENTS)
+
+// Where to look for ip's first data block: the start of the
+// data in ip's allocation group.
+#define IGOAL(ip) (GROUPS ? GDATA((ip)->inum / sb.ipg, sb) : 0)
+
+// Does ip keep its data in ip->addrs? Only regular files do,
+// and only while they are small; see writei().
+#define INLINE(ip) \
+  ((sb.features & FS_INLINE) && (ip)->type == T_FILE && (ip)->size <= INLINESZ)
+
+// Return the disk block holding block bn of extent-mapped
+// inode ip, or 0 if bn is past the last block of the file.
+static uint
+extlookup(struct inode *ip, uint bn)
+{
+  struct exthdr *h;
+  struct extent *e;
+  struct buf *bp, *next;
+  uint addr;
+  int i;
+
+  h = (struct exthdr*)ip->addrs;
+  bp = 0;
+  addr = 0;
+  for(;;){
+    e = EXT(h);
+    for(i = h->n - 1; i >= 0 && e[i].lbn > bn; i--)
+      ;
+    if(i < 0)
+      break;
+    if(h->depth == 0){
+      if(bn < e[i].lbn + e[i].len)
+        addr = e[i].start + bn - e[i].lbn;
+      break;
+    }
+    next = bread(ip->dev, e[i].start);
+    if(bp)
+      brelse(bp);
+    bp = next;
+    h = (struct exthdr*)bp->data;
+  }
+  if(bp)
+    brelse(bp);
+  return addr;
+}
+
+// Allocate a disk block for block bn of extent-mapped inode ip,
+// which must be the block just past the end of the file. The
+// block goes right after the last one if possible, growing the
+// last extent; otherwise a new extent is appended at the right
+// edge of the tree, adding nodes and a level as needed.
+// The caller writes the i-node, which holds the root.
+static uint
+extappend(struct inode *ip, uint bn, int zero)
+{
+  struct exthdr *h[EXTMAXDEPTH+1], *nh;
+  struct buf *bp[EXTMAXDEPTH+1], *nbp;
+  struct extent *e, *last, ent;
+  uint addr, goal, child;
+  int d, k, top;
+
+  // Load the rightmost path; h[top] is the root.
+  top = ((struct exthdr*)ip->addrs)->depth;
+  h[top] = (struct exthdr*)ip->addrs;
+  bp[top] = 0;
+  for(d = top; d > 0; d--){
+    bp[d-1] = bread(ip->dev, EXT(h[d])[h[d]->n-1].start);
+    h[d-1] = (struct exthdr*)bp[d-1]->data;
+  }
+
+  last = h[0]->n > 0 ? &EXT(h[0])[h[0]->n-1] : 0;
+  if((last ? last->lbn + last->len : 0) != bn)
+    panic("extappend: hole");
+  goal = last ? last->start + last->len : IGOAL(ip);
+  addr = balloc(ip->dev, zero, goal);
+  if(last && addr == goal){
+    last->len++;
+    if(bp[0])
+      log_write(bp[0]);
+    goto out;
+  }
+
+  // Find the lowest node on the path with a free entry.
+  for(d = 0; d <= top; d++)
+    if(h[d]->n < (d == top ? NEXTROOT : NEXTBLK))
+      break;
+  if(d > top){
+    // Full all the way up: move the root's entries into a new
+    // node and make that the root's only child.
+    if(top == EXTMAXDEPTH)
+      panic("extappend: tree full");
+    child = balloc(ip->dev, 1, IGOAL(ip));
+    nbp = bread(ip->dev, child);
+    memmove(nbp->data, h[top], sizeof(struct exthdr) + h[top]->n*sizeof(struct extent));
+    log_write(nbp);
+    h[top]->depth = top+1;
+    h[top]->n = 1;
+    EXT(h[top])[0].lbn = 0;
+    EXT(h[top])[0].start = child;
+    EXT(h[top])[0].len = 0;
+    h[top+1] = h[top];
+    bp[top+1] = 0;
+    h[top] = (struct exthdr*)nbp->data;
+    bp[top] = nbp;
+    d = ++top;
+  }
+
+  // Hang a new path of single-entry nodes, ending in the new
+  // extent, off node d.
+  ent.lbn = bn;
+  ent.start = addr;
+  ent.len = 1;
+  for(k = 0; k < d; k++){
+    child = balloc(ip->dev, 1, IGOAL(ip));
+    nbp = bread(ip->dev, child);
+    nh = (struct exthdr*)nbp->data;
+    nh->depth = k;
+    nh->n = 1;
+    EXT(nh)[0] = ent;
+    log_write(nbp);
+    brelse(nbp);
+    ent.start = child;
+    ent.len = 0;
+  }
+  e = &EXT(h[d])[h[d]->n++];
+  *e = ent;
+  if(bp[d])
+    log_write(bp[d]);
+
+out:
+  for(d = 0; d < top; d++)
+    brelse(bp[d]);
+  return addr;
+}
+
+// Free the blocks of the extent tree node h and everything
+// it points to.
+static void
+extfree(uint dev, struct exthdr *h)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint b;
+  int i;
+
+  e = EXT(h);
+  for(i = 0; i < h->n; i++){
+    if(h->depth == 0){
+      for(b = 0; b < e[i].len; b++)
+        bfree(dev, e[i].start + b);
+    } else {
+      bp = bread(dev, e[i].start);
+      extfree(dev, (struct exthdr*)bp->data);
+      brelse(bp);
+      bfree(dev, e[i].start);
+    }
+  }
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, prev, *a;
   struct buf *bp;
+  int zero;
+
+  // Directory blocks are metadata; see writei().
+  zero = !LOGORDERED || ip->type == T_DIR;
+
+  if(EXTENTS){
+    if((addr = extlookup(ip, bn)) == 0)
+      addr = extappend(ip, bn, zero);
+    return addr;
+  }
 
+  // New blocks go right after the file's previous block, and
+  // a file's first block near the start of its group's data.
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0){
+      prev = bn > 0 ? ip->addrs[bn-1] : 0;
+      ip->addrs[bn] = addr = balloc(ip->dev, zero, prev ? prev+1 : IGOAL(ip));
+    }
     return addr;
   }
   bn -= NDIRECT;
 
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[NDIRECT]) == 0){
+      prev = ip->addrs[NDIRECT-1];
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, 1, prev ? prev+1 : IGOAL(ip));
+    }
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
     if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+      prev = bn > 0 ? a[bn-1] : ip->addrs[NDIRECT];
+      a[bn] = addr = balloc(ip->dev, zero, prev ? prev+1 : IGOAL(ip));
       log_write(bp);
     }
     brelse(bp);
@@ -411,6 +935,15 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(INLINE(ip) || EXTENTS){
+    if(!INLINE(ip))
+      extfree(ip->dev, (struct exthdr*)ip->addrs);
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -458,7 +991,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
       return -1;
-    return devsw[ip->major].read(ip, dst, n);
+    return devsw[ip->major].read(ip, dst, n, 0);
   }
 
   if(off > ip->size || off + n < off)
@@ -466,6 +999,11 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  if(INLINE(ip)){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
@@ -475,6 +1013,82 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Like readi(), but hand each piece of the file, in place in
+// the buffer cache, to out(arg, src, n), which returns how many
+// bytes it took or -1. A short count ends the read. Lets
+// splice() move file data without copying it out first.
+// Returns the bytes taken, or -1 if out failed before any.
+int
+readiout(struct inode *ip, uint off, uint n,
+         int (*out)(void*, char*, int), void *arg)
+{
+  uint tot, m;
+  struct buf *bp;
+  int r;
+
+  if(ip->type == T_DEV || off > ip->size || off + n < off)
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+
+  if(INLINE(ip))
+    return n > 0 ? out(arg, (char*)ip->addrs + off, n) : 0;
+
+  for(tot=0; tot<n; tot+=r, off+=r){
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+    r = out(arg, (char*)bp->data + off%BSIZE, m);
+    brelse(bp);
+    if(r < 0)
+      return tot > 0 ? tot : -1;
+    if(r < m)
+      return tot + r;
+  }
+  return n;
+}
+
+// Start reading the blocks of ip's bytes [off, off+n) that are
+// not cached, without waiting for them, so that one process can
+// have many disk reads in flight; a later readi() finds them in
+// the cache or waits for them there. Returns how many reads it
+// started. Caller must hold ip->lock.
+int
+readiahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+  int k;
+
+  if(ip->type != T_FILE || INLINE(ip) || off >= ip->size)
+    return 0;
+  if(n > ip->size - off)
+    n = ip->size - off;
+
+  k = 0;
+  end = (off + n + BSIZE - 1) / BSIZE;
+  for(bn = off/BSIZE; bn < end; bn++)
+    k += bprefetch(ip->dev, bmap(ip, bn));
+  return k;
+}
+
+// Move the inline data of ip, which is about to grow past
+// INLINESZ, out to its first block. ip->size stays as it is,
+// so the caller must make the file bigger than INLINESZ.
+static void
+iuninline(struct inode *ip)
+{
+  char data[INLINESZ];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, INLINESZ);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  if(ip->size == 0)
+    return;
+  bp = bread(ip->dev, bmap(ip, 0));
+  memmove(bp->data, data, ip->size);
+  log_write_data(bp);
+  brelse(bp);
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
@@ -492,14 +1106,29 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(off + n > (EXTENTS ? sb.size : MAXFILE)*BSIZE)
     return -1;
 
+  if(INLINE(ip)){
+    if(off + n <= INLINESZ){
+      // Inline data is logged with the i-node.
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      return n;
+    }
+    iuninline(ip);
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
-    log_write(bp);
+    if(ip->type == T_DIR)
+      log_write(bp);
+    else
+      log_write_data(bp);
     brelse(bp);
   }
 
@@ -510,6 +1139,59 @@ writei(struct inode *ip, char *src, uint off, uint n)
   return n;
 }
 
+// Like writei(), but have in(arg, dst, n) fill each piece of
+// the file in place, returning how many bytes it put there or
+// -1. A short count ends the write. Only for ordinary files.
+// Returns the bytes written, or -1 if in failed before any.
+int
+writeiin(struct inode *ip, uint off, uint n,
+         int (*in)(void*, char*, int), void *arg)
+{
+  uint tot, m;
+  struct buf *bp;
+  int r;
+
+  if(ip->type != T_FILE || off > ip->size || off + n < off)
+    return -1;
+  if(off + n > (EXTENTS ? sb.size : MAXFILE)*BSIZE)
+    return -1;
+
+  if(INLINE(ip)){
+    if(off + n <= INLINESZ){
+      if((r = in(arg, (char*)ip->addrs + off, n)) > 0 && off + r > ip->size){
+        ip->size = off + r;
+        iupdate(ip);
+      }
+      return r;
+    }
+    iuninline(ip);
+  }
+
+  for(tot=0; tot<n; tot+=r, off+=r){
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+    if((r = in(arg, (char*)bp->data + off%BSIZE, m)) > 0)
+      log_write_data(bp);
+    brelse(bp);
+    if(r < 0){
+      if(tot == 0)
+        return -1;
+      break;
+    }
+    if(r < m){
+      tot += r;
+      off += r;
+      break;
+    }
+  }
+
+  if(tot > 0 && off > ip->size){
+    ip->size = off;
+    iupdate(ip);
+  }
+  return tot;
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -519,34 +1201,356 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+#define NDIRENT  (BSIZE / sizeof(struct dirent))
+#define DXHDR(bp, root)  ((struct dxhdr*)((bp)->data + ((root) ? DXROOT : 0)))
+#define DXENT(h)  ((struct dxentry*)((h) + 1))
+
+// Search entries [from, to) of directory block fbn for name.
+// Return its inode number and set *poff, or return 0.
+static uint
+dirscan(struct inode *dp, uint fbn, uint from, uint to, char *name, uint *poff)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint inum;
+
+  bp = bread(dp->dev, bmap(dp, fbn));
+  de = (struct dirent*)bp->data;
+  inum = 0;
+  for(; from < to; from++){
+    if(de[from].inum != 0 && namecmp(name, de[from].name) == 0){
+      inum = de[from].inum;
+      if(poff)
+        *poff = fbn*BSIZE + from*sizeof(*de);
+      break;
+    }
+  }
+  brelse(bp);
+  return inum;
+}
+
+// Hash a directory entry name (FNV-1a).
+static uint
+dxhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Is dp a hashed directory?
+static int
+dxindexed(struct inode *dp)
+{
+  struct buf *bp;
+  struct dxhdr *h;
+  int r;
+
+  if(dp->size < BSIZE)
+    return 0;
+  bp = bread(dp->dev, bmap(dp, 0));
+  h = DXHDR(bp, 1);
+  r = h->zero == 0 && h->magic == DX_MAGIC;
+  brelse(bp);
+  return r;
+}
+
+// Return the index of the last of the n entries in e whose
+// hash is at most hash. e[0] covers every hash below e[1].
+static int
+dxsearch(struct dxentry *e, int n, uint hash)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(e[mid].hash <= hash)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+// Return the leaf of hashed directory dp that holds hash.
+static uint
+dxleaf(struct inode *dp, uint hash)
+{
+  struct buf *bp;
+  struct dxhdr *h;
+  uint blk, depth;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  h = DXHDR(bp, 1);
+  depth = h->depth;
+  blk = DXENT(h)[dxsearch(DXENT(h), h->n, hash)].block;
+  brelse(bp);
+  if(depth > 0){
+    bp = bread(dp->dev, bmap(dp, blk));
+    h = DXHDR(bp, 0);
+    blk = DXENT(h)[dxsearch(DXENT(h), h->n, hash)].block;
+    brelse(bp);
+  }
+  return blk;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
-  struct dirent de;
+  uint fbn, n, inum;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
+  if(poff == 0 && dcget(dp, name, &inum))
+    return inum ? iget(dp->dev, inum) : 0;
+
+  inum = 0;
+  if(dxindexed(dp)){
+    // "." and ".." stay in block 0; the rest is in one leaf.
+    if((inum = dirscan(dp, 0, 0, 2, name, poff)) == 0)
+      inum = dirscan(dp, dxleaf(dp, dxhash(name)), 0, NDIRENT, name, poff);
+  } else {
+    for(fbn = 0; inum == 0 && fbn*BSIZE < dp->size; fbn++){
+      n = dp->size - fbn*BSIZE;
+      if(n > BSIZE)
+        n = BSIZE;
+      inum = dirscan(dp, fbn, 0, n/sizeof(struct dirent), name, poff);
+    }
+  }
+
+  dcput(dp, name, inum);
+  return inum ? iget(dp->dev, inum) : 0;
+}
+
+// Append a zeroed block to directory dp.
+// Return its file block number, or 0 if dp cannot grow.
+static uint
+dxgrow(struct inode *dp)
+{
+  uint fbn;
+
+  fbn = dp->size / BSIZE;
+  if(fbn > 0xFFFF || (!EXTENTS && fbn >= MAXFILE))
+    return 0;
+  bmap(dp, fbn);  // directory blocks are allocated zeroed
+  dp->size += BSIZE;
+  iupdate(dp);
+  return fbn;
+}
+
+// Insert an entry for child block blk, holding hashes from
+// hash up, at position at of index h.
+static void
+dxinsert(struct dxhdr *h, int at, uint hash, uint blk)
+{
+  struct dxentry *e;
+
+  e = DXENT(h);
+  memmove(e + at + 1, e + at, (h->n - at) * sizeof(*e));
+  e[at].zero = 0;
+  e[at].block = blk;
+  e[at].hash = hash;
+  h->n++;
+}
+
+// Turn the linear directory dp, whose only block is full, into
+// a hashed one: its entries but "." and ".." move to a leaf.
+static int
+dxconvert(struct inode *dp)
+{
+  struct buf *rb, *lb;
+  struct dxhdr *h;
+  uint leaf;
+
+  if((leaf = dxgrow(dp)) == 0)
+    return -1;
+  rb = bread(dp->dev, bmap(dp, 0));
+  lb = bread(dp->dev, bmap(dp, leaf));
+  memmove(lb->data, rb->data + DXROOT, BSIZE - DXROOT);
+  memset(rb->data + DXROOT, 0, BSIZE - DXROOT);
+  h = DXHDR(rb, 1);
+  h->magic = DX_MAGIC;
+  h->depth = 0;
+  h->n = 0;
+  dxinsert(h, 0, 0, leaf);
+  log_write(lb);
+  log_write(rb);
+  brelse(lb);
+  brelse(rb);
+  return 0;
+}
+
+// Split the full leaf lb, whose entry is at position at of
+// index h, moving the upper half of its hashes to a new leaf.
+// The caller writes h's block.
+static int
+dxsplitleaf(struct inode *dp, struct buf *lb, struct dxhdr *h, int at)
+{
+  struct buf *xb;
+  struct dirent *de, *xe;
+  uint hs[NDIRENT], i, j, m, n, hash, split, leaf;
+
+  // Sort a copy of the leaf's hashes. The entries themselves
+  // stay where they are, so that a reader part way through the
+  // directory (see dirread()) misses none of those it has yet
+  // to read.
+  de = (struct dirent*)lb->data;
+  for(n = i = 0; i < NDIRENT; i++){
+    if(de[i].inum == 0)
       continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+    hash = dxhash(de[i].name);
+    for(j = n; j > 0 && hs[j-1] > hash; j--)
+      hs[j] = hs[j-1];
+    hs[j] = hash;
+    n++;
+  }
+
+  // Split near the middle, between different hashes, so
+  // that a hash never spans two leaves.
+  for(i = 0; i < n/2; i++){
+    m = n/2 + i;
+    if(m < n && hs[m-1] != hs[m])
+      break;
+    m = n/2 - i;
+    if(m > 0 && hs[m-1] != hs[m])
+      break;
+  }
+  if(i == n/2 || (leaf = dxgrow(dp)) == 0)
+    return -1;
+  split = hs[m];
+
+  // Move the entries with hashes from split up to the new leaf,
+  // which is past every other block of the directory.
+  xb = bread(dp->dev, bmap(dp, leaf));
+  xe = (struct dirent*)xb->data;
+  for(i = 0; i < NDIRENT; i++){
+    if(de[i].inum != 0 && dxhash(de[i].name) >= split){
+      *xe++ = de[i];
+      memset(&de[i], 0, sizeof(de[i]));
     }
   }
+  dxinsert(h, at + 1, split, leaf);
+  log_write(xb);
+  brelse(xb);
+  log_write(lb);
+  return 0;
+}
 
+// Make room in the full index node nb, whose entry is at
+// position at of the root in rb, by moving its upper half
+// to a new node.
+static int
+dxsplitnode(struct inode *dp, struct buf *rb, int at, struct buf *nb)
+{
+  struct buf *xb;
+  struct dxhdr *rh, *nh, *xh;
+  uint node, m;
+
+  rh = DXHDR(rb, 1);
+  nh = DXHDR(nb, 0);
+  if(rh->n == NDXROOT || (node = dxgrow(dp)) == 0)
+    return -1;
+  xb = bread(dp->dev, bmap(dp, node));
+  xh = DXHDR(xb, 0);
+  m = nh->n / 2;
+  xh->magic = DX_MAGIC;
+  xh->n = nh->n - m;
+  memmove(DXENT(xh), DXENT(nh) + m, xh->n * sizeof(struct dxentry));
+  memset(DXENT(nh) + m, 0, xh->n * sizeof(struct dxentry));
+  nh->n = m;
+  dxinsert(rh, at + 1, DXENT(xh)[0].hash, node);
+  log_write(xb);
+  brelse(xb);
+  log_write(nb);
+  log_write(rb);
   return 0;
 }
 
+// Make room in the full root in rb by moving its entries
+// to a new index node below it.
+static int
+dxdeepen(struct inode *dp, struct buf *rb)
+{
+  struct buf *xb;
+  struct dxhdr *rh, *xh;
+  uint node;
+
+  rh = DXHDR(rb, 1);
+  if(rh->depth > 0 || (node = dxgrow(dp)) == 0)
+    return -1;
+  xb = bread(dp->dev, bmap(dp, node));
+  xh = DXHDR(xb, 0);
+  xh->magic = DX_MAGIC;
+  xh->n = rh->n;
+  memmove(DXENT(xh), DXENT(rh), rh->n * sizeof(struct dxentry));
+  memset(DXENT(rh), 0, rh->n * sizeof(struct dxentry));
+  rh->depth = 1;
+  rh->n = 0;
+  dxinsert(rh, 0, 0, node);
+  log_write(xb);
+  brelse(xb);
+  log_write(rb);
+  return 0;
+}
+
+// Add (name, inum) to hashed directory dp, splitting its leaf
+// and index nodes as they fill up.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+  struct buf *rb, *nb, *lb;
+  struct dxhdr *rh, *ph;
+  struct dirent *de;
+  uint hash, i;
+  int ri, pi, r;
+
+  hash = dxhash(name);
+  for(;;){
+    // Walk the index down to the leaf for hash.
+    rb = bread(dp->dev, bmap(dp, 0));
+    rh = ph = DXHDR(rb, 1);
+    ri = pi = dxsearch(DXENT(rh), rh->n, hash);
+    nb = 0;
+    if(rh->depth > 0){
+      nb = bread(dp->dev, bmap(dp, DXENT(rh)[ri].block));
+      ph = DXHDR(nb, 0);
+      pi = dxsearch(DXENT(ph), ph->n, hash);
+    }
+    lb = bread(dp->dev, bmap(dp, DXENT(ph)[pi].block));
+
+    de = (struct dirent*)lb->data;
+    for(i = 0; i < NDIRENT && de[i].inum != 0; i++)
+      ;
+    if(i < NDIRENT){
+      strncpy(de[i].name, name, DIRSIZ);
+      de[i].inum = inum;
+      log_write(lb);
+      r = 1;
+    } else if(nb == 0 && rh->n == NDXROOT)
+      r = dxdeepen(dp, rb);
+    else if(nb != 0 && ph->n == NDXNODE)
+      r = dxsplitnode(dp, rb, ri, nb);
+    else if((r = dxsplitleaf(dp, lb, ph, pi)) == 0)
+      log_write(nb ? nb : rb);
+
+    brelse(lb);
+    if(nb)
+      brelse(nb);
+    brelse(rb);
+    if(r != 0)
+      return r > 0 ? 0 : -1;
+  }
+}
+
 // Write a new directory entry (name, inum) into the directory dp.
 int
 dirlink(struct inode *dp, char *name, uint inum)
@@ -561,6 +1565,13 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  if(dxindexed(dp)){
+    if(dxlink(dp, name, inum) < 0)
+      return -1;
+    dcput(dp, name, inum);
+    return 0;
+  }
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -569,14 +1580,71 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
+  // Index a directory rather than let it grow a second block.
+  if(off == BSIZE && dp->size == BSIZE){
+    if(dxconvert(dp) < 0 || dxlink(dp, name, inum) < 0)
+      return -1;
+    dcput(dp, name, inum);
+    return 0;
+  }
+
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcput(dp, name, inum);
 
   return 0;
 }
 
+// Remove the entry for name, which dirlookup() found at
+// offset off, from directory dp.
+void
+dirunlink(struct inode *dp, char *name, uint off)
+{
+  struct dirent de;
+
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+  dcput(dp, name, 0);
+}
+
+// Copy up to n in-use entries of directory dp, which is locked,
+// into de, starting at byte offset *off and advancing *off past
+// the last one copied. A hashed directory's index slots read as
+// unused entries, so they are skipped too. If ips is not 0, also
+// take a reference to each entry's inode in ips, which keeps it
+// from being freed once dp is unlocked. Returns the number copied.
+int
+dirread(struct inode *dp, uint *off, struct dirent *de,
+        struct inode **ips, int n)
+{
+  struct buf *bp;
+  struct dirent *e;
+  int i;
+
+  if(dp->type != T_DIR)
+    panic("dirread not DIR");
+
+  *off = (*off + sizeof(*e) - 1) / sizeof(*e) * sizeof(*e);
+  i = 0;
+  while(i < n && *off < dp->size){
+    bp = bread(dp->dev, bmap(dp, *off / BSIZE));
+    do {
+      e = (struct dirent*)(bp->data + *off % BSIZE);
+      if(e->inum != 0){
+        if(ips)
+          ips[i] = iget(dp->dev, e->inum);
+        de[i++] = *e;
+      }
+      *off += sizeof(*e);
+    } while(i < n && *off < dp->size && *off % BSIZE != 0);
+    brelse(bp);
+  }
+  return i;
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -631,22 +1699,24 @@ namex(char *path, int nameiparent, char *name)
   else
     ip = idup(myproc()->cwd);
 
+  // Lookups only read each directory, so they can share it.
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type != T_DIR){
-      iunlockput(ip);
+      iunlockshared(ip);
+      iput(ip);
       return 0;
     }
     if(nameiparent && *path == '\0'){
       // Stop one level early.
-      iunlock(ip);
+      iunlockshared(ip);
       return ip;
     }
-    if((next = dirlookup(ip, name, 0)) == 0){
-      iunlockput(ip);
+    next = dirlookup(ip, name, 0);
+    iunlockshared(ip);
+    iput(ip);
+    if(next == 0)
       return 0;
-    }
-    iunlockput(ip);
     ip = next;
   }
   if(nameiparent){
@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code. Uses PCI bus-master DMA (as on the PIIX
+// controllers QEMU and Bochs emulate) when the controller has
+// it, and falls back to simple PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +14,7 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +26,62 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_SETMUL 0xc6
+
+// Longest run of sectors one command may cover: a single READ/
+// WRITE MULTIPLE block in PIO mode, or one DMA transfer.
+#define IDE_MAXMULT   16
+#define IDE_MAXDMA    128
+
+// Bus-master registers of the primary channel, relative to
+// the controller's BAR4.
+#define BM_CMD        0x0
+#define BM_STATUS     0x2
+#define BM_PRDT       0x4
+
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // device to memory
+
+#define BM_ST_ACTIVE  0x01
+#define BM_ST_ERR     0x02
+#define BM_ST_INTR    0x04
+#define BM_ST_DRV0    0x20  // drive 0 can do DMA
+#define BM_ST_DRV1    0x40  // drive 1 can do DMA
+
+// Physical region descriptor: one physically contiguous piece
+// of a DMA transfer. A piece may not cross a 64 KB boundary.
+struct prd {
+  uint addr;
+  ushort count;   // bytes; 0 means 64 KB
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor in the table
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
 // You must hold idelock while manipulating queue.
+//
+// The queue is an elevator (C-LOOK): after the bufs of the
+// running command come the requests at or past the disk head
+// position in ascending block order, then the requests behind
+// the head, also ascending, for the next sweep. idestart()
+// merges a run of adjacent blocks into one multi-sector command.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;               // bufs covered by the running command
+static uint headdev, headblock;   // where the running command started
 
 static int havedisk1;
 static void idestart(struct buf*);
+static void idedmainit(void);
+
+// Bus-master DMA state; havedma is 0 when using PIO.
+static int havedma;
+static ushort bmbase;
+static struct prd *prdt;
 
 // Wait for IDE disk to become ready.
 static int
@@ -65,35 +114,150 @@ ideinit(void)
     }
   }
 
+  // Let READ/WRITE MULTIPLE move IDE_MAXMULT sectors per interrupt.
+  for(i = 0; i <= havedisk1; i++){
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, IDE_MAXMULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+}
+
+// Look for a bus-master capable IDE controller on the PCI bus
+// and prepare it for DMA on the primary channel.
+static void
+idedmainit(void)
+{
+  struct pcidev d;
+  uint bar;
+
+  if(!pcifindclass(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &d))
+    return;
+  if(((pciread(&d, PCI_CLASS) >> 8) & 0x80) == 0)
+    return;  // programming interface says no bus master
+  bar = pciread(&d, PCI_BAR(4));
+  if((bar & PCI_BAR_IO) == 0 || (bar & ~3) == 0)
+    return;
+  if((prdt = (struct prd*)kalloc()) == 0)
+    return;
+
+  pciwrite(&d, PCI_COMMAND,
+           pciread(&d, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  bmbase = bar & ~3;
+  outb(bmbase + BM_CMD, 0);
+  outb(bmbase + BM_STATUS, BM_ST_DRV0 | BM_ST_DRV1 | BM_ST_ERR | BM_ST_INTR);
+  havedma = 1;
+  cprintf("ide: bus-master DMA at port 0x%x\n", bmbase);
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Fill the PRD table to cover the data of the nbuf bufs
+// starting at b, and point the bus master at it.
+static void
+idedmaprd(struct buf *b, int nbuf)
+{
+  struct prd *p;
+  uint pa, end, n;
+  int dir;
+
+  dir = (b->flags & B_DIRTY) ? 0 : BM_CMD_READ;
+  p = prdt;
+  for(; nbuf > 0; nbuf--, b = b->qnext){
+    pa = V2P(b->data);
+    end = pa + BSIZE;
+    while(pa < end){
+      n = 0x10000 - (pa & 0xFFFF);
+      if(n > end - pa)
+        n = end - pa;
+      p->addr = pa;
+      p->count = n & 0xFFFF;
+      p->flags = 0;
+      pa += n;
+      p++;
+    }
+  }
+  (p-1)->flags = PRD_EOT;
+
+  // The out instructions are no compiler barrier; make sure the
+  // table is in memory before the controller can read it.
+  __sync_synchronize();
+  outl(bmbase + BM_PRDT, V2P(prdt));
+  outb(bmbase + BM_CMD, dir);
+  outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ST_ERR | BM_ST_INTR);
+}
+
+// Does b come before the request at or behind the disk head?
+static int
+idebehind(struct buf *b)
+{
+  return b->dev < headdev || (b->dev == headdev && b->blockno < headblock);
+}
+
+// Should a be served before b in C-LOOK order?
+static int
+ideahead(struct buf *a, struct buf *b)
+{
+  if(idebehind(a) != idebehind(b))
+    return idebehind(b);
+  return a->dev < b->dev || (a->dev == b->dev && a->blockno < b->blockno);
+}
+
+// Start the request for b, together with the queued requests
+// that continue it on disk.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *last, *q;
+  int n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int maxsect = havedma ? IDE_MAXDMA : IDE_MAXMULT;
 
-  if (sector_per_block > 7) panic("idestart");
+  // A block larger than a sector is always moved with one
+  // multiple-sector command.
+  if (sector_per_block > IDE_MAXMULT) panic("idestart");
+
+  // Merge adjacent blocks moving in the same direction.
+  for(n = 1, last = b; (q = last->qnext) != 0; n++, last = q){
+    if((n+1)*sector_per_block > maxsect)
+      break;
+    if(q->dev != b->dev || q->blockno != last->blockno + 1)
+      break;
+    if((q->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+  }
+  if(last->blockno >= FSSIZE)
+    panic("incorrect blockno");
+  idenbuf = n;
+  headdev = b->dev;
+  headblock = b->blockno;
+
+  int nsect = n * sector_per_block;
+  int sector = b->blockno * sector_per_block;
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(havedma){
+    idedmaprd(b, n);
+    outb(0x1f7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(bmbase + BM_CMD, inb(bmbase + BM_CMD) | BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(q = b; n > 0; n--, q = q->qnext)
+      outsl(0x1f0, q->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,6 +268,7 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int n, st;
 
   // First queued buffer is the active request.
   acquire(&idelock);
@@ -112,16 +277,39 @@ ideintr(void)
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(havedma){
+    // Stop the bus master and acknowledge the interrupt.
+    st = inb(bmbase + BM_STATUS);
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, st | BM_ST_ERR | BM_ST_INTR);
+    if((st & BM_ST_ERR) || idewait(1) < 0){
+      // Redo this request, and all later ones, with PIO.
+      cprintf("ide: DMA error, falling back to PIO\n");
+      havedma = 0;
+      idestart(b);
+      release(&idelock);
+      return;
+    }
+  }
+
+  // Finish every buf the command covered.
+  for(n = idenbuf; n > 0; n--){
+    b = idequeue;
+    idequeue = b->qnext;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Read data if needed.
+    if(!havedma && !(b->flags & B_DIRTY) && idewait(1) >= 0)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+    if(b->flags & B_ASYNC)
+      bdone(b);
+  }
+  idenbuf = 0;
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -138,6 +326,7 @@ void
 iderw(struct buf *b)
 {
   struct buf **pp;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -148,18 +337,23 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  // Insert b into idequeue in elevator order, after the
+  // bufs of the command that is running now.
+  pp = &idequeue;
+  for(i = 0; i < idenbuf; i++)
+    pp = &(*pp)->qnext;
+  for(; *pp && !ideahead(b, *pp); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
 
   // Start disk if necessary.
   if(idequeue == b)
     idestart(b);
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+  // Wait for request to finish, unless it is a bprefetch()
+  // that ideintr() will finish.
+  while(!(b->flags & B_ASYNC) && (b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
@@ -28,22 +28,43 @@
 //   block C
 //   ...
 // Log appends are synchronous.
+//
+// With LOGORDERED set, the log runs in ordered mode: writei()
+// sends regular-file data blocks straight to their home location
+// through log_write_data(), before the transaction that links
+// them into an inode commits, and only metadata (inodes, indirect
+// blocks, directories, free map) is logged. A crash can then lose
+// the tail of a write, but never exposes an inode pointing at
+// blocks that were not yet written.
+
+// The log size and the per-op block budget are chosen by mkfs
+// and recorded in the superblock.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  int block[MAXLOGSIZE];
 };
 
 struct log {
   struct spinlock lock;
   int start;
   int size;
+  int opblocks;    // max # of log blocks one FS sys call writes
   int outstanding; // how many FS sys calls are executing.
   int committing;  // in commit(), please wait.
   int dev;
+  int nbitmap;     // number of free map blocks on dev
+  int nmap;        // block map blocks a write may dirty
   struct logheader lh;
+
+  // Free map blocks that bfree() has modified in the current
+  // transaction, with a copy of each as it was before the first
+  // free. See log_freeing().
+  int ncommitted;
+  uint cblock[MAXLOGSIZE];
+  uchar *cdata[MAXLOGSIZE];
 };
 struct log log;
 
@@ -61,7 +82,21 @@ initlog(int dev)
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
+  log.opblocks = sb.opblocks ? sb.opblocks : MAXOPBLOCKS;
+  if (log.size - 1 > MAXLOGSIZE || log.opblocks < MAXOPBLOCKS ||
+      log.opblocks > log.size - 1)
+    panic("initlog: bad log size");
   log.dev = dev;
+  log.nbitmap = (sb.features & FS_GROUPS) ? sb.ngroups : sb.size/BPB + 1;
+  // itrunc() may dirty every free map block in one op.
+  if(log.nbitmap + 3 > log.opblocks)
+    panic("initlog: too many free map blocks");
+  // Blocks of the block map a write may dirty: the indirect block,
+  // or the rightmost path of an extent tree, a new path beside it
+  // and a new root child.
+  log.nmap = (sb.features & FS_EXTENTS) ? 2*EXTMAXDEPTH+1 : 1;
+  if(log_datablocks() < 1)
+    panic("initlog: op blocks too small");
   recover_from_log();
 }
 
@@ -129,7 +164,7 @@ begin_op(void)
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + (log.outstanding+1)*log.opblocks > log.size-1){
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
@@ -189,16 +224,48 @@ write_log(void)
   }
 }
 
+// The transaction is on disk, so the blocks it freed are
+// free in the committed state too.
+static void
+drop_committed(void)
+{
+  int i;
+
+  acquire(&log.lock);
+  for(i = 0; i < log.ncommitted; i++)
+    kfree((char*)log.cdata[i]);
+  log.ncommitted = 0;
+  release(&log.lock);
+}
+
+// Sort the logged block numbers, so that install_trans()
+// sweeps the disk in one direction instead of seeking back
+// and forth in the order the blocks were first modified.
+static void
+sort_head(void)
+{
+  int i, j, b;
+
+  for (i = 1; i < log.lh.n; i++) {
+    b = log.lh.block[i];
+    for (j = i; j > 0 && log.lh.block[j-1] > b; j--)
+      log.lh.block[j] = log.lh.block[j-1];
+    log.lh.block[j] = b;
+  }
+}
+
 static void
 commit()
 {
   if (log.lh.n > 0) {
+    sort_head();
     write_log();     // Write modified blocks from cache to log
     write_head();    // Write header to disk -- the real commit
     install_trans(); // Now install writes to home locations
     log.lh.n = 0;
     write_head();    // Erase the transaction from the log
   }
+  drop_committed();
 }
 
 // Caller has modified b->data and is done with the buffer.
@@ -215,7 +282,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= MAXLOGSIZE || log.lh.n >= log.size - 1)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -232,3 +299,112 @@ log_write(struct buf *b)
   release(&log.lock);
 }
 
+
+// Ordered-mode replacement for log_write() on file data blocks.
+// The block goes straight to its home location, so the data is
+// on disk before the transaction that makes the inode point at
+// it commits. A block that is already part of the transaction
+// keeps going through the log, since install_trans() would
+// otherwise write the older logged copy over it.
+void
+log_write_data(struct buf *b)
+{
+  int i;
+
+  if(!LOGORDERED){
+    log_write(b);
+    return;
+  }
+  if (log.outstanding < 1)
+    panic("log_write_data outside of trans");
+
+  acquire(&log.lock);
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)
+      break;
+  }
+  release(&log.lock);
+
+  if (i < log.lh.n)
+    log_write(b);
+  else
+    bwrite(b);
+}
+
+// bfree() is about to clear bits in free map block b. Keep a
+// copy of b as of the last commit, so that balloc() does not
+// reuse a block freed by this transaction: ordered data written
+// into it would reach the disk while the committed file system
+// still has the old owner pointing at it.
+void
+log_freeing(struct buf *b)
+{
+  int i;
+  uchar *c;
+
+  if(!LOGORDERED)
+    return;
+
+  acquire(&log.lock);
+  for (i = 0; i < log.ncommitted; i++) {
+    if (log.cblock[i] == b->blockno) {
+      release(&log.lock);
+      return;
+    }
+  }
+  if (log.ncommitted >= MAXLOGSIZE || (c = (uchar*)kalloc()) == 0)
+    panic("log_freeing");
+  memmove(c, b->data, BSIZE);
+  log.cblock[log.ncommitted] = b->blockno;
+  log.cdata[log.ncommitted] = c;
+  log.ncommitted++;
+  release(&log.lock);
+}
+
+// Return the committed copy of free map block b saved by
+// log_freeing(), or 0 if this transaction has freed nothing
+// in it. Valid until the transaction commits.
+uchar*
+log_committed(struct buf *b)
+{
+  int i;
+  uchar *c;
+
+  c = 0;
+  acquire(&log.lock);
+  for (i = 0; i < log.ncommitted; i++) {
+    if (log.cblock[i] == b->blockno) {
+      c = log.cdata[i];
+      break;
+    }
+  }
+  release(&log.lock);
+  return c;
+}
+
+// Maximum number of file data blocks that one FS operation
+// may write without exceeding its share of log space.
+int
+log_datablocks(void)
+{
+  int n, max;
+
+  // An extent tree gains at most one new leaf per write if
+  // the write adds no more extents than a leaf holds.
+  max = log.nmap > 1 ? NEXTBLK : MAXFILE;
+
+  // Journaled data: i-node, block map, and 2 blocks of
+  // slop for non-aligned writes, with a possible free map
+  // block for every data block.
+  if(!LOGORDERED)
+    n = (log.opblocks-1-log.nmap-2) / 2;
+
+  // Ordered data: only the i-node, the block map and the
+  // free map blocks are logged, and a write dirties at most
+  // every free map block once.
+  else if(log.nbitmap + 1 + log.nmap <= log.opblocks)
+    n = max;
+  else
+    n = log.opblocks-1-log.nmap-1;
+  return n < max ? n : max;
+}
@@ -0,0 +1,265 @@
+// virtio-blk disk driver, using the legacy PCI interface that
+// QEMU's virtio-blk-pci device offers.
+// Replaces ide.c for the file system disk (see DISK in the
+// Makefile); the boot disk stays on IDE for the boot loader.
+//
+// Unlike the IDE driver, which runs one command at a time, this
+// driver hands every request to the device as soon as iderw()
+// sees it, so up to a third of the queue (three descriptors per
+// request) can be in flight at once.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define SECTOR_SIZE   512
+
+// The virtqueue is shared with the device, which needs it to be
+// physically contiguous and page aligned.
+static char vqmem[VIRTQ_SIZE(VIRTIO_MAXQ)] __attribute__((__aligned__(PGSIZE)));
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  uint qsz;
+  uint nsect;    // capacity in sectors
+
+  struct virtq_desc *desc;
+  struct virtq_avail *avail;
+  struct virtq_used *used;
+
+  char free[VIRTIO_MAXQ];  // is a descriptor free?
+  ushort usedidx;          // we've looked this far in used->ring
+
+  // Per-request state, indexed by the first descriptor of the
+  // request's chain.
+  struct {
+    struct buf *b;
+    struct virtio_blk_req req;
+    uchar status;
+  } info[VIRTIO_MAXQ];
+} disk;
+
+void
+ideinit(void)
+{
+  struct pcidev d;
+  uint bar, i;
+
+  initlock(&disk.lock, "virtio");
+
+  if(!pcifinddev(VIRTIO_VENDOR, VIRTIO_DEV_BLK, &d))
+    panic("virtio: no virtio-blk device");
+  bar = pciread(&d, PCI_BAR(0));
+  if((bar & PCI_BAR_IO) == 0)
+    panic("virtio: no legacy I/O BAR");
+  pciwrite(&d, PCI_COMMAND,
+           pciread(&d, PCI_COMMAND) | PCI_CMD_IO | PCI_CMD_MASTER);
+  disk.iobase = bar & ~3;
+
+  // Reset, then tell the device we know how to drive it.
+  // We need none of its optional features.
+  outb(disk.iobase + VIRTIO_STATUS, 0);
+  outb(disk.iobase + VIRTIO_STATUS, VIRTIO_ST_ACKNOWLEDGE);
+  outb(disk.iobase + VIRTIO_STATUS, VIRTIO_ST_ACKNOWLEDGE | VIRTIO_ST_DRIVER);
+  outl(disk.iobase + VIRTIO_GUEST_FEATURES, 0);
+
+  // Set up queue 0.
+  outw(disk.iobase + VIRTIO_QUEUE_SEL, 0);
+  disk.qsz = inw(disk.iobase + VIRTIO_QUEUE_SIZE);
+  if(disk.qsz == 0 || disk.qsz > VIRTIO_MAXQ)
+    panic("virtio: bad queue size");
+  memset(vqmem, 0, VIRTQ_SIZE(disk.qsz));
+  disk.desc = (struct virtq_desc*)vqmem;
+  disk.avail = (struct virtq_avail*)(vqmem + VIRTQ_AVAIL_OFF(disk.qsz));
+  disk.used = (struct virtq_used*)(vqmem + VIRTQ_USED_OFF(disk.qsz));
+  outl(disk.iobase + VIRTIO_QUEUE_PFN, V2P(vqmem) / PGSIZE);
+  for(i = 0; i < disk.qsz; i++)
+    disk.free[i] = 1;
+
+  disk.nsect = inl(disk.iobase + VIRTIO_CONFIG);
+  outb(disk.iobase + VIRTIO_STATUS,
+       VIRTIO_ST_ACKNOWLEDGE | VIRTIO_ST_DRIVER | VIRTIO_ST_DRIVER_OK);
+
+  diskirq = pciread(&d, PCI_INTR) & 0xFF;
+  ioapicenable(diskirq, ncpu - 1);
+  cprintf("virtio: disk %d sectors, queue %d, irq %d\n",
+          disk.nsect, disk.qsz, diskirq);
+}
+
+// Find a free descriptor, mark it non-free, return its index.
+static int
+alloc_desc(void)
+{
+  int i;
+
+  for(i = 0; i < disk.qsz; i++){
+    if(disk.free[i]){
+      disk.free[i] = 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Mark a descriptor as free.
+static void
+free_desc(int i)
+{
+  if(i >= disk.qsz || disk.free[i])
+    panic("virtio: free_desc");
+  disk.desc[i].addr = 0;
+  disk.desc[i].len = 0;
+  disk.desc[i].flags = 0;
+  disk.desc[i].next = 0;
+  disk.free[i] = 1;
+  wakeup(&disk.free[0]);
+}
+
+// Free a chain of descriptors.
+static void
+free_chain(int i)
+{
+  int flag, nxt;
+
+  for(;;){
+    flag = disk.desc[i].flags;
+    nxt = disk.desc[i].next;
+    free_desc(i);
+    if(!(flag & VRING_DESC_F_NEXT))
+      break;
+    i = nxt;
+  }
+}
+
+// Allocate three descriptors (they need not be contiguous).
+// Disk transfers always use three descriptors.
+static int
+alloc3_desc(int *idx)
+{
+  int i, j;
+
+  for(i = 0; i < 3; i++){
+    idx[i] = alloc_desc();
+    if(idx[i] < 0){
+      for(j = 0; j < i; j++)
+        free_desc(idx[j]);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void
+setdesc(int i, void *va, uint len, int flags, int next)
+{
+  disk.desc[i].addr = V2P(va);
+  disk.desc[i].addrhi = 0;
+  disk.desc[i].len = len;
+  disk.desc[i].flags = flags;
+  disk.desc[i].next = next;
+}
+
+// Interrupt handler: finish every request the device has
+// put in the used ring.
+void
+ideintr(void)
+{
+  struct buf *b;
+  int id;
+
+  acquire(&disk.lock);
+
+  // Reading the ISR acknowledges the interrupt. Requests that
+  // complete after this raise a new one.
+  inb(disk.iobase + VIRTIO_ISR);
+
+  while(disk.usedidx != disk.used->idx){
+    __sync_synchronize();
+    id = disk.used->ring[disk.usedidx % disk.qsz].id;
+
+    if(disk.info[id].status != 0)
+      panic("virtio: request failed");
+
+    b = disk.info[id].b;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    wakeup(b);
+    if(b->flags & B_ASYNC)
+      bdone(b);
+
+    disk.info[id].b = 0;
+    free_chain(id);
+    disk.usedidx++;
+  }
+
+  release(&disk.lock);
+}
+
+//PAGEBREAK!
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  int idx[3];
+  uint sector;
+  struct virtio_blk_req *req;
+
+  if(!holdingsleep(&b->lock))
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->dev != 1)
+    panic("iderw: request not for disk 1");
+  sector = b->blockno * (BSIZE / SECTOR_SIZE);
+  if(sector + BSIZE / SECTOR_SIZE > disk.nsect)
+    panic("iderw: block out of range");
+
+  acquire(&disk.lock);
+
+  // Wait for the device to retire enough requests to give us
+  // a descriptor chain.
+  while(alloc3_desc(idx) != 0)
+    sleep(&disk.free[0], &disk.lock);
+
+  req = &disk.info[idx[0]].req;
+  req->type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  req->reserved = 0;
+  req->sector = sector;
+  req->sectorhi = 0;
+
+  setdesc(idx[0], req, sizeof(*req), VRING_DESC_F_NEXT, idx[1]);
+  setdesc(idx[1], b->data, BSIZE,
+          VRING_DESC_F_NEXT | ((b->flags & B_DIRTY) ? 0 : VRING_DESC_F_WRITE),
+          idx[2]);
+  disk.info[idx[0]].status = 0xff;  // device writes 0 on success
+  setdesc(idx[2], &disk.info[idx[0]].status, 1, VRING_DESC_F_WRITE, 0);
+  disk.info[idx[0]].b = b;
+
+  // Tell the device the first index in our chain of descriptors.
+  disk.avail->ring[disk.avail->idx % disk.qsz] = idx[0];
+  __sync_synchronize();
+  disk.avail->idx++;
+  __sync_synchronize();
+  outw(disk.iobase + VIRTIO_QUEUE_NOTIFY, 0);
+
+  // Wait for request to finish, unless it is a bprefetch()
+  // that ideintr() will finish.
+  while(!(b->flags & B_ASYNC) && (b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &disk.lock);
+
+  release(&disk.lock);
+}
@@ -54,6 +54,12 @@ cat_plain(int fd)
 {
   int n;
 
+  // The kernel can move a file to a pipe or the console, or a
+  // pipe to a file, by itself; anything else is copied here.
+  while((n = splice(fd, 1, 64*1024)) > 0)
+    ;
+  if(n == 0)
+    return;
   while((n = read(fd, buf, sizeof(buf))) > 0) {
     if (write(1, buf, n) != n) {
       printf(1, "cat: write error\n");
@@ -0,0 +1,838 @@
+// Tests of the file system's larger files and of the I/O
+// system calls beyond read and write. They live apart from
+// usertests, which has to stay under MAXFILE blocks to fit in
+// an fs.img without extents.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "poll.h"
+#include "uio.h"
+#include "ioring.h"
+#include "batch.h"
+#include "syscall.h"
+
+char buf[8192];
+int stdout = 1;
+
+// Write past MAXFILE, which only an extent-mapped
+// file system (mkfs -e) allows.
+void
+hugefile(void)
+{
+  int i, fd, n;
+
+  printf(stdout, "huge file test\n");
+
+  fd = open("huge", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "error: creat huge failed!\n");
+    exit();
+  }
+  for(i = 0; i < 2*MAXFILE; i++){
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, BSIZE) != BSIZE)
+      break;
+  }
+  close(fd);
+  if(i == MAXFILE){
+    unlink("huge");
+    printf(stdout, "huge file test skipped: no extents\n");
+    return;
+  }
+  if(i != 2*MAXFILE){
+    printf(stdout, "error: write huge file failed at block %d\n", i);
+    exit();
+  }
+
+  fd = open("huge", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "error: open huge failed!\n");
+    exit();
+  }
+  for(n = 0; read(fd, buf, BSIZE) == BSIZE; n++){
+    if(((int*)buf)[0] != n){
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+  }
+  close(fd);
+  if(n != 2*MAXFILE){
+    printf(stdout, "read only %d blocks from huge\n", n);
+    exit();
+  }
+  if(unlink("huge") < 0){
+    printf(stdout, "unlink huge failed\n");
+    exit();
+  }
+  printf(stdout, "huge file ok\n");
+}
+
+// Grow a file a few bytes at a time, so that it starts out with
+// its data in the i-node and moves to a block partway through.
+void
+smallfile(void)
+{
+  int i, fd;
+
+  printf(stdout, "small file test\n");
+
+  fd = open("small", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    if(write(fd, &i, 1) != 1){
+      printf(stdout, "error: write small failed at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("small", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 100){
+    printf(stdout, "error: read small failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < 100; i++){
+    if(buf[i] != i){
+      printf(stdout, "small file byte %d is %d\n", i, buf[i]);
+      exit();
+    }
+  }
+  if(unlink("small") < 0){
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file ok\n");
+}
+
+// Push 4 MB through a pipe in large writes whose size is not a
+// multiple of the pipe's pages, and report how long it took.
+void
+pipebench(void)
+{
+  int fds[2], pid, t0;
+  int seq, i, n, total;
+
+  printf(1, "pipebench test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  t0 = uptime();
+  pid = fork();
+  seq = 0;
+  if(pid == 0){
+    close(fds[0]);
+    for(total = 0; total < 4*1024*1024; total += n){
+      n = 4*1024*1024 - total;
+      if(n > 8191)
+        n = 8191;
+      for(i = 0; i < n; i++)
+        buf[i] = seq++;
+      if(write(fds[1], buf, n) != n){
+        printf(1, "pipebench write failed\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+    close(fds[1]);
+    total = 0;
+    while((n = read(fds[0], buf, sizeof(buf))) > 0){
+      for(i = 0; i < n; i++){
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+          printf(1, "pipebench: wrong byte at %d\n", total + i);
+          exit();
+        }
+      }
+      total += n;
+    }
+    close(fds[0]);
+    wait();
+    if(total != 4*1024*1024){
+      printf(1, "pipebench: read %d bytes\n", total);
+      exit();
+    }
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipebench ok, 4096 KB in %d ticks\n", uptime() - t0);
+}
+
+// Page-aligned pipe transfers pass the writer's pages to the
+// reader instead of copying; the writer reusing its buffer must
+// not change what the reader gets. Every eighth round is read
+// in small pieces, which copies out of the passed pages.
+void
+pipepages(void)
+{
+  int fds[2], pid, t0, round, pg, i, n, pad;
+  char *a;
+
+  printf(1, "pipepages test\n");
+  a = sbrk(0);
+  pad = 4096 - (uint)a % 4096;
+  if(sbrk(pad + 4*4096) == (char*)-1){
+    printf(1, "pipepages: sbrk failed\n");
+    exit();
+  }
+  a += pad;
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  t0 = uptime();
+  pid = fork();
+  if(pid == 0){
+    close(fds[0]);
+    for(round = 0; round < 256; round++){
+      for(pg = 0; pg < 4; pg++){
+        a[pg*4096] = round;
+        a[pg*4096 + 4095] = pg;
+      }
+      if(write(fds[1], a, 4*4096) != 4*4096){
+        printf(1, "pipepages write failed\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  close(fds[1]);
+  for(round = 0; round < 256; round++){
+    for(pg = 0; pg < 4; pg++){
+      if(round % 8 == 7){
+        for(i = 0; i < 4096; i += n)
+          if((n = read(fds[0], buf + i, 4096 - i < 1000 ? 4096 - i : 1000)) <= 0)
+            break;
+        memmove(a + pg*4096, buf, 4096);
+      } else
+        i = read(fds[0], a + pg*4096, 4096);
+      if(i != 4096){
+        printf(1, "pipepages: short read\n");
+        exit();
+      }
+      if(a[pg*4096] != (char)round || a[pg*4096 + 4095] != pg){
+        printf(1, "pipepages: round %d page %d wrong\n", round, pg);
+        exit();
+      }
+      a[pg*4096] = -1;
+    }
+  }
+  if(read(fds[0], buf, 1) != 0){
+    printf(1, "pipepages: extra data\n");
+    exit();
+  }
+  close(fds[0]);
+  wait();
+  sbrk(-(pad + 4*4096));
+  printf(1, "pipepages ok, 4096 KB in %d ticks\n", uptime() - t0);
+}
+
+// With memory used up, a read into a page still shared with a
+// pipe fails, rather than the kernel faulting on its write.
+void
+cowoom(void)
+{
+  int fds[2], pid;
+  char *a;
+
+  printf(1, "cowoom test\n");
+  pid = fork();
+  if(pid == 0){
+    a = sbrk(0);
+    a = sbrk(4096 - (uint)a % 4096 + 4096) + (4096 - (uint)a % 4096);
+    if(pipe(fds) != 0 || write(fds[1], a, 4096) != 4096){
+      printf(1, "cowoom: pipe write failed\n");
+      exit();
+    }
+    write(fds[1], "x", 1);
+    while(sbrk(4096) != (char*)-1)
+      ;
+    if(read(fds[0], a + 1, 10) != -1 ||
+       fstat(fds[0], (struct stat*)(a + 8)) != -1){
+      printf(1, "cowoom: read into a shared page with no memory\n");
+      exit();
+    }
+    printf(1, "cowoom ok\n");
+    exit();
+  } else if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  wait();
+}
+
+// poll() on two pipes wakes for the one that gets data, times
+// out when neither does, and reports a closed writer.
+void
+polltest(void)
+{
+  int a[2], b[2], pid, n;
+  struct pollfd pfd[3];
+  char c;
+
+  printf(1, "poll test\n");
+  if(pipe(a) != 0 || pipe(b) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pfd[0].fd = a[0];
+  pfd[0].events = POLLIN;
+  pfd[1].fd = b[0];
+  pfd[1].events = POLLIN;
+  pfd[2].fd = a[1];
+  pfd[2].events = POLLOUT;
+  if(poll(pfd, 3, 0) != 1 || pfd[0].revents || pfd[1].revents ||
+     pfd[2].revents != POLLOUT){
+    printf(1, "poll: empty pipes not reported right\n");
+    exit();
+  }
+  if(poll(pfd, 2, 3) != 0){
+    printf(1, "poll: no timeout\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    sleep(2);
+    write(b[1], "x", 1);
+    exit();
+  } else if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  n = poll(pfd, 2, -1);
+  if(n != 1 || pfd[0].revents || pfd[1].revents != POLLIN ||
+     read(b[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "poll: wrong wakeup, %d ready\n", n);
+    exit();
+  }
+  wait();
+  close(b[1]);
+  if(poll(pfd, 2, -1) != 1 || !(pfd[1].revents & POLLHUP) ||
+     read(b[0], &c, 1) != 0){
+    printf(1, "poll: closed pipe not reported\n");
+    exit();
+  }
+  close(a[0]);
+  close(a[1]);
+  close(b[0]);
+  printf(1, "poll ok\n");
+}
+
+// Reads and writes on an O_NONBLOCK pipe return EWOULDBLOCK
+// rather than waiting, and a write to a nearly full one
+// returns what fit.
+void
+nonblock(void)
+{
+  int fds[2], n, total;
+
+  printf(1, "nonblock test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+     fcntl(fds[0], F_GETFL, 0) != (O_RDONLY|O_NONBLOCK)){
+    printf(1, "nonblock: fcntl failed\n");
+    exit();
+  }
+  if(read(fds[0], buf, 1) != EWOULDBLOCK){
+    printf(1, "nonblock: read of empty pipe did not fail\n");
+    exit();
+  }
+  for(total = 0; (n = write(fds[1], buf, 1000)) == 1000; total += n)
+    ;
+  if(n < 0 || write(fds[1], buf, 1) != EWOULDBLOCK){
+    printf(1, "nonblock: write to full pipe did not fail\n");
+    exit();
+  }
+  total += n;
+  for(n = 0; (n = read(fds[0], buf, sizeof(buf))) > 0; total -= n)
+    ;
+  if(n != EWOULDBLOCK || total != 0){
+    printf(1, "nonblock: read back %d too few bytes\n", total);
+    exit();
+  }
+  close(fds[1]);
+  if(read(fds[0], buf, 1) != 0){
+    printf(1, "nonblock: no end of file\n");
+    exit();
+  }
+  close(fds[0]);
+  printf(1, "nonblock ok\n");
+}
+
+// lseek moves the offset only within the file; pread and
+// pwrite take their own offset and leave the file's alone.
+void
+seektest(void)
+{
+  int fd;
+  char b[4];
+
+  printf(1, "seek test\n");
+  fd = open("seekfile", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "abcdefghij", 10) != 10){
+    printf(1, "seek: create failed\n");
+    exit();
+  }
+  if(lseek(fd, 3, SEEK_SET) != 3 || read(fd, b, 2) != 2 ||
+     b[0] != 'd' || b[1] != 'e' || lseek(fd, -1, SEEK_CUR) != 4 ||
+     lseek(fd, 0, SEEK_END) != 10 || lseek(fd, 1, SEEK_END) != -1 ||
+     lseek(fd, -11, SEEK_CUR) != -1){
+    printf(1, "seek: lseek wrong\n");
+    exit();
+  }
+  lseek(fd, 5, SEEK_SET);
+  if(pwrite(fd, "XY", 2, 1) != 2 || pread(fd, b, 3, 0) != 3 ||
+     b[0] != 'a' || b[1] != 'X' || b[2] != 'Y' ||
+     pread(fd, b, 3, 10) != 0 || pwrite(fd, "Z", 1, 11) != -1 ||
+     lseek(fd, 0, SEEK_CUR) != 5){
+    printf(1, "seek: pread/pwrite wrong\n");
+    exit();
+  }
+  close(fd);
+  unlink("seekfile");
+  printf(1, "seek ok\n");
+}
+
+// writev writes its buffers in order as one write, and readv
+// fills its buffers in order, stopping at the end of the file.
+void
+iovtest(void)
+{
+  struct iovec iov[3];
+  char a[4], b[8];
+  int fd;
+
+  printf(1, "iov test\n");
+  fd = open("iovfile", O_CREATE|O_RDWR);
+  iov[0].iov_base = "abc";
+  iov[0].iov_len = 3;
+  iov[1].iov_base = "";
+  iov[1].iov_len = 0;
+  iov[2].iov_base = "defgh";
+  iov[2].iov_len = 5;
+  if(fd < 0 || writev(fd, iov, 3) != 8){
+    printf(1, "iov: writev failed\n");
+    exit();
+  }
+  iov[1].iov_base = (char*)-1;
+  iov[1].iov_len = 1;
+  if(writev(fd, iov, 3) != -1){
+    printf(1, "iov: writev of bad buffer succeeded\n");
+    exit();
+  }
+  close(fd);
+  fd = open("iovfile", O_RDONLY);
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = b;
+  iov[1].iov_len = sizeof(b);
+  if(readv(fd, iov, 2) != 8 || a[0] != 'a' || a[3] != 'd' ||
+     b[0] != 'e' || b[3] != 'h'){
+    printf(1, "iov: readv wrong\n");
+    exit();
+  }
+  close(fd);
+  unlink("iovfile");
+  printf(1, "iov ok\n");
+}
+
+// getdents returns every entry of a directory once, skipping
+// unused slots, with DENT_STAT's type and size matching stat().
+void
+getdentstest(void)
+{
+  struct direntplus de[3];
+  struct stat st;
+  char name[3];
+  int fd, i, n, seen;
+
+  printf(1, "getdents test\n");
+  if(mkdir("gdd") != 0 || chdir("gdd") != 0){
+    printf(1, "getdents: mkdir failed\n");
+    exit();
+  }
+  name[0] = 'f';
+  name[2] = 0;
+  for(i = 0; i < 10; i++){
+    name[1] = '0' + i;
+    fd = open(name, O_CREATE|O_RDWR);
+    write(fd, "xxxxxxxxxx", i);
+    close(fd);
+  }
+  unlink("f3");
+  fd = open(".", O_RDONLY);
+  seen = 0;
+  while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+    for(i = 0; i < n / sizeof(de[0]); i++){
+      if(de[i].name[0] != 'f')
+        continue;
+      if(stat(de[i].name, &st) < 0 || st.ino != de[i].inum ||
+         st.type != de[i].type || st.size != de[i].size ||
+         de[i].size != de[i].name[1] - '0'){
+        printf(1, "getdents: %s wrong\n", de[i].name);
+        exit();
+      }
+      seen |= 1 << (de[i].name[1] - '0');
+    }
+  }
+  close(fd);
+  if(n < 0 || seen != (0x3ff & ~(1 << 3))){
+    printf(1, "getdents: saw %x\n", seen);
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    name[1] = '0' + i;
+    unlink(name);
+  }
+  chdir("..");
+  unlink("gdd");
+  printf(1, "getdents ok\n");
+}
+
+// splice moves a file into a pipe and a pipe into a file
+// without the data passing through user memory, and refuses
+// file-to-file.
+void
+splicetest(void)
+{
+  int fds[2], fd, fd2, pid, i, n;
+
+  printf(1, "splice test\n");
+  fd = open("splicein", O_CREATE|O_RDWR);
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i * 7;
+  for(i = 0; i < 5; i++)
+    write(fd, buf, sizeof(buf));
+  close(fd);
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    close(fds[0]);
+    fd = open("splicein", O_RDONLY);
+    read(fd, buf, 3);
+    for(n = 0; (i = splice(fd, fds[1], 4000)) > 0; n += i)
+      ;
+    if(i < 0 || n != 5*sizeof(buf) - 3){
+      printf(1, "splice: file to pipe moved %d\n", n);
+      exit();
+    }
+    exit();
+  } else if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  close(fds[1]);
+  fd = open("spliceout", O_CREATE|O_RDWR);
+  for(n = 0; (i = splice(fds[0], fd, 1 << 20)) > 0; n += i)
+    ;
+  close(fds[0]);
+  wait();
+  close(fd);
+  if(i < 0 || n != 5*sizeof(buf) - 3){
+    printf(1, "splice: pipe to file moved %d\n", n);
+    exit();
+  }
+  fd = open("spliceout", O_RDWR);
+  for(i = 0; i < n; i++){
+    if(read(fd, buf, 1) != 1 || buf[0] != (char)((i + 3) % sizeof(buf) * 7)){
+      printf(1, "splice: byte %d wrong\n", i);
+      exit();
+    }
+  }
+  fd2 = open("splicein", O_RDONLY);
+  if(splice(fd2, fd, 10) != -1){
+    printf(1, "splice: file to file succeeded\n");
+    exit();
+  }
+  close(fd);
+  close(fd2);
+  unlink("splicein");
+  unlink("spliceout");
+  printf(1, "splice ok\n");
+}
+
+// Queue a request in ring r.
+void
+ioqueue(struct ioring *r, int op, int fd, char *p, int n, uint off)
+{
+  struct iosqe *e;
+
+  e = &IORING_SQ(r)[r->sqtail % r->nentries];
+  e->op = op;
+  e->fd = fd;
+  e->buf = p;
+  e->n = n;
+  e->off = off;
+  e->user = r->sqtail;
+  r->sqtail++;
+}
+
+// ioring_enter() does the requests queued in the ring in order,
+// across several trips around it, and posts their results.
+void
+ioringtest(void)
+{
+  static uint ring[IORING_SIZE(8) / sizeof(uint)];
+  struct ioring *r = (struct ioring*)ring;
+  struct iocqe *c;
+  char out[6][64];
+  int fd, i, j, round;
+
+  printf(1, "ioring test\n");
+  fd = open("ioring", O_CREATE|O_RDWR);
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i * 3;
+  write(fd, buf, sizeof(buf));
+  if(ioring_setup(r, 8) != 0 || r->nentries != 8){
+    printf(1, "ioring_setup failed\n");
+    exit();
+  }
+  for(round = 0; round < 3; round++){
+    for(i = 0; i < 6; i++)
+      ioqueue(r, IORING_OP_READ, fd, out[i], 64, i*1000 + round);
+    ioqueue(r, IORING_OP_WRITE, fd, "xyz", 3, 8000 + round);
+    ioqueue(r, IORING_OP_READ, 99, out[0], 64, 0);
+    if(ioring_enter(8) != 8 || r->sqhead != r->sqtail ||
+       r->cqtail - r->cqhead != 8){
+      printf(1, "ioring: round %d not done\n", round);
+      exit();
+    }
+    for(i = 0; i < 8; i++){
+      c = &IORING_CQ(r)[r->cqhead % r->nentries];
+      if(c->user != round*8 + i || c->res != (i < 6 ? 64 : i == 6 ? 3 : -1)){
+        printf(1, "ioring: result %d is %d\n", c->user, c->res);
+        exit();
+      }
+      r->cqhead++;
+    }
+    for(i = 0; i < 6; i++)
+      for(j = 0; j < 64; j++)
+        if(out[i][j] != (char)((i*1000 + round + j) * 3)){
+          printf(1, "ioring: read %d wrong\n", i);
+          exit();
+        }
+  }
+  if(pread(fd, out[0], 5, 8000) != 5 || out[0][0] != 'x' || out[0][2] != 'x' ||
+     out[0][4] != 'z'){
+    printf(1, "ioring: write wrong\n");
+    exit();
+  }
+  if(ioring_enter(1) != 0){
+    printf(1, "ioring: empty ring did something\n");
+    exit();
+  }
+  close(fd);
+  unlink("ioring");
+  printf(1, "ioring ok\n");
+}
+
+// Set ops[i] to system call num with arguments a0..a2, the
+// ones in link naming earlier calls.
+void
+setop(struct sysop *ops, int i, int num, int link, int a0, int a1, int a2)
+{
+  ops[i].num = num;
+  ops[i].link = link;
+  ops[i].args[0] = a0;
+  ops[i].args[1] = a1;
+  ops[i].args[2] = a2;
+  ops[i].ret = 0;
+}
+
+// batch() passes results between calls, leaving the links as
+// they were, stops at a failure with BATCH_ABORT, and refuses
+// fork().
+void
+batchtest(void)
+{
+  struct sysop ops[6];
+  struct stat st;
+
+  printf(1, "batch test\n");
+  setop(ops, 0, SYS_open, 0, (int)"batchf", O_CREATE|O_RDWR, 0);
+  setop(ops, 1, SYS_write, 1, 0, (int)"hello", 5);
+  setop(ops, 2, SYS_fstat, 1, 0, (int)&st, 0);
+  setop(ops, 3, SYS_close, 1, 0, 0, 0);
+  setop(ops, 4, SYS_close, 1, 0, 0, 0);
+  setop(ops, 5, SYS_getpid, 0, 0, 0, 0);
+  if(batch(ops, 6, BATCH_ABORT) != 5 || ops[0].ret < 0 || ops[1].ret != 5 ||
+     ops[2].ret != 0 || st.size != 5 || ops[3].ret != 0 || ops[4].ret != -1 ||
+     ops[5].ret != 0 || ops[1].args[0] != 0 || ops[3].args[0] != 0){
+    printf(1, "batch: wrong results\n");
+    exit();
+  }
+  setop(ops, 0, SYS_getpid, 0, 0, 0, 0);
+  setop(ops, 1, SYS_fork, 0, 0, 0, 0);
+  setop(ops, 2, SYS_unlink, 0, (int)"batchf", 0, 0);
+  setop(ops, 3, SYS_close, 1, 3, 0, 0);
+  if(batch(ops, 4, 0) != 4 || ops[0].ret != getpid() || ops[1].ret != -1 ||
+     ops[2].ret != 0 || ops[3].ret != -1){
+    printf(1, "batch: forked or linked forward\n");
+    exit();
+  }
+  printf(1, "batch ok\n");
+}
+
+// Report what getpid(), and open(), fstat() and close() of a
+// file, cost made with a trap each and made with batch().
+void
+batchbench(void)
+{
+  static struct sysop ops[BATCH_MAX];
+  struct stat st;
+  int i, j, fd, t0, t1, t2, t3, t4;
+
+  printf(1, "batchbench test\n");
+  for(i = 0; i < BATCH_MAX; i++)
+    setop(ops, i, SYS_getpid, 0, 0, 0, 0);
+  t0 = uptime();
+  for(i = 0; i < 1000*BATCH_MAX; i++)
+    getpid();
+  t1 = uptime();
+  for(i = 0; i < 1000; i++)
+    if(batch(ops, BATCH_MAX, 0) != BATCH_MAX){
+      printf(1, "batchbench: batch failed\n");
+      exit();
+    }
+
+  fd = open("batchbf", O_CREATE|O_RDWR);
+  close(fd);
+  t2 = uptime();
+  for(i = 0; i < 100*(BATCH_MAX/3); i++){
+    fd = open("batchbf", O_RDONLY);
+    fstat(fd, &st);
+    close(fd);
+  }
+  t3 = uptime();
+  for(j = 0; j + 3 <= BATCH_MAX; j += 3){
+    setop(ops, j, SYS_open, 0, (int)"batchbf", O_RDONLY, 0);
+    setop(ops, j+1, SYS_fstat, 1, j, (int)&st, 0);
+    setop(ops, j+2, SYS_close, 1, j, 0, 0);
+  }
+  for(i = 0; i < 100; i++){
+    if(batch(ops, j, BATCH_ABORT) != j || ops[j-1].ret != 0){
+      printf(1, "batchbench: open batch failed\n");
+      exit();
+    }
+  }
+  t4 = uptime();
+  unlink("batchbf");
+  printf(1, "batchbench ok, %d getpid %d/%d ticks, %d open/fstat/close %d/%d ticks"
+         " (trap each/batched)\n", 1000*BATCH_MAX, t1 - t0, t2 - t1,
+         100*(BATCH_MAX/3), t3 - t2, t4 - t3);
+}
+
+// four processes read the same file at the same time, each
+// through its own file descriptor, so they share its i-node lock.
+void
+fourreaders(void)
+{
+  int fd, pid, i, j, n, pass, off, t0;
+
+  printf(1, "fourreaders test\n");
+
+  unlink("fourreaders");
+  fd = open("fourreaders", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "create fourreaders failed\n");
+    exit();
+  }
+  for(i = 0; i < 32; i++){
+    for(j = 0; j < 2000; j++)
+      buf[j] = (i*2000 + j) % 251;
+    if(write(fd, buf, 2000) != 2000){
+      printf(1, "write fourreaders failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  t0 = uptime();
+  for(i = 0; i < 4; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      for(pass = 0; pass < 8; pass++){
+        fd = open("fourreaders", 0);
+        if(fd < 0){
+          printf(1, "open fourreaders failed\n");
+          exit();
+        }
+        off = 0;
+        while((n = read(fd, buf, 1000)) > 0){
+          for(j = 0; j < n; j++){
+            if((uchar)buf[j] != (off + j) % 251){
+              printf(1, "fourreaders: wrong byte at %d\n", off + j);
+              exit();
+            }
+          }
+          off += n;
+        }
+        close(fd);
+        if(off != 32*2000){
+          printf(1, "fourreaders: read %d bytes\n", off);
+          exit();
+        }
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+
+  unlink("fourreaders");
+  printf(1, "fourreaders ok, %d ticks\n", uptime() - t0);
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "iotests starting\n");
+
+  fourreaders();
+  hugefile();
+  smallfile();
+
+  pipebench();
+  pipepages();
+  cowoom();
+  polltest();
+  nonblock();
+  seektest();
+  iovtest();
+  getdentstest();
+  splicetest();
+  ioringtest();
+  batchtest();
+  batchbench();
+
+  printf(1, "iotests ok\n");
+  exit();
+}
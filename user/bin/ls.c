@@ -78,8 +78,8 @@ void
 ls(char *path)
 {
   char buf[512], *p;
-  int fd;
-  struct dirent de;
+  int fd, i, n;
+  struct direntplus de[16];
   struct stat st;
 
   if((fd = open(path, 0)) < 0){
@@ -110,16 +110,18 @@ ls(char *path)
     strcpy(buf, path);
     p = buf+strlen(buf);
     *p++ = '/';
-    while(read(fd, &de, sizeof(de)) == sizeof(de)){
-      if(de.inum == 0)
-        continue;
-      memmove(p, de.name, DIRSIZ);
-      p[DIRSIZ] = 0;
-      if(stat(buf, &st) < 0){
-        printf(1, "ls: cannot stat %s\n", buf);
-        continue;
+    // Each entry comes with its inode's type and size, so
+    // there is no need to stat() it.
+    while((n = getdents(fd, de, sizeof(de), DENT_STAT)) > 0){
+      for(i = 0; i < n / sizeof(de[0]); i++){
+        memmove(p, de[i].name, DIRSIZ);
+        p[DIRSIZ] = 0;
+        st.type = de[i].type;
+        st.ino = de[i].inum;
+        st.nlink = de[i].nlink;
+        st.size = de[i].size;
+        emit_entry(buf, p, &st);
       }
-      emit_entry(buf, p, &st);
     }
     break;
   }
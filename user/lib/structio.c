@@ -3,58 +3,128 @@
 #include "structio.h"
 
 static void
-write_str(int fd, const char *s)
+flush(struct struct_writer *w)
+{
+  if(w->niov > 0)
+    writev(w->fd, w->iov, w->niov);
+  w->niov = 0;
+  w->nbuf = 0;
+}
+
+// Add the n bytes at s to the record, without copying them.
+static void
+put(struct struct_writer *w, const char *s, int n)
+{
+  struct iovec *last;
+
+  if(n <= 0)
+    return;
+  if(w->niov > 0){
+    last = &w->iov[w->niov - 1];
+    if((const char*)last->iov_base + last->iov_len == s){
+      last->iov_len += n;
+      return;
+    }
+  }
+  if(w->niov == STRUCT_NIOV)
+    flush(w);
+  w->iov[w->niov].iov_base = (void*)s;
+  w->iov[w->niov].iov_len = n;
+  w->niov++;
+}
+
+// Add a copy of the n bytes at s to the record.
+static void
+putcopy(struct struct_writer *w, const char *s, int n)
+{
+  if(w->nbuf + n > STRUCT_BUFSZ || w->niov == STRUCT_NIOV)
+    flush(w);
+  memmove(w->buf + w->nbuf, s, n);
+  put(w, w->buf + w->nbuf, n);
+  w->nbuf += n;
+}
+
+static void
+put_str(struct struct_writer *w, const char *s)
 {
   if(s)
-    write(fd, s, strlen(s));
+    put(w, s, strlen(s));
 }
 
+// Runs of plain characters go in as they are; only the
+// escapes are generated.
 static void
-write_escaped(int fd, const char *s)
+put_escaped(struct struct_writer *w, const char *s)
 {
   static const char *hex = "0123456789abcdef";
+  const char *run;
   char buf[6];
 
-  for(; *s; s++){
+  for(run = s; *s; s++){
     char c = *s;
+    const char *esc;
+
     switch(c){
     case '"':
-      write(fd, "\\\"", 2);
+      esc = "\\\"";
       break;
     case '\\':
-      write(fd, "\\\\", 2);
+      esc = "\\\\";
       break;
     case '\n':
-      write(fd, "\\n", 2);
+      esc = "\\n";
       break;
     case '\r':
-      write(fd, "\\r", 2);
+      esc = "\\r";
       break;
     case '\t':
-      write(fd, "\\t", 2);
+      esc = "\\t";
       break;
     default:
-      if((uchar)c < 0x20){
-        buf[0] = '\\';
-        buf[1] = 'u';
-        buf[2] = '0';
-        buf[3] = '0';
-        buf[4] = hex[(c >> 4) & 0xf];
-        buf[5] = hex[c & 0xf];
-        write(fd, buf, sizeof(buf));
-      } else {
-        write(fd, &c, 1);
-      }
+      if((uchar)c >= 0x20)
+        continue;
+      esc = 0;
       break;
     }
+    put(w, run, s - run);
+    run = s + 1;
+    if(esc){
+      put(w, esc, 2);
+    } else {
+      buf[0] = '\\';
+      buf[1] = 'u';
+      buf[2] = '0';
+      buf[3] = '0';
+      buf[4] = hex[(c >> 4) & 0xf];
+      buf[5] = hex[c & 0xf];
+      putcopy(w, buf, sizeof(buf));
+    }
   }
+  put(w, run, s - run);
+}
+
+static void
+put_int(struct struct_writer *w, int value)
+{
+  char buf[12];
+  int i;
+  uint x;
+
+  x = value < 0 ? -(uint)value : value;
+  i = sizeof(buf);
+  do {
+    buf[--i] = '0' + x % 10;
+  } while((x /= 10) != 0);
+  if(value < 0)
+    buf[--i] = '-';
+  putcopy(w, buf + i, sizeof(buf) - i);
 }
 
 static void
 begin_field(struct struct_writer *w)
 {
   if(w->need_comma)
-    write(w->fd, ",", 1);
+    put(w, ",", 1);
   else
     w->need_comma = 1;
 }
@@ -64,32 +134,35 @@ struct_begin(struct struct_writer *w, int fd)
 {
   w->fd = fd;
   w->need_comma = 0;
-  write(fd, "{", 1);
+  w->niov = 0;
+  w->nbuf = 0;
+  put(w, "{", 1);
 }
 
 void
 struct_field_str(struct struct_writer *w, const char *key, const char *value)
 {
   begin_field(w);
-  write(w->fd, "\"", 1);
-  write_str(w->fd, key ? key : "");
-  write(w->fd, "\":\"", 3);
-  write_escaped(w->fd, value ? value : "");
-  write(w->fd, "\"", 1);
+  put(w, "\"", 1);
+  put_str(w, key ? key : "");
+  put(w, "\":\"", 3);
+  put_escaped(w, value ? value : "");
+  put(w, "\"", 1);
 }
 
 void
 struct_field_int(struct struct_writer *w, const char *key, int value)
 {
   begin_field(w);
-  write(w->fd, "\"", 1);
-  write_str(w->fd, key ? key : "");
-  write(w->fd, "\":", 2);
-  printf(w->fd, "%d", value);
+  put(w, "\"", 1);
+  put_str(w, key ? key : "");
+  put(w, "\":", 2);
+  put_int(w, value);
 }
 
 void
 struct_end(struct struct_writer *w)
 {
-  write(w->fd, "}\n", 2);
+  put(w, "}\n", 2);
+  flush(w);
 }